@@ -573,9 +573,7 @@ cachedb_intcache_lookup(struct module_qstate* qstate)
 		/* lookup in negative cache; may result in 
 		 * NOERROR/NODATA or NXDOMAIN answers that need validation */
 		msg = val_neg_getmsg(qstate->env->neg_cache, &qstate->qinfo,
-			qstate->region, qstate->env->rrset_cache,
-			qstate->env->scratch_buffer,
-			*qstate->env->now, 1/*add SOA*/, NULL);
+			qstate->region, qstate->env, 1/*add SOA*/, NULL);
 	}
 	if(!msg)
 		return 0;
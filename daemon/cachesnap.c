@@ -0,0 +1,709 @@
+/*
+ * daemon/cachesnap.c - binary snapshot of the cache.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains functions to save the cache(s) to a binary
+ * snapshot file and to load them from it.
+ */
+#include "config.h"
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#include <sys/stat.h>
+#include <fcntl.h>
+#include "daemon/cachesnap.h"
+#include "services/cache/rrset.h"
+#include "services/cache/dns.h"
+#include "util/module.h"
+#include "util/data/msgreply.h"
+#include "util/data/packed_rrset.h"
+#include "util/data/dname.h"
+#include "util/storage/slabhash.h"
+#include "util/regional.h"
+#include "util/alloc.h"
+#include "util/log.h"
+#include "util/net_help.h"
+#include "sldns/sbuffer.h"
+
+/** snapshot file magic */
+#define SNAP_MAGIC "UBCS"
+/** snapshot file format version */
+#define SNAP_VERSION 1
+/** size of the snapshot header */
+#define SNAP_HEADER_SIZE 16
+/** record tag of an rrset */
+#define SNAP_TAG_RRSET 'R'
+/** record tag of a message */
+#define SNAP_TAG_MSG 'M'
+/** record tag of the end of the file */
+#define SNAP_TAG_END 'E'
+
+/** write 8 bit value to snapshot */
+static int
+snap_w8(FILE* out, uint8_t v)
+{
+	return fputc((int)v, out) != EOF;
+}
+
+/** write 16 bit value to snapshot, in network order */
+static int
+snap_w16(FILE* out, uint16_t v)
+{
+	uint8_t b[2];
+	sldns_write_uint16(b, v);
+	return fwrite(b, 1, sizeof(b), out) == sizeof(b);
+}
+
+/** write 32 bit value to snapshot, in network order */
+static int
+snap_w32(FILE* out, uint32_t v)
+{
+	uint8_t b[4];
+	sldns_write_uint32(b, v);
+	return fwrite(b, 1, sizeof(b), out) == sizeof(b);
+}
+
+/** write data block to snapshot */
+static int
+snap_wdata(FILE* out, const void* data, size_t len)
+{
+	return len == 0 || fwrite(data, 1, len, out) == len;
+}
+
+/** write dname to snapshot, with its length in front */
+static int
+snap_wdname(FILE* out, uint8_t* dname, size_t len)
+{
+	return snap_w16(out, (uint16_t)len) && snap_wdata(out, dname, len);
+}
+
+/** remaining ttl, that is not negative */
+static uint32_t
+snap_ttl(time_t ttl, time_t now)
+{
+	if(ttl < now)
+		return 0;
+	return (uint32_t)(ttl - now);
+}
+
+/** write rrset record, the rrset is locked by the caller */
+static int
+snap_write_rrset(FILE* out, struct ub_packed_rrset_key* k,
+	struct packed_rrset_data* d, time_t now, size_t* num)
+{
+	size_t i;
+	if(!k || !d || k->id == 0)
+		return 1;
+	if(d->ttl < now)
+		return 1; /* expired */
+	if(d->count + d->rrsig_count == 0)
+		return 1;
+	if(!snap_w8(out, SNAP_TAG_RRSET) ||
+		!snap_wdname(out, k->rk.dname, k->rk.dname_len) ||
+		!snap_w16(out, ntohs(k->rk.type)) ||
+		!snap_w16(out, ntohs(k->rk.rrset_class)) ||
+		!snap_w32(out, k->rk.flags) ||
+		!snap_w32(out, snap_ttl(d->ttl, now)) ||
+		!snap_w32(out, (uint32_t)d->count) ||
+		!snap_w32(out, (uint32_t)d->rrsig_count) ||
+		!snap_w8(out, (uint8_t)d->trust) ||
+		!snap_w8(out, (uint8_t)d->security))
+		return 0;
+	for(i=0; i<d->count + d->rrsig_count; i++) {
+		if(!snap_w32(out, snap_ttl(d->rr_ttl[i], now)) ||
+			!snap_w32(out, (uint32_t)d->rr_len[i]) ||
+			!snap_wdata(out, d->rr_data[i], d->rr_len[i]))
+			return 0;
+	}
+	(*num)++;
+	return 1;
+}
+
+/** write rrset cache to snapshot */
+static int
+snap_write_rrset_cache(FILE* out, struct rrset_cache* r, time_t now,
+	size_t* num)
+{
+	size_t slab;
+	struct lruhash_entry* e;
+	for(slab=0; slab<r->table.size; slab++) {
+		struct lruhash* h = r->table.array[slab];
+		lock_quick_lock(&h->lock);
+		for(e=h->lru_start; e; e = e->lru_next) {
+			lock_rw_rdlock(&e->lock);
+			if(!snap_write_rrset(out, (struct ub_packed_rrset_key*)
+				e->key, (struct packed_rrset_data*)e->data,
+				now, num)) {
+				lock_rw_unlock(&e->lock);
+				lock_quick_unlock(&h->lock);
+				return 0;
+			}
+			lock_rw_unlock(&e->lock);
+		}
+		lock_quick_unlock(&h->lock);
+	}
+	return 1;
+}
+
+/** copy msg entry into region, entry is locked by caller */
+static int
+snap_copy_msg(struct regional* region, struct lruhash_entry* e,
+	struct query_info** k, struct reply_info** d, uint16_t* hashflags)
+{
+	struct reply_info* rep = (struct reply_info*)e->data;
+	if(rep->rrset_count > RR_COUNT_MAX)
+		return 0; /* to protect against integer overflow */
+	*d = (struct reply_info*)regional_alloc_init(region, e->data,
+		sizeof(struct reply_info) +
+		sizeof(struct rrset_ref) * (rep->rrset_count-1) +
+		sizeof(struct ub_packed_rrset_key*) * rep->rrset_count);
+	if(!*d)
+		return 0;
+	(*d)->rrsets = (struct ub_packed_rrset_key**)(void *)(
+		(uint8_t*)(&((*d)->ref[0])) +
+		sizeof(struct rrset_ref) * rep->rrset_count);
+	*k = (struct query_info*)regional_alloc_init(region,
+		e->key, sizeof(struct query_info));
+	if(!*k)
+		return 0;
+	/* the CD flag is part of the hash for some queries */
+	*hashflags = (e->hash == query_info_hash(*k, 0))?0:BIT_CD;
+	(*k)->qname = regional_alloc_init(region,
+		(*k)->qname, (*k)->qname_len);
+	return (*k)->qname != NULL;
+}
+
+/** write msg record */
+static int
+snap_write_msg(FILE* out, struct query_info* k, struct reply_info* d,
+	uint16_t hashflags, time_t now, size_t* num)
+{
+	size_t i;
+	if(d->ttl < now)
+		return 1; /* expired */
+	if(!rrset_array_lock(d->ref, d->rrset_count, now))
+		return 1; /* rrsets have timed out or do not exist */
+	if(!snap_w8(out, SNAP_TAG_MSG) ||
+		!snap_wdname(out, k->qname, k->qname_len) ||
+		!snap_w16(out, k->qtype) ||
+		!snap_w16(out, k->qclass) ||
+		!snap_w16(out, hashflags) ||
+		!snap_w16(out, d->flags) ||
+		!snap_w16(out, (uint16_t)d->qdcount) ||
+		!snap_w32(out, snap_ttl(d->ttl, now)) ||
+		!snap_w32(out, snap_ttl(d->prefetch_ttl, now)) ||
+		!snap_w8(out, (uint8_t)d->security) ||
+		!snap_w32(out, (uint32_t)d->an_numrrsets) ||
+		!snap_w32(out, (uint32_t)d->ns_numrrsets) ||
+		!snap_w32(out, (uint32_t)d->ar_numrrsets)) {
+		rrset_array_unlock(d->ref, d->rrset_count);
+		return 0;
+	}
+	for(i=0; i<d->rrset_count; i++) {
+		struct ub_packed_rrset_key* rk = d->rrsets[i];
+		if(!snap_wdname(out, rk->rk.dname, rk->rk.dname_len) ||
+			!snap_w16(out, ntohs(rk->rk.type)) ||
+			!snap_w16(out, ntohs(rk->rk.rrset_class)) ||
+			!snap_w32(out, rk->rk.flags)) {
+			rrset_array_unlock(d->ref, d->rrset_count);
+			return 0;
+		}
+	}
+	rrset_array_unlock(d->ref, d->rrset_count);
+	(*num)++;
+	return 1;
+}
+
+/** write msg cache to snapshot */
+static int
+snap_write_msg_cache(FILE* out, struct slabhash* sh, struct regional* region,
+	time_t now, size_t* num)
+{
+	size_t slab;
+	struct lruhash_entry* e;
+	struct query_info* k;
+	struct reply_info* d;
+	uint16_t hashflags;
+	for(slab=0; slab<sh->size; slab++) {
+		struct lruhash* h = sh->array[slab];
+		lock_quick_lock(&h->lock);
+		for(e=h->lru_start; e; e = e->lru_next) {
+			regional_free_all(region);
+			lock_rw_rdlock(&e->lock);
+			if(!snap_copy_msg(region, e, &k, &d, &hashflags)) {
+				lock_rw_unlock(&e->lock);
+				lock_quick_unlock(&h->lock);
+				return 0;
+			}
+			lock_rw_unlock(&e->lock);
+			/* release lock so we can lock the rrset references
+			 * in the rrset cache */
+			if(!snap_write_msg(out, k, d, hashflags, now, num)) {
+				lock_quick_unlock(&h->lock);
+				return 0;
+			}
+		}
+		lock_quick_unlock(&h->lock);
+	}
+	regional_free_all(region);
+	return 1;
+}
+
+int
+cache_snapshot_write(struct module_env* env, struct regional* region,
+	const char* fname)
+{
+	char tempf[2048];
+	FILE* out;
+	time_t now = *env->now;
+	uint64_t tm = (uint64_t)time(NULL);
+	size_t num_rrset = 0, num_msg = 0;
+	int ok;
+
+	snprintf(tempf, sizeof(tempf), "%s-%u", fname, (unsigned)getpid());
+	out = fopen(tempf, "wb");
+	if(!out) {
+		log_err("could not open cache snapshot %s: %s", tempf,
+			strerror(errno));
+		return 0;
+	}
+	ok = snap_wdata(out, SNAP_MAGIC, 4) &&
+		snap_w32(out, SNAP_VERSION) &&
+		snap_w32(out, (uint32_t)(tm>>32)) &&
+		snap_w32(out, (uint32_t)(tm&0xffffffff)) &&
+		snap_write_rrset_cache(out, env->rrset_cache, now,
+			&num_rrset) &&
+		snap_write_msg_cache(out, env->msg_cache, region, now,
+			&num_msg) &&
+		snap_w8(out, SNAP_TAG_END);
+	if(fclose(out) != 0)
+		ok = 0;
+	if(!ok) {
+		log_err("could not write cache snapshot %s: %s", tempf,
+			strerror(errno));
+		(void)unlink(tempf);
+		return 0;
+	}
+#ifdef UB_ON_WINDOWS
+	(void)unlink(fname); /* windows does not replace file with rename() */
+#endif
+	if(rename(tempf, fname) < 0) {
+		log_err("rename(%s to %s): %s", tempf, fname, strerror(errno));
+		(void)unlink(tempf);
+		return 0;
+	}
+	verbose(VERB_OPS, "cache snapshot: wrote %u rrsets and %u messages "
+		"to %s", (unsigned)num_rrset, (unsigned)num_msg, fname);
+	return 1;
+}
+
+/** read position in the snapshot */
+struct snap_buf {
+	/** current position */
+	uint8_t* p;
+	/** number of octets left after the position */
+	size_t left;
+};
+
+/** read 8 bit value from snapshot */
+static int
+snap_r8(struct snap_buf* b, uint8_t* v)
+{
+	if(b->left < 1)
+		return 0;
+	*v = *b->p;
+	b->p++;
+	b->left--;
+	return 1;
+}
+
+/** read 16 bit value from snapshot */
+static int
+snap_r16(struct snap_buf* b, uint16_t* v)
+{
+	if(b->left < 2)
+		return 0;
+	*v = sldns_read_uint16(b->p);
+	b->p += 2;
+	b->left -= 2;
+	return 1;
+}
+
+/** read 32 bit value from snapshot */
+static int
+snap_r32(struct snap_buf* b, uint32_t* v)
+{
+	if(b->left < 4)
+		return 0;
+	*v = sldns_read_uint32(b->p);
+	b->p += 4;
+	b->left -= 4;
+	return 1;
+}
+
+/** skip data block in the snapshot, returns its start */
+static int
+snap_rdata(struct snap_buf* b, size_t len, uint8_t** data)
+{
+	if(b->left < len)
+		return 0;
+	*data = b->p;
+	b->p += len;
+	b->left -= len;
+	return 1;
+}
+
+/** read dname from snapshot, the dname is checked for validity */
+static int
+snap_rdname(struct snap_buf* b, uint8_t** dname, size_t* len)
+{
+	uint16_t l;
+	if(!snap_r16(b, &l) || l == 0 || !snap_rdata(b, l, dname))
+		return 0;
+	if(dname_valid(*dname, l) != l)
+		return 0;
+	*len = l;
+	return 1;
+}
+
+/** subtract elapsed time from ttl read from snapshot */
+static time_t
+snap_ttl_adjust(uint32_t ttl, time_t elapsed)
+{
+	if((time_t)ttl <= elapsed)
+		return 0;
+	return (time_t)ttl - elapsed;
+}
+
+/** read rrset record from snapshot and put it in the cache */
+static int
+snap_load_rrset(struct snap_buf* b, struct module_env* env, time_t elapsed,
+	size_t* num)
+{
+	uint8_t* dname, *start, *rrs, *rdata;
+	size_t dname_len, i, num_rr, total = 0;
+	uint16_t type, dclass;
+	uint32_t flags, ttl, count, rrsig_count, rr_ttl, rr_len;
+	uint8_t trust, security;
+	struct ub_packed_rrset_key* ak;
+	struct packed_rrset_data* ad;
+	struct rrset_ref ref;
+	time_t now = *env->now;
+
+	if(!snap_rdname(b, &dname, &dname_len) ||
+		!snap_r16(b, &type) || !snap_r16(b, &dclass) ||
+		!snap_r32(b, &flags) || !snap_r32(b, &ttl) ||
+		!snap_r32(b, &count) || !snap_r32(b, &rrsig_count) ||
+		!snap_r8(b, &trust) || !snap_r8(b, &security))
+		return 0;
+	if(count > RR_COUNT_MAX || rrsig_count > RR_COUNT_MAX ||
+		count + rrsig_count == 0)
+		return 0;
+	if(trust > (uint8_t)rrset_trust_ultimate ||
+		security > (uint8_t)sec_status_secure)
+		return 0;
+	num_rr = (size_t)count + (size_t)rrsig_count;
+	/* check the RRs, they are copied below */
+	start = b->p;
+	for(i=0; i<num_rr; i++) {
+		if(!snap_r32(b, &rr_ttl) || !snap_r32(b, &rr_len) ||
+			rr_len < 2 || !snap_rdata(b, rr_len, &rdata) ||
+			(size_t)sldns_read_uint16(rdata)+2 != rr_len)
+			return 0;
+		total += rr_len;
+	}
+	if(snap_ttl_adjust(ttl, elapsed) == 0)
+		return 1; /* expired */
+
+	ak = alloc_special_obtain(env->alloc);
+	if(!ak) {
+		log_err("cache snapshot: out of memory");
+		return 0;
+	}
+	ak->entry.data = NULL;
+	memset(&ak->rk, 0, sizeof(ak->rk));
+	ak->rk.type = htons(type);
+	ak->rk.rrset_class = htons(dclass);
+	ak->rk.flags = flags;
+	ak->rk.dname_len = dname_len;
+	ak->rk.dname = (uint8_t*)memdup(dname, dname_len);
+	if(!ak->rk.dname) {
+		log_err("cache snapshot: out of memory");
+		ub_packed_rrset_parsedelete(ak, env->alloc);
+		return 0;
+	}
+	ak->entry.hash = rrset_key_hash(&ak->rk);
+	ad = (struct packed_rrset_data*)malloc(sizeof(*ad) + (sizeof(size_t)
+		+ sizeof(uint8_t*) + sizeof(time_t))*num_rr + total);
+	if(!ad) {
+		log_err("cache snapshot: out of memory");
+		ub_packed_rrset_parsedelete(ak, env->alloc);
+		return 0;
+	}
+	memset(ad, 0, sizeof(*ad));
+	ad->ttl = snap_ttl_adjust(ttl, elapsed) + now;
+	ad->count = (size_t)count;
+	ad->rrsig_count = (size_t)rrsig_count;
+	ad->trust = (enum rrset_trust)trust;
+	ad->security = (enum sec_status)security;
+	/* the rr_len array is first, fill it in for the pointer fixup */
+	ad->rr_len = (size_t*)((uint8_t*)ad + sizeof(*ad));
+	rrs = start;
+	for(i=0; i<num_rr; i++) {
+		ad->rr_len[i] = sldns_read_uint32(rrs+4);
+		rrs += 8 + ad->rr_len[i];
+	}
+	packed_rrset_ptr_fixup(ad);
+	rrs = start;
+	for(i=0; i<num_rr; i++) {
+		ad->rr_ttl[i] = snap_ttl_adjust(sldns_read_uint32(rrs),
+			elapsed) + now;
+		memmove(ad->rr_data[i], rrs+8, ad->rr_len[i]);
+		rrs += 8 + ad->rr_len[i];
+	}
+	ak->entry.data = ad;
+
+	ref.key = ak;
+	ref.id = ak->id;
+	(void)rrset_cache_update(env->rrset_cache, &ref, env->alloc, now);
+	(*num)++;
+	return 1;
+}
+
+/** read msg record from snapshot and put it in the cache */
+static int
+snap_load_msg(struct snap_buf* b, struct module_env* env,
+	struct regional* region, time_t elapsed, size_t* num)
+{
+	struct query_info qinf;
+	struct reply_info rep;
+	uint8_t* dname;
+	size_t dname_len, i;
+	uint16_t type, dclass, hashflags, flags, qdcount;
+	uint32_t ttl, prefetch_ttl, an, ns, ar, rflags;
+	uint8_t security;
+	int go_on = 1;
+	time_t now = *env->now;
+
+	regional_free_all(region);
+	memset(&qinf, 0, sizeof(qinf));
+	memset(&rep, 0, sizeof(rep));
+	if(!snap_rdname(b, &qinf.qname, &qinf.qname_len) ||
+		!snap_r16(b, &qinf.qtype) || !snap_r16(b, &qinf.qclass) ||
+		!snap_r16(b, &hashflags) || !snap_r16(b, &flags) ||
+		!snap_r16(b, &qdcount) || !snap_r32(b, &ttl) ||
+		!snap_r32(b, &prefetch_ttl) || !snap_r8(b, &security) ||
+		!snap_r32(b, &an) || !snap_r32(b, &ns) || !snap_r32(b, &ar))
+		return 0;
+	if(an > RR_COUNT_MAX || ns > RR_COUNT_MAX || ar > RR_COUNT_MAX)
+		return 0; /* protect against integer overflow in alloc */
+	if(security > (uint8_t)sec_status_secure)
+		return 0;
+	rep.flags = flags;
+	rep.qdcount = (uint8_t)qdcount;
+	rep.ttl = snap_ttl_adjust(ttl, elapsed);
+	rep.prefetch_ttl = snap_ttl_adjust(prefetch_ttl, elapsed);
+	rep.security = (enum sec_status)security;
+	rep.an_numrrsets = (size_t)an;
+	rep.ns_numrrsets = (size_t)ns;
+	rep.ar_numrrsets = (size_t)ar;
+	rep.rrset_count = (size_t)an+(size_t)ns+(size_t)ar;
+	if(rep.ttl == 0)
+		go_on = 0; /* expired, read past it */
+	else if(rep.rrset_count > 0) {
+		rep.rrsets = (struct ub_packed_rrset_key**)regional_alloc_zero(
+			region, sizeof(struct ub_packed_rrset_key*)*
+			rep.rrset_count);
+		if(!rep.rrsets) {
+			log_err("cache snapshot: out of memory");
+			return 0;
+		}
+	}
+
+	/* fill reply with copies of the referenced rrsets */
+	for(i=0; i<rep.rrset_count; i++) {
+		struct ub_packed_rrset_key* k;
+		if(!snap_rdname(b, &dname, &dname_len) ||
+			!snap_r16(b, &type) || !snap_r16(b, &dclass) ||
+			!snap_r32(b, &rflags))
+			return 0;
+		if(!go_on)
+			continue;
+		k = rrset_cache_lookup(env->rrset_cache, dname, dname_len,
+			type, dclass, rflags, now, 0);
+		if(!k) {
+			/* not found or expired, skip the message */
+			go_on = 0;
+			continue;
+		}
+		rep.rrsets[i] = packed_rrset_copy_region(k, region, now);
+		lock_rw_unlock(&k->entry.lock);
+		if(!rep.rrsets[i]) {
+			log_err("cache snapshot: out of memory");
+			return 0;
+		}
+	}
+	if(!go_on)
+		return 1;
+
+	if(!dns_cache_store(env, &qinf, &rep, 0, 0, 0, NULL,
+		(uint32_t)hashflags)) {
+		log_err("cache snapshot: out of memory");
+		return 0;
+	}
+	(*num)++;
+	return 1;
+}
+
+/** read the records in the snapshot */
+static int
+snap_load_records(struct snap_buf* b, struct module_env* env,
+	struct regional* region, const char* fname)
+{
+	uint8_t* magic;
+	uint8_t tag;
+	uint32_t version, tm_hi, tm_lo;
+	uint64_t tm;
+	time_t elapsed;
+	size_t num_rrset = 0, num_msg = 0;
+
+	if(!snap_rdata(b, 4, &magic) || memcmp(magic, SNAP_MAGIC, 4) != 0 ||
+		!snap_r32(b, &version) || !snap_r32(b, &tm_hi) ||
+		!snap_r32(b, &tm_lo)) {
+		log_err("cache snapshot %s: not a cache snapshot", fname);
+		return 0;
+	}
+	if(version != SNAP_VERSION) {
+		log_err("cache snapshot %s: unknown version %u", fname,
+			(unsigned)version);
+		return 0;
+	}
+	tm = ((uint64_t)tm_hi<<32) | (uint64_t)tm_lo;
+	if((uint64_t)time(NULL) > tm)
+		elapsed = (time_t)((uint64_t)time(NULL) - tm);
+	else	elapsed = 0;
+
+	while(snap_r8(b, &tag)) {
+		if(tag == SNAP_TAG_RRSET) {
+			if(!snap_load_rrset(b, env, elapsed, &num_rrset))
+				break;
+		} else if(tag == SNAP_TAG_MSG) {
+			if(!snap_load_msg(b, env, region, elapsed, &num_msg))
+				break;
+		} else if(tag == SNAP_TAG_END) {
+			regional_free_all(region);
+			verbose(VERB_OPS, "cache snapshot: loaded %u rrsets "
+				"and %u messages from %s, %u seconds old",
+				(unsigned)num_rrset, (unsigned)num_msg, fname,
+				(unsigned)elapsed);
+			return 1;
+		} else	break;
+	}
+	regional_free_all(region);
+	log_err("cache snapshot %s: bad record after %u rrsets and "
+		"%u messages", fname, (unsigned)num_rrset, (unsigned)num_msg);
+	return 0;
+}
+
+int
+cache_snapshot_load(struct module_env* env, struct regional* region,
+	const char* fname)
+{
+	struct snap_buf b;
+	struct stat st;
+	uint8_t* data;
+	int fd, r;
+
+	fd = open(fname, O_RDONLY);
+	if(fd == -1) {
+		if(errno == ENOENT) {
+			verbose(VERB_OPS, "cache snapshot %s: no such file",
+				fname);
+			return 1;
+		}
+		log_err("could not open cache snapshot %s: %s", fname,
+			strerror(errno));
+		return 0;
+	}
+	if(fstat(fd, &st) == -1) {
+		log_err("could not stat cache snapshot %s: %s", fname,
+			strerror(errno));
+		close(fd);
+		return 0;
+	}
+	if(st.st_size < SNAP_HEADER_SIZE) {
+		log_err("cache snapshot %s: file too short", fname);
+		close(fd);
+		return 0;
+	}
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+	data = (uint8_t*)mmap(NULL, (size_t)st.st_size, PROT_READ,
+		MAP_PRIVATE, fd, 0);
+	if(data == (uint8_t*)MAP_FAILED) {
+		log_err("could not mmap cache snapshot %s: %s", fname,
+			strerror(errno));
+		close(fd);
+		return 0;
+	}
+#else
+	data = (uint8_t*)malloc((size_t)st.st_size);
+	if(!data) {
+		log_err("cache snapshot: out of memory");
+		close(fd);
+		return 0;
+	}
+	if(read(fd, data, (size_t)st.st_size) != (ssize_t)st.st_size) {
+		log_err("could not read cache snapshot %s: %s", fname,
+			strerror(errno));
+		free(data);
+		close(fd);
+		return 0;
+	}
+#endif
+	close(fd);
+
+	b.p = data;
+	b.left = (size_t)st.st_size;
+	r = snap_load_records(&b, env, region, fname);
+
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+	(void)munmap(data, (size_t)st.st_size);
+#else
+	free(data);
+#endif
+	return r;
+}
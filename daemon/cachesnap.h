@@ -0,0 +1,95 @@
+/*
+ * daemon/cachesnap.h - binary snapshot of the cache.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains functions to save the message and rrset caches
+ * to a binary snapshot file, and to load them from that file again.
+ * The snapshot is written when the server exits, and read when it
+ * starts, before the threads answer queries, so that a restart does
+ * not begin with an empty cache.
+ *
+ * The file is read with mmap, and all numbers are in network order.
+ * The format of the file is:
+ * header: magic "UBCS", uint32 version, and the time of writing, as
+ * 	the uint32 high and uint32 low part of the 64bit value.
+ * then a list of records, each record starts with a tag octet:
+ * 'R' rrset: uint16 dname_len, dname, uint16 type, uint16 class,
+ * 	uint32 flags, uint32 ttl, uint32 count, uint32 rrsig_count,
+ * 	uint8 trust, uint8 security, and then per RR: uint32 ttl,
+ * 	uint32 len, rdata (including the rdata length).
+ * 'M' msg: uint16 qname_len, qname, uint16 qtype, uint16 qclass,
+ * 	uint16 hashflags, uint16 flags, uint16 qdcount, uint32 ttl,
+ * 	uint32 prefetch_ttl, uint8 security, uint32 an, ns, ar, and
+ * 	then per rrset reference: uint16 dname_len, dname, uint16 type,
+ * 	uint16 class, uint32 flags.
+ * 'E' end of the file.
+ *
+ * The TTLs in the file are the remaining TTLs at the time of writing.
+ * When loading, the time elapsed since then is subtracted, and entries
+ * that have expired are not loaded.  Message references to rrsets that
+ * are not in the cache cause the message to be skipped.
+ */
+
+#ifndef DAEMON_CACHESNAP_H
+#define DAEMON_CACHESNAP_H
+struct module_env;
+struct regional;
+
+/**
+ * Write the message and rrset cache to a snapshot file.
+ * The file is written to a temporary file, and then renamed over fname.
+ * @param env: module env with the caches and the current time.
+ * @param region: scratch region for temporary copies.
+ * @param fname: file name of the snapshot.
+ * @return false on failure, error is logged.
+ */
+int cache_snapshot_write(struct module_env* env, struct regional* region,
+	const char* fname);
+
+/**
+ * Load the message and rrset cache from a snapshot file.
+ * @param env: module env with the caches, the current time and the alloc
+ * 	cache to allocate rrsets with.
+ * @param region: scratch region for temporary copies.
+ * @param fname: file name of the snapshot.
+ * @return false on failure, error is logged.  Entries that were read
+ * 	before the failure stay in the cache.
+ */
+int cache_snapshot_load(struct module_env* env, struct regional* region,
+	const char* fname);
+
+#endif /* DAEMON_CACHESNAP_H */
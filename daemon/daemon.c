@@ -60,6 +60,9 @@
 #include <time.h>
 #endif
 #include <sys/time.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 #ifdef HAVE_NSS
 /* nss3 */
@@ -70,6 +73,7 @@
 #include "daemon/worker.h"
 #include "daemon/remote.h"
 #include "daemon/acl_list.h"
+#include "daemon/cachesnap.h"
 #include "util/log.h"
 #include "util/config_file.h"
 #include "util/data/msgreply.h"
@@ -77,6 +81,8 @@
 #include "util/storage/lookup3.h"
 #include "util/storage/slabhash.h"
 #include "services/listen_dnsport.h"
+#include "services/inflight.h"
+#include "validator/val_cryptopool.h"
 #include "services/cache/rrset.h"
 #include "services/cache/infra.h"
 #include "services/localzone.h"
@@ -86,6 +92,7 @@
 #include "util/random.h"
 #include "util/tube.h"
 #include "util/net_help.h"
+#include "util/regional.h"
 #include "sldns/keyraw.h"
 #include "respip/respip.h"
 #include <signal.h>
@@ -197,6 +204,194 @@ signal_handling_playback(struct worker* wrk)
 	sig_record_reload = 0;
 }
 
+/**
+ * Get the CPUs that the process may run on, before threads are pinned.
+ * @param daemon: the daemon, cpus_allowed is filled in.
+ */
+static void
+daemon_get_cpus_allowed(struct daemon* daemon)
+{
+#ifdef CPU_SET
+	cpu_set_t set;
+	int i, num;
+	CPU_ZERO(&set);
+	if(sched_getaffinity(0, sizeof(set), &set) != 0) {
+		log_err("sched_getaffinity: %s", strerror(errno));
+		return;
+	}
+	num = CPU_COUNT(&set);
+	if(num <= 0 || !(daemon->cpus_allowed = (int*)reallocarray(NULL,
+		(size_t)num, sizeof(int))))
+		return;
+	for(i=0; i<CPU_SETSIZE && daemon->num_cpus_allowed<num; i++) {
+		if(CPU_ISSET(i, &set))
+			daemon->cpus_allowed[daemon->num_cpus_allowed++] = i;
+	}
+#else
+	(void)daemon;
+#endif
+}
+
+/**
+ * Set the CPU affinity of the calling thread.
+ * @param cpus: the CPUs it may run on.
+ * @param num: number of CPUs in the array.
+ */
+static void
+daemon_set_affinity(int* cpus, int num)
+{
+#ifdef CPU_SET
+	cpu_set_t set;
+	int i;
+	CPU_ZERO(&set);
+	for(i=0; i<num; i++) {
+		if(cpus[i] < CPU_SETSIZE)
+			CPU_SET(cpus[i], &set);
+	}
+	if(sched_setaffinity(0, sizeof(set), &set) != 0)
+		log_warn("could not set cpu affinity to cpu %d: %s",
+			(num?cpus[0]:-1), strerror(errno));
+#else
+	(void)cpus; (void)num;
+#endif
+}
+
+/**
+ * Create the table of queries in flight that the threads share, for
+ * inflight-dedup.
+ * @param daemon: the daemon, its workers are created.
+ */
+static void
+daemon_setup_inflight(struct daemon* daemon)
+{
+	struct tube** wake;
+	int i;
+	if(!daemon->cfg->inflight_dedup || daemon->num < 2)
+		return;
+#ifdef THREADS_DISABLED
+	log_warn("inflight-dedup needs threads, it is not enabled");
+	return;
+#endif
+	wake = (struct tube**)reallocarray(NULL, (size_t)daemon->num,
+		sizeof(*wake));
+	if(!wake)
+		fatal_exit("could not create inflight table: out of memory");
+	for(i=0; i<daemon->num; i++)
+		wake[i] = daemon->workers[i]->wake;
+	daemon->inflight = inflight_create((size_t)daemon->num*
+		(size_t)daemon->cfg->num_queries_per_thread,
+		daemon->num, wake);
+	free(wake);
+	if(!daemon->inflight)
+		fatal_exit("could not create inflight table: out of memory");
+}
+
+/**
+ * Start the threads that verify signatures for the workers, for
+ * crypto-threads.
+ * @param daemon: the daemon, its workers are created.
+ */
+static void
+daemon_setup_crypto(struct daemon* daemon)
+{
+	struct tube** wake;
+	int i;
+	if(!daemon->cfg->crypto_threads ||
+		modstack_find(&daemon->mods, "validator") == -1)
+		return;
+#ifdef THREADS_DISABLED
+	log_warn("crypto-threads needs threads, it is not enabled");
+	return;
+#endif
+	wake = (struct tube**)reallocarray(NULL, (size_t)daemon->num,
+		sizeof(*wake));
+	if(!wake)
+		fatal_exit("could not create crypto threads: out of memory");
+	for(i=0; i<daemon->num; i++)
+		wake[i] = daemon->workers[i]->crypto_wake;
+	daemon->crypto = crypto_pool_create(daemon->cfg->crypto_threads,
+		daemon->num, wake);
+	free(wake);
+	if(!daemon->crypto)
+		fatal_exit("could not create crypto threads: out of memory");
+}
+
+/**
+ * Decide the CPU of every thread for cpu-affinity, and attach or remove
+ * the so-reuseport-cbpf filter.  The main thread is pinned here, the
+ * other threads pin themselves when they start.
+ * @param daemon: the daemon, its workers are created.
+ */
+static void
+daemon_setup_cpus(struct daemon* daemon)
+{
+	int* list = NULL, *use;
+	int i, j, n;
+	if(daemon->cpus) {
+		/* restore, threads are created with the main affinity */
+		free(daemon->cpus);
+		daemon->cpus = NULL;
+		if(daemon->cpus_allowed)
+			daemon_set_affinity(daemon->cpus_allowed,
+				daemon->num_cpus_allowed);
+	}
+	if(daemon->cfg->cpu_affinity) {
+#ifdef CPU_SET
+		n = cfg_parse_cpu_list(daemon->cfg->cpu_affinity_list, &list);
+		if(n < 0)
+			fatal_exit("could not parse cpu-affinity-list");
+		use = list;
+		if(n == 0) {
+			use = daemon->cpus_allowed;
+			n = daemon->num_cpus_allowed;
+		}
+		if(n > 0 && (daemon->cpus = (int*)reallocarray(NULL,
+			(size_t)daemon->num, sizeof(int))) != NULL) {
+			for(i=0; i<daemon->num; i++)
+				daemon->cpus[i] = use[i%n];
+			daemon_set_affinity(&daemon->cpus[0], 1);
+			verbose(VERB_OPS, "cpu-affinity: %d threads pinned "
+				"to %d cpus", daemon->num, n);
+		} else log_warn("cpu-affinity: no cpus to pin threads to");
+		free(list);
+#else
+		log_warn("cpu-affinity is not supported on this system");
+#endif
+	}
+
+	if(!daemon->cfg->so_reuseport_cbpf) {
+		if(daemon->reuseport_cbpf)
+			(void)listening_ports_steer_cpu(daemon->ports[0],
+				NULL, 0);
+		daemon->reuseport_cbpf = 0;
+		return;
+	}
+	if(!daemon->reuseport || daemon->num != (int)daemon->num_ports) {
+		log_warn("so-reuseport-cbpf needs so-reuseport sockets for "
+			"every thread");
+		return;
+	}
+	if(!daemon->cpus) {
+		log_warn("so-reuseport-cbpf needs cpu-affinity");
+		return;
+	}
+	for(i=0; i<daemon->num; i++) {
+		for(j=0; j<i; j++) {
+			if(daemon->cpus[i] == daemon->cpus[j]) {
+				log_warn("so-reuseport-cbpf needs a different "
+					"cpu for every thread");
+				return;
+			}
+		}
+	}
+	if(listening_ports_steer_cpu(daemon->ports[0], daemon->cpus,
+		daemon->num)) {
+		daemon->reuseport_cbpf = 1;
+		verbose(VERB_OPS, "so-reuseport-cbpf: queries are steered "
+			"to the thread on the receiving cpu");
+	}
+}
+
 struct daemon* 
 daemon_init(void)
 {
@@ -281,6 +476,7 @@ daemon_init(void)
 	if(gettimeofday(&daemon->time_boot, NULL) < 0)
 		log_err("gettimeofday: %s", strerror(errno));
 	daemon->time_last_stat = daemon->time_boot;
+	daemon_get_cpus_allowed(daemon);
 	return daemon;	
 }
 
@@ -509,6 +705,10 @@ thread_start(void* arg)
 	else
 		port_num = 0;
 #endif
+	/* pin before init, so the worker memory is close to its cpu */
+	if(worker->daemon->cpus)
+		daemon_set_affinity(&worker->daemon->cpus[worker->thread_num],
+			1);
 	if(!worker_init(worker, worker->daemon->cfg,
 			worker->daemon->ports[port_num], 0))
 		fatal_exit("Could not initialize thread");
@@ -562,6 +762,70 @@ daemon_stop_others(struct daemon* daemon)
 	}
 }
 
+/**
+ * Load the cache snapshot into the caches, before the threads start to
+ * answer queries.  It is only loaded when the server starts, a reload
+ * starts with empty caches.
+ * @param daemon: the daemon with the caches.
+ */
+static void
+daemon_load_cache_snapshot(struct daemon* daemon)
+{
+	struct config_file* cfg = daemon->cfg;
+	struct module_env env;
+	struct alloc_cache alloc;
+	struct regional* region;
+	time_t now = time(NULL);
+	char* fname;
+
+	if(daemon->cache_snapshot_loaded)
+		return;
+	daemon->cache_snapshot_loaded = 1;
+	if(!cfg->cache_snapshot_file || !cfg->cache_snapshot_file[0])
+		return;
+	if(!(fname = fname_after_chroot(cfg->cache_snapshot_file, cfg, 1))) {
+		log_err("out of memory");
+		return;
+	}
+	if(!(region = regional_create())) {
+		log_err("out of memory");
+		free(fname);
+		return;
+	}
+	/* the thread number after the workers, so that the rrset IDs do
+	 * not collide with the IDs that the worker threads hand out */
+	alloc_init(&alloc, &daemon->superalloc, daemon->num);
+	env = *daemon->env;
+	env.alloc = &alloc;
+	env.now = &now;
+	(void)cache_snapshot_load(&env, region, fname);
+	alloc_clear(&alloc);
+	regional_destroy(region);
+	free(fname);
+}
+
+/**
+ * Save the cache snapshot, when the server exits.
+ * @param daemon: the daemon, with the main worker that is stopped but not
+ * 	deleted, its buffers are used.
+ */
+static void
+daemon_save_cache_snapshot(struct daemon* daemon)
+{
+	struct config_file* cfg = daemon->cfg;
+	struct worker* worker = daemon->workers[0];
+	char* fname;
+
+	if(!cfg->cache_snapshot_file || !cfg->cache_snapshot_file[0])
+		return;
+	if(!(fname = fname_after_chroot(cfg->cache_snapshot_file, cfg, 1))) {
+		log_err("out of memory");
+		return;
+	}
+	(void)cache_snapshot_write(&worker->env, worker->scratchpad, fname);
+	free(fname);
+}
+
 void 
 daemon_fork(struct daemon* daemon)
 {
@@ -619,6 +883,18 @@ daemon_fork(struct daemon* daemon)
 	 */
 	daemon_create_workers(daemon);
 
+	/* pin the main thread and steer queries to the threads' cpus */
+	daemon_setup_cpus(daemon);
+
+	/* the threads share the queries in flight */
+	daemon_setup_inflight(daemon);
+
+	/* signatures are verified by the crypto threads */
+	daemon_setup_crypto(daemon);
+
+	/* fill the cache from the snapshot before queries are answered */
+	daemon_load_cache_snapshot(daemon);
+
 #if defined(HAVE_EV_LOOP) || defined(HAVE_EV_DEFAULT_LOOP)
 	/* in libev the first inited base gets signals */
 	if(!worker_init(daemon->workers[0], daemon->cfg, daemon->ports[0], 1))
@@ -657,6 +933,10 @@ daemon_fork(struct daemon* daemon)
 	/* we exited! a signal happened! Stop other threads */
 	daemon_stop_others(daemon);
 
+	/* save the cache when the server exits, not when it reloads */
+	if(daemon->workers[0]->need_to_exit)
+		daemon_save_cache_snapshot(daemon);
+
 	/* Shutdown SHM */
 	shm_main_shutdown(daemon);
 
@@ -685,8 +965,16 @@ daemon_cleanup(struct daemon* daemon)
 	daemon->views = NULL;
 	/* key cache is cleared by module desetup during next daemon_fork() */
 	daemon_remote_clear(daemon->rc);
+	/* the threads have stopped, no more wakeups for deleted workers */
+	inflight_clear(daemon->inflight);
+	crypto_pool_stop(daemon->crypto);
 	for(i=0; i<daemon->num; i++)
 		worker_delete(daemon->workers[i]);
+	inflight_delete(daemon->inflight);
+	daemon->inflight = NULL;
+	/* after the workers, their queries no longer refer to the jobs */
+	crypto_pool_delete(daemon->crypto);
+	daemon->crypto = NULL;
 	free(daemon->workers);
 	daemon->workers = NULL;
 	daemon->num = 0;
@@ -710,6 +998,8 @@ daemon_delete(struct daemon* daemon)
 	for(i = 0; i < daemon->num_ports; i++)
 		listening_ports_free(daemon->ports[i]);
 	free(daemon->ports);
+	free(daemon->cpus);
+	free(daemon->cpus_allowed);
 	listening_ports_free(daemon->rc_ports);
 	if(daemon->env) {
 		slabhash_delete(daemon->env->msg_cache);
@@ -791,6 +1081,7 @@ void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 			fatal_exit("malloc failure updating config settings");
 		}
 	}
+	slabhash_setclock(daemon->env->msg_cache, cfg->cache_clock_eviction);
 	if((daemon->env->rrset_cache = rrset_cache_adjust(
 		daemon->env->rrset_cache, cfg, &daemon->superalloc)) == 0)
 		fatal_exit("malloc failure updating config settings");
@@ -55,6 +55,8 @@ struct acl_list;
 struct local_zones;
 struct views;
 struct ub_randstate;
+struct inflight_table;
+struct crypto_pool;
 struct daemon_remote;
 struct respip_set;
 struct shm_main_info;
@@ -89,6 +91,14 @@ struct daemon {
 	size_t num_ports;
 	/** reuseport is enabled if true */
 	int reuseport;
+	/** the CPU of every thread, with cpu-affinity, or NULL if not pinned */
+	int* cpus;
+	/** the CPUs the process was allowed to run on at startup */
+	int* cpus_allowed;
+	/** number of CPUs in cpus_allowed */
+	int num_cpus_allowed;
+	/** if a so-reuseport-cbpf filter is attached to the ports */
+	int reuseport_cbpf;
 	/** port number for remote that has ports opened. */
 	int rc_port;
 	/** listening ports for remote control */
@@ -101,6 +111,10 @@ struct daemon {
 	int num;
 	/** the worker entries */
 	struct worker** workers;
+	/** shared table of queries in flight, with inflight-dedup, or NULL */
+	struct inflight_table* inflight;
+	/** threads that verify signatures, with crypto-threads, or NULL */
+	struct crypto_pool* crypto;
 	/** do we need to exit unbound (or is it only a reload?) */
 	int need_to_exit;
 	/** master random table ; used for port div between threads on reload*/
@@ -130,6 +144,8 @@ struct daemon {
 	struct respip_set* respip_set;
 	/** some response-ip tags or actions are configured if true */
 	int use_response_ip;
+	/** the cache snapshot has been loaded, it is loaded once, at start */
+	int cache_snapshot_loaded;
 #ifdef USE_DNSCRYPT
 	/** the dnscrypt environment */
 	struct dnsc_env* dnscenv;
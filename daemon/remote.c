@@ -59,6 +59,7 @@
 #include "daemon/daemon.h"
 #include "daemon/stats.h"
 #include "daemon/cachedump.h"
+#include "daemon/cachesnap.h"
 #include "util/log.h"
 #include "util/config_file.h"
 #include "util/net_help.h"
@@ -748,6 +749,10 @@ print_stats(SSL* ssl, const char* nm, struct ub_stats_info* s)
 		(unsigned long)s->svr.num_queries_prefetch)) return 0;
 	if(!ssl_printf(ssl, "%s.num.zero_ttl"SQ"%lu\n", nm,
 		(unsigned long)s->svr.zero_ttl_responses)) return 0;
+	if(!ssl_printf(ssl, "%s.num.wirecache"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_wirecache_hits)) return 0;
+	if(!ssl_printf(ssl, "%s.num.dedup"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_queries_dedup)) return 0;
 	if(!ssl_printf(ssl, "%s.num.recursivereplies"SQ"%lu\n", nm, 
 		(unsigned long)s->mesh_replies_sent)) return 0;
 #ifdef USE_DNSCRYPT
@@ -786,6 +791,11 @@ print_stats(SSL* ssl, const char* nm, struct ub_stats_info* s)
 		s->mesh_time_median)) return 0;
 	if(!ssl_printf(ssl, "%s.tcpusage"SQ"%lu\n", nm,
 		(unsigned long)s->svr.tcp_accept_usage)) return 0;
+	if(!ssl_printf(ssl, "%s.udp.batch.num"SQ"%lu\n", nm,
+		(unsigned long)s->svr.udp_batches)) return 0;
+	if(!ssl_printf(ssl, "%s.udp.batch.avg"SQ"%g\n", nm,
+		s->svr.udp_batches?(double)s->svr.udp_batch_pkts/
+		(double)s->svr.udp_batches : 0.0)) return 0;
 	return 1;
 }
 
@@ -994,6 +1004,16 @@ print_ext(SSL* ssl, struct ub_stats_info* s)
 		(unsigned long)s->svr.qtcp)) return 0;
 	if(!ssl_printf(ssl, "num.query.tcpout"SQ"%lu\n", 
 		(unsigned long)s->svr.qtcp_outgoing)) return 0;
+	if(!ssl_printf(ssl, "num.query.tcpout.reuse"SQ"%lu\n", 
+		(unsigned long)s->svr.qtcp_outgoing_reuse)) return 0;
+	if(!ssl_printf(ssl, "num.tcpout.open"SQ"%lu\n", 
+		(unsigned long)s->svr.tcp_outgoing_open)) return 0;
+	if(!ssl_printf(ssl, "num.tcpout.tlshandshake"SQ"%lu\n", 
+		(unsigned long)s->svr.tls_outgoing_handshake)) return 0;
+	if(!ssl_printf(ssl, "num.query.udpout.batched"SQ"%lu\n", 
+		(unsigned long)s->svr.qudp_outgoing_batched)) return 0;
+	if(!ssl_printf(ssl, "num.udpout.batch.sends"SQ"%lu\n", 
+		(unsigned long)s->svr.udp_outgoing_batch_sends)) return 0;
 	if(!ssl_printf(ssl, "num.query.ipv6"SQ"%lu\n", 
 		(unsigned long)s->svr.qipv6)) return 0;
 	/* flags */
@@ -1039,6 +1059,16 @@ print_ext(SSL* ssl, struct ub_stats_info* s)
 	/* iteration */
 	if(!ssl_printf(ssl, "num.query.ratelimited"SQ"%lu\n", 
 		(unsigned long)s->svr.queries_ratelimited)) return 0;
+	if(!ssl_printf(ssl, "num.query.fanout"SQ"%lu\n", 
+		(unsigned long)s->svr.target_fanout)) return 0;
+	if(!ssl_printf(ssl, "num.query.fanout.fetch"SQ"%lu\n", 
+		(unsigned long)s->svr.target_fanout_fetch)) return 0;
+	if(!ssl_printf(ssl, "num.query.fanout.cancel"SQ"%lu\n", 
+		(unsigned long)s->svr.target_fanout_cancel)) return 0;
+	if(!ssl_printf(ssl, "num.query.aggressive.NXDOMAIN"SQ"%lu\n", 
+		(unsigned long)s->svr.neg_synth_nxdomain)) return 0;
+	if(!ssl_printf(ssl, "num.query.aggressive.NOERROR"SQ"%lu\n", 
+		(unsigned long)s->svr.neg_synth_nodata)) return 0;
 	/* validation */
 	if(!ssl_printf(ssl, "num.answer.secure"SQ"%lu\n", 
 		(unsigned long)s->svr.ans_secure)) return 0;
@@ -1046,6 +1076,30 @@ print_ext(SSL* ssl, struct ub_stats_info* s)
 		(unsigned long)s->svr.ans_bogus)) return 0;
 	if(!ssl_printf(ssl, "num.rrset.bogus"SQ"%lu\n", 
 		(unsigned long)s->svr.rrset_bogus)) return 0;
+	if(!ssl_printf(ssl, "num.sigcache.hit"SQ"%lu\n", 
+		(unsigned long)s->svr.sig_cache_hit)) return 0;
+	if(!ssl_printf(ssl, "num.sigcache.miss"SQ"%lu\n", 
+		(unsigned long)s->svr.sig_cache_miss)) return 0;
+	if(!ssl_printf(ssl, "num.nsec3cache.hit"SQ"%lu\n", 
+		(unsigned long)s->svr.nsec3_cache_hit)) return 0;
+	if(!ssl_printf(ssl, "num.nsec3cache.miss"SQ"%lu\n", 
+		(unsigned long)s->svr.nsec3_cache_miss)) return 0;
+	if(!ssl_printf(ssl, "num.crypto.jobs"SQ"%lu\n", 
+		(unsigned long)s->svr.crypto_jobs)) return 0;
+	for(i=0; i<UB_STATS_CRYPTO_HIST_NUM; i++) {
+		if(inhibit_zero && s->svr.crypto_queue_hist[i] == 0)
+			continue;
+		if(!ssl_printf(ssl, "histogram.crypto.queue.%d.to.%d"SQ"%lu\n",
+			(i?(1<<i):0), (1<<(i+1)),
+			(unsigned long)s->svr.crypto_queue_hist[i])) return 0;
+	}
+	for(i=0; i<UB_STATS_CRYPTO_HIST_NUM; i++) {
+		if(inhibit_zero && s->svr.crypto_verify_hist[i] == 0)
+			continue;
+		if(!ssl_printf(ssl, "histogram.crypto.verify.%d.to.%d"SQ"%lu\n",
+			(i?(1<<i):0), (1<<(i+1)),
+			(unsigned long)s->svr.crypto_verify_hist[i])) return 0;
+	}
 	/* threat detection */
 	if(!ssl_printf(ssl, "unwanted.queries"SQ"%lu\n", 
 		(unsigned long)s->svr.unwanted_queries)) return 0;
@@ -1060,6 +1114,10 @@ print_ext(SSL* ssl, struct ub_stats_info* s)
 		(unsigned)s->svr.infra_cache_count)) return 0;
 	if(!ssl_printf(ssl, "key.cache.count"SQ"%u\n",
 		(unsigned)s->svr.key_cache_count)) return 0;
+	if(!ssl_printf(ssl, "sig.cache.count"SQ"%u\n",
+		(unsigned)s->svr.sig_cache_count)) return 0;
+	if(!ssl_printf(ssl, "nsec3.cache.count"SQ"%u\n",
+		(unsigned)s->svr.nsec3_cache_count)) return 0;
 #ifdef USE_DNSCRYPT
 	if(!ssl_printf(ssl, "dnscrypt_shared_secret.cache.count"SQ"%u\n",
 		(unsigned)s->svr.shared_secret_cache_count)) return 0;
@@ -1560,7 +1618,10 @@ infra_del_host(struct lruhash_entry* e, void* arg)
 	/* entry is locked */
 	struct del_info* inf = (struct del_info*)arg;
 	struct infra_key* k = (struct infra_key*)e->key;
-	if(sockaddr_cmp(&inf->addr, inf->addrlen, &k->addr, k->addrlen) == 0) {
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	infra_addr_unpack(&k->addr, &addr, &addrlen);
+	if(sockaddr_cmp(&inf->addr, inf->addrlen, &addr, addrlen) == 0) {
 		struct infra_data* d = (struct infra_data*)e->data;
 		d->probedelay = 0;
 		d->timeout_A = 0;
@@ -1574,6 +1635,27 @@ infra_del_host(struct lruhash_entry* e, void* arg)
 	}
 }
 
+/** callback to expire the shared server information of a host */
+static void
+infra_del_server(struct lruhash_entry* e, void* arg)
+{
+	/* entry is locked */
+	struct del_info* inf = (struct del_info*)arg;
+	struct infra_server_key* k = (struct infra_server_key*)e->key;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	infra_addr_unpack(&k->addr, &addr, &addrlen);
+	if(sockaddr_cmp(&inf->addr, inf->addrlen, &addr, addrlen) == 0) {
+		struct infra_server_data* d =
+			(struct infra_server_data*)e->data;
+		rtt_init(&d->rtt);
+		if(d->ttl > inf->expired) {
+			d->ttl = inf->expired;
+			inf->num_keys++;
+		}
+	}
+}
+
 /** flush infra cache */
 static void
 do_flush_infra(SSL* ssl, struct worker* worker, char* arg)
@@ -1583,6 +1665,8 @@ do_flush_infra(SSL* ssl, struct worker* worker, char* arg)
 	struct del_info inf;
 	if(strcmp(arg, "all") == 0) {
 		slabhash_clear(worker->env.infra_cache->hosts);
+		if(worker->env.infra_cache->servers)
+			slabhash_clear(worker->env.infra_cache->servers);
 		send_ok(ssl);
 		return;
 	}
@@ -1605,6 +1689,9 @@ do_flush_infra(SSL* ssl, struct worker* worker, char* arg)
 	memmove(&inf.addr, &addr, len);
 	slabhash_traverse(worker->env.infra_cache->hosts, 1, &infra_del_host,
 		&inf);
+	if(worker->env.infra_cache->servers)
+		slabhash_traverse(worker->env.infra_cache->servers, 1,
+			&infra_del_server, &inf);
 	send_ok(ssl);
 }
 
@@ -1743,6 +1830,34 @@ bogus_del_kcache(struct lruhash_entry* e, void* arg)
 	}
 }
 
+/** write the cache snapshot to the given or the configured file */
+static void
+do_cache_snapshot(SSL* ssl, struct worker* worker, char* arg)
+{
+	struct config_file* cfg = worker->env.cfg;
+	char* fname;
+	if(*arg)
+		fname = strdup(arg);
+	else if(cfg->cache_snapshot_file && cfg->cache_snapshot_file[0])
+		fname = fname_after_chroot(cfg->cache_snapshot_file, cfg, 1);
+	else {
+		(void)ssl_printf(ssl, "error no cache-snapshot-file "
+			"configured and no file given\n");
+		return;
+	}
+	if(!fname) {
+		(void)ssl_printf(ssl, "error out of memory\n");
+		return;
+	}
+	if(!cache_snapshot_write(&worker->env, worker->scratchpad, fname)) {
+		(void)ssl_printf(ssl, "error could not write %s\n", fname);
+		free(fname);
+		return;
+	}
+	free(fname);
+	send_ok(ssl);
+}
+
 /** remove all bogus rrsets, msgs and keys from cache */
 static void
 do_flush_bogus(SSL* ssl, struct worker* worker)
@@ -2332,7 +2447,7 @@ do_dump_requestlist(SSL* ssl, struct worker* worker)
 	/* show worker mesh contents */
 	mesh = worker->env.mesh;
 	if(!mesh) return;
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
+	for(m = mesh->all_first; m; m = m->all_next) {
 		char* t = sldns_wire2str_type(m->s.qinfo.qtype);
 		char* c = sldns_wire2str_class(m->s.qinfo.qclass);
 		dname_str(m->s.qinfo.qname, buf);
@@ -2371,14 +2486,17 @@ dump_infra_host(struct lruhash_entry* e, void* arg)
 	struct infra_arg* a = (struct infra_arg*)arg;
 	struct infra_key* k = (struct infra_key*)e->key;
 	struct infra_data* d = (struct infra_data*)e->data;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
 	char ip_str[1024];
 	char name[257];
 	int port;
 	if(a->ssl_failed)
 		return;
-	addr_to_str(&k->addr, k->addrlen, ip_str, sizeof(ip_str));
+	infra_addr_unpack(&k->addr, &addr, &addrlen);
+	addr_to_str(&addr, addrlen, ip_str, sizeof(ip_str));
 	dname_str(k->zonename, name);
-	port = (int)ntohs(((struct sockaddr_in*)&k->addr)->sin_port);
+	port = (int)ntohs(((struct sockaddr_in*)&addr)->sin_port);
 	if(port != UNBOUND_DNS_PORT) {
 		snprintf(ip_str+strlen(ip_str), sizeof(ip_str)-strlen(ip_str),
 			"@%d", port);
@@ -2421,6 +2539,54 @@ do_dump_infra(SSL* ssl, struct worker* worker)
 	slabhash_traverse(arg.infra->hosts, 0, &dump_infra_host, (void*)&arg);
 }
 
+/** dump the latency histogram percentiles of a host */
+static void
+dump_latency_host(struct lruhash_entry* e, void* arg)
+{
+	struct infra_arg* a = (struct infra_arg*)arg;
+	struct infra_key* k = (struct infra_key*)e->key;
+	struct infra_data* d = (struct infra_data*)e->data;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	char ip_str[1024];
+	char name[257];
+	int i, port, replies = 0;
+	if(a->ssl_failed || d->ttl < a->now)
+		return;
+	for(i=0; i<INFRA_LAT_BUCKETS; i++)
+		replies += (int)d->lat_hist[i];
+	if(replies == 0 && d->lat_lost == 0)
+		return;
+	infra_addr_unpack(&k->addr, &addr, &addrlen);
+	addr_to_str(&addr, addrlen, ip_str, sizeof(ip_str));
+	dname_str(k->zonename, name);
+	port = (int)ntohs(((struct sockaddr_in*)&addr)->sin_port);
+	if(port != UNBOUND_DNS_PORT) {
+		snprintf(ip_str+strlen(ip_str), sizeof(ip_str)-strlen(ip_str),
+			"@%d", port);
+	}
+	if(!ssl_printf(a->ssl, "%s %s replies %d lost %d p50 %d p90 %d "
+		"p99 %d\n", ip_str, name, replies, (int)d->lat_lost,
+		infra_lat_percentile(d, 50), infra_lat_percentile(d, 90),
+		infra_lat_percentile(d, 99))) {
+		a->ssl_failed = 1;
+		return;
+	}
+}
+
+/** do the dump_latency command */
+static void
+do_dump_latency(SSL* ssl, struct worker* worker)
+{
+	struct infra_arg arg;
+	arg.infra = worker->env.infra_cache;
+	arg.ssl = ssl;
+	arg.now = *worker->env.now;
+	arg.ssl_failed = 0;
+	slabhash_traverse(arg.infra->hosts, 0, &dump_latency_host,
+		(void*)&arg);
+}
+
 /** do the log_reopen command */
 static void
 do_log_reopen(SSL* ssl, struct worker* worker)
@@ -2706,6 +2872,29 @@ do_ip_ratelimit_list(SSL* ssl, struct worker* worker, char* arg)
 	slabhash_traverse(a.infra->client_ip_rates, 0, ip_rate_list, &a);
 }
 
+/** list items in the jostle eviction table */
+static void
+evict_list(struct lruhash_entry* e, void* arg)
+{
+	SSL* ssl = (SSL*)arg;
+	struct rate_key* k = (struct rate_key*)e->key;
+	struct evict_data* d = (struct evict_data*)e->data;
+	char buf[257];
+	dname_str(k->name, buf);
+	ssl_printf(ssl, "%s %lu last %lld\n", buf, (unsigned long)d->count,
+		(long long)d->last);
+}
+
+/** do the jostle_list command */
+static void
+do_jostle_list(SSL* ssl, struct worker* worker)
+{
+	if(worker->env.infra_cache->domain_evicts == NULL)
+		return;
+	slabhash_traverse(worker->env.infra_cache->domain_evicts, 0,
+		evict_list, ssl);
+}
+
 /** tell other processes to execute the command */
 static void
 distribute_cmd(struct daemon_remote* rc, SSL* ssl, char* cmd)
@@ -2760,6 +2949,9 @@ execute_cmd(struct daemon_remote* rc, SSL* ssl, char* cmd,
 	} else if(cmdcmp(p, "load_cache", 10)) {
 		if(load_cache(ssl, worker)) send_ok(ssl);
 		return;
+	} else if(cmdcmp(p, "cache_snapshot", 14)) {
+		do_cache_snapshot(ssl, worker, skipwhite(p+14));
+		return;
 	} else if(cmdcmp(p, "list_forwards", 13)) {
 		do_list_forwards(ssl, worker);
 		return;
@@ -2787,6 +2979,9 @@ execute_cmd(struct daemon_remote* rc, SSL* ssl, char* cmd,
 	} else if(cmdcmp(p, "ip_ratelimit_list", 17)) {
 		do_ip_ratelimit_list(ssl, worker, p+17);
 		return;
+	} else if(cmdcmp(p, "jostle_list", 11)) {
+		do_jostle_list(ssl, worker);
+		return;
 	} else if(cmdcmp(p, "stub_add", 8)) {
 		/* must always distribute this cmd */
 		if(rc) distribute_cmd(rc, ssl, cmd);
@@ -2883,6 +3078,8 @@ execute_cmd(struct daemon_remote* rc, SSL* ssl, char* cmd,
 		do_dump_requestlist(ssl, worker);
 	} else if(cmdcmp(p, "dump_infra", 10)) {
 		do_dump_infra(ssl, worker);
+	} else if(cmdcmp(p, "dump_latency", 12)) {
+		do_dump_latency(ssl, worker);
 	} else if(cmdcmp(p, "log_reopen", 10)) {
 		do_log_reopen(ssl, worker);
 	} else if(cmdcmp(p, "set_option", 10)) {
@@ -61,6 +61,10 @@
 #include "services/cache/rrset.h"
 #include "services/cache/infra.h"
 #include "validator/val_kcache.h"
+#include "validator/val_sigcache.h"
+#include "validator/val_nsec3cache.h"
+#include "validator/val_neg.h"
+#include "validator/val_cryptopool.h"
 
 /** add timers and the values do not overflow or become negative */
 static void
@@ -85,18 +89,18 @@ void server_stats_init(struct ub_server_stats* stats, struct config_file* cfg)
 void server_stats_querymiss(struct ub_server_stats* stats, struct worker* worker)
 {
 	stats->num_queries_missed_cache++;
-	stats->sum_query_list_size += worker->env.mesh->all.count;
-	if((long long)worker->env.mesh->all.count > stats->max_query_list_size)
-		stats->max_query_list_size = (long long)worker->env.mesh->all.count;
+	stats->sum_query_list_size += worker->env.mesh->all_count;
+	if((long long)worker->env.mesh->all_count > stats->max_query_list_size)
+		stats->max_query_list_size = (long long)worker->env.mesh->all_count;
 }
 
 void server_stats_prefetch(struct ub_server_stats* stats, struct worker* worker)
 {
 	stats->num_queries_prefetch++;
 	/* changes the query list size so account that, like a querymiss */
-	stats->sum_query_list_size += worker->env.mesh->all.count;
-	if((long long)worker->env.mesh->all.count > stats->max_query_list_size)
-		stats->max_query_list_size = (long long)worker->env.mesh->all.count;
+	stats->sum_query_list_size += worker->env.mesh->all_count;
+	if((long long)worker->env.mesh->all_count > stats->max_query_list_size)
+		stats->max_query_list_size = (long long)worker->env.mesh->all_count;
 }
 
 void server_stats_log(struct ub_server_stats* stats, struct worker* worker,
@@ -140,6 +144,89 @@ get_rrset_bogus(struct worker* worker, int reset)
 	return r;
 }
 
+/** get the signature cache counters, the hits and misses are counted
+ * per thread */
+static void
+get_sig_cache(struct worker* worker, struct ub_stats_info* s)
+{
+	int m = modstack_find(&worker->env.mesh->mods, "validator");
+	struct sig_cache* sc;
+	s->svr.sig_cache_hit = (long long)worker->env.num_sig_cache_hit;
+	s->svr.sig_cache_miss = (long long)worker->env.num_sig_cache_miss;
+	s->svr.sig_cache_count = 0;
+	if(m == -1)
+		return;
+	sc = ((struct val_env*)worker->env.modinfo[m])->sigcache;
+	if(!sc)
+		return;
+	s->svr.sig_cache_count = (long long)count_slabhash_entries(sc->slab);
+}
+
+/** get the NSEC3 hash cache counters, the hits and misses are counted
+ * per thread */
+static void
+get_nsec3_cache(struct worker* worker, struct ub_stats_info* s)
+{
+	int m = modstack_find(&worker->env.mesh->mods, "validator");
+	struct nsec3_hash_cache* hc;
+	s->svr.nsec3_cache_hit = (long long)worker->env.num_nsec3_cache_hit;
+	s->svr.nsec3_cache_miss = (long long)worker->env.num_nsec3_cache_miss;
+	s->svr.nsec3_cache_count = 0;
+	if(m == -1)
+		return;
+	hc = ((struct val_env*)worker->env.modinfo[m])->nsec3cache;
+	if(!hc)
+		return;
+	s->svr.nsec3_cache_count = (long long)count_slabhash_entries(hc->slab);
+}
+
+/** get the aggressive negative cache counters from validator */
+static void
+get_neg_synth(struct worker* worker, int reset, struct ub_stats_info* s)
+{
+	int m = modstack_find(&worker->env.mesh->mods, "validator");
+	struct val_neg_cache* neg;
+	size_t nxdomain, nodata;
+	s->svr.neg_synth_nxdomain = 0;
+	s->svr.neg_synth_nodata = 0;
+	if(m == -1)
+		return;
+	neg = ((struct val_env*)worker->env.modinfo[m])->neg_cache;
+	if(!neg)
+		return;
+	val_neg_get_stats(neg, &nxdomain, &nodata,
+		reset && !worker->env.cfg->stat_cumulative);
+	s->svr.neg_synth_nxdomain = (long long)nxdomain;
+	s->svr.neg_synth_nodata = (long long)nodata;
+}
+
+/** get the crypto pool counters */
+static void
+get_crypto_pool(struct worker* worker, int reset, struct ub_stats_info* s)
+{
+	struct crypto_pool* pool = worker->daemon->crypto;
+	int i;
+	s->svr.crypto_jobs = 0;
+	for(i=0; i<UB_STATS_CRYPTO_HIST_NUM; i++) {
+		s->svr.crypto_queue_hist[i] = 0;
+		s->svr.crypto_verify_hist[i] = 0;
+	}
+	if(!pool)
+		return;
+	lock_basic_lock(&pool->stat_lock);
+	s->svr.crypto_jobs = (long long)pool->num_jobs;
+	for(i=0; i<UB_STATS_CRYPTO_HIST_NUM && i<CRYPTO_HIST_BUCKETS; i++) {
+		s->svr.crypto_queue_hist[i] = (long long)pool->hist_queue[i];
+		s->svr.crypto_verify_hist[i] = (long long)pool->hist_verify[i];
+	}
+	if(reset && !worker->env.cfg->stat_cumulative) {
+		pool->num_jobs = 0;
+		memset(pool->hist_queue, 0, sizeof(pool->hist_queue));
+		memset(pool->hist_verify, 0, sizeof(pool->hist_verify));
+	}
+	lock_basic_unlock(&pool->stat_lock);
+}
+
 /** get number of ratelimited queries from iterator */
 static size_t
 get_queries_ratelimit(struct worker* worker, int reset)
@@ -158,6 +245,30 @@ get_queries_ratelimit(struct worker* worker, int reset)
 	return r;
 }
 
+/** get the target fetch fanout counters */
+static void
+get_target_fanout(struct worker* worker, int reset, struct ub_stats_info* s)
+{
+	int m = modstack_find(&worker->env.mesh->mods, "iterator");
+	struct iter_env* ie;
+	s->svr.target_fanout = 0;
+	s->svr.target_fanout_fetch = 0;
+	s->svr.target_fanout_cancel = 0;
+	if(m == -1)
+		return;
+	ie = (struct iter_env*)worker->env.modinfo[m];
+	lock_basic_lock(&ie->fanout_lock);
+	s->svr.target_fanout = (long long)ie->num_fanout;
+	s->svr.target_fanout_fetch = (long long)ie->num_fanout_fetch;
+	s->svr.target_fanout_cancel = (long long)ie->num_fanout_cancel;
+	if(reset && !worker->env.cfg->stat_cumulative) {
+		ie->num_fanout = 0;
+		ie->num_fanout_fetch = 0;
+		ie->num_fanout_cancel = 0;
+	}
+	lock_basic_unlock(&ie->fanout_lock);
+}
+
 #ifdef USE_DNSCRYPT
 /** get the number of shared secret cache miss */
 static size_t
@@ -198,10 +309,11 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	struct listen_list* lp;
 
 	s->svr = worker->stats;
-	s->mesh_num_states = (long long)worker->env.mesh->all.count;
+	s->mesh_num_states = (long long)worker->env.mesh->all_count;
 	s->mesh_num_reply_states = (long long)worker->env.mesh->num_reply_states;
 	s->mesh_jostled = (long long)worker->env.mesh->stats_jostled;
 	s->mesh_dropped = (long long)worker->env.mesh->stats_dropped;
+	s->svr.num_queries_dedup = (long long)worker->env.mesh->stats_dedup;
 	s->mesh_replies_sent = (long long)worker->env.mesh->replies_sent;
 	s->mesh_replies_sum_wait_sec = (long long)worker->env.mesh->replies_sum_wait.tv_sec;
 	s->mesh_replies_sum_wait_usec = (long long)worker->env.mesh->replies_sum_wait.tv_usec;
@@ -219,12 +331,24 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	/* values from outside network */
 	s->svr.unwanted_replies = (long long)worker->back->unwanted_replies;
 	s->svr.qtcp_outgoing = (long long)worker->back->num_tcp_outgoing;
+	s->svr.qtcp_outgoing_reuse = (long long)worker->back->num_tcp_reuse;
+	s->svr.tcp_outgoing_open = (long long)worker->back->num_tcp_open;
+	s->svr.qudp_outgoing_batched = (long long)worker->back->num_udp_batched;
+	s->svr.udp_outgoing_batch_sends =
+		(long long)worker->back->num_udp_batch_sends;
+	s->svr.tls_outgoing_handshake =
+		(long long)worker->back->num_tls_handshake;
 
 	/* get and reset validator rrset bogus number */
 	s->svr.rrset_bogus = (long long)get_rrset_bogus(worker, reset);
+	get_sig_cache(worker, s);
+	get_nsec3_cache(worker, s);
+	get_neg_synth(worker, reset, s);
+	get_crypto_pool(worker, reset, s);
 
 	/* get and reset iterator query ratelimit number */
 	s->svr.queries_ratelimited = (long long)get_queries_ratelimit(worker, reset);
+	get_target_fanout(worker, reset, s);
 
 	/* get cache sizes */
 	s->svr.msg_cache_count = (long long)count_slabhash_entries(worker->env.msg_cache);
@@ -264,6 +388,18 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 			s->svr.tcp_accept_usage += (long long)lp->com->cur_tcp_count;
 	}
 
+	/* get udp batch fill */
+	s->svr.udp_batches = 0;
+	s->svr.udp_batch_pkts = 0;
+	for(lp = worker->front->cps; lp; lp = lp->next) {
+		if(lp->com->type == comm_udp) {
+			s->svr.udp_batches +=
+				(long long)lp->com->udp_batch_count;
+			s->svr.udp_batch_pkts +=
+				(long long)lp->com->udp_batch_pkts;
+		}
+	}
+
 	if(reset && !worker->env.cfg->stat_cumulative) {
 		worker_stats_clear(worker);
 	}
@@ -311,6 +447,10 @@ void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 	total->svr.num_queries_missed_cache += a->svr.num_queries_missed_cache;
 	total->svr.num_queries_prefetch += a->svr.num_queries_prefetch;
 	total->svr.sum_query_list_size += a->svr.sum_query_list_size;
+	total->svr.udp_batches += a->svr.udp_batches;
+	total->svr.udp_batch_pkts += a->svr.udp_batch_pkts;
+	total->svr.num_wirecache_hits += a->svr.num_wirecache_hits;
+	total->svr.num_queries_dedup += a->svr.num_queries_dedup;
 #ifdef USE_DNSCRYPT
 	total->svr.num_query_dnscrypt_crypted += a->svr.num_query_dnscrypt_crypted;
 	total->svr.num_query_dnscrypt_cert += a->svr.num_query_dnscrypt_cert;
@@ -329,6 +469,14 @@ void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 		total->svr.qclass_big += a->svr.qclass_big;
 		total->svr.qtcp += a->svr.qtcp;
 		total->svr.qtcp_outgoing += a->svr.qtcp_outgoing;
+		total->svr.qtcp_outgoing_reuse += a->svr.qtcp_outgoing_reuse;
+		total->svr.tcp_outgoing_open += a->svr.tcp_outgoing_open;
+		total->svr.tls_outgoing_handshake +=
+			a->svr.tls_outgoing_handshake;
+		total->svr.qudp_outgoing_batched +=
+			a->svr.qudp_outgoing_batched;
+		total->svr.udp_outgoing_batch_sends +=
+			a->svr.udp_outgoing_batch_sends;
 		total->svr.qipv6 += a->svr.qipv6;
 		total->svr.qbit_QR += a->svr.qbit_QR;
 		total->svr.qbit_AA += a->svr.qbit_AA;
@@ -344,6 +492,10 @@ void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 		total->svr.zero_ttl_responses += a->svr.zero_ttl_responses;
 		total->svr.ans_secure += a->svr.ans_secure;
 		total->svr.ans_bogus += a->svr.ans_bogus;
+		total->svr.sig_cache_hit += a->svr.sig_cache_hit;
+		total->svr.sig_cache_miss += a->svr.sig_cache_miss;
+		total->svr.nsec3_cache_hit += a->svr.nsec3_cache_hit;
+		total->svr.nsec3_cache_miss += a->svr.nsec3_cache_miss;
 		total->svr.unwanted_replies += a->svr.unwanted_replies;
 		total->svr.unwanted_queries += a->svr.unwanted_queries;
 		total->svr.tcp_accept_usage += a->svr.tcp_accept_usage;
@@ -58,6 +58,7 @@
 #include "services/cache/rrset.h"
 #include "services/cache/infra.h"
 #include "services/cache/dns.h"
+#include "services/cache/wirecache.h"
 #include "services/mesh.h"
 #include "services/localzone.h"
 #include "util/data/msgparse.h"
@@ -152,6 +153,7 @@ worker_mem_report(struct worker* ATTR_UNUSED(worker),
 		+ comm_point_get_mem(worker->cmd_com) 
 		+ sizeof(worker->rndstate) 
 		+ regional_get_mem(worker->scratchpad) 
+		+ wirecache_get_mem(worker->wirecache)
 		+ sizeof(*worker->env.scratch_buffer) 
 		+ sldns_buffer_capacity(worker->env.scratch_buffer)
 		+ forwards_get_mem(worker->env.fwds)
@@ -410,6 +412,36 @@ worker_handle_control_cmd(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
 	}
 }
 
+void
+worker_handle_inflight_wakeup(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
+	size_t ATTR_UNUSED(len), int error, void* arg)
+{
+	struct worker* worker = (struct worker*)arg;
+	free(msg);
+	if(error != NETEVENT_NOERROR) {
+		if(error != NETEVENT_CLOSED)
+			log_info("inflight wakeup event: %d", error);
+		return;
+	}
+	verbose(VERB_ALGO, "inflight wakeup");
+	mesh_inflight_wakeup(worker->env.mesh);
+}
+
+void
+worker_handle_crypto_wakeup(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
+	size_t ATTR_UNUSED(len), int error, void* arg)
+{
+	struct worker* worker = (struct worker*)arg;
+	free(msg);
+	if(error != NETEVENT_NOERROR) {
+		if(error != NETEVENT_CLOSED)
+			log_info("crypto wakeup event: %d", error);
+		return;
+	}
+	verbose(VERB_ALGO, "crypto wakeup");
+	mesh_crypto_wakeup(worker->env.mesh);
+}
+
 /** check if a delegation is secure */
 static enum sec_status
 check_delegation_secure(struct reply_info *rep) 
@@ -593,6 +625,92 @@ apply_respip_action(struct worker* worker, const struct query_info* qinfo,
 	return 1;
 }
 
+/** see if the wire cache can be used for the answer to this query, it
+ * is not used if the answer can be changed per query */
+static int
+wirecache_usable(struct worker* worker, struct query_info* qinfo,
+	struct edns_data* edns)
+{
+	return worker->wirecache && !worker->daemon->use_response_ip &&
+		!qinfo->local_alias && !edns->opt_list &&
+		!worker->env.cfg->serve_expired && !RRSET_ROUNDROBIN &&
+		!worker->env.inplace_cb_lists[inplace_cb_reply_cache];
+}
+
+/** store the encoded answer in the wire cache, rrsets are locked */
+static void
+wirecache_store_answer(struct worker* worker, struct query_info* qinfo,
+	struct reply_info* rep, uint16_t flags, int dnssec, int secure)
+{
+	struct edns_data noedns;
+	sldns_buffer* buf = worker->wirecache->buf;
+	memset(&noedns, 0, sizeof(noedns));
+	/* the full answer, without EDNS, it is added for every query */
+	if(!reply_info_answer_encode(qinfo, rep, 0, flags, buf,
+		*worker->env.now, 1, worker->scratchpad,
+		(uint16_t)sldns_buffer_capacity(buf), &noedns, dnssec,
+		secure))
+		return;
+	(void)wirecache_store(worker->wirecache, qinfo, flags, dnssec,
+		query_info_hash(qinfo, flags), rep, buf, *worker->env.now,
+		secure);
+}
+
+/**
+ * Answer query from the wire cache.  The message cache entry is locked.
+ * @param worker: the worker.
+ * @param qinfo: query.
+ * @param rep: reply from the message cache.
+ * @param h: hash of the query.
+ * @param id: query id, in network order.
+ * @param flags: query flags.
+ * @param repinfo: reply info, its buffer gets the answer.
+ * @param edns: EDNS from the query, changed to the EDNS for the answer.
+ * @return 0 if not answered, use answer_from_cache.
+ */
+static int
+answer_from_wirecache(struct worker* worker, struct query_info* qinfo,
+	struct reply_info* rep, hashvalue_type h, uint16_t id, uint16_t flags,
+	struct comm_reply* repinfo, struct edns_data* edns)
+{
+	time_t timenow = *worker->env.now;
+	struct wirecache_entry* e;
+	struct edns_data reply_edns;
+	if(!(e=wirecache_lookup(worker->wirecache, qinfo, flags,
+		(edns->bits & EDNS_DO)?1:0, h)))
+		return 0;
+	if(rep->ttl < timenow)
+		return 0;
+	/* checks the rrset IDs and TTLs */
+	if(!rrset_array_lock(rep->ref, rep->rrset_count, timenow))
+		return 0;
+	if(!wirecache_entry_valid(e, rep)) {
+		rrset_array_unlock(rep->ref, rep->rrset_count);
+		wirecache_remove(worker->wirecache, e);
+		return 0;
+	}
+	reply_edns = *edns;
+	reply_edns.edns_version = EDNS_ADVERTISED_VERSION;
+	reply_edns.udp_size = EDNS_ADVERTISED_SIZE;
+	reply_edns.ext_rcode = 0;
+	reply_edns.bits &= EDNS_DO;
+	if(!wirecache_answer(e, qinfo, id, flags, repinfo->c->buffer, timenow,
+		&reply_edns, edns->udp_size)) {
+		/* too large, answer_from_cache truncates it */
+		rrset_array_unlock(rep->ref, rep->rrset_count);
+		return 0;
+	}
+	*edns = reply_edns;
+	rrset_array_unlock_touch(worker->env.rrset_cache, worker->scratchpad,
+		rep->ref, rep->rrset_count);
+	worker->stats.num_wirecache_hits++;
+	if(worker->stats.extended) {
+		if(e->secure) worker->stats.ans_secure++;
+		server_stats_insrcode(&worker->stats, repinfo->c->buffer);
+	}
+	return 1;
+}
+
 /** answer query from the cache.
  * Normally, the answer message will be built in repinfo->c->buffer; if the
  * answer is supposed to be suppressed or the answer is supposed to be an
@@ -730,6 +848,10 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 				edns->opt_list = NULL;
 		error_encode(repinfo->c->buffer, LDNS_RCODE_SERVFAIL, 
 			qinfo, id, flags, edns);
+	} else if(!partial_rep && encode_rep == rep &&
+		wirecache_usable(worker, qinfo, edns)) {
+		wirecache_store_answer(worker, qinfo, rep, flags,
+			(edns->bits & EDNS_DO)?1:0, secure);
 	}
 	/* cannot send the reply right now, because blocking network syscall
 	 * is bad while holding locks. */
@@ -746,14 +868,16 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 /** Reply to client and perform prefetch to keep cache up to date.
  * If the buffer for the reply is empty, it indicates that only prefetch is
  * necessary and the reply should be suppressed (because it's dropped or
- * being deferred). */
+ * being deferred).  For a pipelined TCP stream the reply is not sent here,
+ * the stream writes it when the request callback returns. */
 static void
 reply_and_prefetch(struct worker* worker, struct query_info* qinfo, 
 	uint16_t flags, struct comm_reply* repinfo, time_t leeway)
 {
 	/* first send answer to client to keep its latency 
 	 * as small as a cachereply */
-	if(sldns_buffer_limit(repinfo->c->buffer) != 0)
+	if(sldns_buffer_limit(repinfo->c->buffer) != 0 &&
+		!repinfo->c->tcp_req_info)
 		comm_point_send_reply(repinfo);
 	server_stats_prefetch(&worker->stats, worker);
 	
@@ -1090,7 +1214,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 
 	/* check if this query should be dropped based on source ip rate limiting */
 	if(!infra_ip_ratelimit_inc(worker->env.infra_cache, repinfo,
-			*worker->env.now)) {
+			*worker->env.now, worker->env.now_tv)) {
 		/* See if we are passed through with slip factor */
 		if(worker->env.cfg->ip_ratelimit_factor != 0 &&
 			ub_random_max(worker->env.rnd,
@@ -1322,7 +1446,14 @@ lookup_cache:
 		h = query_info_hash(lookup_qinfo, sldns_buffer_read_u16_at(c->buffer, 2));
 		if((e=slabhash_lookup(worker->env.msg_cache, h, lookup_qinfo, 0))) {
 			/* answer from cache - we have acquired a readlock on it */
-			if(answer_from_cache(worker, &qinfo, 
+			if((!partial_rep &&
+				wirecache_usable(worker, &qinfo, &edns) &&
+				answer_from_wirecache(worker, &qinfo,
+				(struct reply_info*)e->data, h,
+				*(uint16_t*)(void *)sldns_buffer_begin(c->buffer),
+				sldns_buffer_read_u16_at(c->buffer, 2), repinfo,
+				&edns)) ||
+				answer_from_cache(worker, &qinfo, 
 				cinfo, &need_drop, &alias_rrset, &partial_rep,
 				(struct reply_info*)e->data, 
 				*(uint16_t*)(void *)sldns_buffer_begin(c->buffer), 
@@ -1345,7 +1476,9 @@ lookup_cache:
 						sldns_buffer_read_u16_at(c->buffer, 2),
 						repinfo, leeway);
 					if(!partial_rep) {
-						rc = 0;
+						rc = c->tcp_req_info &&
+							sldns_buffer_limit(
+							c->buffer) != 0;
 						regional_free_all(worker->scratchpad);
 						goto send_reply_rc;
 					}
@@ -1533,6 +1666,20 @@ worker_create(struct daemon* daemon, int id, int* ports, int n)
 		free(worker);
 		return NULL;
 	}
+	if(daemon->cfg->inflight_dedup && !(worker->wake = tube_create())) {
+		tube_delete(worker->cmd);
+		free(worker->ports);
+		free(worker);
+		return NULL;
+	}
+	if(daemon->cfg->crypto_threads &&
+		!(worker->crypto_wake = tube_create())) {
+		tube_delete(worker->cmd);
+		tube_delete(worker->wake);
+		free(worker->ports);
+		free(worker);
+		return NULL;
+	}
 	/* create random state here to avoid locking trouble in RAND_bytes */
 	seed = (unsigned int)time(NULL) ^ (unsigned int)getpid() ^
 		(((unsigned int)worker->thread_num)<<17);
@@ -1541,6 +1688,8 @@ worker_create(struct daemon* daemon, int id, int* ports, int n)
 		seed = 0;
 		log_err("could not init random numbers.");
 		tube_delete(worker->cmd);
+		tube_delete(worker->wake);
+		tube_delete(worker->crypto_wake);
 		free(worker->ports);
 		free(worker);
 		return NULL;
@@ -1614,8 +1763,9 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	}
 	worker->front = listen_create(worker->base, ports,
 		cfg->msg_buffer_size, (int)cfg->incoming_num_tcp, 
-		worker->daemon->listen_sslctx, dtenv, worker_handle_request,
-		worker);
+		cfg->incoming_tcp_pipeline, cfg->incoming_tcp_pipeline_total,
+		cfg->udp_batch_size, worker->daemon->listen_sslctx, dtenv,
+		worker_handle_request, worker);
 	if(!worker->front) {
 		log_err("could not create listening sockets");
 		worker_delete(worker);
@@ -1631,7 +1781,9 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		&worker_alloc_cleanup, worker,
 		cfg->do_udp || cfg->udp_upstream_without_downstream,
 		worker->daemon->connect_sslctx, cfg->delay_close,
-		dtenv);
+		dtenv, cfg->tcp_reuse_timeout,
+		(size_t)cfg->max_reuse_tcp_queries, cfg->outgoing_batch,
+		cfg->outgoing_port_pool, cfg->outgoing_port_pool_uses);
 	if(!worker->back) {
 		log_err("could not create outgoing sockets");
 		worker_delete(worker);
@@ -1644,6 +1796,18 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+	if(worker->wake && !tube_setup_bg_listen(worker->wake, worker->base,
+		&worker_handle_inflight_wakeup, worker)) {
+		log_err("could not create inflight wakeup compt.");
+		worker_delete(worker);
+		return 0;
+	}
+	if(worker->crypto_wake && !tube_setup_bg_listen(worker->crypto_wake,
+		worker->base, &worker_handle_crypto_wakeup, worker)) {
+		log_err("could not create crypto wakeup compt.");
+		worker_delete(worker);
+		return 0;
+	}
 	worker->stat_timer = comm_timer_create(worker->base, 
 		worker_stat_timer_cb, worker);
 	if(!worker->stat_timer) {
@@ -1659,6 +1823,15 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		return 0;
 	}
 
+	if(cfg->wire_cache_size > 0) {
+		worker->wirecache = wirecache_create(cfg->wire_cache_size);
+		if(!worker->wirecache) {
+			log_err("malloc failure");
+			worker_delete(worker);
+			return 0;
+		}
+	}
+
 	server_stats_init(&worker->stats, cfg);
 	alloc_init(&worker->alloc, &worker->daemon->superalloc, 
 		worker->thread_num);
@@ -1685,6 +1858,14 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		return 0;
 	}
 	worker->env.mesh = mesh_create(&worker->daemon->mods, &worker->env);
+	if(worker->daemon->crypto) {
+		worker->env.crypto_pool = worker->daemon->crypto;
+		worker->env.crypto_thread = worker->thread_num;
+	}
+	if(worker->env.mesh && worker->daemon->inflight) {
+		worker->env.mesh->inflight = worker->daemon->inflight;
+		worker->env.mesh->inflight_thread = worker->thread_num;
+	}
 	worker->env.detach_subs = &mesh_detach_subs;
 	worker->env.attach_sub = &mesh_attach_sub;
 	worker->env.add_sub = &mesh_add_sub;
@@ -1760,6 +1941,8 @@ worker_delete(struct worker* worker)
 	outside_network_delete(worker->back);
 	comm_signal_delete(worker->comsig);
 	tube_delete(worker->cmd);
+	tube_delete(worker->wake);
+	tube_delete(worker->crypto_wake);
 	comm_timer_delete(worker->stat_timer);
 	comm_timer_delete(worker->env.probe_timer);
 	free(worker->ports);
@@ -1774,6 +1957,7 @@ worker_delete(struct worker* worker)
 	alloc_clear(&worker->alloc);
 	regional_destroy(worker->env.scratch);
 	regional_destroy(worker->scratchpad);
+	wirecache_delete(worker->wirecache);
 	free(worker);
 }
 
@@ -1805,14 +1989,29 @@ worker_alloc_cleanup(void* arg)
 	struct worker* worker = (struct worker*)arg;
 	slabhash_clear(&worker->env.rrset_cache->table);
 	slabhash_clear(worker->env.msg_cache);
+	wirecache_clear(worker->wirecache);
 }
 
 void worker_stats_clear(struct worker* worker)
 {
+	struct listen_list* lp;
 	server_stats_init(&worker->stats, worker->env.cfg);
 	mesh_stats_clear(worker->env.mesh);
 	worker->back->unwanted_replies = 0;
 	worker->back->num_tcp_outgoing = 0;
+	worker->back->num_tcp_reuse = 0;
+	worker->back->num_tcp_open = 0;
+	worker->back->num_tls_handshake = 0;
+	worker->back->num_udp_batched = 0;
+	worker->back->num_udp_batch_sends = 0;
+	worker->env.num_sig_cache_hit = 0;
+	worker->env.num_sig_cache_miss = 0;
+	worker->env.num_nsec3_cache_hit = 0;
+	worker->env.num_nsec3_cache_miss = 0;
+	for(lp = worker->front->cps; lp; lp = lp->next) {
+		lp->com->udp_batch_count = 0;
+		lp->com->udp_batch_pkts = 0;
+	}
 }
 
 void worker_start_accept(void* arg)
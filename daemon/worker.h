@@ -62,6 +62,7 @@ struct regional;
 struct tube;
 struct daemon_remote;
 struct query_info;
+struct wirecache;
 
 /** worker commands */
 enum worker_commands {
@@ -88,6 +89,12 @@ struct worker {
 	ub_thread_type thr_id;
 	/** pipe, for commands for this worker */
 	struct tube* cmd;
+	/** pipe, wakes the worker when other threads are done with queries
+	 * its states wait for, with inflight-dedup, or NULL */
+	struct tube* wake;
+	/** pipe, wakes the worker when the crypto pool has finished its
+	 * signature verification jobs, with crypto-threads, or NULL */
+	struct tube* crypto_wake;
 	/** the event base this worker works with */
 	struct comm_base* base;
 	/** the frontside listening interface where request events come in */
@@ -119,6 +126,8 @@ struct worker {
 	struct ub_server_stats stats;
 	/** thread scratch regional */
 	struct regional* scratchpad;
+	/** encoded replies for cache answers, or NULL if not used */
+	struct wirecache* wirecache;
 
 	/** module environment passed to modules, changed for this thread */
 	struct module_env env;
@@ -585,6 +585,7 @@ dns64_synth_aaaa_data(const struct ub_packed_rrset_key* fk,
 	dd->rrsig_count = 0;
 	dd->trust = fd->trust;
 	dd->security = fd->security;
+	dd->canon_len = 0;
 
 	/*
 	 * Synthesize AAAA records. Adjust pointers in structure.
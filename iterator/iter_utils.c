@@ -150,6 +150,7 @@ iter_apply_cfg(struct iter_env* iter_env, struct config_file* cfg)
 	for(i=0; i<iter_env->max_dependency_depth+1; i++)
 		verbose(VERB_QUERY, "target fetch policy for level %d is %d",
 			i, iter_env->target_fetch_policy[i]);
+	iter_env->target_fetch_fanout = cfg->target_fetch_fanout;
 	
 	if(!iter_env->donotq)
 		iter_env->donotq = donotq_create();
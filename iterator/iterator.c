@@ -83,6 +83,13 @@ iter_init(struct module_env* env, int id)
 	lock_protect(&iter_env->queries_ratelimit_lock,
 			&iter_env->num_queries_ratelimited,
 		sizeof(iter_env->num_queries_ratelimited));
+	lock_basic_init(&iter_env->fanout_lock);
+	lock_protect(&iter_env->fanout_lock, &iter_env->num_fanout,
+		sizeof(iter_env->num_fanout));
+	lock_protect(&iter_env->fanout_lock, &iter_env->num_fanout_fetch,
+		sizeof(iter_env->num_fanout_fetch));
+	lock_protect(&iter_env->fanout_lock, &iter_env->num_fanout_cancel,
+		sizeof(iter_env->num_fanout_cancel));
 
 	if(!iter_apply_cfg(iter_env, env->cfg)) {
 		log_err("iterator: could not apply configuration settings.");
@@ -110,6 +117,7 @@ iter_deinit(struct module_env* env, int id)
 		return;
 	iter_env = (struct iter_env*)env->modinfo[id];
 	lock_basic_destroy(&iter_env->queries_ratelimit_lock);
+	lock_basic_destroy(&iter_env->fanout_lock);
 	free(iter_env->target_fetch_policy);
 	priv_delete(iter_env->priv);
 	donotq_delete(iter_env->donotq);
@@ -140,6 +148,7 @@ iter_new(struct module_qstate* qstate, int id)
 	iq->dp = NULL;
 	iq->depth = 0;
 	iq->num_target_queries = 0;
+	iq->fanout_dp = NULL;
 	iq->num_current_queries = 0;
 	iq->query_restart_count = 0;
 	iq->referral_count = 0;
@@ -1114,9 +1123,7 @@ processInitRequest(struct module_qstate* qstate, struct iter_qstate* iq,
 			/* lookup in negative cache; may result in
 			 * NOERROR/NODATA or NXDOMAIN answers that need validation */
 			msg = val_neg_getmsg(qstate->env->neg_cache, &iq->qchase,
-				qstate->region, qstate->env->rrset_cache,
-				qstate->env->scratch_buffer, 
-				*qstate->env->now, 1/*add SOA*/, NULL);
+				qstate->region, qstate->env, 1/*add SOA*/, NULL);
 		}
 		/* item taken from cache does not match our query name, thus
 		 * security needs to be re-examined later */
@@ -1271,12 +1278,13 @@ processInitRequest(struct module_qstate* qstate, struct iter_qstate* iq,
 			otherwise valid data in the cache */
 		if(!iq->ratelimit_ok && infra_ratelimit_exceeded(
 			qstate->env->infra_cache, iq->dp->name,
-			iq->dp->namelen, *qstate->env->now)) {
+			iq->dp->namelen, *qstate->env->now,
+			qstate->env->now_tv)) {
 			/* and increment the rate, so that the rate for time
 			 * now will also exceed the rate, keeping cache fresh */
 			(void)infra_ratelimit_inc(qstate->env->infra_cache,
 				iq->dp->name, iq->dp->namelen,
-				*qstate->env->now);
+				*qstate->env->now, qstate->env->now_tv);
 			/* see if we are passed through with slip factor */
 			if(qstate->env->cfg->ratelimit_factor != 0 &&
 				ub_random_max(qstate->env->rnd,
@@ -1639,6 +1647,66 @@ query_for_targets(struct module_qstate* qstate, struct iter_qstate* iq,
 	return 1;
 }
 
+/**
+ * Fetch all missing targets in parallel, for target-fetch-fanout, if the
+ * delegation point has no addresses that can be used.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ * @param id: module id.
+ * @param num: returns the number of queries generated.
+ * @return false if no fanout is done, the caller fetches targets.
+ */
+static int
+fanout_targets(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie, int id, int* num)
+{
+	size_t naddr, nres, navail;
+	*num = 0;
+	if(!ie->target_fetch_fanout || iq->fanout_dp == iq->dp ||
+		iq->depth >= ie->max_dependency_depth)
+		return 0;
+	delegpt_count_addr(iq->dp, &naddr, &nres, &navail);
+	if(nres + navail != 0 || delegpt_count_missing_targets(iq->dp) == 0)
+		return 0;
+	verbose(VERB_ALGO, "no usable addresses, fetch all missing targets");
+	iq->fanout_dp = iq->dp;
+	(void)query_for_targets(qstate, iq, ie, id, -1, num);
+	lock_basic_lock(&ie->fanout_lock);
+	ie->num_fanout++;
+	ie->num_fanout_fetch += (size_t)*num;
+	lock_basic_unlock(&ie->fanout_lock);
+	return 1;
+}
+
+/**
+ * Stop waiting for the fanout target lookups when enough addresses are
+ * known.  The lookups continue detached and fill the cache.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ */
+static void
+fanout_cancel(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie)
+{
+	size_t naddr, nres, navail;
+	if(iq->fanout_dp != iq->dp || iq->num_target_queries == 0)
+		return;
+	delegpt_count_addr(iq->dp, &naddr, &nres, &navail);
+	if(nres + navail < (size_t)ie->target_fetch_fanout)
+		return;
+	verbose(VERB_ALGO, "fanout has %d addresses, stop waiting for %d "
+		"targets", (int)(nres + navail), iq->num_target_queries);
+	fptr_ok(fptr_whitelist_modenv_detach_subs(
+		qstate->env->detach_subs));
+	(*qstate->env->detach_subs)(qstate);
+	iq->num_target_queries = 0;
+	lock_basic_lock(&ie->fanout_lock);
+	ie->num_fanout_cancel++;
+	lock_basic_unlock(&ie->fanout_lock);
+}
+
 /**
  * Called by processQueryTargets when it would like extra targets to query
  * but it seems to be out of options.  At last resort some less appealing
@@ -1879,7 +1947,7 @@ static int
 processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	struct iter_env* ie, int id)
 {
-	int tf_policy;
+	int tf_policy, fanout = 0;
 	struct delegpt_addr* target;
 	struct outbound_entry* outq;
 
@@ -1974,6 +2042,11 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 		verbose(VERB_ALGO, "0x20 fallback number %d", 
 			(int)iq->caps_server);
 
+	/* if there are no addresses, fetch all missing targets at once */
+	} else if(fanout_targets(qstate, iq, ie, id, &fanout)) {
+		iq->num_target_queries += fanout;
+		target_count_increase(iq, fanout);
+
 	/* if there is a policy to fetch missing targets 
 	 * opportunistically, do it. we rely on the fact that once a 
 	 * query (or queries) for a missing name have been issued, 
@@ -1991,6 +2064,8 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 
 	/* Add the current set of unused targets to our queue. */
 	delegpt_add_unused_targets(iq->dp);
+	/* enough targets from the fanout, do not wait for the rest */
+	fanout_cancel(qstate, iq, ie);
 
 	/* Select the next usable target, filtering out unsuitable targets. */
 	target = iter_server_selection(ie, qstate->env, iq->dp, 
@@ -2084,7 +2159,8 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	/* if not forwarding, check ratelimits per delegationpoint name */
 	if(!(iq->chase_flags & BIT_RD) && !iq->ratelimit_ok) {
 		if(!infra_ratelimit_inc(qstate->env->infra_cache, iq->dp->name,
-			iq->dp->namelen, *qstate->env->now)) {
+			iq->dp->namelen, *qstate->env->now,
+			qstate->env->now_tv)) {
 			lock_basic_lock(&ie->queries_ratelimit_lock);
 			ie->num_queries_ratelimited++;
 			lock_basic_unlock(&ie->queries_ratelimit_lock);
@@ -2219,7 +2295,8 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 			&target->addr, target->addrlen);
 		if(!(iq->chase_flags & BIT_RD) && !iq->ratelimit_ok)
 		    infra_ratelimit_dec(qstate->env->infra_cache, iq->dp->name,
-			iq->dp->namelen, *qstate->env->now);
+			iq->dp->namelen, *qstate->env->now,
+			qstate->env->now_tv);
 		if(qstate->env->cfg->qname_minimisation)
 			iq->minimisation_state = SKIP_MINIMISE_STATE;
 		return next_state(iq, QUERYTARGETS_STATE);
@@ -2227,6 +2304,11 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	outbound_list_insert(&iq->outlist, outq);
 	iq->num_current_queries++;
 	iq->sent_count++;
+	/* remember the server for the jostle admission control */
+	qstate->work_zone = iq->dp->name;
+	qstate->work_zonelen = iq->dp->namelen;
+	memmove(&qstate->work_addr, &target->addr, target->addrlen);
+	qstate->work_addrlen = target->addrlen;
 	qstate->ext_state[id] = module_wait_reply;
 
 	return 0;
@@ -2446,7 +2528,7 @@ processQueryResponse(struct module_qstate* qstate, struct iter_qstate* iq,
 			 * our queries to the given name */
 			infra_ratelimit_dec(qstate->env->infra_cache,
 				iq->dp->name, iq->dp->namelen,
-				*qstate->env->now);
+				*qstate->env->now, qstate->env->now_tv);
 		}
 
 		/* if hardened, only store referral if we asked for it */
@@ -134,6 +134,18 @@ struct iter_env {
 	lock_basic_type queries_ratelimit_lock;
 	/** number of queries that have been ratelimited */
 	size_t num_queries_ratelimited;
+
+	/** fetch all missing targets in parallel when there are no
+	 * addresses, until this many are known. 0 is off. */
+	int target_fetch_fanout;
+	/** lock on the fanout counters */
+	lock_basic_type fanout_lock;
+	/** number of times all missing targets were fetched in parallel */
+	size_t num_fanout;
+	/** number of target lookups started by the fanout */
+	size_t num_fanout_fetch;
+	/** number of times the fanout lookups were no longer waited for */
+	size_t num_fanout_cancel;
 };
 
 /**
@@ -292,6 +304,10 @@ struct iter_qstate {
 	/** number of outstanding target sub queries */
 	int num_target_queries;
 
+	/** the delegation point for which the targets were fetched in
+	 * parallel, with target-fetch-fanout, or NULL */
+	struct delegpt* fanout_dp;
+
 	/** outstanding direct queries */
 	int num_current_queries;
 
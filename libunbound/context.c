@@ -79,6 +79,7 @@ context_finalize(struct ub_ctx* ctx)
 		if(!ctx->env->msg_cache)
 			return UB_NOMEM;
 	}
+	slabhash_setclock(ctx->env->msg_cache, cfg->cache_clock_eviction);
 	ctx->env->rrset_cache = rrset_cache_adjust(ctx->env->rrset_cache,
 		ctx->env->cfg, ctx->env->alloc);
 	if(!ctx->env->rrset_cache)
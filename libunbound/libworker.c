@@ -235,7 +235,11 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct ub_event_base* eb)
 		ports, numports, cfg->unwanted_threshold,
 		cfg->outgoing_tcp_mss, &libworker_alloc_cleanup, w,
 		cfg->do_udp || cfg->udp_upstream_without_downstream, w->sslctx,
-		cfg->delay_close, NULL);
+		cfg->delay_close, NULL, cfg->tcp_reuse_timeout,
+		(size_t)cfg->max_reuse_tcp_queries, cfg->outgoing_batch,
+		/* a foreground resolve does not open a pool per call */
+		w->is_bg?cfg->outgoing_port_pool:0,
+		cfg->outgoing_port_pool_uses);
 	w->env->outnet = w->back;
 	if(!w->is_bg || w->is_bg_thread) {
 		lock_basic_unlock(&ctx->cfglock);
@@ -951,6 +955,20 @@ struct outbound_entry* worker_send_query(struct query_info* ATTR_UNUSED(qinfo),
 	return 0;
 }
 
+void worker_handle_inflight_wakeup(struct tube* ATTR_UNUSED(tube),
+	uint8_t* ATTR_UNUSED(msg), size_t ATTR_UNUSED(len),
+	int ATTR_UNUSED(error), void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
+void worker_handle_crypto_wakeup(struct tube* ATTR_UNUSED(tube),
+	uint8_t* ATTR_UNUSED(msg), size_t ATTR_UNUSED(len),
+	int ATTR_UNUSED(error), void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void 
 worker_alloc_cleanup(void* ATTR_UNUSED(arg))
 {
@@ -637,6 +637,8 @@ struct ub_shm_stat_info {
 #define UB_STATS_OPCODE_NUM 16
 /** number of histogram buckets */
 #define UB_STATS_BUCKET_NUM 40
+/** number of crypto pool histogram buckets */
+#define UB_STATS_CRYPTO_HIST_NUM 16
 
 /** per worker statistics. */
 struct ub_server_stats {
@@ -747,6 +749,57 @@ struct ub_server_stats {
 	long long num_query_dnscrypt_replay;
 	/** number of dnscrypt nonces cache entries */
 	long long nonce_cache_count;
+	/** number of batches of UDP datagrams received with recvmmsg */
+	long long udp_batches;
+	/** number of UDP datagrams received in those batches */
+	long long udp_batch_pkts;
+	/** number of cache answers sent from the wire cache */
+	long long num_wirecache_hits;
+	/** number of outgoing TCP queries sent on an already open stream */
+	long long qtcp_outgoing_reuse;
+	/** number of outgoing TCP streams opened */
+	long long tcp_outgoing_open;
+	/** number of TLS handshakes for outgoing streams */
+	long long tls_outgoing_handshake;
+	/** number of queries that waited for another thread that resolved
+	 * the same query, with inflight-dedup */
+	long long num_queries_dedup;
+	/** number of outgoing UDP queries sent in batches, outgoing-batch */
+	long long qudp_outgoing_batched;
+	/** number of send calls for outgoing UDP batches, one per server */
+	long long udp_outgoing_batch_sends;
+	/** number of delegations where all missing targets were fetched
+	 * at once, target-fetch-fanout */
+	long long target_fanout;
+	/** number of target queries sent by the fanouts */
+	long long target_fanout_fetch;
+	/** number of fanouts that stopped waiting for the remaining
+	 * target queries */
+	long long target_fanout_cancel;
+	/** number of signatures found in the verified signature cache */
+	long long sig_cache_hit;
+	/** number of signatures not in the signature cache, verified */
+	long long sig_cache_miss;
+	/** number of signature cache entries */
+	long long sig_cache_count;
+	/** number of rrsets verified by the crypto threads */
+	long long crypto_jobs;
+	/** histogram of the crypto queue length when a job is queued,
+	 * bucket i counts from 2**i up to 2**(i+1), bucket 0 includes 0 */
+	long long crypto_queue_hist[UB_STATS_CRYPTO_HIST_NUM];
+	/** histogram of the time, in usec, from queue until verified,
+	 * buckets like crypto_queue_hist */
+	long long crypto_verify_hist[UB_STATS_CRYPTO_HIST_NUM];
+	/** number of NSEC3 hashes found in the NSEC3 hash cache */
+	long long nsec3_cache_hit;
+	/** number of NSEC3 hashes not in the NSEC3 hash cache, hashed */
+	long long nsec3_cache_miss;
+	/** number of NSEC3 hash cache entries */
+	long long nsec3_cache_count;
+	/** number of NXDOMAIN answers synthesized from the negative cache */
+	long long neg_synth_nxdomain;
+	/** number of NODATA answers synthesized from the negative cache */
+	long long neg_synth_nodata;
 };
 
 /** 
@@ -136,6 +136,30 @@ struct outbound_entry* worker_send_query(struct query_info* qinfo,
 void worker_handle_control_cmd(struct tube* tube, uint8_t* msg, size_t len,
 	int error, void* arg);
 
+/**
+ * process wakeups from other threads for queries that waited on the
+ * inflight table.  Frees the message.
+ * @param tube: the wake tube of the worker.
+ * @param msg: message contents.  Is freed.
+ * @param len: length of message.
+ * @param error: if error (NETEVENT_*) happened.
+ * @param arg: user argument, the worker.
+ */
+void worker_handle_inflight_wakeup(struct tube* tube, uint8_t* msg,
+	size_t len, int error, void* arg);
+
+/**
+ * process wakeups from the crypto pool, for signature verification jobs
+ * that are done.  Frees the message.
+ * @param tube: the crypto wake tube of the worker.
+ * @param msg: message contents.  Is freed.
+ * @param len: length of message.
+ * @param error: if error (NETEVENT_*) happened.
+ * @param arg: user argument, the worker.
+ */
+void worker_handle_crypto_wakeup(struct tube* tube, uint8_t* msg,
+	size_t len, int error, void* arg);
+
 /** handles callbacks from listening event interface */
 int worker_handle_request(struct comm_point* c, void* arg, int error,
 	struct comm_reply* repinfo);
@@ -484,6 +484,7 @@ copy_rrset(const struct ub_packed_rrset_key* key, struct regional* region)
 		return NULL;
 	*d = *data;
 	d->rrsig_count = 0;
+	d->canon_len = 0;
 	ck->entry.data = d;
 
 	/* derived from packed_rrset_ptr_fixup() with copying the data */
@@ -728,9 +728,9 @@ dns_cache_lookup(struct module_env* env,
 	h = query_info_hash(&k, flags);
 	e = slabhash_lookup(env->msg_cache, h, &k, 0);
 	if(e) {
-		struct msgreply_entry* key = (struct msgreply_entry*)e->key;
 		struct reply_info* data = (struct reply_info*)e->data;
-		struct dns_msg* msg = tomsg(env, &key->key, data, region, now, 
+		/* the key is stored in lowercase, use the case of the query */
+		struct dns_msg* msg = tomsg(env, &k, data, region, now, 
 			scratch);
 		if(msg) {
 			lock_rw_unlock(&e->lock);
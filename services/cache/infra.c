@@ -69,7 +69,8 @@ size_t
 infra_sizefunc(void* k, void* ATTR_UNUSED(d))
 {
 	struct infra_key* key = (struct infra_key*)k;
-	return sizeof(*key) + sizeof(struct infra_data) + key->namelen
+	return sizeof(*key) + sizeof(struct infra_data)
+		+ (key->namelen > INFRA_KEY_NAME_INLINE ? key->namelen : 0)
 		+ lock_get_mem(&key->entry.lock);
 }
 
@@ -78,7 +79,7 @@ infra_compfunc(void* key1, void* key2)
 {
 	struct infra_key* k1 = (struct infra_key*)key1;
 	struct infra_key* k2 = (struct infra_key*)key2;
-	int r = sockaddr_cmp(&k1->addr, k1->addrlen, &k2->addr, k2->addrlen);
+	int r = memcmp(&k1->addr, &k2->addr, sizeof(k1->addr));
 	if(r != 0)
 		return r;
 	if(k1->namelen != k2->namelen) {
@@ -96,7 +97,7 @@ infra_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
 	if(!key)
 		return;
 	lock_rw_destroy(&key->entry.lock);
-	free(key->zonename);
+	/* the zonename is in the key, or allocated with the key */
 	free(key);
 }
 
@@ -146,6 +147,40 @@ rate_deldatafunc(void* d, void* ATTR_UNUSED(arg))
 	free(data);
 }
 
+size_t 
+evict_sizefunc(void* k, void* ATTR_UNUSED(d))
+{
+	struct rate_key* key = (struct rate_key*)k;
+	return sizeof(*key) + sizeof(struct evict_data) + key->namelen
+		+ lock_get_mem(&key->entry.lock);
+}
+
+size_t 
+infra_server_sizefunc(void* k, void* ATTR_UNUSED(d))
+{
+	struct infra_server_key* key = (struct infra_server_key*)k;
+	return sizeof(*key) + sizeof(struct infra_server_data)
+		+ lock_get_mem(&key->entry.lock);
+}
+
+int 
+infra_server_compfunc(void* key1, void* key2)
+{
+	struct infra_server_key* k1 = (struct infra_server_key*)key1;
+	struct infra_server_key* k2 = (struct infra_server_key*)key2;
+	return memcmp(&k1->addr, &k2->addr, sizeof(k1->addr));
+}
+
+void 
+infra_server_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
+{
+	struct infra_server_key* key = (struct infra_server_key*)k;
+	if(!key)
+		return;
+	lock_rw_destroy(&key->entry.lock);
+	free(key);
+}
+
 /** find or create element in domainlimit tree */
 static struct domain_limit_data* domain_limit_findcreate(
 	struct infra_cache* infra, char* name)
@@ -215,6 +250,48 @@ static int infra_ratelimit_cfg_insert(struct infra_cache* infra,
 	return 1;
 }
 
+/** delete ip ratelimit exempt entries */
+static void exempt_free(rbnode_type* n, void* ATTR_UNUSED(arg))
+{
+	free(n);
+}
+
+/** setup the ip ratelimit and token bucket settings from config */
+static int infra_ip_ratelimit_cfg(struct infra_cache* infra,
+	struct config_file* cfg)
+{
+	struct config_strlist* p;
+	struct addr_tree_node* n;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	int net;
+	infra->ratelimit_burst = cfg->ratelimit_burst;
+	infra->ip_ratelimit_burst = cfg->ip_ratelimit_burst;
+	infra->ip_ratelimit_prefix4 = cfg->ip_ratelimit_ipv4_prefix;
+	infra->ip_ratelimit_prefix6 = cfg->ip_ratelimit_ipv6_prefix;
+	traverse_postorder(&infra->ip_ratelimit_exempt, exempt_free, NULL);
+	addr_tree_init(&infra->ip_ratelimit_exempt);
+	for(p = cfg->ip_ratelimit_exempt; p; p = p->next) {
+		if(!netblockstrtoaddr(p->str, 0, &addr, &addrlen, &net)) {
+			log_err("cannot parse ip-ratelimit-exempt: %s", p->str);
+			return 0;
+		}
+		n = (struct addr_tree_node*)calloc(1, sizeof(*n));
+		if(!n) {
+			log_err("out of memory");
+			return 0;
+		}
+		if(!addr_tree_insert(&infra->ip_ratelimit_exempt, n, &addr,
+			addrlen, net)) {
+			verbose(VERB_QUERY, "ignoring duplicate "
+				"ip-ratelimit-exempt: %s", p->str);
+			free(n);
+		}
+	}
+	addr_tree_init_parents(&infra->ip_ratelimit_exempt);
+	return 1;
+}
+
 struct infra_cache* 
 infra_create(struct config_file* cfg)
 {
@@ -229,8 +306,11 @@ infra_create(struct config_file* cfg)
 		free(infra);
 		return NULL;
 	}
+	slabhash_setclock(infra->hosts, cfg->cache_clock_eviction);
 	infra->host_ttl = cfg->host_ttl;
+	infra->sel_percentile = cfg->server_selection_percentile;
 	name_tree_init(&infra->domain_limits);
+	addr_tree_init(&infra->ip_ratelimit_exempt);
 	infra_dp_ratelimit = cfg->ratelimit;
 	if(cfg->ratelimit != 0) {
 		infra->domain_rates = slabhash_create(cfg->ratelimit_slabs,
@@ -256,6 +336,34 @@ infra_create(struct config_file* cfg)
 		infra_delete(infra);
 		return NULL;
 	}
+	if(!infra_ip_ratelimit_cfg(infra, cfg)) {
+		infra_delete(infra);
+		return NULL;
+	}
+	if(cfg->jostle_adaptive) {
+		infra->domain_evicts = slabhash_create(cfg->ratelimit_slabs,
+			INFRA_HOST_STARTSIZE, cfg->ratelimit_size,
+			&evict_sizefunc, &rate_compfunc, &rate_delkeyfunc,
+			&evict_deldatafunc, NULL);
+		if(!infra->domain_evicts) {
+			infra_delete(infra);
+			return NULL;
+		}
+	}
+	if(cfg->infra_cache_server_shared) {
+		infra->servers = slabhash_create(cfg->infra_cache_slabs,
+			INFRA_HOST_STARTSIZE, cfg->infra_cache_numhosts *
+			(sizeof(struct infra_server_key)+
+			sizeof(struct infra_server_data)),
+			&infra_server_sizefunc, &infra_server_compfunc,
+			&infra_server_delkeyfunc, &infra_server_deldatafunc,
+			NULL);
+		if(!infra->servers) {
+			infra_delete(infra);
+			return NULL;
+		}
+		slabhash_setclock(infra->servers, cfg->cache_clock_eviction);
+	}
 	return infra;
 }
 
@@ -277,6 +385,9 @@ infra_delete(struct infra_cache* infra)
 	slabhash_delete(infra->domain_rates);
 	traverse_postorder(&infra->domain_limits, domain_limit_free, NULL);
 	slabhash_delete(infra->client_ip_rates);
+	traverse_postorder(&infra->ip_ratelimit_exempt, exempt_free, NULL);
+	slabhash_delete(infra->domain_evicts);
+	slabhash_delete(infra->servers);
 	free(infra);
 }
 
@@ -287,12 +398,25 @@ infra_adjust(struct infra_cache* infra, struct config_file* cfg)
 	if(!infra)
 		return infra_create(cfg);
 	infra->host_ttl = cfg->host_ttl;
+	infra->sel_percentile = cfg->server_selection_percentile;
 	maxmem = cfg->infra_cache_numhosts * (sizeof(struct infra_key)+
 		sizeof(struct infra_data)+INFRA_BYTES_NAME);
 	if(maxmem != slabhash_get_size(infra->hosts) ||
-		cfg->infra_cache_slabs != infra->hosts->size) {
+		cfg->infra_cache_slabs != infra->hosts->size ||
+		(cfg->jostle_adaptive != 0) != (infra->domain_evicts != NULL) ||
+		(cfg->infra_cache_server_shared != 0) !=
+		(infra->servers != NULL)) {
 		infra_delete(infra);
 		infra = infra_create(cfg);
+	} else {
+		slabhash_setclock(infra->hosts, cfg->cache_clock_eviction);
+		if(infra->servers)
+			slabhash_setclock(infra->servers,
+				cfg->cache_clock_eviction);
+		if(!infra_ip_ratelimit_cfg(infra, cfg)) {
+			infra_delete(infra);
+			return NULL;
+		}
 	}
 	return infra;
 }
@@ -324,11 +448,50 @@ hash_addr(struct sockaddr_storage* addr, socklen_t addrlen,
 	return h;
 }
 
+void
+infra_addr_pack(struct infra_addr* a, struct sockaddr_storage* addr,
+	socklen_t addrlen)
+{
+	if(addr_is_ip6(addr, addrlen)) {
+		struct sockaddr_in6* in6 = (struct sockaddr_in6*)addr;
+		memmove(a->ip, &in6->sin6_addr, INET6_SIZE);
+		memmove(a->port, &in6->sin6_port, sizeof(a->port));
+	} else {
+		struct sockaddr_in* in = (struct sockaddr_in*)addr;
+		memset(a->ip, 0, 10);
+		a->ip[10] = 0xff;
+		a->ip[11] = 0xff;
+		memmove(a->ip+12, &in->sin_addr, INET_SIZE);
+		memmove(a->port, &in->sin_port, sizeof(a->port));
+	}
+}
+
+void
+infra_addr_unpack(struct infra_addr* a, struct sockaddr_storage* addr,
+	socklen_t* addrlen)
+{
+	static const uint8_t mapped[12] = {0,0,0,0, 0,0,0,0, 0,0,0xff,0xff};
+	memset(addr, 0, sizeof(*addr));
+	if(memcmp(a->ip, mapped, sizeof(mapped)) == 0) {
+		struct sockaddr_in* in = (struct sockaddr_in*)addr;
+		in->sin_family = AF_INET;
+		memmove(&in->sin_addr, a->ip+12, INET_SIZE);
+		memmove(&in->sin_port, a->port, sizeof(a->port));
+		*addrlen = (socklen_t)sizeof(*in);
+	} else {
+		struct sockaddr_in6* in6 = (struct sockaddr_in6*)addr;
+		in6->sin6_family = AF_INET6;
+		memmove(&in6->sin6_addr, a->ip, INET6_SIZE);
+		memmove(&in6->sin6_port, a->port, sizeof(a->port));
+		*addrlen = (socklen_t)sizeof(*in6);
+	}
+}
+
 /** calculate infra hash for a key */
 static hashvalue_type
-hash_infra(struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name)
+hash_infra(struct infra_addr* a, uint8_t* name)
 {
-	return dname_query_hash(name, hash_addr(addr, addrlen, 1));
+	return dname_query_hash(name, hashlittle(a, sizeof(*a), 0xab));
 }
 
 /** lookup version that does not check host ttl (you check it) */
@@ -337,16 +500,155 @@ infra_lookup_nottl(struct infra_cache* infra, struct sockaddr_storage* addr,
 	socklen_t addrlen, uint8_t* name, size_t namelen, int wr)
 {
 	struct infra_key k;
-	k.addrlen = addrlen;
-	memcpy(&k.addr, addr, addrlen);
-	k.namelen = namelen;
+	infra_addr_pack(&k.addr, addr, addrlen);
+	k.namelen = (uint8_t)namelen;
 	k.zonename = name;
-	k.entry.hash = hash_infra(addr, addrlen, name);
+	k.entry.hash = hash_infra(&k.addr, name);
 	k.entry.key = (void*)&k;
 	k.entry.data = NULL;
 	return slabhash_lookup(infra->hosts, k.entry.hash, &k, wr);
 }
 
+/** lookup the server entry, returns locked entry or NULL */
+static struct lruhash_entry*
+server_lookup(struct infra_cache* infra, struct infra_addr* a, int wr)
+{
+	struct infra_server_key k;
+	memmove(&k.addr, a, sizeof(k.addr));
+	k.entry.hash = hashlittle(a, sizeof(*a), 0xab);
+	k.entry.key = (void*)&k;
+	k.entry.data = NULL;
+	return slabhash_lookup(infra->servers, k.entry.hash, &k, wr);
+}
+
+/** start the rtt and edns of a zone entry from the server entry, if any.
+ * The server lock is taken while the zone entry is locked, never the
+ * other way around. */
+static void
+server_inherit(struct infra_cache* infra, struct infra_addr* a,
+	struct infra_data* data, time_t timenow)
+{
+	struct lruhash_entry* e = server_lookup(infra, a, 0);
+	struct infra_server_data* s;
+	if(!e)
+		return;
+	s = (struct infra_server_data*)e->data;
+	if(s->ttl >= timenow) {
+		memmove(&data->rtt, &s->rtt, sizeof(data->rtt));
+		data->edns_version = s->edns_version;
+		data->edns_lame_known = s->edns_lame_known;
+	}
+	lock_rw_unlock(&e->lock);
+}
+
+/** init the server data elements */
+static void
+server_data_init(struct infra_cache* infra, struct infra_server_data* data,
+	time_t timenow)
+{
+	data->ttl = timenow + infra->host_ttl;
+	rtt_init(&data->rtt);
+	data->edns_version = 0;
+	data->edns_lame_known = 0;
+}
+
+/**
+ * Get the server entry to update it.
+ * @param infra: infra cache with the servers table.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param timenow: time now.
+ * @param needtoinsert: set true if the entry is new and has to be
+ *	inserted, otherwise the entry is write locked.
+ * @return entry or NULL on malloc failure.
+ */
+static struct lruhash_entry*
+server_get(struct infra_cache* infra, struct sockaddr_storage* addr,
+	socklen_t addrlen, time_t timenow, int* needtoinsert)
+{
+	struct infra_server_key* key;
+	struct infra_server_data* data;
+	struct infra_addr a;
+	struct lruhash_entry* e;
+	infra_addr_pack(&a, addr, addrlen);
+	*needtoinsert = 0;
+	if((e = server_lookup(infra, &a, 1))) {
+		data = (struct infra_server_data*)e->data;
+		if(data->ttl < timenow)
+			server_data_init(infra, data, timenow);
+		return e;
+	}
+	key = (struct infra_server_key*)malloc(sizeof(*key));
+	if(!key)
+		return NULL;
+	data = (struct infra_server_data*)malloc(sizeof(*data));
+	if(!data) {
+		free(key);
+		return NULL;
+	}
+	memmove(&key->addr, &a, sizeof(a));
+	lock_rw_init(&key->entry.lock);
+	key->entry.hash = hashlittle(&a, sizeof(a), 0xab);
+	key->entry.key = (void*)key;
+	key->entry.data = (void*)data;
+	server_data_init(infra, data, timenow);
+	*needtoinsert = 1;
+	return &key->entry;
+}
+
+/** done with the server entry from server_get */
+static void
+server_done(struct infra_cache* infra, struct lruhash_entry* e,
+	int needtoinsert)
+{
+	if(needtoinsert)
+		slabhash_insert(infra->servers, e->hash, e, e->data, NULL);
+	else 	{ lock_rw_unlock(&e->lock); }
+}
+
+/** feed a zone rtt update back into the server entry */
+static void
+server_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
+	socklen_t addrlen, int roundtrip, int orig_rtt, time_t timenow)
+{
+	int needtoinsert;
+	struct lruhash_entry* e = server_get(infra, addr, addrlen, timenow,
+		&needtoinsert);
+	struct infra_server_data* data;
+	if(!e)
+		return;
+	data = (struct infra_server_data*)e->data;
+	if(roundtrip == -1) {
+		rtt_lost(&data->rtt, orig_rtt);
+	} else {
+		if(rtt_unclamped(&data->rtt) >= USEFUL_SERVER_TOP_TIMEOUT)
+			rtt_init(&data->rtt);
+		rtt_update(&data->rtt, roundtrip);
+	}
+	server_done(infra, e, needtoinsert);
+}
+
+/** feed a zone edns update back into the server entry */
+static void
+server_edns_update(struct infra_cache* infra, struct sockaddr_storage* addr,
+	socklen_t addrlen, int edns_version, time_t timenow)
+{
+	int needtoinsert;
+	struct lruhash_entry* e = server_get(infra, addr, addrlen, timenow,
+		&needtoinsert);
+	struct infra_server_data* data;
+	if(!e)
+		return;
+	data = (struct infra_server_data*)e->data;
+	/* do not update if noEDNS and stored is yesEDNS */
+	if(!(edns_version == -1 && (data->edns_version != -1 &&
+		data->edns_lame_known))) {
+		data->edns_version = edns_version;
+		data->edns_lame_known = 1;
+	}
+	server_done(infra, e, needtoinsert);
+}
+
 /** init the data elements */
 static void
 data_entry_init(struct infra_cache* infra, struct lruhash_entry* e, 
@@ -365,6 +667,11 @@ data_entry_init(struct infra_cache* infra, struct lruhash_entry* e,
 	data->timeout_A = 0;
 	data->timeout_AAAA = 0;
 	data->timeout_other = 0;
+	memset(data->lat_hist, 0, sizeof(data->lat_hist));
+	data->lat_lost = 0;
+	if(infra->servers)
+		server_inherit(infra, &((struct infra_key*)e->key)->addr,
+			data, timenow);
 }
 
 /** 
@@ -382,7 +689,9 @@ new_entry(struct infra_cache* infra, struct sockaddr_storage* addr,
 	socklen_t addrlen, uint8_t* name, size_t namelen, time_t tm)
 {
 	struct infra_data* data;
-	struct infra_key* key = (struct infra_key*)malloc(sizeof(*key));
+	/* a long zonename is stored after the key, in the same allocation */
+	struct infra_key* key = (struct infra_key*)malloc(sizeof(*key)
+		+ (namelen > INFRA_KEY_NAME_INLINE ? namelen : 0));
 	if(!key)
 		return NULL;
 	data = (struct infra_data*)malloc(sizeof(struct infra_data));
@@ -390,19 +699,16 @@ new_entry(struct infra_cache* infra, struct sockaddr_storage* addr,
 		free(key);
 		return NULL;
 	}
-	key->zonename = memdup(name, namelen);
-	if(!key->zonename) {
-		free(key);
-		free(data);
-		return NULL;
-	}
-	key->namelen = namelen;
+	if(namelen > INFRA_KEY_NAME_INLINE)
+		key->zonename = (uint8_t*)(key+1);
+	else	key->zonename = key->name;
+	memmove(key->zonename, name, namelen);
+	key->namelen = (uint8_t)namelen;
+	infra_addr_pack(&key->addr, addr, addrlen);
 	lock_rw_init(&key->entry.lock);
-	key->entry.hash = hash_infra(addr, addrlen, name);
+	key->entry.hash = hash_infra(&key->addr, name);
 	key->entry.key = (void*)key;
 	key->entry.data = (void*)data;
-	key->addrlen = addrlen;
-	memcpy(&key->addr, addr, addrlen);
 	data_entry_init(infra, &key->entry, tm);
 	return &key->entry;
 }
@@ -532,6 +838,67 @@ infra_update_tcp_works(struct infra_cache* infra,
 	lock_rw_unlock(&e->lock);
 }
 
+/** count a reply in the latency histogram, roundtrip -1 is a loss */
+static void
+lat_hist_add(struct infra_data* data, int roundtrip)
+{
+	int i, total = (int)data->lat_lost;
+	if(roundtrip == -1) {
+		data->lat_lost++;
+	} else {
+		for(i=0; i<INFRA_LAT_BUCKETS-1 && roundtrip >= (1<<i); i++)
+			;
+		data->lat_hist[i]++;
+	}
+	for(i=0; i<INFRA_LAT_BUCKETS; i++)
+		total += (int)data->lat_hist[i];
+	if(total+1 >= INFRA_LAT_DECAY) {
+		/* halve the counts, so that older samples weigh less */
+		for(i=0; i<INFRA_LAT_BUCKETS; i++)
+			data->lat_hist[i] /= 2;
+		data->lat_lost /= 2;
+	}
+}
+
+int
+infra_lat_percentile(struct infra_data* data, int pct)
+{
+	int i, total = 0, cum = 0, target, lo, hi;
+	for(i=0; i<INFRA_LAT_BUCKETS; i++)
+		total += (int)data->lat_hist[i];
+	if(total == 0)
+		return -1;
+	/* the sample number, rounded up, that has the percentile */
+	target = (total*pct + 99)/100;
+	if(target < 1)
+		target = 1;
+	for(i=0; i<INFRA_LAT_BUCKETS; i++) {
+		if(cum + (int)data->lat_hist[i] >= target)
+			break;
+		cum += (int)data->lat_hist[i];
+	}
+	if(i >= INFRA_LAT_BUCKETS)
+		i = INFRA_LAT_BUCKETS-1;
+	/* bucket i holds [2^(i-1), 2^i) msec */
+	lo = (i==0)?0:(1<<(i-1));
+	hi = 1<<i;
+	return lo + (hi-lo)*(target-cum)/(int)data->lat_hist[i];
+}
+
+/** the selection rtt from the latency histogram: the percentile plus
+ * the retransmit timeout for the fraction of lost queries.
+ * @return -1 if there are not enough samples. */
+static int
+lat_select_rtt(struct infra_data* data, int pct)
+{
+	int i, total = (int)data->lat_lost, p;
+	for(i=0; i<INFRA_LAT_BUCKETS; i++)
+		total += (int)data->lat_hist[i];
+	if(total < INFRA_LAT_MIN || (p = infra_lat_percentile(data, pct)) < 0)
+		return -1;
+	return p + (int)(((long long)data->lat_lost * data->rtt.rto) / total);
+}
+
 int 
 infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	socklen_t addrlen, uint8_t* nm, size_t nmlen, int qtype,
@@ -551,6 +918,7 @@ infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	}
 	/* have an entry, update the rtt */
 	data = (struct infra_data*)e->data;
+	lat_hist_add(data, roundtrip);
 	if(roundtrip == -1) {
 		rtt_lost(&data->rtt, orig_rtt);
 		if(qtype == LDNS_RR_TYPE_A) {
@@ -583,6 +951,9 @@ infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	if(needtoinsert)
 		slabhash_insert(infra->hosts, e->hash, e, e->data, NULL);
 	else 	{ lock_rw_unlock(&e->lock); }
+	if(infra->servers)
+		server_rtt_update(infra, addr, addrlen, roundtrip, orig_rtt,
+			timenow);
 	return rto;
 }
 
@@ -611,6 +982,27 @@ long long infra_get_host_rto(struct infra_cache* infra,
 	return ttl;
 }
 
+int
+infra_expected_rtt(struct infra_cache* infra, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint8_t* nm, size_t nmlen, time_t timenow)
+{
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
+		nm, nmlen, 0);
+	struct infra_data* data;
+	int expect = 0, timeouts;
+	if(!e) return 0;
+	data = (struct infra_data*)e->data;
+	if(data->ttl >= timenow) {
+		timeouts = (int)data->timeout_A + (int)data->timeout_AAAA +
+			(int)data->timeout_other;
+		expect = data->rtt.rto * (1+timeouts);
+		if(expect > RTT_MAX_TIMEOUT)
+			expect = RTT_MAX_TIMEOUT;
+	}
+	lock_rw_unlock(&e->lock);
+	return expect;
+}
+
 int 
 infra_edns_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	socklen_t addrlen, uint8_t* nm, size_t nmlen, int edns_version,
@@ -639,6 +1031,8 @@ infra_edns_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	if(needtoinsert)
 		slabhash_insert(infra->hosts, e->hash, e, e->data, NULL);
 	else 	{ lock_rw_unlock(&e->lock); }
+	if(infra->servers)
+		server_edns_update(infra, addr, addrlen, edns_version, timenow);
 	return 1;
 }
 
@@ -672,6 +1066,12 @@ infra_get_lame_rtt(struct infra_cache* infra,
 				*rtt = USEFUL_SERVER_TOP_TIMEOUT;
 			else	*rtt = USEFUL_SERVER_TOP_TIMEOUT-1000;
 		}
+	} else if(infra->sel_percentile && *rtt < USEFUL_SERVER_TOP_TIMEOUT) {
+		/* select on the latency percentile and loss rate */
+		int sel = lat_select_rtt(host, infra->sel_percentile);
+		if(sel >= 0)
+			*rtt = (sel < USEFUL_SERVER_TOP_TIMEOUT-1000)?sel:
+				USEFUL_SERVER_TOP_TIMEOUT-1000;
 	}
 	if(timenow > host->ttl) {
 		/* expired entry */
@@ -783,23 +1183,76 @@ static struct lruhash_entry* infra_find_ratedata(struct infra_cache* infra,
 	return slabhash_lookup(infra->domain_rates, h, &key, wr);
 }
 
+/** the client address for the ip ratelimit, aggregated to the prefix */
+static void ip_rate_addr(struct infra_cache* infra,
+	struct comm_reply* repinfo, struct sockaddr_storage* addr,
+	socklen_t* addrlen)
+{
+	*addr = repinfo->addr;
+	*addrlen = repinfo->addrlen;
+	if(addr_is_ip6(addr, *addrlen)) {
+		if(infra->ip_ratelimit_prefix6 < 128)
+			addr_mask(addr, *addrlen, infra->ip_ratelimit_prefix6);
+	} else if(infra->ip_ratelimit_prefix4 < 32)
+		addr_mask(addr, *addrlen, infra->ip_ratelimit_prefix4);
+}
+
 /** find data item in array for ip addresses */
 struct lruhash_entry* infra_find_ip_ratedata(struct infra_cache* infra,
 	struct comm_reply* repinfo, int wr)
 {
 	struct ip_rate_key key;
-	hashvalue_type h = hash_addr(&(repinfo->addr),
-		repinfo->addrlen, 0);
+	hashvalue_type h;
 	memset(&key, 0, sizeof(key));
-	key.addr = repinfo->addr;
-	key.addrlen = repinfo->addrlen;
+	ip_rate_addr(infra, repinfo, &key.addr, &key.addrlen);
+	h = hash_addr(&key.addr, key.addrlen, 0);
 	key.entry.hash = h;
 	return slabhash_lookup(infra->client_ip_rates, h, &key, wr);
 }
 
+/** the time in msec for the token bucket */
+static long long rate_msec(time_t timenow, struct timeval* tv)
+{
+	if(tv)
+		return ((long long)tv->tv_sec)*1000 + tv->tv_usec/1000;
+	return ((long long)timenow)*1000;
+}
+
+/** refill the token bucket, with lim queries per second, up to burst */
+static void rate_bucket_refill(struct rate_data* d, int lim, int burst,
+	long long now)
+{
+	long long max = ((long long)burst)*1000;
+	/* threads may have a slightly older time, do not go back */
+	if(now > d->tokens_time) {
+		d->tokens += (now - d->tokens_time) * lim;
+		d->tokens_time = now;
+	}
+	if(d->tokens > max)
+		d->tokens = max;
+}
+
+/** take a token from the bucket, returns false if it is empty */
+static int rate_bucket_take(struct rate_data* d, int lim, int burst,
+	long long now)
+{
+	rate_bucket_refill(d, lim, burst, now);
+	if(d->tokens < 1000)
+		return 0;
+	d->tokens -= 1000;
+	return 1;
+}
+
+/** start a new token bucket, full, minus the current query */
+static void rate_bucket_init(struct rate_data* d, int burst, long long now)
+{
+	d->tokens = ((long long)burst)*1000 - 1000;
+	d->tokens_time = now;
+}
+
 /** create rate data item for name, number 1 in now */
 static void infra_create_ratedata(struct infra_cache* infra,
-	uint8_t* name, size_t namelen, time_t timenow)
+	uint8_t* name, size_t namelen, time_t timenow, long long msec)
 {
 	hashvalue_type h = dname_query_hash(name, 0xab);
 	struct rate_key* k = (struct rate_key*)calloc(1, sizeof(*k));
@@ -822,15 +1275,15 @@ static void infra_create_ratedata(struct infra_cache* infra,
 	k->entry.data = d;
 	d->qps[0] = 1;
 	d->timestamp[0] = timenow;
+	rate_bucket_init(d, infra->ratelimit_burst, msec);
 	slabhash_insert(infra->domain_rates, h, &k->entry, d, NULL);
 }
 
 /** create rate data item for ip address */
 static void infra_ip_create_ratedata(struct infra_cache* infra,
-	struct comm_reply* repinfo, time_t timenow)
+	struct comm_reply* repinfo, time_t timenow, long long msec)
 {
-	hashvalue_type h = hash_addr(&(repinfo->addr),
-	repinfo->addrlen, 0);
+	hashvalue_type h;
 	struct ip_rate_key* k = (struct ip_rate_key*)calloc(1, sizeof(*k));
 	struct ip_rate_data* d = (struct ip_rate_data*)calloc(1, sizeof(*d));
 	if(!k || !d) {
@@ -838,14 +1291,15 @@ static void infra_ip_create_ratedata(struct infra_cache* infra,
 		free(d);
 		return; /* alloc failure */
 	}
-	k->addr = repinfo->addr;
-	k->addrlen = repinfo->addrlen;
+	ip_rate_addr(infra, repinfo, &k->addr, &k->addrlen);
+	h = hash_addr(&k->addr, k->addrlen, 0);
 	lock_rw_init(&k->entry.lock);
 	k->entry.hash = h;
 	k->entry.key = k;
 	k->entry.data = d;
 	d->qps[0] = 1;
 	d->timestamp[0] = timenow;
+	rate_bucket_init(d, infra->ip_ratelimit_burst, msec);
 	slabhash_insert(infra->client_ip_rates, h, &k->entry, d, NULL);
 }
 
@@ -882,11 +1336,80 @@ int infra_rate_max(void* data, time_t now)
 	return max;
 }
 
-int infra_ratelimit_inc(struct infra_cache* infra, uint8_t* name,
+/** find eviction counter for name, caller unlocks */
+static struct lruhash_entry* infra_find_evictdata(struct infra_cache* infra,
+	uint8_t* name, size_t namelen, int wr)
+{
+	struct rate_key key;
+	hashvalue_type h = dname_query_hash(name, 0xab);
+	memset(&key, 0, sizeof(key));
+	key.name = name;
+	key.namelen = namelen;
+	key.entry.hash = h;
+	return slabhash_lookup(infra->domain_evicts, h, &key, wr);
+}
+
+void infra_evict_inc(struct infra_cache* infra, uint8_t* name,
 	size_t namelen, time_t timenow)
+{
+	struct lruhash_entry* entry;
+	struct rate_key* k;
+	struct evict_data* d;
+	if(!infra->domain_evicts || !name)
+		return;
+	entry = infra_find_evictdata(infra, name, namelen, 1);
+	if(entry) {
+		d = (struct evict_data*)entry->data;
+		d->count++;
+		d->last = timenow;
+		lock_rw_unlock(&entry->lock);
+		return;
+	}
+	k = (struct rate_key*)calloc(1, sizeof(*k));
+	d = (struct evict_data*)calloc(1, sizeof(*d));
+	if(!k || !d) {
+		free(k);
+		free(d);
+		return; /* alloc failure */
+	}
+	k->namelen = namelen;
+	k->name = memdup(name, namelen);
+	if(!k->name) {
+		free(k);
+		free(d);
+		return; /* alloc failure */
+	}
+	lock_rw_init(&k->entry.lock);
+	k->entry.hash = dname_query_hash(name, 0xab);
+	k->entry.key = k;
+	k->entry.data = d;
+	d->count = 1;
+	d->last = timenow;
+	slabhash_insert(infra->domain_evicts, k->entry.hash, &k->entry, d,
+		NULL);
+}
+
+size_t infra_evict_count(struct infra_cache* infra, uint8_t* name,
+	size_t namelen)
+{
+	struct lruhash_entry* entry;
+	size_t count;
+	if(!infra->domain_evicts)
+		return 0;
+	entry = infra_find_evictdata(infra, name, namelen, 0);
+	if(!entry)
+		return 0;
+	count = ((struct evict_data*)entry->data)->count;
+	lock_rw_unlock(&entry->lock);
+	return count;
+}
+
+int infra_ratelimit_inc(struct infra_cache* infra, uint8_t* name,
+	size_t namelen, time_t timenow, struct timeval* tv)
 {
 	int lim, max;
 	struct lruhash_entry* entry;
+	long long msec = rate_msec(timenow, tv);
 
 	if(!infra_dp_ratelimit)
 		return 1; /* not enabled */
@@ -898,6 +1421,20 @@ int infra_ratelimit_inc(struct infra_cache* infra, uint8_t* name,
 	
 	/* find or insert ratedata */
 	entry = infra_find_ratedata(infra, name, namelen, 1);
+	if(entry && infra->ratelimit_burst) {
+		struct rate_data* d = (struct rate_data*)entry->data;
+		int ok = rate_bucket_take(d, lim, infra->ratelimit_burst, msec);
+		int empty = (d->tokens < 1000);
+		int* cur = infra_rate_find_second(entry->data, timenow);
+		(*cur)++;
+		lock_rw_unlock(&entry->lock);
+		if(ok && empty) {
+			char buf[257];
+			dname_str(name, buf);
+			verbose(VERB_OPS, "ratelimit exceeded %s %d", buf, lim);
+		}
+		return ok;
+	}
 	if(entry) {
 		int premax = infra_rate_max(entry->data, timenow);
 		int* cur = infra_rate_find_second(entry->data, timenow);
@@ -914,12 +1451,14 @@ int infra_ratelimit_inc(struct infra_cache* infra, uint8_t* name,
 	}
 
 	/* create */
-	infra_create_ratedata(infra, name, namelen, timenow);
+	infra_create_ratedata(infra, name, namelen, timenow, msec);
+	if(infra->ratelimit_burst)
+		return 1;
 	return (1 < lim);
 }
 
 void infra_ratelimit_dec(struct infra_cache* infra, uint8_t* name,
-	size_t namelen, time_t timenow)
+	size_t namelen, time_t timenow, struct timeval* tv)
 {
 	struct lruhash_entry* entry;
 	int* cur;
@@ -930,11 +1469,18 @@ void infra_ratelimit_dec(struct infra_cache* infra, uint8_t* name,
 	cur = infra_rate_find_second(entry->data, timenow);
 	if((*cur) > 0)
 		(*cur)--;
+	if(infra->ratelimit_burst) {
+		/* give the token back */
+		struct rate_data* d = (struct rate_data*)entry->data;
+		d->tokens += 1000;
+		rate_bucket_refill(d, 0, infra->ratelimit_burst,
+			rate_msec(timenow, tv));
+	}
 	lock_rw_unlock(&entry->lock);
 }
 
 int infra_ratelimit_exceeded(struct infra_cache* infra, uint8_t* name,
-	size_t namelen, time_t timenow)
+	size_t namelen, time_t timenow, struct timeval* tv)
 {
 	struct lruhash_entry* entry;
 	int lim, max;
@@ -946,6 +1492,21 @@ int infra_ratelimit_exceeded(struct infra_cache* infra, uint8_t* name,
 	if(!lim)
 		return 0; /* disabled for this domain */
 
+	if(infra->ratelimit_burst) {
+		/* is the token bucket empty */
+		struct rate_data* d;
+		int exceeded;
+		entry = infra_find_ratedata(infra, name, namelen, 1);
+		if(!entry)
+			return 0; /* not cached */
+		d = (struct rate_data*)entry->data;
+		rate_bucket_refill(d, lim, infra->ratelimit_burst,
+			rate_msec(timenow, tv));
+		exceeded = (d->tokens < 1000);
+		lock_rw_unlock(&entry->lock);
+		return exceeded;
+	}
+
 	/* find current rate */
 	entry = infra_find_ratedata(infra, name, namelen, 0);
 	if(!entry)
@@ -962,12 +1523,14 @@ infra_get_mem(struct infra_cache* infra)
 	size_t s = sizeof(*infra) + slabhash_get_mem(infra->hosts);
 	if(infra->domain_rates) s += slabhash_get_mem(infra->domain_rates);
 	if(infra->client_ip_rates) s += slabhash_get_mem(infra->client_ip_rates);
+	if(infra->domain_evicts) s += slabhash_get_mem(infra->domain_evicts);
+	if(infra->servers) s += slabhash_get_mem(infra->servers);
 	/* ignore domain_limits because walk through tree is big */
 	return s;
 }
 
 int infra_ip_ratelimit_inc(struct infra_cache* infra,
-  struct comm_reply* repinfo, time_t timenow)
+  struct comm_reply* repinfo, time_t timenow, struct timeval* tv)
 {
 	int max;
 	struct lruhash_entry* entry;
@@ -976,8 +1539,30 @@ int infra_ip_ratelimit_inc(struct infra_cache* infra,
 	if(!infra_ip_ratelimit) {
 		return 1;
 	}
+	/* exempt from the ratelimit */
+	if(infra->ip_ratelimit_exempt.count != 0 &&
+		addr_tree_lookup(&infra->ip_ratelimit_exempt, &repinfo->addr,
+		repinfo->addrlen))
+		return 1;
 	/* find or insert ratedata */
 	entry = infra_find_ip_ratedata(infra, repinfo, 1);
+	if(entry && infra->ip_ratelimit_burst) {
+		struct ip_rate_data* d = (struct ip_rate_data*)entry->data;
+		int ok = rate_bucket_take(d, infra_ip_ratelimit,
+			infra->ip_ratelimit_burst, rate_msec(timenow, tv));
+		int empty = (d->tokens < 1000);
+		int* cur = infra_rate_find_second(entry->data, timenow);
+		(*cur)++;
+		lock_rw_unlock(&entry->lock);
+		if(ok && empty) {
+			char client_ip[128];
+			addr_to_str((struct sockaddr_storage *)&repinfo->addr,
+				repinfo->addrlen, client_ip, sizeof(client_ip));
+			verbose(VERB_OPS, "ratelimit exceeded %s %d", client_ip,
+				infra_ip_ratelimit);
+		}
+		return ok;
+	}
 	if(entry) {
 		int premax = infra_rate_max(entry->data, timenow);
 		int* cur = infra_rate_find_second(entry->data, timenow);
@@ -996,6 +1581,7 @@ int infra_ip_ratelimit_inc(struct infra_cache* infra,
 	}
 
 	/* create */
-	infra_ip_create_ratedata(infra, repinfo, timenow);
+	infra_ip_create_ratedata(infra, repinfo, timenow,
+		rate_msec(timenow, tv));
 	return 1;
 }
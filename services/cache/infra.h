@@ -52,22 +52,48 @@
 struct slabhash;
 struct config_file;
 
+/**
+ * Compact host address for the infra cache, 18 bytes.  IPv4 addresses
+ * are stored as IPv4-mapped IPv6 addresses.
+ */
+struct infra_addr {
+	/** IPv6 address, or ::ffff:a.b.c.d for IPv4 */
+	uint8_t ip[16];
+	/** port number, in network byte order */
+	uint8_t port[2];
+};
+
+/** bytes of the zone name that are stored in the infra key itself, so
+ * that addr, namelen, the name and the name pointer fill 64 bytes */
+#define INFRA_KEY_NAME_INLINE 37
+
 /**
  * Host information kept for every server, per zone.
+ * The fields that are compared are at the start, with the zone name stored
+ * in the key when it fits, and the hash table entry is last.  Longer zone
+ * names are allocated in the same block, after the key.
  */
 struct infra_key {
-	/** the host address. */
-	struct sockaddr_storage addr;
-	/** length of addr. */
-	socklen_t addrlen;
-	/** zone name in wireformat */
-	uint8_t* zonename;
+	/** the host address and port. */
+	struct infra_addr addr;
 	/** length of zonename */
-	size_t namelen;
+	uint8_t namelen;
+	/** the zone name, if namelen is at most INFRA_KEY_NAME_INLINE */
+	uint8_t name[INFRA_KEY_NAME_INLINE];
+	/** zone name in wireformat, points to name or after the key */
+	uint8_t* zonename;
 	/** hash table entry, data of type infra_data. */
 	struct lruhash_entry entry;
 };
 
+/** number of latency histogram buckets, in log2 msec: <1, <2, <4, ..,
+ * the last bucket counts the rest */
+#define INFRA_LAT_BUCKETS 12
+/** when the histogram holds this many samples, the counts are halved */
+#define INFRA_LAT_DECAY 1024
+/** samples needed before the histogram is used for server selection */
+#define INFRA_LAT_MIN 8
+
 /**
  * Host information encompasses host capabilities and retransmission timeouts.
  * And lameness information (notAuthoritative, noEDNS, Recursive)
@@ -104,6 +130,36 @@ struct infra_data {
 	uint8_t timeout_AAAA;
 	/** timeouts counter for others */
 	uint8_t timeout_other;
+
+	/** latency histogram, replies counted per log2 msec bucket */
+	uint16_t lat_hist[INFRA_LAT_BUCKETS];
+	/** number of lost queries, counted with the histogram */
+	uint16_t lat_lost;
+};
+
+/**
+ * Server information, shared between the zones of a server address.
+ */
+struct infra_server_key {
+	/** the host address and port. */
+	struct infra_addr addr;
+	/** hash table entry, data of type infra_server_data. */
+	struct lruhash_entry entry;
+};
+
+/**
+ * Roundtrip and EDNS information for a server address.  New zone entries
+ * for the server start with it, and zone updates are fed back into it.
+ */
+struct infra_server_data {
+	/** TTL value for this entry. absolute time. */
+	time_t ttl;
+	/** round trip times for timeout calculation */
+	struct rtt_info rtt;
+	/** edns version that the host supports, -1 means no EDNS */
+	int edns_version;
+	/** if the EDNS lameness is already known or not. */
+	uint8_t edns_lame_known;
 };
 
 /**
@@ -120,6 +176,26 @@ struct infra_cache {
 	rbtree_type domain_limits;
 	/** hash table with query rates per client ip: ip_rate_key, ip_rate_data */
 	struct slabhash* client_ip_rates;
+	/** percentile of the latency histogram used for server selection,
+	 * 0 selects with the smoothed rtt */
+	int sel_percentile;
+	/** token bucket size for domain ratelimits, 0 uses qps counters */
+	int ratelimit_burst;
+	/** token bucket size for ip ratelimits, 0 uses qps counters */
+	int ip_ratelimit_burst;
+	/** prefix length ipv4 clients are aggregated to for ip ratelimits */
+	int ip_ratelimit_prefix4;
+	/** prefix length ipv6 clients are aggregated to for ip ratelimits */
+	int ip_ratelimit_prefix6;
+	/** netblocks exempt from ip ratelimits, struct addr_tree_node */
+	rbtree_type ip_ratelimit_exempt;
+	/** hash table with jostle evictions per zone: rate_key, evict_data,
+	 * NULL if jostle-adaptive is off */
+	struct slabhash* domain_evicts;
+	/** hash table with information per server address:
+	 * infra_server_key, infra_server_data,
+	 * NULL if infra-cache-server-shared is off */
+	struct slabhash* servers;
 };
 
 /** ratelimit, unless overridden by domain_limits, 0 is off */
@@ -180,15 +256,50 @@ struct rate_data {
 	/** what the timestamp is of the qps array members, counter is
 	 * valid for that timestamp.  Usually now and now-1. */
 	time_t timestamp[RATE_WINDOW];
+	/** token bucket, if a burst is configured.  Tokens available, in
+	 * thousandths of a query. */
+	long long tokens;
+	/** token bucket, msec time of the last refill */
+	long long tokens_time;
 };
 
 #define ip_rate_data rate_data
 
+/**
+ * Data for the eviction counters per domain name.
+ * Incremented when a query state that works on the zone (the delegation
+ * point) is jostled out to make space for a new query.
+ */
+struct evict_data {
+	/** number of query states evicted for the zone */
+	size_t count;
+	/** time of the last eviction */
+	time_t last;
+};
+
 /** infra host cache default hash lookup size */
 #define INFRA_HOST_STARTSIZE 32
 /** bytes per zonename reserved in the hostcache, dnamelen(zonename.com.) */
 #define INFRA_BYTES_NAME 14
 
+/**
+ * Pack an address into the compact form of the infra cache.
+ * @param a: the compact address is returned here.
+ * @param addr: host address, IPv4 or IPv6.
+ * @param addrlen: length of addr.
+ */
+void infra_addr_pack(struct infra_addr* a, struct sockaddr_storage* addr,
+	socklen_t addrlen);
+
+/**
+ * Unpack the compact address of the infra cache.
+ * @param a: the compact address.
+ * @param addr: the address is returned here, IPv4 for mapped addresses.
+ * @param addrlen: length of addr is returned here.
+ */
+void infra_addr_unpack(struct infra_addr* a, struct sockaddr_storage* addr,
+	socklen_t* addrlen);
+
 /**
  * Create infra cache.
  * @param cfg: config parameters or NULL for defaults.
@@ -366,12 +477,13 @@ long long infra_get_host_rto(struct infra_cache* infra,
  * @param name: zone name
  * @param namelen: zone name length
  * @param timenow: what time it is now.
+ * @param tv: time now with more precision, for the token bucket, or NULL.
  * @return 1 if it could be incremented. 0 if the increment overshot the
  * ratelimit or if in the previous second the ratelimit was exceeded.
  * Failures like alloc failures are not returned (probably as 1).
  */
 int infra_ratelimit_inc(struct infra_cache* infra, uint8_t* name,
-	size_t namelen, time_t timenow);
+	size_t namelen, time_t timenow, struct timeval* tv);
 
 /**
  * Decrement the query rate counter for a delegation point.
@@ -382,9 +494,10 @@ int infra_ratelimit_inc(struct infra_cache* infra, uint8_t* name,
  * @param name: zone name
  * @param namelen: zone name length
  * @param timenow: what time it is now.
+ * @param tv: time now with more precision, for the token bucket, or NULL.
  */
 void infra_ratelimit_dec(struct infra_cache* infra, uint8_t* name,
-	size_t namelen, time_t timenow);
+	size_t namelen, time_t timenow, struct timeval* tv);
 
 /**
  * See if the query rate counter for a delegation point is exceeded.
@@ -393,11 +506,57 @@ void infra_ratelimit_dec(struct infra_cache* infra, uint8_t* name,
  * @param name: zone name
  * @param namelen: zone name length
  * @param timenow: what time it is now.
+ * @param tv: time now with more precision, for the token bucket, or NULL.
  * @return true if exceeded.
  */
 int infra_ratelimit_exceeded(struct infra_cache* infra, uint8_t* name,
+	size_t namelen, time_t timenow, struct timeval* tv);
+
+/**
+ * Get the expected time to get an answer from a server for a zone.
+ * It is the retransmit timeout, multiplied by one plus the number of
+ * recent timeouts, so that slow and failing servers score higher.
+ * @param infra: infra cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: zone name
+ * @param namelen: zone name length
+ * @param timenow: what time it is now.
+ * @return expected msec, or 0 if no (valid) information is in the cache.
+ */
+int infra_expected_rtt(struct infra_cache* infra,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
+	size_t namelen, time_t timenow);
+
+/**
+ * Increment the eviction counter for a zone.
+ * @param infra: infra cache, nothing happens without domain_evicts.
+ * @param name: zone name, the delegation point of the evicted query.
+ * @param namelen: zone name length
+ * @param timenow: what time it is now.
+ */
+void infra_evict_inc(struct infra_cache* infra, uint8_t* name,
 	size_t namelen, time_t timenow);
 
+/**
+ * Get the eviction counter for a zone.
+ * @param infra: infra cache.
+ * @param name: zone name.
+ * @param namelen: zone name length
+ * @return number of evictions counted, 0 if none.
+ */
+size_t infra_evict_count(struct infra_cache* infra, uint8_t* name,
+	size_t namelen);
+
+/**
+ * Get a percentile from the latency histogram of a host.
+ * @param data: the host data, caller holds the lock.
+ * @param pct: the percentile, 1-100.
+ * @return the estimated latency in msec, interpolated in the bucket,
+ *	or -1 if there are no replies counted.
+ */
+int infra_lat_percentile(struct infra_data* data, int pct);
+
 /** find the maximum rate stored, not too old. 0 if no information. */
 int infra_rate_max(void* data, time_t now);
 
@@ -410,10 +569,11 @@ int infra_find_ratelimit(struct infra_cache* infra, uint8_t* name,
  *  @param infra: infra cache
  *  @param repinfo: information about client
  *  @param timenow: what time it is now.
+ *  @param tv: time now with more precision, for the token bucket, or NULL.
  *  @return 1 if it could be incremented. 0 if the increment overshot the
  *  ratelimit and the query should be dropped. */
 int infra_ip_ratelimit_inc(struct infra_cache* infra,
-	struct comm_reply* repinfo, time_t timenow);
+	struct comm_reply* repinfo, time_t timenow, struct timeval* tv);
 
 /**
  * Get memory used by the infra cache.
@@ -459,4 +619,22 @@ void ip_rate_delkeyfunc(void* d, void* arg);
 /* delete data */
 #define ip_rate_deldatafunc rate_deldatafunc
 
+/** calculate size for the eviction counter hashtable, rate_key keys */
+size_t evict_sizefunc(void* k, void* d);
+
+/** delete eviction counter data */
+#define evict_deldatafunc rate_deldatafunc
+
+/** calculate size for the server hashtable */
+size_t infra_server_sizefunc(void* k, void* d);
+
+/** compare two server addresses, returns -1, 0, or +1 */
+int infra_server_compfunc(void* key1, void* key2);
+
+/** delete server key, and destroy the lock */
+void infra_server_delkeyfunc(void* k, void* arg);
+
+/** delete server data */
+#define infra_server_deldatafunc rate_deldatafunc
+
 #endif /* SERVICES_CACHE_INFRA_H */
@@ -45,8 +45,10 @@
 #include "util/config_file.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/msgreply.h"
+#include "util/data/dname.h"
 #include "util/regional.h"
 #include "util/alloc.h"
+#include "validator/val_sigcrypt.h"
 
 void
 rrset_markdel(void* key)
@@ -86,6 +88,8 @@ struct rrset_cache* rrset_cache_adjust(struct rrset_cache *r,
 		rrset_cache_delete(r);
 		r = rrset_cache_create(cfg, alloc);
 	}
+	if(r && cfg)
+		slabhash_setclock(&r->table, cfg->cache_clock_eviction);
 	return r;
 }
 
@@ -104,6 +108,14 @@ rrset_cache_touch(struct rrset_cache* r, struct ub_packed_rrset_key* key,
 	 * And if two threads do this, it results in deadlock.
 	 * So, the caller must not hold entrylock.
 	 */
+	if(table->clock) {
+		/* the entry lock is enough to set the reference bit */
+		lock_rw_rdlock(&key->entry.lock);
+		if(key->id == id && key->entry.hash == hash)
+			key->entry.lru_ref = 1;
+		lock_rw_unlock(&key->entry.lock);
+		return;
+	}
 	lock_quick_lock(&table->lock);
 	/* we have locked the hash table, the item can still be deleted.
 	 * because it could already have been reclaimed, but not yet set id=0.
@@ -164,6 +176,40 @@ need_to_update_rrset(void* nd, void* cd, time_t timenow, int equal, int ns)
 	return 0;
 }
 
+/** see if an equal validated rrset in the cache lacks the canonical
+ * rdata image; then the new rrset gets the cached TTLs and trust and is
+ * stored in its place. */
+static int
+need_to_add_canon(void* nd, void* cd, int equal)
+{
+	struct packed_rrset_data* newd = (struct packed_rrset_data*)nd;
+	struct packed_rrset_data* cached = (struct packed_rrset_data*)cd;
+	size_t i;
+	if(!equal || newd->security != sec_status_secure ||
+		cached->security != sec_status_secure ||
+		cached->canon_len != 0 || newd->count == 0)
+		return 0;
+	newd->ttl = cached->ttl;
+	newd->trust = cached->trust;
+	for(i=0; i<(newd->count+newd->rrsig_count); i++)
+		newd->rr_ttl[i] = cached->rr_ttl[i];
+	return 1;
+}
+
+/** store the canonical rdata image with validated rrset data */
+static void
+rrset_store_canon(struct ub_packed_rrset_key* k)
+{
+	struct packed_rrset_data* d = (struct packed_rrset_data*)k->entry.data;
+	struct packed_rrset_data* nd;
+	if(d->security != sec_status_secure || d->canon_len != 0)
+		return;
+	if(!(nd = rrset_canonical_store(k)))
+		return; /* it is stored without */
+	free(d);
+	k->entry.data = nd;
+}
+
 /** Update RRSet special key ID */
 static void
 rrset_update_id(struct rrset_ref* ref, struct alloc_cache* alloc)
@@ -191,6 +237,8 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 	int equal = 0;
 	log_assert(ref->id != 0 && k->id != 0);
 	log_assert(k->rk.dname != NULL);
+	/* the owner name is stored in lowercase, compares are a memcmp */
+	query_dname_tolower(k->rk.dname);
 	/* looks up item with a readlock - no editing! */
 	if((e=slabhash_lookup(&r->table, h, k, 0)) != 0) {
 		/* return id and key as they will be used in the cache
@@ -205,7 +253,8 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 		equal = rrsetdata_equal((struct packed_rrset_data*)k->entry.
 			data, (struct packed_rrset_data*)e->data);
 		if(!need_to_update_rrset(k->entry.data, e->data, timenow,
-			equal, (rrset_type==LDNS_RR_TYPE_NS))) {
+			equal, (rrset_type==LDNS_RR_TYPE_NS)) &&
+			!need_to_add_canon(k->entry.data, e->data, equal)) {
 			/* cache is superior, return that value */
 			lock_rw_unlock(&e->lock);
 			ub_packed_rrset_parsedelete(k, alloc);
@@ -221,6 +270,8 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 		/* use insert to update entry to manage lruhash
 		 * cache size values nicely. */
 	}
+	/* validated rrsets keep their canonical form for later checks */
+	rrset_store_canon(k);
 	log_assert(ref->key->id != 0);
 	slabhash_insert(&r->table, h, &k->entry, k->entry.data, alloc);
 	if(e) {
@@ -0,0 +1,364 @@
+/*
+ * services/cache/wirecache.c - per thread cache of encoded replies.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the wire cache, a per thread cache of encoded
+ * replies.
+ */
+#include "config.h"
+#include "services/cache/wirecache.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/data/msgencode.h"
+#include "util/data/packed_rrset.h"
+#include "util/data/dname.h"
+#include "util/net_help.h"
+#include "util/log.h"
+#include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
+
+/** smallest number of hash bins */
+#define WIRECACHE_MIN_BINS 64
+/** largest number of hash bins */
+#define WIRECACHE_MAX_BINS 65536
+/** expected average size of an entry, to size the hash table */
+#define WIRECACHE_AVG_SIZE 512
+
+struct wirecache*
+wirecache_create(size_t maxmem)
+{
+	struct wirecache* wc = (struct wirecache*)calloc(1, sizeof(*wc));
+	if(!wc)
+		return NULL;
+	wc->max = maxmem;
+	wc->num_bins = WIRECACHE_MIN_BINS;
+	while(wc->num_bins < WIRECACHE_MAX_BINS &&
+		wc->num_bins*WIRECACHE_AVG_SIZE < maxmem)
+		wc->num_bins *= 2;
+	wc->mask = wc->num_bins - 1;
+	wc->bins = (struct wirecache_entry**)calloc(wc->num_bins,
+		sizeof(struct wirecache_entry*));
+	wc->buf = sldns_buffer_new(65535);
+	if(!wc->bins || !wc->buf) {
+		wirecache_delete(wc);
+		return NULL;
+	}
+	return wc;
+}
+
+void
+wirecache_clear(struct wirecache* wc)
+{
+	struct wirecache_entry* e, *n;
+	if(!wc)
+		return;
+	for(e=wc->lru_start; e; e=n) {
+		n = e->lru_next;
+		free(e);
+	}
+	memset(wc->bins, 0, wc->num_bins*sizeof(struct wirecache_entry*));
+	wc->lru_start = NULL;
+	wc->lru_end = NULL;
+	wc->num = 0;
+	wc->used = 0;
+}
+
+void
+wirecache_delete(struct wirecache* wc)
+{
+	if(!wc)
+		return;
+	if(wc->bins)
+		wirecache_clear(wc);
+	free(wc->bins);
+	sldns_buffer_free(wc->buf);
+	free(wc);
+}
+
+size_t
+wirecache_get_mem(struct wirecache* wc)
+{
+	if(!wc)
+		return 0;
+	return sizeof(*wc) + wc->num_bins*sizeof(struct wirecache_entry*) +
+		sldns_buffer_capacity(wc->buf) + wc->used;
+}
+
+/** remove entry from lru list */
+static void
+wirecache_lru_remove(struct wirecache* wc, struct wirecache_entry* e)
+{
+	if(e->lru_prev)
+		e->lru_prev->lru_next = e->lru_next;
+	else	wc->lru_start = e->lru_next;
+	if(e->lru_next)
+		e->lru_next->lru_prev = e->lru_prev;
+	else	wc->lru_end = e->lru_prev;
+}
+
+/** add entry to the front of the lru list */
+static void
+wirecache_lru_front(struct wirecache* wc, struct wirecache_entry* e)
+{
+	e->lru_prev = NULL;
+	e->lru_next = wc->lru_start;
+	if(wc->lru_start)
+		wc->lru_start->lru_prev = e;
+	else	wc->lru_end = e;
+	wc->lru_start = e;
+}
+
+void
+wirecache_remove(struct wirecache* wc, struct wirecache_entry* e)
+{
+	struct wirecache_entry** p = &wc->bins[e->hash & wc->mask];
+	while(*p && *p != e)
+		p = &(*p)->next;
+	if(*p)
+		*p = e->next;
+	wirecache_lru_remove(wc, e);
+	wc->num--;
+	wc->used -= e->size;
+	free(e);
+}
+
+struct wirecache_entry*
+wirecache_lookup(struct wirecache* wc, struct query_info* qinfo,
+	uint16_t qflags, int dnssec, hashvalue_type hash)
+{
+	struct wirecache_entry* e;
+	qflags &= (BIT_CD|BIT_AD);
+	for(e=wc->bins[hash & wc->mask]; e; e=e->next) {
+		if(e->hash == hash && e->qtype == qinfo->qtype &&
+			e->qclass == qinfo->qclass && e->qflags == qflags &&
+			e->dnssec == dnssec &&
+			e->qname_len == qinfo->qname_len &&
+			query_dname_compare(e->qname, qinfo->qname) == 0)
+			break;
+	}
+	if(e && e != wc->lru_start) {
+		wirecache_lru_remove(wc, e);
+		wirecache_lru_front(wc, e);
+	}
+	return e;
+}
+
+int
+wirecache_entry_valid(struct wirecache_entry* e, struct reply_info* rep)
+{
+	size_t i;
+	if(e->rep != rep || e->rep_ttl != rep->ttl ||
+		e->rep_flags != rep->flags ||
+		e->rep_security != (int)rep->security ||
+		e->rrset_count != rep->rrset_count)
+		return 0;
+	for(i=0; i<rep->rrset_count; i++) {
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			rep->ref[i].key->entry.data;
+		/* the reply can be a new one at the same address, and the
+		 * rrset key can be reused for another rrset, the IDs are
+		 * unique */
+		if(e->rrset_id[i] != rep->ref[i].id ||
+			e->rrset_id[i] != rep->ref[i].key->id)
+			return 0;
+		if(e->rrset_data[i] != (void*)d || e->rrset_ttl[i] != d->ttl)
+			return 0;
+	}
+	return 1;
+}
+
+int
+wirecache_answer(struct wirecache_entry* e, struct query_info* qinfo,
+	uint16_t id, uint16_t qflags, sldns_buffer* pkt, time_t now,
+	struct edns_data* edns, size_t maxsize)
+{
+	uint8_t* p = sldns_buffer_begin(pkt);
+	size_t i, rest = LDNS_HEADER_SIZE + e->qname_len;
+	size_t need = e->wire_len;
+	uint16_t flags;
+	if(edns->edns_present)
+		need += calc_edns_field_size(edns);
+	if(need > maxsize || need > sldns_buffer_capacity(pkt))
+		return 0;
+	/* the header, the query name as given, and the rest of the reply */
+	memmove(p, e->wire, LDNS_HEADER_SIZE);
+	if(qinfo->qname != p + LDNS_HEADER_SIZE)
+		memmove(p + LDNS_HEADER_SIZE, qinfo->qname, e->qname_len);
+	memmove(p + rest, e->wire + rest, e->wire_len - rest);
+	sldns_buffer_clear(pkt);
+	sldns_buffer_set_position(pkt, e->wire_len);
+	sldns_buffer_flip(pkt);
+	sldns_buffer_write_at(pkt, 0, &id, sizeof(id));
+	flags = (sldns_buffer_read_u16_at(pkt, 2) & ~BIT_RD) | (qflags&BIT_RD);
+	sldns_buffer_write_u16_at(pkt, 2, flags);
+	for(i=0; i<e->num_ttl; i++) {
+		if(e->ttl_abs[i] > now)
+			sldns_buffer_write_u32_at(pkt, e->ttl_pos[i],
+				(uint32_t)(e->ttl_abs[i] - now));
+		else	sldns_buffer_write_u32_at(pkt, e->ttl_pos[i], 0);
+	}
+	attach_edns_record(pkt, edns);
+	return 1;
+}
+
+/** find the TTL positions in the encoded reply, returns number of RRs
+ * or -1 if malformed. If pos is not NULL, the positions are stored. */
+static int
+wirecache_find_ttls(sldns_buffer* wire, uint16_t* pos)
+{
+	size_t i, num;
+	int n = 0;
+	if(sldns_buffer_limit(wire) < LDNS_HEADER_SIZE ||
+		LDNS_QDCOUNT(sldns_buffer_begin(wire)) != 1)
+		return -1;
+	num = (size_t)LDNS_ANCOUNT(sldns_buffer_begin(wire)) +
+		(size_t)LDNS_NSCOUNT(sldns_buffer_begin(wire)) +
+		(size_t)LDNS_ARCOUNT(sldns_buffer_begin(wire));
+	sldns_buffer_set_position(wire, LDNS_HEADER_SIZE);
+	if(!pkt_dname_len(wire) || sldns_buffer_remaining(wire) < 4)
+		return -1;
+	sldns_buffer_skip(wire, 4);
+	for(i=0; i<num; i++) {
+		uint16_t rdlen;
+		if(!pkt_dname_len(wire) || sldns_buffer_remaining(wire) < 10)
+			return -1;
+		sldns_buffer_skip(wire, 4);
+		if(pos)
+			pos[n] = (uint16_t)sldns_buffer_position(wire);
+		n++;
+		sldns_buffer_skip(wire, 4);
+		rdlen = sldns_buffer_read_u16(wire);
+		if(sldns_buffer_remaining(wire) < rdlen)
+			return -1;
+		sldns_buffer_skip(wire, (ssize_t)rdlen);
+	}
+	if(sldns_buffer_remaining(wire) != 0)
+		return -1;
+	return n;
+}
+
+/** make room for an entry of the given size */
+static void
+wirecache_make_space(struct wirecache* wc, size_t size)
+{
+	while(wc->lru_end && wc->used + size > wc->max)
+		wirecache_remove(wc, wc->lru_end);
+}
+
+int
+wirecache_store(struct wirecache* wc, struct query_info* qinfo,
+	uint16_t qflags, int dnssec, hashvalue_type hash,
+	struct reply_info* rep, sldns_buffer* wire, time_t now, int secure)
+{
+	struct wirecache_entry* e;
+	size_t i, size, len = sldns_buffer_limit(wire);
+	int num_ttl;
+	uint8_t* p;
+
+	for(i=0; i<rep->rrset_count; i++) {
+		/* rrsets with fixed TTL are not stored, the patched TTLs
+		 * count down from the time of encoding */
+		if((rep->rrsets[i]->rk.flags & PACKED_RRSET_FIXEDTTL))
+			return 0;
+	}
+	if(len > 65535 || LDNS_TC_WIRE(sldns_buffer_begin(wire)))
+		return 0;
+	if((num_ttl = wirecache_find_ttls(wire, NULL)) < 0)
+		return 0;
+	size = sizeof(*e) + rep->rrset_count*(sizeof(rrset_id_type)+
+		sizeof(void*)+sizeof(time_t))
+		+ (size_t)num_ttl*(sizeof(time_t)+sizeof(uint16_t)) + len;
+	if(size > wc->max)
+		return 0;
+
+	/* replace existing entry */
+	if((e = wirecache_lookup(wc, qinfo, qflags, dnssec, hash)) != NULL)
+		wirecache_remove(wc, e);
+	wirecache_make_space(wc, size);
+	e = (struct wirecache_entry*)malloc(size);
+	if(!e)
+		return 0;
+	memset(e, 0, sizeof(*e));
+	p = (uint8_t*)e + sizeof(*e);
+	/* arrays of larger alignment first */
+	e->rrset_id = (rrset_id_type*)p;
+	p += rep->rrset_count*sizeof(rrset_id_type);
+	e->rrset_data = (void**)p;
+	p += rep->rrset_count*sizeof(void*);
+	e->rrset_ttl = (time_t*)p;
+	p += rep->rrset_count*sizeof(time_t);
+	e->ttl_abs = (time_t*)p;
+	p += (size_t)num_ttl*sizeof(time_t);
+	e->ttl_pos = (uint16_t*)p;
+	p += (size_t)num_ttl*sizeof(uint16_t);
+	e->wire = p;
+	memmove(e->wire, sldns_buffer_begin(wire), len);
+	e->wire_len = len;
+	e->size = size;
+	e->hash = hash;
+	e->qname = e->wire + LDNS_HEADER_SIZE;
+	e->qname_len = qinfo->qname_len;
+	e->qtype = qinfo->qtype;
+	e->qclass = qinfo->qclass;
+	e->qflags = qflags & (BIT_CD|BIT_AD);
+	e->dnssec = dnssec;
+	e->secure = secure;
+	e->rep = rep;
+	e->rep_ttl = rep->ttl;
+	e->rep_flags = rep->flags;
+	e->rep_security = (int)rep->security;
+	e->rrset_count = rep->rrset_count;
+	for(i=0; i<rep->rrset_count; i++) {
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			rep->ref[i].key->entry.data;
+		e->rrset_id[i] = rep->ref[i].id;
+		e->rrset_data[i] = (void*)d;
+		e->rrset_ttl[i] = d->ttl;
+	}
+	e->num_ttl = (size_t)num_ttl;
+	(void)wirecache_find_ttls(wire, e->ttl_pos);
+	for(i=0; i<e->num_ttl; i++)
+		e->ttl_abs[i] = (time_t)sldns_buffer_read_u32_at(wire,
+			e->ttl_pos[i]) + now;
+
+	e->next = wc->bins[hash & wc->mask];
+	wc->bins[hash & wc->mask] = e;
+	wirecache_lru_front(wc, e);
+	wc->num++;
+	wc->used += size;
+	return 1;
+}
@@ -0,0 +1,238 @@
+/*
+ * services/cache/wirecache.h - per thread cache of encoded replies.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the wire cache.  It is a per thread cache of
+ * encoded replies, for answers from the message cache.  A hit copies
+ * the stored reply and only patches the ID, the RD flag, the TTLs and
+ * the EDNS record, instead of encoding the reply again.
+ *
+ * It is not locked, every thread has its own.  The entries refer to the
+ * message cache entry and the rrsets they were made from; those are not
+ * dereferenced by the wire cache, the caller holds the message entry
+ * lock and the rrset locks, and checks the entry with
+ * wirecache_entry_valid.  The entry stores the rrset IDs, like the
+ * rrset references of the message cache.  An rrset that got a new ID,
+ * was updated in place or has expired makes the entry invalid.
+ */
+
+#ifndef SERVICES_CACHE_WIRECACHE_H
+#define SERVICES_CACHE_WIRECACHE_H
+#include "util/storage/lruhash.h"
+#include "util/data/packed_rrset.h"
+struct query_info;
+struct reply_info;
+struct edns_data;
+struct sldns_buffer;
+
+/**
+ * An encoded reply in the wire cache.
+ * Allocated in one block, with the arrays and the wire data after it.
+ */
+struct wirecache_entry {
+	/** next in hash bin */
+	struct wirecache_entry* next;
+	/** lru list, previous, towards most recently used */
+	struct wirecache_entry* lru_prev;
+	/** lru list, next, towards least recently used */
+	struct wirecache_entry* lru_next;
+	/** hash value of the query and flags */
+	hashvalue_type hash;
+	/** query name, as encoded in the reply */
+	uint8_t* qname;
+	/** length of qname */
+	size_t qname_len;
+	/** query type, host order */
+	uint16_t qtype;
+	/** query class, host order */
+	uint16_t qclass;
+	/** query flags that change the reply, CD and AD */
+	uint16_t qflags;
+	/** if the DO bit was set */
+	int dnssec;
+	/** if the reply was secure, for statistics */
+	int secure;
+	/** the message cache reply this was made from, not dereferenced */
+	struct reply_info* rep;
+	/** the ttl of that reply, to notice a reply that was replaced */
+	time_t rep_ttl;
+	/** the flags of that reply */
+	uint16_t rep_flags;
+	/** the security status of that reply */
+	int rep_security;
+	/** number of rrset references */
+	size_t rrset_count;
+	/** rrset id, per reference, as in the rrset_ref of the reply.
+	 * The pointers can be reused for other rrsets, the ids are not. */
+	rrset_id_type* rrset_id;
+	/** rrset data, per reference, to notice updates in place */
+	void** rrset_data;
+	/** rrset ttl, per reference */
+	time_t* rrset_ttl;
+	/** number of RRs in the reply, and the TTL fields */
+	size_t num_ttl;
+	/** position of the TTL fields in the wire */
+	uint16_t* ttl_pos;
+	/** absolute expiry time of the RRs */
+	time_t* ttl_abs;
+	/** the encoded reply, without EDNS record */
+	uint8_t* wire;
+	/** length of the wire */
+	size_t wire_len;
+	/** size of the allocation, for memory accounting */
+	size_t size;
+};
+
+/**
+ * The wire cache, per thread.
+ */
+struct wirecache {
+	/** hash bins, size is a power of two */
+	struct wirecache_entry** bins;
+	/** number of bins */
+	size_t num_bins;
+	/** mask for the bins */
+	size_t mask;
+	/** number of entries */
+	size_t num;
+	/** memory used by entries */
+	size_t used;
+	/** maximum memory for entries */
+	size_t max;
+	/** most recently used entry */
+	struct wirecache_entry* lru_start;
+	/** least recently used entry */
+	struct wirecache_entry* lru_end;
+	/** buffer to encode replies in */
+	struct sldns_buffer* buf;
+};
+
+/**
+ * Create wire cache.
+ * @param maxmem: maximum memory used by the entries.
+ * @return new wire cache or NULL on malloc failure.
+ */
+struct wirecache* wirecache_create(size_t maxmem);
+
+/**
+ * Delete wire cache.
+ * @param wc: wire cache to delete.
+ */
+void wirecache_delete(struct wirecache* wc);
+
+/**
+ * Remove all entries from the wire cache.
+ * @param wc: wire cache.
+ */
+void wirecache_clear(struct wirecache* wc);
+
+/**
+ * Get memory used by the wire cache.
+ * @param wc: wire cache.
+ * @return memory in bytes.
+ */
+size_t wirecache_get_mem(struct wirecache* wc);
+
+/**
+ * Lookup the encoded reply for a query, and make it most recently used.
+ * @param wc: wire cache.
+ * @param qinfo: query, the name is compared case insensitive.
+ * @param qflags: query flags, of which CD and AD are used.
+ * @param dnssec: if the DO bit is set.
+ * @param hash: hash value of the query, the message cache hash.
+ * @return entry or NULL if not found.
+ */
+struct wirecache_entry* wirecache_lookup(struct wirecache* wc,
+	struct query_info* qinfo, uint16_t qflags, int dnssec,
+	hashvalue_type hash);
+
+/**
+ * Remove an entry from the wire cache and free it.
+ * @param wc: wire cache.
+ * @param e: entry to remove.
+ */
+void wirecache_remove(struct wirecache* wc, struct wirecache_entry* e);
+
+/**
+ * Check if the entry is still made from the cached reply.
+ * The caller holds the message cache entry lock, and the rrset locks
+ * obtained with rrset_array_lock, that also checked the rrset IDs.
+ * @param e: the entry.
+ * @param rep: the reply in the message cache.
+ * @return false if the entry is out of date.
+ */
+int wirecache_entry_valid(struct wirecache_entry* e, struct reply_info* rep);
+
+/**
+ * Create the reply from the entry.  Copies the wire into the buffer, and
+ * patches ID, RD flag, TTLs and EDNS.  The query name is kept as it is in
+ * the buffer, so it has the case of the query.
+ * @param e: the entry.
+ * @param qinfo: the query, its qname is written in the reply.
+ * @param id: query ID, in network order.
+ * @param qflags: query flags, the RD flag is copied.
+ * @param pkt: buffer to write the reply in.
+ * @param now: current time.
+ * @param edns: EDNS record to add, if edns_present.
+ * @param maxsize: maximum size of the reply.
+ * @return false if the reply does not fit, the buffer is not changed.
+ */
+int wirecache_answer(struct wirecache_entry* e, struct query_info* qinfo,
+	uint16_t id, uint16_t qflags, struct sldns_buffer* pkt, time_t now,
+	struct edns_data* edns, size_t maxsize);
+
+/**
+ * Store an encoded reply in the wire cache.  The reply has to be encoded
+ * from the cached reply with the rrsets still locked, without EDNS,
+ * and without truncation.  An existing entry for the query is replaced.
+ * @param wc: wire cache.
+ * @param qinfo: query.
+ * @param qflags: query flags, of which CD and AD are stored.
+ * @param dnssec: if the DO bit is set.
+ * @param hash: hash value of the query.
+ * @param rep: the reply in the message cache, with its rrsets locked.
+ * @param wire: the encoded reply.
+ * @param now: the time used for encoding.
+ * @param secure: if the reply is secure.
+ * @return false on malloc failure or malformed wire.
+ */
+int wirecache_store(struct wirecache* wc, struct query_info* qinfo,
+	uint16_t qflags, int dnssec, hashvalue_type hash,
+	struct reply_info* rep, struct sldns_buffer* wire, time_t now,
+	int secure);
+
+#endif /* SERVICES_CACHE_WIRECACHE_H */
@@ -0,0 +1,247 @@
+/*
+ * services/inflight.c - shared table of queries in flight, for all threads.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the table of recursions that are in flight, shared by
+ * the threads.
+ */
+#include "config.h"
+#include "services/inflight.h"
+#include "util/data/msgreply.h"
+#include "util/data/dname.h"
+#include "util/log.h"
+#include "util/net_help.h"
+#include "util/tube.h"
+
+struct inflight_table*
+inflight_create(size_t size, int num_threads, struct tube** wake)
+{
+	struct inflight_table* table = (struct inflight_table*)calloc(1,
+		sizeof(*table));
+	size_t i;
+	if(!table)
+		return NULL;
+	table->size = 1024;
+	while(table->size < size && table->size < 1024*1024)
+		table->size *= 2;
+	table->num_threads = num_threads;
+	table->bin = (struct inflight_entry**)calloc(table->size,
+		sizeof(struct inflight_entry*));
+	table->wake_pending = (uint8_t*)calloc((size_t)num_threads, 1);
+	table->wake = (struct tube**)memdup(wake,
+		sizeof(struct tube*)*(size_t)num_threads);
+	if(!table->bin || !table->wake_pending || !table->wake) {
+		free(table->bin);
+		free(table->wake_pending);
+		free(table->wake);
+		free(table);
+		return NULL;
+	}
+	for(i=0; i<INFLIGHT_LOCKS; i++)
+		lock_basic_init(&table->lock[i]);
+	lock_basic_init(&table->wake_lock);
+	lock_protect(&table->wake_lock, table->wake_pending,
+		(size_t)num_threads);
+	return table;
+}
+
+/** delete the entries in the bins, caller holds the locks */
+static void
+inflight_delete_entries(struct inflight_table* table)
+{
+	size_t i;
+	for(i=0; i<table->size; i++) {
+		struct inflight_entry* e = table->bin[i], *nx;
+		while(e) {
+			nx = e->next;
+			free(e);
+			e = nx;
+		}
+		table->bin[i] = NULL;
+	}
+}
+
+void
+inflight_delete(struct inflight_table* table)
+{
+	size_t i;
+	if(!table)
+		return;
+	for(i=0; i<INFLIGHT_LOCKS; i++)
+		lock_basic_destroy(&table->lock[i]);
+	lock_basic_destroy(&table->wake_lock);
+	inflight_delete_entries(table);
+	free(table->bin);
+	free(table->wake_pending);
+	free(table->wake);
+	free(table);
+}
+
+void
+inflight_clear(struct inflight_table* table)
+{
+	size_t i;
+	if(!table)
+		return;
+	for(i=0; i<INFLIGHT_LOCKS; i++)
+		lock_basic_lock(&table->lock[i]);
+	inflight_delete_entries(table);
+	for(i=0; i<INFLIGHT_LOCKS; i++)
+		lock_basic_unlock(&table->lock[i]);
+}
+
+/** see if the entry is for the query */
+static int
+inflight_entry_match(struct inflight_entry* e, struct query_info* qinfo,
+	uint16_t flags, uint32_t hash)
+{
+	return e->hash == hash && e->qtype == qinfo->qtype &&
+		e->qclass == qinfo->qclass && e->flags == flags &&
+		e->qname_len == qinfo->qname_len &&
+		query_dname_compare(e->qname, qinfo->qname) == 0;
+}
+
+/** create a new entry, or NULL on malloc failure */
+static struct inflight_entry*
+inflight_entry_create(struct inflight_table* table, struct query_info* qinfo,
+	uint16_t flags, uint32_t hash, int thread, void* owner)
+{
+	size_t wlen = ((size_t)table->num_threads+7)/8;
+	struct inflight_entry* e = (struct inflight_entry*)malloc(
+		sizeof(*e) + qinfo->qname_len + wlen);
+	if(!e)
+		return NULL;
+	e->next = NULL;
+	e->hash = hash;
+	e->qtype = qinfo->qtype;
+	e->qclass = qinfo->qclass;
+	e->flags = flags;
+	e->qname_len = qinfo->qname_len;
+	e->qname = (uint8_t*)e + sizeof(*e);
+	memmove(e->qname, qinfo->qname, qinfo->qname_len);
+	e->owner_thread = thread;
+	e->owner = owner;
+	e->waiters = e->qname + qinfo->qname_len;
+	memset(e->waiters, 0, wlen);
+	return e;
+}
+
+int
+inflight_acquire(struct inflight_table* table, struct query_info* qinfo,
+	uint16_t flags, uint32_t hash, int thread, void* owner)
+{
+	size_t b = hash & (table->size-1);
+	lock_basic_type* lock = &table->lock[b & (INFLIGHT_LOCKS-1)];
+	struct inflight_entry* e;
+	lock_basic_lock(lock);
+	for(e = table->bin[b]; e; e = e->next) {
+		if(inflight_entry_match(e, qinfo, flags, hash)) {
+			if(e->owner_thread == thread) {
+				/* our own, for a state that is not the
+				 * same, like a different client info */
+				lock_basic_unlock(lock);
+				return 1;
+			}
+			e->waiters[thread/8] |= (uint8_t)(1<<(thread%8));
+			lock_basic_unlock(lock);
+			return 0;
+		}
+	}
+	/* if out of memory, resolve it without the table */
+	if((e = inflight_entry_create(table, qinfo, flags, hash, thread,
+		owner)) != NULL) {
+		e->next = table->bin[b];
+		table->bin[b] = e;
+	}
+	lock_basic_unlock(lock);
+	return 1;
+}
+
+/** wake up a thread, unless a wakeup is already pending for it */
+static void
+inflight_wake(struct inflight_table* table, int thread)
+{
+	int send = 0;
+	lock_basic_lock(&table->wake_lock);
+	if(!table->wake_pending[thread]) {
+		table->wake_pending[thread] = 1;
+		send = 1;
+	}
+	lock_basic_unlock(&table->wake_lock);
+	if(send) {
+		uint32_t c = 0;
+		if(!tube_write_msg(table->wake[thread], (uint8_t*)&c,
+			sizeof(c), 0)) {
+			log_err("could not wake up thread %d", thread);
+			inflight_wakeup_done(table, thread);
+		}
+	}
+}
+
+void
+inflight_release(struct inflight_table* table, uint32_t hash, void* owner)
+{
+	size_t b = hash & (table->size-1);
+	lock_basic_type* lock = &table->lock[b & (INFLIGHT_LOCKS-1)];
+	struct inflight_entry** p, *e;
+	int i;
+	lock_basic_lock(lock);
+	for(p = &table->bin[b]; *p; p = &(*p)->next) {
+		if((*p)->owner == owner && (*p)->hash == hash)
+			break;
+	}
+	if(!(e = *p)) {
+		/* not in the table, it was cleared or out of memory */
+		lock_basic_unlock(lock);
+		return;
+	}
+	*p = e->next;
+	lock_basic_unlock(lock);
+	for(i=0; i<table->num_threads; i++) {
+		if(e->waiters[i/8] & (1<<(i%8)))
+			inflight_wake(table, i);
+	}
+	free(e);
+}
+
+void
+inflight_wakeup_done(struct inflight_table* table, int thread)
+{
+	lock_basic_lock(&table->wake_lock);
+	table->wake_pending[thread] = 0;
+	lock_basic_unlock(&table->wake_lock);
+}
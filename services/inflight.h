@@ -0,0 +1,159 @@
+/*
+ * services/inflight.h - shared table of queries in flight, for all threads.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the table of recursions that are in flight, shared by
+ * the threads.  A thread that gets a query for a name that another thread
+ * is already resolving waits for that to finish, and then answers from the
+ * cache, instead of sending the same queries upstream.
+ */
+
+#ifndef SERVICES_INFLIGHT_H
+#define SERVICES_INFLIGHT_H
+#include "util/locks.h"
+struct query_info;
+struct tube;
+
+/** number of locks for the table, power of two */
+#define INFLIGHT_LOCKS 64
+
+/**
+ * Entry for a query that is resolved by a thread.
+ */
+struct inflight_entry {
+	/** next in the hash bin */
+	struct inflight_entry* next;
+	/** hash of the query and flags */
+	uint32_t hash;
+	/** query type */
+	uint16_t qtype;
+	/** query class */
+	uint16_t qclass;
+	/** the RD and CD query flags */
+	uint16_t flags;
+	/** length of qname */
+	size_t qname_len;
+	/** the query name, allocated after the entry */
+	uint8_t* qname;
+	/** the thread that resolves it */
+	int owner_thread;
+	/** the mesh state of the owner, only compared, not used */
+	void* owner;
+	/** bitmap of threads that wait for it, allocated after the entry */
+	uint8_t* waiters;
+};
+
+/**
+ * The shared table of queries in flight.
+ */
+struct inflight_table {
+	/** locks, a bin is protected by lock[bin%INFLIGHT_LOCKS] */
+	lock_basic_type lock[INFLIGHT_LOCKS];
+	/** hash bins, fixed size, power of two */
+	struct inflight_entry** bin;
+	/** number of bins */
+	size_t size;
+	/** number of threads */
+	int num_threads;
+	/** lock on the wake_pending array */
+	lock_basic_type wake_lock;
+	/** per thread, true if a wakeup was sent and not handled yet */
+	uint8_t* wake_pending;
+	/** per thread, the tube that wakes it up.  Because a wakeup is
+	 * only sent if none is pending, there is one writer at a time. */
+	struct tube** wake;
+};
+
+/**
+ * Create the inflight table.
+ * @param size: the number of queries that can be in flight, the number
+ *	of bins is made about that size.
+ * @param num_threads: number of threads that use the table.
+ * @param wake: array of the wakeup tubes of the threads, it is copied.
+ * @return new table or NULL on malloc failure.
+ */
+struct inflight_table* inflight_create(size_t size, int num_threads,
+	struct tube** wake);
+
+/**
+ * Delete the inflight table, and the entries.
+ * @param table: to delete.
+ */
+void inflight_delete(struct inflight_table* table);
+
+/**
+ * Remove all entries, without waking up threads.  Used when the threads
+ * stop.
+ * @param table: the table.
+ */
+void inflight_clear(struct inflight_table* table);
+
+/**
+ * Register a query as in flight for this thread, or find out that another
+ * thread is already resolving it.
+ * @param table: the table.
+ * @param qinfo: the query.
+ * @param flags: the RD and CD flags of the query.
+ * @param hash: hash of the query and flags, the same in every thread.
+ * @param thread: this thread.
+ * @param owner: pointer that identifies the query for inflight_release.
+ * @return false if another thread resolves it, and this thread is woken
+ *	up when that is done.  True if this thread should resolve it, and
+ *	then call inflight_release.
+ */
+int inflight_acquire(struct inflight_table* table, struct query_info* qinfo,
+	uint16_t flags, uint32_t hash, int thread, void* owner);
+
+/**
+ * The thread is done with a query, remove it and wake up the waiting
+ * threads.
+ * @param table: the table.
+ * @param hash: hash that was used for inflight_acquire.
+ * @param owner: the owner that was used for inflight_acquire.
+ */
+void inflight_release(struct inflight_table* table, uint32_t hash,
+	void* owner);
+
+/**
+ * The thread handles its wakeup, it can be woken up again after this.
+ * Call it before the waiting queries are checked.
+ * @param table: the table.
+ * @param thread: this thread.
+ */
+void inflight_wakeup_done(struct inflight_table* table, int thread);
+
+#endif /* SERVICES_INFLIGHT_H */
@@ -67,6 +67,10 @@
 #include <systemd/sd-daemon.h>
 #endif
 
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
+
 /** number of queued TCP connections for listen() */
 #define TCP_BACKLOG 256 
 
@@ -1194,7 +1198,8 @@ listen_cp_insert(struct comm_point* c, struct listen_dnsport* front)
 
 struct listen_dnsport* 
 listen_create(struct comm_base* base, struct listen_port* ports,
-	size_t bufsize, int tcp_accept_count, void* sslctx,
+	size_t bufsize, int tcp_accept_count, int tcp_pipeline,
+	int tcp_pipeline_total, int udp_batch_size, void* sslctx,
 	struct dt_env* dtenv, comm_point_callback_type* cb, void *cb_arg)
 {
 	struct listen_dnsport* front = (struct listen_dnsport*)
@@ -1202,6 +1207,7 @@ listen_create(struct comm_base* base, struct listen_port* ports,
 	if(!front)
 		return NULL;
 	front->cps = NULL;
+	front->tcp_spool_buff = NULL;
 	front->udp_buff = sldns_buffer_new(bufsize);
 #ifdef USE_DNSCRYPT
 	front->dnscrypt_udp_buff = NULL;
@@ -1210,6 +1216,13 @@ listen_create(struct comm_base* base, struct listen_port* ports,
 		free(front);
 		return NULL;
 	}
+	if(tcp_pipeline > 1) {
+		front->tcp_spool_buff = sldns_buffer_new(bufsize);
+		if(!front->tcp_spool_buff) {
+			listen_delete(front);
+			return NULL;
+		}
+	}
 
 	/* create comm points as needed */
 	while(ports) {
@@ -1252,6 +1265,22 @@ listen_create(struct comm_base* base, struct listen_port* ports,
 			front->dnscrypt_udp_buff = cp->dnscrypt_buffer;
 		}
 #endif
+		if((ports->ftype == listen_type_udp ||
+			ports->ftype == listen_type_udpancil) &&
+			!comm_point_set_udp_batch(cp, udp_batch_size)) {
+			comm_point_delete(cp);
+			listen_delete(front);
+			return NULL;
+		}
+		/* dnscrypt streams are answered one query at a time */
+		if((ports->ftype == listen_type_tcp ||
+			ports->ftype == listen_type_ssl) &&
+			!comm_point_set_tcp_pipeline(cp, front->tcp_spool_buff,
+			tcp_pipeline, tcp_pipeline_total)) {
+			comm_point_delete(cp);
+			listen_delete(front);
+			return NULL;
+		}
 		if(!listen_cp_insert(cp, front)) {
 			log_err("malloc failed");
 			comm_point_delete(cp);
@@ -1293,6 +1322,7 @@ listen_delete(struct listen_dnsport* front)
 		sldns_buffer_free(front->dnscrypt_udp_buff);
 	}
 #endif
+	sldns_buffer_free(front->tcp_spool_buff);
 	sldns_buffer_free(front->udp_buff);
 	free(front);
 }
@@ -1407,6 +1437,88 @@ void listening_ports_free(struct listen_port* list)
 	}
 }
 
+int listening_ports_steer_cpu(struct listen_port* list, int* cpus, int num)
+{
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+	/* the program loads the CPU number, compares it with the CPU of
+	 * every thread and returns the index of that socket.  For other
+	 * CPUs it returns num, out of range, and the kernel falls back
+	 * to the reuseport hash. */
+	struct sock_filter* code;
+	struct sock_fprog prog;
+	int i, at = 0;
+	if(!cpus) {
+#ifdef SO_DETACH_REUSEPORT_BPF
+		int dummy = 0;
+		for(; list; list = list->next) {
+			if(list->fd == -1)
+				continue;
+			if(setsockopt(list->fd, SOL_SOCKET,
+				SO_DETACH_REUSEPORT_BPF, (void*)&dummy,
+				(socklen_t)sizeof(dummy)) < 0 &&
+				errno != ENOENT) {
+				log_warn("setsockopt(.. SO_DETACH_REUSEPORT_BPF"
+					" ..) failed: %s", strerror(errno));
+				return 0;
+			}
+		}
+		return 1;
+#else
+		return 0;
+#endif
+	}
+	if(num < 1 || 2*num+2 > BPF_MAXINSNS) {
+		log_warn("so-reuseport-cbpf: cannot steer %d threads", num);
+		return 0;
+	}
+	code = (struct sock_filter*)reallocarray(NULL, (size_t)(2*num+2),
+		sizeof(*code));
+	if(!code) {
+		log_err("so-reuseport-cbpf: out of memory");
+		return 0;
+	}
+	code[at].code = BPF_LD | BPF_W | BPF_ABS;
+	code[at].jt = 0;
+	code[at].jf = 0;
+	code[at++].k = (uint32_t)(SKF_AD_OFF + SKF_AD_CPU);
+	for(i=0; i<num; i++) {
+		/* if A == cpu, continue at next, else skip the ret */
+		code[at].code = BPF_JMP | BPF_JEQ | BPF_K;
+		code[at].jt = 0;
+		code[at].jf = 1;
+		code[at++].k = (uint32_t)cpus[i];
+		code[at].code = BPF_RET | BPF_K;
+		code[at].jt = 0;
+		code[at].jf = 0;
+		code[at++].k = (uint32_t)i;
+	}
+	code[at].code = BPF_RET | BPF_K;
+	code[at].jt = 0;
+	code[at].jf = 0;
+	code[at++].k = (uint32_t)num;
+	memset(&prog, 0, sizeof(prog));
+	prog.len = (unsigned short)at;
+	prog.filter = code;
+	for(; list; list = list->next) {
+		if(list->fd == -1)
+			continue;
+		if(setsockopt(list->fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF,
+			(void*)&prog, (socklen_t)sizeof(prog)) < 0) {
+			log_warn("setsockopt(.. SO_ATTACH_REUSEPORT_CBPF ..) "
+				"failed: %s", strerror(errno));
+			free(code);
+			return 0;
+		}
+	}
+	free(code);
+	return 1;
+#else
+	(void)list; (void)cpus; (void)num;
+	log_warn("so-reuseport-cbpf is not supported on this system");
+	return 0;
+#endif
+}
+
 size_t listen_get_mem(struct listen_dnsport* listen)
 {
 	struct listen_list* p;
@@ -1419,6 +1531,9 @@ size_t listen_get_mem(struct listen_dnsport* listen)
 		s += sldns_buffer_capacity(listen->dnscrypt_udp_buff);
 	}
 #endif
+	if(listen->tcp_spool_buff)
+		s += sizeof(*listen->tcp_spool_buff) +
+			sldns_buffer_capacity(listen->tcp_spool_buff);
 	for(p = listen->cps; p; p = p->next) {
 		s += sizeof(*p);
 		s += comm_point_get_mem(p->com);
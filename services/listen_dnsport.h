@@ -62,6 +62,10 @@ struct listen_dnsport {
 #ifdef USE_DNSCRYPT
 	struct sldns_buffer* dnscrypt_udp_buff;
 #endif
+	/** buffer that answers for pipelined TCP streams are encoded into,
+	    before they are written or queued on the stream. NULL if the
+	    TCP streams are not pipelined. */
+	struct sldns_buffer* tcp_spool_buff;
 	/** list of comm points used to get incoming events */
 	struct listen_list* cps;
 };
@@ -129,6 +133,20 @@ struct listen_port* listening_ports_open(struct config_file* cfg,
  */
 void listening_ports_free(struct listen_port* list);
 
+/**
+ * Attach a socket filter to the so-reuseport socket groups that steers
+ * every incoming packet to the socket of the thread that runs on the CPU
+ * that received the packet.  Packets that arrive on other CPUs are
+ * distributed with the normal reuseport hash.
+ * @param list: the ports of thread 0, one socket of every group.
+ * @param cpus: the CPU of every thread, the index is the thread number,
+ *	and also the index of the socket in the reuseport group.
+ *	If NULL, the filter that was attached before is removed.
+ * @param num: number of threads.
+ * @return false if not supported or it failed (a warning is logged).
+ */
+int listening_ports_steer_cpu(struct listen_port* list, int* cpus, int num);
+
 /**
  * Create commpoints with for this thread for the shared ports.
  * @param base: the comm_base that provides event functionality.
@@ -137,6 +155,12 @@ void listening_ports_free(struct listen_port* list);
  * @param bufsize: size of datagram buffer.
  * @param tcp_accept_count: max number of simultaneous TCP connections 
  * 	from clients.
+ * @param tcp_pipeline: max number of queries outstanding on one TCP
+ *	connection from a client.  0 or 1 for no pipelining.
+ * @param tcp_pipeline_total: max number of queries outstanding on all
+ *	pipelined TCP connections.
+ * @param udp_batch_size: number of UDP datagrams to handle per system
+ *	call, with recvmmsg and sendmmsg.  0 or 1 for no batches.
  * @param sslctx: nonNULL if ssl context.
  * @param dtenv: nonNULL if dnstap enabled.
  * @param cb: callback function when a request arrives. It is passed
@@ -146,6 +170,7 @@ void listening_ports_free(struct listen_port* list);
  */
 struct listen_dnsport* listen_create(struct comm_base* base,
 	struct listen_port* ports, size_t bufsize, int tcp_accept_count,
+	int tcp_pipeline, int tcp_pipeline_total, int udp_batch_size,
 	void* sslctx, struct dt_env *dtenv, comm_point_callback_type* cb,
 	void* cb_arg);
 
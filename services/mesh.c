@@ -46,6 +46,7 @@
 #include "services/mesh.h"
 #include "services/outbound_list.h"
 #include "services/cache/dns.h"
+#include "services/cache/infra.h"
 #include "util/log.h"
 #include "util/net_help.h"
 #include "util/module.h"
@@ -59,6 +60,9 @@
 #include "sldns/wire2str.h"
 #include "services/localzone.h"
 #include "util/data/dname.h"
+#include "util/storage/lookup3.h"
+#include "services/inflight.h"
+#include "validator/val_cryptopool.h"
 #include "respip/respip.h"
 
 /** subtract timers and the values do not overflow or become negative */
@@ -223,6 +227,173 @@ mesh_state_ref_compare(const void* ap, const void* bp)
 	return mesh_state_compare(a->s, b->s);
 }
 
+/** initial number of buckets in the all_table, power of two */
+#define MESH_ALL_TABLE_START 256
+
+/** hash the fields that mesh_state_compare uses, except client info */
+static uint32_t
+mesh_state_hash(struct query_info* qinfo, uint16_t qflags, int prime,
+	int valrec, struct mesh_state* unique)
+{
+	uint32_t k[2];
+	uint32_t h;
+	k[0] = ((uint32_t)qinfo->qtype<<16) | (uint32_t)qinfo->qclass;
+	k[1] = (uint32_t)(qflags&(BIT_RD|BIT_CD)) | (prime?0x10000:0) |
+		(valrec?0x20000:0);
+	h = hashlittle(k, sizeof(k), 0x6d);
+	h = dname_query_hash(qinfo->qname, h);
+	if(unique)
+		h = hashlittle(&unique, sizeof(unique), h);
+	return h;
+}
+
+/** double the all_table, if that fails the chains get longer */
+static void
+mesh_all_grow(struct mesh_area* mesh)
+{
+	size_t i, newsize = mesh->all_size*2;
+	struct mesh_state** t = (struct mesh_state**)calloc(newsize,
+		sizeof(*t));
+	if(!t)
+		return;
+	for(i=0; i<mesh->all_size; i++) {
+		struct mesh_state* m = mesh->all_table[i], *nx;
+		while(m) {
+			nx = m->hash_next;
+			m->hash_next = t[m->hash&(newsize-1)];
+			t[m->hash&(newsize-1)] = m;
+			m = nx;
+		}
+	}
+	free(mesh->all_table);
+	mesh->all_table = t;
+	mesh->all_size = newsize;
+}
+
+/** add a mesh state to the all_table and the all list */
+static void
+mesh_all_insert(struct mesh_area* mesh, struct mesh_state* m)
+{
+	struct mesh_state** bin;
+	if(mesh->all_count >= mesh->all_size)
+		mesh_all_grow(mesh);
+	m->hash = mesh_state_hash(&m->s.qinfo, m->s.query_flags,
+		m->s.is_priming, m->s.is_valrec, m->unique);
+	bin = &mesh->all_table[m->hash&(mesh->all_size-1)];
+	m->hash_next = *bin;
+	*bin = m;
+	m->all_next = NULL;
+	m->all_prev = mesh->all_last;
+	if(mesh->all_last)
+		mesh->all_last->all_next = m;
+	else	mesh->all_first = m;
+	mesh->all_last = m;
+	mesh->all_count++;
+}
+
+/** remove a mesh state from the all_table and the all list */
+static void
+mesh_all_remove(struct mesh_area* mesh, struct mesh_state* m)
+{
+	struct mesh_state** p = &mesh->all_table[m->hash&(mesh->all_size-1)];
+	while(*p && *p != m)
+		p = &(*p)->hash_next;
+	if(!*p)
+		return; /* not in the table */
+	*p = m->hash_next;
+	if(m->all_prev)
+		m->all_prev->all_next = m->all_next;
+	else	mesh->all_first = m->all_next;
+	if(m->all_next)
+		m->all_next->all_prev = m->all_prev;
+	else	mesh->all_last = m->all_prev;
+	log_assert(mesh->all_count > 0);
+	mesh->all_count--;
+}
+
+/** add a mesh state to the end of the wait list */
+static void
+mesh_wait_insert(struct mesh_area* mesh, struct mesh_state* m)
+{
+	m->inflight = mesh_inflight_wait;
+	m->wait_next = NULL;
+	m->wait_prev = mesh->wait_last;
+	if(mesh->wait_last)
+		mesh->wait_last->wait_next = m;
+	else	mesh->wait_first = m;
+	mesh->wait_last = m;
+}
+
+/** remove a mesh state from the wait list */
+static void
+mesh_wait_remove(struct mesh_area* mesh, struct mesh_state* m)
+{
+	m->inflight = mesh_inflight_none;
+	if(m->wait_prev)
+		m->wait_prev->wait_next = m->wait_next;
+	else	mesh->wait_first = m->wait_next;
+	if(m->wait_next)
+		m->wait_next->wait_prev = m->wait_prev;
+	else	mesh->wait_last = m->wait_prev;
+}
+
+/**
+ * See if another thread resolves the query of a new state, if not,
+ * this thread is the owner of the query in the inflight table.
+ * @param mesh: mesh area.
+ * @param m: the mesh state.
+ * @return false if another thread resolves it, the state must wait.
+ */
+static int
+mesh_inflight_acquire(struct mesh_area* mesh, struct mesh_state* m)
+{
+	if(!inflight_acquire(mesh->inflight, &m->s.qinfo,
+		m->s.query_flags&(BIT_RD|BIT_CD), m->hash,
+		mesh->inflight_thread, m))
+		return 0;
+	m->inflight = mesh_inflight_owner;
+	return 1;
+}
+
+/** see if the client info makes no difference to the recursion, so
+ * the query can be shared with other threads */
+static int
+mesh_inflight_client_ok(struct respip_client_info* cinfo)
+{
+	return !cinfo || (!cinfo->taglist && !cinfo->tag_actions &&
+		!cinfo->tag_datas && !cinfo->view);
+}
+
+/** add a mesh state to the end of the run queue, if not queued yet */
+static void
+mesh_run_insert(struct mesh_area* mesh, struct mesh_state* m)
+{
+	if(m->run_queued)
+		return;
+	m->run_queued = 1;
+	m->run_next = NULL;
+	m->run_prev = mesh->run_last;
+	if(mesh->run_last)
+		mesh->run_last->run_next = m;
+	else	mesh->run_first = m;
+	mesh->run_last = m;
+}
+
+/** remove a mesh state from the run queue, if it is queued */
+static void
+mesh_run_remove(struct mesh_area* mesh, struct mesh_state* m)
+{
+	if(!m->run_queued)
+		return;
+	m->run_queued = 0;
+	if(m->run_prev)
+		m->run_prev->run_next = m->run_next;
+	else	mesh->run_first = m->run_next;
+	if(m->run_next)
+		m->run_next->run_prev = m->run_prev;
+	else	mesh->run_last = m->run_prev;
+}
+
 struct mesh_area* 
 mesh_create(struct module_stack* stack, struct module_env* env)
 {
@@ -238,10 +409,18 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 		log_err("mesh area alloc: out of memory");
 		return NULL;
 	}
+	mesh->all_size = MESH_ALL_TABLE_START;
+	mesh->all_table = (struct mesh_state**)calloc(mesh->all_size,
+		sizeof(struct mesh_state*));
+	if(!mesh->all_table) {
+		timehist_delete(mesh->histogram);
+		sldns_buffer_free(mesh->qbuf_bak);
+		free(mesh);
+		log_err("mesh area alloc: out of memory");
+		return NULL;
+	}
 	mesh->mods = *stack;
 	mesh->env = env;
-	rbtree_init(&mesh->run, &mesh_state_compare);
-	rbtree_init(&mesh->all, &mesh_state_compare);
 	mesh->num_reply_addrs = 0;
 	mesh->num_reply_states = 0;
 	mesh->num_detached_states = 0;
@@ -255,20 +434,19 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 	mesh->jostle_max.tv_usec = (time_t)((env->cfg->jostle_time % 1000)
 		*1000);
 #endif
+	mesh->jostle_adaptive = env->cfg->jostle_adaptive;
 	return mesh;
 }
 
 /** help mesh delete delete mesh states */
 static void
-mesh_delete_helper(rbnode_type* n)
+mesh_delete_helper(struct mesh_area* mesh)
 {
-	struct mesh_state* mstate = (struct mesh_state*)n->key;
 	/* perform a full delete, not only 'cleanup' routine,
 	 * because other callbacks expect a clean state in the mesh.
-	 * For 're-entrant' calls */
-	mesh_state_delete(&mstate->s);
-	/* but because these delete the items from the tree, postorder
-	 * traversal and rbtree rebalancing do not work together */
+	 * For 're-entrant' calls.  That also removes it from the list. */
+	while(mesh->all_first)
+		mesh_state_delete(&mesh->all_first->s);
 }
 
 void 
@@ -277,8 +455,8 @@ mesh_delete(struct mesh_area* mesh)
 	if(!mesh)
 		return;
 	/* free all query states */
-	while(mesh->all.count)
-		mesh_delete_helper(mesh->all.root);
+	mesh_delete_helper(mesh);
+	free(mesh->all_table);
 	timehist_delete(mesh->histogram);
 	sldns_buffer_free(mesh->qbuf_bak);
 	free(mesh);
@@ -288,12 +466,17 @@ void
 mesh_delete_all(struct mesh_area* mesh)
 {
 	/* free all query states */
-	while(mesh->all.count)
-		mesh_delete_helper(mesh->all.root);
+	mesh_delete_helper(mesh);
 	mesh->stats_dropped += mesh->num_reply_addrs;
 	/* clear mesh area references */
-	rbtree_init(&mesh->run, &mesh_state_compare);
-	rbtree_init(&mesh->all, &mesh_state_compare);
+	memset(mesh->all_table, 0, sizeof(struct mesh_state*)*mesh->all_size);
+	mesh->all_count = 0;
+	mesh->all_first = NULL;
+	mesh->all_last = NULL;
+	mesh->run_first = NULL;
+	mesh->run_last = NULL;
+	mesh->wait_first = NULL;
+	mesh->wait_last = NULL;
 	mesh->num_reply_addrs = 0;
 	mesh->num_reply_states = 0;
 	mesh->num_detached_states = 0;
@@ -304,45 +487,124 @@ mesh_delete_all(struct mesh_area* mesh)
 	mesh->jostle_last = NULL;
 }
 
-int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
+/**
+ * Score a jostle list entry for the adaptive admission control.
+ * The expected time to completion is the expected answer time of the
+ * server it waits for, from the infra cache, which is higher for slow and
+ * failing zones.  A state that finishes within the jostle timeout stays,
+ * others score the fraction of their work that remains, in permille, so
+ * that states that have spent the least of their expected work go first.
+ * @param mesh: the mesh area.
+ * @param m: entry in the jostle list.
+ * @return score, higher is better to evict, or -1 if it must stay.
+ */
+static int
+mesh_jostle_score(struct mesh_area* mesh, struct mesh_state* m)
+{
+	struct timeval age;
+	long long agems, maxms, expect = 0;
+	if(!m->reply_list || m->list_select != mesh_jostle_list)
+		return -1;
+	timeval_subtract(&age, mesh->env->now_tv, 
+		&m->reply_list->start_time);
+	agems = (long long)age.tv_sec*1000 + (long long)age.tv_usec/1000;
+	maxms = (long long)mesh->jostle_max.tv_sec*1000 +
+		(long long)mesh->jostle_max.tv_usec/1000;
+	if(m->s.work_zone)
+		expect = (long long)infra_expected_rtt(mesh->env->infra_cache,
+			&m->s.work_addr, m->s.work_addrlen, m->s.work_zone,
+			m->s.work_zonelen, *mesh->env->now);
+	if(agems + expect <= maxms)
+		return -1;
+	return (int)(expect*1000/(agems+expect));
+}
+
+/**
+ * Find the entry to jostle out, if any.
+ * @param mesh: the mesh area.
+ * @return the state to evict or NULL.
+ */
+static struct mesh_state*
+mesh_jostle_select(struct mesh_area* mesh)
 {
 	struct mesh_state* m = mesh->jostle_first;
+	struct mesh_state* best = NULL;
+	int i, score, best_score = -1;
+	if(!mesh->jostle_adaptive) {
+		/* the oldest item, if it is old enough */
+		struct timeval age;
+		if(!m || !m->reply_list || m->list_select != mesh_jostle_list)
+			return NULL;
+		timeval_subtract(&age, mesh->env->now_tv, 
+			&m->reply_list->start_time);
+		if(timeval_smaller(&mesh->jostle_max, &age))
+			return m;
+		return NULL;
+	}
+	for(i=0; m && i<MESH_JOSTLE_SCAN; m = m->next, i++) {
+		score = mesh_jostle_score(mesh, m);
+		if(score > best_score) {
+			best = m;
+			best_score = score;
+		}
+	}
+	if(best)
+		verbose(VERB_ALGO, "jostle score %d", best_score);
+	return best;
+}
+
+int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
+{
+	struct mesh_state* m;
 	/* free space is available */
 	if(mesh->num_reply_states < mesh->max_reply_states)
 		return 1;
 	/* try to kick out a jostle-list item */
-	if(m && m->reply_list && m->list_select == mesh_jostle_list) {
-		/* how old is it? */
-		struct timeval age;
-		timeval_subtract(&age, mesh->env->now_tv, 
-			&m->reply_list->start_time);
-		if(timeval_smaller(&mesh->jostle_max, &age)) {
-			/* its a goner */
-			log_nametypeclass(VERB_ALGO, "query jostled out to "
-				"make space for a new one",
-				m->s.qinfo.qname, m->s.qinfo.qtype,
-				m->s.qinfo.qclass);
-			/* backup the query */
-			if(qbuf) sldns_buffer_copy(mesh->qbuf_bak, qbuf);
-			/* notify supers */
-			if(m->super_set.count > 0) {
-				verbose(VERB_ALGO, "notify supers of failure");
-				m->s.return_msg = NULL;
-				m->s.return_rcode = LDNS_RCODE_SERVFAIL;
-				mesh_walk_supers(mesh, m);
-			}
-			mesh->stats_jostled ++;
-			mesh_state_delete(&m->s);
-			/* restore the query - note that the qinfo ptr to
-			 * the querybuffer is then correct again. */
-			if(qbuf) sldns_buffer_copy(qbuf, mesh->qbuf_bak);
-			return 1;
+	if((m = mesh_jostle_select(mesh)) != NULL) {
+		/* its a goner */
+		log_nametypeclass(VERB_ALGO, "query jostled out to "
+			"make space for a new one",
+			m->s.qinfo.qname, m->s.qinfo.qtype,
+			m->s.qinfo.qclass);
+		/* backup the query */
+		if(qbuf) sldns_buffer_copy(mesh->qbuf_bak, qbuf);
+		/* notify supers */
+		if(m->super_set.count > 0) {
+			verbose(VERB_ALGO, "notify supers of failure");
+			m->s.return_msg = NULL;
+			m->s.return_rcode = LDNS_RCODE_SERVFAIL;
+			mesh_walk_supers(mesh, m);
 		}
+		mesh->stats_jostled ++;
+		if(m->s.work_zone)
+			infra_evict_inc(mesh->env->infra_cache,
+				m->s.work_zone, m->s.work_zonelen,
+				*mesh->env->now);
+		mesh_state_delete(&m->s);
+		/* restore the query - note that the qinfo ptr to
+		 * the querybuffer is then correct again. */
+		if(qbuf) sldns_buffer_copy(qbuf, mesh->qbuf_bak);
+		return 1;
 	}
 	/* no space for new item */
 	return 0;
 }
 
+/**
+ * The buffer to encode an answer to a client into.  For a pipelined TCP
+ * stream it is the spool buffer, the stream buffer can hold the next
+ * query that is being read.
+ * @param rep: the reply information of the client.
+ * @return the buffer.
+ */
+static sldns_buffer*
+mesh_reply_buffer(struct comm_reply* rep)
+{
+	if(rep->c->tcp_req_info)
+		return rep->c->tcp_req_info->spool_buffer;
+	return rep->c->buffer;
+}
+
 void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 	struct respip_client_info* cinfo, uint16_t qflags,
 	struct edns_data* edns, struct comm_reply* rep, uint16_t qid)
@@ -377,9 +639,6 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 	}
 	/* see if it already exists, if not, create one */
 	if(!s) {
-#ifdef UNBOUND_DEBUG
-		struct rbnode_type* n;
-#endif
 		s = mesh_state_create(mesh->env, qinfo, cinfo,
 			qflags&(BIT_RD|BIT_CD), 0, 0);
 		if(!s) {
@@ -387,7 +646,7 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 			if(!inplace_cb_reply_servfail_call(mesh->env, qinfo, NULL, NULL,
 				LDNS_RCODE_SERVFAIL, edns, mesh->env->scratch))
 					edns->opt_list = NULL;
-			error_encode(rep->c->buffer, LDNS_RCODE_SERVFAIL,
+			error_encode(mesh_reply_buffer(rep), LDNS_RCODE_SERVFAIL,
 				qinfo, qid, qflags, edns);
 			comm_point_send_reply(rep);
 			return;
@@ -403,20 +662,14 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 				if(!inplace_cb_reply_servfail_call(mesh->env, qinfo, NULL,
 					NULL, LDNS_RCODE_SERVFAIL, edns, mesh->env->scratch))
 						edns->opt_list = NULL;
-				error_encode(rep->c->buffer, LDNS_RCODE_SERVFAIL,
+				error_encode(mesh_reply_buffer(rep), LDNS_RCODE_SERVFAIL,
 					qinfo, qid, qflags, edns);
 				comm_point_send_reply(rep);
 				return;
 			}
 		}
 
-#ifdef UNBOUND_DEBUG
-		n =
-#else
-		(void)
-#endif
-		rbtree_insert(&mesh->all, &s->node);
-		log_assert(n != NULL);
+		mesh_all_insert(mesh, s);
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
 		added = 1;
@@ -431,7 +684,7 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 			if(!inplace_cb_reply_servfail_call(mesh->env, qinfo, &s->s,
 				NULL, LDNS_RCODE_SERVFAIL, edns, mesh->env->scratch))
 					edns->opt_list = NULL;
-			error_encode(rep->c->buffer, LDNS_RCODE_SERVFAIL,
+			error_encode(mesh_reply_buffer(rep), LDNS_RCODE_SERVFAIL,
 				qinfo, qid, qflags, edns);
 			comm_point_send_reply(rep);
 			if(added)
@@ -460,8 +713,64 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 			s->list_select = mesh_jostle_list;
 		}
 	}
-	if(added)
+	if(added) {
+		/* if another thread resolves it, wait for that and then
+		 * answer from the cache */
+		if(mesh->inflight && !unique && mesh_inflight_client_ok(cinfo)
+			&& !mesh_inflight_acquire(mesh, s)) {
+			verbose(VERB_ALGO, "mesh_new_client: wait for the "
+				"same query in another thread");
+			mesh->stats_dedup++;
+			mesh_wait_insert(mesh, s);
+			return;
+		}
 		mesh_run(mesh, s, module_event_new, NULL);
+	}
+}
+
+void
+mesh_inflight_wakeup(struct mesh_area* mesh)
+{
+	struct mesh_state* m, *nx;
+	if(!mesh->inflight)
+		return;
+	/* a release after this sends a new wakeup */
+	inflight_wakeup_done(mesh->inflight, mesh->inflight_thread);
+	/* take the list, states that still wait are put back on it */
+	m = mesh->wait_first;
+	mesh->wait_first = NULL;
+	mesh->wait_last = NULL;
+	for(; m; m = nx) {
+		nx = m->wait_next;
+		m->inflight = mesh_inflight_none;
+		if(mesh_inflight_acquire(mesh, m))
+			mesh_run_insert(mesh, m);
+		else	mesh_wait_insert(mesh, m);
+	}
+	if(mesh->run_first) {
+		m = mesh->run_first;
+		mesh_run_remove(mesh, m);
+		mesh_run(mesh, m, module_event_new, NULL);
+	}
+}
+
+void
+mesh_crypto_wakeup(struct mesh_area* mesh)
+{
+	struct crypto_job* job, *nx;
+	struct module_qstate* qstate;
+	if(!mesh->env->crypto_pool)
+		return;
+	/* states that are deleted while the list is handled clear the
+	 * qstate of their jobs */
+	job = crypto_pool_take(mesh->env->crypto_pool,
+		mesh->env->crypto_thread);
+	for(; job; job = nx) {
+		nx = job->next;
+		if((qstate = crypto_job_finish(job)) != NULL)
+			mesh_run(mesh, (struct mesh_state*)qstate->mesh_info,
+				module_event_pass, NULL);
+	}
 }
 
 int 
@@ -481,9 +790,6 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 
 	/* see if it already exists, if not, create one */
 	if(!s) {
-#ifdef UNBOUND_DEBUG
-		struct rbnode_type* n;
-#endif
 		s = mesh_state_create(mesh->env, qinfo, NULL,
 			qflags&(BIT_RD|BIT_CD), 0, 0);
 		if(!s) {
@@ -498,13 +804,7 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 				return 0;
 			}
 		}
-#ifdef UNBOUND_DEBUG
-		n =
-#else
-		(void)
-#endif
-		rbtree_insert(&mesh->all, &s->node);
-		log_assert(n != NULL);
+		mesh_all_insert(mesh, s);
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
 		added = 1;
@@ -552,9 +852,6 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 {
 	struct mesh_state* s = mesh_area_find(mesh, NULL, qinfo,
 		qflags&(BIT_RD|BIT_CD), 0, 0);
-#ifdef UNBOUND_DEBUG
-	struct rbnode_type* n;
-#endif
 	/* already exists, and for a different purpose perhaps.
 	 * if mesh_no_list, keep it that way. */
 	if(s) {
@@ -577,13 +874,7 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 		log_err("prefetch mesh_state_create: out of memory");
 		return;
 	}
-#ifdef UNBOUND_DEBUG
-	n =
-#else
-	(void)
-#endif
-	rbtree_insert(&mesh->all, &s->node);
-	log_assert(n != NULL);
+	mesh_all_insert(mesh, s);
 	/* set detached (it is now) */
 	mesh->num_detached_states++;
 	/* make it ignore the cache */
@@ -605,13 +896,7 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 	}
 
 	if(!run) {
-#ifdef UNBOUND_DEBUG
-		n =
-#else
-		(void)
-#endif
-		rbtree_insert(&mesh->run, &s->run_node);
-		log_assert(n != NULL);
+		mesh_run_insert(mesh, s);
 		return;
 	}
 
@@ -648,10 +933,6 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 		return NULL;
 	}
 	memset(mstate, 0, sizeof(*mstate));
-	mstate->node = *RBTREE_NULL;
-	mstate->run_node = *RBTREE_NULL;
-	mstate->node.key = mstate;
-	mstate->run_node.key = mstate;
 	mstate->reply_list = NULL;
 	mstate->list_select = mesh_no_list;
 	mstate->replies_sent = 0;
@@ -693,6 +974,9 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 	mstate->s.no_cache_lookup = 0;
 	mstate->s.no_cache_store = 0;
 	mstate->s.need_refetch = 0;
+	mstate->s.work_zone = NULL;
+	mstate->s.work_zonelen = 0;
+	mstate->s.work_addrlen = 0;
 
 	/* init modules */
 	for(i=0; i<env->mesh->mods.num; i++) {
@@ -787,8 +1071,12 @@ mesh_state_delete(struct module_qstate* qstate)
 	RBTREE_FOR(super, struct mesh_state_ref*, &mstate->super_set) {
 		(void)rbtree_delete(&super->s->sub_set, &ref);
 	}
-	(void)rbtree_delete(&mesh->run, mstate);
-	(void)rbtree_delete(&mesh->all, mstate);
+	mesh_run_remove(mesh, mstate);
+	mesh_all_remove(mesh, mstate);
+	if(mstate->inflight == mesh_inflight_owner)
+		inflight_release(mesh->inflight, mstate->hash, mstate);
+	else if(mstate->inflight == mesh_inflight_wait)
+		mesh_wait_remove(mesh, mstate);
 	mesh_state_cleanup(mstate);
 }
 
@@ -843,7 +1131,7 @@ void mesh_detach_subs(struct module_qstate* qstate)
 			&& ref->s->super_set.count == 0) {
 			mesh->num_detached_states++;
 			log_assert(mesh->num_detached_states + 
-				mesh->num_reply_states <= mesh->all.count);
+				mesh->num_reply_states <= mesh->all_count);
 		}
 	}
 	rbtree_init(&qstate->mesh_info->sub_set, &mesh_state_ref_compare);
@@ -862,9 +1150,6 @@ int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
 		return 0;
 	}
 	if(!*sub) {
-#ifdef UNBOUND_DEBUG
-		struct rbnode_type* n;
-#endif
 		/* create a new one */
 		*sub = mesh_state_create(qstate->env, qinfo, NULL, qflags, prime,
 			valrec);
@@ -872,23 +1157,11 @@ int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
 			log_err("mesh_attach_sub: out of memory");
 			return 0;
 		}
-#ifdef UNBOUND_DEBUG
-		n =
-#else
-		(void)
-#endif
-		rbtree_insert(&mesh->all, &(*sub)->node);
-		log_assert(n != NULL);
+		mesh_all_insert(mesh, (*sub));
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
 		/* set new query state to run */
-#ifdef UNBOUND_DEBUG
-		n =
-#else
-		(void)
-#endif
-		rbtree_insert(&mesh->run, &(*sub)->run_node);
-		log_assert(n != NULL);
+		mesh_run_insert(mesh, (*sub));
 		*newq = &(*sub)->s;
 	} else
 		*newq = NULL;
@@ -1037,6 +1310,7 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 	/* Copy the client's EDNS for later restore, to make sure the edns
 	 * compare is with the correct edns options. */
 	struct edns_data edns_bak = r->edns;
+	sldns_buffer* r_buffer = mesh_reply_buffer(&r->query_reply);
 	/* examine security status */
 	if(m->s.env->need_to_validate && (!(r->qflags&BIT_CD) ||
 		m->s.env->cfg->ignore_cd) && rep && 
@@ -1064,12 +1338,13 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 		edns_opt_list_compare(prev->edns.opt_list, r->edns.opt_list)
 		== 0) {
 		/* if the previous reply is identical to this one, fix ID */
-		if(prev->query_reply.c->buffer != r->query_reply.c->buffer)
-			sldns_buffer_copy(r->query_reply.c->buffer, 
-				prev->query_reply.c->buffer);
-		sldns_buffer_write_at(r->query_reply.c->buffer, 0, 
+		sldns_buffer* prev_buffer = mesh_reply_buffer(
+			&prev->query_reply);
+		if(prev_buffer != r_buffer)
+			sldns_buffer_copy(r_buffer, prev_buffer);
+		sldns_buffer_write_at(r_buffer, 0, 
 			&r->qid, sizeof(uint16_t));
-		sldns_buffer_write_at(r->query_reply.c->buffer, 12, 
+		sldns_buffer_write_at(r_buffer, 12, 
 			r->qname, m->s.qinfo.qname_len);
 		comm_point_send_reply(&r->query_reply);
 	} else if(rcode) {
@@ -1084,7 +1359,7 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 				&r->edns, m->s.region))
 					r->edns.opt_list = NULL;
 		}
-		error_encode(r->query_reply.c->buffer, rcode, &m->s.qinfo,
+		error_encode(r_buffer, rcode, &m->s.qinfo,
 			r->qid, r->qflags, &r->edns);
 		comm_point_send_reply(&r->query_reply);
 	} else {
@@ -1098,14 +1373,14 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 		if(!inplace_cb_reply_call(m->s.env, &m->s.qinfo, &m->s, rep,
 			LDNS_RCODE_NOERROR, &r->edns, m->s.region) ||
 			!reply_info_answer_encode(&m->s.qinfo, rep, r->qid, 
-			r->qflags, r->query_reply.c->buffer, 0, 1, 
+			r->qflags, r_buffer, 0, 1, 
 			m->s.env->scratch, udp_size, &r->edns, 
 			(int)(r->edns.bits & EDNS_DO), secure)) 
 		{
 			if(!inplace_cb_reply_servfail_call(m->s.env, &m->s.qinfo, &m->s,
 			rep, LDNS_RCODE_SERVFAIL, &r->edns, m->s.region))
 				r->edns.opt_list = NULL;
-			error_encode(r->query_reply.c->buffer, 
+			error_encode(r_buffer, 
 				LDNS_RCODE_SERVFAIL, &m->s.qinfo, r->qid, 
 				r->qflags, &r->edns);
 		}
@@ -1122,19 +1397,17 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 	timeval_add(&m->s.env->mesh->replies_sum_wait, &duration);
 	timehist_insert(m->s.env->mesh->histogram, &duration);
 	if(m->s.env->cfg->stat_extended) {
-		uint16_t rc = FLAGS_GET_RCODE(sldns_buffer_read_u16_at(r->
-			query_reply.c->buffer, 2));
+		uint16_t rc = FLAGS_GET_RCODE(sldns_buffer_read_u16_at(
+			r_buffer, 2));
 		if(secure) m->s.env->mesh->ans_secure++;
 		m->s.env->mesh->ans_rcode[ rc ] ++;
-		if(rc == 0 && LDNS_ANCOUNT(sldns_buffer_begin(r->
-			query_reply.c->buffer)) == 0)
+		if(rc == 0 && LDNS_ANCOUNT(sldns_buffer_begin(r_buffer)) == 0)
 			m->s.env->mesh->ans_nodata++;
 	}
 	/* Log reply sent */
 	if(m->s.env->cfg->log_replies) {
 		log_reply_info(0, &m->s.qinfo, &r->query_reply.addr,
-			r->query_reply.addrlen, duration, 0,
-			r->query_reply.c->buffer);
+			r->query_reply.addrlen, duration, 0, r_buffer);
 	}
 }
 
@@ -1178,7 +1451,7 @@ void mesh_walk_supers(struct mesh_area* mesh, struct mesh_state* mstate)
 	RBTREE_FOR(ref, struct mesh_state_ref*, &mstate->super_set)
 	{
 		/* make super runnable */
-		(void)rbtree_insert(&mesh->run, &ref->s->run_node);
+		mesh_run_insert(mesh, ref->s);
 		/* callback the function to inform super of result */
 		fptr_ok(fptr_whitelist_mod_inform_super(
 			mesh->mods.mod[ref->s->s.curmod]->inform_super));
@@ -1192,9 +1465,9 @@ struct mesh_state* mesh_area_find(struct mesh_area* mesh,
 	uint16_t qflags, int prime, int valrec)
 {
 	struct mesh_state key;
-	struct mesh_state* result;
+	struct mesh_state* m;
+	uint32_t h;
 
-	key.node.key = &key;
 	key.s.is_priming = prime;
 	key.s.is_valrec = valrec;
 	key.s.qinfo = *qinfo;
@@ -1204,9 +1477,13 @@ struct mesh_state* mesh_area_find(struct mesh_area* mesh,
 	 * desire aggregation).*/
 	key.unique = NULL;
 	key.s.client_info = cinfo;
-	
-	result = (struct mesh_state*)rbtree_search(&mesh->all, &key);
-	return result;
+
+	h = mesh_state_hash(qinfo, qflags, prime, valrec, NULL);
+	for(m = mesh->all_table[h&(mesh->all_size-1)]; m; m = m->hash_next) {
+		if(m->hash == h && mesh_state_compare(m, &key) == 0)
+			return m;
+	}
+	return NULL;
 }
 
 int mesh_state_add_cb(struct mesh_state* s, struct edns_data* edns,
@@ -1460,10 +1737,10 @@ void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 
 		/* run more modules */
 		ev = module_event_pass;
-		if(mesh->run.count > 0) {
-			/* pop random element off the runnable tree */
-			mstate = (struct mesh_state*)mesh->run.root->key;
-			(void)rbtree_delete(&mesh->run, mstate);
+		if(mesh->run_first) {
+			/* pop the oldest element off the run queue */
+			mstate = mesh->run_first;
+			mesh_run_remove(mesh, mstate);
 		} else mstate = NULL;
 	}
 	if(verbosity >= VERB_ALGO) {
@@ -1478,7 +1755,7 @@ mesh_log_list(struct mesh_area* mesh)
 	char buf[30];
 	struct mesh_state* m;
 	int num = 0;
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
+	for(m = mesh->all_first; m; m = m->all_next) {
 		snprintf(buf, sizeof(buf), "%d%s%s%s%s%s%s mod%d %s%s", 
 			num++, (m->s.is_priming)?"p":"",  /* prime */
 			(m->s.is_valrec)?"v":"",  /* prime */
@@ -1499,7 +1776,7 @@ mesh_stats(struct mesh_area* mesh, const char* str)
 	verbose(VERB_DETAIL, "%s %u recursion states (%u with reply, "
 		"%u detached), %u waiting replies, %u recursion replies "
 		"sent, %d replies dropped, %d states jostled out", 
-		str, (unsigned)mesh->all.count, 
+		str, (unsigned)mesh->all_count, 
 		(unsigned)mesh->num_reply_states,
 		(unsigned)mesh->num_detached_states,
 		(unsigned)mesh->num_reply_addrs,
@@ -1528,6 +1805,7 @@ mesh_stats_clear(struct mesh_area* mesh)
 	mesh->replies_sum_wait.tv_usec = 0;
 	mesh->stats_jostled = 0;
 	mesh->stats_dropped = 0;
+	mesh->stats_dedup = 0;
 	timehist_clear(mesh->histogram);
 	mesh->ans_secure = 0;
 	mesh->ans_bogus = 0;
@@ -1542,7 +1820,8 @@ mesh_get_mem(struct mesh_area* mesh)
 	size_t s = sizeof(*mesh) + sizeof(struct timehist) +
 		sizeof(struct th_buck)*mesh->histogram->num +
 		sizeof(sldns_buffer) + sldns_buffer_capacity(mesh->qbuf_bak);
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
+	s += sizeof(struct mesh_state*)*mesh->all_size;
+	for(m = mesh->all_first; m; m = m->all_next) {
 		/* all, including m itself allocated in qstate region */
 		s += regional_get_mem(m->s.region);
 	}
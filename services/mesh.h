@@ -59,6 +59,7 @@ struct query_info;
 struct reply_info;
 struct outbound_entry;
 struct timehist;
+struct inflight_table;
 struct respip_client_info;
 
 /**
@@ -74,6 +75,12 @@ struct respip_client_info;
  */
 #define MESH_MAX_SUBSUB 1024
 
+/**
+ * Number of jostle list entries, from the oldest, that the adaptive
+ * admission control scores to find the one to jostle out.
+ */
+#define MESH_JOSTLE_SCAN 16
+
 /** 
  * Mesh of query states
  */
@@ -83,10 +90,34 @@ struct mesh_area {
 	/** environment for new states */
 	struct module_env* env;
 
-	/** set of runnable queries (mesh_state.run_node) */
-	rbtree_type run;
-	/** rbtree of all current queries (mesh_state.node)*/
-	rbtree_type all;
+	/** queue of runnable queries, first to run (mesh_state.run_next).
+	 * First in, first out, so the order of work is deterministic */
+	struct mesh_state* run_first;
+	/** last entry in the run queue, the newest */
+	struct mesh_state* run_last;
+
+	/** hash table of all current queries, chained with
+	 * mesh_state.hash_next.  The size is a power of two. */
+	struct mesh_state** all_table;
+	/** number of buckets in all_table */
+	size_t all_size;
+	/** number of current queries, in the table and the all list */
+	size_t all_count;
+	/** double linked list of all current queries, in order of
+	 * creation, first is oldest (mesh_state.all_next) */
+	struct mesh_state* all_first;
+	/** last entry in the all list, the newest */
+	struct mesh_state* all_last;
+
+	/** shared table of queries in flight in the threads, or NULL */
+	struct inflight_table* inflight;
+	/** the thread number in the inflight table */
+	int inflight_thread;
+	/** double linked list of the query states that wait for another
+	 * thread to resolve the query (mesh_state.wait_next) */
+	struct mesh_state* wait_first;
+	/** last entry in the wait list */
+	struct mesh_state* wait_last;
 
 	/** count of the total number of mesh_reply entries */
 	size_t num_reply_addrs;
@@ -110,6 +141,9 @@ struct mesh_area {
 	size_t stats_jostled;
 	/** stats, cumulative number of incoming client msgs dropped */
 	size_t stats_dropped;
+	/** stats, cumulative number of query states that waited for the
+	 * same recursion in another thread, instead of their own */
+	size_t stats_dedup;
 	/** number of replies sent */
 	size_t replies_sent;
 	/** sum of waiting times for the replies */
@@ -142,6 +176,9 @@ struct mesh_area {
 	struct mesh_state* jostle_last;
 	/** timeout for jostling. if age is lower, it does not get jostled. */
 	struct timeval jostle_max;
+	/** if the jostle list is scored with the adaptive admission control,
+	 * instead of only jostling the oldest entry */
+	int jostle_adaptive;
 };
 
 /**
@@ -154,10 +191,20 @@ struct mesh_area {
  * region. All parts (rbtree nodes etc) are also allocated in the region.
  */
 struct mesh_state {
-	/** node in mesh_area all tree, key is this struct. Must be first. */
-	rbnode_type node;
-	/** node in mesh_area runnable tree, key is this struct */
-	rbnode_type run_node;
+	/** next in the mesh_area all_table bucket */
+	struct mesh_state* hash_next;
+	/** previous in the mesh_area all list */
+	struct mesh_state* all_prev;
+	/** next in the mesh_area all list */
+	struct mesh_state* all_next;
+	/** previous in the mesh_area run queue */
+	struct mesh_state* run_prev;
+	/** next in the mesh_area run queue */
+	struct mesh_state* run_next;
+	/** previous in the mesh_area wait list */
+	struct mesh_state* wait_prev;
+	/** next in the mesh_area wait list */
+	struct mesh_state* wait_next;
 	/** the query state. Note that the qinfo and query_flags 
 	 * may not change. */
 	struct module_qstate s;
@@ -183,9 +230,17 @@ struct mesh_state {
 		mesh_jostle_list } list_select;
 	/** pointer to this state for uniqueness or NULL */
 	struct mesh_state* unique;
+	/** if this state resolves the query for the inflight table, waits
+	 * for another thread in the wait list, or neither */
+	enum mesh_inflight_select { mesh_inflight_none, mesh_inflight_owner,
+		mesh_inflight_wait } inflight;
 
+	/** hash of the query, flags and uniqueness, for the all_table */
+	uint32_t hash;
 	/** true if replies have been sent out (at end for alignment) */
 	uint8_t replies_sent;
+	/** true if the state is in the run queue */
+	uint8_t run_queued;
 };
 
 /**
@@ -595,6 +650,20 @@ size_t mesh_get_mem(struct mesh_area* mesh);
 int mesh_detect_cycle(struct module_qstate* qstate, struct query_info* qinfo,
 	uint16_t flags, int prime, int valrec);
 
+/**
+ * Another thread is done with queries that states in the wait list wait
+ * for.  The states that have no other thread to wait for are run.
+ * @param mesh: the mesh area.
+ */
+void mesh_inflight_wakeup(struct mesh_area* mesh);
+
+/**
+ * The crypto pool has finished signature verification jobs for this
+ * thread.  The states whose jobs are all done are run.
+ * @param mesh: the mesh area.
+ */
+void mesh_crypto_wakeup(struct mesh_area* mesh);
+
 /** compare two mesh_states */
 int mesh_state_compare(const void* ap, const void* bp);
 
@@ -85,6 +85,9 @@ static int randomize_and_send_udp(struct pending* pend, sldns_buffer* packet,
 static void waiting_list_remove(struct outside_network* outnet,
 	struct waiting_tcp* w);
 
+/** open the ports of the udp port pool */
+static void port_pool_fill(struct outside_network* outnet);
+
 int 
 pending_cmp(const void* key1, const void* key2)
 {
@@ -127,6 +130,28 @@ serviced_cmp(const void* key1, const void* key2)
 	return sockaddr_cmp(&q1->addr, q1->addrlen, &q2->addr, q2->addrlen);
 }
 
+int
+reuse_cmp(const void* key1, const void* key2)
+{
+	struct pending_tcp* r1 = (struct pending_tcp*)key1;
+	struct pending_tcp* r2 = (struct pending_tcp*)key2;
+	if(r1->ssl_upstream != r2->ssl_upstream)
+		return (r1->ssl_upstream < r2->ssl_upstream)?-1:1;
+	return sockaddr_cmp(&r1->addr, r1->addrlen, &r2->addr, r2->addrlen);
+}
+
+int
+reuse_id_cmp(const void* key1, const void* key2)
+{
+	struct waiting_tcp* w1 = (struct waiting_tcp*)key1;
+	struct waiting_tcp* w2 = (struct waiting_tcp*)key2;
+	if(w1->id < w2->id)
+		return -1;
+	if(w1->id > w2->id)
+		return 1;
+	return 0;
+}
+
 /** delete waiting_tcp entry. Does not unlink from waiting list. 
  * @param w: to delete.
  */
@@ -139,6 +164,13 @@ waiting_tcp_delete(struct waiting_tcp* w)
 	free(w);
 }
 
+/** delete waiting_tcp in the query tree of a stream */
+static void
+waiting_tcp_node_del(rbnode_type* node, void* ATTR_UNUSED(arg))
+{
+	waiting_tcp_delete((struct waiting_tcp*)node->key);
+}
+
 /** 
  * Pick random outgoing-interface of that family, and bind it.
  * port set to 0 so OS picks a port number for us.
@@ -276,14 +308,189 @@ outnet_tcp_connect(int s, struct sockaddr_storage* addr, socklen_t addrlen)
 	return 1;
 }
 
-/** use next free buffer to service a tcp query */
+/** find an open stream to the destination that takes more queries */
+static struct pending_tcp*
+reuse_tcp_find(struct outside_network* outnet, struct sockaddr_storage* addr,
+	socklen_t addrlen, int ssl_upstream)
+{
+	struct pending_tcp key;
+	rbnode_type* n;
+	memcpy(&key.addr, addr, addrlen);
+	key.addrlen = addrlen;
+	key.ssl_upstream = ssl_upstream;
+	n = rbtree_search(&outnet->tcp_reuse, &key);
+	if(!n)
+		return NULL;
+	return (struct pending_tcp*)n->key;
+}
+
+/** remove the stream from the tcp_reuse tree, it takes no new queries */
+static void
+reuse_tree_remove(struct outside_network* outnet, struct pending_tcp* pend)
+{
+	if(!pend->in_reuse_tree)
+		return;
+	(void)rbtree_delete(&outnet->tcp_reuse, pend);
+	pend->in_reuse_tree = 0;
+}
+
+/** remove the stream from the idle list and stop its idle timer */
+static void
+reuse_idle_remove(struct outside_network* outnet, struct pending_tcp* pend)
+{
+	if(!pend->is_idle)
+		return;
+	if(pend->idle_prev)
+		pend->idle_prev->idle_next = pend->idle_next;
+	else	outnet->tcp_reuse_first = pend->idle_next;
+	if(pend->idle_next)
+		pend->idle_next->idle_prev = pend->idle_prev;
+	else	outnet->tcp_reuse_last = pend->idle_prev;
+	pend->idle_prev = NULL;
+	pend->idle_next = NULL;
+	pend->is_idle = 0;
+	comm_timer_disable(pend->idle_timer);
+}
+
+/** put the stream at the front of the idle list and start its timer */
+static void
+reuse_idle_insert(struct outside_network* outnet, struct pending_tcp* pend)
+{
+	struct timeval tv;
+	log_assert(!pend->is_idle);
+	pend->idle_prev = NULL;
+	pend->idle_next = outnet->tcp_reuse_first;
+	if(outnet->tcp_reuse_first)
+		outnet->tcp_reuse_first->idle_prev = pend;
+	else	outnet->tcp_reuse_last = pend;
+	outnet->tcp_reuse_first = pend;
+	pend->is_idle = 1;
+#ifndef S_SPLINT_S
+	tv.tv_sec = outnet->tcp_reuse_timeout/1000;
+	tv.tv_usec = (outnet->tcp_reuse_timeout%1000)*1000;
+#endif
+	comm_timer_set(pend->idle_timer, &tv);
+}
+
+/** remove the query from its stream, the stream itself is left as is */
+static void
+reuse_tcp_remove_query(struct pending_tcp* pend, struct waiting_tcp* w)
+{
+	(void)rbtree_delete(&pend->query_tree, w);
+	if(w->write_wait_queued) {
+		struct waiting_tcp* p = pend->write_first, *prev = NULL;
+		while(p) {
+			if(p == w) {
+				if(prev)
+					prev->next_waiting = w->next_waiting;
+				else	pend->write_first = w->next_waiting;
+				if(pend->write_last == w)
+					pend->write_last = prev;
+				break;
+			}
+			prev = p;
+			p = p->next_waiting;
+		}
+		w->write_wait_queued = 0;
+	}
+	w->next_waiting = NULL;
+	w->stream = NULL;
+}
+
+/** add the query to the stream, it is put on the write list */
+static void
+reuse_tcp_add_query(struct outside_network* outnet, struct pending_tcp* pend,
+	struct waiting_tcp* w)
+{
+	/* the ID must be unique among the queries on the stream */
+	while(rbtree_search(&pend->query_tree, w)) {
+		w->id = ((unsigned)ub_random(outnet->rnd)>>8) & 0xffff;
+		LDNS_ID_SET(w->pkt, w->id);
+	}
+	w->id_node.key = w;
+	(void)rbtree_insert(&pend->query_tree, &w->id_node);
+	w->stream = pend;
+	w->next_waiting = NULL;
+	w->write_wait_queued = 1;
+	if(pend->write_last)
+		pend->write_last->next_waiting = w;
+	else	pend->write_first = w;
+	pend->write_last = w;
+	pend->num_queries++;
+	if(pend->num_queries > 1)
+		pend->reused = 1;
+	if(pend->num_queries >= outnet->max_reuse_tcp_queries)
+		reuse_tree_remove(outnet, pend);
+	reuse_idle_remove(outnet, pend);
+	outnet->num_tcp_outgoing++;
+}
+
+/** put the next query of the write list in the buffer of the comm point,
+ * the caller starts listening for write */
+static void
+reuse_tcp_load_write(struct pending_tcp* pend)
+{
+	struct waiting_tcp* w = pend->write_first;
+	log_assert(w);
+	pend->write_first = w->next_waiting;
+	if(pend->write_last == w)
+		pend->write_last = NULL;
+	w->next_waiting = NULL;
+	w->write_wait_queued = 0;
+	sldns_buffer_clear(pend->c->buffer);
+	sldns_buffer_write(pend->c->buffer, w->pkt, w->pkt_len);
+	sldns_buffer_flip(pend->c->buffer);
+	pend->c->tcp_is_reading = 0;
+	pend->c->tcp_byte_count = 0;
+}
+
+/** if the stream is waiting for the start of a reply, write the next
+ * query. Otherwise that is done when the current read or write is done. */
+static void
+reuse_tcp_write_next(struct pending_tcp* pend)
+{
+	struct comm_point* c = pend->c;
+	if(!pend->write_first || c->fd == -1 || !c->tcp_is_reading ||
+		c->tcp_byte_count != 0 ||
+		c->ssl_shake_state != comm_ssl_shake_none)
+		return;
+	reuse_tcp_load_write(pend);
+	comm_point_stop_listening(c);
+	comm_point_start_listening(c, -1, 0);
+}
+
+/** close the stream and put it on the free list. The queries must have
+ * been taken off the stream. */
+static void
+reuse_tcp_close(struct outside_network* outnet, struct pending_tcp* pend)
+{
+	log_assert(pend->query_tree.count == 0 && !pend->write_first);
+	reuse_tree_remove(outnet, pend);
+	reuse_idle_remove(outnet, pend);
+	if(pend->c->ssl) {
+#ifdef HAVE_SSL
+		SSL_shutdown(pend->c->ssl);
+		SSL_free(pend->c->ssl);
+		pend->c->ssl = NULL;
+#endif
+	}
+	comm_point_close(pend->c);
+	pend->gen++;
+	pend->num_queries = 0;
+	pend->reused = 0;
+	pend->next_free = outnet->tcp_free;
+	outnet->tcp_free = pend;
+}
+
+/** use next free buffer to open a stream for a tcp query */
 static int
-outnet_tcp_take_into_use(struct waiting_tcp* w, uint8_t* pkt, size_t pkt_len)
+outnet_tcp_take_into_use(struct waiting_tcp* w)
 {
-	struct pending_tcp* pend = w->outnet->tcp_free;
+	struct outside_network* outnet = w->outnet;
+	struct pending_tcp* pend = outnet->tcp_free;
 	int s;
 	log_assert(pend);
-	log_assert(pkt);
+	log_assert(w->pkt);
 	log_assert(w->addrlen > 0);
 	/* open socket */
 	s = outnet_get_tcp_fd(&w->addr, w->addrlen, w->outnet->tcp_mss);
@@ -363,37 +570,70 @@ outnet_tcp_take_into_use(struct waiting_tcp* w, uint8_t* pkt, size_t pkt_len)
 		comm_point_tcp_win_bio_cb(pend->c, pend->c->ssl);
 #endif
 		pend->c->ssl_shake_state = comm_ssl_shake_write;
+		outnet->num_tls_handshake++;
 	}
-	w->pkt = NULL;
-	w->next_waiting = (void*)pend;
-	pend->id = LDNS_ID_WIRE(pkt);
-	w->outnet->num_tcp_outgoing++;
-	w->outnet->tcp_free = pend->next_free;
+	outnet->num_tcp_open++;
+	outnet->tcp_free = pend->next_free;
 	pend->next_free = NULL;
-	pend->query = w;
+	memcpy(&pend->addr, &w->addr, w->addrlen);
+	pend->addrlen = w->addrlen;
+	pend->ssl_upstream = w->ssl_upstream;
+	pend->reuse_node.key = pend;
+	pend->in_reuse_tree = (rbtree_insert(&outnet->tcp_reuse,
+		&pend->reuse_node) != NULL);
 	pend->c->repinfo.addrlen = w->addrlen;
 	memcpy(&pend->c->repinfo.addr, &w->addr, w->addrlen);
-	sldns_buffer_clear(pend->c->buffer);
-	sldns_buffer_write(pend->c->buffer, pkt, pkt_len);
-	sldns_buffer_flip(pend->c->buffer);
-	pend->c->tcp_is_reading = 0;
-	pend->c->tcp_byte_count = 0;
+	reuse_tcp_add_query(outnet, pend, w);
+	reuse_tcp_load_write(pend);
 	comm_point_start_listening(pend->c, s, -1);
 	return 1;
 }
 
+/** send the tcp query on an open stream to the destination, or open a new
+ * stream for it, or put it on the waiting list.
+ * @return 0 if a new stream could not be opened. */
+static int
+outnet_tcp_send(struct waiting_tcp* w)
+{
+	struct outside_network* outnet = w->outnet;
+	struct pending_tcp* pend = reuse_tcp_find(outnet, &w->addr,
+		w->addrlen, w->ssl_upstream);
+	if(pend) {
+		verbose(VERB_ALGO, "outnettcp: reuse stream");
+		outnet->num_tcp_reuse++;
+		reuse_tcp_add_query(outnet, pend, w);
+		reuse_tcp_write_next(pend);
+		return 1;
+	}
+	if(!outnet->tcp_free && outnet->tcp_reuse_last) {
+		/* close the least recently used idle stream */
+		reuse_tcp_close(outnet, outnet->tcp_reuse_last);
+	}
+	if(!outnet->tcp_free) {
+		/* queue up */
+		w->next_waiting = NULL;
+		if(outnet->tcp_wait_last)
+			outnet->tcp_wait_last->next_waiting = w;
+		else	outnet->tcp_wait_first = w;
+		outnet->tcp_wait_last = w;
+		return 1;
+	}
+	return outnet_tcp_take_into_use(w);
+}
+
 /** see if buffers can be used to service TCP queries */
 static void
 use_free_buffer(struct outside_network* outnet)
 {
 	struct waiting_tcp* w;
-	while(outnet->tcp_free && outnet->tcp_wait_first 
-		&& !outnet->want_to_quit) {
+	while((outnet->tcp_free || outnet->tcp_reuse_last)
+		&& outnet->tcp_wait_first && !outnet->want_to_quit) {
 		w = outnet->tcp_wait_first;
 		outnet->tcp_wait_first = w->next_waiting;
 		if(outnet->tcp_wait_last == w)
 			outnet->tcp_wait_last = NULL;
-		if(!outnet_tcp_take_into_use(w, w->pkt, w->pkt_len)) {
+		w->next_waiting = NULL;
+		if(!outnet_tcp_send(w)) {
 			comm_point_callback_type* cb = w->cb;
 			void* cb_arg = w->cb_arg;
 			waiting_tcp_delete(w);
@@ -403,23 +643,71 @@ use_free_buffer(struct outside_network* outnet)
 	}
 }
 
-/** decommission a tcp buffer, closes commpoint and frees waiting_tcp entry */
+/** the stream may have no more queries; keep it open on the idle list,
+ * or close it if it cannot be reused (or keep is false). */
 static void
-decommission_pending_tcp(struct outside_network* outnet, 
-	struct pending_tcp* pend)
+reuse_tcp_stream_done(struct outside_network* outnet,
+	struct pending_tcp* pend, int keep)
 {
-	if(pend->c->ssl) {
-#ifdef HAVE_SSL
-		SSL_shutdown(pend->c->ssl);
-		SSL_free(pend->c->ssl);
-		pend->c->ssl = NULL;
-#endif
+	if(pend->query_tree.count != 0 || pend->is_idle)
+		return;
+	if(keep && pend->in_reuse_tree && outnet->tcp_reuse_timeout > 0 &&
+		!outnet->want_to_quit) {
+		reuse_idle_insert(outnet, pend);
+		return;
 	}
-	comm_point_close(pend->c);
-	pend->next_free = outnet->tcp_free;
-	outnet->tcp_free = pend;
-	waiting_tcp_delete(pend->query);
-	pend->query = NULL;
+	reuse_tcp_close(outnet, pend);
+	use_free_buffer(outnet);
+}
+
+/** the stream failed, close it. Queries on a reused stream are sent again
+ * on a new stream, because the server may have closed the idle stream
+ * when we wrote to it; the other queries get the error. */
+static void
+reuse_tcp_fail(struct outside_network* outnet, struct pending_tcp* pend,
+	int error)
+{
+	struct waiting_tcp* list = NULL, *last = NULL, *w;
+	int reused = pend->reused;
+	while(pend->query_tree.count != 0) {
+		w = (struct waiting_tcp*)rbtree_first(&pend->query_tree)->key;
+		reuse_tcp_remove_query(pend, w);
+		if(last)
+			last->next_waiting = w;
+		else	list = w;
+		last = w;
+	}
+	reuse_tcp_close(outnet, pend);
+	while(list) {
+		comm_point_callback_type* cb;
+		void* cb_arg;
+		w = list;
+		list = w->next_waiting;
+		w->next_waiting = NULL;
+		if(reused && !w->retried && error == NETEVENT_CLOSED &&
+			!outnet->want_to_quit) {
+			w->retried = 1;
+			verbose(VERB_ALGO, "outnettcp: resend query on new "
+				"stream");
+			if(outnet_tcp_send(w))
+				continue;
+		}
+		cb = w->cb;
+		cb_arg = w->cb_arg;
+		waiting_tcp_delete(w);
+		fptr_ok(fptr_whitelist_pending_tcp(cb));
+		(void)(*cb)(NULL, cb_arg, error, NULL);
+	}
+	use_free_buffer(outnet);
+}
+
+void
+reuse_tcp_idle_timeout(void* arg)
+{
+	struct pending_tcp* pend = (struct pending_tcp*)arg;
+	struct outside_network* outnet = pend->outnet;
+	verbose(VERB_ALGO, "outnettcp: close idle stream");
+	reuse_tcp_close(outnet, pend);
 	use_free_buffer(outnet);
 }
 
@@ -428,24 +716,58 @@ outnet_tcp_cb(struct comm_point* c, void* arg, int error,
 	struct comm_reply *reply_info)
 {
 	struct pending_tcp* pend = (struct pending_tcp*)arg;
-	struct outside_network* outnet = pend->query->outnet;
+	struct outside_network* outnet = pend->outnet;
+	unsigned int gen = pend->gen;
+	struct waiting_tcp key, *w = NULL;
+	rbnode_type* n;
 	verbose(VERB_ALGO, "outnettcp cb");
+	if(error == NETEVENT_PKT_WRITTEN) {
+		/* write the queued queries before the replies are read */
+		reuse_tcp_write_next(pend);
+		return 0;
+	}
 	if(error != NETEVENT_NOERROR) {
 		verbose(VERB_QUERY, "outnettcp got tcp error %d", error);
-		/* pass error below and exit */
+		reuse_tcp_fail(outnet, pend, error);
+		return 0;
+	}
+	/* check ID */
+	if(sldns_buffer_limit(c->buffer) < sizeof(uint16_t)) {
+		reuse_tcp_fail(outnet, pend, NETEVENT_CLOSED);
+		return 0;
+	}
+	key.id = LDNS_ID_WIRE(sldns_buffer_begin(c->buffer));
+	if((n = rbtree_search(&pend->query_tree, &key)) != NULL)
+		w = (struct waiting_tcp*)n->key;
+	if(!w || w->write_wait_queued) {
+		/* a reply for a query that timed out or was deleted */
+		log_addr(VERB_QUERY, "outnettcp: bad ID in reply, from:",
+			&pend->addr, pend->addrlen);
 	} else {
-		/* check ID */
-		if(sldns_buffer_limit(c->buffer) < sizeof(uint16_t) ||
-			LDNS_ID_WIRE(sldns_buffer_begin(c->buffer))!=pend->id) {
-			log_addr(VERB_QUERY, 
-				"outnettcp: bad ID in reply, from:",
-				&pend->query->addr, pend->query->addrlen);
-			error = NETEVENT_CLOSED;
-		}
+		comm_point_callback_type* cb = w->cb;
+		void* cb_arg = w->cb_arg;
+		reuse_tcp_remove_query(pend, w);
+		waiting_tcp_delete(w);
+		fptr_ok(fptr_whitelist_pending_tcp(cb));
+		(void)(*cb)(c, cb_arg, NETEVENT_NOERROR, reply_info);
+		if(gen != pend->gen)
+			return 0; /* the callback closed the stream */
+	}
+	if(pend->write_first) {
+		reuse_tcp_load_write(pend);
+		comm_point_start_listening(c, -1, 0);
+		return 0;
+	}
+	if(pend->query_tree.count == 0) {
+		reuse_tcp_stream_done(outnet, pend, 1);
+		if(gen != pend->gen)
+			return 0;
 	}
-	fptr_ok(fptr_whitelist_pending_tcp(pend->query->cb));
-	(void)(*pend->query->cb)(c, pend->query->cb_arg, error, reply_info);
-	decommission_pending_tcp(outnet, pend);
+	/* read the next reply, or on an idle stream notice a close */
+	sldns_buffer_clear(c->buffer);
+	c->tcp_is_reading = 1;
+	c->tcp_byte_count = 0;
+	comm_point_start_listening(c, -1, 0);
 	return 0;
 }
 
@@ -458,6 +780,10 @@ portcomm_loweruse(struct outside_network* outnet, struct port_comm* pc)
 	if(pc->num_outstanding > 0) {
 		return;
 	}
+	if(pc->pool_index != -1) {
+		/* it stays open in the pool */
+		return;
+	}
 	/* close it and replace in unused list */
 	verbose(VERB_ALGO, "close of port %d", pc->number);
 	comm_point_close(pc->cp);
@@ -469,6 +795,12 @@ portcomm_loweruse(struct outside_network* outnet, struct port_comm* pc)
 	pif->out[pc->index]->index = pc->index;
 	pc->next = outnet->unused_fds;
 	outnet->unused_fds = pc;
+	outnet->num_udp_open--;
+	if(pc->is_pool)
+		outnet->num_pool_open--;
+	/* a retired pool port is replaced by a new random port */
+	if(outnet->num_pool_open < outnet->port_pool && !outnet->want_to_quit)
+		port_pool_fill(outnet);
 }
 
 /** try to send waiting UDP queries */
@@ -501,6 +833,48 @@ outnet_send_wait_udp(struct outside_network* outnet)
 	}
 }
 
+/** add pending udp query to the batch list, and start the batch timer */
+static void
+batch_list_add(struct outside_network* outnet, struct pending* pend)
+{
+	pend->next_batch = NULL;
+	pend->in_batch = 1;
+	if(outnet->batch_last)
+		outnet->batch_last->next_batch = pend;
+	else {
+		struct timeval tv;
+		/* a new batch, send it when the current events are done */
+		tv.tv_sec = 0;
+		tv.tv_usec = 0;
+		outnet->batch_first = pend;
+		comm_timer_set(outnet->batch_timer, &tv);
+	}
+	outnet->batch_last = pend;
+}
+
+/** remove pending udp query from the batch list or failed list */
+static void
+batch_list_remove(struct outside_network* outnet, struct pending* p)
+{
+	struct pending* prev = NULL, *x;
+	x = (p->in_batch == 1)?outnet->batch_first:outnet->batch_fail;
+	while(x && x != p) {
+		prev = x;
+		x = x->next_batch;
+	}
+	if(x) {
+		if(prev)
+			prev->next_batch = p->next_batch;
+		else if(p->in_batch == 1)
+			outnet->batch_first = p->next_batch;
+		else	outnet->batch_fail = p->next_batch;
+		if(p->in_batch == 1 && outnet->batch_last == p)
+			outnet->batch_last = prev;
+	}
+	p->next_batch = NULL;
+	p->in_batch = 0;
+}
+
 int 
 outnet_udp_cb(struct comm_point* c, void* arg, int error,
 	struct comm_reply *reply_info)
@@ -663,11 +1037,19 @@ create_pending_tcp(struct outside_network* outnet, size_t bufsize)
 			return 0;
 		outnet->tcp_conns[i]->next_free = outnet->tcp_free;
 		outnet->tcp_free = outnet->tcp_conns[i];
+		outnet->tcp_conns[i]->outnet = outnet;
+		rbtree_init(&outnet->tcp_conns[i]->query_tree, reuse_id_cmp);
 		outnet->tcp_conns[i]->c = comm_point_create_tcp_out(
 			outnet->base, bufsize, outnet_tcp_cb, 
 			outnet->tcp_conns[i]);
 		if(!outnet->tcp_conns[i]->c)
 			return 0;
+		outnet->tcp_conns[i]->c->tcp_notify_written = 1;
+		outnet->tcp_conns[i]->idle_timer = comm_timer_create(
+			outnet->base, reuse_tcp_idle_timeout,
+			outnet->tcp_conns[i]);
+		if(!outnet->tcp_conns[i]->idle_timer)
+			return 0;
 	}
 	return 1;
 }
@@ -690,6 +1072,11 @@ static int setup_if(struct port_if* pif, const char* addrstr,
 		sizeof(struct port_comm*));
 	if(!pif->out)
 		return 0;
+	pif->pool_num = 0;
+	pif->pool = (struct port_comm**)calloc(numfd,
+		sizeof(struct port_comm*));
+	if(!pif->pool)
+		return 0;
 	return 1;
 }
 
@@ -700,7 +1087,9 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	struct ub_randstate* rnd, int use_caps_for_id, int* availports, 
 	int numavailports, size_t unwanted_threshold, int tcp_mss,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
-	void* sslctx, int delayclose, struct dt_env* dtenv)
+	void* sslctx, int delayclose, struct dt_env* dtenv,
+	int tcp_reuse_timeout, size_t max_reuse_tcp_queries, int udp_batch,
+	int port_pool, int port_pool_uses)
 {
 	struct outside_network* outnet = (struct outside_network*)
 		calloc(1, sizeof(struct outside_network));
@@ -729,6 +1118,14 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	outnet->use_caps_for_id = use_caps_for_id;
 	outnet->do_udp = do_udp;
 	outnet->tcp_mss = tcp_mss;
+	rbtree_init(&outnet->tcp_reuse, reuse_cmp);
+	outnet->tcp_reuse_timeout = tcp_reuse_timeout;
+	/* the IDs of the queries on a stream must be unique */
+	if(max_reuse_tcp_queries < 1)
+		max_reuse_tcp_queries = 1;
+	if(max_reuse_tcp_queries > 0xffff)
+		max_reuse_tcp_queries = 0xffff;
+	outnet->max_reuse_tcp_queries = max_reuse_tcp_queries;
 #ifndef S_SPLINT_S
 	if(delayclose) {
 		outnet->delayclose = 1;
@@ -770,6 +1167,13 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 		outside_network_delete(outnet);
 		return NULL;
 	}
+	outnet->udp_batch = udp_batch;
+	if(udp_batch && !(outnet->batch_timer = comm_timer_create(base,
+		outnet_udp_batch_cb, outnet))) {
+		log_err("malloc failed");
+		outside_network_delete(outnet);
+		return NULL;
+	}
 
 	/* allocate commpoints */
 	for(k=0; k<num_ports; k++) {
@@ -830,6 +1234,15 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 			}
 		}
 	}
+	/* open the pool ports, leave fds for other interfaces unused, so
+	 * that the queries never wait for an fd */
+	if(port_pool > (int)num_ports - outnet->num_ip4 - outnet->num_ip6)
+		port_pool = (int)num_ports - outnet->num_ip4 - outnet->num_ip6;
+	if(do_udp && port_pool > 0) {
+		outnet->port_pool = port_pool;
+		outnet->port_pool_uses = (port_pool_uses>0?port_pool_uses:1);
+		port_pool_fill(outnet);
+	}
 	return outnet;
 }
 
@@ -907,6 +1320,7 @@ outside_network_delete(struct outside_network* outnet)
 			}
 			free(outnet->ip4_ifs[i].avail_ports);
 			free(outnet->ip4_ifs[i].out);
+			free(outnet->ip4_ifs[i].pool);
 		}
 		free(outnet->ip4_ifs);
 	}
@@ -921,6 +1335,7 @@ outside_network_delete(struct outside_network* outnet)
 			}
 			free(outnet->ip6_ifs[i].avail_ports);
 			free(outnet->ip6_ifs[i].out);
+			free(outnet->ip6_ifs[i].pool);
 		}
 		free(outnet->ip6_ifs);
 	}
@@ -928,9 +1343,14 @@ outside_network_delete(struct outside_network* outnet)
 		size_t i;
 		for(i=0; i<outnet->num_tcp; i++)
 			if(outnet->tcp_conns[i]) {
-				comm_point_delete(outnet->tcp_conns[i]->c);
-				waiting_tcp_delete(outnet->tcp_conns[i]->query);
-				free(outnet->tcp_conns[i]);
+				struct pending_tcp* pend = outnet->tcp_conns[i];
+				/* free queries, but do not unlink from tree */
+				if(pend->query_tree.root)
+					traverse_postorder(&pend->query_tree,
+						waiting_tcp_node_del, NULL);
+				comm_point_delete(pend->c);
+				comm_timer_delete(pend->idle_timer);
+				free(pend);
 			}
 		free(outnet->tcp_conns);
 	}
@@ -950,6 +1370,15 @@ outside_network_delete(struct outside_network* outnet)
 			p = np;
 		}
 	}
+	if(outnet->batch_first) {
+		struct pending* p = outnet->batch_first, *np;
+		while(p) {
+			np = p->next_batch;
+			pending_delete(NULL, p);
+			p = np;
+		}
+	}
+	comm_timer_delete(outnet->batch_timer);
 	free(outnet);
 }
 
@@ -975,6 +1404,8 @@ pending_delete(struct outside_network* outnet, struct pending* p)
 				outnet->udp_wait_last = prev;
 		}
 	}
+	if(outnet && p->in_batch)
+		batch_list_remove(outnet, p);
 	if(outnet) {
 		(void)rbtree_delete(outnet->pending, p->node.key);
 	}
@@ -1063,12 +1494,112 @@ select_id(struct outside_network* outnet, struct pending* pend,
 	return 1;
 }
 
+/**
+ * Open a new port on the interface and grab an unused port_comm for it.
+ * @param outnet: outside network, with an unused fd.
+ * @param pif: interface.
+ * @param my_port: index of the port, at or above pif->inuse.
+ * @param inuse: set to true if the port was in use by another process.
+ * @return the port_comm or NULL if the socket could not be made.
+ */
+static struct port_comm*
+udp_port_open(struct outside_network* outnet, struct port_if* pif,
+	int my_port, int* inuse)
+{
+	struct port_comm* pc;
+	int fd, portno;
+	log_assert(outnet->unused_fds);
+	log_assert(pif->inuse < pif->maxout);
+	portno = pif->avail_ports[my_port - pif->inuse];
+	fd = udp_sockport(&pif->addr, pif->addrlen, pif->pfxlen,
+		portno, inuse, outnet->rnd);
+	if(fd == -1)
+		return NULL;
+	/* grab fd */
+	pc = outnet->unused_fds;
+	outnet->unused_fds = pc->next;
+
+	/* setup portcomm */
+	pc->next = NULL;
+	pc->number = portno;
+	pc->pif = pif;
+	pc->index = pif->inuse;
+	pc->num_outstanding = 0;
+	pc->num_uses = 0;
+	pc->pool_index = -1;
+	pc->is_pool = 0;
+	comm_point_start_listening(pc->cp, fd, -1);
+
+	/* grab port in interface */
+	pif->out[pif->inuse] = pc;
+	pif->avail_ports[my_port - pif->inuse] =
+		pif->avail_ports[pif->avail_total-pif->inuse-1];
+	pif->inuse++;
+	outnet->num_udp_open++;
+	return pc;
+}
+
+/** open the ports of the pool, random interface and random port */
+static void
+port_pool_fill(struct outside_network* outnet)
+{
+	int my_if, my_port, inuse, tries = 0;
+	int num_if = outnet->num_ip4 + outnet->num_ip6;
+	struct port_if* pif;
+	struct port_comm* pc;
+	if(num_if == 0)
+		return;
+	while(outnet->num_pool_open < outnet->port_pool &&
+		outnet->unused_fds) {
+		my_if = ub_random_max(outnet->rnd, num_if);
+		pif = (my_if < outnet->num_ip4)?&outnet->ip4_ifs[my_if]:
+			&outnet->ip6_ifs[my_if - outnet->num_ip4];
+		if(pif->avail_total - pif->inuse <= 0 ||
+			pif->inuse >= pif->maxout) {
+			if(++tries == MAX_PORT_RETRY)
+				break;
+			continue;
+		}
+		my_port = pif->inuse + ub_random_max(outnet->rnd,
+			pif->avail_total - pif->inuse);
+		if(!(pc = udp_port_open(outnet, pif, my_port, &inuse))) {
+			if(!inuse || ++tries == MAX_PORT_RETRY) {
+				/* the pool is filled when a port closes */
+				verbose(VERB_ALGO, "could not fill the udp "
+					"port pool, %d ports in the pool",
+					outnet->num_pool_open);
+				break;
+			}
+			continue;
+		}
+		pc->pool_index = pif->pool_num;
+		pc->is_pool = 1;
+		pif->pool[pif->pool_num++] = pc;
+		outnet->num_pool_open++;
+		verbose(VERB_ALGO, "opened UDP pool port=%d", pc->number);
+	}
+}
+
+/** take a port out of the pool, it is closed when its queries are done */
+static void
+port_pool_retire(struct outside_network* outnet, struct port_comm* pc)
+{
+	struct port_if* pif = pc->pif;
+	log_assert(pc->pool_index != -1 && pif->pool_num > 0);
+	verbose(VERB_ALGO, "retire UDP pool port=%d after %d queries",
+		pc->number, pc->num_uses);
+	pif->pool_num--;
+	pif->pool[pc->pool_index] = pif->pool[pif->pool_num];
+	pif->pool[pc->pool_index]->pool_index = pc->pool_index;
+	pc->pool_index = -1;
+}
+
 /** Select random interface and port */
 static int
 select_ifport(struct outside_network* outnet, struct pending* pend,
 	int num_if, struct port_if* ifs)
 {
-	int my_if, my_port, fd, portno, inuse, tries=0;
+	int my_if, my_port, inuse, tries=0;
 	struct port_if* pif;
 	/* randomly select interface and port */
 	if(num_if == 0) {
@@ -1081,6 +1612,16 @@ select_ifport(struct outside_network* outnet, struct pending* pend,
 	while(1) {
 		my_if = ub_random_max(outnet->rnd, num_if);
 		pif = &ifs[my_if];
+		if(pif->pool_num > 0) {
+			/* a random port of the pool, the pool ports are
+			 * random ports, that are replaced by new random
+			 * ports when they are retired */
+			pend->pc = pif->pool[ub_random_max(outnet->rnd,
+				pif->pool_num)];
+			verbose(VERB_ALGO, "using UDP if=%d pool port=%d",
+				my_if, pend->pc->number);
+			break;
+		}
 		my_port = ub_random_max(outnet->rnd, pif->avail_total);
 		if(my_port < pif->inuse) {
 			/* port already open */
@@ -1090,38 +1631,19 @@ select_ifport(struct outside_network* outnet, struct pending* pend,
 			break;
 		}
 		/* try to open new port, if fails, loop to try again */
-		log_assert(pif->inuse < pif->maxout);
-		portno = pif->avail_ports[my_port - pif->inuse];
-		fd = udp_sockport(&pif->addr, pif->addrlen, pif->pfxlen,
-			portno, &inuse, outnet->rnd);
-		if(fd == -1 && !inuse) {
+		pend->pc = udp_port_open(outnet, pif, my_port, &inuse);
+		if(!pend->pc && !inuse) {
 			/* nonrecoverable error making socket */
 			return 0;
 		}
-		if(fd != -1) {
+		if(pend->pc) {
 			verbose(VERB_ALGO, "opened UDP if=%d port=%d", 
-				my_if, portno);
-			/* grab fd */
-			pend->pc = outnet->unused_fds;
-			outnet->unused_fds = pend->pc->next;
-
-			/* setup portcomm */
-			pend->pc->next = NULL;
-			pend->pc->number = portno;
-			pend->pc->pif = pif;
-			pend->pc->index = pif->inuse;
-			pend->pc->num_outstanding = 0;
-			comm_point_start_listening(pend->pc->cp, fd, -1);
-
-			/* grab port in interface */
-			pif->out[pif->inuse] = pend->pc;
-			pif->avail_ports[my_port - pif->inuse] =
-				pif->avail_ports[pif->avail_total-pif->inuse-1];
-			pif->inuse++;
+				my_if, pend->pc->number);
 			break;
 		}
 		/* failed, already in use */
-		verbose(VERB_QUERY, "port %d in use, trying another", portno);
+		verbose(VERB_QUERY, "port %d in use, trying another",
+			pif->avail_ports[my_port - pif->inuse]);
 		tries++;
 		if(tries == MAX_PORT_RETRY) {
 			log_err("failed to find an open port, drop msg");
@@ -1130,6 +1652,10 @@ select_ifport(struct outside_network* outnet, struct pending* pend,
 	}
 	log_assert(pend->pc);
 	pend->pc->num_outstanding++;
+	pend->pc->num_uses++;
+	if(pend->pc->pool_index != -1 &&
+		pend->pc->num_uses >= outnet->port_pool_uses)
+		port_pool_retire(outnet, pend->pc);
 
 	return 1;
 }
@@ -1182,6 +1708,163 @@ randomize_and_send_udp(struct pending* pend, sldns_buffer* packet, int timeout)
 	return 1;
 }
 
+/** put a query of the batch on the failed list, for its callback */
+static void
+batch_fail_add(struct outside_network* outnet, struct pending* pend)
+{
+	pend->next_batch = outnet->batch_fail;
+	pend->in_batch = 2;
+	outnet->batch_fail = pend;
+}
+
+/**
+ * Send batched queries to the same server, from one port, with one send
+ * call.  The queries that fail are put on the failed list.
+ * @param outnet: outside network.
+ * @param group: the queries, they are not in a list.
+ * @param num: number of queries, at most UDP_SEND_MAX.
+ */
+static void
+batch_send_group(struct outside_network* outnet, struct pending** group,
+	int num)
+{
+	sldns_buffer pkt[UDP_SEND_MAX];
+	sldns_buffer* send[UDP_SEND_MAX];
+	struct pending* sendp[UDP_SEND_MAX], *failp[UDP_SEND_MAX];
+	struct pending* first = group[0];
+	struct port_comm* pc;
+	struct timeval tv;
+	int i, n = 0, nf = 0, sent = 0;
+
+	if(!outnet->unused_fds) {
+		/* no port can be opened, the queries wait for an fd */
+		verbose(VERB_ALGO, "no fds available, udp query waiting");
+		for(i=0; i<num; i++) {
+			group[i]->next_waiting = NULL;
+			if(outnet->udp_wait_last)
+				outnet->udp_wait_last->next_waiting = group[i];
+			else	outnet->udp_wait_first = group[i];
+			outnet->udp_wait_last = group[i];
+		}
+		return;
+	}
+	/* select src_if, port, the other queries use the same port */
+	if(!(addr_is_ip6(&first->addr, first->addrlen)?
+		select_ifport(outnet, first, outnet->num_ip6, outnet->ip6_ifs):
+		select_ifport(outnet, first, outnet->num_ip4, outnet->ip4_ifs))) {
+		for(i=0; i<num; i++)
+			batch_fail_add(outnet, group[i]);
+		return;
+	}
+	pc = first->pc;
+	log_assert(pc && pc->cp);
+	/* count all the queries on the port, so that it is not closed
+	 * while the queries of the group are set up and sent */
+	for(i=1; i<num; i++) {
+		group[i]->pc = pc;
+		pc->num_outstanding++;
+	}
+	for(i=0; i<num; i++) {
+		struct pending* p = group[i];
+		sldns_buffer_init_frm_data(&pkt[n], p->pkt, p->pkt_len);
+		if(!select_id(outnet, p, &pkt[n])) {
+			failp[nf++] = p;
+			continue;
+		}
+		send[n] = &pkt[n];
+		sendp[n] = p;
+		n++;
+	}
+	if(n != 0) {
+		sent = comm_point_send_udp_msgs(pc->cp, send, n,
+			(struct sockaddr*)&first->addr, first->addrlen);
+		outnet->num_udp_batch_sends++;
+		outnet->num_udp_batched += (size_t)sent;
+	}
+	for(i=0; i<n; i++) {
+		struct pending* p = sendp[i];
+		if(i >= sent) {
+			failp[nf++] = p;
+			continue;
+		}
+#ifndef S_SPLINT_S
+		tv.tv_sec = p->timeout/1000;
+		tv.tv_usec = (p->timeout%1000)*1000;
+#endif
+		comm_timer_set(p->timer, &tv);
+#ifdef USE_DNSTAP
+		if(outnet->dtenv &&
+		   (outnet->dtenv->log_resolver_query_messages ||
+		    outnet->dtenv->log_forwarder_query_messages))
+			dt_msg_send_outside_query(outnet->dtenv, &p->addr,
+				comm_udp, p->sq->zone, p->sq->zonelen,
+				send[i]);
+#endif
+		free(p->pkt); /* freeing now makes get_mem correct */
+		p->pkt = NULL;
+		p->pkt_len = 0;
+	}
+	/* after the send, the failed queries release the port */
+	for(i=0; i<nf; i++) {
+		portcomm_loweruse(outnet, pc);
+		failp[i]->pc = NULL;
+		batch_fail_add(outnet, failp[i]);
+	}
+}
+
+void
+outnet_udp_batch_cb(void* arg)
+{
+	struct outside_network* outnet = (struct outside_network*)arg;
+	struct pending* list = outnet->batch_first, *p, **prevp;
+	struct pending* group[UDP_SEND_MAX];
+	int num;
+	outnet->batch_first = NULL;
+	outnet->batch_last = NULL;
+	if(outnet->want_to_quit) {
+		/* the queries are deleted with the outside network */
+		outnet->batch_first = list;
+		return;
+	}
+	/* no callbacks are made while the batch is sent, so the list can
+	 * be taken apart */
+	while(list) {
+		/* the first query and more queries to the same server */
+		num = 0;
+		group[num++] = list;
+		list->in_batch = 0;
+		list = list->next_batch;
+		prevp = &list;
+		while(*prevp && num < UDP_SEND_MAX) {
+			p = *prevp;
+			if(sockaddr_cmp(&p->addr, p->addrlen, &group[0]->addr,
+				group[0]->addrlen) == 0) {
+				*prevp = p->next_batch;
+				p->in_batch = 0;
+				group[num++] = p;
+			} else	prevp = &p->next_batch;
+		}
+		if(num > 1)
+			verbose(VERB_ALGO, "udp batch of %d queries to the "
+				"same server", num);
+		batch_send_group(outnet, group, num);
+	}
+	/* callback error on the queries that could not be sent */
+	while(outnet->batch_fail) {
+		p = outnet->batch_fail;
+		outnet->batch_fail = p->next_batch;
+		p->next_batch = NULL;
+		p->in_batch = 0;
+		if(p->cb) {
+			fptr_ok(fptr_whitelist_pending_udp(p->cb));
+			(void)(*p->cb)(outnet->unused_fds?
+				outnet->unused_fds->cp:NULL, p->cb_arg,
+				NETEVENT_CLOSED, NULL);
+		}
+		pending_delete(outnet, p);
+	}
+}
+
 struct pending* 
 pending_udp_query(struct serviced_query* sq, struct sldns_buffer* packet,
 	int timeout, comm_point_callback_type* cb, void* cb_arg)
@@ -1202,9 +1885,7 @@ pending_udp_query(struct serviced_query* sq, struct sldns_buffer* packet,
 		return NULL;
 	}
 
-	if(sq->outnet->unused_fds == NULL) {
-		/* no unused fd, cannot create a new port (randomly) */
-		verbose(VERB_ALGO, "no fds available, udp query waiting");
+	if(sq->outnet->unused_fds == NULL || sq->outnet->udp_batch) {
 		pend->timeout = timeout;
 		pend->pkt_len = sldns_buffer_limit(packet);
 		pend->pkt = (uint8_t*)memdup(sldns_buffer_begin(packet),
@@ -1214,6 +1895,13 @@ pending_udp_query(struct serviced_query* sq, struct sldns_buffer* packet,
 			free(pend);
 			return NULL;
 		}
+		if(sq->outnet->udp_batch) {
+			/* sent with the batch, at the next event loop pass */
+			batch_list_add(sq->outnet, pend);
+			return pend;
+		}
+		/* no unused fd, cannot create a new port (randomly) */
+		verbose(VERB_ALGO, "no fds available, udp query waiting");
 		/* put at end of waiting list */
 		if(sq->outnet->udp_wait_last)
 			sq->outnet->udp_wait_last->next_waiting = pend;
@@ -1236,16 +1924,16 @@ outnet_tcptimer(void* arg)
 	struct outside_network* outnet = w->outnet;
 	comm_point_callback_type* cb;
 	void* cb_arg;
-	if(w->pkt) {
+	if(!w->stream) {
 		/* it is on the waiting list */
 		waiting_list_remove(outnet, w);
 	} else {
-		/* it was in use */
-		struct pending_tcp* pend=(struct pending_tcp*)w->next_waiting;
-		comm_point_close(pend->c);
-		pend->query = NULL;
-		pend->next_free = outnet->tcp_free;
-		outnet->tcp_free = pend;
+		/* it was in use; the server did not answer, so the stream
+		 * takes no new queries and is closed when it has no more */
+		struct pending_tcp* pend = w->stream;
+		reuse_tcp_remove_query(pend, w);
+		reuse_tree_remove(outnet, pend);
+		reuse_tcp_stream_done(outnet, pend, 0);
 	}
 	cb = w->cb;
 	cb_arg = w->cb_arg;
@@ -1259,13 +1947,13 @@ struct waiting_tcp*
 pending_tcp_query(struct serviced_query* sq, sldns_buffer* packet,
 	int timeout, comm_point_callback_type* callback, void* callback_arg)
 {
-	struct pending_tcp* pend = sq->outnet->tcp_free;
 	struct waiting_tcp* w;
 	struct timeval tv;
 	uint16_t id;
-	/* if no buffer is free allocate space to store query */
+	/* allocate space to store the query, it is kept until the reply
+	 * so that it can be sent again if a reused stream fails */
 	w = (struct waiting_tcp*)malloc(sizeof(struct waiting_tcp) 
-		+ (pend?0:sldns_buffer_limit(packet)));
+		+ sldns_buffer_limit(packet));
 	if(!w) {
 		return NULL;
 	}
@@ -1273,10 +1961,17 @@ pending_tcp_query(struct serviced_query* sq, sldns_buffer* packet,
 		free(w);
 		return NULL;
 	}
-	w->pkt = NULL;
-	w->pkt_len = 0;
 	id = ((unsigned)ub_random(sq->outnet->rnd)>>8) & 0xffff;
 	LDNS_ID_SET(sldns_buffer_begin(packet), id);
+	w->pkt = (uint8_t*)w + sizeof(struct waiting_tcp);
+	w->pkt_len = sldns_buffer_limit(packet);
+	memmove(w->pkt, sldns_buffer_begin(packet), w->pkt_len);
+	w->id = id;
+	w->id_node.key = w;
+	w->next_waiting = NULL;
+	w->stream = NULL;
+	w->write_wait_queued = 0;
+	w->retried = 0;
 	memcpy(&w->addr, &sq->addr, sq->addrlen);
 	w->addrlen = sq->addrlen;
 	w->outnet = sq->outnet;
@@ -1288,31 +1983,21 @@ pending_tcp_query(struct serviced_query* sq, sldns_buffer* packet,
 	tv.tv_usec = 0;
 #endif
 	comm_timer_set(w->timer, &tv);
-	if(pend) {
-		/* we have a buffer available right now */
-		if(!outnet_tcp_take_into_use(w, sldns_buffer_begin(packet),
-			sldns_buffer_limit(packet))) {
-			waiting_tcp_delete(w);
-			return NULL;
-		}
+	/* send on an open stream, a new stream, or queue up */
+	if(!outnet_tcp_send(w)) {
+		waiting_tcp_delete(w);
+		return NULL;
+	}
 #ifdef USE_DNSTAP
-		if(sq->outnet->dtenv &&
-		   (sq->outnet->dtenv->log_resolver_query_messages ||
-		    sq->outnet->dtenv->log_forwarder_query_messages))
+	if(w->stream && sq->outnet->dtenv &&
+	   (sq->outnet->dtenv->log_resolver_query_messages ||
+	    sq->outnet->dtenv->log_forwarder_query_messages)) {
+		/* the ID can have been changed for the reused stream */
+		LDNS_ID_SET(sldns_buffer_begin(packet), w->id);
 		dt_msg_send_outside_query(sq->outnet->dtenv, &sq->addr,
 		comm_tcp, sq->zone, sq->zonelen, packet);
-#endif
-	} else {
-		/* queue up */
-		w->pkt = (uint8_t*)w + sizeof(struct waiting_tcp);
-		w->pkt_len = sldns_buffer_limit(packet);
-		memmove(w->pkt, sldns_buffer_begin(packet), w->pkt_len);
-		w->next_waiting = NULL;
-		if(sq->outnet->tcp_wait_last)
-			sq->outnet->tcp_wait_last->next_waiting = w;
-		else	sq->outnet->tcp_wait_first = w;
-		sq->outnet->tcp_wait_last = w;
 	}
+#endif
 	return w;
 }
 
@@ -1454,9 +2139,13 @@ serviced_delete(struct serviced_query* sq)
 		} else {
 			struct waiting_tcp* p = (struct waiting_tcp*)
 				sq->pending;
-			if(p->pkt == NULL) {
-				decommission_pending_tcp(sq->outnet, 
-					(struct pending_tcp*)p->next_waiting);
+			if(p->stream) {
+				/* the stream stays open for other queries,
+				 * a reply for this one is ignored */
+				struct pending_tcp* pend = p->stream;
+				reuse_tcp_remove_query(pend, p);
+				waiting_tcp_delete(p);
+				reuse_tcp_stream_done(sq->outnet, pend, 1);
 			} else {
 				waiting_list_remove(sq->outnet, p);
 				waiting_tcp_delete(p);
@@ -2200,10 +2889,13 @@ size_t outnet_get_mem(struct outside_network* outnet)
 	
 	s += sizeof(struct pending_tcp*)*outnet->num_tcp;
 	for(i=0; i<outnet->num_tcp; i++) {
+		rbnode_type* n;
 		s += sizeof(struct pending_tcp);
 		s += comm_point_get_mem(outnet->tcp_conns[i]->c);
-		if(outnet->tcp_conns[i]->query)
-			s += waiting_tcp_get_mem(outnet->tcp_conns[i]->query);
+		s += comm_timer_get_mem(outnet->tcp_conns[i]->idle_timer);
+		for(n = rbtree_first(&outnet->tcp_conns[i]->query_tree);
+			n != RBTREE_NULL; n = rbtree_next(n))
+			s += waiting_tcp_get_mem((struct waiting_tcp*)n->key);
 	}
 	for(w=outnet->tcp_wait_first; w; w = w->next_waiting)
 		s += waiting_tcp_get_mem(w);
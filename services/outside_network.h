@@ -156,6 +156,54 @@ struct outside_network {
 	struct waiting_tcp* tcp_wait_first;
 	/** last of waiting query list */
 	struct waiting_tcp* tcp_wait_last;
+
+	/** tree of open tcp streams that can take more queries, sorted by
+	 * destination address and ssl. Elements are struct pending_tcp. */
+	rbtree_type tcp_reuse;
+	/** list of idle streams, most recently used first. These have
+	 * no queries outstanding and are closed first when a new
+	 * stream is needed and there are no free comm points. */
+	struct pending_tcp* tcp_reuse_first;
+	/** last (least recently used) element of idle stream list */
+	struct pending_tcp* tcp_reuse_last;
+	/** msec an idle stream is kept open for reuse, 0 closes it at once */
+	int tcp_reuse_timeout;
+	/** max number of queries sent on one stream before it is retired */
+	size_t max_reuse_tcp_queries;
+	/** number of queries sent on an already open stream (statistics) */
+	size_t num_tcp_reuse;
+	/** number of new tcp streams opened (statistics) */
+	size_t num_tcp_open;
+	/** number of ssl handshakes started for new streams (statistics) */
+	size_t num_tls_handshake;
+
+	/** if udp queries are collected and sent in batches, per server */
+	int udp_batch;
+	/** pending udp queries that wait to be sent with the next batch */
+	struct pending* batch_first;
+	/** last pending udp query in the batch list */
+	struct pending* batch_last;
+	/** pending udp queries of the batch that failed to be sent, and
+	 * wait for their callback */
+	struct pending* batch_fail;
+	/** timer that sends the batch, at the next pass of the event loop */
+	struct comm_timer* batch_timer;
+	/** number of udp queries sent in batches (statistics) */
+	size_t num_udp_batched;
+	/** number of send calls, one per server per batch (statistics) */
+	size_t num_udp_batch_sends;
+
+	/** number of udp ports that are kept open in the pool, 0 is off */
+	int port_pool;
+	/** number of queries on a pool port before it is retired, it is
+	 * closed when its queries are done, and replaced by a new random
+	 * port */
+	int port_pool_uses;
+	/** number of open ports of the pool, on all interfaces, with the
+	 * retired ports that are not closed yet */
+	int num_pool_open;
+	/** number of udp ports that are open, on all interfaces */
+	int num_udp_open;
 };
 
 /**
@@ -185,6 +233,12 @@ struct port_if {
 	int maxout;
 	/** number of commpoints (and thus also ports) in use */
 	int inuse;
+
+	/** array of the open ports of the port pool, first part in use,
+	 * allocated for max number of fds */
+	struct port_comm** pool;
+	/** number of ports in the pool array */
+	int pool_num;
 };
 
 /**
@@ -201,6 +255,14 @@ struct port_comm {
 	int index;
 	/** number of outstanding queries on this port */
 	int num_outstanding;
+	/** number of queries sent on this port since it was opened */
+	int num_uses;
+	/** index in the pool array of the interface, or -1 if the port is
+	 * not in the pool array */
+	int pool_index;
+	/** if the port was opened for the pool, it counts in the pool
+	 * until it is closed, also after it is retired */
+	int is_pool;
 	/** UDP commpoint, fd=-1 if not in use */
 	struct comm_point* cp;
 };
@@ -241,31 +303,78 @@ struct pending {
 	uint8_t* pkt;
 	/** length of query packet. */
 	size_t pkt_len;
+
+	/*---- filled if udp pending is in the batch -----*/
+	/** next in the batch list, or the failed list of the batch */
+	struct pending* next_batch;
+	/** if it is in the batch list (1) or failed list (2), or not (0) */
+	int in_batch;
 };
 
 /**
- * Pending TCP query to server.
+ * Pending TCP stream to server. The stream carries one or more queries,
+ * the replies are matched to the queries by ID. Queries are written one
+ * after the other, replies are read in between.
  */
 struct pending_tcp {
 	/** next in list of free tcp comm points, or NULL. */
 	struct pending_tcp* next_free;
-	/** the ID for the query; checked in reply */
-	uint16_t id;
+	/** the outside network it is part of */
+	struct outside_network* outnet;
 	/** tcp comm point it was sent on (and reply must come back on). */
 	struct comm_point* c;
-	/** the query being serviced, NULL if the pending_tcp is unused. */
-	struct waiting_tcp* query;
+	/** node in outnet tcp_reuse tree, key is this structure. */
+	rbnode_type reuse_node;
+	/** if the stream is in the tcp_reuse tree and takes more queries */
+	int in_reuse_tree;
+	/** destination address of the stream */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** if the stream uses ssl */
+	int ssl_upstream;
+	/** queries on the stream, sorted by ID. Elements are
+	 * struct waiting_tcp. Empty if the pending_tcp is unused or idle. */
+	rbtree_type query_tree;
+	/** queries on the stream waiting to be written, in order */
+	struct waiting_tcp* write_first;
+	/** last query waiting to be written */
+	struct waiting_tcp* write_last;
+	/** number of queries sent on this stream since it was opened */
+	size_t num_queries;
+	/** if the stream has been used for more than one query */
+	int reused;
+	/** incremented when the stream is closed, to detect a close (and
+	 * reopen) of the comm point from inside a callback. */
+	unsigned int gen;
+	/** if on the idle list */
+	int is_idle;
+	/** prev and next on the outnet idle stream list */
+	struct pending_tcp* idle_prev, *idle_next;
+	/** timer that closes the stream when it has been idle too long */
+	struct comm_timer* idle_timer;
 };
 
 /**
- * Query waiting for TCP buffer.
+ * Query waiting for TCP buffer, or sent on a TCP stream.
  */
 struct waiting_tcp {
 	/** 
-	 * next in waiting list.
-	 * if pkt==0, this points to the pending_tcp structure.
+	 * next in waiting list, or next in the write list of the stream.
 	 */
 	struct waiting_tcp* next_waiting;
+	/** node in the query_tree of the stream, key is this structure */
+	rbnode_type id_node;
+	/** the ID for the query; checked in reply */
+	uint16_t id;
+	/** the stream the query is on, or NULL if it is on the waiting
+	 * list of the outside network */
+	struct pending_tcp* stream;
+	/** if the query is on the write list of the stream */
+	int write_wait_queued;
+	/** if the query has been resent on a new stream after its reused
+	 * stream was closed */
+	int retried;
 	/** timeout event; timer keeps running whether the query is
 	 * waiting for a buffer or the tcp reply is pending */
 	struct comm_timer* timer;
@@ -278,8 +387,8 @@ struct waiting_tcp {
 	/** 
 	 * The query itself, the query packet to send.
 	 * allocated after the waiting_tcp structure.
-	 * set to NULL when the query is serviced and it part of pending_tcp.
-	 * if this is NULL, the next_waiting points to the pending_tcp.
+	 * kept until the query is done, so it can be resent if the stream
+	 * fails.
 	 */
 	uint8_t* pkt;
 	/** length of query packet. */
@@ -410,6 +519,14 @@ struct serviced_query {
  * @param delayclose: if not 0, udp sockets are delayed before timeout closure.
  * 	msec to wait on timeouted udp sockets.
  * @param dtenv: environment to send dnstap events with (if enabled).
+ * @param tcp_reuse_timeout: msec an idle tcp stream is kept open for reuse.
+ * @param max_reuse_tcp_queries: max queries sent on one tcp stream.
+ * @param udp_batch: if udp queries are sent in batches, at the next pass
+ *	of the event loop, with one port and send call per server.
+ * @param port_pool: number of random udp ports that are kept open, the
+ *	queries use a random port of this pool, 0 is off.
+ * @param port_pool_uses: number of queries on a pool port, after that it
+ *	is replaced by a new random port.
  * @return: the new structure (with no pending answers) or NULL on error.
  */
 struct outside_network* outside_network_create(struct comm_base* base,
@@ -418,7 +535,9 @@ struct outside_network* outside_network_create(struct comm_base* base,
 	struct ub_randstate* rnd, int use_caps_for_id, int* availports, 
 	int numavailports, size_t unwanted_threshold, int tcp_mss,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
-	void* sslctx, int delayclose, struct dt_env *dtenv);
+	void* sslctx, int delayclose, struct dt_env *dtenv,
+	int tcp_reuse_timeout, size_t max_reuse_tcp_queries, int udp_batch,
+	int port_pool, int port_pool_uses);
 
 /**
  * Delete outside_network structure.
@@ -554,9 +673,15 @@ void pending_udp_timer_cb(void *arg);
 /** callback for udp delay for timeout */
 void pending_udp_timer_delay_cb(void *arg);
 
+/** callback for the udp batch timer, sends the batch */
+void outnet_udp_batch_cb(void* arg);
+
 /** callback for outgoing TCP timer event */
 void outnet_tcptimer(void* arg);
 
+/** callback for idle TCP stream timer event */
+void reuse_tcp_idle_timeout(void* arg);
+
 /** callback for serviced query UDP answers */
 int serviced_udp_callback(struct comm_point* c, void* arg, int error,
         struct comm_reply* rep);
@@ -571,4 +696,10 @@ int pending_cmp(const void* key1, const void* key2);
 /** compare function of serviced query rbtree */
 int serviced_cmp(const void* key1, const void* key2);
 
+/** compare function of tcp stream reuse rbtree, by ssl and address */
+int reuse_cmp(const void* key1, const void* key2);
+
+/** compare function of the queries on a tcp stream, by ID */
+int reuse_id_cmp(const void* key1, const void* key2);
+
 #endif /* OUTSIDE_NETWORK_H */
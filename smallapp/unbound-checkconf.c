@@ -376,6 +376,13 @@ morechecks(struct config_file* cfg, const char* fname)
 		fatal_exit("verbosity value < 0");
 	if(cfg->num_threads <= 0 || cfg->num_threads > 10000)
 		fatal_exit("num_threads value weird");
+	if(cfg->cpu_affinity_list[0]) {
+		int* cpus = NULL;
+		if(cfg_parse_cpu_list(cfg->cpu_affinity_list, &cpus) < 0)
+			fatal_exit("cannot parse cpu-affinity-list: %s",
+				cfg->cpu_affinity_list);
+		free(cpus);
+	}
 	if(!cfg->do_ip4 && !cfg->do_ip6)
 		fatal_exit("ip4 and ip6 are both disabled, pointless");
 	if(!cfg->do_ip6 && cfg->prefer_ip6)
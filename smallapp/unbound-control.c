@@ -107,6 +107,7 @@ usage(void)
 	printf("  				(one entry per line).\n");
 	printf("  dump_cache			print cache to stdout\n");
 	printf("  load_cache			load cache from stdin\n");
+	printf("  cache_snapshot [file]		save cache to binary snapshot file\n");
 	printf("  lookup <name>			print nameservers for name\n");
 	printf("  flush <name>			flushes common types for name from cache\n");
 	printf("  				types:  A, AAAA, MX, PTR, NS,\n");
@@ -121,6 +122,7 @@ usage(void)
 	printf("  dump_requestlist		show what is worked on by first thread\n");
 	printf("  flush_infra [all | ip] 	remove ping, edns for one IP or all\n");
 	printf("  dump_infra			show ping and edns entries\n");
+	printf("  dump_latency			show latency percentiles of servers\n");
 	printf("  set_option opt: val		set option to value, no reload\n");
 	printf("  get_option opt		get option value\n");
 	printf("  list_stubs			list stub-zones and root hints in use\n");
@@ -142,6 +144,7 @@ usage(void)
 	printf("  ratelimit_list [+a]		list ratelimited domains\n");
 	printf("  ip_ratelimit_list [+a]	list ratelimited ip addresses\n");
 	printf("		+a		list all, also not ratelimited\n");
+	printf("  jostle_list			list queries jostled out per zone\n");
 	printf("  view_list_local_zones	view	list local-zones in view\n");
 	printf("  view_list_local_data	view	list local-data RRs in view\n");
 	printf("  view_local_zone view name type  	add local-zone in view\n");
@@ -200,6 +203,8 @@ static void pr_stats(const char* nm, struct ub_stats_info* s)
 	PR_UL_NM("num.cachemiss", s->svr.num_queries_missed_cache);
 	PR_UL_NM("num.prefetch", s->svr.num_queries_prefetch);
 	PR_UL_NM("num.zero_ttl", s->svr.zero_ttl_responses);
+	PR_UL_NM("num.wirecache", s->svr.num_wirecache_hits);
+	PR_UL_NM("num.dedup", s->svr.num_queries_dedup);
 	PR_UL_NM("num.recursivereplies", s->mesh_replies_sent);
 #ifdef USE_DNSCRYPT
     PR_UL_NM("num.dnscrypt.crypted", s->svr.num_query_dnscrypt_crypted);
@@ -227,6 +232,9 @@ static void pr_stats(const char* nm, struct ub_stats_info* s)
 	PR_TIMEVAL("recursion.time.avg", avg);
 	printf("%s.recursion.time.median"SQ"%g\n", nm, s->mesh_time_median);
 	PR_UL_NM("tcpusage", s->svr.tcp_accept_usage);
+	PR_UL_NM("udp.batch.num", s->svr.udp_batches);
+	printf("%s.udp.batch.avg"SQ"%g\n", nm, s->svr.udp_batches?
+		(double)s->svr.udp_batch_pkts/(double)s->svr.udp_batches:0.0);
 }
 
 /** print uptime */
@@ -318,6 +326,11 @@ static void print_extended(struct ub_stats_info* s)
 	/* transport */
 	PR_UL("num.query.tcp", s->svr.qtcp);
 	PR_UL("num.query.tcpout", s->svr.qtcp_outgoing);
+	PR_UL("num.query.tcpout.reuse", s->svr.qtcp_outgoing_reuse);
+	PR_UL("num.tcpout.open", s->svr.tcp_outgoing_open);
+	PR_UL("num.tcpout.tlshandshake", s->svr.tls_outgoing_handshake);
+	PR_UL("num.query.udpout.batched", s->svr.qudp_outgoing_batched);
+	PR_UL("num.udpout.batch.sends", s->svr.udp_outgoing_batch_sends);
 	PR_UL("num.query.ipv6", s->svr.qipv6);
 
 	/* flags */
@@ -345,10 +358,32 @@ static void print_extended(struct ub_stats_info* s)
 	}
 	/* iteration */
 	PR_UL("num.query.ratelimited", s->svr.queries_ratelimited);
+	PR_UL("num.query.fanout", s->svr.target_fanout);
+	PR_UL("num.query.fanout.fetch", s->svr.target_fanout_fetch);
+	PR_UL("num.query.fanout.cancel", s->svr.target_fanout_cancel);
+	PR_UL("num.query.aggressive.NXDOMAIN", s->svr.neg_synth_nxdomain);
+	PR_UL("num.query.aggressive.NOERROR", s->svr.neg_synth_nodata);
 	/* validation */
 	PR_UL("num.answer.secure", s->svr.ans_secure);
 	PR_UL("num.answer.bogus", s->svr.ans_bogus);
 	PR_UL("num.rrset.bogus", s->svr.rrset_bogus);
+	PR_UL("num.sigcache.hit", s->svr.sig_cache_hit);
+	PR_UL("num.sigcache.miss", s->svr.sig_cache_miss);
+	PR_UL("num.nsec3cache.hit", s->svr.nsec3_cache_hit);
+	PR_UL("num.nsec3cache.miss", s->svr.nsec3_cache_miss);
+	PR_UL("num.crypto.jobs", s->svr.crypto_jobs);
+	for(i=0; i<UB_STATS_CRYPTO_HIST_NUM; i++) {
+		if(inhibit_zero && s->svr.crypto_queue_hist[i] == 0)
+			continue;
+		snprintf(nm, sizeof(nm), "%d.to.%d", (i?(1<<i):0), (1<<(i+1)));
+		PR_UL_SUB("histogram.crypto.queue", nm, s->svr.crypto_queue_hist[i]);
+	}
+	for(i=0; i<UB_STATS_CRYPTO_HIST_NUM; i++) {
+		if(inhibit_zero && s->svr.crypto_verify_hist[i] == 0)
+			continue;
+		snprintf(nm, sizeof(nm), "%d.to.%d", (i?(1<<i):0), (1<<(i+1)));
+		PR_UL_SUB("histogram.crypto.verify", nm, s->svr.crypto_verify_hist[i]);
+	}
 	/* threat detection */
 	PR_UL("unwanted.queries", s->svr.unwanted_queries);
 	PR_UL("unwanted.replies", s->svr.unwanted_replies);
@@ -357,6 +392,8 @@ static void print_extended(struct ub_stats_info* s)
 	PR_UL("rrset.cache.count", s->svr.rrset_cache_count);
 	PR_UL("infra.cache.count", s->svr.infra_cache_count);
 	PR_UL("key.cache.count", s->svr.key_cache_count);
+	PR_UL("sig.cache.count", s->svr.sig_cache_count);
+	PR_UL("nsec3.cache.count", s->svr.nsec3_cache_count);
 #ifdef USE_DNSCRYPT
 	PR_UL("dnscrypt_shared_secret.cache.count",
 			 s->svr.shared_secret_cache_count);
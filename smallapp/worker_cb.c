@@ -54,6 +54,20 @@ void worker_handle_control_cmd(struct tube* ATTR_UNUSED(tube),
 	log_assert(0);
 }
 
+void worker_handle_inflight_wakeup(struct tube* ATTR_UNUSED(tube),
+	uint8_t* ATTR_UNUSED(msg), size_t ATTR_UNUSED(len),
+	int ATTR_UNUSED(error), void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
+void worker_handle_crypto_wakeup(struct tube* ATTR_UNUSED(tube),
+	uint8_t* ATTR_UNUSED(msg), size_t ATTR_UNUSED(len),
+	int ATTR_UNUSED(error), void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 int worker_handle_request(struct comm_point* ATTR_UNUSED(c), 
 	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
         struct comm_reply* ATTR_UNUSED(repinfo))
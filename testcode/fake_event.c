@@ -734,7 +734,8 @@ run_scenario(struct replay_runtime* runtime)
 struct listen_dnsport* 
 listen_create(struct comm_base* base, struct listen_port* ATTR_UNUSED(ports),
 	size_t bufsize, int ATTR_UNUSED(tcp_accept_count),
-	void* ATTR_UNUSED(sslctx), struct dt_env* ATTR_UNUSED(dtenv),
+	int ATTR_UNUSED(tcp_pipeline), int ATTR_UNUSED(tcp_pipeline_total),
+	int ATTR_UNUSED(udp_batch_size), void* ATTR_UNUSED(sslctx), struct dt_env* ATTR_UNUSED(dtenv),
 	comm_point_callback_type* cb, void* cb_arg)
 {
 	struct replay_runtime* runtime = (struct replay_runtime*)base;
@@ -903,7 +904,10 @@ outside_network_create(struct comm_base* base, size_t bufsize,
 	int ATTR_UNUSED(outgoing_tcp_mss),
 	void (*unwanted_action)(void*), void* ATTR_UNUSED(unwanted_param),
 	int ATTR_UNUSED(do_udp), void* ATTR_UNUSED(sslctx),
-	int ATTR_UNUSED(delayclose), struct dt_env* ATTR_UNUSED(dtenv))
+	int ATTR_UNUSED(delayclose), struct dt_env* ATTR_UNUSED(dtenv),
+	int ATTR_UNUSED(tcp_reuse_timeout),
+	size_t ATTR_UNUSED(max_reuse_tcp_queries), int ATTR_UNUSED(udp_batch),
+	int ATTR_UNUSED(port_pool), int ATTR_UNUSED(port_pool_uses))
 {
 	struct replay_runtime* runtime = (struct replay_runtime*)base;
 	struct outside_network* outnet =  calloc(1, 
@@ -1163,6 +1167,12 @@ void listening_ports_free(struct listen_port* list)
 	free(list);
 }
 
+int listening_ports_steer_cpu(struct listen_port* ATTR_UNUSED(list),
+	int* ATTR_UNUSED(cpus), int ATTR_UNUSED(num))
+{
+	return 0;
+}
+
 struct comm_point* comm_point_create_local(struct comm_base* ATTR_UNUSED(base),
         int ATTR_UNUSED(fd), size_t ATTR_UNUSED(bufsize),
         comm_point_callback_type* ATTR_UNUSED(callback), 
@@ -1244,11 +1254,21 @@ void pending_udp_timer_delay_cb(void *ATTR_UNUSED(arg))
 	log_assert(0);
 }
 
+void outnet_udp_batch_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void outnet_tcptimer(void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
 }
 
+void reuse_tcp_idle_timeout(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void comm_point_udp_callback(int ATTR_UNUSED(fd), short ATTR_UNUSED(event), 
 	void* ATTR_UNUSED(arg))
 {
@@ -1331,6 +1351,18 @@ int serviced_cmp(const void* ATTR_UNUSED(a), const void* ATTR_UNUSED(b))
 	return 0;
 }
 
+int reuse_cmp(const void* ATTR_UNUSED(a), const void* ATTR_UNUSED(b))
+{
+	log_assert(0);
+	return 0;
+}
+
+int reuse_id_cmp(const void* ATTR_UNUSED(a), const void* ATTR_UNUSED(b))
+{
+	log_assert(0);
+	return 0;
+}
+
 /* timers in testbound for autotrust. statistics tested in tdir. */
 struct comm_timer* comm_timer_create(struct comm_base* base, 
 	void (*cb)(void*), void* cb_arg)
@@ -1470,4 +1502,17 @@ int outnet_tcp_connect(int ATTR_UNUSED(s), struct sockaddr_storage* ATTR_UNUSED(
 	return 0;
 }
 
+int test_comm_point_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* repinfo)
+{
+	struct comm_point_testcb* t = (struct comm_point_testcb*)arg;
+	return (*t->point_cb)(c, t->arg, error, repinfo);
+}
+
+void test_comm_timer_cb(void* arg)
+{
+	struct comm_point_testcb* t = (struct comm_point_testcb*)arg;
+	(*t->timer_cb)(t->arg);
+}
+
 /*********** End of Dummy routines ***********/
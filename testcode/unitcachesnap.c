@@ -0,0 +1,437 @@
+/*
+ * testcode/unitcachesnap.c - unit test for the cache snapshot file.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+/**
+/**
+ * \file
+ * Unit test for the cache snapshot, that saves the message and rrset
+ * caches to a file and loads them from it again.
+ */
+#include "config.h"
+#include "testcode/unitmain.h"
+#include "daemon/cachesnap.h"
+#include "services/cache/dns.h"
+#include "services/cache/rrset.h"
+#include "util/module.h"
+#include "util/alloc.h"
+#include "util/regional.h"
+#include "util/net_help.h"
+#include "util/config_file.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/data/packed_rrset.h"
+#include "util/data/dname.h"
+#include "util/storage/slabhash.h"
+#include "sldns/sbuffer.h"
+#include "sldns/str2wire.h"
+#include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
+
+/** verbosity for this test */
+static int vbmp = 0;
+
+/** size of the snapshot file header */
+#define CS_HEADER_SIZE 16
+
+/** caches and environment for the test */
+struct cs_env {
+	/** module env with the caches */
+	struct module_env env;
+	/** config for the cache sizes */
+	struct config_file* cfg;
+	/** alloc cache */
+	struct alloc_cache alloc;
+	/** scratch region */
+	struct regional* region;
+	/** the current time */
+	time_t now;
+};
+
+/** create empty caches at the time now */
+static void
+cs_env_init(struct cs_env* e, time_t now)
+{
+	memset(e, 0, sizeof(*e));
+	e->cfg = config_create();
+	unit_assert(e->cfg);
+	alloc_init(&e->alloc, NULL, 0);
+	e->region = regional_create();
+	unit_assert(e->region);
+	e->now = now;
+	e->env.cfg = e->cfg;
+	e->env.alloc = &e->alloc;
+	e->env.now = &e->now;
+	e->env.rrset_cache = rrset_cache_create(e->cfg, &e->alloc);
+	unit_assert(e->env.rrset_cache);
+	e->env.msg_cache = slabhash_create(e->cfg->msg_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, e->cfg->msg_cache_size,
+		msgreply_sizefunc, query_info_compare, query_entry_delete,
+		reply_info_delete, NULL);
+	unit_assert(e->env.msg_cache);
+}
+
+/** delete the caches */
+static void
+cs_env_delete(struct cs_env* e)
+{
+	slabhash_delete(e->env.msg_cache);
+	rrset_cache_delete(e->env.rrset_cache);
+	regional_destroy(e->region);
+	alloc_clear(&e->alloc);
+	config_delete(e->cfg);
+}
+
+/** append an RR in text format to the packet */
+static void
+add_rr(sldns_buffer* pkt, const char* str)
+{
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	size_t len = sizeof(rr), dname_len = 0;
+	unit_assert(sldns_str2wire_rr_buf(str, rr, &len, &dname_len, 3600,
+		NULL, 0, NULL, 0) == 0);
+	sldns_buffer_write(pkt, rr, len);
+}
+
+/** store the reply for www.example.com. A, with an A and NS rrset */
+static void
+store_reply(struct cs_env* e)
+{
+	sldns_buffer* pkt = sldns_buffer_new(65535);
+	uint8_t qname[LDNS_MAX_DOMAINLEN+1];
+	size_t qname_len = sizeof(qname);
+	struct query_info qinfo;
+	struct reply_info* rep;
+	struct edns_data edns;
+	unit_assert(pkt);
+	unit_assert(sldns_str2wire_dname_buf("www.example.com.", qname,
+		&qname_len) == 0);
+	sldns_buffer_write_u16(pkt, 0); /* id */
+	sldns_buffer_write_u16(pkt, BIT_QR|BIT_RD|BIT_RA); /* flags */
+	sldns_buffer_write_u16(pkt, 1); /* qdcount */
+	sldns_buffer_write_u16(pkt, 2); /* ancount */
+	sldns_buffer_write_u16(pkt, 1); /* nscount */
+	sldns_buffer_write_u16(pkt, 0); /* arcount */
+	sldns_buffer_write(pkt, qname, qname_len);
+	sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_A);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	add_rr(pkt, "www.example.com. 3600 IN A 192.0.2.1");
+	add_rr(pkt, "www.example.com. 3600 IN A 192.0.2.2");
+	add_rr(pkt, "example.com. 7200 IN NS ns.example.com.");
+	sldns_buffer_flip(pkt);
+
+	unit_assert(reply_info_parse(pkt, &e->alloc, &qinfo, &rep, e->region,
+		&edns) == 0);
+	/* the TTLs are relative, the store adds the current time */
+	unit_assert(dns_cache_store(&e->env, &qinfo, rep, 0, 0, 0, NULL, 0));
+	query_info_clear(&qinfo);
+	reply_info_parsedelete(rep, &e->alloc);
+	regional_free_all(e->region);
+	sldns_buffer_free(pkt);
+}
+
+/** check that a TTL is the expected one, the load may take a second */
+static void
+check_ttl(time_t ttl, time_t expect)
+{
+	unit_assert(ttl <= expect && ttl >= expect-1);
+}
+
+/** check the rrset in the cache, expect_ttl 0 means it is not there */
+static void
+check_rrset(struct cs_env* e, const char* name, uint16_t type,
+	size_t count, time_t expect_ttl)
+{
+	uint8_t dname[LDNS_MAX_DOMAINLEN+1];
+	size_t dname_len = sizeof(dname), i;
+	struct ub_packed_rrset_key* k;
+	struct packed_rrset_data* d;
+	unit_assert(sldns_str2wire_dname_buf(name, dname, &dname_len) == 0);
+	k = rrset_cache_lookup(e->env.rrset_cache, dname, dname_len, type,
+		LDNS_RR_CLASS_IN, 0, e->now, 0);
+	if(expect_ttl == 0) {
+		unit_assert(k == NULL);
+		return;
+	}
+	unit_assert(k);
+	d = (struct packed_rrset_data*)k->entry.data;
+	unit_assert(d->count == count && d->rrsig_count == 0);
+	check_ttl(d->ttl, expect_ttl);
+	for(i=0; i<d->count; i++)
+		check_ttl(d->rr_ttl[i], expect_ttl);
+	lock_rw_unlock(&k->entry.lock);
+}
+
+/** check the message in the cache, expect_ttl 0 means it is not there */
+static void
+check_msg(struct cs_env* e, time_t expect_ttl)
+{
+	uint8_t qname[LDNS_MAX_DOMAINLEN+1];
+	size_t qname_len = sizeof(qname);
+	struct msgreply_entry* m;
+	struct reply_info* rep;
+	unit_assert(sldns_str2wire_dname_buf("www.example.com.", qname,
+		&qname_len) == 0);
+	m = msg_cache_lookup(&e->env, qname, qname_len, LDNS_RR_TYPE_A,
+		LDNS_RR_CLASS_IN, 0, e->now, 0);
+	if(expect_ttl == 0) {
+		unit_assert(m == NULL);
+		return;
+	}
+	unit_assert(m);
+	rep = (struct reply_info*)m->entry.data;
+	check_ttl(rep->ttl, expect_ttl);
+	unit_assert(rep->an_numrrsets == 1 && rep->ns_numrrsets == 1 &&
+		rep->ar_numrrsets == 0);
+	unit_assert(rep->flags & BIT_QR);
+	lock_rw_unlock(&m->entry.lock);
+}
+
+/** read the snapshot file into memory */
+static uint8_t*
+read_file(const char* fname, size_t* len)
+{
+	uint8_t* data;
+	long sz;
+	FILE* in = fopen(fname, "rb");
+	unit_assert(in);
+	unit_assert(fseek(in, 0, SEEK_END) == 0);
+	sz = ftell(in);
+	unit_assert(sz > CS_HEADER_SIZE);
+	rewind(in);
+	data = (uint8_t*)malloc((size_t)sz);
+	unit_assert(data);
+	unit_assert(fread(data, 1, (size_t)sz, in) == (size_t)sz);
+	fclose(in);
+	*len = (size_t)sz;
+	return data;
+}
+
+/** write (a changed copy of) the snapshot file */
+static void
+write_file(const char* fname, uint8_t* data, size_t len)
+{
+	FILE* out = fopen(fname, "wb");
+	unit_assert(out);
+	unit_assert(fwrite(data, 1, len, out) == len);
+	unit_assert(fclose(out) == 0);
+}
+
+/** return the position after the record that starts at pos */
+static size_t
+skip_record(uint8_t* d, size_t pos)
+{
+	size_t p = pos+1, i, num;
+	if(d[pos] == 'R') {
+		p += 2 + sldns_read_uint16(d+p); /* dname */
+		p += 2+2+4+4; /* type, class, flags, ttl */
+		num = sldns_read_uint32(d+p) + sldns_read_uint32(d+p+4);
+		p += 4+4+1+1; /* count, rrsig_count, trust, security */
+		for(i=0; i<num; i++)
+			p += 4+4 + sldns_read_uint32(d+p+4);
+	} else if(d[pos] == 'M') {
+		p += 2 + sldns_read_uint16(d+p); /* qname */
+		p += 2*5+4+4+1; /* up to and including security */
+		num = sldns_read_uint32(d+p) + sldns_read_uint32(d+p+4) +
+			sldns_read_uint32(d+p+8);
+		p += 4*3;
+		for(i=0; i<num; i++)
+			p += 2 + sldns_read_uint16(d+p) + 2+2+4;
+	}
+	return p;
+}
+
+/** find the first record with the tag, return its position */
+static size_t
+find_record(uint8_t* d, size_t len, uint8_t tag)
+{
+	size_t pos = CS_HEADER_SIZE;
+	while(pos < len && d[pos] != tag)
+		pos = skip_record(d, pos);
+	unit_assert(pos < len);
+	return pos;
+}
+
+/** load the file into empty caches, return the result of the load */
+static int
+load_file(const char* fname, uint8_t* data, size_t len)
+{
+	struct cs_env e;
+	int r;
+	write_file(fname, data, len);
+	cs_env_init(&e, 5000);
+	r = cache_snapshot_load(&e.env, e.region, fname);
+	cs_env_delete(&e);
+	return r;
+}
+
+/** move the time of writing in the header back by secs */
+static void
+age_header(uint8_t* d, uint32_t secs)
+{
+	uint64_t tm = ((uint64_t)sldns_read_uint32(d+8)<<32) |
+		(uint64_t)sldns_read_uint32(d+12);
+	tm -= secs;
+	sldns_write_uint32(d+8, (uint32_t)(tm>>32));
+	sldns_write_uint32(d+12, (uint32_t)(tm&0xffffffff));
+}
+
+/** test write and load, and the adjustment of the TTLs */
+static void
+roundtrip_test(const char* fname, uint8_t** data, size_t* len)
+{
+	struct cs_env e, l;
+	uint8_t* copy;
+	unit_show_func("daemon/cachesnap.c", "cache_snapshot_write");
+	cs_env_init(&e, 1000);
+	store_reply(&e);
+	check_rrset(&e, "www.example.com.", LDNS_RR_TYPE_A, 2, 1000+3600);
+	check_msg(&e, 1000+3600);
+	/* 100 seconds later the remaining TTLs are written */
+	e.now = 1100;
+	unit_assert(cache_snapshot_write(&e.env, e.region, fname));
+	cs_env_delete(&e);
+	*data = read_file(fname, len);
+	unit_assert(memcmp(*data, "UBCS", 4) == 0);
+	unit_assert(sldns_read_uint32(*data+4) == 1);
+	unit_assert((*data)[*len-1] == 'E');
+
+	unit_show_func("daemon/cachesnap.c", "cache_snapshot_load");
+	/* the remaining TTLs are added to the current time */
+	cs_env_init(&l, 5000);
+	unit_assert(cache_snapshot_load(&l.env, l.region, fname));
+	check_rrset(&l, "www.example.com.", LDNS_RR_TYPE_A, 2, 5000+3500);
+	check_rrset(&l, "example.com.", LDNS_RR_TYPE_NS, 1, 5000+7100);
+	check_msg(&l, 5000+3500);
+	cs_env_delete(&l);
+
+	/* the time since the file was written is subtracted */
+	copy = memdup(*data, *len);
+	unit_assert(copy);
+	age_header(copy, 200);
+	write_file(fname, copy, *len);
+	cs_env_init(&l, 5000);
+	unit_assert(cache_snapshot_load(&l.env, l.region, fname));
+	check_rrset(&l, "www.example.com.", LDNS_RR_TYPE_A, 2, 5000+3300);
+	check_rrset(&l, "example.com.", LDNS_RR_TYPE_NS, 1, 5000+6900);
+	check_msg(&l, 5000+3300);
+	cs_env_delete(&l);
+
+	/* expired entries are skipped, and so is the message that
+	 * references them */
+	age_header(copy, 3400);
+	write_file(fname, copy, *len);
+	cs_env_init(&l, 5000);
+	unit_assert(cache_snapshot_load(&l.env, l.region, fname));
+	check_rrset(&l, "www.example.com.", LDNS_RR_TYPE_A, 2, 0);
+	check_rrset(&l, "example.com.", LDNS_RR_TYPE_NS, 1, 5000+3500);
+	check_msg(&l, 0);
+	cs_env_delete(&l);
+	free(copy);
+
+	/* no snapshot file is not an error */
+	unlink(fname);
+	cs_env_init(&l, 5000);
+	unit_assert(cache_snapshot_load(&l.env, l.region, fname));
+	check_msg(&l, 0);
+	cs_env_delete(&l);
+}
+
+/** test rejection of damaged files */
+static void
+reject_test(const char* fname, uint8_t* data, size_t len)
+{
+	uint8_t* copy = memdup(data, len);
+	size_t rpos, mpos;
+	unit_assert(copy);
+	unit_show_func("daemon/cachesnap.c", "snap_load_records");
+	/* the unchanged file loads */
+	unit_assert(load_file(fname, copy, len));
+
+	/* truncated files */
+	unit_assert(!load_file(fname, copy, len-1));
+	unit_assert(!load_file(fname, copy, CS_HEADER_SIZE-1));
+	unit_assert(!load_file(fname, copy, CS_HEADER_SIZE+10));
+	rpos = find_record(copy, len, 'R');
+	unit_assert(!load_file(fname, copy, skip_record(copy, rpos)-1));
+
+	/* bad magic and version */
+	copy[0] = 'X';
+	unit_assert(!load_file(fname, copy, len));
+	copy[0] = data[0];
+	sldns_write_uint32(copy+4, 2);
+	unit_assert(!load_file(fname, copy, len));
+	memmove(copy, data, len);
+
+	unit_show_func("daemon/cachesnap.c", "snap_load_rrset");
+	/* out of range trust and security of the rrset; the trust and
+	 * security octets are at the end of the fixed part of the record */
+	rpos += 1 + 2 + sldns_read_uint16(copy+rpos+1) + 2+2+4+4+4+4;
+	copy[rpos] = (uint8_t)rrset_trust_ultimate+1;
+	unit_assert(!load_file(fname, copy, len));
+	copy[rpos] = (uint8_t)rrset_trust_ultimate;
+	unit_assert(load_file(fname, copy, len));
+	copy[rpos+1] = (uint8_t)sec_status_secure+1;
+	unit_assert(!load_file(fname, copy, len));
+	memmove(copy, data, len);
+
+	unit_show_func("daemon/cachesnap.c", "snap_load_msg");
+	/* out of range security of the message */
+	mpos = find_record(copy, len, 'M');
+	mpos += 1 + 2 + sldns_read_uint16(copy+mpos+1) + 2*5+4+4;
+	copy[mpos] = (uint8_t)sec_status_secure+1;
+	unit_assert(!load_file(fname, copy, len));
+	copy[mpos] = (uint8_t)sec_status_secure;
+	unit_assert(load_file(fname, copy, len));
+
+	/* an unknown record tag */
+	memmove(copy, data, len);
+	copy[find_record(copy, len, 'M')] = 'X';
+	unit_assert(!load_file(fname, copy, len));
+	free(copy);
+}
+
+void cachesnap_test(void)
+{
+	char fname[256];
+	uint8_t* data = NULL;
+	size_t len = 0;
+	unit_show_feature("cache snapshot");
+	snprintf(fname, sizeof(fname), "/tmp/unbound.unittest.snap.%u",
+		(unsigned)getpid());
+	if(vbmp) printf("snapshot file %s\n", fname);
+	roundtrip_test(fname, &data, &len);
+	reject_test(fname, data, len);
+	unlink(fname);
+	free(data);
+}
@@ -39,6 +39,7 @@
  */
 
 #include "config.h"
+#include <ctype.h>
 #include "util/log.h"
 #include "testcode/unitmain.h"
 #include "util/data/dname.h"
@@ -127,6 +128,98 @@ dname_test_query_dname_compare(void)
 					(uint8_t*)"\003abc\001a") == 1);
 }
 
+/** test dname_lower_equal */
+static void
+dname_test_lower_equal(void)
+{
+	uint8_t a[256], b[256];
+	size_t i, len;
+	unit_show_func("util/data/dname.c", "dname_lower_equal");
+	unit_assert(dname_lower_equal((uint8_t*)"", (uint8_t*)"", 1));
+	unit_assert(dname_lower_equal((uint8_t*)"\003aBc\001a", 
+		(uint8_t*)"\003AbC\001A", 7));
+	unit_assert(!dname_lower_equal((uint8_t*)"\003abc\001a", 
+		(uint8_t*)"\003abc\001b", 7));
+	/* a long name, so that the vector and the tail are both used */
+	memmove(a, "\007example\003COM\002xZ\013MixedCaseAb\002nl\000", 31);
+	memmove(b, "\007EXAMPLE\003com\002Xz\013mIXEDcASEaB\002NL\000", 31);
+	unit_assert(dname_lower_equal(a, b, 31));
+	for(len=1; len<31; len++)
+		unit_assert(dname_lower_equal(a, b, len));
+	for(i=0; i<31; i++) {
+		uint8_t c = b[i];
+		b[i] ^= 0x01;
+		unit_assert(!dname_lower_equal(a, b, 31));
+		b[i] = c;
+	}
+	/* characters next to the letters are not folded */
+	for(i=0; i<256; i++) {
+		a[0] = 1; a[1] = (uint8_t)i; a[2] = 0;
+		b[0] = 1; b[1] = (uint8_t)(i^0x20); b[2] = 0;
+		if((i >= 'A' && i <= 'Z') || (i >= 'a' && i <= 'z'))
+			unit_assert(dname_lower_equal(a, b, 3));
+		else	unit_assert(!dname_lower_equal(a, b, 3));
+	}
+	/* the same for every position in a vector */
+	for(len=1; len<40; len++) {
+		a[0] = (uint8_t)len;
+		b[0] = (uint8_t)len;
+		for(i=1; i<=len; i++) {
+			a[i] = (uint8_t)("@AZ[`az{\300\301\341"[i%11]);
+			b[i] = a[i];
+		}
+		a[len+1] = 0;
+		b[len+1] = 0;
+		for(i=1; i<=len; i++) {
+			uint8_t c = b[i];
+			b[i] ^= 0x20;
+			if((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'))
+				unit_assert(dname_lower_equal(a, b, len+2));
+			else	unit_assert(!dname_lower_equal(a, b, len+2));
+			b[i] = c;
+		}
+	}
+}
+
+/** test dname_query_hash and dname_pkt_hash */
+static void
+dname_test_hash(sldns_buffer* buff)
+{
+	uint8_t a[256], b[256];
+	size_t i;
+	hashvalue_type h;
+	unit_show_func("util/data/dname.c", "dname_pkt_hash");
+	h = dname_query_hash((uint8_t*)"\003www\007example\003com\000", 1);
+	unit_assert(h == dname_query_hash(
+		(uint8_t*)"\003WWW\007ExAmPlE\003cOm\000", 1));
+	unit_assert(h != dname_query_hash(
+		(uint8_t*)"\003www\007example\003net\000", 1));
+	unit_assert(h != dname_query_hash(
+		(uint8_t*)"\003www\007example\003com\000", 2));
+	unit_assert(dname_query_hash((uint8_t*)"\000", 1) != h);
+
+	/* compressed name in a packet, with different case */
+	sldns_buffer_clear(buff);
+	sldns_buffer_write(buff, "\003www\007example\003com\000", 17);
+	sldns_buffer_write(buff, "\003wWw\300\004", 6);
+	sldns_buffer_flip(buff);
+	unit_assert(dname_pkt_hash(buff, sldns_buffer_at(buff, 17), 1) == h);
+	unit_assert(dname_pkt_hash(buff, sldns_buffer_begin(buff), 1) == h);
+
+	/* a long name, lowercased in more than one vector */
+	for(i=0; i<250; i+=50) {
+		a[i] = 49;
+		memset(a+i+1, 'a'+i/50, 49);
+	}
+	a[250] = 0;
+	memmove(b, a, 251);
+	for(i=1; i<250; i+=3)
+		b[i] = (uint8_t)toupper((unsigned char)b[i]);
+	unit_assert(dname_query_hash(a, 1) == dname_query_hash(b, 1));
+	b[247] ^= 0x01;
+	unit_assert(dname_query_hash(a, 1) != dname_query_hash(b, 1));
+}
+
 /** test dname_count_labels */
 static void
 dname_test_count_labels(void)
@@ -842,6 +935,8 @@ void dname_test(void)
 	dname_test_qdtl(buff);
 	dname_test_pdtl(loopbuf, boundbuf);
 	dname_test_query_dname_compare();
+	dname_test_lower_equal();
+	dname_test_hash(buff);
 	dname_test_count_labels();
 	dname_test_count_size_labels();
 	dname_test_dname_lab_cmp();
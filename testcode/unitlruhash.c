@@ -39,10 +39,16 @@
  */
 
 #include "config.h"
+#include <ctype.h>
+#include <sys/time.h>
 #include "testcode/unitmain.h"
 #include "util/log.h"
 #include "util/storage/lruhash.h"
 #include "util/storage/slabhash.h" /* for the test structures */
+#include "util/data/msgreply.h"
+#include "util/data/dname.h"
+#include "util/net_help.h"
+#include "sldns/rrdef.h"
 
 /** use this type for the lruhash test key */
 typedef struct slabhash_testkey testkey_type;
@@ -227,6 +233,68 @@ test_short_table(struct lruhash* table)
 	lruhash_remove(table, myhash(14), k2);
 }
 
+/** insert test element with id in the table */
+static testkey_type*
+clock_insert(struct lruhash* table, int id)
+{
+	testkey_type* k = newkey(id);
+	testdata_type* d = newdata(id);
+	k->entry.data = d;
+	lruhash_insert(table, myhash(id), &k->entry, d, NULL);
+	return k;
+}
+
+/** see if element with id is in the table, it is looked up */
+static int
+clock_present(struct lruhash* table, int id)
+{
+	testkey_type* k = newkey(id);
+	struct lruhash_entry* en = lruhash_lookup(table, myhash(id), k, 0);
+	delkey(k);
+	if(!en)
+		return 0;
+	lock_rw_unlock(&en->lock);
+	return 1;
+}
+
+/** test CLOCK eviction, entries that are used get a second chance */
+static void
+test_clock(void)
+{
+	/* room for four elements */
+	struct lruhash* table = lruhash_create(2,
+		4*test_slabhash_sizefunc(NULL, NULL), 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	testkey_type* k3;
+	unit_assert(table);
+	lruhash_setclock(table, 1);
+	(void)clock_insert(table, 1);
+	(void)clock_insert(table, 2);
+	k3 = clock_insert(table, 3);
+	(void)clock_insert(table, 4);
+	unit_assert(table->num == 4);
+	/* lookup does not change the LRU list */
+	unit_assert(table->lru_start->lru_next == &k3->entry);
+	unit_assert(clock_present(table, 3));
+	unit_assert(table->lru_start->lru_next == &k3->entry);
+
+	/* all are new, with the bit set, after one round the oldest goes */
+	(void)clock_insert(table, 5);
+	unit_assert(table->num == 4);
+	unit_assert(!clock_present(table, 1));
+	/* 2 is used, the bit is set, so 3 goes next, not 2 */
+	unit_assert(clock_present(table, 2));
+	(void)clock_insert(table, 6);
+	unit_assert(table->num == 4);
+	unit_assert(clock_present(table, 2));
+	unit_assert(!clock_present(table, 3));
+	unit_assert(clock_present(table, 4));
+	unit_assert(clock_present(table, 5));
+	unit_assert(clock_present(table, 6));
+	lruhash_delete(table);
+}
+
 /** number of hash test max */
 #define HASHTESTMAX 25
 
@@ -477,6 +545,139 @@ test_threaded_table(struct lruhash* table)
 	if(0) lruhash_status(table, "hashtest", 1);
 }
 
+/** number of names in the key compare perf test */
+#define PERFNAMES 1024
+/** number of lookups in the key compare perf test */
+#define PERFLOOKUPS 200000
+
+/** make a name for the perf test, www<i>.example.com, mixed case if asked */
+static size_t
+perf_name(uint8_t* buf, int i, int mixed)
+{
+	char lab[32];
+	size_t len, j;
+	snprintf(lab, sizeof(lab), "www%d", i);
+	len = strlen(lab);
+	buf[0] = (uint8_t)len;
+	memmove(buf+1, lab, len);
+	memmove(buf+1+len, "\007example\003com\000", 13);
+	len += 14;
+	if(mixed) {
+		for(j=1; j<len; j+=2)
+			buf[j] = (uint8_t)toupper((unsigned char)buf[j]);
+	}
+	return len;
+}
+
+/** time in msec since start */
+static double
+perf_msec(struct timeval* start)
+{
+	struct timeval end;
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return (double)(end.tv_sec - start->tv_sec)*1000. + 
+		((double)end.tv_usec - (double)start->tv_usec)/1000.;
+}
+
+/** time lookups of message cache keys, the keys are stored in lowercase */
+static void
+perf_lookup(struct lruhash* table, int mixed)
+{
+	uint8_t buf[LDNS_MAX_DOMAINLEN+1];
+	struct query_info q;
+	struct lruhash_entry* e;
+	struct timeval start;
+	double dt;
+	int i;
+	memset(&q, 0, sizeof(q));
+	q.qname = buf;
+	q.qtype = LDNS_RR_TYPE_A;
+	q.qclass = LDNS_RR_CLASS_IN;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<PERFLOOKUPS; i++) {
+		q.qname_len = perf_name(buf, i%PERFNAMES, mixed);
+		e = lruhash_lookup(table, query_info_hash(&q, 0), &q, 0);
+		unit_assert(e);
+		lock_rw_unlock(&e->lock);
+	}
+	dt = perf_msec(&start);
+	printf("lookup %s names: did %u in %g msec for %f lookup/sec\n",
+		(mixed?"mixed case":"lowercase"), (unsigned)PERFLOOKUPS, dt,
+		(double)PERFLOOKUPS / (dt/1000.));
+}
+
+/** time the name compares, case insensitive per label and the fast path */
+static void
+perf_compare(void)
+{
+	static uint8_t a[PERFNAMES][LDNS_MAX_DOMAINLEN+1];
+	static uint8_t b[PERFNAMES][LDNS_MAX_DOMAINLEN+1];
+	static size_t len[PERFNAMES];
+	struct timeval start;
+	double dt;
+	int i, mixed, n = 0;
+	for(mixed=0; mixed<2; mixed++) {
+		for(i=0; i<PERFNAMES; i++) {
+			len[i] = perf_name(a[i], i, 0);
+			(void)perf_name(b[i], i, mixed);
+		}
+		if(gettimeofday(&start, NULL) < 0)
+			fatal_exit("gettimeofday: %s", strerror(errno));
+		for(i=0; i<PERFLOOKUPS*5; i++)
+			n += (query_dname_compare(a[i%PERFNAMES],
+				b[i%PERFNAMES]) == 0);
+		dt = perf_msec(&start);
+		printf("query_dname_compare %s: did %u in %g msec\n",
+			(mixed?"mixed case":"lowercase"),
+			(unsigned)PERFLOOKUPS*5, dt);
+		if(gettimeofday(&start, NULL) < 0)
+			fatal_exit("gettimeofday: %s", strerror(errno));
+		for(i=0; i<PERFLOOKUPS*5; i++)
+			n += dname_lower_equal(a[i%PERFNAMES], b[i%PERFNAMES],
+				len[i%PERFNAMES]);
+		dt = perf_msec(&start);
+		printf("dname_lower_equal %s: did %u in %g msec\n",
+			(mixed?"mixed case":"lowercase"),
+			(unsigned)PERFLOOKUPS*5, dt);
+	}
+	unit_assert(n == PERFLOOKUPS*5*4);
+}
+
+/** performance test of the message cache key compare */
+static void
+test_perf_keys(void)
+{
+	uint8_t buf[LDNS_MAX_DOMAINLEN+1];
+	struct lruhash* table = lruhash_create(1024, 1024*1024*1024,
+		msgreply_sizefunc, query_info_compare, query_entry_delete,
+		reply_info_delete, NULL);
+	struct query_info q;
+	struct msgreply_entry* e;
+	struct reply_info* rep;
+	int i;
+	unit_assert(table);
+	memset(&q, 0, sizeof(q));
+	q.qtype = LDNS_RR_TYPE_A;
+	q.qclass = LDNS_RR_CLASS_IN;
+	for(i=0; i<PERFNAMES; i++) {
+		/* insert the mixed case, it is stored in lowercase */
+		q.qname_len = perf_name(buf, i, 1);
+		q.qname = memdup(buf, q.qname_len);
+		rep = (struct reply_info*)calloc(1, sizeof(*rep));
+		unit_assert(q.qname && rep);
+		e = query_info_entrysetup(&q, rep, query_info_hash(&q, 0));
+		unit_assert(e);
+		lruhash_insert(table, e->entry.hash, &e->entry, rep, NULL);
+	}
+	unit_assert(table->num == PERFNAMES);
+	perf_lookup(table, 0);
+	perf_lookup(table, 1);
+	perf_compare();
+	lruhash_delete(table);
+}
+
 void lruhash_test(void)
 {
 	/* start very very small array, so it can do lots of table_grow() */
@@ -496,4 +697,22 @@ void lruhash_test(void)
 		test_slabhash_delkey, test_slabhash_deldata, NULL);
 	test_threaded_table(table);
 	lruhash_delete(table);
+
+	/* the same tests with CLOCK eviction */
+	test_clock();
+	table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	lruhash_setclock(table, 1);
+	test_short_table(table);
+	test_long_table(table);
+	lruhash_delete(table);
+	table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	lruhash_setclock(table, 1);
+	test_threaded_table(table);
+	lruhash_delete(table);
+
+	test_perf_keys();
 }
@@ -380,6 +380,31 @@ config_memsize_test(void)
 	unit_assert( cfg_parse_memsize("0 Gb", &v) && v==0*1024*1024);
 }
 
+/** test config_file: cfg_parse_cpu_list */
+static void
+config_cpu_list_test(void)
+{
+	int* c = NULL;
+	unit_show_func("util/config_file.c", "cfg_parse_cpu_list");
+	if(0) {
+		/* these emit errors */
+		unit_assert( cfg_parse_cpu_list("a", &c) == -1 && !c);
+		unit_assert( cfg_parse_cpu_list("1-", &c) == -1 && !c);
+		unit_assert( cfg_parse_cpu_list("3-1", &c) == -1 && !c);
+		unit_assert( cfg_parse_cpu_list("-1", &c) == -1 && !c);
+		unit_assert( cfg_parse_cpu_list("1 2x", &c) == -1 && !c);
+	}
+	unit_assert( cfg_parse_cpu_list("", &c) == 0 && !c);
+	unit_assert( cfg_parse_cpu_list(" , ", &c) == 0 && !c);
+	unit_assert( cfg_parse_cpu_list("5", &c) == 1 && c[0] == 5);
+	free(c);
+	unit_assert( cfg_parse_cpu_list("0 2,4-7", &c) == 6);
+	unit_assert( c[0] == 0 && c[1] == 2 && c[2] == 4 && c[5] == 7);
+	free(c);
+	unit_assert( cfg_parse_cpu_list("0-39", &c) == 40 && c[39] == 39);
+	free(c);
+}
+
 /** test config_file: test tag code */
 static void
 config_tag_test(void) 
@@ -433,6 +458,7 @@ rtt_test(void)
 }
 
 #include "services/cache/infra.h"
+#include "sldns/str2wire.h"
 
 /* lookup and get key and data structs easily */
 static struct infra_data* infra_lookup_host(struct infra_cache* infra,
@@ -529,6 +555,422 @@ infra_test(void)
 	config_delete(cfg);
 }
 
+/** test the server information shared between zones */
+static void
+infra_server_test(void)
+{
+	struct sockaddr_storage one;
+	socklen_t onelen;
+	uint8_t* zone = (uint8_t*)"\007example\003com\000";
+	size_t zonelen = 13;
+	uint8_t* zone2 = (uint8_t*)"\007example\003net\000";
+	uint8_t* zone3 = (uint8_t*)"\007example\003org\000";
+	struct infra_cache* slab;
+	struct config_file* cfg = config_create();
+	time_t now = 0;
+	uint8_t edns_lame;
+	int vs, to, rto;
+	struct infra_key* k;
+	struct infra_data* d;
+	int init = 376;
+
+	unit_show_feature("infra server shared");
+	unit_assert(ipstrtoaddr("127.0.0.1", 53, &one, &onelen));
+	cfg->infra_cache_server_shared = 1;
+	slab = infra_create(cfg);
+	unit_assert(slab && slab->servers);
+
+	/* a timeout and edns info for one zone */
+	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, now,
+		&vs, &edns_lame, &to) );
+	unit_assert( vs == 0 && to == init && edns_lame == 0 );
+	unit_assert( infra_rtt_update(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, -1, init, now) == init*2 );
+	unit_assert( infra_edns_update(slab, &one, onelen, zone, zonelen,
+		-1, now) );
+	unit_assert( infra_set_lame(slab, &one, onelen, zone, zonelen, now,
+		0, 0, LDNS_RR_TYPE_A) );
+
+	/* another zone on the server starts with that information */
+	unit_assert( infra_host(slab, &one, onelen, zone2, zonelen, now,
+		&vs, &edns_lame, &to) );
+	unit_assert( vs == -1 && to == init*2 && edns_lame == 1 );
+	/* but lameness is per zone */
+	unit_assert( (d=infra_lookup_host(slab, &one, onelen, zone2, zonelen,
+		0, now, &k)) );
+	unit_assert(!d->isdnsseclame && !d->rec_lame && !d->lame_type_A &&
+		!d->lame_other);
+	lock_rw_unlock(&k->entry.lock);
+
+	/* a reply in the second zone is fed back to the server */
+	rto = infra_rtt_update(slab, &one, onelen, zone2, zonelen,
+		LDNS_RR_TYPE_A, 20, init*2, now);
+	unit_assert( rto < init*2 );
+	unit_assert( infra_host(slab, &one, onelen, zone3, zonelen, now,
+		&vs, &edns_lame, &to) );
+	unit_assert( to == rto );
+
+	/* after the ttl, the server information is not used */
+	now += cfg->host_ttl + 10;
+	unit_assert( infra_host(slab, &one, onelen, zone2, zonelen, now,
+		&vs, &edns_lame, &to) );
+	unit_assert( vs == 0 && to == init && edns_lame == 0 );
+
+	infra_delete(slab);
+	config_delete(cfg);
+}
+
+/** test the latency histogram and percentile server selection */
+static void
+infra_latency_test(void)
+{
+	struct sockaddr_storage one;
+	socklen_t onelen;
+	uint8_t* zone = (uint8_t*)"\007example\003com\000";
+	size_t zonelen = 13;
+	struct infra_cache* slab;
+	struct config_file* cfg = config_create();
+	time_t now = 0;
+	int i, lame, dlame, rlame, rtt;
+	struct infra_key* k;
+	struct infra_data* d;
+
+	unit_show_feature("infra latency histogram");
+	unit_assert(ipstrtoaddr("127.0.0.1", 53, &one, &onelen));
+	cfg->server_selection_percentile = 90;
+	slab = infra_create(cfg);
+	unit_assert(slab);
+
+	/* bimodal: 80 fast replies and 20 slow ones */
+	for(i=0; i<80; i++)
+		unit_assert(infra_rtt_update(slab, &one, onelen, zone, zonelen,
+			LDNS_RR_TYPE_A, 10, 376, now));
+	for(i=0; i<20; i++)
+		unit_assert(infra_rtt_update(slab, &one, onelen, zone, zonelen,
+			LDNS_RR_TYPE_A, 700, 376, now));
+	unit_assert( (d=infra_lookup_host(slab, &one, onelen, zone, zonelen,
+		0, now, &k)) );
+	/* 10 msec is in the [8, 16) bucket, 700 msec in [512, 1024) */
+	unit_assert(d->lat_hist[4] == 80 && d->lat_hist[10] == 20);
+	unit_assert(infra_lat_percentile(d, 50) >= 8 &&
+		infra_lat_percentile(d, 50) < 16);
+	unit_assert(infra_lat_percentile(d, 90) >= 512 &&
+		infra_lat_percentile(d, 90) < 1024);
+	lock_rw_unlock(&k->entry.lock);
+
+	/* selection uses the p90, not the smoothed rtt */
+	unit_assert(infra_get_lame_rtt(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, &lame, &dlame, &rlame, &rtt, now));
+	unit_assert(rtt >= 512 && rtt < 1024);
+
+	/* the counts decay */
+	for(i=0; i<INFRA_LAT_DECAY; i++)
+		unit_assert(infra_rtt_update(slab, &one, onelen, zone, zonelen,
+			LDNS_RR_TYPE_A, 10, 376, now));
+	unit_assert( (d=infra_lookup_host(slab, &one, onelen, zone, zonelen,
+		0, now, &k)) );
+	unit_assert(d->lat_hist[10] < 20);
+	unit_assert(infra_lat_percentile(d, 90) < 16);
+	lock_rw_unlock(&k->entry.lock);
+
+	infra_delete(slab);
+	config_delete(cfg);
+}
+
+/** do an ip ratelimit query for the address */
+static int
+infra_ip_rate_query(struct infra_cache* infra, const char* ip,
+	struct timeval* tv)
+{
+	struct comm_reply rep;
+	memset(&rep, 0, sizeof(rep));
+	unit_assert(ipstrtoaddr(ip, 53, &rep.addr, &rep.addrlen));
+	return infra_ip_ratelimit_inc(infra, &rep, tv->tv_sec, tv);
+}
+
+/** test the token bucket ratelimits */
+static void
+infra_ratelimit_test(void)
+{
+	uint8_t* zone = (uint8_t*)"\007example\003com\000";
+	size_t zonelen = 13;
+	struct infra_cache* infra;
+	struct config_file* cfg = config_create();
+	struct timeval tv;
+	int i;
+
+	unit_show_feature("infra ratelimit token bucket");
+	cfg->ip_ratelimit = 10;
+	cfg->ip_ratelimit_burst = 5;
+	cfg->ip_ratelimit_ipv4_prefix = 24;
+	cfg->ratelimit = 10;
+	cfg->ratelimit_burst = 3;
+	unit_assert(cfg_strlist_insert(&cfg->ip_ratelimit_exempt,
+		strdup("192.0.2.0/24")));
+	infra = infra_create(cfg);
+	unit_assert(infra);
+	tv.tv_sec = 1000;
+	tv.tv_usec = 0;
+
+	/* the burst is allowed, for the whole /24 */
+	for(i=0; i<5; i++)
+		unit_assert(infra_ip_rate_query(infra, "10.0.0.1", &tv));
+	unit_assert(!infra_ip_rate_query(infra, "10.0.0.1", &tv));
+	unit_assert(!infra_ip_rate_query(infra, "10.0.0.2", &tv));
+	unit_assert(infra_ip_rate_query(infra, "10.0.1.1", &tv));
+	/* 100 msec refills one query at 10 qps */
+	tv.tv_usec = 100000;
+	unit_assert(infra_ip_rate_query(infra, "10.0.0.2", &tv));
+	unit_assert(!infra_ip_rate_query(infra, "10.0.0.1", &tv));
+	/* exempt addresses are not limited */
+	for(i=0; i<20; i++)
+		unit_assert(infra_ip_rate_query(infra, "192.0.2.7", &tv));
+
+	/* the domain ratelimit */
+	for(i=0; i<3; i++)
+		unit_assert(infra_ratelimit_inc(infra, zone, zonelen,
+			tv.tv_sec, &tv));
+	unit_assert(!infra_ratelimit_inc(infra, zone, zonelen, tv.tv_sec,
+		&tv));
+	unit_assert(infra_ratelimit_exceeded(infra, zone, zonelen, tv.tv_sec,
+		&tv));
+	/* a referral gives the token back */
+	infra_ratelimit_dec(infra, zone, zonelen, tv.tv_sec, &tv);
+	unit_assert(!infra_ratelimit_exceeded(infra, zone, zonelen,
+		tv.tv_sec, &tv));
+
+	infra_delete(infra);
+	config_delete(cfg);
+	infra_ip_ratelimit = 0;
+	infra_dp_ratelimit = 0;
+}
+
+/** test the compact address of the infra cache */
+static void
+infra_addr_test(void)
+{
+	struct sockaddr_storage a, b;
+	socklen_t alen, blen;
+	struct infra_addr ia, ib;
+	unit_show_feature("infra addr");
+	unit_assert(sizeof(ia) == 18);
+
+	unit_assert(ipstrtoaddr("192.0.2.1", 5353, &a, &alen));
+	infra_addr_pack(&ia, &a, alen);
+	infra_addr_unpack(&ia, &b, &blen);
+	unit_assert(sockaddr_cmp(&a, alen, &b, blen) == 0);
+
+	unit_assert(ipstrtoaddr("2001:db8::1", 53, &a, &alen));
+	infra_addr_pack(&ia, &a, alen);
+	infra_addr_unpack(&ia, &b, &blen);
+	unit_assert(sockaddr_cmp(&a, alen, &b, blen) == 0);
+
+	/* different port, different key */
+	unit_assert(ipstrtoaddr("2001:db8::1", 54, &b, &blen));
+	infra_addr_pack(&ib, &b, blen);
+	unit_assert(memcmp(&ia, &ib, sizeof(ia)) != 0);
+}
+
+/** test the layout of the infra key, and short and long zone names */
+static void
+infra_key_test(void)
+{
+	struct sockaddr_storage a;
+	socklen_t alen;
+	uint8_t* zone = (uint8_t*)"\007example\003com\000";
+	size_t zonelen = 13;
+	uint8_t longzone[64];
+	size_t longzonelen = sizeof(longzone);
+	struct infra_cache* slab;
+	struct config_file* cfg = config_create();
+	uint8_t edns_lame;
+	int vs, to;
+	struct infra_key* k;
+	unit_show_feature("infra key");
+
+	/* the compared fields and the name pointer are first, in 64 bytes,
+	 * and the hash table entry is last */
+	unit_assert(offsetof(struct infra_key, addr) == 0);
+	unit_assert(offsetof(struct infra_key, namelen) ==
+		sizeof(struct infra_addr));
+	unit_assert(offsetof(struct infra_key, name) ==
+		sizeof(struct infra_addr) + 1);
+	unit_assert(offsetof(struct infra_key, zonename) ==
+		offsetof(struct infra_key, name) + INFRA_KEY_NAME_INLINE);
+	unit_assert(offsetof(struct infra_key, zonename) + sizeof(uint8_t*)
+		<= 64);
+	unit_assert(offsetof(struct infra_key, entry) >=
+		offsetof(struct infra_key, zonename) + sizeof(uint8_t*));
+	unit_assert(offsetof(struct infra_key, entry) +
+		sizeof(struct lruhash_entry) == sizeof(struct infra_key));
+
+	unit_assert(sldns_str2wire_dname_buf("a-zone-name-longer-than-inline."
+		"example.com.", longzone, &longzonelen) == 0);
+	unit_assert(longzonelen > INFRA_KEY_NAME_INLINE);
+	unit_assert(ipstrtoaddr("192.0.2.1", 53, &a, &alen));
+	unit_assert(cfg);
+	slab = infra_create(cfg);
+	unit_assert(slab);
+	unit_assert(infra_host(slab, &a, alen, zone, zonelen, 0, &vs,
+		&edns_lame, &to));
+	unit_assert(infra_host(slab, &a, alen, longzone, longzonelen, 0, &vs,
+		&edns_lame, &to));
+
+	/* the short name is in the key, the long name after it */
+	unit_assert(infra_lookup_host(slab, &a, alen, zone, zonelen, 0, 0,
+		&k));
+	unit_assert(k->zonename == k->name && k->namelen == zonelen);
+	unit_assert(memcmp(k->zonename, zone, zonelen) == 0);
+	lock_rw_unlock(&k->entry.lock);
+	unit_assert(infra_lookup_host(slab, &a, alen, longzone, longzonelen,
+		0, 0, &k));
+	unit_assert(k->zonename == (uint8_t*)(k+1) &&
+		k->namelen == longzonelen);
+	unit_assert(memcmp(k->zonename, longzone, longzonelen) == 0);
+	lock_rw_unlock(&k->entry.lock);
+
+	infra_delete(slab);
+	config_delete(cfg);
+}
+
+/** test the expected rtt and eviction counters for jostle-adaptive */
+static void
+infra_evict_test(void)
+{
+	struct sockaddr_storage one, two;
+	socklen_t onelen, twolen;
+	uint8_t* zone = (uint8_t*)"\007example\003com\000";
+	size_t zonelen = 13;
+	uint8_t* zone2 = (uint8_t*)"\003net\000";
+	size_t zone2len = 5;
+	struct infra_cache* slab;
+	struct config_file* cfg = config_create();
+	time_t now = 0;
+	uint8_t edns_lame;
+	int vs, to;
+	int init = 376;
+
+	unit_show_feature("infra jostle data");
+	unit_assert(ipstrtoaddr("127.0.0.1", 53, &one, &onelen));
+	unit_assert(ipstrtoaddr("127.0.0.2", 53, &two, &twolen));
+
+	/* without jostle-adaptive there is no table */
+	slab = infra_create(cfg);
+	unit_assert(slab->domain_evicts == NULL);
+	infra_evict_inc(slab, zone, zonelen, now);
+	unit_assert(infra_evict_count(slab, zone, zonelen) == 0);
+	infra_delete(slab);
+
+	cfg->jostle_adaptive = 1;
+	slab = infra_create(cfg);
+	unit_assert(slab->domain_evicts != NULL);
+	unit_assert(infra_expected_rtt(slab, &one, onelen, zone, zonelen,
+		now) == 0);
+	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, now,
+		&vs, &edns_lame, &to) );
+	unit_assert(infra_expected_rtt(slab, &one, onelen, zone, zonelen,
+		now) == init);
+	/* a timeout backs off the rto, and counts once more */
+	unit_assert( infra_rtt_update(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, -1, init, now) );
+	unit_assert(infra_expected_rtt(slab, &one, onelen, zone, zonelen,
+		now) == init*2*2);
+	unit_assert(infra_expected_rtt(slab, &two, twolen, zone, zonelen,
+		now) == 0);
+	/* expired data is not used */
+	unit_assert(infra_expected_rtt(slab, &one, onelen, zone, zonelen,
+		now + cfg->host_ttl + 10) == 0);
+
+	unit_assert(infra_evict_count(slab, zone, zonelen) == 0);
+	infra_evict_inc(slab, zone, zonelen, now);
+	infra_evict_inc(slab, zone, zonelen, now+1);
+	infra_evict_inc(slab, zone2, zone2len, now);
+	unit_assert(infra_evict_count(slab, zone, zonelen) == 2);
+	unit_assert(infra_evict_count(slab, zone2, zone2len) == 1);
+
+	/* infra_adjust removes the table when the option is turned off */
+	cfg->jostle_adaptive = 0;
+	slab = infra_adjust(slab, cfg);
+	unit_assert(slab && slab->domain_evicts == NULL);
+	infra_delete(slab);
+	config_delete(cfg);
+}
+
+#include "services/inflight.h"
+#include "util/tube.h"
+#include "util/data/msgreply.h"
+/** test the shared table of queries in flight */
+static void
+inflight_test(void)
+{
+	struct tube* wake[3];
+	struct inflight_table* t;
+	struct query_info q, q2;
+	int own = 0, own2 = 0;
+	uint8_t* msg = NULL;
+	uint32_t len = 0;
+	int i;
+	unit_show_feature("inflight table");
+	for(i=0; i<3; i++) {
+		wake[i] = tube_create();
+		unit_assert(wake[i]);
+	}
+	t = inflight_create(10, 3, wake);
+	unit_assert(t && t->size == 1024);
+	memset(&q, 0, sizeof(q));
+	q.qname = (uint8_t*)"\003www\007example\003com\000";
+	q.qname_len = 17;
+	q.qtype = LDNS_RR_TYPE_A;
+	q.qclass = LDNS_RR_CLASS_IN;
+	q2 = q;
+	q2.qname = (uint8_t*)"\003WWW\007exAMple\003com\000";
+
+	/* thread 0 resolves it, 1 and 2 wait, case does not matter */
+	unit_assert(inflight_acquire(t, &q, BIT_RD, 123, 0, &own));
+	unit_assert(!inflight_acquire(t, &q2, BIT_RD, 123, 1, &own2));
+	unit_assert(!inflight_acquire(t, &q, BIT_RD, 123, 2, &own2));
+	/* other flags is another query, and thread 0 again resolves it */
+	unit_assert(inflight_acquire(t, &q, BIT_RD|BIT_CD, 123, 1, &own2));
+	unit_assert(inflight_acquire(t, &q, BIT_RD, 123, 0, &own2));
+
+	/* release wakes up thread 1 and 2, once */
+	inflight_release(t, 123, &own);
+	unit_assert(tube_read_msg(wake[0], &msg, &len, 1) == -1);
+	for(i=1; i<3; i++) {
+		unit_assert(tube_read_msg(wake[i], &msg, &len, 1) == 1);
+		unit_assert(len == 4);
+		free(msg);
+		unit_assert(tube_read_msg(wake[i], &msg, &len, 1) == -1);
+	}
+	/* thread 1 is now owner, a wakeup is pending for thread 2 */
+	unit_assert(inflight_acquire(t, &q, BIT_RD, 123, 1, &own));
+	unit_assert(!inflight_acquire(t, &q, BIT_RD, 123, 2, &own2));
+	inflight_release(t, 123, &own);
+	unit_assert(tube_read_msg(wake[2], &msg, &len, 1) == -1);
+	inflight_wakeup_done(t, 2);
+	unit_assert(inflight_acquire(t, &q, BIT_RD, 123, 2, &own));
+	unit_assert(!inflight_acquire(t, &q, BIT_RD, 123, 1, &own2));
+	inflight_release(t, 123, &own);
+	unit_assert(tube_read_msg(wake[1], &msg, &len, 1) == -1);
+	inflight_wakeup_done(t, 1);
+	unit_assert(inflight_acquire(t, &q, BIT_RD, 123, 2, &own));
+	unit_assert(!inflight_acquire(t, &q, BIT_RD, 123, 1, &own2));
+	inflight_release(t, 123, &own);
+	unit_assert(tube_read_msg(wake[1], &msg, &len, 1) == 1);
+	free(msg);
+
+	/* clear removes it without wakeups */
+	inflight_wakeup_done(t, 1);
+	unit_assert(inflight_acquire(t, &q, BIT_RD, 123, 0, &own));
+	unit_assert(!inflight_acquire(t, &q, BIT_RD, 123, 1, &own2));
+	inflight_clear(t);
+	inflight_release(t, 123, &own);
+	unit_assert(tube_read_msg(wake[1], &msg, &len, 1) == -1);
+	inflight_delete(t);
+	for(i=0; i<3; i++)
+		tube_delete(wake[i]);
+}
+
 #include "util/random.h"
 /** test randomness */
 static void
@@ -891,6 +1333,7 @@ main(int argc, char* argv[])
 	verify_test();
 	net_test();
 	config_memsize_test();
+	config_cpu_list_test();
 	config_tag_test();
 	dname_test();
 	rtt_test();
@@ -900,6 +1343,17 @@ main(int argc, char* argv[])
 	lruhash_test();
 	slabhash_test();
 	infra_test();
+	infra_addr_test();
+	infra_key_test();
+	infra_server_test();
+	infra_ratelimit_test();
+	infra_latency_test();
+	infra_evict_test();
+	inflight_test();
+	outnet_test();
+	wirecache_test();
+	cachesnap_test();
+	netevent_test();
 	ldns_test();
 	msgparse_test();
 #ifdef CLIENT_SUBNET
@@ -80,5 +80,13 @@ void ecs_test(void);
 void ldns_test(void);
 /** unit test for auth zone functions */
 void authzone_test(void);
+/** unit test for outside network functions */
+void outnet_test(void);
+/** unit test for the wire cache */
+void wirecache_test(void);
+/** unit test for the cache snapshot file */
+void cachesnap_test(void);
+/** unit test for the comm points */
+void netevent_test(void);
 
 #endif /* TESTCODE_UNITMAIN_H */
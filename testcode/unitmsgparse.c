@@ -65,6 +65,12 @@ static int matches_nolocation = 0;
 static int check_rrsigs = 0;
 /** do not check buffer sameness */
 static int check_nosameness = 0;
+/** maximum number of packets kept for the parse performance test */
+#define PERF_CORPUS_MAX 1024
+/** the packets from the testdata files, for the parse performance test */
+static sldns_buffer* perf_corpus[PERF_CORPUS_MAX];
+/** number of packets in the perf_corpus */
+static size_t perf_corpus_num = 0;
 
 /** see if buffers contain the same packet */
 static int
@@ -189,9 +195,10 @@ perf_encode(struct query_info* qi, struct reply_info* rep, uint16_t id,
 	/* time in millisec */
 	dt = (double)(end.tv_sec - start.tv_sec)*1000. + 
 		((double)end.tv_usec - (double)start.tv_usec)/1000.;
-	printf("[%d] did %u in %g msec for %f encode/sec size %d\n", num++,
+	printf("[%d] did %u in %g msec for %f encode/sec size %d%s\n", num++,
 		(unsigned)max, dt, (double)max / (dt/1000.), 
-		(int)sldns_buffer_limit(out));
+		(int)sldns_buffer_limit(out),
+		(COMPRESSION_HASH?" compression-hash":""));
 	regional_destroy(r2);
 }
 
@@ -225,6 +232,9 @@ perftestpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out,
 		unit_assert(ret != LDNS_RCODE_SERVFAIL);
 	} else {
 		perf_encode(&qi, rep, id, flags, out, timenow, &edns);
+		COMPRESSION_HASH = 1;
+		perf_encode(&qi, rep, id, flags, out, timenow, &edns);
+		COMPRESSION_HASH = 0;
 	} 
 
 	query_info_clear(&qi);
@@ -309,6 +319,27 @@ check_the_rrsigs(struct query_info* qinfo, struct reply_info* rep)
 	}
 }
 
+/** see if the compression hash encodes the same packet as the tree */
+static void
+test_compression_hash(struct query_info* qi, struct reply_info* rep,
+	uint16_t id, uint16_t flags, sldns_buffer* out, time_t timenow,
+	struct regional* region, uint16_t udpsize, struct edns_data* edns)
+{
+	sldns_buffer* out2 = sldns_buffer_new(sldns_buffer_capacity(out));
+	int ret;
+	unit_assert(out2);
+	COMPRESSION_HASH = 1;
+	ret = reply_info_encode(qi, rep, id, flags, out2, timenow, region,
+		udpsize, (int)(edns->bits & EDNS_DO));
+	COMPRESSION_HASH = 0;
+	unit_assert(ret != 0);
+	attach_edns_record(out2, edns);
+	unit_assert(sldns_buffer_limit(out) == sldns_buffer_limit(out2));
+	unit_assert(memcmp(sldns_buffer_begin(out), sldns_buffer_begin(out2),
+		sldns_buffer_limit(out)) == 0);
+	sldns_buffer_free(out2);
+}
+
 /** test a packet */
 static void
 testpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out, 
@@ -324,6 +355,15 @@ testpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out,
 	struct edns_data edns;
 
 	hex_to_buf(pkt, hex);
+	if(perf_corpus_num < PERF_CORPUS_MAX) {
+		perf_corpus[perf_corpus_num] = sldns_buffer_new(
+			sldns_buffer_limit(pkt));
+		unit_assert(perf_corpus[perf_corpus_num]);
+		sldns_buffer_write(perf_corpus[perf_corpus_num],
+			sldns_buffer_begin(pkt), sldns_buffer_limit(pkt));
+		sldns_buffer_flip(perf_corpus[perf_corpus_num]);
+		perf_corpus_num++;
+	}
 	memmove(&id, sldns_buffer_begin(pkt), sizeof(id));
 	if(sldns_buffer_limit(pkt) < 2)
 		flags = 0;
@@ -352,6 +392,8 @@ testpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out,
 			test_buffers(pkt, out);
 		if(check_rrsigs)
 			check_the_rrsigs(&qi, rep);
+		test_compression_hash(&qi, rep, id, flags, out, timenow,
+			region, 65535, &edns);
 
 		if(sldns_buffer_limit(out) > lim) {
 			ret = reply_info_encode(&qi, rep, id, flags, out, 
@@ -370,6 +412,9 @@ testpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out,
 				LDNS_TC_WIRE(sldns_buffer_begin(out)));
 				/* must set TC bit if shortened */
 			unit_assert(sldns_buffer_limit(out) <= lim);
+			test_compression_hash(&qi, rep, id, flags, out,
+				timenow, region,
+				lim - calc_edns_field_size(&edns), &edns);
 		}
 	} 
 
@@ -435,6 +480,49 @@ simpletest(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out)
 	);
 }
 
+/** performance test of parsing the packets from the testdata files */
+static void
+perf_parse_corpus(struct alloc_cache* alloc)
+{
+	struct query_info qi;
+	struct reply_info* rep;
+	struct edns_data edns;
+	struct regional* region = regional_create();
+	size_t rounds = 1000, i, j, bytes = 0;
+	struct timeval start, end;
+	double dt;
+	unit_assert(region);
+	for(j=0; j<perf_corpus_num; j++)
+		bytes += sldns_buffer_limit(perf_corpus[j]);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<rounds; i++) {
+		for(j=0; j<perf_corpus_num; j++) {
+			rep = NULL;
+			sldns_buffer_rewind(perf_corpus[j]);
+			if(reply_info_parse(perf_corpus[j], alloc, &qi, &rep,
+				region, &edns) == 0) {
+				query_info_clear(&qi);
+				reply_info_parsedelete(rep, alloc);
+			}
+			regional_free_all(region);
+		}
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	/* time in nanosec */
+	dt = (double)(end.tv_sec - start.tv_sec)*1000000000. + 
+		((double)end.tv_usec - (double)start.tv_usec)*1000.;
+	printf("parse of %u packets (%u bytes) %u times: %g ns/packet, "
+		"dname hash with %s\n", (unsigned)perf_corpus_num,
+		(unsigned)bytes, (unsigned)rounds,
+		dt / (double)(rounds*perf_corpus_num), dname_hash_impl());
+	regional_destroy(region);
+	for(j=0; j<perf_corpus_num; j++)
+		sldns_buffer_free(perf_corpus[j]);
+	perf_corpus_num = 0;
+}
+
 /** simple test of parsing, pcat file */
 static void
 testfromfile(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out,
@@ -533,6 +621,9 @@ void msgparse_test(void)
 	check_nosameness = 0;
 	check_rrsigs = 0;
 
+	/* parse speed over the packets of the files above */
+	perf_parse_corpus(&alloc);
+
 	/* cleanup */
 	alloc_clear(&alloc);
 	alloc_clear(&super_a);
@@ -45,29 +45,30 @@
 #include "util/data/dname.h"
 #include "testcode/unitmain.h"
 #include "validator/val_neg.h"
+#include "util/config_file.h"
 #include "sldns/rrdef.h"
 
 /** verbose unit test for negative cache */
 static int negverbose = 0;
 
 /** debug printout of neg cache */
-static void print_neg_cache(struct val_neg_cache* neg)
+static void print_neg_cache(struct val_neg_stripe* stripe)
 {
 	char buf[1024];
 	struct val_neg_zone* z;
 	struct val_neg_data* d;
 	printf("neg_cache print\n");
-	printf("memuse %d of %d\n", (int)neg->use, (int)neg->max);
-	printf("maxiter %d\n", (int)neg->nsec3_max_iter);
-	printf("%d zones\n", (int)neg->tree.count);
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
+	printf("memuse %d of %d\n", (int)stripe->use, (int)stripe->max);
+	printf("maxiter %d\n", (int)stripe->nsec3_max_iter);
+	printf("%d zones\n", (int)stripe->tree.count);
+	RBTREE_FOR(z, struct val_neg_zone*, &stripe->tree) {
 		dname_str(z->name, buf);
 		printf("%24s", buf);
 		printf(" len=%2.2d labs=%d inuse=%d count=%d tree.count=%d\n",
 			(int)z->len, z->labs, (int)z->in_use, z->count,
 			(int)z->tree.count);
 	}
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
+	RBTREE_FOR(z, struct val_neg_zone*, &stripe->tree) {
 		printf("\n");
 		dname_print(stdout, NULL, z->name);
 		printf(" zone details\n");
@@ -200,14 +201,16 @@ static void add_item(struct val_neg_cache* neg)
 	uint8_t* rr_data;
 	char* zname = get_random_zone();
 	char* from, *to;
+	struct val_neg_stripe* stripe = neg_zone_stripe(neg, (uint8_t*)zname,
+		LDNS_RR_CLASS_IN);
 
-	lock_basic_lock(&neg->lock);
+	lock_basic_lock(&stripe->lock);
 	if(negverbose)
 		log_nametypeclass(0, "add to zone", (uint8_t*)zname, 0, 0);
-	z = neg_find_zone(neg, (uint8_t*)zname, strlen(zname)+1, 
+	z = neg_find_zone(stripe, (uint8_t*)zname, strlen(zname)+1, 
 		LDNS_RR_CLASS_IN);
 	if(!z) {
-		z = neg_create_zone(neg,  (uint8_t*)zname, strlen(zname)+1,
+		z = neg_create_zone(stripe,  (uint8_t*)zname, strlen(zname)+1,
 		                LDNS_RR_CLASS_IN);
 	}
 	unit_assert(z);
@@ -233,8 +236,8 @@ static void add_item(struct val_neg_cache* neg)
 	rd.rr_data = &rr_data;
 	rr_data = (uint8_t*)to;
 
-	neg_insert_data(neg, z, &nsec);
-	lock_basic_unlock(&neg->lock);
+	neg_insert_data(stripe, z, &nsec);
+	lock_basic_unlock(&stripe->lock);
 }
 
 /** remove a random item */
@@ -244,21 +247,24 @@ static void remove_item(struct val_neg_cache* neg)
 	struct val_neg_data* d;
 	rbnode_type* walk;
 	struct val_neg_zone* z;
+	/* pick a random stripe */
+	struct val_neg_stripe* stripe = &neg->stripes[random() %
+		(int)neg->num_stripes];
 	
-	lock_basic_lock(&neg->lock);
-	if(neg->tree.count == 0) {
-		lock_basic_unlock(&neg->lock);
+	lock_basic_lock(&stripe->lock);
+	if(stripe->tree.count == 0) {
+		lock_basic_unlock(&stripe->lock);
 		return; /* nothing to delete */
 	}
 
 	/* pick a random zone */
-	walk = rbtree_first(&neg->tree); /* first highest parent, big count */
+	walk = rbtree_first(&stripe->tree); /* first highest parent, big count */
 	z = (struct val_neg_zone*)walk;
 	n = random() % (int)(z->count);
 	if(negverbose)
 		printf("neg stress delete zone %d\n", n);
 	i=0;
-	walk = rbtree_first(&neg->tree);
+	walk = rbtree_first(&stripe->tree);
 	z = (struct val_neg_zone*)walk;
 	while(i!=n+1 && walk && walk != RBTREE_NULL && !z->in_use) {
 		walk = rbtree_next(walk);
@@ -267,11 +273,11 @@ static void remove_item(struct val_neg_cache* neg)
 			i++;
 	}
 	if(!walk || walk == RBTREE_NULL) {
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&stripe->lock);
 		return;
 	}
 	if(!z->in_use) {
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&stripe->lock);
 		return;
 	}
 	if(negverbose)
@@ -293,35 +299,35 @@ static void remove_item(struct val_neg_cache* neg)
 			i++;
 	}
 	if(!walk || walk == RBTREE_NULL) {
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&stripe->lock);
 		return;
 	}
 	if(d->in_use) {
 		if(negverbose)
 			log_nametypeclass(0, "neg delete item:", d->name, 0, 0);
-		neg_delete_data(neg, d);
+		neg_delete_data(stripe, d);
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_basic_unlock(&stripe->lock);
 }
 
 /** sum up the zone trees */
-static size_t sumtrees_all(struct val_neg_cache* neg)
+static size_t sumtrees_all(struct val_neg_stripe* stripe)
 {
 	size_t res = 0;
 	struct val_neg_zone* z;
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
+	RBTREE_FOR(z, struct val_neg_zone*, &stripe->tree) {
 		res += z->tree.count;
 	}
 	return res;
 }
 
 /** sum up the zone trees, in_use only */
-static size_t sumtrees_inuse(struct val_neg_cache* neg)
+static size_t sumtrees_inuse(struct val_neg_stripe* stripe)
 {
 	size_t res = 0;
 	struct val_neg_zone* z;
 	struct val_neg_data* d;
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
+	RBTREE_FOR(z, struct val_neg_zone*, &stripe->tree) {
 		/* get count of highest parent for num in use */
 		d = (struct val_neg_data*)rbtree_first(&z->tree);
 		if(d && (rbnode_type*)d!=RBTREE_NULL)
@@ -331,32 +337,32 @@ static size_t sumtrees_inuse(struct val_neg_cache* neg)
 }
 
 /** check if lru is still valid */
-static void check_lru(struct val_neg_cache* neg)
+static void check_lru(struct val_neg_stripe* stripe)
 {
 	struct val_neg_data* p, *np;
 	size_t num = 0;
 	size_t inuse;
-	p = neg->first;
+	p = stripe->first;
 	while(p) {
 		if(!p->prev) {
-			unit_assert(neg->first == p);
+			unit_assert(stripe->first == p);
 		}
 		np = p->next;
 		if(np) {
 			unit_assert(np->prev == p);
 		} else {
-			unit_assert(neg->last == p);
+			unit_assert(stripe->last == p);
 		}
 		num++;
 		p = np;
 	}
-	inuse = sumtrees_inuse(neg);
+	inuse = sumtrees_inuse(stripe);
 	if(negverbose)
 		printf("num lru %d, inuse %d, all %d\n",
-			(int)num, (int)sumtrees_inuse(neg), 
-			(int)sumtrees_all(neg));
+			(int)num, (int)sumtrees_inuse(stripe), 
+			(int)sumtrees_all(stripe));
 	unit_assert( num == inuse);
-	unit_assert( inuse <= sumtrees_all(neg));
+	unit_assert( inuse <= sumtrees_all(stripe));
 }
 
 /** sum up number of items inuse in subtree */
@@ -375,12 +381,12 @@ static int sum_subtree_inuse(struct val_neg_zone* zone,
 }
 
 /** sum up number of items inuse in subtree */
-static int sum_zone_subtree_inuse(struct val_neg_cache* neg,
+static int sum_zone_subtree_inuse(struct val_neg_stripe* stripe,
 	struct val_neg_zone* zone)
 {
 	struct val_neg_zone* z;
 	int num = 0;
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
+	RBTREE_FOR(z, struct val_neg_zone*, &stripe->tree) {
 		if(dname_subdomain_c(z->name, zone->name)) {
 			if(z->in_use)
 				num++;
@@ -423,7 +429,7 @@ static void checkzonetree(struct val_neg_zone* zone)
 }
 
 /** check if negative cache is still valid */
-static void check_zone_invariants(struct val_neg_cache* neg, 
+static void check_zone_invariants(struct val_neg_stripe* stripe, 
 	struct val_neg_zone* zone)
 {
 	unit_assert(zone->nsec3_hash == 0);
@@ -440,7 +446,7 @@ static void check_zone_invariants(struct val_neg_cache* neg,
 				zone->in_use, zone->count, 
 				(int)zone->tree.count);
 			if(negverbose)
-				print_neg_cache(neg);
+				print_neg_cache(stripe);
 		}
 		unit_assert(zone->in_use);
 	}
@@ -460,40 +466,66 @@ static void check_zone_invariants(struct val_neg_cache* neg,
 		unit_assert(dname_is_root(zone->name));
 	}
 	/* tree property: */
-	unit_assert(zone->count == sum_zone_subtree_inuse(neg, zone));
+	unit_assert(zone->count == sum_zone_subtree_inuse(stripe, zone));
 
 	/* check structure of zone data tree */
 	checkzonetree(zone);
 }
 
-/** check if negative cache is still valid */
-static void check_neg_invariants(struct val_neg_cache* neg)
+/** check if a stripe of the negative cache is still valid */
+static void check_stripe_invariants(struct val_neg_cache* neg,
+	struct val_neg_stripe* stripe)
 {
 	struct val_neg_zone* z;
 	/* check structure of LRU list */
-	lock_basic_lock(&neg->lock);
-	check_lru(neg);
-	unit_assert(neg->max == 1024*1024);
-	unit_assert(neg->nsec3_max_iter == 1500);
-	unit_assert(neg->tree.cmp == &val_neg_zone_compare);
+	lock_basic_lock(&stripe->lock);
+	check_lru(stripe);
+	unit_assert(stripe->max == 1024*1024 / neg->num_stripes);
+	unit_assert(stripe->nsec3_max_iter == 1500);
+	unit_assert(stripe->tree.cmp == &val_neg_zone_compare);
 
-	if(neg->tree.count == 0) {
+	if(stripe->tree.count == 0) {
 		/* empty */
-		unit_assert(neg->tree.count == 0);
-		unit_assert(neg->first == NULL);
-		unit_assert(neg->last == NULL);
-		unit_assert(neg->use == 0);
-		lock_basic_unlock(&neg->lock);
+		unit_assert(stripe->tree.count == 0);
+		unit_assert(stripe->first == NULL);
+		unit_assert(stripe->last == NULL);
+		unit_assert(stripe->use == 0);
+		lock_basic_unlock(&stripe->lock);
 		return;
 	}
 
-	unit_assert(neg->first != NULL);
-	unit_assert(neg->last != NULL);
+	unit_assert(stripe->first != NULL);
+	unit_assert(stripe->last != NULL);
 
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
-		check_zone_invariants(neg, z);
+	RBTREE_FOR(z, struct val_neg_zone*, &stripe->tree) {
+		check_zone_invariants(stripe, z);
+		/* the in use zones are in the stripe for their name */
+		if(z->in_use) {
+			unit_assert(neg_zone_stripe(neg, z->name, z->dclass)
+				== stripe);
+		}
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_basic_unlock(&stripe->lock);
+}
+
+/** check if negative cache is still valid */
+static void check_neg_invariants(struct val_neg_cache* neg)
+{
+	size_t i;
+	unit_assert(neg->num_stripes > 0);
+	unit_assert(neg->mask == neg->num_stripes-1);
+	for(i=0; i<neg->num_stripes; i++)
+		check_stripe_invariants(neg, &neg->stripes[i]);
+}
+
+/** see if the negative cache has items */
+static int neg_has_items(struct val_neg_cache* neg)
+{
+	size_t i;
+	for(i=0; i<neg->num_stripes; i++)
+		if(neg->stripes[i].first)
+			return 1;
+	return 0;
 }
 
 /** perform stress test on insert and delete in neg cache */
@@ -511,13 +543,13 @@ static void stress_test(struct val_neg_cache* neg)
 	/* empty it */
 	if(negverbose)
 		printf("neg stress empty\n");
-	while(neg->first) {
+	while(neg_has_items(neg)) {
 		remove_item(neg);
 		check_neg_invariants(neg);
 	}
 	if(negverbose)
 		printf("neg stress emptied\n");
-	unit_assert(neg->first == NULL);
+	unit_assert(!neg_has_items(neg));
 	/* insert again */
 	for(i=0; i<100; i++) {
 		if(random() % 10 < 8)
@@ -530,14 +562,30 @@ static void stress_test(struct val_neg_cache* neg)
 void neg_test(void)
 {
 	struct val_neg_cache* neg;
+	struct config_file* cfg;
 	srandom(48);
 	unit_show_feature("negative cache");
 
 	/* create with defaults */
 	neg = val_neg_create(NULL, 1500);
 	unit_assert(neg);
+	unit_assert(neg->num_stripes == 1);
 	
 	stress_test(neg);
 
 	neg_cache_delete(neg);
+
+	/* create with the zones spread over stripes */
+	cfg = config_create();
+	unit_assert(cfg);
+	cfg->neg_cache_size = 1024*1024;
+	cfg->neg_cache_slabs = 4;
+	neg = val_neg_create(cfg, 1500);
+	unit_assert(neg);
+	unit_assert(neg->num_stripes == 4);
+
+	stress_test(neg);
+
+	neg_cache_delete(neg);
+	config_delete(cfg);
 }
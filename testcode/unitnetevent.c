@@ -0,0 +1,502 @@
+/*
+ * testcode/unitnetevent.c - unit test for the comm points.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+/**
+/**
+ * \file
+ * Unit test for the comm points in util/netevent.c, the pipelined queries
+ * on incoming TCP streams and the batches of UDP datagrams.  A client
+ * socket sends queries to a comm point on the loopback address, and the
+ * event loop is run in steps by a timer.
+ */
+#include "config.h"
+#include "testcode/unitmain.h"
+#include "util/netevent.h"
+#include "util/net_help.h"
+#include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
+
+/** verbosity for this test */
+static int vbmp = 0;
+
+/** max number of queries outstanding on a stream in the test */
+#define PIPE_MAX 3
+/** max number of queries outstanding on all streams in the test */
+#define PIPE_TOTAL 4
+/** max number of queries read in the test */
+#define PIPE_QUERIES 16
+/** msec between the steps of the test */
+#define STEP_MSEC 50
+
+/** max number of datagrams in a udp batch in the test */
+#define UDP_TEST_BATCH 4
+/** number of datagrams sent in the udp batch test */
+#define UDP_TEST_NUM 10
+
+/** state of the tcp pipeline test */
+struct pipe_test {
+	/** the comm base */
+	struct comm_base* base;
+	/** the step timer */
+	struct comm_timer* timer;
+	/** the spool buffer of the streams */
+	sldns_buffer* spool;
+	/** the client sockets */
+	int client_a, client_b;
+	/** the current step */
+	int step;
+	/** number of queries read by the comm point */
+	int num;
+	/** the IDs of the queries read */
+	uint16_t id[PIPE_QUERIES];
+	/** the reply info of the queries read */
+	struct comm_reply rep[PIPE_QUERIES];
+	/** number of closed stream callbacks */
+	int closed;
+};
+
+/** connect a client to the server, blocking with a receive timeout */
+static int
+client_connect(struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	struct timeval tv;
+	int s = (int)socket(AF_INET, SOCK_STREAM, 0);
+	unit_assert(s != -1);
+	tv.tv_sec = 1;
+	tv.tv_usec = 0;
+	unit_assert(setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, (void*)&tv,
+		(socklen_t)sizeof(tv)) == 0);
+	unit_assert(connect(s, (struct sockaddr*)addr, addrlen) == 0);
+	return s;
+}
+
+/** send queries, with the IDs from first to last, on the client */
+static void
+client_send(int s, uint16_t first, uint16_t last)
+{
+	uint8_t buf[(2+LDNS_HEADER_SIZE)*PIPE_QUERIES];
+	size_t len = 0;
+	uint16_t id;
+	memset(buf, 0, sizeof(buf));
+	for(id=first; id<=last; id++) {
+		sldns_write_uint16(buf+len, LDNS_HEADER_SIZE);
+		sldns_write_uint16(buf+len+2, id);
+		len += 2+LDNS_HEADER_SIZE;
+	}
+	unit_assert(send(s, (void*)buf, len, 0) == (ssize_t)len);
+}
+
+/** read an answer on the client, check its ID */
+static void
+client_read(int s, uint16_t id)
+{
+	uint8_t buf[2+LDNS_HEADER_SIZE];
+	unit_assert(recv(s, (void*)buf, sizeof(buf), MSG_WAITALL) ==
+		(ssize_t)sizeof(buf));
+	unit_assert(sldns_read_uint16(buf) == LDNS_HEADER_SIZE);
+	if(vbmp) printf("client read answer %d\n",
+		(int)sldns_read_uint16(buf+2));
+	unit_assert(sldns_read_uint16(buf+2) == id);
+	unit_assert(LDNS_QR_WIRE(buf+2));
+}
+
+/** the comm point read a query */
+static int
+pipe_query_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* repinfo)
+{
+	struct pipe_test* t = (struct pipe_test*)arg;
+	if(error != NETEVENT_NOERROR) {
+		t->closed++;
+		return 0;
+	}
+	unit_assert(sldns_buffer_limit(c->buffer) == LDNS_HEADER_SIZE);
+	unit_assert(t->num < PIPE_QUERIES);
+	t->id[t->num] = sldns_buffer_read_u16_at(c->buffer, 0);
+	t->rep[t->num] = *repinfo;
+	if(vbmp) printf("query %d read\n", (int)t->id[t->num]);
+	t->num++;
+	/* the query resolves, the answer is sent later */
+	return 0;
+}
+
+/** find the query with the ID */
+static int
+find_query(struct pipe_test* t, uint16_t id)
+{
+	int i;
+	for(i=0; i<t->num; i++)
+		if(t->id[i] == id)
+			return i;
+	unit_assert(0);
+	return -1;
+}
+
+/** check that the queries with the IDs from first to last were read */
+static void
+check_read(struct pipe_test* t, int num, uint16_t first, uint16_t last)
+{
+	uint16_t id;
+	unit_assert(t->num == num);
+	for(id=first; id<=last; id++)
+		(void)find_query(t, id);
+}
+
+/** the stream of a query */
+static struct tcp_req_info*
+query_req(struct pipe_test* t, uint16_t id)
+{
+	return t->rep[find_query(t, id)].c->tcp_req_info;
+}
+
+/** send the answer for a query, like the mesh, from the spool buffer */
+static void
+answer(struct pipe_test* t, uint16_t id)
+{
+	int i = find_query(t, id);
+	sldns_buffer_clear(t->spool);
+	sldns_buffer_write_u16(t->spool, id);
+	sldns_buffer_write_u16(t->spool, BIT_QR);
+	sldns_buffer_write_u16(t->spool, 0);
+	sldns_buffer_write_u16(t->spool, 0);
+	sldns_buffer_write_u16(t->spool, 0);
+	sldns_buffer_write_u16(t->spool, 0);
+	sldns_buffer_flip(t->spool);
+	comm_point_send_reply(&t->rep[i]);
+}
+
+/** the next step of the test, the event loop has run in between */
+static void
+pipe_step(void* arg)
+{
+	struct pipe_test* t = (struct pipe_test*)arg;
+	struct tcp_req_info* a, *b;
+	struct timeval tv;
+	if(vbmp) printf("step %d\n", t->step);
+	switch(t->step) {
+	case 0:
+		/* client a sent 5 queries, 3 are read */
+		check_read(t, PIPE_MAX, 1, 3);
+		a = query_req(t, 1);
+		unit_assert(a->num_open_req == 3 && a->num_done_req == 0);
+		client_send(t->client_b, 10, 12);
+		break;
+	case 1:
+		/* the first query of client b is read, also when the total
+		 * is used up, and the other queries have to wait */
+		check_read(t, PIPE_TOTAL, 10, 10);
+		/* answers in another order, the first is written, the
+		 * next waits in the write queue of the stream */
+		answer(t, 3);
+		answer(t, 1);
+		a = query_req(t, 1);
+		unit_assert(a->num_open_req == 1 && a->num_done_req == 1);
+		unit_assert(a->done_req_mem > 0);
+		break;
+	case 2:
+		/* the answers arrive in the order they were sent */
+		client_read(t->client_a, 3);
+		client_read(t->client_a, 1);
+		a = query_req(t, 1);
+		unit_assert(a->num_done_req == 0 && a->done_req_mem == 0);
+		/* client a now has room for queries 4 and 5 */
+		check_read(t, 6, 4, 5);
+		unit_assert(a->num_open_req == 3);
+		/* the stream of client b waits for its answer */
+		b = query_req(t, 10);
+		unit_assert(b->num_open_req == 1);
+		answer(t, 10);
+		break;
+	case 3:
+		client_read(t->client_b, 10);
+		/* after the answer, the next query of client b is read,
+		 * but not the one after it, the total is used up */
+		check_read(t, 7, 11, 11);
+		/* client a stops sending, the stream stays open for the
+		 * answers */
+		unit_assert(shutdown(t->client_a, SHUT_WR) == 0);
+		answer(t, 2);
+		break;
+	case 4:
+		client_read(t->client_a, 2);
+		a = query_req(t, 1);
+		unit_assert(a->read_is_closed);
+		unit_assert(a->num_open_req == 2);
+		unit_assert(t->closed == 0);
+		answer(t, 5);
+		answer(t, 4);
+		break;
+	case 5:
+		/* after the last answer the stream is closed */
+		client_read(t->client_a, 5);
+		client_read(t->client_a, 4);
+		unit_assert(t->closed == 1);
+		a = query_req(t, 1);
+		unit_assert(!a->read_is_closed && a->num_open_req == 0);
+		unit_assert(a->cp->fd == -1);
+		/* the answer for a closed stream is discarded */
+		answer(t, 1);
+		unit_assert(a->num_open_req == 0 && a->num_done_req == 0);
+		/* the answers for client b are written, and its
+		 * stream reads the last query */
+		answer(t, 11);
+		break;
+	case 6:
+		client_read(t->client_b, 11);
+		check_read(t, 8, 12, 12);
+		answer(t, 12);
+		break;
+	default:
+		client_read(t->client_b, 12);
+		comm_base_exit(t->base);
+		return;
+	}
+	t->step++;
+	tv.tv_sec = 0;
+	tv.tv_usec = STEP_MSEC*1000;
+	comm_timer_set(t->timer, &tv);
+}
+
+/** test pipelined queries on tcp streams, and the limits for them */
+static void
+tcp_pipeline_test(void)
+{
+	struct pipe_test t;
+	struct comm_point_testcb cb;
+	struct comm_point* acc;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct timeval tv;
+	int s;
+
+	unit_show_func("util/netevent.c", "tcp_req_info_send_reply");
+	memset(&t, 0, sizeof(t));
+	cb.point_cb = &pipe_query_cb;
+	cb.timer_cb = &pipe_step;
+	cb.arg = &t;
+	t.base = comm_base_create(0);
+	unit_assert(t.base);
+	t.spool = sldns_buffer_new(512);
+	unit_assert(t.spool);
+	t.timer = comm_timer_create(t.base, &test_comm_timer_cb, &cb);
+	unit_assert(t.timer);
+
+	s = (int)socket(AF_INET, SOCK_STREAM, 0);
+	unit_assert(s != -1);
+	unit_assert(ipstrtoaddr("127.0.0.1", 0, &addr, &addrlen));
+	unit_assert(bind(s, (struct sockaddr*)&addr, addrlen) == 0);
+	unit_assert(getsockname(s, (struct sockaddr*)&addr, &addrlen) == 0);
+	unit_assert(listen(s, 4) == 0);
+	fd_set_nonblock(s);
+	acc = comm_point_create_tcp(t.base, s, 2, 512, &test_comm_point_cb,
+		&cb);
+	unit_assert(acc);
+	unit_assert(comm_point_set_tcp_pipeline(acc, t.spool, PIPE_MAX,
+		PIPE_TOTAL));
+
+	t.client_a = client_connect(&addr, addrlen);
+	t.client_b = client_connect(&addr, addrlen);
+	client_send(t.client_a, 1, 5);
+	tv.tv_sec = 0;
+	tv.tv_usec = STEP_MSEC*1000;
+	comm_timer_set(t.timer, &tv);
+	comm_base_dispatch(t.base);
+	unit_assert(t.step == 7);
+
+	close(t.client_a);
+	close(t.client_b);
+	comm_point_delete(acc);
+	comm_timer_delete(t.timer);
+	sldns_buffer_free(t.spool);
+	comm_base_delete(t.base);
+}
+
+/** state of the udp batch test */
+struct udp_test {
+	/** the comm base */
+	struct comm_base* base;
+	/** if the datagrams have the interface in the ancillary data */
+	int ancil;
+	/** the address of the client */
+	struct sockaddr_storage client;
+	/** length of the client address */
+	socklen_t clientlen;
+	/** number of datagrams read by the comm point */
+	int num;
+};
+
+/** the comm point read a datagram, the ID tells if it gets a reply */
+static int
+udp_query_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* repinfo)
+{
+	struct udp_test* t = (struct udp_test*)arg;
+	unit_assert(error == NETEVENT_NOERROR);
+	unit_assert(sldns_buffer_limit(c->buffer) == LDNS_HEADER_SIZE);
+	/* the datagrams are read in the order they are sent */
+	unit_assert(sldns_buffer_read_u16_at(c->buffer, 0) == t->num);
+	unit_assert(repinfo->c == c);
+	unit_assert(repinfo->addrlen == t->clientlen &&
+		memcmp(&repinfo->addr, &t->client, t->clientlen) == 0);
+	if(t->ancil)
+		unit_assert(repinfo->srctype == 4);
+	t->num++;
+	if(sldns_buffer_read_u16_at(c->buffer, 0)%3 == 0)
+		return 0; /* no reply */
+	LDNS_QR_SET(sldns_buffer_begin(c->buffer));
+	return 1;
+}
+
+/** the datagrams have been read */
+static void
+udp_done(void* arg)
+{
+	struct udp_test* t = (struct udp_test*)arg;
+	comm_base_exit(t->base);
+}
+
+/** test datagrams read in batches with recvmmsg, and the replies that
+ * are sent with sendmmsg; with and without the interface of the query */
+static void
+udp_batch_test(int ancil)
+{
+	struct udp_test t;
+	struct comm_point_testcb cb;
+	struct comm_point* c;
+	struct comm_timer* timer;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	sldns_buffer* buf;
+	uint8_t pkt[LDNS_HEADER_SIZE];
+	struct timeval tv;
+	int s, cl, i;
+
+	memset(&t, 0, sizeof(t));
+	t.ancil = ancil;
+	cb.point_cb = &udp_query_cb;
+	cb.timer_cb = &udp_done;
+	cb.arg = &t;
+	t.base = comm_base_create(0);
+	unit_assert(t.base);
+	buf = sldns_buffer_new(512);
+	unit_assert(buf);
+	timer = comm_timer_create(t.base, &test_comm_timer_cb, &cb);
+	unit_assert(timer);
+
+	s = (int)socket(AF_INET, SOCK_DGRAM, 0);
+	unit_assert(s != -1);
+	unit_assert(ipstrtoaddr("127.0.0.1", 0, &addr, &addrlen));
+	unit_assert(bind(s, (struct sockaddr*)&addr, addrlen) == 0);
+	unit_assert(getsockname(s, (struct sockaddr*)&addr, &addrlen) == 0);
+	fd_set_nonblock(s);
+	if(ancil) {
+#ifdef IP_PKTINFO
+		int on = 1;
+		unit_assert(setsockopt(s, IPPROTO_IP, IP_PKTINFO, (void*)&on,
+			(socklen_t)sizeof(on)) == 0);
+#endif
+		c = comm_point_create_udp_ancil(t.base, s, buf,
+			&test_comm_point_cb, &cb);
+	} else	c = comm_point_create_udp(t.base, s, buf,
+			&test_comm_point_cb, &cb);
+	unit_assert(c);
+	unit_assert(comm_point_set_udp_batch(c, UDP_TEST_BATCH));
+
+	/* the client sends the datagrams before the event loop runs */
+	cl = (int)socket(AF_INET, SOCK_DGRAM, 0);
+	unit_assert(cl != -1);
+	unit_assert(ipstrtoaddr("127.0.0.1", 0, &t.client, &t.clientlen));
+	unit_assert(bind(cl, (struct sockaddr*)&t.client, t.clientlen) == 0);
+	unit_assert(getsockname(cl, (struct sockaddr*)&t.client,
+		&t.clientlen) == 0);
+	memset(pkt, 0, sizeof(pkt));
+	for(i=0; i<UDP_TEST_NUM; i++) {
+		sldns_write_uint16(pkt, (uint16_t)i);
+		unit_assert(sendto(cl, (void*)pkt, sizeof(pkt), 0,
+			(struct sockaddr*)&addr, addrlen) ==
+			(ssize_t)sizeof(pkt));
+	}
+	tv.tv_sec = 0;
+	tv.tv_usec = 50*1000;
+	comm_timer_set(timer, &tv);
+	comm_base_dispatch(t.base);
+	unit_assert(t.num == UDP_TEST_NUM);
+
+	/* the replies arrive in order, from the server address */
+	for(i=0; i<UDP_TEST_NUM; i++) {
+		struct sockaddr_storage from;
+		socklen_t fromlen = (socklen_t)sizeof(from);
+		if(i%3 == 0)
+			continue;
+		unit_assert(recvfrom(cl, (void*)pkt, sizeof(pkt), 0,
+			(struct sockaddr*)&from, &fromlen) ==
+			(ssize_t)sizeof(pkt));
+		unit_assert(sldns_read_uint16(pkt) == (uint16_t)i);
+		unit_assert(LDNS_QR_WIRE(pkt));
+		unit_assert(fromlen == addrlen &&
+			memcmp(&from, &addr, addrlen) == 0);
+	}
+	fd_set_nonblock(cl);
+	unit_assert(recv(cl, (void*)pkt, sizeof(pkt), 0) == -1);
+
+	/* the batch fill statistics: full batches, and then the rest */
+	if(vbmp) printf("udp batch: %d datagrams in %d batches\n",
+		(int)c->udp_batch_pkts, (int)c->udp_batch_count);
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG) && !defined(USE_WINSOCK)
+	unit_assert(c->udp_batch_count == (UDP_TEST_NUM+UDP_TEST_BATCH-1)/
+		UDP_TEST_BATCH);
+	unit_assert(c->udp_batch_pkts == UDP_TEST_NUM);
+#else
+	unit_assert(c->udp_batch_count == 0 && c->udp_batch_pkts == 0);
+#endif
+
+	close(cl);
+	comm_point_delete(c);
+	comm_timer_delete(timer);
+	sldns_buffer_free(buf);
+	comm_base_delete(t.base);
+}
+
+void
+netevent_test(void)
+{
+	unit_show_feature("comm point");
+	tcp_pipeline_test();
+	unit_show_func("util/netevent.c", "udp_batch_callback");
+	udp_batch_test(0);
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_RECVMSG) && defined(IP_PKTINFO)
+	unit_show_func("util/netevent.c", "udp_send_set_ancil");
+	udp_batch_test(1);
+#endif
+}
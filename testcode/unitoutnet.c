@@ -0,0 +1,918 @@
+/*
+ * testcode/unitoutnet.c - unit test for the outside network.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * \file
+ * Unit test for the outside network, the udp query batches, the port
+ * pool and the reuse of tcp streams.  The queries are sent to a socket on
+ * the loopback address, that the test reads.
+ */
+#include "config.h"
+#include "testcode/unitmain.h"
+#include "services/outside_network.h"
+#include "util/netevent.h"
+#include "util/net_help.h"
+#include "util/random.h"
+#include "util/rbtree.h"
+#include "sldns/sbuffer.h"
+#include "sldns/str2wire.h"
+#include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
+
+/** verbosity for this test */
+static int vbmp = 0;
+
+/** first port of the permitted ports of the test */
+#define TEST_PORT_START 20000
+/** number of permitted ports of the test */
+#define TEST_PORT_NUM 40000
+/** number of outgoing udp sockets of the test */
+#define TEST_NUM_FDS 64
+/** number of permitted ports of the port pool test */
+#define TEST_POOL_PORTS 16
+/** number of ports in the pool of the port pool test */
+#define TEST_POOL_SIZE 8
+/** number of queries on a pool port of the port pool test */
+#define TEST_POOL_USES 5
+/** number of queries of the port pool test */
+#define TEST_POOL_QUERIES 40
+/** msec an idle tcp stream is kept open in the reuse test */
+#define TEST_REUSE_TIMEOUT 200
+/** max queries on a tcp stream in the reuse test */
+#define TEST_REUSE_MAX 3
+/** number of tcp queries of the reuse test, numbered from 1 */
+#define TEST_REUSE_QUERIES 8
+/** number of streams the server accepts in the reuse test */
+#define TEST_REUSE_CONNS 4
+
+/** make the list of permitted ports */
+static int*
+make_ports(void)
+{
+	int i;
+	int* ports = (int*)malloc(sizeof(int)*TEST_PORT_NUM);
+	unit_assert(ports);
+	for(i=0; i<TEST_PORT_NUM; i++)
+		ports[i] = TEST_PORT_START + i;
+	return ports;
+}
+
+/** make an outside network, ipv4 only, sends from 0.0.0.0 */
+static struct outside_network*
+make_outnet(struct comm_base* base, struct ub_randstate* rnd, int* ports,
+	int num_ports, int udp_batch, int port_pool, int port_pool_uses)
+{
+	struct outside_network* outnet = outside_network_create(base, 4096,
+		TEST_NUM_FDS, NULL, 0, 1, 0, 0, NULL, rnd, 0, ports,
+		num_ports, 0, 0, NULL, NULL, 1, NULL, 0, NULL, 0, 1,
+		udp_batch, port_pool, port_pool_uses);
+	unit_assert(outnet);
+	return outnet;
+}
+
+/** make the server socket on the loopback address, nonblocking */
+static int
+make_server(struct sockaddr_storage* addr, socklen_t* addrlen)
+{
+	int s = (int)socket(AF_INET, SOCK_DGRAM, 0);
+	unit_assert(s != -1);
+	unit_assert(ipstrtoaddr("127.0.0.1", 0, addr, addrlen));
+	unit_assert(bind(s, (struct sockaddr*)addr, *addrlen) == 0);
+	unit_assert(getsockname(s, (struct sockaddr*)addr, addrlen) == 0);
+	fd_set_nonblock(s);
+	return s;
+}
+
+/**
+ * Read the queries that arrived at the server.  Each one must have the ID
+ * of a pending query, and come from the port of that pending query.
+ * @param s: server socket.
+ * @param outnet: the pending queries are in it.
+ * @param addr: server address, the pending queries are sent to it.
+ * @param addrlen: length of addr.
+ * @param srcports: the source ports are stored in here.
+ * @param max: size of srcports.
+ * @return number of queries read.
+ */
+static int
+server_recv(int s, struct outside_network* outnet,
+	struct sockaddr_storage* addr, socklen_t addrlen, int* srcports,
+	int max)
+{
+	uint8_t buf[512];
+	struct sockaddr_storage from;
+	socklen_t fromlen;
+	struct pending key, *p;
+	ssize_t r;
+	int num = 0;
+	while(1) {
+		fromlen = (socklen_t)sizeof(from);
+		r = recvfrom(s, (void*)buf, sizeof(buf), 0,
+			(struct sockaddr*)&from, &fromlen);
+		if(r == -1)
+			break;
+		unit_assert(r >= LDNS_HEADER_SIZE);
+		key.id = (unsigned)sldns_read_uint16(buf);
+		memcpy(&key.addr, addr, addrlen);
+		key.addrlen = addrlen;
+		p = (struct pending*)rbtree_search(outnet->pending, &key);
+		unit_assert(p && p->pc);
+		unit_assert(p->pc->number ==
+			(int)ntohs(((struct sockaddr_in*)&from)->sin_port));
+		unit_assert(num < max);
+		srcports[num++] = p->pc->number;
+	}
+	return num;
+}
+
+/** make the query packet for qNUM.example.com. A */
+static void
+make_query(sldns_buffer* pkt, int num)
+{
+	char nm[64];
+	uint8_t qname[LDNS_MAX_DOMAINLEN+1];
+	size_t qname_len = sizeof(qname);
+
+	snprintf(nm, sizeof(nm), "q%d.example.com.", num);
+	unit_assert(sldns_str2wire_dname_buf(nm, qname, &qname_len) == 0);
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, 0); /* id */
+	sldns_buffer_write_u16(pkt, 0); /* flags */
+	sldns_buffer_write_u16(pkt, 1); /* qdcount */
+	sldns_buffer_write_u16(pkt, 0); /* ancount */
+	sldns_buffer_write_u16(pkt, 0); /* nscount */
+	sldns_buffer_write_u16(pkt, 0); /* arcount */
+	sldns_buffer_write(pkt, qname, qname_len);
+	sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_A);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	sldns_buffer_flip(pkt);
+}
+
+/**
+ * Make a serviced query and send its pending udp query.  The serviced
+ * query has no callbacks, so the pending query callback, when it is made,
+ * deletes it from the serviced tree.
+ */
+static struct serviced_query*
+make_sq(struct outside_network* outnet, int num,
+	struct sockaddr_storage* addr, socklen_t addrlen, sldns_buffer* pkt)
+{
+	struct serviced_query* sq;
+
+	make_query(pkt, num);
+	sq = (struct serviced_query*)calloc(1, sizeof(*sq));
+	unit_assert(sq);
+	sq->node.key = sq;
+	sq->qbuflen = sldns_buffer_limit(pkt) - 2;
+	sq->qbuf = memdup(sldns_buffer_at(pkt, 2), sq->qbuflen);
+	sq->zone = memdup("\007example\003com", 13);
+	unit_assert(sq->qbuf && sq->zone);
+	sq->zonelen = 13;
+	sq->qtype = LDNS_RR_TYPE_A;
+	sq->status = serviced_query_UDP;
+	memcpy(&sq->addr, addr, addrlen);
+	sq->addrlen = addrlen;
+	sq->outnet = outnet;
+	unit_assert(rbtree_insert(outnet->serviced, &sq->node));
+	sq->pending = pending_udp_query(sq, pkt, 5000, &serviced_udp_callback,
+		sq);
+	unit_assert(sq->pending);
+	return sq;
+}
+
+/** count the different values in the array */
+static int
+count_distinct(int* a, int num)
+{
+	int i, j, n = 0;
+	for(i=0; i<num; i++) {
+		for(j=0; j<i; j++)
+			if(a[j] == a[i])
+				break;
+		if(j == i)
+			n++;
+	}
+	return n;
+}
+
+/** test that sendmmsg sends more than UDP_SEND_MAX messages in chunks */
+static void
+send_msgs_test(void)
+{
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct comm_point c;
+	sldns_buffer* bufs[UDP_SEND_MAX+4];
+	uint8_t buf[64];
+	int i, s, num = UDP_SEND_MAX+4;
+	ssize_t r;
+
+	unit_show_func("util/netevent.c", "comm_point_send_udp_msgs");
+	s = make_server(&addr, &addrlen);
+	memset(&c, 0, sizeof(c));
+	c.fd = (int)socket(AF_INET, SOCK_DGRAM, 0);
+	unit_assert(c.fd != -1);
+	for(i=0; i<num; i++) {
+		bufs[i] = sldns_buffer_new(16);
+		unit_assert(bufs[i]);
+		sldns_buffer_write_u32(bufs[i], (uint32_t)i);
+		sldns_buffer_flip(bufs[i]);
+	}
+	unit_assert(comm_point_send_udp_msgs(&c, bufs, num,
+		(struct sockaddr*)&addr, addrlen) == num);
+	/* they arrive in order */
+	for(i=0; i<num; i++) {
+		r = recv(s, (void*)buf, sizeof(buf), 0);
+		unit_assert(r == 4);
+		unit_assert(sldns_read_uint32(buf) == (uint32_t)i);
+	}
+	unit_assert(recv(s, (void*)buf, sizeof(buf), 0) == -1);
+
+	for(i=0; i<num; i++)
+		sldns_buffer_free(bufs[i]);
+	close(c.fd);
+	close(s);
+}
+
+/** test the udp batch: send per server, and the callback on failure */
+static void
+batch_test(void)
+{
+	struct comm_base* base;
+	struct ub_randstate* rnd;
+	struct outside_network* outnet;
+	struct sockaddr_storage addr, addr6;
+	socklen_t addrlen, addr6len;
+	sldns_buffer* pkt;
+	int srcports[64];
+	int i, s, num4 = UDP_SEND_MAX+4, num6 = 3;
+	int* ports;
+
+	unit_show_func("services/outside_network.c", "outnet_udp_batch_cb");
+	base = comm_base_create(0);
+	unit_assert(base);
+	rnd = ub_initstate(42, NULL);
+	unit_assert(rnd);
+	ports = make_ports();
+	outnet = make_outnet(base, rnd, ports, TEST_PORT_NUM, 1, 0, 0);
+	pkt = sldns_buffer_new(512);
+	unit_assert(pkt);
+	s = make_server(&addr, &addrlen);
+	/* there is no ip6 outgoing interface, these queries fail */
+	unit_assert(ipstrtoaddr("::1", 53, &addr6, &addr6len));
+
+	for(i=0; i<num4; i++) {
+		(void)make_sq(outnet, i, &addr, addrlen, pkt);
+		if(i == 2) {
+			int j;
+			for(j=0; j<num6; j++)
+				(void)make_sq(outnet, 100+j, &addr6, addr6len,
+					pkt);
+		}
+	}
+	/* the queries wait for the batch, nothing is sent yet */
+	unit_assert(outnet->batch_first != NULL);
+	unit_assert(outnet->serviced->count == (size_t)(num4+num6));
+	unit_assert(outnet->pending->count == 0);
+	unit_assert(server_recv(s, outnet, &addr, addrlen, srcports, 64)
+		== 0);
+	if(vbmp) printf("send batch of %d queries\n", num4+num6);
+
+	outnet_udp_batch_cb(outnet);
+
+	/* the queries to the server are sent in groups of UDP_SEND_MAX,
+	 * a port and a send call per group */
+	unit_assert(outnet->num_udp_batch_sends == 2);
+	unit_assert(outnet->num_udp_batched == (size_t)num4);
+	unit_assert(outnet->pending->count == (size_t)num4);
+	unit_assert(server_recv(s, outnet, &addr, addrlen, srcports, 64)
+		== num4);
+	unit_assert(count_distinct(srcports, num4) <= 2);
+	unit_assert(count_distinct(srcports, UDP_SEND_MAX) == 1);
+	/* the failed queries got the NETEVENT_CLOSED callback, that
+	 * deleted their serviced queries */
+	unit_assert(outnet->serviced->count == (size_t)num4);
+	unit_assert(outnet->batch_first == NULL);
+	unit_assert(outnet->batch_last == NULL);
+	unit_assert(outnet->batch_fail == NULL);
+
+	/* deletes the serviced queries and the pending queries */
+	outside_network_delete(outnet);
+	close(s);
+	sldns_buffer_free(pkt);
+	free(ports);
+	ub_randfree(rnd);
+	comm_base_delete(base);
+}
+
+/**
+ * Take the IDs for queries to the server, so that select_id fails on them.
+ * @param outnet: the pending tree is in it.
+ * @param taken: array of 0x10000 pending elements, entered in the tree.
+ * @param addr: server address.
+ * @param addrlen: length of addr.
+ * @param free_ids: this number of IDs, from 0, are not taken.
+ */
+static void
+take_ids(struct outside_network* outnet, struct pending* taken,
+	struct sockaddr_storage* addr, socklen_t addrlen, int free_ids)
+{
+	int i;
+	for(i=free_ids; i<0x10000; i++) {
+		taken[i].node.key = &taken[i];
+		taken[i].id = (unsigned)i;
+		memcpy(&taken[i].addr, addr, addrlen);
+		taken[i].addrlen = addrlen;
+		unit_assert(rbtree_insert(outnet->pending, &taken[i].node));
+	}
+}
+
+/** remove the taken IDs from the pending tree again */
+static void
+release_ids(struct outside_network* outnet, struct pending* taken,
+	int free_ids)
+{
+	int i;
+	for(i=free_ids; i<0x10000; i++)
+		unit_assert(rbtree_delete(outnet->pending, &taken[i]));
+}
+
+/** test a udp batch where the first query, or all, fail to get an ID */
+static void
+batch_fail_test(void)
+{
+	struct comm_base* base;
+	struct ub_randstate* rnd;
+	struct outside_network* outnet;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	sldns_buffer* pkt;
+	struct pending* taken;
+	int srcports[64];
+	int i, s, num = 4, free_ids = 16, got;
+	int* ports;
+
+	unit_show_func("services/outside_network.c", "batch_send_group");
+	base = comm_base_create(0);
+	unit_assert(base);
+	rnd = ub_initstate(42, NULL);
+	unit_assert(rnd);
+	ports = make_ports();
+	outnet = make_outnet(base, rnd, ports, TEST_PORT_NUM, 1, 0, 0);
+	pkt = sldns_buffer_new(512);
+	unit_assert(pkt);
+	s = make_server(&addr, &addrlen);
+	taken = (struct pending*)calloc(0x10000, sizeof(*taken));
+	unit_assert(taken);
+
+	/* every ID is taken, the first query of the group fails, and
+	 * then all the others, on the port that it selected */
+	take_ids(outnet, taken, &addr, addrlen, 0);
+	for(i=0; i<num; i++)
+		(void)make_sq(outnet, i, &addr, addrlen, pkt);
+	outnet_udp_batch_cb(outnet);
+	unit_assert(outnet->num_udp_batch_sends == 0);
+	unit_assert(outnet->num_udp_batched == 0);
+	unit_assert(outnet->serviced->count == 0);
+	unit_assert(outnet->pending->count == 0x10000);
+	unit_assert(outnet->batch_fail == NULL);
+	/* the port is closed after the queries failed */
+	unit_assert(outnet->num_udp_open == 0);
+	unit_assert(outnet->ip4_ifs[0].inuse == 0);
+	unit_assert(server_recv(s, outnet, &addr, addrlen, srcports, 64)
+		== 0);
+	release_ids(outnet, taken, 0);
+
+	/* a few IDs are free, some queries get one and are sent, the
+	 * others fail, the port stays open for the sent queries */
+	take_ids(outnet, taken, &addr, addrlen, free_ids);
+	for(i=0; i<num; i++)
+		(void)make_sq(outnet, i, &addr, addrlen, pkt);
+	outnet_udp_batch_cb(outnet);
+	got = server_recv(s, outnet, &addr, addrlen, srcports, 64);
+	if(vbmp) printf("%d of %d queries got a free ID\n", got, num);
+	unit_assert(got <= free_ids);
+	unit_assert(outnet->num_udp_batched == (size_t)got);
+	unit_assert(outnet->num_udp_batch_sends == (got?1:0));
+	unit_assert(outnet->serviced->count == (size_t)got);
+	unit_assert(outnet->pending->count == (size_t)(0x10000-free_ids+got));
+	unit_assert(outnet->batch_fail == NULL);
+	unit_assert(outnet->num_udp_open == (got?1:0));
+	if(got) {
+		unit_assert(count_distinct(srcports, got) == 1);
+		unit_assert(outnet->ip4_ifs[0].out[0]->num_outstanding == got);
+	}
+	release_ids(outnet, taken, free_ids);
+
+	outside_network_delete(outnet);
+	close(s);
+	free(taken);
+	sldns_buffer_free(pkt);
+	free(ports);
+	ub_randfree(rnd);
+	comm_base_delete(base);
+}
+
+/** find the open port_comm for the port number, or NULL */
+static struct port_comm*
+find_open_port(struct port_if* pif, int number)
+{
+	int i;
+	for(i=0; i<pif->inuse; i++)
+		if(pif->out[i]->number == number)
+			return pif->out[i];
+	return NULL;
+}
+
+/** check the open ports of the interface, and the use counts */
+static void
+pool_check_open(struct outside_network* outnet, struct port_if* pif)
+{
+	int i;
+	unit_assert(pif->inuse == outnet->num_udp_open);
+	for(i=0; i<pif->inuse; i++) {
+		unit_assert(pif->out[i]->index == i);
+		unit_assert(pif->out[i]->pif == pif);
+		unit_assert(pif->out[i]->num_outstanding >= 0);
+	}
+}
+
+/** test the port pool: queries use the pool ports, that rotate */
+static void
+pool_test(void)
+{
+	struct comm_base* base;
+	struct ub_randstate* rnd;
+	struct outside_network* outnet;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	sldns_buffer* pkt;
+	struct serviced_query* sqs[TEST_POOL_QUERIES], *extra;
+	int poolports[TEST_POOL_SIZE], srcports[TEST_POOL_QUERIES];
+	int i, j, s, inpool;
+	int* ports;
+	struct port_if* pif;
+	struct port_comm* pc;
+
+	unit_show_func("services/outside_network.c", "select_ifport");
+	base = comm_base_create(0);
+	unit_assert(base);
+	rnd = ub_initstate(42, NULL);
+	unit_assert(rnd);
+	ports = make_ports();
+	outnet = make_outnet(base, rnd, ports, TEST_POOL_PORTS, 0,
+		TEST_POOL_SIZE, TEST_POOL_USES);
+	pkt = sldns_buffer_new(512);
+	unit_assert(pkt);
+	s = make_server(&addr, &addrlen);
+	pif = &outnet->ip4_ifs[0];
+
+	/* the pool is opened at the start */
+	unit_assert(outnet->port_pool == TEST_POOL_SIZE);
+	unit_assert(outnet->num_pool_open == TEST_POOL_SIZE);
+	unit_assert(outnet->num_udp_open == TEST_POOL_SIZE);
+	unit_assert(pif->pool_num == TEST_POOL_SIZE);
+	pool_check_open(outnet, pif);
+	for(i=0; i<TEST_POOL_SIZE; i++) {
+		unit_assert(pif->pool[i]->pool_index == i);
+		unit_assert(pif->pool[i]->is_pool);
+		unit_assert(pif->pool[i]->num_uses == 0);
+		unit_assert(pif->pool[i]->num_outstanding == 0);
+		poolports[i] = pif->pool[i]->number;
+	}
+
+	/* the queries use the pool ports, the uses of the pool are
+	 * TEST_POOL_QUERIES, after that all the ports are retired */
+	for(i=0; i<TEST_POOL_QUERIES; i++) {
+		sqs[i] = make_sq(outnet, i, &addr, addrlen, pkt);
+		srcports[i] = ((struct pending*)sqs[i]->pending)->pc->number;
+		inpool = 0;
+		for(j=0; j<TEST_POOL_SIZE; j++)
+			if(poolports[j] == srcports[i])
+				inpool = 1;
+		unit_assert(inpool);
+	}
+	if(vbmp) printf("%d queries on %d pool ports\n", TEST_POOL_QUERIES,
+		count_distinct(srcports, TEST_POOL_QUERIES));
+	unit_assert(server_recv(s, outnet, &addr, addrlen, srcports,
+		TEST_POOL_QUERIES) == TEST_POOL_QUERIES);
+	unit_assert(pif->pool_num == 0);
+	unit_assert(outnet->num_pool_open == TEST_POOL_SIZE);
+	unit_assert(outnet->num_udp_open == TEST_POOL_SIZE);
+	pool_check_open(outnet, pif);
+	for(j=0; j<TEST_POOL_SIZE; j++) {
+		pc = find_open_port(pif, poolports[j]);
+		unit_assert(pc && pc->is_pool && pc->pool_index == -1);
+		unit_assert(pc->num_uses == TEST_POOL_USES);
+		unit_assert(pc->num_outstanding == TEST_POOL_USES);
+	}
+
+	/* with the pool retired, a query picks a random port of the
+	 * range, as without the pool, that is closed when it is done */
+	extra = make_sq(outnet, TEST_POOL_QUERIES, &addr, addrlen, pkt);
+	pc = ((struct pending*)extra->pending)->pc;
+	unit_assert(pc->pool_index == -1);
+	unit_assert(outnet->num_udp_open == TEST_POOL_SIZE +
+		(pc->is_pool?0:1));
+	outnet_serviced_query_stop(extra, NULL);
+	unit_assert(outnet->num_udp_open == TEST_POOL_SIZE);
+	unit_assert(pif->pool_num == 0);
+
+	/* when the queries are done, the retired ports are closed and
+	 * replaced by new random ports */
+	for(i=0; i<TEST_POOL_QUERIES; i++)
+		outnet_serviced_query_stop(sqs[i], NULL);
+	unit_assert(outnet->pending->count == 0);
+	unit_assert(outnet->num_pool_open == TEST_POOL_SIZE);
+	unit_assert(outnet->num_udp_open == TEST_POOL_SIZE);
+	unit_assert(pif->pool_num == TEST_POOL_SIZE);
+	pool_check_open(outnet, pif);
+	for(i=0; i<pif->inuse; i++) {
+		unit_assert(pif->out[i]->is_pool);
+		unit_assert(pif->out[i]->num_outstanding == 0);
+		unit_assert(pif->out[i]->num_uses == 0);
+	}
+
+	/* one query at a time, every query uses a pool port, and the
+	 * pool rotates over the port range */
+	for(i=0; i<TEST_POOL_QUERIES; i++) {
+		struct serviced_query* sq = make_sq(outnet, i, &addr,
+			addrlen, pkt);
+		pc = ((struct pending*)sq->pending)->pc;
+		unit_assert(pc->is_pool);
+		unit_assert(pc->num_outstanding == 1);
+		srcports[i] = pc->number;
+		outnet_serviced_query_stop(sq, NULL);
+		unit_assert(outnet->num_udp_open == TEST_POOL_SIZE);
+		unit_assert(pif->pool_num == TEST_POOL_SIZE);
+		pool_check_open(outnet, pif);
+	}
+	if(vbmp) printf("%d queries one at a time on %d ports\n",
+		TEST_POOL_QUERIES, count_distinct(srcports,
+		TEST_POOL_QUERIES));
+	unit_assert(count_distinct(srcports, TEST_POOL_QUERIES) >
+		TEST_POOL_SIZE);
+
+	outside_network_delete(outnet);
+	close(s);
+	sldns_buffer_free(pkt);
+	free(ports);
+	ub_randfree(rnd);
+	comm_base_delete(base);
+}
+
+/** state of the tcp stream reuse test */
+struct reuse_test {
+	/** the outside network */
+	struct outside_network* outnet;
+	/** the step timer */
+	struct comm_timer* timer;
+	/** the callbacks, with the test as argument */
+	struct comm_point_testcb* cb;
+	/** buffer for the query packets */
+	sldns_buffer* pkt;
+	/** the destination of the queries */
+	struct serviced_query sq;
+	/** the listening socket of the server */
+	int listen;
+	/** the accepted streams of the server */
+	int conn[TEST_REUSE_CONNS];
+	/** the streams of the queries */
+	struct pending_tcp* stream[TEST_REUSE_QUERIES];
+	/** the IDs of the queries, as the server read them */
+	uint16_t id[TEST_REUSE_QUERIES];
+	/** if the reply for the query has been received */
+	int replied[TEST_REUSE_QUERIES];
+	/** number of error callbacks */
+	int num_error;
+	/** the current step */
+	int step;
+};
+
+/** the query number of the query packet, from its qname */
+static int
+query_num(uint8_t* pkt, size_t len)
+{
+	uint8_t* lab = pkt + LDNS_HEADER_SIZE;
+	unit_assert(len > LDNS_HEADER_SIZE+2 && lab[0] >= 2 &&
+		(size_t)lab[0] + LDNS_HEADER_SIZE+1 <= len && lab[1] == 'q');
+	return (int)(lab[2] - '0');
+}
+
+/** accept a stream on the server, reads are blocking with a timeout */
+static int
+reuse_accept(struct reuse_test* t)
+{
+	struct timeval tv;
+	int s = (int)accept(t->listen, NULL, NULL);
+	unit_assert(s != -1);
+	fd_set_block(s);
+	tv.tv_sec = 1;
+	tv.tv_usec = 0;
+	unit_assert(setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, (void*)&tv,
+		(socklen_t)sizeof(tv)) == 0);
+	return s;
+}
+
+/** read a query on a server stream, and reply to it, return its number */
+static int
+reuse_read(struct reuse_test* t, int s, uint8_t* buf, size_t* len)
+{
+	int num;
+	unit_assert(recv(s, (void*)buf, 2, MSG_WAITALL) == 2);
+	*len = sldns_read_uint16(buf);
+	unit_assert(*len >= LDNS_HEADER_SIZE && *len < 512);
+	unit_assert(recv(s, (void*)(buf+2), *len, MSG_WAITALL) ==
+		(ssize_t)*len);
+	num = query_num(buf+2, *len);
+	t->id[num] = sldns_read_uint16(buf+2);
+	if(vbmp) printf("server read query %d, ID %d\n", num,
+		(int)t->id[num]);
+	return num;
+}
+
+/** read a query on a server stream, check its number */
+static void
+reuse_read_query(struct reuse_test* t, int s, int num)
+{
+	uint8_t buf[512];
+	size_t len;
+	unit_assert(reuse_read(t, s, buf, &len) == num);
+}
+
+/** reply to a query on a server stream, the reply echoes the query */
+static void
+reuse_reply(struct reuse_test* t, int s, int num)
+{
+	uint8_t buf[512];
+	size_t len;
+	sldns_buffer_clear(t->pkt);
+	make_query(t->pkt, num);
+	len = sldns_buffer_limit(t->pkt);
+	sldns_write_uint16(buf, len);
+	memmove(buf+2, sldns_buffer_begin(t->pkt), len);
+	sldns_write_uint16(buf+2, t->id[num]);
+	LDNS_QR_SET(buf+2);
+	unit_assert(send(s, (void*)buf, len+2, 0) == (ssize_t)len+2);
+}
+
+/** check that the server stream has been closed */
+static void
+reuse_check_eof(int s)
+{
+	uint8_t buf[16];
+	unit_assert(recv(s, (void*)buf, sizeof(buf), 0) == 0);
+}
+
+/** the reply to a tcp query, or an error */
+static int
+reuse_reply_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* ATTR_UNUSED(reply_info))
+{
+	struct reuse_test* t = (struct reuse_test*)arg;
+	int num;
+	if(error != NETEVENT_NOERROR) {
+		if(vbmp) printf("query error %d\n", error);
+		t->num_error++;
+		return 0;
+	}
+	num = query_num(sldns_buffer_begin(c->buffer),
+		sldns_buffer_limit(c->buffer));
+	if(vbmp) printf("reply for query %d\n", num);
+	unit_assert(LDNS_ID_WIRE(sldns_buffer_begin(c->buffer)) ==
+		t->id[num]);
+	unit_assert(!t->replied[num]);
+	t->replied[num] = 1;
+	return 0;
+}
+
+/** send a tcp query, return its stream */
+static struct pending_tcp*
+reuse_query(struct reuse_test* t, int num)
+{
+	struct waiting_tcp* w;
+	make_query(t->pkt, num);
+	w = pending_tcp_query(&t->sq, t->pkt, 5, &test_comm_point_cb, t->cb);
+	unit_assert(w && w->stream);
+	t->stream[num] = w->stream;
+	return w->stream;
+}
+
+/** the next step of the reuse test, the event loop has run in between */
+static void
+reuse_step(void* arg)
+{
+	struct reuse_test* t = (struct reuse_test*)arg;
+	struct outside_network* outnet = t->outnet;
+	struct pending_tcp* a = t->stream[1], *b = t->stream[4];
+	struct timeval tv;
+	int msec = 50;
+	if(vbmp) printf("step %d\n", t->step);
+	switch(t->step) {
+	case 0:
+		t->conn[0] = reuse_accept(t);
+		reuse_read_query(t, t->conn[0], 1);
+		/* the next queries use the open stream */
+		unit_assert(reuse_query(t, 2) == a);
+		unit_assert(reuse_query(t, 3) == a);
+		unit_assert(outnet->num_tcp_reuse == 2);
+		unit_assert(a->reused && a->num_queries == 3);
+		/* the stream has the max number of queries, it takes no
+		 * new ones, the next query opens a new stream */
+		unit_assert(!a->in_reuse_tree);
+		unit_assert(a->query_tree.count == 3);
+		unit_assert(reuse_query(t, 4) != a);
+		unit_assert(outnet->num_tcp_open == 2);
+		break;
+	case 1:
+		/* the queries on the stream have different IDs */
+		reuse_read_query(t, t->conn[0], 2);
+		reuse_read_query(t, t->conn[0], 3);
+		unit_assert(t->id[1] != t->id[2] && t->id[1] != t->id[3] &&
+			t->id[2] != t->id[3]);
+		t->conn[1] = reuse_accept(t);
+		reuse_read_query(t, t->conn[1], 4);
+		/* the replies are matched by ID */
+		reuse_reply(t, t->conn[0], 3);
+		reuse_reply(t, t->conn[0], 1);
+		reuse_reply(t, t->conn[1], 4);
+		break;
+	case 2:
+		unit_assert(t->replied[3] && t->replied[1] && t->replied[4]);
+		unit_assert(!t->replied[2] && a->query_tree.count == 1);
+		/* the stream without queries is idle, and reused */
+		unit_assert(b->is_idle && b->in_reuse_tree);
+		unit_assert(outnet->tcp_reuse_first == b);
+		unit_assert(reuse_query(t, 5) == b);
+		unit_assert(!b->is_idle && outnet->tcp_reuse_first == NULL);
+		unit_assert(outnet->num_tcp_reuse == 3);
+		reuse_reply(t, t->conn[0], 2);
+		break;
+	case 3:
+		/* the stream at the max number of queries is closed when
+		 * its queries are done */
+		unit_assert(t->replied[2]);
+		unit_assert(a->c->fd == -1 && a->query_tree.count == 0);
+		reuse_check_eof(t->conn[0]);
+		reuse_read_query(t, t->conn[1], 5);
+		reuse_reply(t, t->conn[1], 5);
+		break;
+	case 4:
+		unit_assert(t->replied[5]);
+		unit_assert(b->is_idle && b->c->fd != -1);
+		/* wait for the idle timeout */
+		msec = TEST_REUSE_TIMEOUT*3/2;
+		break;
+	case 5:
+		/* the idle stream is closed */
+		unit_assert(!b->is_idle && b->c->fd == -1);
+		unit_assert(outnet->tcp_reuse_first == NULL);
+		reuse_check_eof(t->conn[1]);
+		/* a new query opens a new stream */
+		(void)reuse_query(t, 6);
+		unit_assert(outnet->num_tcp_open == 3);
+		break;
+	case 6:
+		t->conn[2] = reuse_accept(t);
+		reuse_read_query(t, t->conn[2], 6);
+		reuse_reply(t, t->conn[2], 6);
+		break;
+	case 7:
+		unit_assert(t->replied[6] && t->stream[6]->is_idle);
+		/* the server closes the idle stream, the query that is
+		 * written on it is sent again on a new stream */
+		close(t->conn[2]);
+		t->conn[2] = -1;
+		unit_assert(reuse_query(t, 7) == t->stream[6]);
+		unit_assert(outnet->num_tcp_reuse == 4);
+		break;
+	case 8:
+		unit_assert(outnet->num_tcp_open == 4);
+		t->conn[3] = reuse_accept(t);
+		reuse_read_query(t, t->conn[3], 7);
+		reuse_reply(t, t->conn[3], 7);
+		break;
+	default:
+		unit_assert(t->replied[7]);
+		unit_assert(t->num_error == 0);
+		comm_base_exit(outnet->base);
+		return;
+	}
+	t->step++;
+	tv.tv_sec = msec/1000;
+	tv.tv_usec = (msec%1000)*1000;
+	comm_timer_set(t->timer, &tv);
+}
+
+/** test the reuse of tcp streams: queries on an open stream, the ID
+ * on the stream, the max queries per stream and the idle timeout */
+static void
+reuse_test(void)
+{
+	struct reuse_test t;
+	struct comm_point_testcb cb;
+	struct comm_base* base;
+	struct ub_randstate* rnd;
+	struct timeval tv;
+	int i;
+	int* ports;
+
+	unit_show_func("services/outside_network.c", "outnet_tcp_send");
+#ifdef SIGPIPE
+	(void)signal(SIGPIPE, SIG_IGN);
+#endif
+	memset(&t, 0, sizeof(t));
+	cb.point_cb = &reuse_reply_cb;
+	cb.timer_cb = &reuse_step;
+	cb.arg = &t;
+	t.cb = &cb;
+	base = comm_base_create(0);
+	unit_assert(base);
+	rnd = ub_initstate(42, NULL);
+	unit_assert(rnd);
+	ports = make_ports();
+	t.outnet = outside_network_create(base, 4096, TEST_NUM_FDS, NULL, 0,
+		1, 0, 2, NULL, rnd, 0, ports, TEST_PORT_NUM, 0, 0, NULL, NULL,
+		1, NULL, 0, NULL, TEST_REUSE_TIMEOUT, TEST_REUSE_MAX, 0, 0, 0);
+	unit_assert(t.outnet);
+	t.pkt = sldns_buffer_new(512);
+	unit_assert(t.pkt);
+	t.timer = comm_timer_create(base, &test_comm_timer_cb, &cb);
+	unit_assert(t.timer);
+	for(i=0; i<TEST_REUSE_CONNS; i++)
+		t.conn[i] = -1;
+
+	/* the server listens on the loopback address */
+	t.listen = (int)socket(AF_INET, SOCK_STREAM, 0);
+	unit_assert(t.listen != -1);
+	unit_assert(ipstrtoaddr("127.0.0.1", 0, &t.sq.addr, &t.sq.addrlen));
+	unit_assert(bind(t.listen, (struct sockaddr*)&t.sq.addr,
+		t.sq.addrlen) == 0);
+	unit_assert(getsockname(t.listen, (struct sockaddr*)&t.sq.addr,
+		&t.sq.addrlen) == 0);
+	unit_assert(listen(t.listen, 4) == 0);
+	fd_set_nonblock(t.listen);
+	t.sq.outnet = t.outnet;
+
+	(void)reuse_query(&t, 1);
+	unit_assert(t.outnet->num_tcp_open == 1);
+	tv.tv_sec = 0;
+	tv.tv_usec = 50*1000;
+	comm_timer_set(t.timer, &tv);
+	comm_base_dispatch(base);
+	unit_assert(t.step == 9);
+
+	for(i=0; i<TEST_REUSE_CONNS; i++)
+		if(t.conn[i] != -1)
+			close(t.conn[i]);
+	close(t.listen);
+	outside_network_delete(t.outnet);
+	comm_timer_delete(t.timer);
+	sldns_buffer_free(t.pkt);
+	free(ports);
+	ub_randfree(rnd);
+	comm_base_delete(base);
+}
+
+void
+outnet_test(void)
+{
+	unit_show_feature("outside network");
+	send_msgs_test();
+	batch_test();
+	batch_fail_test();
+	pool_test();
+	reuse_test();
+}
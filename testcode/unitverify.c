@@ -46,6 +46,11 @@
 #include "validator/val_nsec.h"
 #include "validator/val_nsec3.h"
 #include "validator/validator.h"
+#include "validator/val_sigcache.h"
+#include "validator/val_nsec3cache.h"
+#include "validator/val_cryptopool.h"
+#include "validator/val_kentry.h"
+#include "services/cache/rrset.h"
 #include "testcode/testpkts.h"
 #include "util/data/msgreply.h"
 #include "util/data/msgparse.h"
@@ -56,6 +61,7 @@
 #include "util/net_help.h"
 #include "util/module.h"
 #include "util/config_file.h"
+#include "util/tube.h"
 #include "sldns/sbuffer.h"
 #include "sldns/keyraw.h"
 #include "sldns/str2wire.h"
@@ -198,12 +204,37 @@ verifytest_rrset(struct module_env* env, struct val_env* ve,
 	}
 }
 
+/** give the rrset the stored canonical form, as in the rrset cache */
+static void
+canontest_rrset(struct regional* region, struct ub_packed_rrset_key* rrset)
+{
+	struct packed_rrset_data* nd = rrset_canonical_store(rrset);
+	struct ub_packed_rrset_key* ck;
+	if(!nd) {
+		/* only rrsigs, nothing to sort */
+		unit_assert(((struct packed_rrset_data*)rrset->entry.data)
+			->count == 0);
+		return;
+	}
+	unit_assert(nd->canon_len != 0);
+	ck = packed_rrset_copy_region(rrset, region, 0);
+	unit_assert(ck);
+	free(rrset->entry.data);
+	rrset->entry.data = nd;
+	/* with and without the image, and both with the image */
+	unit_assert(rrset_canonical_equal(region, rrset, ck));
+	ck = packed_rrset_copy_region(rrset, region, 0);
+	unit_assert(ck && ((struct packed_rrset_data*)ck->entry.data)
+		->canon_len == nd->canon_len);
+	unit_assert(rrset_canonical_equal(region, rrset, ck));
+}
+
 /** verify and test an entry - every rr in the message */
 static void
 verifytest_entry(struct entry* e, struct alloc_cache* alloc, 
 	struct regional* region, sldns_buffer* pkt, 
 	struct ub_packed_rrset_key* dnskey, struct module_env* env, 
-	struct val_env* ve)
+	struct val_env* ve, int canon)
 {
 	struct query_info qinfo;
 	struct reply_info* rep = NULL;
@@ -219,6 +250,8 @@ verifytest_entry(struct entry* e, struct alloc_cache* alloc,
 	entry_to_repinfo(e, alloc, region, pkt, &qinfo, &rep);
 
 	for(i=0; i<rep->rrset_count; i++) {
+		if(canon)
+			canontest_rrset(region, rep->rrsets[i]);
 		verifytest_rrset(env, ve, rep->rrsets[i], dnskey, &qinfo);
 	}
 
@@ -281,9 +314,12 @@ dstest_entry(struct entry* e, struct alloc_cache* alloc,
 	query_info_clear(&qinfo);
 }
 
-/** verify from a file */
+/** verify from a file, with the signature cache if not NULL, and
+ * with stored canonical forms if canon is true.  The cache hits and
+ * misses of the thread are added to hit and miss, if not NULL. */
 static void
-verifytest_file(const char* fname, const char* at_date)
+verifytest_file_cache(const char* fname, const char* at_date,
+	struct sig_cache* sc, int canon, size_t* hit, size_t* miss)
 {
 	/* 
 	 * The file contains a list of ldns-testpkts entries.
@@ -310,6 +346,7 @@ verifytest_file(const char* fname, const char* at_date)
 	env.scratch_buffer = buf;
 	env.now = &now;
 	ve.date_override = cfg_convert_timeval(at_date);
+	ve.sigcache = sc;
 	unit_assert(region && buf);
 	dnskey = extract_keys(list, &alloc, region, buf);
 	if(vsig) log_nametypeclass(VERB_QUERY, "test dnskey",
@@ -317,8 +354,11 @@ verifytest_file(const char* fname, const char* at_date)
 			ntohs(dnskey->rk.rrset_class));
 	/* ready to go! */
 	for(e = list->next; e; e = e->next) {
-		verifytest_entry(e, &alloc, region, buf, dnskey, &env, &ve);
+		verifytest_entry(e, &alloc, region, buf, dnskey, &env, &ve,
+			canon);
 	}
+	if(hit) *hit += env.num_sig_cache_hit;
+	if(miss) *miss += env.num_sig_cache_miss;
 
 	ub_packed_rrset_parsedelete(dnskey, &alloc);
 	delete_entry(list);
@@ -327,6 +367,43 @@ verifytest_file(const char* fname, const char* at_date)
 	sldns_buffer_free(buf);
 }
 
+/** verify from a file */
+static void
+verifytest_file(const char* fname, const char* at_date)
+{
+	verifytest_file_cache(fname, at_date, NULL, 0, NULL, NULL);
+}
+
+/** verify a file with the canonical form stored in the rrset data */
+static void
+canontest_file(const char* fname, const char* at_date)
+{
+	unit_show_func("validator/val_sigcrypt.c", "rrset_canonical_store");
+	verifytest_file_cache(fname, at_date, NULL, 1, NULL, NULL);
+}
+
+/** verify a file twice with the signature cache, the second time hits */
+static void
+sigcache_test_file(const char* fname, const char* at_date)
+{
+	struct config_file* cfg = config_create();
+	struct sig_cache* sc;
+	size_t hit = 0, miss = 0, first;
+	unit_show_func("validator/val_sigcache.c", "sig_cache_lookup");
+	unit_assert(cfg);
+	sc = sig_cache_create(cfg);
+	unit_assert(sc);
+	verifytest_file_cache(fname, at_date, sc, 0, &hit, &miss);
+	unit_assert(hit == 0 && miss > 0);
+	first = miss;
+	/* the bogus signatures are not cached, and stay bogus */
+	verifytest_file_cache(fname, at_date, sc, 0, &hit, &miss);
+	unit_assert(hit > 0);
+	unit_assert(hit + miss == 2*first);
+	sig_cache_delete(sc);
+	config_delete(cfg);
+}
+
 /** verify DS matches DNSKEY from a file */
 static void
 dstest_file(const char* fname)
@@ -415,9 +492,11 @@ nsectest(void)
 /** Test hash algo - NSEC3 hash it and compare result */
 static void
 nsec3_hash_test_entry(struct entry* e, rbtree_type* ct,
-	struct alloc_cache* alloc, struct regional* region, 
-	sldns_buffer* buf)
+	struct nsec3_hash_cache* hc, struct alloc_cache* alloc,
+	struct module_env* env)
 {
+	struct regional* region = env->scratch;
+	sldns_buffer* buf = env->scratch_buffer;
 	struct query_info qinfo;
 	struct reply_info* rep = NULL;
 	struct ub_packed_rrset_key* answer, *nsec3;
@@ -438,8 +517,8 @@ nsec3_hash_test_entry(struct entry* e, rbtree_type* ct,
 	/* check test is OK */
 	unit_assert(nsec3 && answer && qname);
 
-	ret = nsec3_hash_name(ct, region, buf, nsec3, 0, qname,
-		qinfo.qname_len, &hash);
+	ret = nsec3_hash_name(ct, hc, env, nsec3, 0, qname, qinfo.qname_len,
+		&hash);
 	if(ret != 1) {
 		printf("Bad nsec3_hash_name retcode %d\n", ret);
 		unit_assert(ret == 1);
@@ -456,9 +535,10 @@ nsec3_hash_test_entry(struct entry* e, rbtree_type* ct,
 }
 
 
-/** Read file to test NSEC3 hash algo */
+/** Read file to test NSEC3 hash algo, with the hash cache if not NULL */
 static void
-nsec3_hash_test(const char* fname)
+nsec3_hash_test_cache(const char* fname, struct nsec3_hash_cache* hc,
+	size_t* hit, size_t* miss)
 {
 	/* 
 	 * The list contains a list of ldns-testpkts entries.
@@ -476,6 +556,7 @@ nsec3_hash_test(const char* fname)
 	sldns_buffer* buf = sldns_buffer_new(65535);
 	struct entry* e;
 	struct entry* list = read_datafile(fname, 1);
+	struct module_env env;
 	unit_show_func("NSEC3 hash", fname);
 
 	if(!list)
@@ -483,17 +564,218 @@ nsec3_hash_test(const char* fname)
 	rbtree_init(&ct, &nsec3_hash_cmp);
 	alloc_init(&alloc, NULL, 1);
 	unit_assert(region && buf);
+	memset(&env, 0, sizeof(env));
+	env.scratch = region;
+	env.scratch_buffer = buf;
 
 	/* ready to go! */
 	for(e = list; e; e = e->next) {
-		nsec3_hash_test_entry(e, &ct, &alloc, region, buf);
+		nsec3_hash_test_entry(e, &ct, hc, &alloc, &env);
+	}
+	if(hit) *hit += env.num_nsec3_cache_hit;
+	if(miss) *miss += env.num_nsec3_cache_miss;
+
+	delete_entry(list);
+	regional_destroy(region);
+	alloc_clear(&alloc);
+	sldns_buffer_free(buf);
+}
+
+/** Read file to test NSEC3 hash algo */
+static void
+nsec3_hash_test(const char* fname)
+{
+	nsec3_hash_test_cache(fname, NULL, NULL, NULL);
+}
+
+/** hash a file twice with the NSEC3 hash cache, the second time hits */
+static void
+nsec3cache_test_file(const char* fname)
+{
+	struct config_file* cfg = config_create();
+	struct nsec3_hash_cache* hc;
+	size_t hit = 0, miss = 0;
+	unit_show_func("validator/val_nsec3cache.c", "nsec3_hash_cache_lookup");
+	unit_assert(cfg);
+	hc = nsec3_hash_cache_create(cfg);
+	unit_assert(hc);
+	nsec3_hash_test_cache(fname, hc, &hit, &miss);
+	unit_assert(miss > 0);
+	/* the per query table is new, the hashes come from the cache,
+	 * and they still compare equal to the answers */
+	hit = 0;
+	miss = 0;
+	nsec3_hash_test_cache(fname, hc, &hit, &miss);
+	unit_assert(miss == 0 && hit > 0);
+	nsec3_hash_cache_delete(hc);
+	config_delete(cfg);
+}
+
+#ifndef THREADS_DISABLED
+/** submit a job for every rrset of the reply, returns number of jobs */
+static int
+cryptopool_submit_rep(struct crypto_pool* pool, struct module_qstate* qstate,
+	struct val_qstate* vq, struct val_env* ve, struct reply_info* rep,
+	struct key_entry_key* kkey)
+{
+	struct crypto_job* job;
+	size_t i;
+	for(i=0; i<rep->rrset_count; i++) {
+		job = crypto_job_create(qstate, 0, ve, rep->rrsets[i], kkey, 0);
+		unit_assert(job);
+		job->qnext = vq->crypto_jobs;
+		vq->crypto_jobs = job;
+		unit_assert(crypto_pool_submit(pool, job));
 	}
+	return (int)rep->rrset_count;
+}
 
+/** wait for the wakeup of the worker, and take the finished jobs */
+static struct crypto_job*
+cryptopool_wait(struct crypto_pool* pool, struct tube* wake)
+{
+	uint8_t* msg = NULL;
+	uint32_t len = 0;
+	unit_assert(tube_read_msg(wake, &msg, &len, 0) == 1);
+	free(msg);
+	return crypto_pool_take(pool, 0);
+}
+
+/** verify the rrsets of a file with the crypto pool, and check that jobs
+ * of a query that is cleared by val_clear are not resumed */
+static void
+cryptopool_test_file(const char* fname, const char* at_date)
+{
+	struct ub_packed_rrset_key* dnskey;
+	struct key_entry_key* kkey;
+	struct regional* region = regional_create();
+	struct regional* kregion = regional_create();
+	struct alloc_cache alloc;
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	struct entry* e;
+	struct entry* list = read_datafile(fname, 1);
+	struct config_file* cfg = config_create();
+	struct module_env env;
+	struct module_qstate qstate;
+	struct val_qstate vq;
+	struct val_env ve;
+	struct tube* wake = tube_create();
+	struct crypto_pool* pool;
+	uint8_t sigalg[ALGO_NEEDS_MAX+1];
+	time_t now = time(NULL);
+	int jobs, secure = 0;
+	unit_show_func("validator/val_cryptopool.c", "crypto_pool_submit");
+
+	if(!list)
+		fatal_exit("could not read %s: %s", fname, strerror(errno));
+	unit_assert(region && kregion && buf && cfg && wake);
+	alloc_init(&alloc, NULL, 1);
+	memset(&env, 0, sizeof(env));
+	memset(&ve, 0, sizeof(ve));
+	env.scratch = region;
+	env.scratch_buffer = buf;
+	env.now = &now;
+	env.rrset_cache = rrset_cache_create(cfg, &alloc);
+	unit_assert(env.rrset_cache);
+	ve.date_override = cfg_convert_timeval(at_date);
+	dnskey = extract_keys(list, &alloc, region, buf);
+	setup_sigalg(dnskey, sigalg);
+	kkey = key_entry_create_rrset(kregion, dnskey->rk.dname,
+		dnskey->rk.dname_len, ntohs(dnskey->rk.rrset_class), dnskey,
+		sigalg, now);
+	unit_assert(kkey);
+	pool = crypto_pool_create(2, 1, &wake);
+	unit_assert(pool);
+
+	for(e = list->next; e; e = e->next) {
+		struct query_info qinfo;
+		struct reply_info* rep = NULL;
+		struct crypto_job* job, *nx;
+		struct module_qstate* resume = NULL;
+		size_t i;
+		regional_free_all(region);
+		entry_to_repinfo(e, &alloc, region, buf, &qinfo, &rep);
+		memset(&qstate, 0, sizeof(qstate));
+		memset(&vq, 0, sizeof(vq));
+		qstate.env = &env;
+		qstate.minfo[0] = &vq;
+		jobs = cryptopool_submit_rep(pool, &qstate, &vq, &ve, rep,
+			kkey);
+		/* the query resumes after its last job */
+		while(vq.crypto_jobs) {
+			unit_assert(resume == NULL);
+			for(job = cryptopool_wait(pool, wake); job; job = nx) {
+				nx = job->next;
+				resume = crypto_job_finish(job);
+				jobs--;
+			}
+		}
+		unit_assert(jobs == 0 && resume == &qstate);
+		for(i=0; i<rep->rrset_count; i++) {
+			struct packed_rrset_data* d = (struct packed_rrset_data*)
+				rep->rrsets[i]->entry.data;
+			if(should_be_bogus(rep->rrsets[i], &qinfo)) {
+				unit_assert(d->security != sec_status_secure);
+			} else {
+				unit_assert(d->security == sec_status_secure);
+				secure++;
+			}
+		}
+		reply_info_parsedelete(rep, &alloc);
+		query_info_clear(&qinfo);
+	}
+	unit_assert(secure > 0);
+	lock_basic_lock(&pool->stat_lock);
+	unit_assert(pool->queued == 0 && pool->num_jobs > 0);
+	lock_basic_unlock(&pool->stat_lock);
+
+	/* a query that is deleted while its jobs run, the jobs are
+	 * deleted when they are finished, and the query is not resumed */
+	if(list->next) {
+		struct query_info qinfo;
+		struct reply_info* rep = NULL;
+		struct crypto_job* job, *nx;
+		size_t i;
+		regional_free_all(region);
+		entry_to_repinfo(list->next, &alloc, region, buf, &qinfo, &rep);
+		memset(&qstate, 0, sizeof(qstate));
+		memset(&vq, 0, sizeof(vq));
+		qstate.env = &env;
+		qstate.minfo[0] = &vq;
+		jobs = cryptopool_submit_rep(pool, &qstate, &vq, &ve, rep,
+			kkey);
+		val_clear(&qstate, 0);
+		unit_assert(qstate.minfo[0] == NULL);
+		for(job = vq.crypto_jobs; job; job = job->qnext)
+			unit_assert(job->qstate == NULL);
+		while(jobs > 0) {
+			for(job = cryptopool_wait(pool, wake); job; job = nx) {
+				nx = job->next;
+				unit_assert(job->qstate == NULL);
+				unit_assert(crypto_job_finish(job) == NULL);
+				jobs--;
+			}
+		}
+		unit_assert(jobs == 0);
+		for(i=0; i<rep->rrset_count; i++)
+			unit_assert(((struct packed_rrset_data*)rep->rrsets[i]
+				->entry.data)->security != sec_status_secure);
+		reply_info_parsedelete(rep, &alloc);
+		query_info_clear(&qinfo);
+	}
+
+	crypto_pool_delete(pool);
+	tube_delete(wake);
+	rrset_cache_delete(env.rrset_cache);
+	ub_packed_rrset_parsedelete(dnskey, &alloc);
 	delete_entry(list);
 	regional_destroy(region);
+	regional_destroy(kregion);
 	alloc_clear(&alloc);
 	sldns_buffer_free(buf);
+	config_delete(cfg);
 }
+#endif /* THREADS_DISABLED */
 
 void 
 verify_test(void)
@@ -515,6 +797,11 @@ verify_test(void)
 #endif
 #if (defined(HAVE_EVP_SHA256) || defined(HAVE_NSS) || defined(HAVE_NETTLE)) && defined(USE_SHA2)
 	verifytest_file("testdata/test_sigs.rsasha256", "20070829144150");
+	sigcache_test_file("testdata/test_sigs.rsasha256", "20070829144150");
+	canontest_file("testdata/test_sigs.rsasha256", "20070829144150");
+#  ifndef THREADS_DISABLED
+	cryptopool_test_file("testdata/test_sigs.rsasha256", "20070829144150");
+#  endif
 #  ifdef USE_SHA1
 	verifytest_file("testdata/test_sigs.sha1_and_256", "20070829144150");
 #  endif
@@ -526,6 +813,7 @@ verify_test(void)
 #endif
 #ifdef USE_SHA1
 	verifytest_file("testdata/test_sigs.hinfo", "20090107100022");
+	canontest_file("testdata/test_sigs.hinfo", "20090107100022");
 	verifytest_file("testdata/test_sigs.revoked", "20080414005004");
 #endif
 #ifdef USE_GOST
@@ -551,4 +839,5 @@ verify_test(void)
 #endif
 	nsectest();
 	nsec3_hash_test("testdata/test_nsec3_hash.1");
+	nsec3cache_test_file("testdata/test_nsec3_hash.1");
 }
@@ -0,0 +1,373 @@
+/*
+ * testcode/unitwirecache.c - unit test for the wire cache.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+/**
+ * \file
+ * Unit test for the wire cache, that answers from stored encoded replies.
+ * The replies are parsed from packets, with the rrset references set up
+ * like in the message cache.
+ */
+#include "config.h"
+#include "testcode/unitmain.h"
+#include "services/cache/wirecache.h"
+#include "util/alloc.h"
+#include "util/regional.h"
+#include "util/net_help.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/data/msgencode.h"
+#include "util/data/packed_rrset.h"
+#include "sldns/sbuffer.h"
+#include "sldns/str2wire.h"
+#include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
+
+/** verbosity for this test */
+static int vbmp = 0;
+
+/** time of storage of the reply in the test */
+#define WC_NOW 1000
+
+/** append an RR in text format to the packet */
+static void
+add_rr(sldns_buffer* pkt, const char* str)
+{
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	size_t len = sizeof(rr), dname_len = 0;
+	unit_assert(sldns_str2wire_rr_buf(str, rr, &len, &dname_len, 3600,
+		NULL, 0, NULL, 0) == 0);
+	sldns_buffer_write(pkt, rr, len);
+}
+
+/** make the reply packet for www.example.com. A, two rrsets */
+static void
+make_pkt(sldns_buffer* pkt)
+{
+	uint8_t qname[LDNS_MAX_DOMAINLEN+1];
+	size_t qname_len = sizeof(qname);
+	unit_assert(sldns_str2wire_dname_buf("www.example.com.", qname,
+		&qname_len) == 0);
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, 0); /* id */
+	sldns_buffer_write_u16(pkt, BIT_QR|BIT_RD|BIT_RA); /* flags */
+	sldns_buffer_write_u16(pkt, 1); /* qdcount */
+	sldns_buffer_write_u16(pkt, 2); /* ancount */
+	sldns_buffer_write_u16(pkt, 1); /* nscount */
+	sldns_buffer_write_u16(pkt, 0); /* arcount */
+	sldns_buffer_write(pkt, qname, qname_len);
+	sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_A);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	add_rr(pkt, "www.example.com. 3600 IN A 192.0.2.1");
+	add_rr(pkt, "www.example.com. 3600 IN A 192.0.2.2");
+	add_rr(pkt, "example.com. 7200 IN NS ns.example.com.");
+	sldns_buffer_flip(pkt);
+}
+
+/**
+ * Parse the packet into a reply like in the message cache, with the
+ * rrset references and absolute TTLs.
+ */
+static struct reply_info*
+make_rep(sldns_buffer* pkt, struct alloc_cache* alloc,
+	struct query_info* qinfo, struct regional* region)
+{
+	struct reply_info* rep;
+	struct edns_data edns;
+	size_t i;
+	unit_assert(reply_info_parse(pkt, alloc, qinfo, &rep, region,
+		&edns) == 0);
+	unit_assert(rep->rrset_count == 2);
+	for(i=0; i<rep->rrset_count; i++) {
+		rep->ref[i].key = rep->rrsets[i];
+		rep->ref[i].id = rep->rrsets[i]->id;
+	}
+	reply_info_set_ttls(rep, WC_NOW);
+	return rep;
+}
+
+/** encode the reply without EDNS, and store it in the wire cache */
+static void
+store_rep(struct wirecache* wc, struct query_info* qinfo,
+	struct reply_info* rep, uint16_t flags, int dnssec,
+	struct regional* region, sldns_buffer* buf)
+{
+	struct edns_data noedns;
+	memset(&noedns, 0, sizeof(noedns));
+	unit_assert(reply_info_answer_encode(qinfo, rep, 0, flags, buf,
+		WC_NOW, 1, region, (uint16_t)sldns_buffer_capacity(buf),
+		&noedns, dnssec, 0));
+	unit_assert(wirecache_store(wc, qinfo, flags, dnssec,
+		query_info_hash(qinfo, flags), rep, buf, WC_NOW, 0));
+}
+
+/** check the TTLs of the A and NS rrsets in a parsed answer */
+static void
+check_ttls(struct reply_info* rep, time_t a_ttl, time_t ns_ttl)
+{
+	size_t i, j;
+	for(i=0; i<rep->rrset_count; i++) {
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			rep->rrsets[i]->entry.data;
+		time_t ttl = (ntohs(rep->rrsets[i]->rk.type) ==
+			LDNS_RR_TYPE_A)?a_ttl:ns_ttl;
+		if(vbmp) printf("rrset %d ttl %d\n", (int)i, (int)d->ttl);
+		unit_assert(d->ttl == ttl);
+		for(j=0; j<d->count; j++)
+			unit_assert(d->rr_ttl[j] == ttl);
+	}
+}
+
+/** test that a hit patches the ID, RD flag, TTLs and EDNS */
+static void
+answer_test(struct wirecache* wc, struct query_info* qinfo,
+	struct reply_info* rep, struct alloc_cache* alloc,
+	struct regional* region, sldns_buffer* pkt)
+{
+	struct wirecache_entry* e;
+	struct query_info qi2, uq;
+	struct reply_info* rep2;
+	struct edns_data edns, edns2;
+	uint8_t upper[LDNS_MAX_DOMAINLEN+1];
+	size_t upper_len = sizeof(upper);
+
+	unit_show_func("services/cache/wirecache.c", "wirecache_answer");
+	/* the query has another case, and no RD flag */
+	unit_assert(sldns_str2wire_dname_buf("WWW.Example.COM.", upper,
+		&upper_len) == 0);
+	uq = *qinfo;
+	uq.qname = upper;
+	e = wirecache_lookup(wc, &uq, 0, 0, query_info_hash(qinfo, BIT_RD));
+	unit_assert(e);
+	unit_assert(wirecache_entry_valid(e, rep));
+
+	memset(&edns, 0, sizeof(edns));
+	edns.edns_present = 1;
+	edns.udp_size = 1232;
+	edns.bits = EDNS_DO;
+	unit_assert(wirecache_answer(e, &uq, htons(0x1234), 0, pkt,
+		WC_NOW+10, &edns, 65535));
+	unit_assert(sldns_buffer_limit(pkt) > e->wire_len);
+	unit_assert(LDNS_ID_WIRE(sldns_buffer_begin(pkt)) == 0x1234);
+	unit_assert(LDNS_QR_WIRE(sldns_buffer_begin(pkt)));
+	unit_assert(!LDNS_RD_WIRE(sldns_buffer_begin(pkt)));
+	unit_assert(LDNS_ARCOUNT(sldns_buffer_begin(pkt)) == 1);
+	unit_assert(memcmp(sldns_buffer_at(pkt, LDNS_HEADER_SIZE), upper,
+		upper_len) == 0);
+	unit_assert(reply_info_parse(pkt, alloc, &qi2, &rep2, region,
+		&edns2) == 0);
+	unit_assert(edns2.edns_present);
+	unit_assert(edns2.udp_size == 1232);
+	unit_assert(edns2.bits & EDNS_DO);
+	unit_assert(rep2->rrset_count == 2);
+	check_ttls(rep2, 3590, 7190);
+	query_info_clear(&qi2);
+	reply_info_parsedelete(rep2, alloc);
+
+	/* no EDNS, RD flag set, the A records have expired */
+	memset(&edns, 0, sizeof(edns));
+	unit_assert(wirecache_answer(e, qinfo, htons(0xabcd), BIT_RD, pkt,
+		WC_NOW+4000, &edns, 65535));
+	unit_assert(sldns_buffer_limit(pkt) == e->wire_len);
+	unit_assert(LDNS_ID_WIRE(sldns_buffer_begin(pkt)) == 0xabcd);
+	unit_assert(LDNS_RD_WIRE(sldns_buffer_begin(pkt)));
+	unit_assert(LDNS_ARCOUNT(sldns_buffer_begin(pkt)) == 0);
+	unit_assert(reply_info_parse(pkt, alloc, &qi2, &rep2, region,
+		&edns2) == 0);
+	unit_assert(!edns2.edns_present);
+	check_ttls(rep2, 0, 3200);
+	query_info_clear(&qi2);
+	reply_info_parsedelete(rep2, alloc);
+
+	/* too large for the maximum size, the buffer is not changed */
+	unit_assert(!wirecache_answer(e, qinfo, htons(0x1234), 0, pkt,
+		WC_NOW, &edns, e->wire_len-1));
+	unit_assert(LDNS_ID_WIRE(sldns_buffer_begin(pkt)) == 0xabcd);
+}
+
+/** test that rrset changes make the entry invalid, and it is dropped */
+static void
+valid_test(struct wirecache* wc, struct query_info* qinfo,
+	struct reply_info* rep, struct regional* region, sldns_buffer* buf)
+{
+	hashvalue_type h = query_info_hash(qinfo, BIT_RD);
+	struct wirecache_entry* e;
+	struct packed_rrset_data* d = (struct packed_rrset_data*)
+		rep->ref[0].key->entry.data;
+	void* other = rep->ref[1].key->entry.data;
+	rrset_id_type id = rep->ref[0].id;
+
+	unit_show_func("services/cache/wirecache.c", "wirecache_entry_valid");
+	e = wirecache_lookup(wc, qinfo, BIT_RD, 0, h);
+	unit_assert(e && wirecache_entry_valid(e, rep));
+
+	/* the rrset key got a new id, it is another rrset now */
+	rep->ref[0].key->id = id + 100;
+	unit_assert(!wirecache_entry_valid(e, rep));
+	/* the reply refers to another rrset id */
+	rep->ref[0].key->id = id + 100;
+	rep->ref[0].id = id + 100;
+	unit_assert(!wirecache_entry_valid(e, rep));
+	rep->ref[0].key->id = id;
+	rep->ref[0].id = id;
+	unit_assert(wirecache_entry_valid(e, rep));
+
+	/* the reply itself is replaced by a newer one */
+	rep->ttl += 10;
+	unit_assert(!wirecache_entry_valid(e, rep));
+	rep->ttl -= 10;
+	unit_assert(wirecache_entry_valid(e, rep));
+
+	/* the rrset is updated in place, with new data or a new TTL,
+	 * the entry is dropped, as the worker does */
+	rep->ref[0].key->entry.data = other;
+	unit_assert(!wirecache_entry_valid(e, rep));
+	rep->ref[0].key->entry.data = d;
+	d->ttl += 10;
+	unit_assert(!wirecache_entry_valid(e, rep));
+	wirecache_remove(wc, e);
+	unit_assert(wc->num == 0 && wc->used == 0);
+	unit_assert(wirecache_lookup(wc, qinfo, BIT_RD, 0, h) == NULL);
+
+	/* stored again from the updated rrset, it is valid */
+	store_rep(wc, qinfo, rep, BIT_RD, 0, region, buf);
+	e = wirecache_lookup(wc, qinfo, BIT_RD, 0, h);
+	unit_assert(e && wirecache_entry_valid(e, rep));
+	d->ttl -= 10;
+	unit_assert(!wirecache_entry_valid(e, rep));
+	wirecache_remove(wc, e);
+	store_rep(wc, qinfo, rep, BIT_RD, 0, region, buf);
+}
+
+/** test that the CD, AD and DO variants have their own entries */
+static void
+variant_test(struct wirecache* wc, struct query_info* qinfo,
+	struct reply_info* rep, struct regional* region, sldns_buffer* buf)
+{
+	hashvalue_type h = query_info_hash(qinfo, BIT_RD);
+	struct wirecache_entry* e, *edo, *ecd;
+
+	unit_show_func("services/cache/wirecache.c", "wirecache_lookup");
+	unit_assert(wc->num == 1);
+	e = wirecache_lookup(wc, qinfo, BIT_RD, 0, h);
+	unit_assert(e);
+	/* the RD flag is patched, it is the same entry */
+	unit_assert(wirecache_lookup(wc, qinfo, 0, 0, h) == e);
+	unit_assert(wirecache_lookup(wc, qinfo, BIT_RD|BIT_CD, 0, h) == NULL);
+	unit_assert(wirecache_lookup(wc, qinfo, BIT_RD|BIT_AD, 0, h) == NULL);
+	unit_assert(wirecache_lookup(wc, qinfo, BIT_RD, 1, h) == NULL);
+
+	store_rep(wc, qinfo, rep, BIT_RD, 1, region, buf);
+	store_rep(wc, qinfo, rep, BIT_RD|BIT_CD, 0, region, buf);
+	unit_assert(wc->num == 3);
+	edo = wirecache_lookup(wc, qinfo, BIT_RD, 1, h);
+	ecd = wirecache_lookup(wc, qinfo, BIT_RD|BIT_CD, 0,
+		query_info_hash(qinfo, BIT_RD|BIT_CD));
+	unit_assert(edo && ecd);
+	unit_assert(edo != e && ecd != e && edo != ecd);
+	unit_assert(edo->dnssec == 1 && e->dnssec == 0);
+	unit_assert(ecd->qflags == BIT_CD && e->qflags == 0);
+	unit_assert(wirecache_lookup(wc, qinfo, BIT_RD, 0, h) == e);
+
+	/* storing the same variant again replaces the entry */
+	store_rep(wc, qinfo, rep, BIT_RD, 1, region, buf);
+	unit_assert(wc->num == 3);
+}
+
+/** test that the least recently used entry is removed for space */
+static void
+lru_test(struct query_info* qinfo, struct reply_info* rep,
+	struct regional* region, sldns_buffer* buf)
+{
+	struct wirecache* wc = wirecache_create(1024*1024);
+	hashvalue_type h = query_info_hash(qinfo, BIT_RD);
+	size_t size;
+	unit_assert(wc);
+
+	unit_show_func("services/cache/wirecache.c", "wirecache_store");
+	store_rep(wc, qinfo, rep, BIT_RD, 0, region, buf);
+	size = wc->used;
+	unit_assert(wc->num == 1 && size > 0);
+	wirecache_delete(wc);
+
+	/* room for one entry */
+	wc = wirecache_create(size + size/2);
+	unit_assert(wc);
+	store_rep(wc, qinfo, rep, BIT_RD, 0, region, buf);
+	store_rep(wc, qinfo, rep, BIT_RD, 1, region, buf);
+	unit_assert(wc->num == 1);
+	unit_assert(wirecache_lookup(wc, qinfo, BIT_RD, 0, h) == NULL);
+	unit_assert(wirecache_lookup(wc, qinfo, BIT_RD, 1, h) != NULL);
+	unit_assert(wirecache_get_mem(wc) > wc->used);
+	wirecache_clear(wc);
+	unit_assert(wc->num == 0 && wc->used == 0);
+	unit_assert(wirecache_lookup(wc, qinfo, BIT_RD, 1, h) == NULL);
+	wirecache_delete(wc);
+}
+
+void
+wirecache_test(void)
+{
+	struct alloc_cache super_a, alloc;
+	struct regional* region;
+	sldns_buffer* pkt, *buf;
+	struct query_info qinfo;
+	struct reply_info* rep;
+	struct wirecache* wc;
+
+	unit_show_feature("wire cache");
+	alloc_init(&super_a, NULL, 0);
+	alloc_init(&alloc, &super_a, 1);
+	region = regional_create();
+	pkt = sldns_buffer_new(65535);
+	buf = sldns_buffer_new(65535);
+	wc = wirecache_create(1024*1024);
+	unit_assert(region && pkt && buf && wc);
+
+	make_pkt(pkt);
+	rep = make_rep(pkt, &alloc, &qinfo, region);
+	store_rep(wc, &qinfo, rep, BIT_RD, 0, region, buf);
+	answer_test(wc, &qinfo, rep, &alloc, region, pkt);
+	valid_test(wc, &qinfo, rep, region, buf);
+	variant_test(wc, &qinfo, rep, region, buf);
+	lru_test(&qinfo, rep, region, buf);
+
+	wirecache_delete(wc);
+	query_info_clear(&qinfo);
+	reply_info_parsedelete(rep, &alloc);
+	sldns_buffer_free(pkt);
+	sldns_buffer_free(buf);
+	regional_destroy(region);
+	alloc_clear(&alloc);
+	alloc_clear(&super_a);
+}
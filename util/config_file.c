@@ -124,6 +124,9 @@ config_create(void)
 	cfg->num_queries_per_thread = 1024;
 #  endif
 	cfg->outgoing_num_tcp = 10;
+	cfg->outgoing_batch = 0;
+	cfg->outgoing_port_pool = 0;
+	cfg->outgoing_port_pool_uses = 100;
 	cfg->incoming_num_tcp = 10;
 #else
 	cfg->outgoing_num_ports = 48; /* windows is limited in num fds */
@@ -131,13 +134,21 @@ config_create(void)
 	cfg->outgoing_num_tcp = 2; /* leaves 64-52=12 for: 4if,1stop,thread4 */
 	cfg->incoming_num_tcp = 2; 
 #endif
+	cfg->incoming_tcp_pipeline = 32;
+	cfg->incoming_tcp_pipeline_total = 512;
+	cfg->tcp_reuse_timeout = 60000;
+	cfg->max_reuse_tcp_queries = 200;
 	cfg->edns_buffer_size = 4096; /* 4k from rfc recommendation */
 	cfg->msg_buffer_size = 65552; /* 64 k + a small margin */
 	cfg->msg_cache_size = 4 * 1024 * 1024;
 	cfg->msg_cache_slabs = 4;
 	cfg->jostle_time = 200;
+	cfg->jostle_adaptive = 0;
 	cfg->rrset_cache_size = 4 * 1024 * 1024;
 	cfg->rrset_cache_slabs = 4;
+	cfg->cache_clock_eviction = 0;
+	cfg->cache_snapshot_file = NULL;
+	cfg->wire_cache_size = 0;
 	cfg->host_ttl = 900;
 	cfg->bogus_ttl = 60;
 	cfg->min_ttl = 0;
@@ -147,6 +158,8 @@ config_create(void)
 	cfg->prefetch_key = 0;
 	cfg->infra_cache_slabs = 4;
 	cfg->infra_cache_numhosts = 10000;
+	cfg->infra_cache_server_shared = 0;
+	cfg->server_selection_percentile = 0;
 	cfg->infra_cache_min_rtt = 50;
 	cfg->delay_close = 0;
 	if(!(cfg->outgoing_avail_ports = (int*)calloc(65536, sizeof(int))))
@@ -160,6 +173,7 @@ config_create(void)
 	if(!(cfg->logfile = strdup(""))) goto error_exit;
 	if(!(cfg->pidfile = strdup(PIDFILE))) goto error_exit;
 	if(!(cfg->target_fetch_policy = strdup("3 2 1 0 0"))) goto error_exit;
+	cfg->target_fetch_fanout = 0;
 	cfg->donotqueryaddrs = NULL;
 	cfg->donotquery_localhost = 1;
 	cfg->root_hints = NULL;
@@ -169,6 +183,11 @@ config_create(void)
 	cfg->so_rcvbuf = 0;
 	cfg->so_sndbuf = 0;
 	cfg->so_reuseport = 0;
+	cfg->so_reuseport_cbpf = 0;
+	cfg->inflight_dedup = 0;
+	cfg->cpu_affinity = 0;
+	if(!(cfg->cpu_affinity_list = strdup(""))) goto error_exit;
+	cfg->udp_batch_size = 0;
 	cfg->ip_transparent = 0;
 	cfg->ip_freebind = 0;
 	cfg->num_ifs = 0;
@@ -228,7 +247,13 @@ config_create(void)
 	cfg->permit_small_holddown = 0;
 	cfg->key_cache_size = 4 * 1024 * 1024;
 	cfg->key_cache_slabs = 4;
+	cfg->sig_cache_size = 1 * 1024 * 1024;
+	cfg->crypto_threads = 0;
+	cfg->nsec3_cache_size = 1 * 1024 * 1024;
+	cfg->val_nsec3_max_iterations = 2500;
 	cfg->neg_cache_size = 1 * 1024 * 1024;
+	cfg->neg_cache_slabs = 4;
+	cfg->aggressive_nsec = 0;
 	cfg->local_zones = NULL;
 	cfg->local_zones_nodefault = NULL;
 	cfg->local_zones_disable_default = 0;
@@ -243,6 +268,7 @@ config_create(void)
 	cfg->remote_control_use_cert = 1;
 	cfg->minimal_responses = 0;
 	cfg->rrset_roundrobin = 0;
+	cfg->compression_hash = 0;
 	cfg->max_udp_size = 4096;
 	if(!(cfg->server_key_file = strdup(RUN_DIR"/unbound_server.key"))) 
 		goto error_exit;
@@ -275,6 +301,11 @@ config_create(void)
 	cfg->ratelimit_below_domain = NULL;
 	cfg->ip_ratelimit_factor = 10;
 	cfg->ratelimit_factor = 10;
+	cfg->ip_ratelimit_burst = 0;
+	cfg->ratelimit_burst = 0;
+	cfg->ip_ratelimit_ipv4_prefix = 32;
+	cfg->ip_ratelimit_ipv6_prefix = 128;
+	cfg->ip_ratelimit_exempt = NULL;
 	cfg->qname_minimisation = 0;
 	cfg->qname_minimisation_strict = 0;
 	cfg->shm_enable = 0;
@@ -327,6 +358,7 @@ struct config_file* config_create_forlib(void)
 	cfg->key_cache_size = 1024*1024;
 	cfg->key_cache_slabs = 1;
 	cfg->neg_cache_size = 100 * 1024;
+	cfg->neg_cache_slabs = 1;
 	cfg->donotquery_localhost = 0; /* allow, so that you can ask a
 		forward nameserver running on localhost */
 	cfg->val_log_level = 2; /* to fill why_bogus with */
@@ -449,20 +481,38 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_NUMBER_NONZERO("port:", port)
 	else S_NUMBER_NONZERO("outgoing-range:", outgoing_num_ports)
 	else S_SIZET_OR_ZERO("outgoing-num-tcp:", outgoing_num_tcp)
+	else S_YNO("outgoing-batch:", outgoing_batch)
+	else S_NUMBER_OR_ZERO("outgoing-port-pool:", outgoing_port_pool)
+	else S_NUMBER_NONZERO("outgoing-port-pool-uses:",
+		outgoing_port_pool_uses)
 	else S_SIZET_OR_ZERO("incoming-num-tcp:", incoming_num_tcp)
+	else S_NUMBER_OR_ZERO("incoming-tcp-pipeline:", incoming_tcp_pipeline)
+	else S_NUMBER_NONZERO("incoming-tcp-pipeline-total:",
+		incoming_tcp_pipeline_total)
+	else S_NUMBER_OR_ZERO("tcp-reuse-timeout:", tcp_reuse_timeout)
+	else S_NUMBER_NONZERO("max-reuse-tcp-queries:", max_reuse_tcp_queries)
 	else S_SIZET_NONZERO("edns-buffer-size:", edns_buffer_size)
 	else S_SIZET_NONZERO("msg-buffer-size:", msg_buffer_size)
 	else S_MEMSIZE("msg-cache-size:", msg_cache_size)
 	else S_POW2("msg-cache-slabs:", msg_cache_slabs)
 	else S_SIZET_NONZERO("num-queries-per-thread:",num_queries_per_thread)
+	else S_YNO("inflight-dedup:", inflight_dedup)
 	else S_SIZET_OR_ZERO("jostle-timeout:", jostle_time)
+	else S_YNO("jostle-adaptive:", jostle_adaptive)
 	else S_MEMSIZE("so-rcvbuf:", so_rcvbuf)
 	else S_MEMSIZE("so-sndbuf:", so_sndbuf)
 	else S_YNO("so-reuseport:", so_reuseport)
+	else S_YNO("so-reuseport-cbpf:", so_reuseport_cbpf)
+	else S_YNO("cpu-affinity:", cpu_affinity)
+	else S_STR("cpu-affinity-list:", cpu_affinity_list)
+	else S_NUMBER_OR_ZERO("udp-batch-size:", udp_batch_size)
 	else S_YNO("ip-transparent:", ip_transparent)
 	else S_YNO("ip-freebind:", ip_freebind)
 	else S_MEMSIZE("rrset-cache-size:", rrset_cache_size)
 	else S_POW2("rrset-cache-slabs:", rrset_cache_slabs)
+	else S_YNO("cache-clock-eviction:", cache_clock_eviction)
+	else S_STR("cache-snapshot-file:", cache_snapshot_file)
+	else S_MEMSIZE("wire-cache-size:", wire_cache_size)
 	else S_YNO("prefetch:", prefetch)
 	else S_YNO("prefetch-key:", prefetch_key)
 	else if(strcmp(opt, "cache-max-ttl:") == 0)
@@ -478,6 +528,9 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_NUMBER_OR_ZERO("infra-host-ttl:", host_ttl)
 	else S_POW2("infra-cache-slabs:", infra_cache_slabs)
 	else S_SIZET_NONZERO("infra-cache-numhosts:", infra_cache_numhosts)
+	else S_YNO("infra-cache-server-shared:", infra_cache_server_shared)
+	else S_NUMBER_OR_ZERO("server-selection-percentile:",
+		server_selection_percentile)
 	else S_NUMBER_OR_ZERO("delay-close:", delay_close)
 	else S_STR("chroot:", chrootdir)
 	else S_STR("username:", username)
@@ -490,6 +543,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_STR("version:", version)
 	else S_STRLIST("root-hints:", root_hints)
 	else S_STR("target-fetch-policy:", target_fetch_policy)
+	else S_NUMBER_OR_ZERO("target-fetch-fanout:", target_fetch_fanout)
 	else S_YNO("harden-glue:", harden_glue)
 	else S_YNO("harden-short-bufsize:", harden_short_bufsize)
 	else S_YNO("harden-large-queries:", harden_large_queries)
@@ -522,6 +576,8 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("ignore-cd-flag:", ignore_cd)
 	else S_YNO("serve-expired:", serve_expired)
 	else S_STR("val-nsec3-keysize-iterations:", val_nsec3_key_iterations)
+	else S_NUMBER_OR_ZERO("val-nsec3-max-iterations:",
+		val_nsec3_max_iterations)
 	else S_UNSIGNED_OR_ZERO("add-holddown:", add_holddown)
 	else S_UNSIGNED_OR_ZERO("del-holddown:", del_holddown)
 	else S_UNSIGNED_OR_ZERO("keep-missing:", keep_missing)
@@ -530,9 +586,15 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	  autr_permit_small_holddown = cfg->permit_small_holddown; }
 	else S_MEMSIZE("key-cache-size:", key_cache_size)
 	else S_POW2("key-cache-slabs:", key_cache_slabs)
+	else S_MEMSIZE("sig-cache-size:", sig_cache_size)
+	else S_NUMBER_OR_ZERO("crypto-threads:", crypto_threads)
+	else S_MEMSIZE("nsec3-cache-size:", nsec3_cache_size)
 	else S_MEMSIZE("neg-cache-size:", neg_cache_size)
+	else S_POW2("neg-cache-slabs:", neg_cache_slabs)
+	else S_YNO("aggressive-nsec:", aggressive_nsec)
 	else S_YNO("minimal-responses:", minimal_responses)
 	else S_YNO("rrset-roundrobin:", rrset_roundrobin)
+	else S_YNO("compression-hash:", compression_hash)
 	else S_STRLIST("local-data:", local_data)
 	else S_YNO("unblock-lan-zones:", unblock_lan_zones)
 	else S_YNO("insecure-lan-zones:", insecure_lan_zones)
@@ -602,6 +664,13 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_POW2("ratelimit-slabs:", ratelimit_slabs)
 	else S_NUMBER_OR_ZERO("ip-ratelimit-factor:", ip_ratelimit_factor)
 	else S_NUMBER_OR_ZERO("ratelimit-factor:", ratelimit_factor)
+	else S_NUMBER_OR_ZERO("ip-ratelimit-burst:", ip_ratelimit_burst)
+	else S_NUMBER_OR_ZERO("ratelimit-burst:", ratelimit_burst)
+	else S_NUMBER_OR_ZERO("ip-ratelimit-ipv4-prefix:",
+		ip_ratelimit_ipv4_prefix)
+	else S_NUMBER_OR_ZERO("ip-ratelimit-ipv6-prefix:",
+		ip_ratelimit_ipv6_prefix)
+	else S_STRLIST("ip-ratelimit-exempt:", ip_ratelimit_exempt)
 	else S_YNO("qname-minimisation:", qname_minimisation)
 	else S_YNO("qname-minimisation-strict:", qname_minimisation_strict)
 #ifdef USE_IPSECMOD
@@ -815,20 +884,37 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "port", port)
 	else O_DEC(opt, "outgoing-range", outgoing_num_ports)
 	else O_DEC(opt, "outgoing-num-tcp", outgoing_num_tcp)
+	else O_YNO(opt, "outgoing-batch", outgoing_batch)
+	else O_DEC(opt, "outgoing-port-pool", outgoing_port_pool)
+	else O_DEC(opt, "outgoing-port-pool-uses", outgoing_port_pool_uses)
 	else O_DEC(opt, "incoming-num-tcp", incoming_num_tcp)
+	else O_DEC(opt, "incoming-tcp-pipeline", incoming_tcp_pipeline)
+	else O_DEC(opt, "incoming-tcp-pipeline-total",
+		incoming_tcp_pipeline_total)
+	else O_DEC(opt, "tcp-reuse-timeout", tcp_reuse_timeout)
+	else O_DEC(opt, "max-reuse-tcp-queries", max_reuse_tcp_queries)
 	else O_DEC(opt, "edns-buffer-size", edns_buffer_size)
 	else O_DEC(opt, "msg-buffer-size", msg_buffer_size)
 	else O_MEM(opt, "msg-cache-size", msg_cache_size)
 	else O_DEC(opt, "msg-cache-slabs", msg_cache_slabs)
 	else O_DEC(opt, "num-queries-per-thread", num_queries_per_thread)
 	else O_UNS(opt, "jostle-timeout", jostle_time)
+	else O_YNO(opt, "jostle-adaptive", jostle_adaptive)
 	else O_MEM(opt, "so-rcvbuf", so_rcvbuf)
 	else O_MEM(opt, "so-sndbuf", so_sndbuf)
 	else O_YNO(opt, "so-reuseport", so_reuseport)
+	else O_YNO(opt, "so-reuseport-cbpf", so_reuseport_cbpf)
+	else O_YNO(opt, "inflight-dedup", inflight_dedup)
+	else O_YNO(opt, "cpu-affinity", cpu_affinity)
+	else O_STR(opt, "cpu-affinity-list", cpu_affinity_list)
+	else O_DEC(opt, "udp-batch-size", udp_batch_size)
 	else O_YNO(opt, "ip-transparent", ip_transparent)
 	else O_YNO(opt, "ip-freebind", ip_freebind)
 	else O_MEM(opt, "rrset-cache-size", rrset_cache_size)
 	else O_DEC(opt, "rrset-cache-slabs", rrset_cache_slabs)
+	else O_YNO(opt, "cache-clock-eviction", cache_clock_eviction)
+	else O_STR(opt, "cache-snapshot-file", cache_snapshot_file)
+	else O_MEM(opt, "wire-cache-size", wire_cache_size)
 	else O_YNO(opt, "prefetch-key", prefetch_key)
 	else O_YNO(opt, "prefetch", prefetch)
 	else O_DEC(opt, "cache-max-ttl", max_ttl)
@@ -838,6 +924,9 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "infra-cache-slabs", infra_cache_slabs)
 	else O_DEC(opt, "infra-cache-min-rtt", infra_cache_min_rtt)
 	else O_MEM(opt, "infra-cache-numhosts", infra_cache_numhosts)
+	else O_YNO(opt, "infra-cache-server-shared", infra_cache_server_shared)
+	else O_DEC(opt, "server-selection-percentile",
+		server_selection_percentile)
 	else O_UNS(opt, "delay-close", delay_close)
 	else O_YNO(opt, "do-ip4", do_ip4)
 	else O_YNO(opt, "do-ip6", do_ip6)
@@ -866,6 +955,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_STR(opt, "identity", identity)
 	else O_STR(opt, "version", version)
 	else O_STR(opt, "target-fetch-policy", target_fetch_policy)
+	else O_DEC(opt, "target-fetch-fanout", target_fetch_fanout)
 	else O_YNO(opt, "harden-short-bufsize", harden_short_bufsize)
 	else O_YNO(opt, "harden-large-queries", harden_large_queries)
 	else O_YNO(opt, "harden-glue", harden_glue)
@@ -886,13 +976,19 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "ignore-cd-flag", ignore_cd)
 	else O_YNO(opt, "serve-expired", serve_expired)
 	else O_STR(opt, "val-nsec3-keysize-iterations",val_nsec3_key_iterations)
+	else O_DEC(opt, "val-nsec3-max-iterations", val_nsec3_max_iterations)
 	else O_UNS(opt, "add-holddown", add_holddown)
 	else O_UNS(opt, "del-holddown", del_holddown)
 	else O_UNS(opt, "keep-missing", keep_missing)
 	else O_YNO(opt, "permit-small-holddown", permit_small_holddown)
 	else O_MEM(opt, "key-cache-size", key_cache_size)
 	else O_DEC(opt, "key-cache-slabs", key_cache_slabs)
+	else O_MEM(opt, "sig-cache-size", sig_cache_size)
+	else O_DEC(opt, "crypto-threads", crypto_threads)
+	else O_MEM(opt, "nsec3-cache-size", nsec3_cache_size)
 	else O_MEM(opt, "neg-cache-size", neg_cache_size)
+	else O_DEC(opt, "neg-cache-slabs", neg_cache_slabs)
+	else O_YNO(opt, "aggressive-nsec", aggressive_nsec)
 	else O_YNO(opt, "control-enable", remote_control_enable)
 	else O_DEC(opt, "control-port", control_port)
 	else O_STR(opt, "server-key-file", server_key_file)
@@ -915,6 +1011,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_UNS(opt, "val-override-date", val_date_override)
 	else O_YNO(opt, "minimal-responses", minimal_responses)
 	else O_YNO(opt, "rrset-roundrobin", rrset_roundrobin)
+	else O_YNO(opt, "compression-hash", compression_hash)
 #ifdef CLIENT_SUBNET
 	else O_LST(opt, "send-client-subnet", client_subnet)
 	else O_LST(opt, "client-subnet-zone", client_subnet_zone)
@@ -974,6 +1071,11 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_LS2(opt, "ratelimit-below-domain", ratelimit_below_domain)
 	else O_DEC(opt, "ip-ratelimit-factor", ip_ratelimit_factor)
 	else O_DEC(opt, "ratelimit-factor", ratelimit_factor)
+	else O_DEC(opt, "ip-ratelimit-burst", ip_ratelimit_burst)
+	else O_DEC(opt, "ratelimit-burst", ratelimit_burst)
+	else O_DEC(opt, "ip-ratelimit-ipv4-prefix", ip_ratelimit_ipv4_prefix)
+	else O_DEC(opt, "ip-ratelimit-ipv6-prefix", ip_ratelimit_ipv6_prefix)
+	else O_LST(opt, "ip-ratelimit-exempt", ip_ratelimit_exempt)
 	else O_DEC(opt, "val-sig-skew-min", val_sig_skew_min)
 	else O_DEC(opt, "val-sig-skew-max", val_sig_skew_max)
 	else O_YNO(opt, "qname-minimisation", qname_minimisation)
@@ -1264,6 +1366,8 @@ config_delete(struct config_file* cfg)
 	free(cfg->directory);
 	free(cfg->logfile);
 	free(cfg->pidfile);
+	free(cfg->cpu_affinity_list);
+	free(cfg->cache_snapshot_file);
 	free(cfg->target_fetch_policy);
 	free(cfg->ssl_service_key);
 	free(cfg->ssl_service_pem);
@@ -1317,6 +1421,7 @@ config_delete(struct config_file* cfg)
 	free(cfg->dnstap_identity);
 	free(cfg->dnstap_version);
 	config_deldblstrlist(cfg->ratelimit_for_domain);
+	config_delstrlist(cfg->ip_ratelimit_exempt);
 	config_deldblstrlist(cfg->ratelimit_below_domain);
 #ifdef USE_IPSECMOD
 	free(cfg->ipsecmod_hook);
@@ -1393,6 +1498,72 @@ cfg_mark_ports(const char* str, int allow, int* avail, int num)
 	return 1;
 }
 
+/** parse a CPU number from the string, returns false on failure */
+static int
+cfg_parse_cpu_num(const char* str, char** end, int* cpu)
+{
+	long n;
+	if(!isdigit((unsigned char)*str))
+		return 0;
+	n = strtol(str, end, 10);
+	if(n < 0 || n > 65535)
+		return 0;
+	*cpu = (int)n;
+	return 1;
+}
+
+int
+cfg_parse_cpu_list(const char* str, int** cpus)
+{
+	const char* p = str;
+	char* end;
+	int num = 0, max = 0;
+	*cpus = NULL;
+	while(*p) {
+		int low, high, i;
+		if(isspace((unsigned char)*p) || *p == ',') {
+			p++;
+			continue;
+		}
+		if(!cfg_parse_cpu_num(p, &end, &low)) {
+			log_err("cannot parse cpu number in '%s'", str);
+			goto fail;
+		}
+		high = low;
+		if(*end == '-') {
+			if(!cfg_parse_cpu_num(end+1, &end, &high)
+				|| high < low) {
+				log_err("cannot parse cpu range in '%s'", str);
+				goto fail;
+			}
+		}
+		if(*end && !isspace((unsigned char)*end) && *end != ',') {
+			log_err("cannot parse cpu list '%s'", str);
+			goto fail;
+		}
+		p = end;
+		for(i=low; i<=high; i++) {
+			if(num == max) {
+				int* a;
+				max = (max?max*2:16);
+				a = (int*)reallocarray(*cpus, (size_t)max,
+					sizeof(int));
+				if(!a) {
+					log_err("out of memory");
+					goto fail;
+				}
+				*cpus = a;
+			}
+			(*cpus)[num++] = i;
+		}
+	}
+	return num;
+fail:
+	free(*cpus);
+	*cpus = NULL;
+	return -1;
+}
+
 int 
 cfg_scan_ports(int* avail, int num)
 {
@@ -1803,6 +1974,7 @@ config_apply(struct config_file* config)
 	EDNS_ADVERTISED_SIZE = (uint16_t)config->edns_buffer_size;
 	MINIMAL_RESPONSES = config->minimal_responses;
 	RRSET_ROUNDROBIN = config->rrset_roundrobin;
+	COMPRESSION_HASH = config->compression_hash;
 	log_set_time_asc(config->log_time_ascii);
 	autr_permit_small_holddown = config->permit_small_holddown;
 }
@@ -103,10 +103,25 @@ struct config_file {
 
 	/** outgoing port range number of ports (per thread) */
 	int outgoing_num_ports;
+	/** if outgoing udp queries are sent in batches per server */
+	int outgoing_batch;
+	/** number of outgoing udp ports kept open in a pool (per thread) */
+	int outgoing_port_pool;
+	/** number of queries on a pool port before it is replaced */
+	int outgoing_port_pool_uses;
 	/** number of outgoing tcp buffers per (per thread) */
 	size_t outgoing_num_tcp;
 	/** number of incoming tcp buffers per (per thread) */
 	size_t incoming_num_tcp;
+	/** max number of queries outstanding on an incoming tcp stream */
+	int incoming_tcp_pipeline;
+	/** max number of queries outstanding on all incoming tcp streams
+	 * (per thread) */
+	int incoming_tcp_pipeline_total;
+	/** msec an idle outgoing tcp stream is kept open for reuse */
+	int tcp_reuse_timeout;
+	/** max number of queries sent on one outgoing tcp stream */
+	int max_reuse_tcp_queries;
 	/** allowed udp port numbers, array with 0 if not allowed */
 	int* outgoing_avail_ports;
 
@@ -120,18 +135,34 @@ struct config_file {
 	size_t msg_cache_slabs;
 	/** number of queries every thread can service */
 	size_t num_queries_per_thread;
+	/** if threads wait for the same query in flight in another thread */
+	int inflight_dedup;
 	/** number of msec to wait before items can be jostled out */
 	size_t jostle_time;
+	/** if the jostle list is scored with the infra cache data */
+	int jostle_adaptive;
 	/** size of the rrset cache */
 	size_t rrset_cache_size;
 	/** slabs in the rrset cache */
 	size_t rrset_cache_slabs;
+	/** use CLOCK eviction, not LRU, for the message, rrset, infra and
+	 * key caches, so cache lookups do not lock the hashtable */
+	int cache_clock_eviction;
+	/** file to save the message and rrset cache to on exit, and to
+	 * load them from on start, or NULL if not used */
+	char* cache_snapshot_file;
+	/** size of the per thread cache of encoded replies, 0 is off */
+	size_t wire_cache_size;
 	/** host cache ttl in seconds */
 	int host_ttl;
 	/** number of slabs in the infra host cache */
 	size_t infra_cache_slabs;
 	/** max number of hosts in the infra cache */
 	size_t infra_cache_numhosts;
+	/** if rtt and edns are shared per server, between its zones */
+	int infra_cache_server_shared;
+	/** percentile of the latency histogram for server selection, 0 off */
+	int server_selection_percentile;
 	/** min value for infra cache rtt */
 	int infra_cache_min_rtt;
 	/** delay close of udp-timeouted ports, if 0 no delayclose. in msec */
@@ -139,6 +170,9 @@ struct config_file {
 
 	/** the target fetch policy for the iterator */
 	char* target_fetch_policy;
+	/** fetch all missing targets in parallel when a delegation has no
+	 * addresses, until this many addresses are known. 0 is off */
+	int target_fetch_fanout;
 
 	/** automatic interface for incoming messages. Uses ipv6 remapping,
 	 * and recvmsg/sendmsg ancillary data to detect interfaces, boolean */
@@ -149,6 +183,16 @@ struct config_file {
 	size_t so_sndbuf;
 	/** SO_REUSEPORT requested on port 53 sockets */
 	int so_reuseport;
+	/** attach a BPF program that steers packets to the thread on the
+	 * CPU that received them, for the so-reuseport sockets */
+	int so_reuseport_cbpf;
+	/** pin the threads to CPUs */
+	int cpu_affinity;
+	/** list of CPUs to pin the threads to, or "" for all allowed CPUs */
+	char* cpu_affinity_list;
+	/** number of UDP datagrams to read and reply to with one recvmmsg
+	 * and sendmmsg call on port 53 sockets, 0 or 1 is not batched. */
+	int udp_batch_size;
 	/** IP_TRANSPARENT socket option requested on port 53 sockets */
 	int ip_transparent;
 	/** IP_FREEBIND socket option request on port 53 sockets */
@@ -306,6 +350,8 @@ struct config_file {
 	int serve_expired;
 	/** nsec3 maximum iterations per key size, string */
 	char* val_nsec3_key_iterations;
+	/** nsec3 maximum iterations for any key size */
+	int val_nsec3_max_iterations;
 	/** autotrust add holddown time, in seconds */
 	unsigned int add_holddown;
 	/** autotrust del holddown time, in seconds */
@@ -319,8 +365,19 @@ struct config_file {
 	size_t key_cache_size;
 	/** slabs in the key cache. */
 	size_t key_cache_slabs;
+	/** size of the verified signature cache, 0 disables it */
+	size_t sig_cache_size;
+	/** number of threads that verify signatures, 0 verifies in the
+	 * worker threads */
+	int crypto_threads;
+	/** size of the NSEC3 hash cache, 0 disables it */
+	size_t nsec3_cache_size;
 	/** size of the neg cache */
 	size_t neg_cache_size;
+	/** number of slabs in the neg cache */
+	size_t neg_cache_slabs;
+	/** synthesize NXDOMAIN and NODATA answers from the neg cache */
+	int aggressive_nsec;
 
 	/** local zones config */
 	struct config_str2list* local_zones;
@@ -389,6 +446,9 @@ struct config_file {
 	/* RRSet roundrobin */
 	int rrset_roundrobin;
 
+	/* name compression in replies with a hash table, not the tree */
+	int compression_hash;
+
 	/* maximum UDP response size */
 	size_t max_udp_size;
 
@@ -435,6 +495,14 @@ struct config_file {
 	size_t ip_ratelimit_size;
 	/** ip_ratelimit factor, 0 blocks all, 10 allows 1/10 of traffic */
 	int ip_ratelimit_factor;
+	/** ip_ratelimit token bucket size in queries, 0 uses qps counters */
+	int ip_ratelimit_burst;
+	/** prefix length that ipv4 clients are aggregated to for ratelimit */
+	int ip_ratelimit_ipv4_prefix;
+	/** prefix length that ipv6 clients are aggregated to for ratelimit */
+	int ip_ratelimit_ipv6_prefix;
+	/** netblocks that are exempt from the ip_ratelimit */
+	struct config_strlist* ip_ratelimit_exempt;
 
 	/** ratelimit for domains. 0 is off, otherwise qps (unless overridden) */
 	int ratelimit;
@@ -448,6 +516,8 @@ struct config_file {
 	struct config_str2list* ratelimit_below_domain;
 	/** ratelimit factor, 0 blocks all, 10 allows 1/10 of traffic */
 	int ratelimit_factor;
+	/** ratelimit token bucket size in queries, 0 uses qps counters */
+	int ratelimit_burst;
 	/** minimise outgoing QNAME and hide original QTYPE if possible */
 	int qname_minimisation;
 	/** minimise QNAME in strict mode, minimise according to RFC.
@@ -964,6 +1034,16 @@ int cfg_parse_local_zone(struct config_file* cfg, const char* val);
  */
 int cfg_mark_ports(const char* str, int allow, int* avail, int num);
 
+/**
+ * Parse a CPU list, like "0 2 4-7" or "0,1", into an array of CPU numbers.
+ * @param str: the string to parse.
+ * @param cpus: the array is returned, malloced, the caller frees it.
+ *	NULL if the list is empty.
+ * @return the number of CPUs in the array, or -1 on a parse or malloc
+ *	error (and an error is logged).
+ */
+int cfg_parse_cpu_list(const char* str, int** cpus);
+
 /**
  * Get a condensed list of ports returned. allocated.
  * @param cfg: config file.
@@ -363,8 +363,8 @@ static void yynoreturn yy_fatal_error (yyconst char* msg  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 244
-#define YY_END_OF_BUFFER 245
+#define YY_NUM_RULES 275
+#define YY_END_OF_BUFFER 276
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -372,272 +372,310 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[2395] =
+static yyconst flex_int16_t yy_accept[2746] =
     {   0,
-        1,    1,  226,  226,  230,  230,  234,  234,  238,  238,
-        1,    1,  245,  242,    1,  224,  224,  243,    2,  243,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  226,  227,  227,  228,  243,  230,  231,  231,
-      232,  243,  237,  234,  235,  235,  236,  243,  238,  239,
-      239,  240,  243,  241,  225,    2,  229,  243,  241,  242,
-        0,    1,    2,    2,    2,    2,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  226,    0,  230,    0,
-      237,    0,  234,  238,    0,  241,    0,    2,    2,  241,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  241,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,   91,  242,  242,  242,  242,  242,
-      242,  242,  241,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,   77,  242,  242,  242,  242,  242,
-      242,    8,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,   94,  242,  241,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      241,  242,  242,  242,  242,  242,  242,  242,  242,   37,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  176,  242,   14,   15,  242,   18,   17,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,   90,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  162,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,    3,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  241,  242,  242,  242,  242,  221,  242,  242,
-
-      220,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      233,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,   40,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,   41,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  151,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,   20,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  109,  242,  242,  233,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  203,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  126,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  108,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,   75,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,   25,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,   38,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,   89,  242,
-      242,   88,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,   39,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  127,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,   28,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  191,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,   32,  242,   33,  242,  242,
-      242,   78,  242,   79,  242,  242,   76,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,    7,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      169,  242,  242,  242,  242,  111,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,   29,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  143,  242,  142,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,   16,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,   42,  242,  242,  242,
-      242,  242,  242,  242,  150,  242,  242,  242,  242,   81,
-       80,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      137,  242,  242,  242,  242,  242,  242,  242,  242,   95,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,   60,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  242,  242,  242,   64,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,   36,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      140,  141,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,    6,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  201,  242,  242,  222,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,   26,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  133,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  155,  242,  134,  242,  242,  167,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,   27,  242,  242,  242,  242,
-      242,   93,   84,  242,   85,  242,   83,  242,  242,  242,
-      242,  242,  242,  242,  242,  106,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  190,  242,  242,
-      242,  242,  242,  242,  242,  242,  135,  242,  242,  242,
-      242,  242,  138,  242,  242,  166,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,   74,
-
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,   34,  242,
-      242,   22,  242,  242,  242,  242,   19,  242,  116,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,   49,   51,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  205,  242,
-      242,  242,  177,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,   86,  242,  242,
-      242,  242,  242,  242,  242,  105,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  216,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  110,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  161,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  125,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  121,
-      242,  128,  242,  242,  242,  242,  242,   98,  242,  242,
-       70,  242,  242,  242,  242,  153,  242,  242,  242,  242,
-      242,  168,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  182,  242,  242,  242,  242,  242,
-
-       92,  242,  242,  242,  242,  242,  242,  242,  242,  124,
-      242,  242,  242,  242,  242,   52,   53,  242,  242,  242,
-      242,  242,   35,  242,  242,  242,  242,  242,   59,  129,
-      242,  144,  242,  170,  139,  242,  242,  242,   45,  242,
-      131,  242,  242,  242,  242,  242,    9,  242,  242,  242,
-       73,  242,  242,  242,  242,  195,  242,  152,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  112,  204,  242,
-
-      242,  242,  242,  181,  242,  242,  242,  242,  242,  242,
-      242,  242,  163,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  219,  242,  130,  242,
-      242,  242,   44,   46,  242,  242,  242,  242,  242,  242,
-      242,   72,  242,  242,  242,  242,  193,  242,  200,  242,
-      242,  242,  242,  242,  157,   23,   24,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,   69,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  159,  156,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,  242,  242,   43,  242,
-      242,  242,  242,  242,  242,  242,  242,  107,   13,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  214,  242,
-      217,  242,  242,  242,  242,  242,  242,   12,  242,  242,
-       21,  242,  242,  242,  199,  242,  202,   47,  242,  165,
-      242,  158,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  120,  119,  242,  242,
-      242,  242,  242,  242,  242,  160,  154,  242,  242,  242,
-      206,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,   54,  242,  242,  242,  194,  242,  242,  242,
-      242,  242,  164,  242,  242,  242,  242,  242,  242,  242,
-      242,   48,  242,  242,  242,   82,  242,  113,  242,  115,
-      242,  145,  242,  242,  242,  118,  242,  242,  171,  242,
-      242,  242,  242,  242,  100,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  178,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      146,  242,  242,  192,  242,  218,  242,  242,  242,   30,
-      242,  242,  242,  242,    4,  242,  242,   99,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  174,
-
-      242,  242,  242,  242,  242,  242,  242,  207,  242,  242,
-      242,  242,  242,  242,  180,  242,  242,  149,  242,  242,
-      242,  242,  242,  242,  242,  242,   57,  242,   31,  198,
-      242,  175,  242,  242,   11,  242,  242,  242,  242,  242,
-      242,  147,   61,  242,  242,  242,  242,  242,  123,  242,
-      242,  242,  242,  242,  102,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  179,   96,  242,   87,  242,  242,
-      242,   63,   67,   62,  242,   55,  242,  242,  242,   10,
-      242,  242,  242,  196,  242,  242,  242,  242,  122,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-
-      242,  242,  242,  242,  242,  242,   68,   66,  242,   56,
-      215,  242,  242,  242,  136,  242,  242,  148,  242,  242,
-      242,  242,  242,  242,  114,   50,  242,  242,  242,  242,
-      242,  208,  242,  242,  242,  242,  242,  242,  242,   97,
-       65,  103,  104,   58,  242,  197,  117,  242,  242,  242,
-      242,  173,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,   71,  242,  172,  242,  189,  212,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,    5,  242,
-
-      242,  242,  213,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  101,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  132,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  209,  242,  242,  242,  242,  242,
-      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
-      242,  242,  223,  242,  242,  185,  242,  242,  242,  242,
-      242,  210,  242,  242,  242,  242,  242,  242,  211,  242,
-      242,  242,  183,  242,  186,  187,  242,  242,  242,  242,
-      242,  184,  188,    0
-
+        1,    1,  257,  257,  261,  261,  265,  265,  269,  269,
+        1,    1,  276,  273,    1,  255,  255,  274,    2,  274,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  257,  258,  258,  259,  274,  261,  262,
+      262,  263,  274,  268,  265,  266,  266,  267,  274,  269,
+      270,  270,  271,  274,  272,  256,    2,  260,  274,  272,
+      273,    0,    1,    2,    2,    2,    2,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  257,    0,  257,  261,    0,  261,
+      268,    0,  265,  268,  269,    0,  269,  272,    0,    2,
+        2,  272,  272,    2,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,    2,  272,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  102,  273,  273,  273,  273,  273,  273,
+      273,  273,  272,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+       88,  273,  273,  273,  273,  273,  273,  273,    8,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  105,  273,  273,  272,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  272,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,   42,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      202,  273,   18,   19,  273,   22,   21,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  101,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  179,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,    3,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  272,  273,  273,
+      273,  273,  273,  252,  273,  273,  273,  273,  251,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  264,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,   45,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,   46,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  168,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,   24,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  120,  273,  273,  273,  264,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  234,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      137,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  119,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,   86,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+       29,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,   43,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  100,  273,  273,  273,   99,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,   44,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  138,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,   32,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      217,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,   36,  273,   37,  273,  273,  273,
+
+       89,  273,   90,  273,  273,   87,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,    7,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  195,  273,
+      273,  273,  273,  122,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,   33,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  160,  273,  159,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,   20,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+       47,  273,  273,  273,  273,  273,  273,  273,  273,  167,
+      273,  273,  273,  273,  273,   92,   91,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  154,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  106,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,   70,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,   75,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,   41,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  157,
+      158,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,    6,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  232,  273,  273,  253,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,   30,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  150,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  172,  273,  273,
+      185,  273,  151,  273,  273,  193,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,   31,  273,  273,  273,  273,  273,  104,   95,
+
+      273,   96,  273,   94,  273,  273,  273,  273,  273,  273,
+      273,  273,  117,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  216,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  152,  273,  273,  273,
+      273,  273,  155,  273,  273,  273,  192,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,   85,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,   38,  273,  273,   26,
+      273,  273,  273,  273,  273,   23,  273,  127,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,   57,   59,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  236,  273,  273,  273,
+      203,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,   97,  273,  273,  273,  273,
+      273,  273,  273,  116,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  247,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+
+      273,  121,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  178,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  136,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  132,  273,  139,  273,  273,
+      273,  273,  273,  273,  273,  109,  273,  273,  273,  273,
+      273,   81,  273,  273,  273,  273,  273,  170,  273,  273,
+      273,  273,  143,  273,  273,  194,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  208,  273,
+
+      273,  273,  273,  273,  103,  273,  273,  273,  273,  273,
+      273,  273,  273,  135,  273,  273,  187,  273,  273,  273,
+      273,  273,   60,   61,  273,  273,  273,  273,  273,  273,
+      273,  273,   40,  273,  273,  273,  273,  273,  273,   69,
+      140,  273,  161,  273,  196,  156,  273,  273,  273,  273,
+       50,  273,  146,  273,  273,  273,  189,  273,  273,  273,
+      273,    9,  273,  273,  273,   84,  273,  273,  273,  273,
+      273,  221,  273,  169,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  142,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,   39,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  148,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  123,  235,  273,  273,
+      273,  273,  207,  273,  273,  273,  273,  273,  273,  273,
+      273,  180,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      250,  273,  188,  141,  273,  273,  273,  273,   49,   51,
+      147,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+       83,  273,  273,  227,  273,  273,  219,  273,  231,  273,
+
+      273,  273,  273,  273,  174,  273,  273,   27,   28,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,   80,  273,  273,  273,  273,  273,  273,  273,   56,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  183,
+      273,  273,  176,  173,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,   48,  273,
+      273,  273,  273,  273,  273,  273,  273,  118,   13,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  245,  273,  248,  273,  273,  273,
+      273,  273,  144,  273,  273,   12,  273,  273,  273,   25,
+
+      273,  273,  273,  225,  273,  233,   52,  273,  182,  273,
+      175,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      131,  130,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  177,  171,  186,  273,  273,  273,  237,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,   62,  273,  273,  273,  273,  273,  273,  273,  220,
+      273,  273,  273,  273,  273,  273,  181,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,   53,  273,  273,  184,
+
+      273,  273,   93,  273,  273,   16,  124,  273,  126,  273,
+      162,  273,  273,  273,  273,  129,  273,  273,  197,  273,
+      273,  273,  273,  273,  273,  273,  111,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  204,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  163,  273,  226,  273,  273,  273,
+      273,  218,  273,  249,  273,  273,  273,  273,   34,  273,
+      273,  273,  190,  273,  273,    4,  273,  273,  110,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  200,  273,  273,  273,   55,  273,  273,
+
+      273,  273,  273,  238,  273,  273,  273,  273,  273,  273,
+      206,  273,  273,  166,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,   67,  273,  273,   35,  230,  224,  273,
+      273,  273,  201,  273,  273,  273,   11,  273,  273,  273,
+      273,  273,  273,  273,  273,  164,   72,   71,  273,  273,
+      273,  273,  273,  273,  134,  273,  273,  273,   54,  273,
+      273,  113,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  205,  107,  273,   98,  273,  273,  273,   74,   78,
+       73,  273,  273,   63,  273,  273,  273,  273,  273,  273,
+      273,   10,  273,  273,  273,  273,  222,  273,  273,  273,
+
+      273,  273,  133,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,   79,   77,  273,  273,   14,   66,  273,  273,  273,
+      246,  273,  273,   17,  273,  273,  153,  273,  273,  273,
+      165,  273,  273,  273,  273,  273,  273,  273,  125,   58,
+      273,  273,  273,  273,  273,  239,  273,  273,  273,  273,
+      273,  273,  273,  108,   76,  273,  273,  273,  273,  114,
+      115,   68,  273,  273,  223,  273,  128,  273,  273,  273,
+      273,  273,  199,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  191,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  228,  229,  273,  273,  273,   82,  273,  145,  198,
+      273,  215,  243,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,   64,    5,  273,  273,  273,  273,  244,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,   15,   65,  273,  273,  112,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  149,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  240,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  254,  273,  273,  211,  273,  273,  273,
+      273,  273,  241,  273,  273,  273,  273,  273,  273,  242,
+      273,  273,  273,  209,  273,  212,  213,  273,  273,  273,
+      273,  273,  210,  214,    0
     } ;
 
 static yyconst YY_CHAR yy_ec[256] =
@@ -674,1598 +712,1492 @@ static yyconst YY_CHAR yy_ec[256] =
 
 static yyconst YY_CHAR yy_meta[41] =
     {   0,
-        1,    2,    3,    4,    5,    1,    6,    1,    1,    1,
-        1,    1,    7,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_uint16_t yy_base[2409] =
+static yyconst flex_uint16_t yy_base[2746] =
     {   0,
-        0,    0,   38,   41,   44,   46,   59,   65,   71,   77,
-       90,  112, 3231, 3060,   81, 4693, 4693, 4693,   96,   52,
-       72,   63,  107,  111,   70,   91,  109,  124,   98,  127,
-      114,  133,  136,  130,  144,  146,  163,  165,  171,  179,
-      186,  135, 2630, 4693, 4693, 4693,  164, 2594, 4693, 4693,
-     4693,   95, 2544, 2000, 4693, 4693, 4693,  211, 1777, 4693,
-     4693, 4693,  176, 1650, 4693,  215, 4693,  219,  147, 1368,
-      223,  151,    0,  230,    0,    0,  224,  188,   97,  225,
-      231,  158,  217,  182,  232,  233,  219,  156,  242,  235,
-      237,  239,  240,  243,  190,  248,  245,  260,  262,  246,
-
-      264,  267,  254,  268,  271,  276,  272,  277,  286,  287,
-      288,  290,  291,  292,  293,  295,  298,  302,  304,  303,
-      311,  310,  326,  300,  316,  324,  327,  328,  330,  331,
-      332,  334,  335,  338,  336,  345, 1325,  360, 1024,  315,
-      994,  367,  749,  583,  362,  514,  373,  377,    0,  369,
-      371,  379,  374,  375,  340,  362,  378,  380,  383,  387,
-      390,  392,  394,  404,  402,  406,  407,  399,  409,  411,
-      419,  417,  423,  424,  425,  429,  412,  431,  432,  433,
-      443,  435,  445,  452,  449,  460,  447,  462,  459,  457,
-      464,  465,  469,  477,  472,  388,  474,  473,  475,  476,
-
-      482,  483,  484,  485,  486,  487,  492,  488,  491,  494,
-      505,  501,  509,  504,  508,  511,  521,  512,  523,  513,
-      526,  529,  536,  538,  533,  177,  534,  537,  522,  540,
-      550,  551,  542,  553,  561,  556,  543,  546,  559,  560,
-      562,  563,  565,  569,  575,  574,  576,  578,  580,  582,
-      581,  585,  586,  594,  590,  599,  598,  600,  603,  611,
-      606,  591,  607,  610,  612,  614,  615,  616,  618,  621,
-      624,  627,  625,  635,  631,  632,  638,  639,  640,  643,
-      641,  649,  650,  660,  662,  651,  657,  666,  667,  670,
-      673,  679,  674,  677,  681,  663,  684,  691,  686,  687,
-
-      694,  690,  696,  697,  698,  703,  704,  711,  709,  708,
-      710,  715,  716,  718, 4693,  720,  726,  741,  727,  725,
-      751,  746,  717,  728,  733,  735,  749,  754,  770,  758,
-      759,  762,  763,  766,  765,  773,  772,  775,  776,  783,
-      784,  785,  786,  796,  788,  789,  795,  798,  797,  800,
-      802,  803,  807,  810,  813,  815,  816,  814,  822,  820,
-      836,  817,  833,  840,  841,  831,  842,  832,  847,  848,
-      849,  859,  854,  834,  857,  856,  860,  863,  864,  866,
-      867,  869,  871,  877, 4693,  879,  873,  875,  882,  884,
-      885, 4693,  887,  886,  888,  895,  890,  893,  896,  900,
-
-      909,  901,  911,  918,  913,  915,  916,  919,  922,  917,
-      923,  925,  924,  944,  929,  934,  930,  937,  935,  954,
-      939,  947,  933,  955,  961,  962,  964,  965,  966,  967,
-      968,  971,  978,  969, 4693,  973,  981,  986,  983,  987,
-      989,  992,  991,  997,  998, 1001, 1009, 1005, 1014, 1010,
-     1012, 1011, 1013, 1016, 1020, 1021, 1029, 1025, 1031, 1033,
-     1040, 1042, 1044, 1051, 1027, 1047, 1035, 1049, 1046, 1053,
-     1055, 1056, 1058, 1060, 1061, 1063, 1070, 1068, 1065, 1074,
-     1067, 1075, 1071, 1087, 1088, 1080, 1081, 1090, 1091, 1095,
-     1097, 1099, 1102, 1103, 1105, 1106, 1109, 1112, 1110, 1113,
-
-     1120, 1116, 1124, 1128, 1129, 1115, 1130, 1138, 1135, 1142,
-     1143, 1145, 1153, 1141, 1148, 1155, 1137, 1151, 1159, 1163,
-     1158, 1164, 1172, 1167, 1165, 1173, 1174, 1176, 1179, 1180,
-     1181, 1182, 1183, 1185, 1184, 1186, 1188, 1191, 1195, 1192,
-     1196, 1208, 1201, 1203, 1210, 1212, 1213, 1214, 1218, 1216,
-     1219, 1220, 1225, 1232, 1226, 1228, 1234, 1236, 1238, 1239,
-     1240, 1246, 1248, 1241, 1242, 1254, 1256, 1259, 1260, 4693,
-     1261, 1268, 1264, 1266, 1267, 1271, 1278, 1273, 1274, 1275,
-     1276, 1282, 4693, 1283, 4693, 4693, 1285, 4693, 4693, 1277,
-     1293, 1303, 1305, 1308, 1297, 1290, 1318, 1319, 1317, 1295,
-
-     1314, 1288, 1324, 1329, 1333, 1334, 1315, 1341, 1339, 1343,
-     1345, 1347, 1336, 1351, 1352, 1353, 1355, 1354, 1357, 1360,
-     1363, 1361, 1359, 1364, 1366, 4693, 1367, 1382, 1384, 1380,
-     1381, 1385, 1386, 1388, 1390, 1389, 1391, 1398, 1392, 1399,
-     1408, 1400, 4693, 1403, 1404, 1411, 1415, 1409, 1416, 1418,
-     1405, 1421, 1422, 1425, 4693, 1427, 1432, 1426, 1434, 1435,
-     1437, 1117, 1438, 1440, 1441, 1442, 1443, 1444, 1451, 1450,
-     1448, 1466, 1452, 1455, 1467, 1459, 1474, 1471, 1470, 1473,
-     1476, 1477, 1482, 1484, 1487, 1486, 1488, 1497, 1480, 1495,
-     1492, 1502, 1506, 1496, 1499, 1508, 1509, 4693, 1512, 1515,
-
-     4693, 1514, 1516, 1538, 1517, 1519, 1520, 1521, 1522, 1524,
-     1525, 1531, 1533, 1542, 1540, 1548, 1550, 1552, 1553, 1551,
-     1560, 1558, 1568, 1570, 1566, 1571, 1573, 1575, 1577, 1579,
-     1578, 1585, 1586, 1588, 1595, 1582, 1580, 1598, 1605, 1602,
-     4693, 1613, 1608, 1600, 1609, 1616, 1615, 1612, 1614, 1618,
-     1621, 1630, 1625, 1626, 1628, 1629, 1632, 1635, 1638, 1639,
-     1642, 4693, 1640, 1641, 1643, 1644, 1651, 1652, 1653, 1662,
-     1663, 1672, 1665, 4693, 1667, 1674, 1675, 1677, 1670, 1669,
-     1681, 1688, 1685, 1687, 1686, 1692, 1693, 1694, 1695, 1699,
-     1691, 4693, 1702, 1701, 1706, 1714, 1709, 1711, 1716, 1715,
-
-     1720, 1721, 1722, 1730, 1723, 1726, 4693, 1725, 1734, 1727,
-     1732, 1736, 1746, 1751, 1742, 1744, 1753, 1747, 1754, 1755,
-     1760, 1758, 1761, 1759, 1762, 4693, 1763, 1765,  145, 1769,
-     1771, 1773, 1774, 1781, 1785, 1784, 1788, 1791, 1792, 1793,
-     1795, 1797, 1780, 1798, 1801, 1802, 1804, 1808, 1809, 1811,
-     1810, 1815, 4693, 1813, 1818, 1819, 1824, 1825, 1832, 1833,
-     1835, 1836, 1839, 1837, 4693, 1846, 1841, 1843, 1847, 1849,
-     1852, 1853, 1854, 1857, 1859, 1860, 1862, 1863, 1868, 1865,
-     1866, 1870, 1873, 4693, 1884, 1875, 1877, 1876, 1887, 1888,
-     1899, 1891, 1894, 1901, 1902, 1915, 1904, 1897, 1911, 1912,
-
-     1916, 1909, 1922, 1925, 1931, 1919, 1926, 1936, 1929, 1933,
-     1946, 1948, 1944, 1950, 1947, 1952, 1957, 1958, 4693, 1960,
-     1959, 1962, 1966, 1977, 1968, 1970, 1972, 1937, 1973, 1978,
-     1981, 1984, 1985, 1986, 1989, 1997, 1990, 1999, 4693, 2001,
-     2002, 2000, 2009, 1992, 2014, 2010, 2006, 2017, 2018, 2020,
-     2021, 2023, 2026, 2032, 2022, 2024, 2034, 2035, 4693, 2042,
-     2043, 2039, 2051, 2046, 2047, 2049, 2053, 2050, 4693, 2054,
-     2056, 4693, 2063, 2058, 2061, 1895, 2059, 2062, 2064, 2067,
-     2068, 2071, 2077, 2076, 2069, 2083, 4693, 2084, 2091, 2086,
-     2094, 2096, 2097, 2098, 2099, 2106, 2100, 2111, 2115, 2109,
-
-     2117, 2101, 2121, 2118, 2122, 2124, 4693, 2125, 2128, 2126,
-     2131, 2132, 2133, 2134, 2135, 2137, 2138, 2141, 2147, 2153,
-     2142, 2155, 2161, 2156, 2159, 2163, 2167, 2174, 2175, 2176,
-     2178, 4693, 2181, 2166, 2173, 2183, 2185, 2187, 2186, 2188,
-     2190, 2192, 2191, 2194, 2195, 2204, 2212, 2197, 2205, 2207,
-     2209, 2219, 2215, 2216, 2221, 2229, 2218, 2220, 2225, 2230,
-     2222, 2231, 2232, 2233, 2240, 2238, 2246, 2248, 2251, 2254,
-     2256, 2257, 2258, 4693, 2242, 2259, 2269, 2261, 2272, 2274,
-     2263, 2271, 2273, 2285, 2281, 4693, 2282, 4693, 2286, 2287,
-     2290, 4693, 2295, 4693, 2297, 2292, 4693, 2298, 2302, 2299,
-
-     2304, 2305, 2307, 2310, 2309, 2312, 2313, 2316, 2318, 2320,
-     2322, 2323, 2325, 2326, 4693, 2335, 2328, 2337, 2338, 2340,
-     2330, 2332, 2347, 2343, 2341, 2353, 2349, 2363, 2358, 2365,
-     4693, 2360, 2367, 2362, 2364, 4693, 2368, 2371, 2375, 2369,
-     2373, 2379, 2377, 2384, 2386, 2382, 2387, 2395, 2396, 2388,
-     2399, 2400, 2403, 2413, 2408, 2410, 2411, 2412, 2414, 2416,
-     2423, 2421, 2428, 2418, 2427, 2420, 2429, 2431, 2435, 2437,
-     2438, 2439, 2442, 2443, 2446, 2444, 2445, 2447, 2448, 4693,
-     2451, 2458, 2462, 2459, 2466, 2463, 2468, 2470, 2471, 2472,
-     2475, 2474, 2473, 4693, 2476, 4693, 2479, 2485, 2494, 2495,
-
-     2490, 2497, 2499, 2501, 2500, 2505, 2503, 2513, 2521, 2506,
-     2511, 2516, 2508, 2523, 2518, 4693, 2525, 2527, 2528, 2531,
-     2532, 2533, 2536, 2540, 2535, 2560, 4693, 2548, 2543, 2556,
-     2563, 2562, 2564, 2565, 4693, 2546, 2574, 2569, 2570, 4693,
-     4693, 2572, 2575, 2576, 2577, 2578, 2580, 2587, 2584, 2585,
-     4693, 2599, 2586, 2588, 2596, 2602, 2604, 2605, 2590, 4693,
-     2608, 2611, 2612, 2615, 2616, 2617, 2618, 2619, 2627, 2620,
-     2624, 2625, 2634, 2635, 2641, 4693, 2643, 2636, 2647, 2644,
-     2649, 2650, 2652, 2654, 2655, 2657, 2658, 2659, 2662, 2664,
-     2660, 2661, 2666, 2667, 2678, 2687, 2669, 2680, 2671, 2684,
-
-     2689, 2693, 2694, 2696, 2697, 2701, 2698, 2709, 2704, 4693,
-     2711, 2706, 2716, 2708, 2712, 2720, 2721, 2723, 2713, 2728,
-     2729, 2736, 2731, 4693, 2740, 2738, 2735, 2742, 2741, 2750,
-     2745, 2743, 2746, 2758, 2747, 2759, 2755, 2761, 2764, 2769,
-     4693, 4693, 2762, 2766, 2777, 2770, 2772, 2780, 2774, 2781,
-     2778, 2786, 4693, 2788, 2790, 2791, 2792, 2801, 2803, 2806,
-     2807, 2808, 2794, 2796, 2798, 2813, 2809, 2818, 2819, 2821,
-     2822, 4693, 2824, 2823, 4693, 2828, 2825, 2831, 2830, 2833,
-     2834, 2841, 2835, 2846, 2848, 2855, 2852, 2859, 2863, 2867,
-     2854, 2862, 2870, 4693, 2865, 2869, 2866, 2871, 2881, 2872,
-
-     2882, 2879, 4693, 2883, 2884, 2888, 2890, 2892, 2899, 2895,
-     2897, 2898, 2900, 4693, 2903, 4693, 2907, 2905, 4693, 2906,
-     2911, 2914, 2916, 2913, 2920, 2921, 2928, 2924, 2929, 2930,
-     2931, 2932, 2934, 2941, 2933, 4693, 2942, 2937, 2940, 2951,
-     2945, 4693, 4693, 2953, 4693, 2946, 4693, 2956, 2959, 2963,
-     2961, 2964, 2966, 2970, 2967, 4693, 2972, 2974, 2976, 2980,
-     2981, 2983, 2984, 2985, 2982, 2986, 2987, 4693, 2990, 2988,
-     2992, 2998, 2999, 3004, 3009, 3003, 4693, 3012, 3011, 3015,
-     3020, 3021, 4693, 3018, 3022, 4693, 3026, 3030, 3005, 3032,
-     3034, 3038, 3039, 3035, 3041, 3048, 3045, 3046, 3047, 4693,
-
-     3049, 3051, 3057, 3062, 3052, 3054, 3064, 3066, 3070, 3069,
-     3075, 3077, 3073, 3084, 3079, 3088, 3080, 3083, 4693, 3091,
-     3092, 4693, 3090, 3093, 3094, 3098, 4693, 3099, 4693, 3101,
-     3102, 3104, 3106, 3108, 3110, 3111, 3116, 3121, 3122, 3123,
-     3124, 3133, 3130, 3129, 4693, 4693, 3135, 3141, 3136, 3144,
-     3146, 3139, 3148, 3158, 3150, 3154, 3157, 3165, 4693, 3160,
-     3161, 3168, 4693, 3163, 3169, 3170, 3171, 3173, 3176, 3175,
-     3180, 3183, 3177, 3184, 3182, 3185, 3196, 4693, 3190, 3197,
-     3198, 3199, 3200, 3201, 3202, 4693, 3210, 3206, 3211, 3203,
-     3212, 3215, 3229, 3232, 3234, 3224, 3227, 3235, 3237, 3242,
-
-     3238, 4693, 3245, 3244, 3247, 3207, 3252, 3254, 3255, 3257,
-     3248, 3259, 3261, 3262, 3263, 4693, 3265, 3269, 3271, 3273,
-     3275, 3277, 3278, 3279, 3285, 3286, 3287, 3288, 3292, 4693,
-     3289, 3294, 3296, 3297, 3299, 3300, 3304, 3306, 3308, 3310,
-     3312, 3314, 3316, 4693, 3320, 3322, 3321, 3324, 3328, 3325,
-     3329, 3333, 3331, 3335, 3338, 3341, 3339, 3351, 3352, 4693,
-     3342, 4693, 3354, 3357, 3361, 3359, 3364, 4693, 3365, 3366,
-     4693, 3367, 3369, 3372, 3370, 4693, 3371, 3373, 3376, 3377,
-     3391, 4693, 3393, 3394, 3383, 3401, 3404, 3400, 3402, 3405,
-     3403, 3407, 3408, 3409, 4693, 3413, 3411, 3419, 3420, 3412,
-
-     4693, 3422, 3423, 3424, 3426, 3429, 3436, 3433, 3431, 4693,
-     3435, 3438, 3447, 3440, 3450, 4693, 4693, 3444, 3453, 3456,
-     3445, 3460, 4693, 3462, 3463, 3455, 3465, 3468, 4693, 4693,
-     3470, 4693, 3472, 4693, 4693, 3473, 3474, 3476, 4693, 3481,
-     4693, 3488, 3483, 3485, 3486, 3487, 4693, 3491, 3493, 3495,
-     4693, 3489, 3502, 3497, 3499, 4693, 3504, 4693, 3506, 3512,
-     3513, 3517, 3509, 3516, 3520, 3522, 3527, 3529, 3524, 3531,
-     3532, 3534, 3535, 3537, 3538, 3539, 3540, 3541, 3543, 3548,
-     3551, 3552, 3553, 3554, 3555, 3562, 3556, 3558, 3560, 3564,
-     3567, 3571, 3568, 3574, 3581, 3584, 3588, 4693, 4693, 3590,
-
-     3575, 3586, 3592, 4693, 3594, 3595, 3596, 3599, 3598, 3600,
-     3603, 3601, 4693, 3605, 3606, 3608, 3609, 3610, 3612, 3617,
-     3622, 3623, 3628, 3632, 3639, 3629, 3634, 3624, 3636, 3637,
-     3640, 3645, 3644, 3652, 3653, 3659, 4693, 3648, 4693, 3654,
-     3656, 3661, 4693, 4693, 3662, 3665, 3670, 3664, 3666, 3672,
-     3673, 4693, 3674, 3681, 3687, 3675, 4693, 3691, 4693, 3693,
-     3678, 3695, 3696, 3699, 4693, 4693, 4693, 3702, 3683, 3700,
-     3706, 3704, 3707, 3711, 3710, 3708, 3712, 4693, 3714, 3717,
-     3719, 3723, 3726, 3731, 3728, 3732, 3739, 3736, 3742, 3734,
-     3740, 3747, 3751, 4693, 4693, 3744, 3752, 3754, 3756, 3758,
-
-     3765, 3760, 3762, 3766, 3768, 3769, 3771, 3770, 4693, 3778,
-     3774, 3772, 3773, 3780, 3784, 3787, 3785, 4693, 4693, 3791,
-     3792, 3795, 3797, 3798, 3799, 3800, 3802, 3803, 4693, 3804,
-     4693, 3805, 3807, 3824, 3821, 3823, 3827, 4693, 3826, 3816,
-     4693, 3809, 3828, 3830, 4693, 3833, 4693, 4693, 3837, 4693,
-     3838, 4693, 3839, 3840, 3844, 3846, 3848, 3850, 3853, 3854,
-     3856, 3857, 3860, 3867, 3863, 3864, 4693, 4693, 3871, 3866,
-     3872, 3879, 3876, 3877, 3883, 4693, 4693, 3880, 3884, 3887,
-     4693, 3886, 3888, 3895, 3893, 3896, 3897, 3894, 3900, 3902,
-     3907, 3903, 3904, 3909, 3918, 3916, 3920, 3906, 3923, 3924,
-
-     3927, 3928, 4693, 3930, 3931, 3935, 4693, 3937, 3938, 3940,
-     3941, 3942, 4693, 3943, 3955, 3952, 3950, 3957, 3964, 3960,
-     3962, 4693, 3966, 3967, 3968, 4693, 3944, 4693, 3970, 4693,
-     3974, 4693, 3978, 3984, 3977, 4693, 3987, 3989, 4693, 3997,
-     3979, 3981, 3975, 3998, 4693, 4005, 4002, 4004, 4011, 4000,
-     3991, 4008, 4006, 4020, 4015, 4017, 4693, 4019, 4021, 4023,
-     4026, 4025, 4028, 4027, 4030, 4033, 4042, 4031, 4035, 4032,
-     4693, 4045, 4053, 4693, 4046, 4693, 4055, 4048, 4056, 4693,
-     4059, 4050, 4060, 4062, 4693, 4065, 4063, 4693, 4068, 4072,
-     4074, 4069, 4075, 4079, 4076, 4080, 4085, 4086, 4091, 4693,
-
-     4082, 4087, 4099, 4097, 4101, 4108, 4103, 4693, 4105, 4106,
-     4109, 4118, 4113, 4115, 4693, 4117, 4119, 4693, 4123, 4120,
-     4126, 4124, 4133, 4135, 4137, 4139, 4693, 4142, 4693, 4693,
-     4127, 4693, 4143, 4147, 4693, 4150, 4145, 4151, 4152, 4154,
-     4155, 4693, 4693, 4156, 4163, 4158, 4168, 4164, 4693, 4162,
-     4172, 4173, 4174, 4175, 4693, 4176, 4177, 4179, 4180, 4183,
-     4187, 4188, 4189, 4185, 4693, 4693, 4191, 4693, 4194, 4198,
-     4204, 4693, 4693, 4693, 4213, 4693, 4215, 4219, 4218, 4693,
-     4221, 4207, 4195, 4693, 4224, 4226, 4227, 4228, 4693, 4229,
-     4230, 4234, 4237, 4241, 4238, 4244, 4242, 4256, 4252, 4232,
-
-     4245, 4248, 4258, 4259, 4261, 4266, 4693, 4693, 4268, 4693,
-     4693, 4271, 4273, 4275, 4693, 4276, 4278, 4693, 4282, 4279,
-     4283, 4286, 4284, 4289, 4693, 4693, 4290, 4293, 4291, 4297,
-     4292, 4693, 4300, 4307, 4302, 4304, 4305, 4311, 4306, 4693,
-     4693, 4693, 4693, 4693, 4312, 4693, 4693, 4313, 4314, 4319,
-     4320, 4693, 4321, 4326, 4323, 4325, 4330, 4331, 4333, 4335,
-     4338, 4341, 4340, 4343, 4342, 4347, 4349, 4350, 4352, 4363,
-     4367, 4369, 4353, 4355, 4370, 4371, 4374, 4360, 4377, 4384,
-     4380, 4382, 4383, 4693, 4386, 4693, 4387, 4693, 4693, 4389,
-     4390, 4395, 4393, 4404, 4406, 4396, 4407, 4397, 4693, 4399,
-
-     4408, 4409, 4693, 4411, 4418, 4414, 4415, 4417, 4421, 4424,
-     4427, 4425, 4426, 4435, 4436, 4444, 4446, 4437, 4448, 4449,
-     4439, 4456, 4452, 4460, 4693, 4451, 4461, 4462, 4463, 4464,
-     4471, 4466, 4468, 4472, 4693, 4475, 4467, 4484, 4477, 4478,
-     4486, 4487, 4490, 4491, 4693, 4492, 4493, 4498, 4500, 4502,
-     4505, 4506, 4507, 4509, 4511, 4512, 4520, 4515, 4521, 4523,
-     4524, 4525, 4693, 4531, 4527, 4693, 4532, 4533, 4534, 4535,
-     4539, 4693, 4548, 4536, 4541, 4549, 4552, 4556, 4693, 4558,
-     4562, 4559, 4693, 4564, 4693, 4693, 4565, 4567, 4568, 4572,
-     4574, 4693, 4693, 4693, 4601, 4608, 4615, 4622, 4629,   70,
-
-     4636, 4643, 4650, 4657, 4664, 4671, 4678, 4685
+        0,    0,   41,    0,   82,    0,  123,    0,  164,    0,
+      205,    0,    0,  246,  287,  248,  249,  250,  290,  331,
+      355,  236,  359,  373,  357,  364,  363,  376,  224,  240,
+      259,  385,  388,  299,  390,  349,  396,  408,  417,  415,
+      397,  357,  353,  444,  383,  384,  387,  485,  526,  398,
+      405,  410,  567,  608,  424,  417,  435,  436,  649,  690,
+      438,  439,  440,  731,  772,  488,  813,  529,  854,  502,
+        0,    0,  895,  898,    0,    0,  939,    0,  516,  552,
+      589,  577,  595,  963,  581,  592,  666,  617,  656,  961,
+      742,  698,  743,  974,  749,  745,  791,  825,  864,  924,
+
+      964,  956,  969,  977,  955,  972,  973,  959,  967,  978,
+      977,  972,  979,  985,  978,  972,  975,  990,  977,  993,
+      979,  999,  981,  990,  989,  986, 1003,  994, 1001, 1016,
+      999, 1011,  995,  998,  994, 1000, 1016, 1007, 1015, 1010,
+     1005, 1019, 1007, 1012,    0,    0,    0,    0,    0,    0,
+        0,    0, 1041,    0,    0,    0,    0,    0,    0,    0,
+     1050,    0, 1025,    0, 1025, 1037, 1015, 1069, 1023, 1027,
+     1059, 1064, 1075, 1065, 1062, 1089, 1069, 1077, 1093, 1083,
+     1088, 1096, 1093, 1088, 1092, 1076, 1093, 1094, 1106, 1097,
+     1098, 1090, 1090, 1095, 1094, 1106, 1109, 1114, 1111, 1097,
+
+     1102, 1125, 1120, 1129, 1102, 1130, 1116, 1105, 1133, 1123,
+     1136, 1128, 1139, 1129, 1124, 1132, 1119, 1134, 1119, 1134,
+     1130, 1139, 1130, 1130, 1127, 1143, 1131, 1146, 1129, 1158,
+     1159, 1136, 1162, 1137, 1156, 1152, 1166, 1142, 1168, 1151,
+     1163, 1166, 1172, 1173, 1166, 1146, 1165, 1166,    0, 1160,
+     1154, 1166, 1170, 1182, 1183, 1173, 1174, 1186, 1166, 1168,
+     1165, 1166, 1185, 1167, 1174, 1181, 1166, 1189, 1191, 1193,
+     1198, 1178, 1196, 1197, 1183, 1185, 1198, 1198, 1194, 1210,
+     1191, 1212, 1203, 1207, 1204, 1216, 1191, 1194, 1192, 1201,
+     1206, 1215, 1214, 1200, 1215, 1202, 1220, 1204, 1220, 1213,
+
+     1232, 1224, 1216, 1220, 1221, 1226, 1229, 1220, 1222, 1233,
+     1240, 1238, 1246, 1226, 1229, 1236, 1239, 1250, 1246, 1251,
+     1238, 1249, 1243, 1236, 1242, 1264, 1239, 1255, 1267, 1257,
+     1258, 1261, 1262, 1252, 1252, 1261, 1278, 1269, 1262, 1256,
+     1275, 1263, 1265, 1295, 1279, 1270, 1285, 1270, 1277, 1295,
+     1296, 1285, 1271, 1274, 1280, 1283, 1277, 1285, 1292, 1313,
+     1285, 1289, 1290, 1306, 1297, 1307, 1299, 1310, 1301, 1324,
+     1299, 1308, 1307, 1328, 1298, 1308, 1320, 1329, 1308, 1313,
+     1314, 1317, 1330, 1329, 1330, 1320, 1320, 1319, 1324, 1330,
+     1331, 1336, 1338, 1334, 1337, 1351, 1325, 1341, 1344, 1346,
+
+     1333, 1353, 1342, 1351, 1344, 1357, 1365, 1356, 1340, 1357,
+     1354, 1352, 1347, 1354, 1362, 1364, 1368, 1365, 1350, 1371,
+     1387, 1373, 1381, 1355, 1369, 1369, 1359, 1368, 1395, 1364,
+     1363, 1371, 1392, 1378, 1383, 1375, 1382, 1397, 1372, 1390,
+     1400, 1381, 1391, 1396, 1376, 1378, 1396, 1386, 1397, 1387,
+     1385, 1404, 1386, 1388, 1403, 1393, 1417, 1412, 1398, 1412,
+     1396, 1416, 1394, 1420, 1409, 1413, 1411, 1408, 1406, 1424,
+     1422, 1413, 1418, 1428, 1449, 1433, 1428, 1434, 1445, 1428,
+     1422, 1427, 1425, 1440, 1442, 1444, 1439, 1449, 1455, 1431,
+     1439, 1446, 1459, 1460, 1444, 1454, 1443, 1454, 1457, 1446,
+
+     1447, 1470, 1453, 1468, 1469, 1476, 1472, 1473, 1479, 1453,
+     1470, 1457, 1469, 1455, 1460, 1476, 1487, 1478, 1465, 1479,
+     1465, 1492, 1482, 1474, 1481, 1487, 1473, 1491, 1475, 1489,
+     1491, 1483, 1483, 1506, 1492, 1499, 1499, 1499, 1500, 1490,
+     1494, 1503, 1510, 1501, 1490, 1496, 1501, 1520, 1509, 1513,
+     1514, 1515, 1514, 1502, 1507, 1528, 1518, 1530, 1523, 1522,
+     1534, 1516, 1517, 1537, 1513, 1525, 1532, 1542, 1525, 1533,
+     1545, 1539, 1516, 1539, 1541, 1526, 1544, 1529, 1530, 1530,
+     1531, 1548, 1544, 1539, 1537, 1537, 1542, 1564, 1540, 1539,
+     1542, 1561, 1559, 1544, 1546, 1555, 1562, 1552, 1550, 1557,
+
+     1564, 1567, 1566, 1569, 1570, 1558, 1570, 1569, 1565, 1571,
+     1580, 1570, 1578, 1581, 1581, 1577, 1573, 1567, 1590, 1578,
+     1590, 1578, 1594, 1585, 1609, 1577, 1578, 1604, 1591, 1581,
+     1582, 1599, 1592, 1587, 1612, 1599, 1590, 1584, 1590, 1606,
+     1626, 1598, 1628, 1630, 1600, 1633, 1634, 1612, 1616, 1619,
+     1623, 1625, 1613, 1609, 1636, 1630, 1628, 1614, 1618, 1613,
+     1636, 1641, 1634, 1623, 1643, 1630, 1645, 1642, 1647, 1646,
+     1650, 1641, 1635, 1651, 1655, 1638, 1650, 1658, 1645, 1647,
+     1644, 1651, 1659, 1666, 1680, 1662, 1649, 1675, 1676, 1668,
+     1666, 1665, 1666, 1675, 1659, 1673, 1672, 1661, 1682, 1673,
+
+     1675, 1690, 1666, 1700, 1678, 1679, 1686, 1685, 1677, 1691,
+     1678, 1675, 1686, 1672, 1694, 1712, 1697, 1701, 1693, 1681,
+     1698, 1683, 1686, 1685, 1688, 1700, 1706, 1693, 1693, 1705,
+     1703, 1702, 1711, 1719, 1700, 1700, 1707, 1728, 1720, 1704,
+     1731, 1722, 1708, 1716, 1724, 1709, 1730, 1738, 1730, 1716,
+     1722, 1743, 1718, 1740, 1722, 1738, 1737, 1744, 1729, 1741,
+     1724, 1742, 1729, 1763, 1735, 1727, 1738, 1752, 1768, 1735,
+     1735, 1748, 1755, 1745, 1753, 1761, 1759, 1750, 1742, 1764,
+     1754, 1765, 1758, 1779, 1760, 1771, 1762, 1774, 1775, 1767,
+     1761, 1769, 1778, 1791, 1787, 1792, 1769, 1772, 1790, 1780,
+
+     1788, 1780, 1783, 1796, 1794, 1792, 1787, 1783, 1784, 1805,
+     1801, 1820, 1813, 1814, 1807, 1792, 1799, 1819, 1809, 1796,
+     1808, 1809, 1803, 1826, 1817, 1813, 1804, 1819, 1805, 1812,
+     1807, 1819, 1820, 1836, 1845, 1818, 1828, 1815, 1817, 1821,
+     1832, 1833, 1834, 1837, 1832, 1841, 1849, 1831, 1859, 1830,
+     1853, 1847, 1846, 1836, 1833, 1839, 1861, 1836, 1854, 1837,
+     1854, 1855, 1845, 1857, 1858, 1859, 1853, 1880, 1862, 1862,
+     1853, 1864, 1872, 1863, 1855, 1871, 1857, 1857, 1857, 1865,
+     1885, 1875, 1876, 1896, 1878, 1866, 1882, 1875, 1879, 1870,
+     1877, 1896, 1897, 1877, 1888, 1895, 1876, 1882, 1885, 1902,
+
+     1881, 1891, 1882, 1877, 1917, 1885, 1897, 1907,    0, 1893,
+     1893, 1904, 1911, 1891, 1909, 1919, 1920, 1899, 1911, 1915,
+     1903, 1914, 1906, 1907, 1917, 1908, 1905, 1916, 1908, 1920,
+     1913, 1910, 1931, 1917, 1914, 1927, 1914, 1930, 1950, 1936,
+     1933, 1932, 1926, 1938, 1924, 1934, 1940, 1928, 1943, 1931,
+     1965, 1953, 1933, 1949, 1951, 1947, 1942, 1939, 1944, 1953,
+     1949, 1943, 1942, 1946, 1959, 1951, 1947, 1948, 1960, 1984,
+     1977, 1958, 1969, 1966, 1955, 1971, 1965, 1985, 1961, 1967,
+     1969, 1982, 1980, 1985, 1974, 1981, 1997, 1991, 1989, 1986,
+     1991, 1992, 1997, 1980, 2007, 1993, 1999, 1991, 1988, 2013,
+
+     2014, 2001, 2005, 2007, 2010, 2012, 2016, 2004, 2030, 2013,
+     2003, 2002, 2012, 2028, 2009, 2016, 2010, 2023, 2018, 2028,
+     2020, 2026, 2018, 2012, 2026, 2034, 2046, 2042, 2027, 2044,
+     2058, 2042, 2041, 2028, 2049, 2029, 2051, 2046, 2031, 2054,
+     2034, 2061, 2051, 2049, 2053, 2065, 2055, 2060, 2044, 2057,
+     2057, 2052, 2080, 2073, 2074, 2064, 2076, 2062, 2053, 2062,
+     2075, 2055, 2071, 2091, 2058, 2056, 2086, 2095, 2088, 2072,
+     2070, 2065, 2067, 2075, 2074, 2075, 2073, 2091, 2073, 2069,
+     2077, 2091, 2077, 2093, 2100, 2077, 2096, 2116, 2084, 2110,
+     2096, 2098, 2093, 2093, 2095, 2106, 2110, 2101, 2122, 2113,
+
+     2107, 2100, 2094, 2103, 2117, 2105, 2104, 2139, 2108, 2126,
+     2124, 2111, 2111, 2119, 2118, 2118, 2119, 2116, 2131, 2130,
+     2133, 2121, 2131, 2140, 2127, 2137, 2123, 2142, 2141, 2142,
+     2154, 2155, 2149, 2150, 2166, 2154, 2150, 2146, 2138, 2143,
+     2143, 2152, 2159, 2141, 2154, 2147, 2159, 2151, 2147, 2173,
+     2174, 2149, 2151, 2152, 2155, 2181, 2156, 2151, 2159, 2173,
+     2186, 2162, 2163, 2178, 2165, 2166, 2185, 2173, 2167, 2174,
+     2189, 2188, 2180, 2194, 2189, 2191, 2183, 2188, 2185, 2197,
+     2214, 2181, 2186, 2205, 2200, 2202, 2203, 2188, 2191, 2190,
+     2217, 2207, 2214, 2195, 2229, 2199, 2232, 2214, 2219, 2227,
+
+     2236, 2224, 2238, 2226, 2210, 2241, 2225, 2209, 2229, 2216,
+     2207, 2214, 2233, 2221, 2231, 2222, 2239, 2235, 2220, 2240,
+     2220, 2232, 2240, 2227, 2242, 2262, 2250, 2256, 2233, 2238,
+     2239, 2253, 2261, 2251, 2237, 2238, 2251, 2251, 2256, 2268,
+     2243, 2262, 2260, 2272, 2247, 2274, 2244, 2269, 2285, 2258,
+     2274, 2255, 2269, 2290, 2253, 2277, 2278, 2266, 2263, 2267,
+     2280, 2283, 2273, 2266, 2284, 2294, 2284, 2282, 2287, 2268,
+     2291, 2301, 2295, 2292, 2285, 2281, 2281, 2281, 2309, 2299,
+     2311, 2283, 2302, 2309, 2304, 2292, 2291, 2292, 2299, 2300,
+     2303, 2303, 2301, 2314, 2325, 2300, 2301, 2308, 2302, 2338,
+
+     2326, 2306, 2322, 2327, 2314, 2316, 2307, 2314, 2324, 2314,
+     2320, 2329, 2328, 2322, 2353, 2326, 2356, 2318, 2345, 2346,
+     2344, 2329, 2346, 2345, 2335, 2343, 2334, 2345, 2346, 2362,
+     2365, 2361, 2341, 2342, 2350, 2346, 2351, 2350, 2355, 2382,
+     2344, 2352, 2370, 2356, 2364, 2369, 2374, 2367, 2359, 2384,
+     2394, 2387, 2364, 2385, 2391, 2381, 2393, 2382, 2388, 2406,
+     2384, 2374, 2401, 2383, 2394, 2412, 2413, 2381, 2393, 2393,
+     2391, 2387, 2387, 2398, 2395, 2415, 2394, 2393, 2426, 2414,
+     2394, 2411, 2411, 2412, 2417, 2414, 2411, 2398, 2436, 2404,
+     2409, 2426, 2407, 2413, 2423, 2422, 2418, 2419, 2417, 2414,
+
+     2414, 2427, 2442, 2425, 2420, 2433, 2441, 2438, 2448, 2439,
+     2445, 2459, 2441, 2439, 2450, 2438, 2449, 2449, 2433, 2432,
+     2437, 2438, 2452, 2449, 2447, 2445, 2456, 2453, 2443, 2449,
+     2466, 2472, 2446, 2449, 2449, 2469, 2472, 2473, 2453, 2475,
+     2455, 2478, 2474, 2485, 2477, 2495, 2488, 2465, 2490, 2460,
+     2483, 2488, 2487, 2495, 2496, 2470, 2480, 2475, 2476, 2503,
+     2478, 2514, 2507, 2488, 2501, 2493, 2490, 2513, 2499, 2489,
+     2501, 2490, 2513, 2487, 2513, 2495, 2494, 2516, 2519, 2533,
+     2534, 2512, 2501, 2507, 2525, 2510, 2519, 2518, 2502, 2528,
+     2504, 2530, 2513, 2517, 2548, 2532, 2531, 2543, 2518, 2532,
+
+     2546, 2547, 2543, 2538, 2535, 2525, 2527, 2535, 2530, 2546,
+     2532, 2525, 2551, 2538, 2550, 2569, 2537, 2542, 2572, 2540,
+     2556, 2555, 2553, 2543, 2538, 2572, 2556, 2566, 2547, 2555,
+     2553, 2580, 2562, 2577, 2583, 2584, 2553, 2586, 2555, 2571,
+     2590, 2599, 2574, 2583, 2576, 2564, 2566, 2597, 2570, 2599,
+     2585, 2583, 2610, 2592, 2595, 2577, 2599, 2602, 2603, 2583,
+     2584, 2611, 2605, 2601, 2603, 2603, 2601, 2625, 2607, 2601,
+     2628, 2596, 2630, 2614, 2606, 2633, 2608, 2609, 2617, 2624,
+     2615, 2620, 2621, 2628, 2608, 2620, 2612, 2612, 2628, 2628,
+     2640, 2621, 2650, 2636, 2620, 2630, 2631, 2628, 2656, 2657,
+
+     2645, 2659, 2630, 2661, 2634, 2636, 2657, 2635, 2652, 2652,
+     2656, 2648, 2671, 2651, 2639, 2644, 2645, 2661, 2654, 2643,
+     2660, 2654, 2655, 2642, 2654, 2668, 2685, 2655, 2664, 2679,
+     2661, 2660, 2678, 2677, 2661, 2664, 2699, 2681, 2686, 2671,
+     2685, 2684, 2706, 2684, 2692, 2701, 2710, 2683, 2699, 2673,
+     2695, 2699, 2697, 2701, 2695, 2700, 2698, 2689, 2688, 2715,
+     2705, 2698, 2704, 2727, 2695, 2701, 2717, 2716, 2703, 2700,
+     2700, 2727, 2717, 2721, 2712, 2724, 2725, 2718, 2726, 2708,
+     2732, 2723, 2721, 2725, 2730, 2733, 2751, 2733, 2734, 2754,
+     2728, 2722, 2725, 2738, 2740, 2760, 2741, 2762, 2743, 2745,
+
+     2728, 2737, 2728, 2746, 2757, 2748, 2759, 2740, 2767, 2758,
+     2758, 2751, 2739, 2772, 2764, 2760, 2760, 2750, 2786, 2787,
+     2780, 2776, 2775, 2758, 2769, 2780, 2779, 2769, 2764, 2774,
+     2785, 2791, 2781, 2788, 2783, 2795, 2805, 2788, 2773, 2790,
+     2809, 2771, 2792, 2775, 2784, 2795, 2784, 2787, 2805, 2801,
+     2791, 2802, 2782, 2790, 2811, 2825, 2793, 2790, 2790, 2796,
+     2795, 2805, 2797, 2833, 2805, 2822, 2819, 2814, 2825, 2812,
+     2812, 2814, 2810, 2828, 2831, 2832, 2817, 2820, 2813, 2811,
+     2835, 2821, 2829, 2840, 2835, 2856, 2838, 2824, 2825, 2834,
+     2842, 2849, 2850, 2831, 2852, 2834, 2854, 2855, 2841, 2839,
+
+     2838, 2872, 2854, 2861, 2842, 2863, 2844, 2838, 2847, 2867,
+     2861, 2865, 2868, 2871, 2852, 2857, 2854, 2875, 2889, 2856,
+     2854, 2858, 2864, 2876, 2882, 2863, 2884, 2865, 2879, 2861,
+     2887, 2880, 2888, 2905, 2880, 2888, 2879, 2896, 2894, 2872,
+     2885, 2878, 2895, 2896, 2901, 2888, 2889, 2896, 2897, 2898,
+     2909, 2900, 2896, 2917, 2908, 2927, 2894, 2929, 2907, 2908,
+     2917, 2925, 2919, 2916, 2902, 2937, 2926, 2911, 2924, 2920,
+     2924, 2945, 2920, 2917, 2919, 2927, 2924, 2951, 2935, 2934,
+     2920, 2922, 2956, 2931, 2945, 2959, 2947, 2944, 2943, 2955,
+     2956, 2952, 2938, 2952, 2942, 2941, 2937, 2956, 2972, 2955,
+
+     2957, 2962, 2957, 2943, 2978, 2945, 2952, 2963, 2948, 2964,
+     2976, 2965, 2954, 2987, 2958, 2959, 2990, 2972, 2984, 2971,
+     2958, 2979, 2996, 2997, 2970, 2984, 2968, 2982, 2985, 2967,
+     2964, 2990, 3006, 2989, 3000, 2983, 2997, 2988, 2999, 3013,
+     3014, 3002, 3016, 2985, 3018, 3019, 3001, 2986, 3003, 3010,
+     3024, 3012, 3026, 3014, 3009, 3021, 3030, 3016, 3002, 2997,
+     3015, 3035, 3003, 3011, 3025, 3039, 3017, 3033, 3029, 3011,
+     3016, 3046, 3034, 3048, 3034, 3037, 3032, 3036, 3025, 3026,
+     3036, 3043, 3029, 3058, 3029, 3047, 3048, 3036, 3031, 3049,
+     3037, 3040, 3032, 3042, 3048, 3044, 3071, 3038, 3054, 3040,
+
+     3062, 3053, 3037, 3044, 3045, 3053, 3043, 3054, 3070, 3069,
+     3062, 3086, 3055, 3054, 3053, 3067, 3054, 3075, 3065, 3081,
+     3076, 3077, 3084, 3085, 3065, 3085, 3101, 3102, 3088, 3072,
+     3080, 3073, 3107, 3074, 3077, 3074, 3077, 3089, 3079, 3082,
+     3100, 3116, 3104, 3095, 3087, 3099, 3092, 3090, 3091, 3094,
+     3092, 3113, 3114, 3109, 3121, 3098, 3102, 3113, 3100, 3115,
+     3101, 3103, 3110, 3104, 3128, 3122, 3126, 3130, 3128, 3132,
+     3146, 3114, 3148, 3149, 3127, 3117, 3133, 3120, 3154, 3155,
+     3156, 3144, 3124, 3142, 3147, 3132, 3130, 3134, 3151, 3147,
+     3166, 3138, 3150, 3169, 3157, 3144, 3172, 3160, 3174, 3162,
+
+     3143, 3164, 3159, 3166, 3180, 3173, 3162, 3183, 3184, 3170,
+     3150, 3160, 3159, 3166, 3156, 3172, 3164, 3174, 3172, 3162,
+     3174, 3197, 3169, 3180, 3181, 3182, 3173, 3190, 3191, 3205,
+     3185, 3188, 3200, 3186, 3191, 3185, 3197, 3184, 3195, 3215,
+     3203, 3204, 3218, 3219, 3207, 3194, 3205, 3215, 3205, 3206,
+     3218, 3209, 3210, 3207, 3202, 3210, 3214, 3208, 3235, 3219,
+     3218, 3206, 3212, 3217, 3218, 3227, 3220, 3244, 3245, 3220,
+     3214, 3214, 3216, 3218, 3238, 3219, 3230, 3220, 3225, 3227,
+     3249, 3250, 3246, 3227, 3261, 3233, 3263, 3230, 3247, 3258,
+     3235, 3255, 3269, 3248, 3252, 3272, 3250, 3247, 3249, 3276,
+
+     3259, 3250, 3250, 3280, 3266, 3282, 3283, 3271, 3285, 3252,
+     3287, 3258, 3276, 3256, 3276, 3279, 3258, 3277, 3282, 3283,
+     3282, 3285, 3270, 3287, 3269, 3274, 3295, 3272, 3292, 3288,
+     3307, 3308, 3301, 3273, 3291, 3283, 3305, 3296, 3277, 3299,
+     3305, 3319, 3320, 3321, 3303, 3301, 3307, 3325, 3287, 3310,
+     3297, 3311, 3299, 3298, 3305, 3321, 3302, 3314, 3304, 3323,
+     3324, 3325, 3311, 3323, 3309, 3304, 3322, 3323, 3313, 3314,
+     3341, 3350, 3338, 3335, 3340, 3320, 3323, 3326, 3327, 3358,
+     3346, 3339, 3348, 3343, 3340, 3341, 3365, 3334, 3354, 3350,
+     3346, 3362, 3342, 3364, 3346, 3351, 3376, 3365, 3360, 3380,
+
+     3358, 3356, 3383, 3350, 3346, 3386, 3387, 3362, 3389, 3355,
+     3391, 3373, 3378, 3371, 3380, 3396, 3378, 3383, 3399, 3387,
+     3379, 3375, 3370, 3392, 3373, 3388, 3408, 3401, 3391, 3392,
+     3399, 3381, 3379, 3396, 3384, 3409, 3379, 3406, 3420, 3388,
+     3393, 3410, 3397, 3407, 3403, 3397, 3395, 3407, 3411, 3403,
+     3392, 3420, 3401, 3402, 3436, 3424, 3438, 3426, 3427, 3409,
+     3410, 3443, 3409, 3445, 3433, 3417, 3429, 3430, 3450, 3438,
+     3418, 3418, 3454, 3418, 3423, 3457, 3443, 3431, 3460, 3429,
+     3426, 3450, 3451, 3452, 3443, 3433, 3435, 3443, 3436, 3437,
+     3459, 3456, 3459, 3475, 3450, 3464, 3444, 3479, 3472, 3468,
+
+     3465, 3475, 3452, 3485, 3467, 3468, 3455, 3481, 3459, 3479,
+     3493, 3481, 3462, 3496, 3484, 3479, 3471, 3481, 3488, 3489,
+     3490, 3485, 3486, 3506, 3494, 3486, 3509, 3510, 3511, 3493,
+     3494, 3481, 3515, 3480, 3484, 3503, 3519, 3507, 3488, 3494,
+     3489, 3501, 3512, 3509, 3508, 3528, 3529, 3530, 3503, 3524,
+     3511, 3521, 3516, 3513, 3537, 3504, 3505, 3521, 3541, 3516,
+     3523, 3544, 3523, 3513, 3513, 3514, 3517, 3520, 3520, 3518,
+     3535, 3555, 3556, 3523, 3558, 3546, 3547, 3543, 3562, 3563,
+     3564, 3557, 3553, 3567, 3553, 3549, 3551, 3559, 3562, 3562,
+     3558, 3577, 3559, 3566, 3548, 3553, 3582, 3564, 3571, 3564,
+
+     3568, 3558, 3588, 3557, 3561, 3568, 3577, 3580, 3581, 3566,
+     3577, 3574, 3590, 3591, 3562, 3573, 3569, 3586, 3587, 3574,
+     3595, 3609, 3610, 3598, 3578, 3613, 3614, 3583, 3593, 3594,
+     3618, 3606, 3607, 3621, 3609, 3590, 3624, 3602, 3613, 3599,
+     3628, 3616, 3601, 3605, 3617, 3605, 3605, 3622, 3636, 3637,
+     3606, 3622, 3600, 3626, 3610, 3643, 3627, 3637, 3618, 3628,
+     3615, 3617, 3620, 3651, 3652, 3624, 3635, 3617, 3618, 3657,
+     3658, 3659, 3647, 3644, 3662, 3629, 3664, 3628, 3648, 3633,
+     3635, 3641, 3670, 3634, 3647, 3654, 3658, 3646, 3661, 3650,
+     3645, 3647, 3650, 3642, 3653, 3649, 3666, 3672, 3673, 3687,
+
+     3654, 3666, 3662, 3678, 3669, 3680, 3681, 3680, 3683, 3684,
+     3665, 3665, 3683, 3682, 3683, 3664, 3675, 3697, 3678, 3692,
+     3695, 3709, 3710, 3698, 3686, 3680, 3714, 3686, 3716, 3717,
+     3686, 3719, 3720, 3708, 3707, 3701, 3691, 3717, 3718, 3699,
+     3701, 3696, 3704, 3731, 3732, 3714, 3700, 3707, 3718, 3737,
+     3704, 3720, 3707, 3714, 3715, 3710, 3725, 3726, 3733, 3734,
+     3716, 3716, 3737, 3732, 3744, 3738, 3735, 3736, 3737, 3724,
+     3750, 3759, 3760, 3742, 3749, 3763, 3746, 3732, 3745, 3734,
+     3735, 3761, 3737, 3744, 3757, 3773, 3761, 3752, 3757, 3744,
+     3746, 3753, 3766, 3763, 3756, 3784, 3745, 3771, 3754, 3773,
+
+     3774, 3771, 3770, 3759, 3780, 3775, 3779, 3783, 3776, 3777,
+     3766, 3781, 3768, 3802, 3790, 3771, 3805, 3787, 3788, 3775,
+     3776, 3795, 3811, 3799, 3780, 3781, 3800, 3803, 3796, 3818,
+     3806, 3807, 3800, 3822, 3804, 3824, 3825, 3807, 3794, 3795,
+     3816, 3817, 3831, 3832, 3874
     } ;
 
-static yyconst flex_int16_t yy_def[2409] =
+static yyconst flex_int16_t yy_def[2746] =
     {   0,
-     2394,    1, 2395, 2395, 2396, 2396, 2397, 2397, 2398, 2398,
-     2399, 2399, 2394, 2400, 2394, 2394, 2394, 2394, 2401, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2402, 2394, 2394, 2394, 2402, 2403, 2394, 2394,
-     2394, 2403, 2404, 2394, 2394, 2394, 2394, 2404, 2405, 2394,
-     2394, 2394, 2405, 2406, 2394, 2407, 2394, 2406, 2406, 2400,
-     2400, 2394, 2408, 2401, 2408, 2401, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2402, 2402, 2403, 2403,
-     2404, 2404, 2394, 2405, 2405, 2406, 2406, 2407, 2407, 2406,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2406, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2406, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2406, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2406, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2394, 2400, 2394, 2394, 2400, 2394, 2394, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2406, 2400, 2400, 2400, 2400, 2394, 2400, 2400,
-
-     2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2406, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400,
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2394, 2400, 2394, 2400, 2400,
-     2400, 2394, 2400, 2394, 2400, 2400, 2394, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2394, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2394, 2400, 2394, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2394,
-     2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2394, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2394, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2394, 2400, 2394, 2400, 2400, 2394, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400,
-     2400, 2394, 2394, 2400, 2394, 2400, 2394, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400,
-     2400, 2400, 2394, 2400, 2400, 2394, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400,
-     2400, 2394, 2400, 2400, 2400, 2400, 2394, 2400, 2394, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2394, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400,
-     2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394,
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400,
-     2394, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400,
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-
-     2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394,
-     2400, 2400, 2400, 2400, 2400, 2394, 2394, 2400, 2400, 2400,
-     2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2394, 2394,
-     2400, 2394, 2400, 2394, 2394, 2400, 2400, 2400, 2394, 2400,
-     2394, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400,
-     2394, 2400, 2400, 2400, 2400, 2394, 2400, 2394, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2394, 2400,
-
-     2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2394, 2400,
-     2400, 2400, 2394, 2394, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2394, 2400, 2400, 2400, 2400, 2394, 2400, 2394, 2400,
-     2400, 2400, 2400, 2400, 2394, 2394, 2394, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2394, 2394, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2394, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400,
-     2394, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400,
-     2394, 2400, 2400, 2400, 2394, 2400, 2394, 2394, 2400, 2394,
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2394, 2394, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2394, 2394, 2400, 2400, 2400,
-     2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2394, 2400, 2400, 2400, 2394, 2400, 2400, 2400,
-     2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2394, 2400, 2400, 2400, 2394, 2400, 2394, 2400, 2394,
-     2400, 2394, 2400, 2400, 2400, 2394, 2400, 2400, 2394, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2394, 2400, 2400, 2394, 2400, 2394, 2400, 2400, 2400, 2394,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2394, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2394, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400, 2394, 2394,
-     2400, 2394, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2394, 2394, 2400, 2400, 2400, 2400, 2400, 2394, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2394, 2400, 2394, 2400, 2400,
-     2400, 2394, 2394, 2394, 2400, 2394, 2400, 2400, 2400, 2394,
-     2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2394, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-
-     2400, 2400, 2400, 2400, 2400, 2400, 2394, 2394, 2400, 2394,
-     2394, 2400, 2400, 2400, 2394, 2400, 2400, 2394, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2394, 2400, 2400, 2400, 2400,
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394,
-     2394, 2394, 2394, 2394, 2400, 2394, 2394, 2400, 2400, 2400,
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2394, 2400, 2394, 2400, 2394, 2394, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400,
-
-     2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2394, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
-     2400, 2400, 2394, 2400, 2400, 2394, 2400, 2400, 2400, 2400,
-     2400, 2394, 2400, 2400, 2400, 2400, 2400, 2400, 2394, 2400,
-     2400, 2400, 2394, 2400, 2394, 2394, 2400, 2400, 2400, 2400,
-     2400, 2394, 2394,    0, 2394, 2394, 2394, 2394, 2394, 2394,
-
-     2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394
+     2745,    1, 2745,    3, 2745,    5, 2745,    7, 2745,    9,
+     2745,   11, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
+     2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
+     2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745,   65,
+       14,   20, 2745, 2745,   19,   74, 2745,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   44,   48,   44,   49,   53,   49,
+       54,   59, 2745,   54,   60,   64,   60,   65,   69,   67,
+     2745,   65,   65,   19,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   67,   65,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14,   65,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2745,   14,   14,   14,   14,   14,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2745,   14,   14,   65,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   65,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2745,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2745,   14, 2745, 2745,   14, 2745, 2745,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2745,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2745,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   65,   14,   14,
+       14,   14,   14, 2745,   14,   14,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2745,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14, 2745,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14, 2745,   14,   14,   14,   65,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2745,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2745,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2745,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2745,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745,   14,   14,   14, 2745,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14, 2745,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14, 2745,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2745,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2745,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2745,   14, 2745,   14,   14,   14,
+
+     2745,   14, 2745,   14,   14, 2745,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2745,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2745,   14,
+       14,   14,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2745,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2745,   14, 2745,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2745,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2745,   14,   14,   14,   14,   14,   14,   14,   14, 2745,
+       14,   14,   14,   14,   14, 2745, 2745,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2745,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2745,
+     2745,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2745,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2745,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2745,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14, 2745,   14,   14,
+     2745,   14, 2745,   14,   14, 2745,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2745,   14,   14,   14,   14,   14, 2745, 2745,
+
+       14, 2745,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14, 2745,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2745,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2745,   14,   14,   14,
+       14,   14, 2745,   14,   14,   14, 2745,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2745,   14,   14, 2745,
+       14,   14,   14,   14,   14, 2745,   14, 2745,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2745, 2745,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2745,   14,   14,   14,
+     2745,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2745,   14,   14,   14,   14,
+       14,   14,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2745,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14, 2745,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2745,   14, 2745,   14,   14,
+       14,   14,   14,   14,   14, 2745,   14,   14,   14,   14,
+       14, 2745,   14,   14,   14,   14,   14, 2745,   14,   14,
+       14,   14, 2745,   14,   14, 2745,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2745,   14,
+
+       14,   14,   14,   14, 2745,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745,   14,   14, 2745,   14,   14,   14,
+       14,   14, 2745, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14, 2745,   14,   14,   14,   14,   14,   14, 2745,
+     2745,   14, 2745,   14, 2745, 2745,   14,   14,   14,   14,
+     2745,   14, 2745,   14,   14,   14, 2745,   14,   14,   14,
+       14, 2745,   14,   14,   14, 2745,   14,   14,   14,   14,
+       14, 2745,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2745,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2745, 2745,   14,   14,
+       14,   14, 2745,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2745,   14, 2745, 2745,   14,   14,   14,   14, 2745, 2745,
+     2745,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2745,   14,   14, 2745,   14,   14, 2745,   14, 2745,   14,
+
+       14,   14,   14,   14, 2745,   14,   14, 2745, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745,   14,   14,   14,   14,   14,   14,   14, 2745,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2745,
+       14,   14, 2745, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14, 2745, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2745,   14, 2745,   14,   14,   14,
+       14,   14, 2745,   14,   14, 2745,   14,   14,   14, 2745,
+
+       14,   14,   14, 2745,   14, 2745, 2745,   14, 2745,   14,
+     2745,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2745, 2745,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745, 2745, 2745,   14,   14,   14, 2745,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745,   14,   14,   14,   14,   14,   14,   14, 2745,
+       14,   14,   14,   14,   14,   14, 2745,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2745,   14,   14, 2745,
+
+       14,   14, 2745,   14,   14, 2745, 2745,   14, 2745,   14,
+     2745,   14,   14,   14,   14, 2745,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14, 2745,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2745,   14, 2745,   14,   14,   14,
+       14, 2745,   14, 2745,   14,   14,   14,   14, 2745,   14,
+       14,   14, 2745,   14,   14, 2745,   14,   14, 2745,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745,   14,   14,   14, 2745,   14,   14,
+
+       14,   14,   14, 2745,   14,   14,   14,   14,   14,   14,
+     2745,   14,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745,   14,   14, 2745, 2745, 2745,   14,
+       14,   14, 2745,   14,   14,   14, 2745,   14,   14,   14,
+       14,   14,   14,   14,   14, 2745, 2745, 2745,   14,   14,
+       14,   14,   14,   14, 2745,   14,   14,   14, 2745,   14,
+       14, 2745,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745, 2745,   14, 2745,   14,   14,   14, 2745, 2745,
+     2745,   14,   14, 2745,   14,   14,   14,   14,   14,   14,
+       14, 2745,   14,   14,   14,   14, 2745,   14,   14,   14,
+
+       14,   14, 2745,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745, 2745,   14,   14, 2745, 2745,   14,   14,   14,
+     2745,   14,   14, 2745,   14,   14, 2745,   14,   14,   14,
+     2745,   14,   14,   14,   14,   14,   14,   14, 2745, 2745,
+       14,   14,   14,   14,   14, 2745,   14,   14,   14,   14,
+       14,   14,   14, 2745, 2745,   14,   14,   14,   14, 2745,
+     2745, 2745,   14,   14, 2745,   14, 2745,   14,   14,   14,
+       14,   14, 2745,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2745,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745, 2745,   14,   14,   14, 2745,   14, 2745, 2745,
+       14, 2745, 2745,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745, 2745,   14,   14,   14,   14, 2745,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14, 2745, 2745,   14,   14, 2745,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2745,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2745,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2745,   14,   14, 2745,   14,   14,   14,
+       14,   14, 2745,   14,   14,   14,   14,   14,   14, 2745,
+       14,   14,   14, 2745,   14, 2745, 2745,   14,   14,   14,
+       14,   14, 2745, 2745,    0
     } ;
 
-static yyconst flex_uint16_t yy_nxt[4734] =
-    {   0,
+static yyconst flex_uint16_t yy_nxt[3915] =
+    {   13,
        14,   15,   16,   17,   18,   19,   18,   14,   14,   14,
        14,   14,   18,   20,   21,   22,   23,   24,   25,   26,
        14,   27,   28,   29,   30,   31,   32,   33,   34,   35,
-       36,   37,   38,   39,   40,   41,   14,   14,   14,   42,
-       44,   45,   46,   44,   45,   46,   49,   50,   49,   50,
-       51,   47,   51,   70,   47,   70,   70,   52,   70,   52,
-       54,   55,   56,   57,   70,   18,   54,   55,   56,   57,
-       70,   18,   58,   60,   61,   62,   71,   80,   58,   60,
-       61,   62,   72,   71,   63,   71,   73,   90,   77,   78,
-       63,   15,   16,   17,   65,   66,   67,   75,  139,   75,
-
-       75,  139,   75,   68,   71,   92,   79,   91,   75,   76,
-       71,   71,   69,   15,   16,   17,   65,   66,   67,   93,
-       71,   81,   71,   94,   71,   68,  100,   71,   82,   85,
-      153,   95,   83,   86,   69,   84,   87,   71,   88,   89,
-       71,   96,  102,   71,   97,  101,   71,  103,   71,   71,
-      107,   98,   72,   99,  108,  104,   73,   71,  147,   71,
-      147,  105,  111,  136,  110,  106,  112,  137,  137,   71,
-      109,   71,  113,  116,  150,  114,   71,  117,   71,  144,
-      144,  118,  115,  121,   71,  126,  122,  127,  165,  157,
-       71,  119,   71,  123,  120,   71,  129,  124,  125,   71,
-
-      133,   71,  128,   71,  134,  152,  130,  173,  135,  159,
-      131,  132,  141,  321,  141,  141,   75,  141,   75,   75,
-      146,   75,  146,  146,   70,  146,   70,   70,  149,   70,
-       71,   75,   71,   75,   75,   70,   75,   71,   71,  158,
-      151,  154,   75,   76,   71,   71,   71,  155,   71,  166,
-       71,  160,   71,   71,  164,   71,   71,  161,   71,   71,
-      156,   71,  168,  170,  162,  163,  174,   71,  167,  180,
-      169,  171,  175,   71,  172,   71,  176,   71,  182,  177,
-       71,   71,  183,  185,   71,   71,  187,  186,  190,   71,
-       71,  188,  178,  179,  181,  189,  191,  193,  192,   71,
-
-       71,   71,  184,   71,   71,   71,   71,  197,   71,  202,
-      199,   71,  194,   71,  200,   71,   71,   71,  139,  196,
-      195,  139,  198,   71,   71,  213,  201,  208,  204,   71,
-      214,  203,  206,  212,  205,  207,  211,   71,  209,   71,
-       71,   71,  210,   71,   71,   71,  220,   71,   71,   71,
-      215,   71,  223,   71,  226,  216,  217,  222,   71,  219,
-      224,  234,  218,  137,  137,  144,  144,  221,  141,  225,
-      141,  141,  227,  141,  146,   71,  146,  146,   75,  146,
-       75,   75,  147,   75,   71,  228,  230,   71,   71,  229,
-      149,   71,   71,   71,  235,  231,   71,  240,  237,  233,
-
-       71,   71,  232,   71,  241,   71,  236,   71,  243,  239,
-      242,  244,   71,  245,  288,   71,  238,   71,  246,   71,
-       71,  253,   71,  248,   71,   71,  257,  255,  249,  256,
-       71,  254,   71,  250,  259,  247,   71,   71,   71,  251,
-      252,  260,   71,  265,   71,   71,   71,  268,   71,  266,
-      267,  261,  269,  262,  263,  258,   71,  264,   71,  275,
-       71,  272,   71,  276,  270,   71,  271,  277,  273,  280,
-       71,  283,   71,   71,  274,   71,  285,   71,   71,  278,
-      279,  281,   71,  284,  286,   71,   71,   71,   71,   71,
-       71,  282,  287,  289,  291,   71,   71,   71,   71,   71,
-
-       71,   71,  295,  293,   71,   71,  290,   71,  301,  294,
-      299,  292,  303,  296,   71,  297,  306,   71,   71,  300,
-      298,   71,   71,  308,   71,   71,   71,  147,  310,  302,
-      312,  309,  304,  305,   71,   71,   71,  307,  313,   71,
-      314,  315,   71,  316,  311,  318,   71,   71,  319,   71,
-      147,   71,  322,   71,  324,   71,   71,  326,  327,   71,
-      328,  325,  323,   71,   71,  320,   71,  317,  330,   71,
-      332,  329,   71,   71,   71,   71,   71,  333,   71,  337,
-      338,  335,   71,  339,  331,  340,  334,   71,   71,   71,
-      342,   71,  343,   71,   71,   71,  145,  346,   71,   71,
-
-      336,  349,  347,   71,   71,  341,  351,   71,  348,  344,
-      345,   71,   71,   71,  354,  352,   71,  350,  356,   71,
-       71,  355,  358,   71,   71,   71,  361,   71,   71,   71,
-      362,   71,  353,  364,   71,  366,  360,   71,   71,  357,
-       71,  359,  370,  368,   71,   71,  363,  371,   71,  365,
-      369,   71,   71,   71,   71,  367,   71,  372,  378,  379,
-      373,  377,   71,   71,   71,  383,  384,  381,  374,  375,
-       71,  376,  385,   71,  382,   71,   71,  380,  386,   71,
-       71,  387,  392,   71,  388,  389,   71,   71,  390,  391,
-       71,  393,   71,  394,   71,  396,  398,   71,  400,   71,
-
-       71,  403,  395,   71,   71,  402,  397,   71,  404,   71,
-       71,   71,  399,  407,  405,  408,   71,   71,  414,  401,
-      406,   71,   71,   71,   71,  409,  413,  415,   71,   71,
-      147,   71,  410,   71,  416,  411,  422,  412,   71,   71,
-       71,   71,  417,  418,  420,  421,   71,  433,   71,  419,
-      143,  437,  423,  424,   71,  432,  425,  426,  434,   71,
-      438,  439,   71,  435,   71,  436,  427,   71,  428,  429,
-      430,   71,   71,  431,  440,   71,   71,  443,   71,   71,
-      451,  442,  441,   71,  449,   71,   71,  444,   71,   71,
-      455,  448,  446,  450,  445,  447,   71,   71,   71,   71,
-
-      453,   71,   71,  454,  458,  452,  459,  460,   71,   71,
-       71,   71,  465,   71,  457,   71,   71,  466,  462,  467,
-       71,  461,  456,   71,  463,  464,   71,   71,   71,   71,
-       71,  469,  477,   71,  468,   71,  470,  473,  476,  478,
-      472,  471,  479,  480,   71,   71,   71,   71,  474,   71,
-      475,  481,  482,   71,   71,   71,  486,  483,  487,  484,
-       71,   71,   71,  490,  485,  488,  491,   71,  493,   71,
-       71,  492,   71,   71,  489,  494,   71,   71,  495,   71,
-       71,  500,   71,  499,   71,  496,   71,  501,   71,  498,
-       71,  503,   71,  504,  497,   71,  506,   71,   71,   71,
-
-       71,   71,  514,   71,  507,  502,   71,  505,   71,   71,
-      509,  516,  515,   71,   71,  513,  519,  508,  510,  512,
-      511,  518,   71,  517,   71,  522,   71,  521,   71,   71,
-       71,   71,   71,  525,  520,   71,   71,   71,   71,  528,
-      524,  530,   71,   71,  542,  529,   71,   71,   71,  523,
-       71,  526,   71,  527,  531,  543,  532,   71,  533,  541,
-       71,  547,  539,  534,  544,  535,  540,   71,   71,  549,
-      545,  548,  546,  536,   71,   71,  537,   71,   71,   71,
-       71,   71,   71,  538,   71,  555,   71,  551,  559,  550,
-      556,   71,  552,  562,  147,  560,   71,  553,  561,   71,
-
-       71,  554,   71,  557,   71,   71,  558,  142,  563,  566,
-       71,   71,  568,  570,   71,  564,  571,  567,   71,  569,
-      565,  573,   71,   71,   71,   71,   71,   71,  575,   71,
-      572,  577,  578,   71,   71,  574,  582,  140,   71,  576,
-       71,  583,   71,  585,   71,  586,   71,  587,   71,  579,
-      581,  584,  580,   71,  588,   71,  589,   71,  590,   71,
-       71,  591,   71,  598,   71,  592,   71,  593,   71,   71,
-      594,   71,  597,   71,   71,  599,   71,  603,   71,  601,
-       71,   71,  595,   71,   71,  596,  604,   71,   71,  610,
-      606,  600,  605,   71,   71,  607,  602,  616,  609,  608,
-
-       71,   71,  611,   71,   71,  612,  613,  614,   71,  615,
-       71,  618,   71,  617,  619,   71,   71,  621,   71,   71,
-      622,  626,   71,   71,  625,   71,   71,  630,   71,   71,
-       71,  624,  623,   71,  627,  631,  620,   71,  629,  628,
-      632,   71,   71,   71,  633,  637,  635,  634,   71,  639,
-       71,   71,  797,  638,   71,   71,   71,  636,   71,  640,
-      642,   71,  646,  641,   71,  643,   71,  644,   71,  647,
-      651,   71,   71,  648,  645,  649,   71,   71,   71,  654,
-       71,  656,  653,  652,  655,   71,   71,   71,  658,   71,
-      650,  660,   71,   71,   71,   71,   71,   71,   71,   71,
-
-      665,   71,  671,  657,   71,   71,  659,  666,   71,   71,
-      661,  662,  667,  663,   71,  664,   71,  668,  675,  670,
-      669,   71,  674,   71,  672,   71,   71,   71,  673,   71,
-      678,   71,   71,   71,  677,  676,  682,  683,   71,   71,
-      684,   71,  679,  685,  681,   71,  680,   71,  688,   71,
-      686,   71,   71,  147,   71,   71,  689,  687,  693,   71,
-      691,   71,  694,  690,  692,  695,  698,   71,  696,   71,
-      699,  701,   71,   71,   71,  704,  697,   71,  700,   71,
-       71,   71,  702,  706,   71,  709,   71,   71,   71,   71,
-       71,   71,  707,  703,  710,   71,   71,  705,   71,  721,
-
-      714,   71,  708,   71,  715,  711,   71,  716,   71,  713,
-       71,  719,  722,  712,  717,  720,   71,  718,   71,  724,
-      723,   71,  725,  727,  726,  728,  739,   71,   71,  737,
-       71,   71,   71,  729,  730,  736,  731,   71,  138,  732,
-      740,  741,   71,  744,  733,  738,   71,   71,  743,   71,
-      734,  735,   71,  742,   71,  745,   71,  746,   71,  747,
-       71,  750,  749,  748,   71,   71,   71,   71,   71,  752,
-       71,  756,   71,   71,   71,  755,   71,   71,  762,   71,
-       71,   71,  761,  751,  760,  763,  753,  754,  757,  764,
-      758,  765,  759,   71,   71,   71,  766,   71,   71,   71,
-
-      767,   71,   71,   71,   71,   71,  768,  769,  771,  772,
-      774,   71,   71,   71,  775,  777,   71,   71,   71,  770,
-      776,   71,   71,  773,   71,  779,  780,  781,   71,   71,
-      784,   71,  778,  782,   71,   71,  783,  786,   71,   71,
-       71,  789,  791,  787,  792,   71,  785,   71,   71,  790,
-       71,   71,  794,   71,   71,   71,   71,   71,  800,  788,
-      793,   71,  799,   71,   71,   71,  803,  806,   71,  795,
-      796,  798,   71,  801,  810,  802,  804,  805,  807,   71,
-       71,  812,  809,   71,   71,  808,   71,   71,  813,   71,
-       71,  820,  811,   71,  817,   71,  819,   71,  815,   71,
-
-       71,   71,  814,  821,  824,   71,  816,  826,   71,   71,
-       71,  818,   71,  825,  823,   71,  831,  822,  829,  147,
-      828,   71,   71,  827,  830,   71,  832,   71,   71,   71,
-       71,  844,   71,   71,   71,   71,  845,   71,   71,  848,
-      852,  833,  835,  850,   71,  853,   71,  836,  846,  834,
-      837,   71,  849,   71,  838,   71,  839,  855,  851,  847,
-      840,   71,  841,   71,   71,   71,   71,  842,  857,  854,
-      859,   71,  843,   71,  866,  864,  856,  863,  858,   71,
-      860,   71,  865,   71,   71,  861,   71,  862,   71,  869,
-       71,   71,   71,   71,  870,   71,  871,  875,   71,   71,
-
-      878,   71,  874,  867,  868,  876,  879,  872,   71,  881,
-      877,   71,  882,   71,  873,   71,  880,  884,   71,  885,
-      886,   71,   71,  890,  887,   71,   71,   71,   71,   71,
-      883,   71,  888,  891,   71,  889,  893,  896,   71,   71,
-      894,   71,   71,   71,  892,   71,  899,  897,   71,  905,
-      895,   71,   71,   71,   71,   71,   71,   71,  898,  901,
-      903,  904,  900,  147,   71,   71,   71,  906,  902,  910,
-      911,  912,  909,  907,  908,   71,   71,  914,   71,  915,
-       71,  918,   71,   71,  913,   71,  919,   71,   71,  920,
-       71,  916,  921,  922,   71,  926,  917,  923,   71,   71,
-
-       71,   71,  924,  928,   71,   71,   71,   71,   71,  925,
-      930,  931,   71,  933,   71,   71,  935,  934,  927,   71,
-      929,  936,   71,  932,   71,  938,  939,   71,   71,   71,
-      937,  940,  942,   71,   71,   71,   71,  947,   71,   71,
-       71,  948,  941,   71,  949,   71,  943,   71,  946,   71,
-      951,  952,  944,  955,  945,   71,  950,   71,  956,   71,
-       71,  954,  958,  953,   71,  959,   71,   71,   71,  963,
-      957,   71,   71,   71,   71,   71,   71,  969,   71,  960,
-      962,  961,   71,  965,   71,  972,   71,   71,  974,  964,
-      145,  966,  975,   71,   71,  968,  970,   71,   71,  971,
-
-      967,   71,  976,  977,   71,   71,   71,  973,   71,  978,
-       71,   71,  983,  981,   71,   71,  987,   71,  984,  979,
-      980,   71,   71,   71,   71,  982,   71,  996,   71,  985,
-      990,   71,   71,  992,  986,  988,  997,   71,   71,  998,
-      989, 1000,  993,  991,  994,   71,   71,  995,   71,   71,
-       71,  999,   71, 1003,   71, 1002,   71, 1005, 1007,   71,
-       71, 1009,   71, 1001, 1010,   71,   71,   71, 1004, 1006,
-       71, 1011,   71,   71, 1008,   71,   71, 1015,   71,   71,
-     1012,   71, 1014,   71, 1016, 1013,   71, 1020,   71,   71,
-       71, 1025, 1017, 1021, 1019, 1024, 1018,   71, 1027, 1022,
-
-       71,   71, 1026, 1023,   71, 1029, 1031,   71,   71, 1028,
-       71, 1032,   71, 1030,   71,   71, 1036,   71, 1045, 1044,
-     1123, 1034,   71, 1033,   71,   71, 1046, 1035,   71,   71,
-     1043, 1048,   71, 1037, 1047,   71, 1038, 1039,   71,   71,
-     1049, 1040,   71, 1050,   71, 1051,   71, 1041, 1053,   71,
-       71, 1042, 1052, 1057, 1054, 1058, 1055,   71, 1078,   71,
-       71,   71, 1059,   71, 1056,   71, 1066, 1060, 1067, 1061,
-       71,   71,   71,   71, 1062,   71, 1063, 1069, 1064,   71,
-     1065,   71, 1068,   71, 1073,   71,   71, 1070, 1072, 1074,
-       71,   71, 1076, 1071,   71, 1075, 1080,   71,   71,   71,
-
-     1079,  143,   71,   71, 1077,   71, 1082, 1085, 1081, 1086,
-       71, 1088,   71,   71,   71,   71, 1083, 1089, 1087,   71,
-     1090, 1092,   71,   71, 1084, 1093, 1094,   71, 1095, 1097,
-       71,   71, 1091,   71,   71,   71,   71,   71, 1099,   71,
-     1096, 1101, 1100, 1105, 1102,   71, 1103,   71,   71, 1108,
-     1109, 1098,   71, 1104, 1106,   71,   71, 1110, 1111,   71,
-       71, 1107,   71,   71,   71, 1115,   71,   71, 1112,   71,
-     1119,   71,   71, 1114,   71,   71,   71,   71, 1126, 1113,
-       71,   71,   71, 1116,   71, 1120, 1124, 1117, 1131,   71,
-       71, 1121, 1118, 1125, 1122, 1130,   71,   71, 1135,   71,
-
-     1127, 1133, 1129, 1136,   71, 1132, 1128,   71, 1137,   71,
-       71,   71,   71,   71,   71, 1138, 1134, 1143, 1147,   71,
-     1144, 1145,   71, 1139,   71, 1140, 1141, 1146,   71, 1142,
-       71,   71, 1148, 1149,   71,   71, 1153,   71,   71,   71,
-     1151,   71, 1157, 1158,   71,   71,   71,   71,   71, 1150,
-       71,   71, 1152, 1154,   71,   71, 1156, 1155, 1161, 1166,
-       71, 1162, 1159, 1163, 1160, 1164,   71, 1167,   71,   71,
-     1165, 1168,   71, 1169,   71, 1171,   71, 1170, 1173,   71,
-       71, 1176, 1177, 1181, 1172, 1175,   71,   71,   71,   71,
-     1178,   71, 1179, 1180,   71, 1182,   71, 1174,   71,   71,
-
-       71,   71, 1187,   71,   71,   71, 1186,   71,   71, 1190,
-       71, 1193, 1184, 1189, 1183, 1185, 1194,   71,   71, 1195,
-       71, 1191,   71, 1188, 1196,   71, 1201, 1192,   71,   71,
-     1197,   71,   71,   71,   71,   71, 1205, 1198,   71, 1199,
-     1204, 1200,   71,   71,   71,   71,   71, 1213, 1203, 1210,
-     1206,   71, 1207,   71, 1202,   71, 1214, 1208, 1216,   71,
-     1212,   71, 1209, 1215,   71, 1211, 1217,   71, 1218,   71,
-       71,   71,   71, 1222,   71, 1225,   71, 1223, 1220, 1228,
-     1219, 1227,   71, 1221,   71,   71,   71,   71, 1226, 1229,
-     1224, 1230, 1234, 1235,   71,   71, 1231, 1239,   71,   71,
-
-       71, 1238, 1232,   71, 1237,   71, 1233, 1240,   71, 1241,
-       71,   71,   71, 1236, 1243,   71, 1244,   71,   71, 1247,
-       71, 1242,   71,   71, 1251,   71,   71, 1245, 1249,   71,
-     1252,   71, 1254,   71, 1248,   71,   71, 1250,   71,   71,
-     1257,   71, 1246,   71, 1259,   71, 1256, 1260,   71, 1253,
-       71,   71, 1263,   71,   71, 1255,   71, 1258, 1264, 1261,
-       71, 1268,   71, 1265, 1262, 1266,   71, 1271, 1270, 1267,
-     1272,   71, 1274,   71, 1269,   71,   71,   71,   71, 1276,
-       71,   71,   71, 1278,   71, 1280,   71, 1275,   71, 1281,
-       71, 1273,   71, 1285, 1277,   71, 1282,   71, 1286,   71,
-
-       71,   71, 1292, 1289, 1283, 1279, 1290, 1284,   71,   71,
-     1294, 1287,   71,   71, 1293, 1288,   71, 1295, 1291, 1297,
-     1298,   71, 1299,   71,   71,   71,   71,   71, 1300,   71,
-     1305,   71, 1310,   71,   71, 1307,   71, 1301, 1296, 1306,
-       71,   71,   71, 1302,   71, 1309, 1303, 1311,   71, 1304,
-       71,   71,   71, 1319, 1308,   71,   71,   71,   71,   71,
-       71,   71, 1312, 1324,   71, 1315, 1316, 1317, 1313, 1318,
-     1314,   71,   71, 1327, 1322,   71,   71, 1320, 1321,   71,
-     1326,   71, 1323,   71,   71,   71,   71,   71,   71,   71,
-     1329, 1325,   71, 1332, 1328, 1334, 1335, 1341,   71, 1336,
-
-     1333, 1331, 1337,   71, 1338, 1330, 1342,   71,   71, 1339,
-       71, 1343,   71,   71,   71, 1345,   71, 1340,   71,   71,
-     1352,   71, 1344, 1347,   71, 1351,   71, 1349, 1346,   71,
-     1350,   71, 1348, 1353,   71, 1357,   71, 1355,   71, 1354,
-       71,   71, 1362, 1359,   71,   71,   71, 1356,   71,   71,
-     1366, 1365, 1358,   71, 1364, 1373,   71,  142, 1361,   71,
-     1363,   71, 1368, 1360, 1367, 1369, 1370, 1371, 1375,   71,
-     1376, 1378, 1372,   71, 1374,   71,   71,   71,   71, 1380,
-     1377, 1381,   71,   71, 1379,   71, 1383,   71,   71,   71,
-       71,   71, 1384,   71, 1391, 1382, 1386,   71,   71,   71,
-
-       71,   71, 1387,   71, 1385, 1396, 1390,  140, 1388,   71,
-     1389, 1394,   71, 1392, 1397,   71, 1393,   71,   71, 1395,
-     1398,   71, 1399, 1403,   71,   71, 1401, 1400,   71,   71,
-       71,   71,   71,   71, 1410, 1405, 1402,   71,   71, 1404,
-       71, 1406, 1407,  138, 1413, 1411, 1414,   71,   71,   71,
-     1408, 1415, 1409, 1416,   71, 1412,   71,   71, 1418, 1419,
-       71, 1417,   71,   71, 1421,   71, 1422,   71,   71, 1420,
-       71,   71,   71,   71,   71,   71, 1427,   71, 1431,   71,
-       71, 1428,   71, 1432,   71, 1423, 1425, 1429, 1426, 1424,
-     1436,   71, 1430,   71, 1437, 1435, 1433,   71, 1441, 1434,
-
-       71, 1442,   71, 1438, 1440, 1443,   71,   71, 1445,   71,
-       71,   71, 1439, 1447,   71, 1448, 1449,   71, 1451,   71,
-     1450,   71,   71, 1453,   71,   71,   71, 1444, 1455,   71,
-     1458, 1446, 1456,   71,   71, 1457,   71, 1452, 1459, 1460,
-     1461,   71,   71, 1465,   71, 1462, 1454, 1467,   71,   71,
-     1470,   71, 1468,   71,   71,   71,   71, 1473,   71,   71,
-       71, 1463, 1464,   71, 1466, 1469, 1471, 1474,   71, 1472,
-     1477,   71,   71, 1479,   71,   71, 1475,   71, 1482,   71,
-     1476, 1483,   71,   71, 1484,   71, 1478,   71, 1480, 1486,
-       71,   71, 1488,   71,   71, 1491, 1481, 1495, 1487,   71,
-
-     1485,   71, 1489,   71,   71,   71, 1494,   71, 1498,   71,
-     1499,   71, 1497, 1490,   71, 1493,   71, 1492, 1500,   71,
-       71,   71,   71, 1505, 1496, 1501,   71, 1503, 1504, 1506,
-     1502,   71,   71, 1509,   71,   71,   71,   71,   71, 1511,
-     1507,   71, 1516,   71,   71, 1519,   71,   71,   71, 1510,
-     1517, 1514, 1518, 1522,   71, 1512, 1513, 1508, 1520,   71,
-     1515,   71, 1526, 1521, 1527,   71, 1528,   71,   71, 1523,
-     1530, 1529,   71, 1524, 1531,   71,   71, 1534,   71,   71,
-       71, 1525,   71,   71,   71,   71, 1536, 1533, 1539, 1541,
-     1535, 1537,   71, 1532,   71,   71,   71,   71, 1544, 1543,
-
-     1545,   71, 1546,   71, 1542,   71, 1548, 1540,   71, 1538,
-       71,   71,   71,   71, 1549, 1550,   71, 1551,   71,   71,
-       71, 1553, 1552, 1554,   71, 1547,   71,   71, 1559,   71,
-     1555, 1556, 1558,   71,   71, 1560, 1557,   71, 1561, 1562,
-     1563,   71,   71,   71,   71,   71,   71,   71, 1570, 1568,
-       71, 1565, 1569,   71,   71,   71, 1572, 1564,   71,   71,
-     1571, 1566, 1575, 1567,   71, 1578,   71, 1573, 1574,   71,
-     1582, 1577,   71, 1576,   71, 1579,   71,   71, 1584,   71,
-       71, 1585, 1586,   71, 1580,   71, 1581,   71, 1587,   71,
-     1590, 1583, 1588,   71,   71,   71,   71,   71,   71,   71,
-
-       71,   71, 1591,   71, 1602,   71, 1598, 1589, 1593, 1594,
-     1595,   71,   71, 1601, 1597, 1592,   71,   71,   71, 1599,
-     1605, 1596,   71, 1600,   71,   71, 1609, 1606,   71, 1603,
-     1608,   71, 1604,   71,   71,   71, 1607, 1614, 1611,   71,
-     1613, 1612, 1616,   71, 1617,   71, 1610,   71,   71, 1619,
-     1618,   71,   71, 1615,   71, 1624, 1620, 1621,   71,   71,
-       71,   71,   71, 1625,   71,   71, 1622,   71, 1627, 1630,
-       71, 1634, 1626,   71, 1623,   71, 1631,   71, 1629,   71,
-     1632, 1628,   71,   71, 1635, 1636,   71, 1633,   71, 1638,
-       71, 1639,   71,   71, 1637, 1640,   71,   71, 1641, 1642,
-
-     1644,   71, 1645,   71,   71,   71,   71,   71, 1646, 1647,
-     1648,   71,   71, 1643,   71,   71, 1649,   71, 1653,   71,
-     1655,   71, 1660,   71,   71, 1651, 1650, 1652, 1662,   71,
-     1659, 1654, 1657, 1661,   71,   71,   71,   71, 1656, 1664,
-     1667, 1665,   71,   71, 1658, 1668,   71, 1671,   71,   71,
-     1666, 1669,   71, 1663,   71, 1672, 1676,   71, 1675,   71,
-     1677,   71, 1670,   71, 1678, 1680, 1682,   71, 1681, 1673,
-       71,   71, 1684,   71,   71, 1683,   71, 1685,   71, 1679,
-     1674,   71,   71,   71,   71, 1687,   71, 1689,   71,   71,
-       71, 1692, 1695,   71, 1686,   71,   71,   71,   71, 1691,
-
-     1696, 1688, 1698,   71, 1694, 1697, 1690, 1693, 1701,   71,
-       71,   71,   71,   71,   71,   71,   71, 1700, 1710,   71,
-       71, 1699, 1702,   71,   71,   71, 1707, 1711,   71, 1712,
-     2394, 1705, 1728, 1703, 1706, 1704, 1708,   71, 1709, 1713,
-       71, 1714,   71, 1715, 1716,   71, 1717,   71,   71, 1720,
-       71,   71, 1718, 1719, 1723,   71, 1724,   71,   71, 1721,
-       71,   71, 1722, 1725, 1729,   71, 1730,   71,   71, 1732,
-       71, 1734,   71, 1735,   71,   71,   71, 1726,   71, 1733,
-     1727, 1739,   71, 1738,   71, 1741,   71, 1731,   71, 1736,
-       71,   71,   71, 1745, 1744, 1737, 1743, 1747,   71,   71,
-
-       71,   71,   71, 1740, 1751,   71, 1742,   71, 1746,   71,
-       71, 1756,   71,   71, 1755, 1749, 1758,   71, 1748,   71,
-     1750,   71, 1752,   71, 1754,   71, 1762,   71, 1760,   71,
-     1753, 1764, 1757,   71,   71,   71, 1763,   71,   71, 1759,
-     1766,   71,   71, 1770,   71, 1765,   71, 1771,   71, 1761,
-     1768,   71,   71, 1773,   71,   71, 2394, 1774, 1778, 1767,
-     1775, 1772, 1769, 1776,   71,   71, 1777,   71, 1783, 1779,
-       71, 1782,   71, 1784,   71, 1780, 1781,   71,   71,   71,
-       71, 1785,   71,   71,   71,   71,   71, 1794, 1789,   71,
-       71, 1795, 1790, 1788, 2394, 1793,   71, 1786, 1791, 1787,
-
-     1792, 1801, 1797, 1798,   71, 1799,   71,   71, 1802, 1796,
-     1800, 1803, 1804,   71,   71,   71,   71,   71,   71, 1806,
-       71,   71,   71, 1810,   71,   71,   71, 1812, 1807, 1805,
-     1811, 1813,   71,   71, 1808,   71,   71,   71, 1814,   71,
-     1809, 1818,   71, 1821,   71, 1815,   71, 1820,   71,   71,
-     1817,   71, 1822,   71, 1826, 1816, 1825,   71,   71, 1819,
-       71, 1827, 1823,   71, 1824, 1828,   71, 1830,   71,   71,
-     1835, 1829, 1831,   71, 1833,   71,   71, 1837,   71, 1834,
-     1836,   71, 1839,   71, 1832,   71,   71,   71, 1843,   71,
-     1838, 1841, 1842, 1844,   71, 1845,   71, 1846,   71,   71,
-
-       71,   71,   71, 1840,   71, 1849,   71, 1852,   71, 1854,
-       71, 1853,   71, 2394, 1847,   71, 1857,   71, 1851,   71,
-     1858, 1848,   71, 1850, 1859,   71,   71, 1856, 1855,   71,
-       71, 1860, 1861,   71, 1865,   71, 1862,   71, 1864, 1866,
-       71, 1867,   71, 1863,   71,   71, 1870,   71,   71, 1868,
-       71,   71,   71,   71,   71, 1878,   71, 1873, 1876, 1871,
-     1872,   71, 1869, 1874,   71,   71,   71,   71,   71,   71,
-     1879,   71, 1875,   71, 1877,   71, 1885,   71, 1886, 1882,
-       71,   71, 1884, 1890,   71, 1881, 1892,   71,   71, 1887,
-     1880, 1883, 1893, 1894,   71, 1888, 1895,   71, 1891,   71,
-
-     1889,   71, 1896,   71, 1897,   71, 1898,   71,   71,   71,
-     1899,   71,   71,   71,   71, 1908,   71, 1909,   71,   71,
-     1905,   71,   71,   71, 1900,   71, 1902, 1901, 1910, 1912,
-       71, 1903, 1904, 1906, 1907,   71,   71,   71, 1913, 1911,
-     1918,   71,   71, 1914, 1919,   71, 1920,   71, 1915,   71,
-       71, 1916,   71,   71, 1924, 1917, 1923,   71,   71, 1928,
-     1921,   71, 1922, 1927, 1929,   71,   71,   71, 1930,   71,
-     1925, 1931,   71, 1926,   71,   71, 1933,   71,   71,   71,
-     1932, 1937, 1938,   71, 1941,   71,   71,   71,   71, 1934,
-     1942,   71, 1939, 1935,   71, 1936,   71, 1940, 1944, 1945,
-
-       71, 1946, 1943, 1947,   71, 1948,   71, 1950,   71,   71,
-     1949, 1952,   71,   71, 1951,   71, 1953,   71, 1954,   71,
-       71,   71, 1957,   71,   71,   71, 1955,   71, 1956, 1959,
-       71, 1960,   71, 1962, 1958, 1964,   71, 1965, 1967,   71,
-     1961,   71, 1963, 1968,   71,   71, 1971,   71, 1969,   71,
-     1970, 1966,   71,   71, 1972,   71, 1973,   71, 1975, 1976,
-       71, 1980, 1974, 1977,   71,   71, 1981,   71, 1979,   71,
-     1978,   71, 1984,   71, 1982,   71, 1983, 1985,   71,   71,
-     1986,   71,   71,   71,   71,   71,   71,   71, 1987, 1990,
-     1989,   71, 1993,   71, 1992, 1991, 1988,   71,   71, 1995,
-
-       71, 1998, 1996, 1994,   71,   71, 1997, 1999,   71, 2003,
-       71,   71,   71,   71, 2007,   71,   71,   71,   71, 2394,
-       71, 2005,   71, 2000, 2011, 2001, 2018, 2002, 2006,   71,
-     2004, 2012, 2009, 2013,   71, 2008,   71,   71, 2010,   71,
-       71,   71, 2017,   71, 2014, 2015,   71, 2021, 2016, 2022,
-       71,   71,   71,   71, 2025, 2019, 2026,   71, 2020,   71,
-     2028,   71, 2027,   71, 2029, 2030,   71,   71, 2032,   71,
-       71, 2023, 2024,   71, 2035, 2036,   71,   71, 2038,   71,
-       71, 2037, 2031, 2039,   71,   71, 2042, 2034, 2033,   71,
-       71, 2041,   71,   71, 2044, 2045,   71,   71, 2046,   71,
-
-       71,   71, 2040, 2048, 2050, 2047,   71,   71,   71,   71,
-       71, 2053, 2057,   71, 2043,   71,   71,   71, 2061,   71,
-       71, 2056,   71, 2062, 2049, 2051, 2052, 2054, 2059,   71,
-     2055,   71, 2063,   71, 2058, 2060,   71,   71, 2065, 2066,
-       71,   71, 2071,   71,   71, 2064, 2068, 2072,   71, 2074,
-       71,   71, 2076,   71,   71,   71,   71,   71, 2075, 2077,
-     2069, 2070, 2067,   71, 2078,   71, 2073, 2080,   71, 2081,
-       71, 2084, 2082,   71, 2079,   71, 2085,   71, 2088,   71,
-       71,   71, 2091,   71, 2087, 2083, 2086,   71,   71, 2089,
-       71,   71,   71, 2090,   71, 2092, 2094,   71, 2095, 2096,
-
-       71, 2101,   71, 2098,   71, 2097, 2099, 2103, 2093, 2100,
-       71,   71, 2105,   71, 2102,   71, 2104,   71,   71,   71,
-     2106,   71, 2107, 2108,   71, 2110, 2111, 2113,   71, 2115,
-       71, 2109,   71,   71,   71, 2118,   71, 2112,   71,   71,
-       71,   71, 2120,   71,   71,   71,   71, 2127,   71, 2117,
-     2121, 2116, 2119, 2114, 2124,   71, 2122, 2129,   71,   71,
-     2125,   71, 2123,   71, 2128, 2130,   71, 2132,   71,   71,
-     2126, 2135,   71,   71, 2134,   71,   71, 2133,   71, 2139,
-     2131,   71,   71, 2136, 2142,   71, 2143,   71,   71,   71,
-     2140, 2144,   71,   71, 2138,   71, 2137, 2149,   71,   71,
-
-       71, 2147, 2150, 2141,   71, 2151, 2154, 2152, 2145, 2155,
-       71, 2146,   71, 2148,   71, 2157,   71, 2156,   71,   71,
-     2153,   71,   71, 2159, 2160, 2162,   71, 2165,   71, 2166,
-       71,   71,   71,   71, 2158, 2168,   71,   71, 2169,   71,
-       71, 2161, 2171, 2163, 2164, 2172,   71, 2173,   71, 2174,
-       71, 2167,   71, 2170, 2176,   71,   71, 2175,   71, 2177,
-       71, 2179, 2180,   71,   71,   71, 2184,   71,   71,   71,
-     2187,   71, 2181, 2185, 2183,   71,   71,   71, 2178, 2188,
-     2189,   71, 2190, 2186, 2182,   71,   71,   71,   71,   71,
-       71, 2193,   71,   71, 2195, 2191,   71, 2196,   71, 2194,
-
-       71,   71,   71, 2205,   71, 2192, 2207,   71,   71, 2197,
-     2208,   71, 2198, 2199, 2200, 2394, 2201,   71, 2202, 2203,
-       71, 2209, 2217, 2204, 2206, 2210,   71, 2211,   71, 2212,
-     2213,   71,   71, 2215,   71, 2214, 2218,   71, 2216,   71,
-       71,   71,   71,   71, 2220,   71, 2219,   71, 2224, 2225,
-       71,   71, 2223, 2226,   71,   71, 2221,   71,   71, 2233,
-     2222,   71, 2228, 2231, 2229,   71, 2227, 2230, 2232,   71,
-     2234,   71,   71, 2235,   71, 2394, 2237, 2238, 2240,   71,
-     2241,   71, 2236, 2242,   71, 2243,   71, 2244,   71,   71,
-     2246,   71,   71, 2239, 2247,   71,   71,   71, 2245,   71,
-
-     2250, 2252,   71,   71,   71,   71,   71, 2248, 2249, 2254,
-       71, 2256, 2251,   71, 2259,   71, 2258,   71,   71,   71,
-       71, 2253, 2261, 2257,   71,   71,   71,   71, 2265, 2260,
-     2255, 2267,   71,   71,   71, 2264,   71, 2262,   71,   71,
-     2273, 2272, 2263,   71,   71, 2275,   71, 2269,   71, 2266,
-     2271,   71, 2268,   71,   71,   71,   71, 2270, 2274, 2276,
-       71, 2284,   71,   71, 2286,   71,   71, 2277,   71, 2278,
-     2279, 2281, 2285,   71, 2283, 2282,   71, 2287, 2280, 2288,
-       71, 2289,   71,   71,   71, 2290, 2292,   71, 2291, 2293,
-       71, 2297, 2294,   71, 2299,   71,   71,   71, 2295,   71,
-
-       71, 2303,   71,   71, 2304, 2296,   71, 2298,   71,   71,
-       71, 2307,   71, 2308, 2301, 2300, 2305,   71, 2302,   71,
-       71,   71,   71, 2309,   71, 2306, 2314,   71,   71, 2311,
-       71,   71, 2312, 2310,   71, 2313, 2316,   71,   71,   71,
-       71, 2318, 2321, 2319, 2315, 2322, 2317, 2325,   71,   71,
-       71, 2327,   71, 2320, 2326, 2329, 2323,   71, 2324,   71,
-     2328,   71,   71, 2333,   71,   71, 2330, 2331, 2336,   71,
-     2334, 2332, 2335,   71,   71,   71,   71,   71, 2341,   71,
-       71,   71, 2338, 2394,   71,   71, 2344, 2345,   71, 2346,
-       71,   71, 2347, 2337, 2343, 2339, 2340,   71, 2342,   71,
-
-       71, 2352, 2348,   71,   71,   71,   71, 2356, 2353, 2349,
-     2350,   71, 2351,   71, 2358,   71, 2359, 2354,   71,   71,
-       71, 2363,   71, 2360,   71,   71, 2361, 2365,   71, 2364,
-     2357, 2355, 2366,   71,   71, 2367,   71,   71,   71, 2362,
-       71, 2368, 2370, 2372,   71,   71,   71,   71,   71,   71,
-     2374, 2375,   71, 2378,   71, 2369, 2394, 2371, 2394, 2373,
-     2379,   71,   71, 2382, 2383,   71, 2376, 2377, 2380,   71,
-     2385,   71,   71, 2381, 2386,   71, 2384,   71,   71, 2387,
-       71,   71, 2388, 2389, 2392,   71, 2393,   71, 2394, 2394,
-     2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2390,
-
-     2391,   43,   43,   43,   43,   43,   43,   43,   48,   48,
-       48,   48,   48,   48,   48,   53,   53,   53,   53,   53,
-       53,   53,   59,   59,   59,   59,   59,   59,   59,   64,
-       64,   64,   64,   64,   64,   64,   74,   74, 2394,   74,
-       74,   74,   74,  137,  137, 2394, 2394, 2394,  137,  137,
-      139,  139, 2394, 2394,  139, 2394,  139,  141, 2394, 2394,
-     2394, 2394, 2394,  141,  144,  144, 2394, 2394, 2394,  144,
-      144,  146, 2394, 2394, 2394, 2394, 2394,  146,  148,  148,
-     2394,  148,  148,  148,  148,   75,   75, 2394,   75,   75,
-       75,   75,   13, 2394, 2394, 2394, 2394, 2394, 2394, 2394,
-
-     2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394,
-     2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394,
-     2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394,
-     2394, 2394, 2394
+       36,   37,   38,   39,   40,   41,   42,   14,   14,   43,
+       13,   44,   44,   45,   46,   47,   44,   44,   44,   44,
+       44,   44,   44,   44,   48,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   13,   49,   49,   50,   51,   49,   49,   52,   49,
+       49,   49,   49,   49,   49,   53,   49,   49,   49,   49,
+
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   13,   54,   55,   56,   57,   58,   54,   18,
+       54,   54,   54,   54,   54,   54,   59,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   13,   60,   60,   61,   62,   63,   60,
+       60,   60,   60,   60,   60,   60,   60,   64,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+
+       60,   60,   60,   60,   13,   65,   15,   16,   17,   66,
+       67,   68,   65,   65,   65,   65,   65,   65,   69,   65,
+       65,   65,   65,   65,   65,   65,   65,   70,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   13,   71,   13,   13,   13,
+       83,   71,  105,   71,   71,   71,   71,   71,  106,   72,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   13,  107,   73,   13,
+       75,   76,   74,   76,   76,   75,   76,   75,   75,   75,
+
+       75,   75,   76,   77,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       13,   78,   78,  116,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   79,   80,   84,   95,   81,  122,   99,   97,  143,
+       85,  144,   13,   13,   86,  100,   13,   87,   88,   82,
+       89,   90,   98,  101,   96,   91,  102,   13,   92,  108,
+
+       93,   94,  112,  103,   13,  104,  113,  109,  117,   13,
+      123,  140,  118,  110,  124,  141,   13,  111,  119,  142,
+      114,  120,  115,   13,  125,  153,  127,  126,  121,  128,
+      129,  133,  136,  134,   13,   13,  130,   13,   13,   13,
+      131,  132,  137,   13,  145,  145,  138,  139,  135,  145,
+      145,  145,  145,  145,  145,  145,  145,  146,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,   13,  147,  147,   13,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,   13,  148,  148,   13,  163,
+      148,  148,  165,  148,  148,  148,  148,  148,  148,  149,
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,  148,  148,  148,  148,  148,   13,  150,  150,  166,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+
+      150,  150,  150,  150,  150,  150,  150,   13,  151,  167,
+      168,  169,  172,  151,  173,  151,  151,  151,  151,  151,
+      151,  152,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,  151,  151,   13,  154,
+      154,  176,  154,  154,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  154,  154,   13,
+      155,  155,  174,  175,  177,  155,  155,  155,  155,  155,
+
+      155,  155,  155,  156,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+       13,  157,  157,  182,  157,  157,  157,  157,  157,  157,
+      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+      157,   13,  158,  180,  181,  183,  186,  158,  187,  158,
+      158,  158,  158,  158,  158,  159,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,   13,  160,   76,  188,   76,   76,  160,   76,
+      160,  160,  160,  160,  160,  160,  161,  160,  160,  160,
+      160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+      160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+      160,  160,  160,   13,  162,  162,  189,  162,  162,  162,
+      162,  162,  162,  162,  162,  162,  162,  162,  162,  162,
+      162,  162,  162,  162,  162,  162,  162,  162,  162,  162,
+      162,  162,  162,  162,  162,  162,  162,  162,  162,  162,
+      162,  162,  162,  162,   13,  190,   73,   13,   76,   76,
+
+       74,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   13,  164,
+      164,  191,  164,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  164,  164,  170,
+      178,  184,  192,  193,  198,  194,  179,  200,  195,  203,
+      201,  205,  171,  204,  207,  208,  206,  209,  210,  211,
+
+      185,  196,  197,  212,  213,  214,  215,  216,  217,  199,
+      202,  218,  220,  221,  222,  219,  223,  225,  226,  227,
+      230,  231,  224,  232,  233,  234,  236,  237,  238,  239,
+      228,  240,  242,  243,  229,  244,  245,  246,  247,  248,
+       13,  250,  153,  251,  252,  235,  253,  256,  257,   13,
+      249,  249,  241,  249,  249,  249,  249,  249,  249,  249,
+      249,  249,  249,  249,  249,  249,  249,  249,  249,  249,
+      249,  249,  249,  249,  249,  249,  249,  249,  249,  249,
+      249,  249,  249,  249,  249,  249,  249,  249,  249,  249,
+      254,  258,  259,  260,  261,  262,  263,  255,  264,  265,
+
+      266,  268,  269,  270,  271,  274,  279,  267,  280,  272,
+      275,  281,  282,  283,  285,  276,  286,  287,  288,  291,
+      289,  277,  278,  290,  293,  292,  273,  294,  295,  299,
+      300,  301,  302,  296,  303,  306,  304,  307,  308,  309,
+      310,  311,  284,  312,  313,  297,  314,  298,  305,  315,
+      316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+      326,  327,  328,  329,  330,  331,  332,  333,  334,  335,
+      336,  337,  338,  339,  340,  341,  342,  343,  344,  345,
+      347,  348,  350,  351,  352,  353,  354,  355,  356,  357,
+      358,  359,  360,  361,  362,  363,  364,  365,  349,  366,
+
+      367,  368,  369,  346,  370,  371,  372,  373,  374,  375,
+      376,  377,  378,  379,  380,  381,  382,  383,  384,  385,
+      386,  388,  389,  390,  391,  392,  393,  394,  395,  396,
+      397,  398,  399,  400,  401,  402,  403,  387,  404,  405,
+      406,  407,  408,  412,  413,  414,  417,  418,  419,  420,
+      409,  410,  421,  411,  422,  423,  424,  426,  427,  425,
+      415,  428,  429,  416,  430,  431,  432,  433,  434,  435,
+      436,  437,  438,  439,  440,  441,  442,  444,  445,  447,
+      446,  448,  443,  451,  449,  452,  450,  453,  454,  457,
+      458,  460,  461,  455,   13,  462,  456,  464,  472,  473,
+
+      465,  466,  474,  476,  477,  478,  479,  475,  480,  459,
+      467,  463,  468,  469,  470,  481,  482,  471,  483,  484,
+      485,  487,  488,  489,  490,  491,  492,  493,  494,  495,
+      486,  496,  497,  498,  499,  500,  501,  502,  503,  504,
+      505,  506,  507,  508,  509,  510,  511,  512,  514,  515,
+      516,  517,  518,  521,  522,  523,  524,  525,  526,  527,
+      528,  529,  513,  519,  530,  520,  531,  532,  533,  534,
+      535,  536,  537,  538,  539,  540,  541,  542,  543,  544,
+      545,  546,  547,  548,  549,  550,   13,  551,  552,  553,
+      554,  555,  556,  557,   13,  558,  560,  559,  561,  562,
+
+      563,  564,  565,  566,  567,  568,  569,  570,  572,  573,
+      574,  575,  576,  577,  578,  579,  580,  581,  582,  588,
+      589,  590,  591,  583,  592,  584,  594,  595,  596,  597,
+      598,  571,  599,  585,  600,  593,  586,  601,  602,  603,
+      604,  605,  606,  587,  607,  608,  609,  610,   13,  611,
+      612,  613,  614,  615,  616,  617,  618,  619,  620,  623,
+      624,  625,  626,  627,  628,  629,  630,  631,  621,  632,
+      633,  634,  635,  636,  622,  637,  639,  640,  638,  642,
+      643,  644,  641,  645,  646,  647,  648,  649,  650,  651,
+      652,  653,  654,  655,  656,  657,  658,  659,  660,  661,
+
+      662,  663,  664,  665,  668,  669,  670,  671,  666,  672,
+      673,  674,  667,  675,  676,  677,  678,  680,  681,  682,
+      683,  684,  685,  686,  687,  688,  689,  690,  691,  692,
+      693,  694,  695,  696,  697,  698,  699,  700,  679,  701,
+      702,  703,  705,  706,  707,  708,  704,  709,  710,  712,
+      713,  714,  715,  717,  718,  719,  720,  716,  721,  722,
+      723,  724,  725,  711,  726,  727,  728,  729,  730,  731,
+      732,  733,  734,  735,  736,  737,  738,  739,  740,  741,
+      742,  743,  744,  745,  746,  747,  748,  749,  750,  751,
+      752,  753,  754,  755,  756,  757,  758,  759,  760,  761,
+
+      762,  763,  764,  765,  766,  768,  769,  770,   13,  771,
+      772,  773,  767,  774,  775,  776,  777,  778,  779,  780,
+      781,  782,  783,  784,  785,   13,  790,   13,  786,   13,
+      791,  787,   13,   13,  792,  793,  794,  795,  788,  796,
+      797,  789,  798,  799,  800,  801,  807,  802,  808,  809,
+      803,  810,  811,  812,  813,  804,  814,  815,  816,  817,
+      818,  805,  806,  819,  820,  821,  822,  823,  824,  825,
+      827,  828,  829,  830,  831,  832,  833,  834,  835,   13,
+      836,  837,  838,  839,  840,  841,  842,  843,  826,  844,
+      845,  846,  847,  848,  849,  850,  851,  852,  853,   13,
+
+      854,  855,  856,  857,  858,  859,  860,  861,  862,  863,
+      864,   13,  867,  868,  869,  870,  871,  872,  865,  873,
+      874,  875,  876,  877,  878,  879,  866,  880,  881,  882,
+      883,  884,  885,  886,  887,  888,  889,  890,  891,  892,
+      893,  894,  896,  897,  898,  899,  900,  901,  902,  895,
+      903,  904,  905,  906,  907,  908,  909,  910,  911,  912,
+      913,  914,   13,  915,  916,  917,  918,   13,  919,  920,
+      921,  922,  928,  923,  929,  930,  931,  924,  932,  925,
+      933,  934,  935,  936,  926,  937,  938,  940,  941,  927,
+      942,  939,  943,  945,  946,  947,  948,  949,  950,  951,
+
+      952,  953,  944,  954,  955,  960,  961,  962,  963,  956,
+      964,  957,  965,  966,  967,  968,  969,  970,  971,   13,
+      972,  973,  958,  974,  975,  976,  977,  978,  979,  959,
+      980,  981,  982,  983,  984,  985,  986,  987,  988,  989,
+      990,  991,  992,  993,   13,  994,  995,  996,  997,  998,
+      999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,   13, 1007,
+     1008, 1010, 1012, 1013, 1011, 1009, 1014, 1015, 1016, 1017,
+     1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026,   13,
+     1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036,
+     1037, 1038, 1039, 1040, 1041,   13, 1042, 1043, 1044, 1045,
+
+     1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+     1056, 1057, 1058, 1059, 1060, 1061,   13, 1062, 1063, 1064,
+     1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
+     1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084,
+     1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,   13,
+     1097, 1098, 1099, 1100, 1101, 1102, 1103, 1094, 1104, 1095,
+     1105, 1106, 1096, 1107,   13, 1108, 1109, 1110, 1111, 1112,
+     1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122,
+     1123, 1124, 1125,   13, 1126, 1127, 1129, 1130, 1131, 1132,
+     1133, 1128, 1134, 1136, 1137, 1138, 1139, 1135, 1140, 1146,
+
+     1147, 1141, 1142, 1148, 1149, 1150, 1143, 1151, 1152, 1153,
+     1154, 1155, 1144, 1156, 1157, 1158, 1145, 1159, 1160, 1161,
+     1162, 1163, 1164, 1165, 1166, 1167, 1173, 1174, 1175,   13,
+     1176, 1177, 1168, 1178, 1179, 1180, 1182, 1169, 1183, 1170,
+     1181, 1171, 1184, 1172, 1185, 1186, 1187, 1188, 1189, 1190,
+     1191, 1192, 1193, 1194, 1195, 1196, 1197,   13, 1198, 1199,
+     1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209,
+     1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218,   13,
+     1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228,
+       13, 1229, 1230, 1231,   13, 1232, 1233, 1234, 1236, 1237,
+
+     1238, 1239, 1240, 1235, 1241, 1242, 1243, 1244, 1245, 1246,
+     1247, 1248, 1249, 1250, 1251,   13, 1252, 1253, 1255, 1256,
+     1257, 1258, 1254, 1259, 1261, 1263, 1260, 1262, 1264, 1265,
+     1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273,   13, 1274,
+     1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284,
+     1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294,
+     1295, 1296, 1297, 1298, 1299,   13, 1300, 1301, 1302, 1303,
+     1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313,
+     1314, 1316, 1318, 1319, 1320, 1315, 1317, 1321, 1322, 1323,
+     1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333,
+
+     1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+     1344, 1345, 1346,   13, 1349, 1350, 1347, 1351, 1352, 1353,
+     1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361,   13, 1348,
+     1362,   13, 1363, 1364, 1365,   13, 1366,   13, 1367, 1368,
+       13, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377,
+     1378, 1379, 1380, 1381, 1382, 1383, 1384, 1386, 1385, 1387,
+     1388,   13, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396,
+     1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406,
+     1407, 1408, 1409, 1410,   13, 1411, 1412, 1413, 1414,   13,
+     1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+
+     1425, 1428, 1429, 1426, 1430, 1431, 1432, 1433, 1434, 1435,
+     1436, 1437, 1438, 1439, 1440, 1427, 1441, 1442, 1443, 1444,
+     1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454,
+     1455, 1456, 1457, 1458, 1459, 1460, 1461,   13, 1462, 1463,
+     1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473,
+     1474, 1476,   13, 1475, 1477,   13, 1479, 1480, 1481, 1478,
+     1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1491, 1493,
+     1490, 1492, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501,
+     1502,   13, 1503, 1504, 1505, 1506, 1507, 1508, 1510, 1512,
+     1514, 1515, 1513,   13, 1517, 1518, 1516, 1519, 1520, 1521,
+
+     1522, 1523, 1511, 1509, 1524,   13, 1525, 1526, 1527, 1528,
+     1529,   13,   13, 1531, 1532, 1533, 1530, 1534, 1535, 1536,
+     1537, 1538, 1539, 1540, 1541,   13, 1542, 1543, 1544, 1545,
+     1546, 1547, 1548, 1549, 1550,   13, 1551, 1552, 1553, 1554,
+     1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564,
+     1565, 1566, 1567, 1568, 1569, 1570, 1572, 1573,   13, 1574,
+     1571, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+     1584, 1585, 1586, 1587, 1588, 1589, 1591, 1592, 1593, 1594,
+     1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1590, 1603,
+     1604, 1605, 1606, 1607,   13, 1608, 1609, 1610, 1611, 1612,
+
+     1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1622, 1623,
+     1624, 1625, 1621,   13, 1626, 1628, 1629, 1630, 1631, 1627,
+     1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641,
+     1642, 1643,   13,   13, 1644, 1645, 1646, 1647, 1648, 1649,
+     1650, 1651, 1652, 1653, 1654, 1655, 1656,   13, 1657, 1658,
+     1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668,
+     1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676,   13, 1678,
+     1679,   13, 1680, 1681, 1682, 1683, 1684, 1685, 1690, 1686,
+     1688, 1691, 1692, 1677, 1687, 1689, 1693, 1694, 1695, 1696,
+     1697, 1699, 1700, 1701, 1702, 1698, 1703, 1704,   13, 1705,
+
+     1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714,   13,
+     1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724,
+     1725, 1726, 1727, 1728,   13, 1729, 1730,   13, 1731,   13,
+     1732, 1733,   13, 1734, 1735, 1736, 1737, 1738, 1739, 1740,
+     1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749,   13,
+     1750, 1752, 1753, 1754, 1755,   13,   13, 1756,   13, 1757,
+       13, 1751, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765,
+       13, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1775,
+     1776, 1777, 1778, 1779,   13, 1774, 1780, 1781, 1784, 1785,
+     1782, 1786, 1787, 1788, 1789, 1790, 1791, 1792,   13, 1793,
+
+     1783, 1794, 1795, 1796, 1797,   13, 1798, 1799, 1800,   13,
+     1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810,
+     1811, 1812, 1813, 1814, 1815, 1816,   13, 1817, 1818, 1819,
+     1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829,
+     1830, 1832, 1833, 1831, 1834, 1835, 1836, 1837, 1838, 1839,
+       13, 1840, 1841,   13, 1842, 1843, 1844, 1845, 1847,   13,
+     1848,   13, 1850, 1851, 1852, 1853, 1854, 1846, 1855, 1856,
+     1857, 1858, 1859, 1849, 1860, 1861, 1862, 1863, 1864, 1865,
+     1867, 1868, 1869, 1870, 1866,   13,   13, 1871, 1872, 1873,
+     1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885,
+
+     1886, 1887, 1888, 1874,   13, 1889, 1890, 1891,   13, 1892,
+     1893, 1894, 1895, 1896, 1875, 1897, 1898, 1899, 1900, 1901,
+     1902, 1903, 1904, 1905,   13, 1906, 1907, 1908, 1909, 1910,
+     1911, 1912,   13, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+     1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929,
+     1930, 1931, 1933, 1934, 1932,   13, 1935, 1936, 1937, 1938,
+     1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948,
+     1949,   13, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957,
+     1958, 1959, 1960, 1962, 1963, 1964, 1965, 1966,   13, 1967,
+     1968, 1969, 1970, 1971, 1972, 1973, 1974, 1961, 1975, 1976,
+
+     1977, 1978, 1979, 1980,   13, 1981, 1982, 1983, 1984, 1985,
+     1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995,
+     1996, 1997, 1998, 1999, 2000, 2001,   13, 2002,   13, 2003,
+     2004, 2005, 2006, 2007, 2009, 2010,   13, 2011, 2012, 2013,
+     2014, 2008, 2015, 2016,   13, 2017, 2018, 2019, 2020, 2021,
+       13, 2022, 2023, 2024, 2025,   13, 2026, 2027,   13, 2028,
+     2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038,
+     2039,   13, 2040, 2041, 2042, 2043, 2044,   13, 2045, 2046,
+     2047, 2048, 2049, 2050, 2051, 2052,   13, 2053, 2054,   13,
+     2055, 2056, 2057, 2058, 2059,   13,   13, 2060, 2061, 2062,
+
+     2063, 2064, 2065, 2066, 2067,   13, 2068, 2069, 2070, 2071,
+     2072, 2073,   13,   13, 2074,   13, 2075,   13,   13, 2076,
+     2077, 2078, 2079,   13, 2080,   13, 2081, 2082, 2083,   13,
+     2084, 2085, 2086, 2087,   13, 2089, 2090, 2091,   13, 2092,
+     2093, 2094, 2095, 2088, 2096,   13, 2097,   13, 2098, 2099,
+     2100, 2101, 2102, 2103, 2104, 2105, 2106,   13, 2107, 2108,
+     2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118,
+       13, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127,
+     2128, 2129, 2130, 2131, 2132,   13, 2133, 2134, 2135, 2136,
+     2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146,
+
+       13,   13, 2147, 2148, 2149, 2150,   13, 2151, 2152, 2153,
+     2154, 2155, 2156, 2157, 2158,   13, 2159, 2160, 2161, 2162,
+     2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172,
+     2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182,
+     2183, 2184, 2185, 2186, 2187,   13, 2188,   13,   13, 2189,
+     2190, 2191, 2192,   13,   13,   13, 2193, 2194, 2195, 2196,
+     2197, 2198, 2199, 2200, 2201,   13, 2202, 2203,   13, 2204,
+     2205,   13, 2206,   13, 2207, 2208, 2209, 2210, 2211,   13,
+     2212, 2213,   13,   13, 2214, 2215, 2216, 2217, 2218, 2219,
+     2220, 2221, 2222, 2223, 2224, 2225,   13, 2226, 2227, 2228,
+
+     2229, 2230, 2231, 2232,   13, 2233, 2234, 2235, 2236, 2237,
+     2238, 2239, 2240, 2241,   13, 2242, 2243,   13,   13, 2244,
+     2245, 2246, 2247, 2249, 2250, 2251, 2252, 2248, 2253, 2254,
+     2255, 2256, 2257, 2258,   13, 2259, 2260, 2261, 2262, 2263,
+     2264, 2265, 2266,   13,   13, 2267, 2268, 2269, 2270, 2271,
+     2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281,
+       13, 2282,   13, 2283, 2284, 2285, 2286, 2287,   13, 2288,
+     2289,   13, 2290, 2291, 2292,   13, 2293, 2294, 2295,   13,
+     2296,   13,   13, 2297,   13, 2298,   13, 2299, 2300, 2301,
+     2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311,
+
+     2312, 2313, 2314, 2315, 2316, 2317,   13,   13, 2318, 2320,
+     2321, 2322, 2323, 2319, 2324, 2325, 2326, 2327,   13,   13,
+       13, 2328, 2329, 2330,   13, 2331, 2332, 2333, 2334, 2335,
+     2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345,
+     2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354,   13,
+     2355, 2356, 2357, 2358, 2359, 2360, 2361,   13, 2362, 2363,
+     2364, 2365, 2366, 2367,   13, 2368, 2369, 2370, 2371, 2372,
+     2374, 2375, 2377, 2378, 2373,   13, 2376, 2379, 2380,   13,
+     2381, 2382,   13, 2383, 2384,   13,   13, 2385,   13, 2386,
+       13, 2387, 2388, 2389, 2390,   13, 2391, 2392,   13, 2394,
+
+     2393, 2395, 2396, 2397, 2398, 2399, 2400,   13, 2401, 2402,
+     2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411,   13,
+     2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421,
+     2422, 2423, 2424, 2425, 2426,   13, 2427,   13, 2428, 2429,
+     2430, 2431,   13, 2432,   13, 2433, 2434, 2435, 2436,   13,
+     2437, 2438, 2439,   13, 2440, 2441,   13, 2442, 2443,   13,
+     2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453,
+     2454, 2455, 2456, 2457,   13, 2458, 2459, 2460,   13, 2461,
+     2462, 2463, 2464, 2465,   13, 2466, 2467, 2468, 2469, 2470,
+     2471, 2472,   13, 2473, 2474,   13, 2475, 2476, 2477, 2478,
+
+     2479, 2480, 2481, 2482, 2483,   13, 2484, 2485,   13,   13,
+       13, 2486, 2487, 2488,   13, 2489, 2490, 2491,   13, 2492,
+     2493, 2494, 2495, 2496, 2497, 2498, 2499,   13,   13,   13,
+     2500, 2501, 2502, 2503, 2504, 2505,   13, 2506, 2507, 2508,
+       13, 2509, 2510,   13, 2511, 2512, 2513, 2514, 2515, 2516,
+     2517, 2518, 2519, 2520,   13,   13, 2521,   13, 2522, 2523,
+     2524,   13,   13,   13, 2525, 2527,   13, 2528, 2529, 2526,
+     2530, 2531, 2532, 2533, 2534, 2535,   13, 2536, 2537, 2538,
+     2539,   13, 2540, 2541, 2542, 2543, 2544,   13, 2545, 2546,
+     2547, 2548, 2549, 2550, 2551, 2552, 2553, 2555, 2557, 2554,
+
+     2558, 2559, 2556, 2560, 2561, 2562, 2563, 2564,   13,   13,
+     2565, 2566,   13,   13, 2567, 2568, 2569,   13, 2570, 2571,
+       13, 2572, 2573,   13, 2574, 2575, 2576,   13, 2577, 2578,
+     2579, 2580, 2581, 2582, 2583,   13,   13, 2584, 2585, 2586,
+     2587, 2588,   13, 2589, 2590, 2591, 2592, 2593, 2594, 2595,
+       13,   13, 2596, 2597, 2598, 2599,   13,   13,   13, 2600,
+     2601,   13, 2602,   13, 2603, 2604, 2605, 2606, 2607,   13,
+     2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617,
+     2618, 2619, 2620, 2621, 2622, 2623,   13, 2624, 2625, 2626,
+     2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636,
+
+     2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644,   13,   13,
+     2645, 2646, 2647,   13, 2648,   13,   13, 2649,   13,   13,
+     2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659,
+       13,   13, 2660, 2661, 2662, 2663,   13, 2664, 2665, 2666,
+     2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676,
+     2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684,   13,   13,
+     2685, 2686,   13, 2687, 2688, 2689, 2690, 2691, 2692, 2693,
+     2694, 2695,   13, 2696, 2697, 2699, 2700, 2698, 2701, 2702,
+     2703, 2704, 2705,   13, 2706, 2707, 2708, 2709, 2710, 2711,
+     2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721,
+
+     2722,   13, 2723, 2724,   13, 2725, 2726, 2727, 2728, 2729,
+       13, 2730, 2731, 2732, 2733, 2734, 2735,   13, 2736, 2737,
+     2738,   13, 2739,   13,   13, 2740, 2741, 2742, 2743, 2744,
+       13,   13,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
+     2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
+     2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
+
+     2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
+     2745, 2745, 2745, 2745
     } ;
 
-static yyconst flex_int16_t yy_chk[4734] =
-    {   0,
+static yyconst flex_int16_t yy_chk[3915] =
+    {   1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    4,    4,    4,    5,    5,    6,    6,
-        5,    3,    6,   20,    4,   20,   20,    5,   20,    6,
-        7,    7,    7,    7,   20,    7,    8,    8,    8,    8,
-     2400,    8,    7,    9,    9,    9,   22,   22,    8,   10,
-       10,   10,   15,   25,    9,   21,   15,   25,   21,   21,
-       10,   11,   11,   11,   11,   11,   11,   19,   52,   19,
-
-       19,   52,   19,   11,   26,   26,   21,   25,   19,   19,
-       79,   29,   11,   12,   12,   12,   12,   12,   12,   26,
-       23,   23,   27,   27,   24,   12,   29,   31,   23,   24,
-       79,   27,   23,   24,   12,   23,   24,   28,   24,   24,
-       30,   28,   31,   34,   28,   30,   32,   32,   42,   33,
-       33,   28,   72,   28,   33,   32,   72,   35,  829,   36,
-       69,   32,   35,   42,   34,   32,   35,   47,   47,   88,
-       33,   82,   35,   36,   69,   35,   37,   37,   38,   63,
-       63,   37,   35,   38,   39,   39,   38,   39,   88,   82,
-      226,   37,   40,   38,   37,   84,   40,   38,   38,   41,
-
-       41,   78,   39,   95,   41,   78,   40,   95,   41,   84,
-       40,   40,   58,  226,   58,   58,   66,   58,   66,   66,
-       68,   66,   68,   68,   71,   68,   71,   71,   66,   71,
-       83,   74,   87,   74,   74,   71,   74,   77,   80,   83,
-       77,   80,   74,   74,   81,   85,   86,   81,   90,   89,
-       91,   85,   92,   93,   87,   89,   94,   85,   97,  100,
-       81,   96,   90,   92,   86,   86,   96,  103,   89,   99,
-       91,   93,   97,   98,   94,   99,   98,  101,  100,   98,
-      102,  104,  101,  102,  105,  107,  103,  102,  105,  106,
-      108,  103,   98,   98,   99,  104,  106,  108,  107,  109,
-
-      110,  111,  101,  112,  113,  114,  115,  112,  116,  116,
-      114,  117,  109,  124,  114,  118,  120,  119,  140,  111,
-      110,  140,  113,  122,  121,  124,  115,  121,  118,  125,
-      125,  117,  119,  123,  118,  120,  122,  126,  121,  123,
-      127,  128,  121,  129,  130,  131,  130,  132,  133,  135,
-      125,  134,  132,  155,  135,  126,  127,  131,  136,  129,
-      133,  155,  128,  138,  138,  145,  145,  130,  142,  134,
-      142,  142,  136,  142,  147,  156,  147,  147,  148,  147,
-      148,  148,  150,  148,  151,  150,  152,  153,  154,  151,
-      148,  157,  152,  158,  156,  153,  159,  161,  158,  154,
-
-      160,  196,  153,  161,  161,  162,  157,  163,  163,  160,
-      162,  164,  168,  165,  196,  165,  159,  164,  165,  166,
-      167,  167,  169,  166,  170,  177,  171,  169,  166,  170,
-      172,  168,  171,  166,  172,  165,  173,  174,  175,  166,
-      166,  173,  176,  177,  178,  179,  180,  180,  182,  178,
-      179,  174,  180,  175,  176,  171,  181,  176,  183,  184,
-      187,  181,  185,  185,  180,  184,  180,  186,  182,  188,
-      190,  191,  189,  186,  183,  188,  193,  191,  192,  186,
-      187,  189,  193,  192,  194,  195,  198,  197,  199,  200,
-      194,  190,  195,  197,  199,  201,  202,  203,  204,  205,
-
-      206,  208,  203,  201,  209,  207,  198,  210,  209,  202,
-      207,  200,  211,  204,  212,  205,  213,  214,  211,  208,
-      206,  215,  213,  215,  216,  218,  220,  146,  217,  210,
-      219,  216,  212,  212,  217,  229,  219,  214,  220,  221,
-      221,  222,  222,  223,  218,  224,  225,  227,  225,  223,
-      228,  224,  227,  230,  229,  233,  237,  231,  232,  238,
-      233,  230,  228,  231,  232,  225,  234,  223,  235,  236,
-      237,  234,  239,  240,  235,  241,  242,  238,  243,  242,
-      243,  240,  244,  244,  236,  245,  239,  246,  245,  247,
-      247,  248,  248,  249,  251,  250,  144,  251,  252,  253,
-
-      241,  254,  252,  255,  262,  246,  256,  254,  253,  249,
-      250,  257,  256,  258,  258,  257,  259,  255,  260,  261,
-      263,  259,  262,  264,  260,  265,  265,  266,  267,  268,
-      266,  269,  257,  268,  270,  270,  264,  271,  273,  261,
-      272,  263,  274,  272,  275,  276,  267,  275,  274,  269,
-      273,  277,  278,  279,  281,  271,  280,  276,  279,  280,
-      277,  278,  282,  283,  286,  283,  283,  281,  277,  277,
-      287,  277,  284,  284,  282,  285,  296,  280,  285,  288,
-      289,  286,  290,  290,  286,  287,  291,  293,  288,  289,
-      294,  291,  292,  292,  295,  294,  296,  297,  298,  299,
-
-      300,  301,  293,  302,  298,  300,  295,  301,  302,  303,
-      304,  305,  297,  304,  303,  304,  306,  307,  308,  299,
-      303,  310,  309,  311,  308,  305,  307,  309,  312,  313,
-      323,  314,  306,  316,  310,  306,  316,  306,  320,  317,
-      319,  324,  310,  311,  313,  314,  325,  320,  326,  312,
-      143,  323,  316,  317,  318,  319,  318,  318,  321,  322,
-      324,  325,  327,  321,  321,  322,  318,  328,  318,  318,
-      318,  330,  331,  318,  326,  332,  333,  329,  335,  334,
-      336,  328,  327,  329,  334,  337,  336,  329,  338,  339,
-      340,  333,  331,  335,  330,  332,  340,  341,  342,  343,
-
-      338,  345,  346,  339,  343,  337,  344,  344,  347,  344,
-      349,  348,  349,  350,  342,  351,  352,  350,  346,  351,
-      353,  345,  341,  354,  347,  348,  355,  358,  356,  357,
-      362,  352,  358,  360,  351,  359,  353,  356,  357,  359,
-      355,  354,  360,  361,  366,  368,  363,  374,  356,  361,
-      356,  362,  363,  364,  365,  367,  367,  364,  368,  365,
-      369,  370,  371,  371,  366,  369,  372,  373,  374,  376,
-      375,  373,  372,  377,  370,  375,  378,  379,  376,  380,
-      381,  381,  382,  380,  383,  377,  387,  382,  388,  379,
-      384,  384,  386,  386,  378,  389,  388,  390,  391,  394,
-
-      393,  395,  396,  397,  389,  383,  398,  387,  396,  399,
-      391,  398,  397,  400,  402,  395,  401,  390,  393,  394,
-      393,  400,  401,  399,  403,  404,  405,  403,  406,  407,
-      410,  404,  408,  406,  402,  409,  411,  413,  412,  409,
-      405,  411,  415,  417,  418,  410,  423,  416,  419,  404,
-      418,  407,  421,  408,  412,  418,  413,  414,  414,  417,
-      422,  422,  415,  414,  419,  414,  416,  420,  424,  424,
-      420,  423,  421,  414,  425,  426,  414,  427,  428,  429,
-      430,  431,  434,  414,  432,  430,  436,  426,  434,  425,
-      431,  433,  427,  438,  437,  436,  439,  428,  437,  438,
-
-      440,  429,  441,  432,  443,  442,  433,  141,  439,  442,
-      444,  445,  444,  446,  446,  440,  447,  443,  448,  445,
-      441,  449,  447,  450,  452,  451,  453,  449,  451,  454,
-      448,  453,  454,  455,  456,  450,  457,  139,  458,  452,
-      465,  457,  457,  459,  459,  460,  460,  461,  467,  455,
-      456,  458,  455,  461,  462,  462,  463,  463,  464,  469,
-      466,  465,  468,  472,  464,  466,  470,  467,  471,  472,
-      468,  473,  471,  474,  475,  473,  476,  477,  479,  475,
-      481,  478,  469,  477,  483,  470,  478,  480,  482,  482,
-      480,  474,  479,  486,  487,  480,  476,  488,  481,  480,
-
-      484,  485,  483,  488,  489,  484,  485,  486,  490,  487,
-      491,  490,  492,  489,  491,  493,  494,  492,  495,  496,
-      493,  497,  497,  499,  496,  498,  500,  501,  506,  502,
-      662,  495,  494,  501,  498,  502,  491,  503,  500,  499,
-      503,  504,  505,  507,  504,  508,  506,  505,  509,  510,
-      517,  508,  662,  509,  514,  510,  511,  507,  512,  511,
-      513,  515,  516,  512,  518,  513,  513,  514,  516,  517,
-      520,  521,  519,  518,  515,  519,  520,  522,  525,  523,
-      524,  524,  522,  521,  523,  523,  526,  527,  526,  528,
-      519,  528,  529,  530,  531,  532,  533,  535,  534,  536,
-
-      533,  537,  539,  525,  538,  540,  527,  534,  539,  541,
-      529,  530,  535,  531,  543,  532,  544,  536,  543,  538,
-      537,  542,  542,  545,  540,  546,  547,  548,  541,  550,
-      546,  549,  551,  552,  545,  544,  550,  551,  553,  555,
-      552,  556,  547,  553,  549,  554,  548,  557,  556,  558,
-      554,  559,  560,  561,  564,  565,  557,  555,  561,  562,
-      559,  563,  562,  558,  560,  563,  566,  566,  564,  567,
-      567,  568,  568,  569,  571,  572,  565,  573,  567,  574,
-      575,  572,  569,  574,  576,  577,  578,  579,  580,  581,
-      590,  577,  575,  571,  578,  582,  584,  573,  587,  590,
-
-      582,  602,  576,  596,  582,  579,  591,  582,  600,  581,
-      595,  584,  591,  580,  582,  587,  592,  582,  593,  593,
-      592,  594,  594,  596,  595,  597,  602,  601,  607,  600,
-      599,  597,  598,  598,  598,  599,  598,  603,  137,  598,
-      603,  604,  604,  607,  598,  601,  605,  606,  606,  613,
-      598,  598,  609,  605,  608,  608,  610,  609,  611,  610,
-      612,  613,  612,  611,  614,  615,  616,  618,  617,  615,
-      619,  619,  623,  620,  622,  618,  621,  624,  625,  625,
-      627,   70,  624,  614,  623,  627,  616,  617,  620,  628,
-      621,  629,  622,  630,  631,  628,  630,  629,  632,  633,
-
-      631,  634,  636,  635,  637,  639,  632,  633,  635,  636,
-      638,  638,  640,  642,  639,  641,  644,  645,  651,  634,
-      640,  641,  648,  637,  646,  644,  645,  646,  647,  649,
-      649,  650,  642,  647,  652,  653,  648,  651,  654,  658,
-      656,  654,  656,  652,  657,  657,  650,  659,  660,  654,
-      661,  663,  659,  664,  665,  666,  667,  668,  665,  653,
-      658,  671,  664,  670,  669,  673,  668,  671,  674,  660,
-      661,  663,  676,  666,  675,  667,  669,  670,  672,  672,
-      675,  677,  674,  679,  678,  673,  680,  677,  678,  681,
-      682,  684,  676,  689,  681,  683,  683,  684,  680,  686,
-
-      685,  687,  679,  685,  688,  691,  680,  690,  690,  694,
-      688,  682,  695,  689,  687,  692,  695,  686,  693,  693,
-      692,  696,  697,  691,  694,  699,  696,  702,  700,  703,
-      705,  705,  706,  707,  708,  709,  706,  710,  711,  709,
-      713,  697,  700,  711,  712,  713,  713,  702,  707,  699,
-      703,  704,  710,  715,  704,  714,  704,  715,  712,  708,
-      704,  716,  704,  717,  720,  718,  719,  704,  717,  714,
-      718,  722,  704,  721,  725,  723,  716,  722,  717,  725,
-      719,  723,  724,  724,  726,  720,  727,  721,  728,  728,
-      729,  731,  730,  737,  728,  736,  728,  730,  732,  733,
-
-      733,  734,  729,  726,  727,  731,  734,  728,  735,  736,
-      732,  738,  737,  744,  728,  740,  735,  739,  739,  740,
-      742,  743,  745,  746,  743,  748,  742,  749,  747,  746,
-      738,  750,  744,  747,  751,  745,  749,  752,  753,  754,
-      750,  755,  756,  752,  748,  757,  755,  753,  758,  761,
-      751,  759,  760,  763,  764,  761,  765,  766,  754,  757,
-      759,  760,  756,   64,  767,  768,  769,  763,  758,  767,
-      768,  769,  766,  764,  765,  770,  771,  771,  773,  772,
-      775,  776,  780,  779,  770,  772,  776,  776,  777,  777,
-      778,  773,  777,  778,  781,  782,  775,  779,  783,  785,
-
-      784,  782,  780,  784,  791,  786,  787,  788,  789,  781,
-      786,  787,  790,  789,  794,  793,  791,  790,  783,  795,
-      785,  793,  797,  788,  798,  795,  796,  796,  800,  799,
-      794,  797,  799,  801,  802,  803,  805,  804,  808,  806,
-      810,  805,  798,  804,  806,  811,  800,  809,  803,  812,
-      809,  810,  801,  813,  802,  815,  808,  816,  814,  813,
-      818,  812,  816,  811,  814,  817,  817,  819,  820,  821,
-      815,  822,  824,  821,  823,  825,  827,  828,  828,  818,
-      820,  819,  830,  823,  831,  832,  832,  833,  834,  822,
-       59,  824,  835,  843,  834,  827,  830,  836,  835,  831,
-
-      825,  837,  836,  837,  838,  839,  840,  833,  841,  838,
-      842,  844,  843,  841,  845,  846,  847,  847,  844,  839,
-      840,  848,  849,  851,  850,  842,  854,  854,  852,  845,
-      850,  855,  856,  852,  846,  848,  855,  857,  858,  856,
-      849,  858,  852,  851,  852,  859,  860,  852,  861,  862,
-      864,  857,  863,  861,  867,  860,  868,  863,  866,  866,
-      869,  868,  870,  859,  869,  871,  872,  873,  862,  864,
-      874,  870,  875,  876,  867,  877,  878,  874,  880,  881,
-      871,  879,  873,  882,  875,  872,  883,  879,  886,  888,
-      887,  885,  876,  880,  878,  883,  877,  885,  887,  881,
-
-      889,  890,  886,  882,  892,  889,  891,  893,  976,  888,
-      898,  891,  891,  890,  894,  895,  895,  897,  899,  898,
-      976,  893,  902,  892,  899,  900,  900,  894,  896,  901,
-      897,  902,  906,  896,  901,  903,  896,  896,  904,  907,
-      903,  896,  909,  904,  905,  905,  910,  896,  907,  908,
-      928,  896,  906,  911,  908,  912,  909,  913,  928,  911,
-      915,  912,  913,  914,  910,  916,  916,  914,  917,  915,
-      917,  918,  921,  920,  915,  922,  915,  920,  915,  923,
-      915,  925,  918,  926,  924,  927,  929,  921,  923,  924,
-      924,  930,  926,  922,  931,  925,  930,  932,  933,  934,
-
-      929,   54,  935,  937,  927,  944,  932,  935,  931,  936,
-      936,  938,  938,  942,  940,  941,  933,  940,  937,  947,
-      941,  943,  943,  946,  934,  944,  945,  945,  946,  948,
-      948,  949,  942,  950,  951,  955,  952,  956,  950,  953,
-      947,  952,  951,  956,  953,  954,  954,  957,  958,  960,
-      961,  949,  962,  955,  957,  960,  961,  962,  963,  964,
-      965,  958,  966,  968,  963,  967,  967,  970,  964,  971,
-      973,  974,  977,  966,  975,  978,  973,  979,  979,  965,
-      980,  981,  985,  968,  982,  974,  977,  970,  984,  984,
-      983,  974,  971,  978,  975,  983,  986,  988,  989,  990,
-
-      980,  986,  982,  989,  989,  985,  981,  991,  990,  992,
-      993,  994,  995,  997, 1002,  991,  988,  995,  998,  996,
-      995,  996, 1000,  992,  998,  993,  994,  997,  999,  994,
-     1001, 1004,  999, 1000, 1003, 1005, 1004, 1006, 1008, 1010,
-     1002, 1009, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1001,
-     1016, 1017, 1003, 1005, 1018, 1021, 1008, 1006, 1013, 1018,
-     1019, 1014, 1011, 1015, 1012, 1016, 1020, 1019, 1022, 1024,
-     1017, 1020, 1025, 1021, 1023, 1023, 1026, 1022, 1025, 1034,
-     1027, 1028, 1029, 1034, 1024, 1027, 1035, 1028, 1029, 1030,
-     1030, 1031, 1031, 1033, 1033, 1035, 1036, 1026, 1037, 1039,
-
-     1038, 1040, 1040, 1041, 1043, 1042, 1039, 1044, 1045, 1043,
-     1048, 1046, 1037, 1042, 1036, 1038, 1046, 1046, 1049, 1047,
-     1050, 1044, 1051, 1041, 1047, 1047, 1052, 1045, 1053, 1054,
-     1048, 1057, 1052, 1058, 1055, 1061, 1056, 1049, 1059, 1050,
-     1055, 1051, 1056, 1060, 1062, 1063, 1064, 1064, 1054, 1061,
-     1057, 1066, 1058, 1065, 1053, 1075, 1065, 1059, 1067, 1067,
-     1063, 1068, 1060, 1066, 1069, 1062, 1068, 1070, 1069, 1071,
-     1072, 1073, 1076, 1073, 1078, 1075, 1081, 1073, 1071, 1078,
-     1070, 1077, 1077, 1072, 1082, 1079, 1083, 1080, 1076, 1079,
-     1073, 1080, 1084, 1085, 1085, 1087, 1081, 1091, 1084, 1089,
-
-     1090, 1090, 1082, 1091, 1089, 1096, 1083, 1093, 1093, 1095,
-     1095, 1098, 1100, 1087, 1098, 1099, 1099, 1101, 1102, 1102,
-     1103, 1096, 1105, 1104, 1106, 1106, 1107, 1100, 1104, 1108,
-     1107, 1109, 1109, 1110, 1103, 1111, 1112, 1105, 1113, 1114,
-     1112, 1117, 1101, 1121, 1114, 1122, 1111, 1116, 1116, 1108,
-     1118, 1119, 1119, 1120, 1125, 1110, 1124, 1113, 1120, 1117,
-     1123, 1124, 1127, 1121, 1118, 1122, 1126, 1127, 1126, 1123,
-     1128, 1129, 1130, 1132, 1125, 1134, 1128, 1135, 1130, 1133,
-     1133, 1137, 1140, 1135, 1138, 1138, 1141, 1132, 1139, 1139,
-     1143, 1129, 1142, 1143, 1134, 1146, 1140, 1144, 1144, 1145,
-
-     1147, 1150, 1148, 1147, 1141, 1137, 1147, 1142, 1148, 1149,
-     1150, 1145, 1151, 1152, 1149, 1146, 1153, 1151, 1147, 1153,
-     1154, 1155, 1155, 1156, 1157, 1158, 1154, 1159, 1156, 1160,
-     1161, 1164, 1166, 1166, 1162, 1163, 1161, 1157, 1152, 1162,
-     1165, 1163, 1167, 1158, 1168, 1165, 1159, 1167, 1169, 1160,
-     1170, 1171, 1172, 1175, 1164, 1173, 1174, 1176, 1177, 1175,
-     1178, 1179, 1168, 1181, 1181, 1171, 1172, 1173, 1169, 1174,
-     1170, 1182, 1184, 1184, 1178, 1183, 1186, 1176, 1177, 1185,
-     1183, 1187, 1179, 1188, 1189, 1190, 1193, 1192, 1191, 1195,
-     1186, 1182, 1197, 1189, 1185, 1191, 1192, 1198, 1198, 1192,
-
-     1190, 1188, 1193, 1201, 1195, 1187, 1199, 1199, 1200, 1195,
-     1202, 1200, 1203, 1205, 1204, 1202, 1207, 1197, 1206, 1210,
-     1208, 1213, 1201, 1204, 1211, 1207, 1208, 1206, 1203, 1212,
-     1206, 1215, 1205, 1209, 1209, 1213, 1214, 1211, 1217, 1210,
-     1218, 1219, 1219, 1215, 1220, 1221, 1222, 1212, 1225, 1223,
-     1223, 1222, 1214, 1224, 1221, 1228, 1229,   53, 1218, 1236,
-     1220, 1228, 1224, 1217, 1223, 1224, 1225, 1226, 1230, 1230,
-     1231, 1233, 1226, 1226, 1229, 1232, 1231, 1233, 1234, 1236,
-     1232, 1237, 1238, 1239, 1234, 1242, 1239, 1237, 1243, 1244,
-     1245, 1246, 1239, 1247, 1248, 1238, 1243, 1249, 1250, 1253,
-
-     1248, 1254, 1244, 1259, 1242, 1254, 1247,   48, 1245, 1255,
-     1246, 1252, 1252, 1249, 1255, 1256, 1250, 1257, 1258, 1253,
-     1256, 1261, 1257, 1262, 1262, 1263, 1259, 1258, 1264, 1265,
-     1266, 1267, 1268, 1270, 1269, 1264, 1261, 1271, 1272, 1263,
-     1269, 1265, 1266,   43, 1272, 1270, 1273, 1273, 1274, 1278,
-     1267, 1274, 1268, 1275, 1275, 1271, 1277, 1280, 1278, 1279,
-     1279, 1277, 1281, 1282, 1281, 1283, 1282, 1284, 1285, 1280,
-     1286, 1287, 1288, 1291, 1292, 1289, 1287, 1290, 1291, 1293,
-     1294, 1288, 1297, 1292, 1299, 1283, 1285, 1289, 1286, 1284,
-     1295, 1295, 1290, 1298, 1296, 1294, 1292, 1300, 1300, 1293,
-
-     1296, 1301, 1301, 1297, 1299, 1302, 1302, 1303, 1304, 1304,
-     1305, 1307, 1298, 1306, 1306, 1307, 1308, 1309, 1311, 1312,
-     1309, 1314, 1308, 1313, 1311, 1315, 1319, 1303, 1315, 1313,
-     1318, 1305, 1316, 1316, 1317, 1317, 1318, 1312, 1319, 1319,
-     1319, 1320, 1321, 1322, 1323, 1319, 1314, 1325, 1327, 1322,
-     1327, 1326, 1325, 1325, 1329, 1328, 1332, 1330, 1331, 1333,
-     1335, 1320, 1321, 1330, 1323, 1326, 1328, 1331, 1337, 1329,
-     1334, 1334, 1336, 1336, 1338, 1343, 1332, 1339, 1339, 1344,
-     1333, 1340, 1340, 1346, 1343, 1347, 1335, 1349, 1337, 1345,
-     1345, 1351, 1347, 1348, 1350, 1350, 1338, 1355, 1346, 1352,
-
-     1344, 1354, 1348, 1355, 1356, 1357, 1354, 1363, 1358, 1364,
-     1359, 1365, 1357, 1349, 1358, 1352, 1359, 1351, 1360, 1360,
-     1361, 1362, 1367, 1365, 1356, 1361, 1366, 1363, 1364, 1366,
-     1362, 1368, 1369, 1369, 1370, 1371, 1374, 1373, 1377, 1371,
-     1367, 1376, 1377, 1379, 1378, 1380, 1380, 1381, 1383, 1370,
-     1378, 1374, 1379, 1382, 1382, 1371, 1373, 1368, 1381, 1384,
-     1376, 1385, 1386, 1381, 1387, 1387, 1388, 1391, 1386, 1383,
-     1389, 1388, 1388, 1384, 1390, 1392, 1389, 1393, 1395, 1397,
-     1390, 1385, 1396, 1393, 1398, 1400, 1396, 1392, 1399, 1401,
-     1395, 1397, 1402, 1391, 1399, 1401, 1404, 1405, 1405, 1404,
-
-     1406, 1406, 1407, 1407, 1402, 1408, 1409, 1400, 1410, 1398,
-     1411, 1412, 1409, 1413, 1410, 1411, 1415, 1412, 1418, 1420,
-     1417, 1415, 1413, 1417, 1421, 1408, 1424, 1422, 1423, 1423,
-     1418, 1420, 1422, 1425, 1426, 1424, 1421, 1428, 1425, 1426,
-     1427, 1427, 1429, 1430, 1431, 1432, 1435, 1433, 1434, 1432,
-     1438, 1429, 1433, 1439, 1434, 1437, 1437, 1428, 1441, 1446,
-     1435, 1430, 1439, 1431, 1440, 1444, 1444, 1437, 1438, 1448,
-     1450, 1441, 1449, 1440, 1451, 1446, 1450, 1452, 1452, 1453,
-     1455, 1453, 1454, 1454, 1448, 1457, 1449, 1458, 1455, 1459,
-     1459, 1451, 1457, 1460, 1461, 1465, 1462, 1463, 1464, 1466,
-
-     1467, 1470, 1460, 1469, 1471, 1471, 1467, 1458, 1462, 1463,
-     1464, 1472, 1473, 1470, 1466, 1461, 1476, 1474, 1489, 1467,
-     1474, 1465, 1475, 1469, 1479, 1478, 1479, 1475, 1480, 1472,
-     1478, 1484, 1473, 1481, 1482, 1485, 1476, 1485, 1481, 1487,
-     1484, 1482, 1488, 1488, 1489, 1490, 1480, 1491, 1494, 1491,
-     1490, 1492, 1493, 1487, 1495, 1496, 1492, 1493, 1497, 1498,
-     1499, 1496, 1501, 1497, 1502, 1505, 1494, 1506, 1499, 1503,
-     1503, 1507, 1498,   14, 1495, 1504, 1504, 1507, 1502, 1508,
-     1505, 1501, 1510, 1509, 1508, 1509, 1513, 1506, 1511, 1511,
-     1512, 1512, 1515, 1517, 1510, 1513, 1518, 1514, 1513, 1514,
-
-     1516, 1516, 1517, 1523, 1520, 1521, 1524, 1525, 1518, 1520,
-     1521, 1526, 1528, 1515, 1530, 1531, 1523, 1532, 1528, 1533,
-     1530, 1534, 1535, 1535, 1536, 1525, 1524, 1526, 1537, 1537,
-     1534, 1528, 1532, 1536, 1538, 1539, 1540, 1541, 1531, 1539,
-     1542, 1540, 1544, 1543, 1533, 1542, 1542, 1547, 1547, 1549,
-     1541, 1543, 1552, 1538, 1548, 1548, 1550, 1550, 1549, 1551,
-     1551, 1553, 1544, 1555, 1552, 1554, 1556, 1556, 1555, 1548,
-     1557, 1554, 1558, 1560, 1561, 1557, 1564, 1560, 1558, 1553,
-     1548, 1562, 1565, 1566, 1567, 1562, 1568, 1565, 1570, 1569,
-     1573, 1568, 1571, 1571, 1561, 1575, 1572, 1574, 1576, 1567,
-
-     1572, 1564, 1574, 1579, 1570, 1573, 1566, 1569, 1577, 1577,
-     1580, 1581, 1582, 1583, 1584, 1585, 1590, 1576, 1588, 1588,
-     1606, 1575, 1579, 1587, 1589, 1591, 1584, 1589, 1592, 1590,
-       13, 1582, 1606, 1580, 1583, 1581, 1585, 1596, 1587, 1591,
-     1597, 1592, 1593, 1593, 1594, 1594, 1595, 1595, 1598, 1598,
-     1599, 1601, 1596, 1597, 1600, 1600, 1601, 1604, 1603, 1599,
-     1605, 1611, 1599, 1603, 1607, 1607, 1608, 1608, 1609, 1610,
-     1610, 1612, 1612, 1613, 1613, 1614, 1615, 1604, 1617, 1611,
-     1605, 1618, 1618, 1617, 1619, 1620, 1620, 1609, 1621, 1614,
-     1622, 1623, 1624, 1624, 1623, 1615, 1622, 1625, 1625, 1626,
-
-     1627, 1628, 1631, 1619, 1629, 1629, 1621, 1632, 1624, 1633,
-     1634, 1635, 1635, 1636, 1634, 1627, 1637, 1637, 1626, 1638,
-     1628, 1639, 1631, 1640, 1633, 1641, 1641, 1642, 1639, 1643,
-     1632, 1643, 1636, 1645, 1647, 1646, 1642, 1648, 1650, 1638,
-     1646, 1649, 1651, 1650, 1653, 1645, 1652, 1651, 1654, 1640,
-     1648, 1655, 1657, 1653, 1656, 1661,    0, 1654, 1658, 1647,
-     1655, 1652, 1649, 1656, 1658, 1659, 1657, 1663, 1665, 1659,
-     1664, 1664, 1666, 1666, 1665, 1661, 1663, 1667, 1669, 1670,
-     1672, 1666, 1673, 1675, 1677, 1674, 1678, 1677, 1670, 1679,
-     1680, 1678, 1672, 1669,    0, 1675, 1685, 1667, 1673, 1667,
-
-     1674, 1685, 1680, 1681, 1681, 1683, 1683, 1684, 1686, 1679,
-     1684, 1687, 1688, 1688, 1686, 1689, 1691, 1687, 1690, 1690,
-     1692, 1693, 1694, 1694, 1697, 1700, 1696, 1697, 1691, 1689,
-     1696, 1698, 1698, 1699, 1692, 1702, 1703, 1704, 1699, 1705,
-     1693, 1704, 1706, 1707, 1709, 1700, 1708, 1706, 1711, 1707,
-     1703, 1712, 1708, 1714, 1713, 1702, 1712, 1718, 1721, 1705,
-     1713, 1714, 1709, 1715, 1711, 1715, 1719, 1719, 1726, 1720,
-     1725, 1718, 1720, 1722, 1722, 1724, 1725, 1727, 1727, 1724,
-     1726, 1728, 1731, 1731, 1721, 1733, 1736, 1737, 1738, 1738,
-     1728, 1736, 1737, 1740, 1740, 1742, 1743, 1743, 1744, 1745,
-
-     1746, 1742, 1752, 1733, 1748, 1746, 1749, 1750, 1750, 1753,
-     1754, 1752, 1755,    0, 1744, 1753, 1757, 1757, 1749, 1759,
-     1759, 1745, 1763, 1748, 1760, 1760, 1761, 1755, 1754, 1764,
-     1762, 1761, 1762, 1765, 1766, 1766, 1763, 1769, 1765, 1767,
-     1767, 1768, 1768, 1764, 1770, 1771, 1771, 1772, 1773, 1769,
-     1774, 1775, 1776, 1777, 1778, 1779, 1779, 1774, 1777, 1772,
-     1773, 1780, 1770, 1775, 1781, 1782, 1783, 1784, 1785, 1787,
-     1780, 1788, 1776, 1789, 1778, 1786, 1786, 1790, 1787, 1783,
-     1791, 1793, 1785, 1791, 1792, 1782, 1793, 1794, 1801, 1788,
-     1781, 1784, 1794, 1795, 1795, 1789, 1796, 1796, 1792, 1802,
-
-     1790, 1797, 1797, 1800, 1800, 1803, 1801, 1805, 1806, 1807,
-     1802, 1809, 1808, 1810, 1812, 1812, 1811, 1814, 1814, 1815,
-     1809, 1816, 1817, 1818, 1803, 1819, 1806, 1805, 1815, 1817,
-     1820, 1807, 1808, 1810, 1811, 1821, 1822, 1828, 1818, 1816,
-     1823, 1823, 1826, 1819, 1824, 1824, 1825, 1827, 1820, 1829,
-     1830, 1821, 1825, 1831, 1829, 1822, 1828, 1833, 1832, 1833,
-     1826, 1838, 1827, 1832, 1834, 1834, 1835, 1840, 1835, 1841,
-     1830, 1836, 1836, 1831, 1842, 1845, 1840, 1848, 1846, 1849,
-     1838, 1846, 1847, 1847, 1850, 1850, 1851, 1853, 1856, 1841,
-     1851, 1861, 1848, 1842, 1854, 1845, 1869, 1849, 1854, 1855,
-
-     1855, 1856, 1853, 1858, 1858, 1860, 1860, 1862, 1862, 1863,
-     1861, 1864, 1864, 1870, 1863, 1868, 1868, 1872, 1869, 1871,
-     1873, 1876, 1872, 1875, 1874, 1877, 1870, 1879, 1871, 1874,
-     1880, 1875, 1881, 1877, 1873, 1880, 1882, 1881, 1883, 1883,
-     1876, 1885, 1879, 1884, 1884, 1886, 1887, 1890, 1885, 1888,
-     1886, 1882, 1887, 1891, 1888, 1889, 1889, 1896, 1891, 1892,
-     1892, 1898, 1890, 1893, 1893, 1897, 1898, 1898, 1897, 1899,
-     1896, 1900, 1901, 1902, 1899, 1903, 1900, 1902, 1901, 1904,
-     1903, 1905, 1906, 1908, 1907, 1912, 1913, 1911, 1904, 1907,
-     1906, 1910, 1911, 1914, 1910, 1908, 1905, 1915, 1917, 1913,
-
-     1916, 1916, 1914, 1912, 1920, 1921, 1915, 1917, 1922, 1923,
-     1923, 1924, 1925, 1926, 1927, 1927, 1928, 1930, 1932,    0,
-     1933, 1925, 1942, 1920, 1933, 1921, 1942, 1922, 1926, 1940,
-     1924, 1934, 1930, 1935, 1935, 1928, 1936, 1934, 1932, 1939,
-     1937, 1943, 1940, 1944, 1936, 1937, 1946, 1946, 1939, 1949,
-     1949, 1951, 1953, 1954, 1954, 1943, 1955, 1955, 1944, 1956,
-     1957, 1957, 1956, 1958, 1958, 1959, 1959, 1960, 1961, 1961,
-     1962, 1951, 1953, 1963, 1964, 1965, 1965, 1966, 1969, 1970,
-     1964, 1966, 1960, 1969, 1969, 1971, 1972, 1963, 1962, 1973,
-     1974, 1971, 1972, 1978, 1974, 1975, 1975, 1979, 1978, 1982,
-
-     1980, 1983, 1970, 1980, 1983, 1979, 1985, 1988, 1984, 1986,
-     1987, 1985, 1989, 1989, 1973, 1990, 1992, 1993, 1993, 1998,
-     1991, 1988, 1994, 1994, 1982, 1984, 1984, 1986, 1991, 1996,
-     1987, 1995, 1995, 1997, 1990, 1992, 1999, 2000, 1997, 1998,
-     2001, 2002, 2004, 2004, 2005, 1996, 2000, 2005, 2006, 2008,
-     2008, 2009, 2010, 2010, 2011, 2012, 2014, 2027, 2009, 2011,
-     2001, 2002, 1999, 2017, 2012, 2016, 2006, 2015, 2015, 2016,
-     2018, 2019, 2017, 2020, 2014, 2021, 2019, 2019, 2023, 2023,
-     2024, 2025, 2027, 2029, 2021, 2018, 2020, 2031, 2043, 2024,
-     2035, 2033, 2041, 2025, 2042, 2029, 2033, 2034, 2034, 2035,
-
-     2037, 2041, 2038, 2038, 2051, 2037, 2038, 2043, 2031, 2040,
-     2040, 2044, 2046, 2050, 2042, 2047, 2044, 2048, 2046, 2053,
-     2047, 2052, 2048, 2049, 2049, 2051, 2052, 2054, 2055, 2056,
-     2056, 2050, 2058, 2054, 2059, 2060, 2060, 2053, 2062, 2061,
-     2064, 2063, 2062, 2065, 2068, 2070, 2066, 2069, 2069, 2059,
-     2063, 2058, 2061, 2055, 2066, 2067, 2064, 2072, 2072, 2075,
-     2067, 2078, 2065, 2082, 2070, 2073, 2073, 2077, 2077, 2079,
-     2068, 2081, 2081, 2083, 2079, 2084, 2087, 2078, 2086, 2086,
-     2075, 2089, 2092, 2082, 2090, 2090, 2091, 2091, 2093, 2095,
-     2087, 2092, 2094, 2096, 2084, 2101, 2083, 2097, 2097, 2098,
-
-     2102, 2095, 2098, 2089, 2099, 2099, 2103, 2101, 2093, 2104,
-     2104, 2094, 2103, 2096, 2105, 2106, 2107, 2105, 2109, 2110,
-     2102, 2106, 2111, 2109, 2110, 2112, 2113, 2114, 2114, 2116,
-     2116, 2112, 2117, 2120, 2107, 2119, 2119, 2122, 2120, 2121,
-     2131, 2111, 2122, 2113, 2113, 2123, 2123, 2124, 2124, 2125,
-     2125, 2117, 2126, 2121, 2128, 2128, 2133, 2126, 2137, 2131,
-     2134, 2134, 2136, 2136, 2138, 2139, 2140, 2140, 2141, 2144,
-     2145, 2146, 2137, 2141, 2139, 2150, 2145, 2148, 2133, 2146,
-     2147, 2147, 2148, 2144, 2138, 2151, 2152, 2153, 2154, 2156,
-     2157, 2152, 2158, 2159, 2154, 2150, 2160, 2156, 2164, 2153,
-
-     2161, 2162, 2163, 2164, 2167, 2151, 2169, 2169, 2183, 2157,
-     2170, 2170, 2158, 2159, 2160,    0, 2161, 2171, 2162, 2162,
-     2182, 2171, 2183, 2163, 2167, 2175, 2175, 2177, 2177, 2178,
-     2178, 2179, 2178, 2181, 2181, 2179, 2185, 2185, 2182, 2186,
-     2187, 2188, 2190, 2191, 2187, 2200, 2186, 2192, 2192, 2193,
-     2193, 2195, 2191, 2194, 2194, 2197, 2188, 2196, 2201, 2199,
-     2190, 2202, 2196, 2198, 2197, 2199, 2195, 2197, 2198, 2198,
-     2200, 2203, 2204, 2201, 2205,    0, 2203, 2204, 2206, 2206,
-     2209, 2209, 2202, 2212, 2212, 2213, 2213, 2214, 2214, 2216,
-     2217, 2217, 2220, 2205, 2219, 2219, 2221, 2223, 2216, 2222,
-
-     2222, 2224, 2224, 2227, 2229, 2231, 2228, 2220, 2221, 2228,
-     2230, 2230, 2223, 2233, 2234, 2235, 2233, 2236, 2237, 2239,
-     2234, 2227, 2236, 2231, 2238, 2245, 2248, 2249, 2245, 2235,
-     2229, 2249, 2250, 2251, 2253, 2239, 2255, 2237, 2256, 2254,
-     2256, 2255, 2238, 2257, 2258, 2258, 2259, 2251, 2260, 2248,
-     2254, 2261, 2250, 2263, 2262, 2265, 2264, 2253, 2257, 2259,
-     2266, 2267, 2267, 2268, 2269, 2269, 2273, 2260, 2274, 2261,
-     2262, 2264, 2268, 2278, 2266, 2265, 2270, 2270, 2263, 2271,
-     2271, 2272, 2272, 2275, 2276, 2273, 2275, 2277, 2274, 2276,
-     2279, 2280, 2277, 2281, 2282, 2282, 2283, 2280, 2278, 2285,
-
-     2287, 2290, 2290, 2291, 2291, 2279, 2293, 2281, 2292, 2296,
-     2298, 2294, 2300, 2295, 2285, 2283, 2292, 2294, 2287, 2295,
-     2297, 2301, 2302, 2296, 2304, 2293, 2302, 2306, 2307, 2298,
-     2308, 2305, 2300, 2297, 2309, 2301, 2305, 2310, 2312, 2313,
-     2311, 2307, 2310, 2308, 2304, 2311, 2306, 2314, 2314, 2315,
-     2318, 2316, 2321, 2309, 2315, 2318, 2312, 2316, 2313, 2317,
-     2317, 2319, 2320, 2322, 2326, 2323, 2319, 2320, 2326, 2322,
-     2323, 2321, 2324, 2324, 2327, 2328, 2329, 2330, 2331, 2332,
-     2337, 2333, 2328,    0, 2331, 2334, 2334, 2336, 2336, 2337,
-     2339, 2340, 2337, 2327, 2333, 2329, 2330, 2338, 2332, 2341,
-
-     2342, 2342, 2338, 2343, 2344, 2346, 2347, 2347, 2343, 2339,
-     2340, 2348, 2341, 2349, 2349, 2350, 2350, 2344, 2351, 2352,
-     2353, 2354, 2354, 2351, 2355, 2356, 2352, 2356, 2358, 2355,
-     2348, 2346, 2357, 2357, 2359, 2358, 2360, 2361, 2362, 2353,
-     2365, 2359, 2361, 2364, 2364, 2367, 2368, 2369, 2370, 2374,
-     2367, 2368, 2371, 2371, 2375, 2360,    0, 2362,    0, 2365,
-     2373, 2373, 2376, 2376, 2377, 2377, 2369, 2370, 2374, 2378,
-     2380, 2380, 2382, 2375, 2381, 2381, 2378, 2384, 2387, 2382,
-     2388, 2389, 2384, 2387, 2390, 2390, 2391, 2391,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0, 2388,
-
-     2389, 2395, 2395, 2395, 2395, 2395, 2395, 2395, 2396, 2396,
-     2396, 2396, 2396, 2396, 2396, 2397, 2397, 2397, 2397, 2397,
-     2397, 2397, 2398, 2398, 2398, 2398, 2398, 2398, 2398, 2399,
-     2399, 2399, 2399, 2399, 2399, 2399, 2401, 2401,    0, 2401,
-     2401, 2401, 2401, 2402, 2402,    0,    0,    0, 2402, 2402,
-     2403, 2403,    0,    0, 2403,    0, 2403, 2404,    0,    0,
-        0,    0,    0, 2404, 2405, 2405,    0,    0,    0, 2405,
-     2405, 2406,    0,    0,    0,    0,    0, 2406, 2407, 2407,
-        0, 2407, 2407, 2407, 2407, 2408, 2408,    0, 2408, 2408,
-     2408, 2408, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394,
-
-     2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394,
-     2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394,
-     2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394, 2394,
-     2394, 2394, 2394
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+
+        9,    9,    9,    9,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   14,   14,   16,   17,   18,
+       22,   14,   29,   14,   14,   14,   14,   14,   30,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   15,   31,   15,   19,
+       19,   19,   15,   19,   19,   19,   19,   19,   19,   19,
+
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       20,   20,   20,   34,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   21,   21,   23,   25,   21,   36,   27,   26,   42,
+       23,   43,   45,   46,   23,   27,   47,   23,   23,   21,
+       23,   24,   26,   28,   25,   24,   28,   50,   24,   32,
+
+       24,   24,   33,   28,   51,   28,   33,   32,   35,   52,
+       37,   41,   35,   32,   37,   41,   56,   32,   35,   41,
+       33,   35,   33,   55,   37,   55,   38,   37,   35,   38,
+       38,   39,   40,   39,   57,   58,   38,   61,   62,   63,
+       38,   38,   40,   44,   44,   44,   40,   40,   39,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   48,   48,   48,   66,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   49,   49,   49,   68,   70,
+       49,   49,   79,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   53,   53,   53,   80,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+
+       53,   53,   53,   53,   53,   53,   53,   54,   54,   81,
+       82,   83,   85,   54,   86,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   59,   59,
+       59,   88,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   60,
+       60,   60,   87,   87,   89,   60,   60,   60,   60,   60,
+
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       64,   64,   64,   92,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   65,   65,   91,   91,   93,   95,   65,   96,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   67,   67,   67,   97,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   69,   69,   69,   98,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   73,   99,   73,   74,   74,   74,
+
+       73,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   77,   77,
+       77,  100,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   84,
+       90,   94,  101,  102,  104,  103,   90,  105,  103,  107,
+      106,  108,   84,  107,  109,  110,  108,  111,  112,  113,
+
+       94,  103,  103,  114,  115,  116,  117,  118,  119,  104,
+      106,  120,  121,  122,  123,  120,  124,  125,  126,  127,
+      128,  129,  124,  130,  131,  132,  133,  134,  135,  136,
+      127,  137,  138,  139,  127,  140,  141,  142,  143,  144,
+      153,  163,  153,  165,  166,  132,  167,  169,  170,  161,
+      161,  161,  137,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      168,  171,  172,  173,  174,  175,  176,  168,  177,  178,
+
+      179,  180,  181,  182,  183,  184,  185,  179,  186,  183,
+      184,  187,  188,  189,  190,  184,  191,  192,  193,  195,
+      194,  184,  184,  194,  196,  195,  183,  197,  198,  199,
+      200,  201,  202,  198,  203,  205,  204,  206,  207,  208,
+      209,  210,  189,  211,  212,  198,  213,  198,  204,  214,
+      215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+      225,  226,  227,  228,  229,  230,  231,  232,  232,  233,
+      234,  235,  236,  237,  238,  239,  240,  241,  242,  243,
+      244,  245,  246,  247,  248,  250,  251,  252,  253,  254,
+      255,  256,  257,  258,  259,  260,  261,  262,  245,  263,
+
+      264,  265,  266,  243,  267,  268,  269,  270,  271,  272,
+      273,  274,  275,  276,  277,  278,  279,  280,  281,  282,
+      283,  284,  285,  286,  287,  288,  289,  290,  291,  292,
+      293,  294,  295,  296,  297,  298,  299,  283,  300,  301,
+      302,  303,  304,  305,  306,  307,  308,  309,  310,  310,
+      304,  304,  311,  304,  312,  313,  314,  315,  316,  314,
+      307,  317,  318,  307,  319,  320,  321,  322,  323,  324,
+      325,  326,  327,  328,  329,  330,  331,  332,  333,  334,
+      333,  335,  331,  336,  335,  337,  335,  338,  339,  340,
+      341,  342,  343,  339,  344,  345,  339,  346,  348,  349,
+
+      347,  347,  350,  351,  352,  353,  354,  350,  355,  341,
+      347,  345,  347,  347,  347,  356,  357,  347,  358,  359,
+      360,  361,  362,  363,  364,  365,  366,  367,  368,  369,
+      360,  370,  371,  372,  373,  374,  375,  376,  377,  378,
+      378,  379,  380,  381,  382,  383,  384,  385,  386,  387,
+      388,  389,  390,  391,  392,  393,  394,  395,  396,  397,
+      398,  399,  385,  390,  400,  390,  401,  402,  403,  404,
+      405,  406,  407,  408,  409,  410,  411,  412,  413,  414,
+      415,  416,  417,  418,  419,  420,  421,  422,  423,  424,
+      425,  426,  427,  428,  429,  430,  431,  430,  432,  433,
+
+      434,  435,  436,  437,  438,  439,  440,  441,  442,  443,
+      444,  445,  446,  447,  448,  449,  450,  451,  452,  453,
+      454,  455,  456,  452,  457,  452,  458,  459,  460,  461,
+      462,  441,  463,  452,  464,  457,  452,  465,  466,  467,
+      468,  469,  470,  452,  471,  472,  473,  474,  475,  476,
+      477,  478,  479,  480,  481,  482,  483,  484,  485,  486,
+      487,  488,  489,  490,  491,  492,  493,  494,  485,  495,
+      496,  497,  498,  499,  485,  500,  501,  502,  500,  503,
+      504,  505,  502,  506,  507,  508,  509,  510,  511,  512,
+      513,  514,  515,  516,  517,  518,  519,  520,  521,  522,
+
+      523,  524,  525,  526,  527,  528,  529,  530,  526,  531,
+      532,  533,  526,  534,  535,  536,  537,  538,  539,  540,
+      541,  542,  543,  544,  545,  546,  547,  548,  549,  550,
+      551,  552,  553,  554,  555,  556,  557,  558,  537,  559,
+      560,  561,  562,  563,  564,  565,  561,  566,  567,  568,
+      569,  570,  571,  572,  573,  574,  575,  571,  576,  577,
+      578,  579,  580,  567,  581,  582,  583,  584,  585,  586,
+      587,  588,  589,  590,  591,  592,  593,  594,  595,  596,
+      597,  598,  599,  600,  601,  602,  603,  604,  605,  606,
+      607,  608,  609,  610,  611,  612,  613,  614,  615,  616,
+
+      617,  618,  619,  620,  621,  622,  623,  624,  625,  626,
+      627,  628,  621,  629,  630,  631,  632,  633,  634,  635,
+      636,  637,  638,  639,  640,  641,  642,  643,  640,  644,
+      645,  640,  646,  647,  648,  649,  650,  651,  640,  652,
+      653,  640,  654,  655,  656,  656,  657,  656,  658,  659,
+      656,  660,  661,  662,  663,  656,  664,  665,  666,  667,
+      668,  656,  656,  669,  670,  671,  672,  673,  674,  675,
+      676,  677,  678,  679,  680,  681,  682,  683,  684,  685,
+      686,  687,  688,  689,  690,  691,  692,  693,  675,  694,
+      695,  696,  697,  698,  699,  700,  701,  702,  703,  704,
+
+      705,  706,  707,  708,  709,  710,  711,  712,  713,  714,
+      715,  716,  717,  718,  719,  720,  721,  722,  715,  723,
+      724,  725,  726,  727,  728,  729,  715,  730,  731,  732,
+      733,  734,  735,  736,  737,  738,  739,  740,  741,  742,
+      743,  744,  745,  746,  747,  748,  749,  750,  751,  744,
+      752,  753,  754,  755,  756,  757,  758,  759,  760,  761,
+      762,  763,  764,  765,  766,  767,  768,  769,  770,  771,
+      772,  773,  774,  773,  775,  776,  777,  773,  778,  773,
+      779,  780,  781,  782,  773,  783,  784,  785,  786,  773,
+      787,  784,  788,  789,  790,  791,  792,  793,  794,  795,
+
+      796,  797,  788,  798,  799,  800,  801,  802,  803,  799,
+      804,  799,  805,  806,  807,  808,  809,  810,  811,  812,
+      813,  814,  799,  815,  816,  817,  818,  819,  820,  799,
+      821,  822,  823,  824,  825,  826,  827,  828,  829,  830,
+      831,  832,  833,  834,  835,  836,  837,  838,  839,  840,
+      841,  842,  843,  844,  845,  846,  847,  848,  849,  850,
+      851,  852,  853,  854,  852,  851,  855,  856,  857,  858,
+      859,  860,  861,  862,  863,  864,  865,  866,  867,  868,
+      869,  870,  871,  872,  873,  874,  875,  876,  877,  878,
+      879,  880,  881,  882,  883,  884,  885,  886,  887,  888,
+
+      889,  890,  891,  892,  893,  894,  895,  896,  897,  898,
+      899,  900,  901,  902,  903,  904,  905,  906,  907,  908,
+      910,  911,  912,  913,  914,  915,  916,  917,  918,  919,
+      920,  921,  922,  923,  924,  925,  926,  927,  928,  929,
+      930,  931,  932,  933,  934,  935,  936,  937,  938,  939,
+      940,  941,  942,  943,  944,  945,  946,  938,  947,  938,
+      948,  949,  938,  950,  951,  952,  953,  954,  955,  956,
+      957,  958,  959,  960,  961,  962,  963,  964,  965,  966,
+      967,  968,  969,  970,  971,  972,  973,  974,  975,  976,
+      977,  972,  978,  979,  980,  981,  982,  978,  983,  984,
+
+      985,  983,  983,  986,  987,  988,  983,  989,  990,  991,
+      992,  993,  983,  994,  995,  996,  983,  997,  998,  999,
+     1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009,
+     1010, 1011, 1005, 1012, 1013, 1014, 1015, 1005, 1016, 1005,
+     1014, 1005, 1017, 1005, 1018, 1019, 1020, 1021, 1022, 1023,
+     1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033,
+     1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043,
+     1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+     1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063,
+     1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073,
+
+     1074, 1075, 1076, 1071, 1077, 1078, 1079, 1080, 1081, 1082,
+     1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
+     1093, 1094, 1090, 1095, 1096, 1097, 1095, 1096, 1098, 1099,
+     1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109,
+     1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119,
+     1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129,
+     1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139,
+     1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
+     1150, 1151, 1152, 1153, 1154, 1150, 1151, 1155, 1156, 1157,
+     1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+
+     1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177,
+     1178, 1179, 1180, 1181, 1182, 1183, 1180, 1184, 1185, 1186,
+     1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1180,
+     1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205,
+     1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+     1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1222, 1224,
+     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+     1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
+     1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254,
+     1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264,
+
+     1265, 1266, 1267, 1265, 1268, 1269, 1270, 1271, 1272, 1273,
+     1274, 1275, 1276, 1277, 1278, 1265, 1279, 1280, 1281, 1282,
+     1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292,
+     1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302,
+     1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312,
+     1313, 1314, 1315, 1313, 1316, 1317, 1318, 1319, 1320, 1316,
+     1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330,
+     1328, 1329, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338,
+     1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348,
+     1349, 1350, 1348, 1351, 1352, 1353, 1350, 1354, 1355, 1356,
+
+     1357, 1358, 1347, 1346, 1359, 1360, 1361, 1362, 1363, 1364,
+     1365, 1366, 1367, 1368, 1369, 1370, 1365, 1371, 1372, 1373,
+     1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383,
+     1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
+     1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403,
+     1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413,
+     1409, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422,
+     1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432,
+     1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1428, 1441,
+     1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451,
+
+     1452, 1453, 1454, 1455, 1456, 1457, 1457, 1457, 1458, 1459,
+     1460, 1461, 1457, 1462, 1463, 1464, 1465, 1466, 1467, 1463,
+     1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
+     1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
+     1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497,
+     1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507,
+     1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
+     1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1528, 1526,
+     1527, 1529, 1530, 1515, 1526, 1527, 1531, 1532, 1533, 1534,
+     1535, 1536, 1537, 1538, 1539, 1535, 1540, 1541, 1542, 1543,
+
+     1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553,
+     1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563,
+     1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573,
+     1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+     1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593,
+     1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603,
+     1604, 1594, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612,
+     1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622,
+     1623, 1624, 1625, 1626, 1627, 1621, 1626, 1626, 1628, 1629,
+     1626, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638,
+
+     1626, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647,
+     1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657,
+     1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667,
+     1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677,
+     1678, 1679, 1680, 1678, 1681, 1682, 1683, 1684, 1685, 1686,
+     1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696,
+     1697, 1698, 1699, 1700, 1701, 1702, 1703, 1694, 1704, 1705,
+     1706, 1707, 1708, 1697, 1709, 1710, 1711, 1712, 1713, 1714,
+     1715, 1716, 1717, 1718, 1714, 1719, 1720, 1721, 1722, 1723,
+     1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733,
+
+     1734, 1735, 1736, 1723, 1737, 1738, 1739, 1740, 1741, 1742,
+     1743, 1744, 1745, 1746, 1723, 1747, 1748, 1749, 1750, 1751,
+     1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761,
+     1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771,
+     1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781,
+     1782, 1783, 1784, 1785, 1783, 1786, 1787, 1788, 1789, 1790,
+     1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800,
+     1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810,
+     1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820,
+     1821, 1822, 1823, 1824, 1825, 1826, 1827, 1813, 1828, 1829,
+
+     1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839,
+     1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849,
+     1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859,
+     1860, 1861, 1862, 1863, 1864, 1865, 1866, 1865, 1867, 1868,
+     1869, 1863, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877,
+     1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
+     1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897,
+     1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907,
+     1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917,
+     1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927,
+
+     1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937,
+     1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947,
+     1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957,
+     1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967,
+     1968, 1969, 1970, 1961, 1971, 1972, 1973, 1974, 1975, 1976,
+     1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986,
+     1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996,
+     1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006,
+     2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+     2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026,
+
+     2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036,
+     2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046,
+     2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056,
+     2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2065,
+     2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075,
+     2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085,
+     2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095,
+     2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105,
+     2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115,
+     2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125,
+
+     2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135,
+     2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145,
+     2146, 2147, 2148, 2149, 2150, 2151, 2152, 2148, 2153, 2154,
+     2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164,
+     2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174,
+     2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184,
+     2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194,
+     2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204,
+     2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214,
+     2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224,
+
+     2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234,
+     2235, 2236, 2237, 2233, 2238, 2239, 2240, 2241, 2242, 2243,
+     2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2251, 2252,
+     2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262,
+     2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272,
+     2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282,
+     2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292,
+     2293, 2294, 2295, 2296, 2292, 2297, 2294, 2298, 2299, 2300,
+     2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310,
+     2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320,
+
+     2318, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329,
+     2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339,
+     2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349,
+     2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359,
+     2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369,
+     2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379,
+     2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389,
+     2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399,
+     2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409,
+     2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418,
+
+     2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428,
+     2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438,
+     2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448,
+     2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458,
+     2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468,
+     2469, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477,
+     2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2482,
+     2487, 2488, 2489, 2489, 2490, 2491, 2492, 2493, 2494, 2495,
+     2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505,
+     2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2512,
+
+     2515, 2516, 2513, 2517, 2518, 2519, 2520, 2521, 2522, 2523,
+     2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533,
+     2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543,
+     2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553,
+     2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563,
+     2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
+     2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583,
+     2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593,
+     2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603,
+     2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613,
+
+     2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623,
+     2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633,
+     2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643,
+     2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653,
+     2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663,
+     2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673,
+     2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683,
+     2684, 2685, 2686, 2687, 2688, 2689, 2690, 2688, 2691, 2692,
+     2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702,
+     2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712,
+
+     2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722,
+     2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732,
+     2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742,
+     2743, 2744,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
+     2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
+     2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
+
+     2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
+     2745, 2745, 2745, 2745
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -2475,7 +2407,7 @@ static void config_end_include(void)
 #define YY_NO_INPUT 1
 #endif
 
-#line 2477 "<stdout>"
+#line 2409 "<stdout>"
 
 #define INITIAL 0
 #define quotedstring 1
@@ -2698,7 +2630,7 @@ YY_DECL
 	{
 #line 206 "./util/configlexer.lex"
 
-#line 2700 "<stdout>"
+#line 2632 "<stdout>"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2731,13 +2663,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 2395 )
+				if ( yy_current_state >= 2746 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 4693 );
+		while ( yy_base[yy_current_state] != 3874 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -2832,1097 +2764,1252 @@ YY_RULE_SETUP
 case 14:
 YY_RULE_SETUP
 #line 223 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_IP4) }
+{ YDVAR(1, VAR_INCOMING_TCP_PIPELINE) }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
 #line 224 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_IP6) }
+{ YDVAR(1, VAR_INCOMING_TCP_PIPELINE_TOTAL) }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
 #line 225 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFER_IP6) }
+{ YDVAR(1, VAR_TCP_REUSE_TIMEOUT) }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
 #line 226 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_UDP) }
+{ YDVAR(1, VAR_MAX_REUSE_TCP_QUERIES) }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
 #line 227 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_TCP) }
+{ YDVAR(1, VAR_DO_IP4) }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
 #line 228 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TCP_UPSTREAM) }
+{ YDVAR(1, VAR_DO_IP6) }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
 #line 229 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TCP_MSS) }
+{ YDVAR(1, VAR_PREFER_IP6) }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
 #line 230 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_TCP_MSS) }
+{ YDVAR(1, VAR_DO_UDP) }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
 #line 231 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_DO_TCP) }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
 #line 232 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
+{ YDVAR(1, VAR_TCP_UPSTREAM) }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
 #line 233 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
+{ YDVAR(1, VAR_TCP_MSS) }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
 #line 234 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_PORT) }
+{ YDVAR(1, VAR_OUTGOING_TCP_MSS) }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
 #line 235 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSTEMD) }
+{ YDVAR(1, VAR_SSL_UPSTREAM) }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
 #line 236 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_DAEMONIZE) }
+{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
 #line 237 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
 #line 238 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_SSL_PORT) }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
 #line 239 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
+{ YDVAR(1, VAR_USE_SYSTEMD) }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
 #line 240 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
+{ YDVAR(1, VAR_DO_DAEMONIZE) }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
 #line 241 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_RCVBUF) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
 #line 242 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_SNDBUF) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
 #line 243 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_REUSEPORT) }
+{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
 #line 244 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_TRANSPARENT) }
+{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
 #line 245 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_FREEBIND) }
+{ YDVAR(1, VAR_SO_RCVBUF) }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
 #line 246 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CHROOT) }
+{ YDVAR(1, VAR_SO_SNDBUF) }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
 #line 247 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USERNAME) }
+{ YDVAR(1, VAR_SO_REUSEPORT) }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
 #line 248 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DIRECTORY) }
+{ YDVAR(1, VAR_UDP_BATCH_SIZE) }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 249 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOGFILE) }
+{ YDVAR(1, VAR_IP_TRANSPARENT) }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 250 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PIDFILE) }
+{ YDVAR(1, VAR_IP_FREEBIND) }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
 #line 251 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ROOT_HINTS) }
+{ YDVAR(1, VAR_CHROOT) }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
 #line 252 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
+{ YDVAR(1, VAR_USERNAME) }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
 #line 253 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
+{ YDVAR(1, VAR_DIRECTORY) }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
 #line 254 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
+{ YDVAR(1, VAR_LOGFILE) }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
 #line 255 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
+{ YDVAR(1, VAR_PIDFILE) }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
 #line 256 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
+{ YDVAR(1, VAR_ROOT_HINTS) }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
 #line 257 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
+{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
 #line 258 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_TTL) }
+{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
 #line 259 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
 #line 260 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MIN_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
 #line 261 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_HOST_TTL) }
+{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
 #line 262 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_LAME_TTL) }
+{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
 #line 263 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
+{ YDVAR(1, VAR_CACHE_CLOCK_EVICTION) }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
 #line 264 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
+{ YDVAR(1, VAR_CACHE_SNAPSHOT_FILE) }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
 #line 265 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
+{ YDVAR(1, VAR_WIRE_CACHE_SIZE) }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
 #line 266 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
+{ YDVAR(1, VAR_CACHE_MAX_TTL) }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
 #line 267 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
+{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 268 "./util/configlexer.lex"
-{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
+{ YDVAR(1, VAR_CACHE_MIN_TTL) }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 269 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DELAY_CLOSE) }
+{ YDVAR(1, VAR_INFRA_HOST_TTL) }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 270 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
+{ YDVAR(1, VAR_INFRA_LAME_TTL) }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 271 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
+{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
 #line 272 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
+{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 273 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_GLUE) }
+{ YDVAR(1, VAR_INFRA_CACHE_SERVER_SHARED) }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
 #line 274 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
+{ YDVAR(1, VAR_SERVER_SELECTION_PERCENTILE) }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
 #line 275 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
+{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
 #line 276 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
+{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
 #line 277 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
+{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
 #line 278 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
+{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 279 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CAPS_WHITELIST) }
+{ YDVAR(1, VAR_DELAY_CLOSE) }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
 #line 280 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
+{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
 #line 281 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
+{ YDVAR(1, VAR_TARGET_FETCH_FANOUT) }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
 #line 282 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
+{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
 #line 283 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH_KEY) }
+{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
 #line 284 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH) }
+{ YDVAR(1, VAR_HARDEN_GLUE) }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
 #line 285 "./util/configlexer.lex"
-{ YDVAR(0, VAR_STUB_ZONE) }
+{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 286 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NAME) }
+{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 287 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_ADDR) }
+{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 288 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_HOST) }
+{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 289 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_PRIME) }
+{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 290 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_FIRST) }
+{ YDVAR(1, VAR_CAPS_WHITELIST) }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 291 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 292 "./util/configlexer.lex"
-{ YDVAR(0, VAR_FORWARD_ZONE) }
+{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 293 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_ADDR) }
+{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 294 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_HOST) }
+{ YDVAR(1, VAR_PREFETCH_KEY) }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 295 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_FIRST) }
+{ YDVAR(1, VAR_PREFETCH) }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 296 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
+{ YDVAR(0, VAR_STUB_ZONE) }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 297 "./util/configlexer.lex"
-{ YDVAR(0, VAR_AUTH_ZONE) }
+{ YDVAR(1, VAR_NAME) }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 298 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ZONEFILE) }
+{ YDVAR(1, VAR_STUB_ADDR) }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 299 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MASTER) }
+{ YDVAR(1, VAR_STUB_HOST) }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 300 "./util/configlexer.lex"
-{ YDVAR(1, VAR_URL) }
+{ YDVAR(1, VAR_STUB_PRIME) }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 301 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FOR_DOWNSTREAM) }
+{ YDVAR(1, VAR_STUB_FIRST) }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 302 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FOR_UPSTREAM) }
+{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 303 "./util/configlexer.lex"
-{ YDVAR(0, VAR_VIEW) }
+{ YDVAR(0, VAR_FORWARD_ZONE) }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 304 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VIEW_FIRST) }
+{ YDVAR(1, VAR_FORWARD_ADDR) }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 305 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
+{ YDVAR(1, VAR_FORWARD_HOST) }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
 #line 306 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
+{ YDVAR(1, VAR_FORWARD_FIRST) }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
 #line 307 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL) }
+{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 308 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
+{ YDVAR(0, VAR_AUTH_ZONE) }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
 #line 309 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_ZONE) }
+{ YDVAR(1, VAR_ZONEFILE) }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
 #line 310 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_ALWAYS_FORWARD) }
+{ YDVAR(1, VAR_MASTER) }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
 #line 311 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
+{ YDVAR(1, VAR_URL) }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
 #line 312 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
+{ YDVAR(1, VAR_FOR_DOWNSTREAM) }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
 #line 313 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
+{ YDVAR(1, VAR_FOR_UPSTREAM) }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
 #line 314 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_IDENTITY) }
+{ YDVAR(0, VAR_VIEW) }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
 #line 315 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_VERSION) }
+{ YDVAR(1, VAR_VIEW_FIRST) }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
 #line 316 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
 #line 317 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IDENTITY) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
 #line 318 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VERSION) }
+{ YDVAR(2, VAR_ACCESS_CONTROL) }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
 #line 319 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MODULE_CONF) }
+{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
 #line 320 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_ZONE) }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
 #line 321 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_ALWAYS_FORWARD) }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
 #line 322 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
 #line 323 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
 #line 324 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
 #line 325 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR) }
+{ YDVAR(1, VAR_HIDE_IDENTITY) }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
 #line 326 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_SIGNALING) }
+{ YDVAR(1, VAR_HIDE_VERSION) }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
 #line 327 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
+{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
 #line 328 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
+{ YDVAR(1, VAR_IDENTITY) }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
 #line 329 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
+{ YDVAR(1, VAR_VERSION) }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
 #line 330 "./util/configlexer.lex"
-{ YDVAR(1, VAR_BOGUS_TTL) }
+{ YDVAR(1, VAR_MODULE_CONF) }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
 #line 331 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
+{ YDVAR(1, VAR_DLV_ANCHOR) }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
 #line 332 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
+{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
 #line 333 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
 #line 334 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED) }
+{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
 #line 335 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_DSA) }
+{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
 #line 336 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_SHA1) }
+{ YDVAR(1, VAR_TRUST_ANCHOR) }
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
 #line 337 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_SIGNALING) }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 338 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
+{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 339 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 340 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 341 "./util/configlexer.lex"
-{ 
-				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
+{ YDVAR(1, VAR_BOGUS_TTL) }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
-#line 343 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ADD_HOLDDOWN) }
+#line 342 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
-#line 344 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEL_HOLDDOWN) }
+#line 343 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
-#line 345 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEEP_MISSING) }
+#line 344 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
-#line 346 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
+#line 345 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED) }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
-#line 347 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSLOG) }
+#line 346 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAKE_DSA) }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
-#line 348 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_IDENTITY) }
+#line 347 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAKE_SHA1) }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
-#line 349 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TIME_ASCII) }
+#line 348 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
-#line 350 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_QUERIES) }
+#line 349 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
-#line 351 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_REPLIES) }
+#line 350 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
-#line 352 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE) }
+#line 351 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SIG_CACHE_SIZE) }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
-#line 353 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA) }
+#line 352 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CRYPTO_THREADS) }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
-#line 354 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
+#line 353 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NSEC3_CACHE_SIZE) }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
-#line 355 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
+#line 354 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_NSEC3_MAX_ITERATIONS) }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
-#line 356 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
+#line 355 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
-#line 357 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
+#line 356 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NEG_CACHE_SLABS) }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
-#line 358 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
+#line 357 "./util/configlexer.lex"
+{ YDVAR(1, VAR_AGGRESSIVE_NSEC) }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
-#line 359 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
+#line 358 "./util/configlexer.lex"
+{ 
+				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 360 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_ENABLE) }
+{ YDVAR(1, VAR_ADD_HOLDDOWN) }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 361 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_KEY) }
+{ YDVAR(1, VAR_DEL_HOLDDOWN) }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
 #line 362 "./util/configlexer.lex"
-{ YDVAR(0, VAR_REMOTE_CONTROL) }
+{ YDVAR(1, VAR_KEEP_MISSING) }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 363 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_ENABLE) }
+{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 364 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+{ YDVAR(1, VAR_USE_SYSLOG) }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 365 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_PORT) }
+{ YDVAR(1, VAR_LOG_IDENTITY) }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 366 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_USE_CERT) }
+{ YDVAR(1, VAR_LOG_TIME_ASCII) }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 367 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+{ YDVAR(1, VAR_LOG_QUERIES) }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 368 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+{ YDVAR(1, VAR_LOG_REPLIES) }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 369 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+{ YDVAR(2, VAR_LOCAL_ZONE) }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 370 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+{ YDVAR(1, VAR_LOCAL_DATA) }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 371 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 372 "./util/configlexer.lex"
-{ YDVAR(0, VAR_PYTHON) }
+{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 373 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
 #line 374 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 375 "./util/configlexer.lex"
+{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
+	YY_BREAK
+case 166:
+YY_RULE_SETUP
+#line 376 "./util/configlexer.lex"
+{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
+	YY_BREAK
+case 167:
+YY_RULE_SETUP
+#line 377 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SHM_ENABLE) }
+	YY_BREAK
+case 168:
+YY_RULE_SETUP
+#line 378 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SHM_KEY) }
+	YY_BREAK
+case 169:
+YY_RULE_SETUP
+#line 379 "./util/configlexer.lex"
+{ YDVAR(0, VAR_REMOTE_CONTROL) }
+	YY_BREAK
+case 170:
+YY_RULE_SETUP
+#line 380 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_ENABLE) }
+	YY_BREAK
+case 171:
+YY_RULE_SETUP
+#line 381 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+	YY_BREAK
+case 172:
+YY_RULE_SETUP
+#line 382 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_PORT) }
+	YY_BREAK
+case 173:
+YY_RULE_SETUP
+#line 383 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_USE_CERT) }
+	YY_BREAK
+case 174:
+YY_RULE_SETUP
+#line 384 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+	YY_BREAK
+case 175:
+YY_RULE_SETUP
+#line 385 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+	YY_BREAK
+case 176:
+YY_RULE_SETUP
+#line 386 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+	YY_BREAK
+case 177:
+YY_RULE_SETUP
+#line 387 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+	YY_BREAK
+case 178:
+YY_RULE_SETUP
+#line 388 "./util/configlexer.lex"
+{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+	YY_BREAK
+case 179:
+YY_RULE_SETUP
+#line 389 "./util/configlexer.lex"
+{ YDVAR(0, VAR_PYTHON) }
+	YY_BREAK
+case 180:
+YY_RULE_SETUP
+#line 390 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+	YY_BREAK
+case 181:
+YY_RULE_SETUP
+#line 391 "./util/configlexer.lex"
+{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+	YY_BREAK
+case 182:
+YY_RULE_SETUP
+#line 392 "./util/configlexer.lex"
 { YDVAR(1, VAR_RRSET_ROUNDROBIN) }
 	YY_BREAK
-case 166:
+case 183:
+YY_RULE_SETUP
+#line 393 "./util/configlexer.lex"
+{ YDVAR(1, VAR_COMPRESSION_HASH) }
+	YY_BREAK
+case 184:
+YY_RULE_SETUP
+#line 394 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SO_REUSEPORT_CBPF) }
+	YY_BREAK
+case 185:
+YY_RULE_SETUP
+#line 395 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CPU_AFFINITY) }
+	YY_BREAK
+case 186:
+YY_RULE_SETUP
+#line 396 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CPU_AFFINITY_LIST) }
+	YY_BREAK
+case 187:
+YY_RULE_SETUP
+#line 397 "./util/configlexer.lex"
+{ YDVAR(1, VAR_INFLIGHT_DEDUP) }
+	YY_BREAK
+case 188:
+YY_RULE_SETUP
+#line 398 "./util/configlexer.lex"
+{ YDVAR(1, VAR_JOSTLE_ADAPTIVE) }
+	YY_BREAK
+case 189:
+YY_RULE_SETUP
+#line 399 "./util/configlexer.lex"
+{ YDVAR(1, VAR_OUTGOING_BATCH) }
+	YY_BREAK
+case 190:
+YY_RULE_SETUP
+#line 400 "./util/configlexer.lex"
+{ YDVAR(1, VAR_OUTGOING_PORT_POOL) }
+	YY_BREAK
+case 191:
+YY_RULE_SETUP
+#line 401 "./util/configlexer.lex"
+{ YDVAR(1, VAR_OUTGOING_PORT_POOL_USES) }
+	YY_BREAK
+case 192:
 YY_RULE_SETUP
-#line 376 "./util/configlexer.lex"
+#line 402 "./util/configlexer.lex"
 { YDVAR(1, VAR_MAX_UDP_SIZE) }
 	YY_BREAK
-case 167:
+case 193:
 YY_RULE_SETUP
-#line 377 "./util/configlexer.lex"
+#line 403 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNS64_PREFIX) }
 	YY_BREAK
-case 168:
+case 194:
 YY_RULE_SETUP
-#line 378 "./util/configlexer.lex"
+#line 404 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNS64_SYNTHALL) }
 	YY_BREAK
-case 169:
+case 195:
 YY_RULE_SETUP
-#line 379 "./util/configlexer.lex"
+#line 405 "./util/configlexer.lex"
 { YDVAR(1, VAR_DEFINE_TAG) }
 	YY_BREAK
-case 170:
+case 196:
 YY_RULE_SETUP
-#line 380 "./util/configlexer.lex"
+#line 406 "./util/configlexer.lex"
 { YDVAR(2, VAR_LOCAL_ZONE_TAG) }
 	YY_BREAK
-case 171:
+case 197:
 YY_RULE_SETUP
-#line 381 "./util/configlexer.lex"
+#line 407 "./util/configlexer.lex"
 { YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
 	YY_BREAK
-case 172:
+case 198:
 YY_RULE_SETUP
-#line 382 "./util/configlexer.lex"
+#line 408 "./util/configlexer.lex"
 { YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
 	YY_BREAK
-case 173:
+case 199:
 YY_RULE_SETUP
-#line 383 "./util/configlexer.lex"
+#line 409 "./util/configlexer.lex"
 { YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
 	YY_BREAK
-case 174:
+case 200:
 YY_RULE_SETUP
-#line 384 "./util/configlexer.lex"
+#line 410 "./util/configlexer.lex"
 { YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
 	YY_BREAK
-case 175:
+case 201:
 YY_RULE_SETUP
-#line 385 "./util/configlexer.lex"
+#line 411 "./util/configlexer.lex"
 { YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
 	YY_BREAK
-case 176:
+case 202:
 YY_RULE_SETUP
-#line 386 "./util/configlexer.lex"
+#line 412 "./util/configlexer.lex"
 { YDVAR(0, VAR_DNSTAP) }
 	YY_BREAK
-case 177:
+case 203:
 YY_RULE_SETUP
-#line 387 "./util/configlexer.lex"
+#line 413 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSTAP_ENABLE) }
 	YY_BREAK
-case 178:
+case 204:
 YY_RULE_SETUP
-#line 388 "./util/configlexer.lex"
+#line 414 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
 	YY_BREAK
-case 179:
+case 205:
 YY_RULE_SETUP
-#line 389 "./util/configlexer.lex"
+#line 415 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
 	YY_BREAK
-case 180:
+case 206:
 YY_RULE_SETUP
-#line 390 "./util/configlexer.lex"
+#line 416 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
 	YY_BREAK
-case 181:
+case 207:
 YY_RULE_SETUP
-#line 391 "./util/configlexer.lex"
+#line 417 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSTAP_IDENTITY) }
 	YY_BREAK
-case 182:
+case 208:
 YY_RULE_SETUP
-#line 392 "./util/configlexer.lex"
+#line 418 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSTAP_VERSION) }
 	YY_BREAK
-case 183:
+case 209:
 YY_RULE_SETUP
-#line 393 "./util/configlexer.lex"
+#line 419 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
 	YY_BREAK
-case 184:
+case 210:
 YY_RULE_SETUP
-#line 395 "./util/configlexer.lex"
+#line 421 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 185:
+case 211:
 YY_RULE_SETUP
-#line 397 "./util/configlexer.lex"
+#line 423 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES) }
 	YY_BREAK
-case 186:
+case 212:
 YY_RULE_SETUP
-#line 399 "./util/configlexer.lex"
+#line 425 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 187:
+case 213:
 YY_RULE_SETUP
-#line 401 "./util/configlexer.lex"
+#line 427 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES) }
 	YY_BREAK
-case 188:
+case 214:
 YY_RULE_SETUP
-#line 403 "./util/configlexer.lex"
+#line 429 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 189:
+case 215:
 YY_RULE_SETUP
-#line 405 "./util/configlexer.lex"
+#line 431 "./util/configlexer.lex"
 { YDVAR(1, VAR_DISABLE_DNSSEC_LAME_CHECK) }
 	YY_BREAK
-case 190:
+case 216:
 YY_RULE_SETUP
-#line 406 "./util/configlexer.lex"
+#line 432 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT) }
 	YY_BREAK
-case 191:
+case 217:
 YY_RULE_SETUP
-#line 407 "./util/configlexer.lex"
+#line 433 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT) }
 	YY_BREAK
-case 192:
+case 218:
 YY_RULE_SETUP
-#line 408 "./util/configlexer.lex"
+#line 434 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_SLABS) }
 	YY_BREAK
-case 193:
+case 219:
 YY_RULE_SETUP
-#line 409 "./util/configlexer.lex"
+#line 435 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SLABS) }
 	YY_BREAK
-case 194:
+case 220:
 YY_RULE_SETUP
-#line 410 "./util/configlexer.lex"
+#line 436 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_SIZE) }
 	YY_BREAK
-case 195:
+case 221:
 YY_RULE_SETUP
-#line 411 "./util/configlexer.lex"
+#line 437 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SIZE) }
 	YY_BREAK
-case 196:
+case 222:
 YY_RULE_SETUP
-#line 412 "./util/configlexer.lex"
+#line 438 "./util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_FOR_DOMAIN) }
 	YY_BREAK
-case 197:
+case 223:
 YY_RULE_SETUP
-#line 413 "./util/configlexer.lex"
+#line 439 "./util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_BELOW_DOMAIN) }
 	YY_BREAK
-case 198:
+case 224:
 YY_RULE_SETUP
-#line 414 "./util/configlexer.lex"
+#line 440 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_FACTOR) }
 	YY_BREAK
-case 199:
+case 225:
 YY_RULE_SETUP
-#line 415 "./util/configlexer.lex"
+#line 441 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_FACTOR) }
 	YY_BREAK
-case 200:
+case 226:
 YY_RULE_SETUP
-#line 416 "./util/configlexer.lex"
+#line 442 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IP_RATELIMIT_BURST) }
+	YY_BREAK
+case 227:
+YY_RULE_SETUP
+#line 443 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RATELIMIT_BURST) }
+	YY_BREAK
+case 228:
+YY_RULE_SETUP
+#line 444 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IP_RATELIMIT_IPV4_PREFIX) }
+	YY_BREAK
+case 229:
+YY_RULE_SETUP
+#line 445 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IP_RATELIMIT_IPV6_PREFIX) }
+	YY_BREAK
+case 230:
+YY_RULE_SETUP
+#line 446 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IP_RATELIMIT_EXEMPT) }
+	YY_BREAK
+case 231:
+YY_RULE_SETUP
+#line 447 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP_TAG) }
 	YY_BREAK
-case 201:
+case 232:
 YY_RULE_SETUP
-#line 417 "./util/configlexer.lex"
+#line 448 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP) }
 	YY_BREAK
-case 202:
+case 233:
 YY_RULE_SETUP
-#line 418 "./util/configlexer.lex"
+#line 449 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP_DATA) }
 	YY_BREAK
-case 203:
+case 234:
 YY_RULE_SETUP
-#line 419 "./util/configlexer.lex"
+#line 450 "./util/configlexer.lex"
 { YDVAR(0, VAR_DNSCRYPT) }
 	YY_BREAK
-case 204:
+case 235:
 YY_RULE_SETUP
-#line 420 "./util/configlexer.lex"
+#line 451 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_ENABLE) }
 	YY_BREAK
-case 205:
+case 236:
 YY_RULE_SETUP
-#line 421 "./util/configlexer.lex"
+#line 452 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PORT) }
 	YY_BREAK
-case 206:
+case 237:
 YY_RULE_SETUP
-#line 422 "./util/configlexer.lex"
+#line 453 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PROVIDER) }
 	YY_BREAK
-case 207:
+case 238:
 YY_RULE_SETUP
-#line 423 "./util/configlexer.lex"
+#line 454 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_SECRET_KEY) }
 	YY_BREAK
-case 208:
+case 239:
 YY_RULE_SETUP
-#line 424 "./util/configlexer.lex"
+#line 455 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT) }
 	YY_BREAK
-case 209:
+case 240:
 YY_RULE_SETUP
-#line 425 "./util/configlexer.lex"
+#line 456 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT_ROTATED) }
 	YY_BREAK
-case 210:
+case 241:
 YY_RULE_SETUP
-#line 426 "./util/configlexer.lex"
+#line 457 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE) }
 	YY_BREAK
-case 211:
+case 242:
 YY_RULE_SETUP
-#line 428 "./util/configlexer.lex"
+#line 459 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS) }
 	YY_BREAK
-case 212:
+case 243:
 YY_RULE_SETUP
-#line 430 "./util/configlexer.lex"
+#line 461 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SIZE) }
 	YY_BREAK
-case 213:
+case 244:
 YY_RULE_SETUP
-#line 431 "./util/configlexer.lex"
+#line 462 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SLABS) }
 	YY_BREAK
-case 214:
+case 245:
 YY_RULE_SETUP
-#line 432 "./util/configlexer.lex"
+#line 463 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_ENABLED) }
 	YY_BREAK
-case 215:
+case 246:
 YY_RULE_SETUP
-#line 433 "./util/configlexer.lex"
+#line 464 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_IGNORE_BOGUS) }
 	YY_BREAK
-case 216:
+case 247:
 YY_RULE_SETUP
-#line 434 "./util/configlexer.lex"
+#line 465 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_HOOK) }
 	YY_BREAK
-case 217:
+case 248:
 YY_RULE_SETUP
-#line 435 "./util/configlexer.lex"
+#line 466 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_MAX_TTL) }
 	YY_BREAK
-case 218:
+case 249:
 YY_RULE_SETUP
-#line 436 "./util/configlexer.lex"
+#line 467 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_WHITELIST) }
 	YY_BREAK
-case 219:
+case 250:
 YY_RULE_SETUP
-#line 437 "./util/configlexer.lex"
+#line 468 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_STRICT) }
 	YY_BREAK
-case 220:
+case 251:
 YY_RULE_SETUP
-#line 438 "./util/configlexer.lex"
+#line 469 "./util/configlexer.lex"
 { YDVAR(0, VAR_CACHEDB) }
 	YY_BREAK
-case 221:
+case 252:
 YY_RULE_SETUP
-#line 439 "./util/configlexer.lex"
+#line 470 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_BACKEND) }
 	YY_BREAK
-case 222:
+case 253:
 YY_RULE_SETUP
-#line 440 "./util/configlexer.lex"
+#line 471 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_SECRETSEED) }
 	YY_BREAK
-case 223:
+case 254:
 YY_RULE_SETUP
-#line 441 "./util/configlexer.lex"
+#line 472 "./util/configlexer.lex"
 { YDVAR(1, VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM) }
 	YY_BREAK
-case 224:
-/* rule 224 can match eol */
+case 255:
+/* rule 255 can match eol */
 YY_RULE_SETUP
-#line 442 "./util/configlexer.lex"
+#line 473 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++; }
 	YY_BREAK
 /* Quoted strings. Strip leading and ending quotes */
-case 225:
+case 256:
 YY_RULE_SETUP
-#line 445 "./util/configlexer.lex"
+#line 476 "./util/configlexer.lex"
 { BEGIN(quotedstring); LEXOUT(("QS ")); }
 	YY_BREAK
 case YY_STATE_EOF(quotedstring):
-#line 446 "./util/configlexer.lex"
+#line 477 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 226:
+case 257:
 YY_RULE_SETUP
-#line 451 "./util/configlexer.lex"
+#line 482 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 227:
-/* rule 227 can match eol */
+case 258:
+/* rule 258 can match eol */
 YY_RULE_SETUP
-#line 452 "./util/configlexer.lex"
+#line 483 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end \""); 
 			  cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 228:
+case 259:
 YY_RULE_SETUP
-#line 454 "./util/configlexer.lex"
+#line 485 "./util/configlexer.lex"
 {
         LEXOUT(("QE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -3935,34 +4022,34 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* Single Quoted strings. Strip leading and ending quotes */
-case 229:
+case 260:
 YY_RULE_SETUP
-#line 466 "./util/configlexer.lex"
+#line 497 "./util/configlexer.lex"
 { BEGIN(singlequotedstr); LEXOUT(("SQS ")); }
 	YY_BREAK
 case YY_STATE_EOF(singlequotedstr):
-#line 467 "./util/configlexer.lex"
+#line 498 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 230:
+case 261:
 YY_RULE_SETUP
-#line 472 "./util/configlexer.lex"
+#line 503 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 231:
-/* rule 231 can match eol */
+case 262:
+/* rule 262 can match eol */
 YY_RULE_SETUP
-#line 473 "./util/configlexer.lex"
+#line 504 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end '"); 
 			     cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 232:
+case 263:
 YY_RULE_SETUP
-#line 475 "./util/configlexer.lex"
+#line 506 "./util/configlexer.lex"
 {
         LEXOUT(("SQE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -3975,38 +4062,38 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* include: directive */
-case 233:
+case 264:
 YY_RULE_SETUP
-#line 487 "./util/configlexer.lex"
+#line 518 "./util/configlexer.lex"
 { 
 	LEXOUT(("v(%s) ", yytext)); inc_prev = YYSTATE; BEGIN(include); }
 	YY_BREAK
 case YY_STATE_EOF(include):
-#line 489 "./util/configlexer.lex"
+#line 520 "./util/configlexer.lex"
 {
         yyerror("EOF inside include directive");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 234:
+case 265:
 YY_RULE_SETUP
-#line 493 "./util/configlexer.lex"
+#line 524 "./util/configlexer.lex"
 { LEXOUT(("ISP ")); /* ignore */ }
 	YY_BREAK
-case 235:
-/* rule 235 can match eol */
+case 266:
+/* rule 266 can match eol */
 YY_RULE_SETUP
-#line 494 "./util/configlexer.lex"
+#line 525 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++;}
 	YY_BREAK
-case 236:
+case 267:
 YY_RULE_SETUP
-#line 495 "./util/configlexer.lex"
+#line 526 "./util/configlexer.lex"
 { LEXOUT(("IQS ")); BEGIN(include_quoted); }
 	YY_BREAK
-case 237:
+case 268:
 YY_RULE_SETUP
-#line 496 "./util/configlexer.lex"
+#line 527 "./util/configlexer.lex"
 {
 	LEXOUT(("Iunquotedstr(%s) ", yytext));
 	config_start_include_glob(yytext);
@@ -4014,27 +4101,27 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case YY_STATE_EOF(include_quoted):
-#line 501 "./util/configlexer.lex"
+#line 532 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 238:
+case 269:
 YY_RULE_SETUP
-#line 505 "./util/configlexer.lex"
+#line 536 "./util/configlexer.lex"
 { LEXOUT(("ISTR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 239:
-/* rule 239 can match eol */
+case 270:
+/* rule 270 can match eol */
 YY_RULE_SETUP
-#line 506 "./util/configlexer.lex"
+#line 537 "./util/configlexer.lex"
 { yyerror("newline before \" in include name"); 
 				  cfg_parser->line++; BEGIN(inc_prev); }
 	YY_BREAK
-case 240:
+case 271:
 YY_RULE_SETUP
-#line 508 "./util/configlexer.lex"
+#line 539 "./util/configlexer.lex"
 {
 	LEXOUT(("IQE "));
 	yytext[yyleng - 1] = '\0';
@@ -4044,7 +4131,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(val):
-#line 514 "./util/configlexer.lex"
+#line 545 "./util/configlexer.lex"
 {
 	LEXOUT(("LEXEOF "));
 	yy_set_bol(1); /* Set beginning of line, so "^" rules match.  */
@@ -4056,33 +4143,33 @@ case YY_STATE_EOF(val):
 	}
 }
 	YY_BREAK
-case 241:
+case 272:
 YY_RULE_SETUP
-#line 525 "./util/configlexer.lex"
+#line 556 "./util/configlexer.lex"
 { LEXOUT(("unquotedstr(%s) ", yytext)); 
 			if(--num_args == 0) { BEGIN(INITIAL); }
 			yylval.str = strdup(yytext); return STRING_ARG; }
 	YY_BREAK
-case 242:
+case 273:
 YY_RULE_SETUP
-#line 529 "./util/configlexer.lex"
+#line 560 "./util/configlexer.lex"
 {
 	ub_c_error_msg("unknown keyword '%s'", yytext);
 	}
 	YY_BREAK
-case 243:
+case 274:
 YY_RULE_SETUP
-#line 533 "./util/configlexer.lex"
+#line 564 "./util/configlexer.lex"
 {
 	ub_c_error_msg("stray '%s'", yytext);
 	}
 	YY_BREAK
-case 244:
+case 275:
 YY_RULE_SETUP
-#line 537 "./util/configlexer.lex"
+#line 568 "./util/configlexer.lex"
 ECHO;
 	YY_BREAK
-#line 4084 "<stdout>"
+#line 4171 "<stdout>"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4373,7 +4460,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 2395 )
+			if ( yy_current_state >= 2746 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
@@ -4401,11 +4488,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 2395 )
+		if ( yy_current_state >= 2746 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
-	yy_is_jam = (yy_current_state == 2394);
+	yy_is_jam = (yy_current_state == 2745);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5044,7 +5131,4 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 537 "./util/configlexer.lex"
-
-
-
+#line 568 "./util/configlexer.lex"
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,8 @@
 
 
 
-/* Copy the first part of user declarations.  */
-#line 38 "./util/configparser.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 38 "./util/configparser.y"
 
 #include "config.h"
 
@@ -91,555 +96,669 @@ extern struct config_parser_state* cfg_parser;
 #endif
 
 
-#line 95 "util/configparser.c" /* yacc.c:339  */
+#line 100 "util/configparser.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "configparser.h".  */
-#ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-# define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    SPACE = 258,
-    LETTER = 259,
-    NEWLINE = 260,
-    COMMENT = 261,
-    COLON = 262,
-    ANY = 263,
-    ZONESTR = 264,
-    STRING_ARG = 265,
-    VAR_SERVER = 266,
-    VAR_VERBOSITY = 267,
-    VAR_NUM_THREADS = 268,
-    VAR_PORT = 269,
-    VAR_OUTGOING_RANGE = 270,
-    VAR_INTERFACE = 271,
-    VAR_DO_IP4 = 272,
-    VAR_DO_IP6 = 273,
-    VAR_PREFER_IP6 = 274,
-    VAR_DO_UDP = 275,
-    VAR_DO_TCP = 276,
-    VAR_TCP_MSS = 277,
-    VAR_OUTGOING_TCP_MSS = 278,
-    VAR_CHROOT = 279,
-    VAR_USERNAME = 280,
-    VAR_DIRECTORY = 281,
-    VAR_LOGFILE = 282,
-    VAR_PIDFILE = 283,
-    VAR_MSG_CACHE_SIZE = 284,
-    VAR_MSG_CACHE_SLABS = 285,
-    VAR_NUM_QUERIES_PER_THREAD = 286,
-    VAR_RRSET_CACHE_SIZE = 287,
-    VAR_RRSET_CACHE_SLABS = 288,
-    VAR_OUTGOING_NUM_TCP = 289,
-    VAR_INFRA_HOST_TTL = 290,
-    VAR_INFRA_LAME_TTL = 291,
-    VAR_INFRA_CACHE_SLABS = 292,
-    VAR_INFRA_CACHE_NUMHOSTS = 293,
-    VAR_INFRA_CACHE_LAME_SIZE = 294,
-    VAR_NAME = 295,
-    VAR_STUB_ZONE = 296,
-    VAR_STUB_HOST = 297,
-    VAR_STUB_ADDR = 298,
-    VAR_TARGET_FETCH_POLICY = 299,
-    VAR_HARDEN_SHORT_BUFSIZE = 300,
-    VAR_HARDEN_LARGE_QUERIES = 301,
-    VAR_FORWARD_ZONE = 302,
-    VAR_FORWARD_HOST = 303,
-    VAR_FORWARD_ADDR = 304,
-    VAR_DO_NOT_QUERY_ADDRESS = 305,
-    VAR_HIDE_IDENTITY = 306,
-    VAR_HIDE_VERSION = 307,
-    VAR_IDENTITY = 308,
-    VAR_VERSION = 309,
-    VAR_HARDEN_GLUE = 310,
-    VAR_MODULE_CONF = 311,
-    VAR_TRUST_ANCHOR_FILE = 312,
-    VAR_TRUST_ANCHOR = 313,
-    VAR_VAL_OVERRIDE_DATE = 314,
-    VAR_BOGUS_TTL = 315,
-    VAR_VAL_CLEAN_ADDITIONAL = 316,
-    VAR_VAL_PERMISSIVE_MODE = 317,
-    VAR_INCOMING_NUM_TCP = 318,
-    VAR_MSG_BUFFER_SIZE = 319,
-    VAR_KEY_CACHE_SIZE = 320,
-    VAR_KEY_CACHE_SLABS = 321,
-    VAR_TRUSTED_KEYS_FILE = 322,
-    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 323,
-    VAR_USE_SYSLOG = 324,
-    VAR_OUTGOING_INTERFACE = 325,
-    VAR_ROOT_HINTS = 326,
-    VAR_DO_NOT_QUERY_LOCALHOST = 327,
-    VAR_CACHE_MAX_TTL = 328,
-    VAR_HARDEN_DNSSEC_STRIPPED = 329,
-    VAR_ACCESS_CONTROL = 330,
-    VAR_LOCAL_ZONE = 331,
-    VAR_LOCAL_DATA = 332,
-    VAR_INTERFACE_AUTOMATIC = 333,
-    VAR_STATISTICS_INTERVAL = 334,
-    VAR_DO_DAEMONIZE = 335,
-    VAR_USE_CAPS_FOR_ID = 336,
-    VAR_STATISTICS_CUMULATIVE = 337,
-    VAR_OUTGOING_PORT_PERMIT = 338,
-    VAR_OUTGOING_PORT_AVOID = 339,
-    VAR_DLV_ANCHOR_FILE = 340,
-    VAR_DLV_ANCHOR = 341,
-    VAR_NEG_CACHE_SIZE = 342,
-    VAR_HARDEN_REFERRAL_PATH = 343,
-    VAR_PRIVATE_ADDRESS = 344,
-    VAR_PRIVATE_DOMAIN = 345,
-    VAR_REMOTE_CONTROL = 346,
-    VAR_CONTROL_ENABLE = 347,
-    VAR_CONTROL_INTERFACE = 348,
-    VAR_CONTROL_PORT = 349,
-    VAR_SERVER_KEY_FILE = 350,
-    VAR_SERVER_CERT_FILE = 351,
-    VAR_CONTROL_KEY_FILE = 352,
-    VAR_CONTROL_CERT_FILE = 353,
-    VAR_CONTROL_USE_CERT = 354,
-    VAR_EXTENDED_STATISTICS = 355,
-    VAR_LOCAL_DATA_PTR = 356,
-    VAR_JOSTLE_TIMEOUT = 357,
-    VAR_STUB_PRIME = 358,
-    VAR_UNWANTED_REPLY_THRESHOLD = 359,
-    VAR_LOG_TIME_ASCII = 360,
-    VAR_DOMAIN_INSECURE = 361,
-    VAR_PYTHON = 362,
-    VAR_PYTHON_SCRIPT = 363,
-    VAR_VAL_SIG_SKEW_MIN = 364,
-    VAR_VAL_SIG_SKEW_MAX = 365,
-    VAR_CACHE_MIN_TTL = 366,
-    VAR_VAL_LOG_LEVEL = 367,
-    VAR_AUTO_TRUST_ANCHOR_FILE = 368,
-    VAR_KEEP_MISSING = 369,
-    VAR_ADD_HOLDDOWN = 370,
-    VAR_DEL_HOLDDOWN = 371,
-    VAR_SO_RCVBUF = 372,
-    VAR_EDNS_BUFFER_SIZE = 373,
-    VAR_PREFETCH = 374,
-    VAR_PREFETCH_KEY = 375,
-    VAR_SO_SNDBUF = 376,
-    VAR_SO_REUSEPORT = 377,
-    VAR_HARDEN_BELOW_NXDOMAIN = 378,
-    VAR_IGNORE_CD_FLAG = 379,
-    VAR_LOG_QUERIES = 380,
-    VAR_LOG_REPLIES = 381,
-    VAR_TCP_UPSTREAM = 382,
-    VAR_SSL_UPSTREAM = 383,
-    VAR_SSL_SERVICE_KEY = 384,
-    VAR_SSL_SERVICE_PEM = 385,
-    VAR_SSL_PORT = 386,
-    VAR_FORWARD_FIRST = 387,
-    VAR_STUB_SSL_UPSTREAM = 388,
-    VAR_FORWARD_SSL_UPSTREAM = 389,
-    VAR_STUB_FIRST = 390,
-    VAR_MINIMAL_RESPONSES = 391,
-    VAR_RRSET_ROUNDROBIN = 392,
-    VAR_MAX_UDP_SIZE = 393,
-    VAR_DELAY_CLOSE = 394,
-    VAR_UNBLOCK_LAN_ZONES = 395,
-    VAR_INSECURE_LAN_ZONES = 396,
-    VAR_INFRA_CACHE_MIN_RTT = 397,
-    VAR_DNS64_PREFIX = 398,
-    VAR_DNS64_SYNTHALL = 399,
-    VAR_DNSTAP = 400,
-    VAR_DNSTAP_ENABLE = 401,
-    VAR_DNSTAP_SOCKET_PATH = 402,
-    VAR_DNSTAP_SEND_IDENTITY = 403,
-    VAR_DNSTAP_SEND_VERSION = 404,
-    VAR_DNSTAP_IDENTITY = 405,
-    VAR_DNSTAP_VERSION = 406,
-    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 407,
-    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 408,
-    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 409,
-    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 410,
-    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 411,
-    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 412,
-    VAR_RESPONSE_IP_TAG = 413,
-    VAR_RESPONSE_IP = 414,
-    VAR_RESPONSE_IP_DATA = 415,
-    VAR_HARDEN_ALGO_DOWNGRADE = 416,
-    VAR_IP_TRANSPARENT = 417,
-    VAR_DISABLE_DNSSEC_LAME_CHECK = 418,
-    VAR_IP_RATELIMIT = 419,
-    VAR_IP_RATELIMIT_SLABS = 420,
-    VAR_IP_RATELIMIT_SIZE = 421,
-    VAR_RATELIMIT = 422,
-    VAR_RATELIMIT_SLABS = 423,
-    VAR_RATELIMIT_SIZE = 424,
-    VAR_RATELIMIT_FOR_DOMAIN = 425,
-    VAR_RATELIMIT_BELOW_DOMAIN = 426,
-    VAR_IP_RATELIMIT_FACTOR = 427,
-    VAR_RATELIMIT_FACTOR = 428,
-    VAR_SEND_CLIENT_SUBNET = 429,
-    VAR_CLIENT_SUBNET_ZONE = 430,
-    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 431,
-    VAR_CLIENT_SUBNET_OPCODE = 432,
-    VAR_MAX_CLIENT_SUBNET_IPV4 = 433,
-    VAR_MAX_CLIENT_SUBNET_IPV6 = 434,
-    VAR_CAPS_WHITELIST = 435,
-    VAR_CACHE_MAX_NEGATIVE_TTL = 436,
-    VAR_PERMIT_SMALL_HOLDDOWN = 437,
-    VAR_QNAME_MINIMISATION = 438,
-    VAR_QNAME_MINIMISATION_STRICT = 439,
-    VAR_IP_FREEBIND = 440,
-    VAR_DEFINE_TAG = 441,
-    VAR_LOCAL_ZONE_TAG = 442,
-    VAR_ACCESS_CONTROL_TAG = 443,
-    VAR_LOCAL_ZONE_OVERRIDE = 444,
-    VAR_ACCESS_CONTROL_TAG_ACTION = 445,
-    VAR_ACCESS_CONTROL_TAG_DATA = 446,
-    VAR_VIEW = 447,
-    VAR_ACCESS_CONTROL_VIEW = 448,
-    VAR_VIEW_FIRST = 449,
-    VAR_SERVE_EXPIRED = 450,
-    VAR_FAKE_DSA = 451,
-    VAR_FAKE_SHA1 = 452,
-    VAR_LOG_IDENTITY = 453,
-    VAR_HIDE_TRUSTANCHOR = 454,
-    VAR_TRUST_ANCHOR_SIGNALING = 455,
-    VAR_USE_SYSTEMD = 456,
-    VAR_SHM_ENABLE = 457,
-    VAR_SHM_KEY = 458,
-    VAR_DNSCRYPT = 459,
-    VAR_DNSCRYPT_ENABLE = 460,
-    VAR_DNSCRYPT_PORT = 461,
-    VAR_DNSCRYPT_PROVIDER = 462,
-    VAR_DNSCRYPT_SECRET_KEY = 463,
-    VAR_DNSCRYPT_PROVIDER_CERT = 464,
-    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 465,
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 466,
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 467,
-    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 468,
-    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 469,
-    VAR_IPSECMOD_ENABLED = 470,
-    VAR_IPSECMOD_HOOK = 471,
-    VAR_IPSECMOD_IGNORE_BOGUS = 472,
-    VAR_IPSECMOD_MAX_TTL = 473,
-    VAR_IPSECMOD_WHITELIST = 474,
-    VAR_IPSECMOD_STRICT = 475,
-    VAR_CACHEDB = 476,
-    VAR_CACHEDB_BACKEND = 477,
-    VAR_CACHEDB_SECRETSEED = 478,
-    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 479,
-    VAR_FOR_UPSTREAM = 480,
-    VAR_AUTH_ZONE = 481,
-    VAR_ZONEFILE = 482,
-    VAR_MASTER = 483,
-    VAR_URL = 484,
-    VAR_FOR_DOWNSTREAM = 485
-  };
-#endif
-/* Tokens.  */
-#define SPACE 258
-#define LETTER 259
-#define NEWLINE 260
-#define COMMENT 261
-#define COLON 262
-#define ANY 263
-#define ZONESTR 264
-#define STRING_ARG 265
-#define VAR_SERVER 266
-#define VAR_VERBOSITY 267
-#define VAR_NUM_THREADS 268
-#define VAR_PORT 269
-#define VAR_OUTGOING_RANGE 270
-#define VAR_INTERFACE 271
-#define VAR_DO_IP4 272
-#define VAR_DO_IP6 273
-#define VAR_PREFER_IP6 274
-#define VAR_DO_UDP 275
-#define VAR_DO_TCP 276
-#define VAR_TCP_MSS 277
-#define VAR_OUTGOING_TCP_MSS 278
-#define VAR_CHROOT 279
-#define VAR_USERNAME 280
-#define VAR_DIRECTORY 281
-#define VAR_LOGFILE 282
-#define VAR_PIDFILE 283
-#define VAR_MSG_CACHE_SIZE 284
-#define VAR_MSG_CACHE_SLABS 285
-#define VAR_NUM_QUERIES_PER_THREAD 286
-#define VAR_RRSET_CACHE_SIZE 287
-#define VAR_RRSET_CACHE_SLABS 288
-#define VAR_OUTGOING_NUM_TCP 289
-#define VAR_INFRA_HOST_TTL 290
-#define VAR_INFRA_LAME_TTL 291
-#define VAR_INFRA_CACHE_SLABS 292
-#define VAR_INFRA_CACHE_NUMHOSTS 293
-#define VAR_INFRA_CACHE_LAME_SIZE 294
-#define VAR_NAME 295
-#define VAR_STUB_ZONE 296
-#define VAR_STUB_HOST 297
-#define VAR_STUB_ADDR 298
-#define VAR_TARGET_FETCH_POLICY 299
-#define VAR_HARDEN_SHORT_BUFSIZE 300
-#define VAR_HARDEN_LARGE_QUERIES 301
-#define VAR_FORWARD_ZONE 302
-#define VAR_FORWARD_HOST 303
-#define VAR_FORWARD_ADDR 304
-#define VAR_DO_NOT_QUERY_ADDRESS 305
-#define VAR_HIDE_IDENTITY 306
-#define VAR_HIDE_VERSION 307
-#define VAR_IDENTITY 308
-#define VAR_VERSION 309
-#define VAR_HARDEN_GLUE 310
-#define VAR_MODULE_CONF 311
-#define VAR_TRUST_ANCHOR_FILE 312
-#define VAR_TRUST_ANCHOR 313
-#define VAR_VAL_OVERRIDE_DATE 314
-#define VAR_BOGUS_TTL 315
-#define VAR_VAL_CLEAN_ADDITIONAL 316
-#define VAR_VAL_PERMISSIVE_MODE 317
-#define VAR_INCOMING_NUM_TCP 318
-#define VAR_MSG_BUFFER_SIZE 319
-#define VAR_KEY_CACHE_SIZE 320
-#define VAR_KEY_CACHE_SLABS 321
-#define VAR_TRUSTED_KEYS_FILE 322
-#define VAR_VAL_NSEC3_KEYSIZE_ITERATIONS 323
-#define VAR_USE_SYSLOG 324
-#define VAR_OUTGOING_INTERFACE 325
-#define VAR_ROOT_HINTS 326
-#define VAR_DO_NOT_QUERY_LOCALHOST 327
-#define VAR_CACHE_MAX_TTL 328
-#define VAR_HARDEN_DNSSEC_STRIPPED 329
-#define VAR_ACCESS_CONTROL 330
-#define VAR_LOCAL_ZONE 331
-#define VAR_LOCAL_DATA 332
-#define VAR_INTERFACE_AUTOMATIC 333
-#define VAR_STATISTICS_INTERVAL 334
-#define VAR_DO_DAEMONIZE 335
-#define VAR_USE_CAPS_FOR_ID 336
-#define VAR_STATISTICS_CUMULATIVE 337
-#define VAR_OUTGOING_PORT_PERMIT 338
-#define VAR_OUTGOING_PORT_AVOID 339
-#define VAR_DLV_ANCHOR_FILE 340
-#define VAR_DLV_ANCHOR 341
-#define VAR_NEG_CACHE_SIZE 342
-#define VAR_HARDEN_REFERRAL_PATH 343
-#define VAR_PRIVATE_ADDRESS 344
-#define VAR_PRIVATE_DOMAIN 345
-#define VAR_REMOTE_CONTROL 346
-#define VAR_CONTROL_ENABLE 347
-#define VAR_CONTROL_INTERFACE 348
-#define VAR_CONTROL_PORT 349
-#define VAR_SERVER_KEY_FILE 350
-#define VAR_SERVER_CERT_FILE 351
-#define VAR_CONTROL_KEY_FILE 352
-#define VAR_CONTROL_CERT_FILE 353
-#define VAR_CONTROL_USE_CERT 354
-#define VAR_EXTENDED_STATISTICS 355
-#define VAR_LOCAL_DATA_PTR 356
-#define VAR_JOSTLE_TIMEOUT 357
-#define VAR_STUB_PRIME 358
-#define VAR_UNWANTED_REPLY_THRESHOLD 359
-#define VAR_LOG_TIME_ASCII 360
-#define VAR_DOMAIN_INSECURE 361
-#define VAR_PYTHON 362
-#define VAR_PYTHON_SCRIPT 363
-#define VAR_VAL_SIG_SKEW_MIN 364
-#define VAR_VAL_SIG_SKEW_MAX 365
-#define VAR_CACHE_MIN_TTL 366
-#define VAR_VAL_LOG_LEVEL 367
-#define VAR_AUTO_TRUST_ANCHOR_FILE 368
-#define VAR_KEEP_MISSING 369
-#define VAR_ADD_HOLDDOWN 370
-#define VAR_DEL_HOLDDOWN 371
-#define VAR_SO_RCVBUF 372
-#define VAR_EDNS_BUFFER_SIZE 373
-#define VAR_PREFETCH 374
-#define VAR_PREFETCH_KEY 375
-#define VAR_SO_SNDBUF 376
-#define VAR_SO_REUSEPORT 377
-#define VAR_HARDEN_BELOW_NXDOMAIN 378
-#define VAR_IGNORE_CD_FLAG 379
-#define VAR_LOG_QUERIES 380
-#define VAR_LOG_REPLIES 381
-#define VAR_TCP_UPSTREAM 382
-#define VAR_SSL_UPSTREAM 383
-#define VAR_SSL_SERVICE_KEY 384
-#define VAR_SSL_SERVICE_PEM 385
-#define VAR_SSL_PORT 386
-#define VAR_FORWARD_FIRST 387
-#define VAR_STUB_SSL_UPSTREAM 388
-#define VAR_FORWARD_SSL_UPSTREAM 389
-#define VAR_STUB_FIRST 390
-#define VAR_MINIMAL_RESPONSES 391
-#define VAR_RRSET_ROUNDROBIN 392
-#define VAR_MAX_UDP_SIZE 393
-#define VAR_DELAY_CLOSE 394
-#define VAR_UNBLOCK_LAN_ZONES 395
-#define VAR_INSECURE_LAN_ZONES 396
-#define VAR_INFRA_CACHE_MIN_RTT 397
-#define VAR_DNS64_PREFIX 398
-#define VAR_DNS64_SYNTHALL 399
-#define VAR_DNSTAP 400
-#define VAR_DNSTAP_ENABLE 401
-#define VAR_DNSTAP_SOCKET_PATH 402
-#define VAR_DNSTAP_SEND_IDENTITY 403
-#define VAR_DNSTAP_SEND_VERSION 404
-#define VAR_DNSTAP_IDENTITY 405
-#define VAR_DNSTAP_VERSION 406
-#define VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES 407
-#define VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES 408
-#define VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES 409
-#define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 410
-#define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 411
-#define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 412
-#define VAR_RESPONSE_IP_TAG 413
-#define VAR_RESPONSE_IP 414
-#define VAR_RESPONSE_IP_DATA 415
-#define VAR_HARDEN_ALGO_DOWNGRADE 416
-#define VAR_IP_TRANSPARENT 417
-#define VAR_DISABLE_DNSSEC_LAME_CHECK 418
-#define VAR_IP_RATELIMIT 419
-#define VAR_IP_RATELIMIT_SLABS 420
-#define VAR_IP_RATELIMIT_SIZE 421
-#define VAR_RATELIMIT 422
-#define VAR_RATELIMIT_SLABS 423
-#define VAR_RATELIMIT_SIZE 424
-#define VAR_RATELIMIT_FOR_DOMAIN 425
-#define VAR_RATELIMIT_BELOW_DOMAIN 426
-#define VAR_IP_RATELIMIT_FACTOR 427
-#define VAR_RATELIMIT_FACTOR 428
-#define VAR_SEND_CLIENT_SUBNET 429
-#define VAR_CLIENT_SUBNET_ZONE 430
-#define VAR_CLIENT_SUBNET_ALWAYS_FORWARD 431
-#define VAR_CLIENT_SUBNET_OPCODE 432
-#define VAR_MAX_CLIENT_SUBNET_IPV4 433
-#define VAR_MAX_CLIENT_SUBNET_IPV6 434
-#define VAR_CAPS_WHITELIST 435
-#define VAR_CACHE_MAX_NEGATIVE_TTL 436
-#define VAR_PERMIT_SMALL_HOLDDOWN 437
-#define VAR_QNAME_MINIMISATION 438
-#define VAR_QNAME_MINIMISATION_STRICT 439
-#define VAR_IP_FREEBIND 440
-#define VAR_DEFINE_TAG 441
-#define VAR_LOCAL_ZONE_TAG 442
-#define VAR_ACCESS_CONTROL_TAG 443
-#define VAR_LOCAL_ZONE_OVERRIDE 444
-#define VAR_ACCESS_CONTROL_TAG_ACTION 445
-#define VAR_ACCESS_CONTROL_TAG_DATA 446
-#define VAR_VIEW 447
-#define VAR_ACCESS_CONTROL_VIEW 448
-#define VAR_VIEW_FIRST 449
-#define VAR_SERVE_EXPIRED 450
-#define VAR_FAKE_DSA 451
-#define VAR_FAKE_SHA1 452
-#define VAR_LOG_IDENTITY 453
-#define VAR_HIDE_TRUSTANCHOR 454
-#define VAR_TRUST_ANCHOR_SIGNALING 455
-#define VAR_USE_SYSTEMD 456
-#define VAR_SHM_ENABLE 457
-#define VAR_SHM_KEY 458
-#define VAR_DNSCRYPT 459
-#define VAR_DNSCRYPT_ENABLE 460
-#define VAR_DNSCRYPT_PORT 461
-#define VAR_DNSCRYPT_PROVIDER 462
-#define VAR_DNSCRYPT_SECRET_KEY 463
-#define VAR_DNSCRYPT_PROVIDER_CERT 464
-#define VAR_DNSCRYPT_PROVIDER_CERT_ROTATED 465
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE 466
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS 467
-#define VAR_DNSCRYPT_NONCE_CACHE_SIZE 468
-#define VAR_DNSCRYPT_NONCE_CACHE_SLABS 469
-#define VAR_IPSECMOD_ENABLED 470
-#define VAR_IPSECMOD_HOOK 471
-#define VAR_IPSECMOD_IGNORE_BOGUS 472
-#define VAR_IPSECMOD_MAX_TTL 473
-#define VAR_IPSECMOD_WHITELIST 474
-#define VAR_IPSECMOD_STRICT 475
-#define VAR_CACHEDB 476
-#define VAR_CACHEDB_BACKEND 477
-#define VAR_CACHEDB_SECRETSEED 478
-#define VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM 479
-#define VAR_FOR_UPSTREAM 480
-#define VAR_AUTH_ZONE 481
-#define VAR_ZONEFILE 482
-#define VAR_MASTER 483
-#define VAR_URL 484
-#define VAR_FOR_DOWNSTREAM 485
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
-union YYSTYPE
+#include "configparser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 66 "./util/configparser.y" /* yacc.c:355  */
-
-	char*	str;
-
-#line 599 "util/configparser.c" /* yacc.c:355  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SPACE = 3,                      /* SPACE  */
+  YYSYMBOL_LETTER = 4,                     /* LETTER  */
+  YYSYMBOL_NEWLINE = 5,                    /* NEWLINE  */
+  YYSYMBOL_COMMENT = 6,                    /* COMMENT  */
+  YYSYMBOL_COLON = 7,                      /* COLON  */
+  YYSYMBOL_ANY = 8,                        /* ANY  */
+  YYSYMBOL_ZONESTR = 9,                    /* ZONESTR  */
+  YYSYMBOL_STRING_ARG = 10,                /* STRING_ARG  */
+  YYSYMBOL_VAR_SERVER = 11,                /* VAR_SERVER  */
+  YYSYMBOL_VAR_VERBOSITY = 12,             /* VAR_VERBOSITY  */
+  YYSYMBOL_VAR_NUM_THREADS = 13,           /* VAR_NUM_THREADS  */
+  YYSYMBOL_VAR_PORT = 14,                  /* VAR_PORT  */
+  YYSYMBOL_VAR_OUTGOING_RANGE = 15,        /* VAR_OUTGOING_RANGE  */
+  YYSYMBOL_VAR_INTERFACE = 16,             /* VAR_INTERFACE  */
+  YYSYMBOL_VAR_DO_IP4 = 17,                /* VAR_DO_IP4  */
+  YYSYMBOL_VAR_DO_IP6 = 18,                /* VAR_DO_IP6  */
+  YYSYMBOL_VAR_PREFER_IP6 = 19,            /* VAR_PREFER_IP6  */
+  YYSYMBOL_VAR_DO_UDP = 20,                /* VAR_DO_UDP  */
+  YYSYMBOL_VAR_DO_TCP = 21,                /* VAR_DO_TCP  */
+  YYSYMBOL_VAR_TCP_MSS = 22,               /* VAR_TCP_MSS  */
+  YYSYMBOL_VAR_OUTGOING_TCP_MSS = 23,      /* VAR_OUTGOING_TCP_MSS  */
+  YYSYMBOL_VAR_CHROOT = 24,                /* VAR_CHROOT  */
+  YYSYMBOL_VAR_USERNAME = 25,              /* VAR_USERNAME  */
+  YYSYMBOL_VAR_DIRECTORY = 26,             /* VAR_DIRECTORY  */
+  YYSYMBOL_VAR_LOGFILE = 27,               /* VAR_LOGFILE  */
+  YYSYMBOL_VAR_PIDFILE = 28,               /* VAR_PIDFILE  */
+  YYSYMBOL_VAR_MSG_CACHE_SIZE = 29,        /* VAR_MSG_CACHE_SIZE  */
+  YYSYMBOL_VAR_MSG_CACHE_SLABS = 30,       /* VAR_MSG_CACHE_SLABS  */
+  YYSYMBOL_VAR_NUM_QUERIES_PER_THREAD = 31, /* VAR_NUM_QUERIES_PER_THREAD  */
+  YYSYMBOL_VAR_RRSET_CACHE_SIZE = 32,      /* VAR_RRSET_CACHE_SIZE  */
+  YYSYMBOL_VAR_RRSET_CACHE_SLABS = 33,     /* VAR_RRSET_CACHE_SLABS  */
+  YYSYMBOL_VAR_OUTGOING_NUM_TCP = 34,      /* VAR_OUTGOING_NUM_TCP  */
+  YYSYMBOL_VAR_INFRA_HOST_TTL = 35,        /* VAR_INFRA_HOST_TTL  */
+  YYSYMBOL_VAR_INFRA_LAME_TTL = 36,        /* VAR_INFRA_LAME_TTL  */
+  YYSYMBOL_VAR_INFRA_CACHE_SLABS = 37,     /* VAR_INFRA_CACHE_SLABS  */
+  YYSYMBOL_VAR_INFRA_CACHE_NUMHOSTS = 38,  /* VAR_INFRA_CACHE_NUMHOSTS  */
+  YYSYMBOL_VAR_INFRA_CACHE_LAME_SIZE = 39, /* VAR_INFRA_CACHE_LAME_SIZE  */
+  YYSYMBOL_VAR_NAME = 40,                  /* VAR_NAME  */
+  YYSYMBOL_VAR_STUB_ZONE = 41,             /* VAR_STUB_ZONE  */
+  YYSYMBOL_VAR_STUB_HOST = 42,             /* VAR_STUB_HOST  */
+  YYSYMBOL_VAR_STUB_ADDR = 43,             /* VAR_STUB_ADDR  */
+  YYSYMBOL_VAR_TARGET_FETCH_POLICY = 44,   /* VAR_TARGET_FETCH_POLICY  */
+  YYSYMBOL_VAR_HARDEN_SHORT_BUFSIZE = 45,  /* VAR_HARDEN_SHORT_BUFSIZE  */
+  YYSYMBOL_VAR_HARDEN_LARGE_QUERIES = 46,  /* VAR_HARDEN_LARGE_QUERIES  */
+  YYSYMBOL_VAR_FORWARD_ZONE = 47,          /* VAR_FORWARD_ZONE  */
+  YYSYMBOL_VAR_FORWARD_HOST = 48,          /* VAR_FORWARD_HOST  */
+  YYSYMBOL_VAR_FORWARD_ADDR = 49,          /* VAR_FORWARD_ADDR  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_ADDRESS = 50,  /* VAR_DO_NOT_QUERY_ADDRESS  */
+  YYSYMBOL_VAR_HIDE_IDENTITY = 51,         /* VAR_HIDE_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_VERSION = 52,          /* VAR_HIDE_VERSION  */
+  YYSYMBOL_VAR_IDENTITY = 53,              /* VAR_IDENTITY  */
+  YYSYMBOL_VAR_VERSION = 54,               /* VAR_VERSION  */
+  YYSYMBOL_VAR_HARDEN_GLUE = 55,           /* VAR_HARDEN_GLUE  */
+  YYSYMBOL_VAR_MODULE_CONF = 56,           /* VAR_MODULE_CONF  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_FILE = 57,     /* VAR_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_TRUST_ANCHOR = 58,          /* VAR_TRUST_ANCHOR  */
+  YYSYMBOL_VAR_VAL_OVERRIDE_DATE = 59,     /* VAR_VAL_OVERRIDE_DATE  */
+  YYSYMBOL_VAR_BOGUS_TTL = 60,             /* VAR_BOGUS_TTL  */
+  YYSYMBOL_VAR_VAL_CLEAN_ADDITIONAL = 61,  /* VAR_VAL_CLEAN_ADDITIONAL  */
+  YYSYMBOL_VAR_VAL_PERMISSIVE_MODE = 62,   /* VAR_VAL_PERMISSIVE_MODE  */
+  YYSYMBOL_VAR_INCOMING_NUM_TCP = 63,      /* VAR_INCOMING_NUM_TCP  */
+  YYSYMBOL_VAR_MSG_BUFFER_SIZE = 64,       /* VAR_MSG_BUFFER_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SIZE = 65,        /* VAR_KEY_CACHE_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SLABS = 66,       /* VAR_KEY_CACHE_SLABS  */
+  YYSYMBOL_VAR_TRUSTED_KEYS_FILE = 67,     /* VAR_TRUSTED_KEYS_FILE  */
+  YYSYMBOL_VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 68, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
+  YYSYMBOL_VAR_USE_SYSLOG = 69,            /* VAR_USE_SYSLOG  */
+  YYSYMBOL_VAR_OUTGOING_INTERFACE = 70,    /* VAR_OUTGOING_INTERFACE  */
+  YYSYMBOL_VAR_ROOT_HINTS = 71,            /* VAR_ROOT_HINTS  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_LOCALHOST = 72, /* VAR_DO_NOT_QUERY_LOCALHOST  */
+  YYSYMBOL_VAR_CACHE_MAX_TTL = 73,         /* VAR_CACHE_MAX_TTL  */
+  YYSYMBOL_VAR_HARDEN_DNSSEC_STRIPPED = 74, /* VAR_HARDEN_DNSSEC_STRIPPED  */
+  YYSYMBOL_VAR_ACCESS_CONTROL = 75,        /* VAR_ACCESS_CONTROL  */
+  YYSYMBOL_VAR_LOCAL_ZONE = 76,            /* VAR_LOCAL_ZONE  */
+  YYSYMBOL_VAR_LOCAL_DATA = 77,            /* VAR_LOCAL_DATA  */
+  YYSYMBOL_VAR_INTERFACE_AUTOMATIC = 78,   /* VAR_INTERFACE_AUTOMATIC  */
+  YYSYMBOL_VAR_STATISTICS_INTERVAL = 79,   /* VAR_STATISTICS_INTERVAL  */
+  YYSYMBOL_VAR_DO_DAEMONIZE = 80,          /* VAR_DO_DAEMONIZE  */
+  YYSYMBOL_VAR_USE_CAPS_FOR_ID = 81,       /* VAR_USE_CAPS_FOR_ID  */
+  YYSYMBOL_VAR_STATISTICS_CUMULATIVE = 82, /* VAR_STATISTICS_CUMULATIVE  */
+  YYSYMBOL_VAR_OUTGOING_PORT_PERMIT = 83,  /* VAR_OUTGOING_PORT_PERMIT  */
+  YYSYMBOL_VAR_OUTGOING_PORT_AVOID = 84,   /* VAR_OUTGOING_PORT_AVOID  */
+  YYSYMBOL_VAR_DLV_ANCHOR_FILE = 85,       /* VAR_DLV_ANCHOR_FILE  */
+  YYSYMBOL_VAR_DLV_ANCHOR = 86,            /* VAR_DLV_ANCHOR  */
+  YYSYMBOL_VAR_NEG_CACHE_SIZE = 87,        /* VAR_NEG_CACHE_SIZE  */
+  YYSYMBOL_VAR_HARDEN_REFERRAL_PATH = 88,  /* VAR_HARDEN_REFERRAL_PATH  */
+  YYSYMBOL_VAR_PRIVATE_ADDRESS = 89,       /* VAR_PRIVATE_ADDRESS  */
+  YYSYMBOL_VAR_PRIVATE_DOMAIN = 90,        /* VAR_PRIVATE_DOMAIN  */
+  YYSYMBOL_VAR_REMOTE_CONTROL = 91,        /* VAR_REMOTE_CONTROL  */
+  YYSYMBOL_VAR_CONTROL_ENABLE = 92,        /* VAR_CONTROL_ENABLE  */
+  YYSYMBOL_VAR_CONTROL_INTERFACE = 93,     /* VAR_CONTROL_INTERFACE  */
+  YYSYMBOL_VAR_CONTROL_PORT = 94,          /* VAR_CONTROL_PORT  */
+  YYSYMBOL_VAR_SERVER_KEY_FILE = 95,       /* VAR_SERVER_KEY_FILE  */
+  YYSYMBOL_VAR_SERVER_CERT_FILE = 96,      /* VAR_SERVER_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_KEY_FILE = 97,      /* VAR_CONTROL_KEY_FILE  */
+  YYSYMBOL_VAR_CONTROL_CERT_FILE = 98,     /* VAR_CONTROL_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_USE_CERT = 99,      /* VAR_CONTROL_USE_CERT  */
+  YYSYMBOL_VAR_EXTENDED_STATISTICS = 100,  /* VAR_EXTENDED_STATISTICS  */
+  YYSYMBOL_VAR_LOCAL_DATA_PTR = 101,       /* VAR_LOCAL_DATA_PTR  */
+  YYSYMBOL_VAR_JOSTLE_TIMEOUT = 102,       /* VAR_JOSTLE_TIMEOUT  */
+  YYSYMBOL_VAR_STUB_PRIME = 103,           /* VAR_STUB_PRIME  */
+  YYSYMBOL_VAR_UNWANTED_REPLY_THRESHOLD = 104, /* VAR_UNWANTED_REPLY_THRESHOLD  */
+  YYSYMBOL_VAR_LOG_TIME_ASCII = 105,       /* VAR_LOG_TIME_ASCII  */
+  YYSYMBOL_VAR_DOMAIN_INSECURE = 106,      /* VAR_DOMAIN_INSECURE  */
+  YYSYMBOL_VAR_PYTHON = 107,               /* VAR_PYTHON  */
+  YYSYMBOL_VAR_PYTHON_SCRIPT = 108,        /* VAR_PYTHON_SCRIPT  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MIN = 109,     /* VAR_VAL_SIG_SKEW_MIN  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MAX = 110,     /* VAR_VAL_SIG_SKEW_MAX  */
+  YYSYMBOL_VAR_CACHE_MIN_TTL = 111,        /* VAR_CACHE_MIN_TTL  */
+  YYSYMBOL_VAR_VAL_LOG_LEVEL = 112,        /* VAR_VAL_LOG_LEVEL  */
+  YYSYMBOL_VAR_AUTO_TRUST_ANCHOR_FILE = 113, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_KEEP_MISSING = 114,         /* VAR_KEEP_MISSING  */
+  YYSYMBOL_VAR_ADD_HOLDDOWN = 115,         /* VAR_ADD_HOLDDOWN  */
+  YYSYMBOL_VAR_DEL_HOLDDOWN = 116,         /* VAR_DEL_HOLDDOWN  */
+  YYSYMBOL_VAR_SO_RCVBUF = 117,            /* VAR_SO_RCVBUF  */
+  YYSYMBOL_VAR_EDNS_BUFFER_SIZE = 118,     /* VAR_EDNS_BUFFER_SIZE  */
+  YYSYMBOL_VAR_PREFETCH = 119,             /* VAR_PREFETCH  */
+  YYSYMBOL_VAR_PREFETCH_KEY = 120,         /* VAR_PREFETCH_KEY  */
+  YYSYMBOL_VAR_SO_SNDBUF = 121,            /* VAR_SO_SNDBUF  */
+  YYSYMBOL_VAR_SO_REUSEPORT = 122,         /* VAR_SO_REUSEPORT  */
+  YYSYMBOL_VAR_HARDEN_BELOW_NXDOMAIN = 123, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+  YYSYMBOL_VAR_IGNORE_CD_FLAG = 124,       /* VAR_IGNORE_CD_FLAG  */
+  YYSYMBOL_VAR_LOG_QUERIES = 125,          /* VAR_LOG_QUERIES  */
+  YYSYMBOL_VAR_LOG_REPLIES = 126,          /* VAR_LOG_REPLIES  */
+  YYSYMBOL_VAR_TCP_UPSTREAM = 127,         /* VAR_TCP_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_UPSTREAM = 128,         /* VAR_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_SERVICE_KEY = 129,      /* VAR_SSL_SERVICE_KEY  */
+  YYSYMBOL_VAR_SSL_SERVICE_PEM = 130,      /* VAR_SSL_SERVICE_PEM  */
+  YYSYMBOL_VAR_SSL_PORT = 131,             /* VAR_SSL_PORT  */
+  YYSYMBOL_VAR_FORWARD_FIRST = 132,        /* VAR_FORWARD_FIRST  */
+  YYSYMBOL_VAR_STUB_SSL_UPSTREAM = 133,    /* VAR_STUB_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_FORWARD_SSL_UPSTREAM = 134, /* VAR_FORWARD_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_STUB_FIRST = 135,           /* VAR_STUB_FIRST  */
+  YYSYMBOL_VAR_MINIMAL_RESPONSES = 136,    /* VAR_MINIMAL_RESPONSES  */
+  YYSYMBOL_VAR_RRSET_ROUNDROBIN = 137,     /* VAR_RRSET_ROUNDROBIN  */
+  YYSYMBOL_VAR_MAX_UDP_SIZE = 138,         /* VAR_MAX_UDP_SIZE  */
+  YYSYMBOL_VAR_DELAY_CLOSE = 139,          /* VAR_DELAY_CLOSE  */
+  YYSYMBOL_VAR_UNBLOCK_LAN_ZONES = 140,    /* VAR_UNBLOCK_LAN_ZONES  */
+  YYSYMBOL_VAR_INSECURE_LAN_ZONES = 141,   /* VAR_INSECURE_LAN_ZONES  */
+  YYSYMBOL_VAR_INFRA_CACHE_MIN_RTT = 142,  /* VAR_INFRA_CACHE_MIN_RTT  */
+  YYSYMBOL_VAR_DNS64_PREFIX = 143,         /* VAR_DNS64_PREFIX  */
+  YYSYMBOL_VAR_DNS64_SYNTHALL = 144,       /* VAR_DNS64_SYNTHALL  */
+  YYSYMBOL_VAR_DNSTAP = 145,               /* VAR_DNSTAP  */
+  YYSYMBOL_VAR_DNSTAP_ENABLE = 146,        /* VAR_DNSTAP_ENABLE  */
+  YYSYMBOL_VAR_DNSTAP_SOCKET_PATH = 147,   /* VAR_DNSTAP_SOCKET_PATH  */
+  YYSYMBOL_VAR_DNSTAP_SEND_IDENTITY = 148, /* VAR_DNSTAP_SEND_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_SEND_VERSION = 149,  /* VAR_DNSTAP_SEND_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_IDENTITY = 150,      /* VAR_DNSTAP_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_VERSION = 151,       /* VAR_DNSTAP_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 152, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 153, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 154, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 155, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 156, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 157, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_RESPONSE_IP_TAG = 158,      /* VAR_RESPONSE_IP_TAG  */
+  YYSYMBOL_VAR_RESPONSE_IP = 159,          /* VAR_RESPONSE_IP  */
+  YYSYMBOL_VAR_RESPONSE_IP_DATA = 160,     /* VAR_RESPONSE_IP_DATA  */
+  YYSYMBOL_VAR_HARDEN_ALGO_DOWNGRADE = 161, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+  YYSYMBOL_VAR_IP_TRANSPARENT = 162,       /* VAR_IP_TRANSPARENT  */
+  YYSYMBOL_VAR_DISABLE_DNSSEC_LAME_CHECK = 163, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
+  YYSYMBOL_VAR_IP_RATELIMIT = 164,         /* VAR_IP_RATELIMIT  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SLABS = 165,   /* VAR_IP_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SIZE = 166,    /* VAR_IP_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT = 167,            /* VAR_RATELIMIT  */
+  YYSYMBOL_VAR_RATELIMIT_SLABS = 168,      /* VAR_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_RATELIMIT_SIZE = 169,       /* VAR_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT_FOR_DOMAIN = 170, /* VAR_RATELIMIT_FOR_DOMAIN  */
+  YYSYMBOL_VAR_RATELIMIT_BELOW_DOMAIN = 171, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+  YYSYMBOL_VAR_IP_RATELIMIT_FACTOR = 172,  /* VAR_IP_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_RATELIMIT_FACTOR = 173,     /* VAR_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_SEND_CLIENT_SUBNET = 174,   /* VAR_SEND_CLIENT_SUBNET  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_ZONE = 175,   /* VAR_CLIENT_SUBNET_ZONE  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 176, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_OPCODE = 177, /* VAR_CLIENT_SUBNET_OPCODE  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV4 = 178, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV6 = 179, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
+  YYSYMBOL_VAR_CAPS_WHITELIST = 180,       /* VAR_CAPS_WHITELIST  */
+  YYSYMBOL_VAR_CACHE_MAX_NEGATIVE_TTL = 181, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+  YYSYMBOL_VAR_PERMIT_SMALL_HOLDDOWN = 182, /* VAR_PERMIT_SMALL_HOLDDOWN  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION = 183,   /* VAR_QNAME_MINIMISATION  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION_STRICT = 184, /* VAR_QNAME_MINIMISATION_STRICT  */
+  YYSYMBOL_VAR_IP_FREEBIND = 185,          /* VAR_IP_FREEBIND  */
+  YYSYMBOL_VAR_DEFINE_TAG = 186,           /* VAR_DEFINE_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_TAG = 187,       /* VAR_LOCAL_ZONE_TAG  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG = 188,   /* VAR_ACCESS_CONTROL_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_OVERRIDE = 189,  /* VAR_LOCAL_ZONE_OVERRIDE  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_ACTION = 190, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_DATA = 191, /* VAR_ACCESS_CONTROL_TAG_DATA  */
+  YYSYMBOL_VAR_VIEW = 192,                 /* VAR_VIEW  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_VIEW = 193,  /* VAR_ACCESS_CONTROL_VIEW  */
+  YYSYMBOL_VAR_VIEW_FIRST = 194,           /* VAR_VIEW_FIRST  */
+  YYSYMBOL_VAR_SERVE_EXPIRED = 195,        /* VAR_SERVE_EXPIRED  */
+  YYSYMBOL_VAR_FAKE_DSA = 196,             /* VAR_FAKE_DSA  */
+  YYSYMBOL_VAR_FAKE_SHA1 = 197,            /* VAR_FAKE_SHA1  */
+  YYSYMBOL_VAR_LOG_IDENTITY = 198,         /* VAR_LOG_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_TRUSTANCHOR = 199,     /* VAR_HIDE_TRUSTANCHOR  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_SIGNALING = 200, /* VAR_TRUST_ANCHOR_SIGNALING  */
+  YYSYMBOL_VAR_USE_SYSTEMD = 201,          /* VAR_USE_SYSTEMD  */
+  YYSYMBOL_VAR_SHM_ENABLE = 202,           /* VAR_SHM_ENABLE  */
+  YYSYMBOL_VAR_SHM_KEY = 203,              /* VAR_SHM_KEY  */
+  YYSYMBOL_VAR_DNSCRYPT = 204,             /* VAR_DNSCRYPT  */
+  YYSYMBOL_VAR_DNSCRYPT_ENABLE = 205,      /* VAR_DNSCRYPT_ENABLE  */
+  YYSYMBOL_VAR_DNSCRYPT_PORT = 206,        /* VAR_DNSCRYPT_PORT  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER = 207,    /* VAR_DNSCRYPT_PROVIDER  */
+  YYSYMBOL_VAR_DNSCRYPT_SECRET_KEY = 208,  /* VAR_DNSCRYPT_SECRET_KEY  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT = 209, /* VAR_DNSCRYPT_PROVIDER_CERT  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 210, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
+  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 211, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
+  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 212, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
+  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SIZE = 213, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
+  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SLABS = 214, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
+  YYSYMBOL_VAR_IPSECMOD_ENABLED = 215,     /* VAR_IPSECMOD_ENABLED  */
+  YYSYMBOL_VAR_IPSECMOD_HOOK = 216,        /* VAR_IPSECMOD_HOOK  */
+  YYSYMBOL_VAR_IPSECMOD_IGNORE_BOGUS = 217, /* VAR_IPSECMOD_IGNORE_BOGUS  */
+  YYSYMBOL_VAR_IPSECMOD_MAX_TTL = 218,     /* VAR_IPSECMOD_MAX_TTL  */
+  YYSYMBOL_VAR_IPSECMOD_WHITELIST = 219,   /* VAR_IPSECMOD_WHITELIST  */
+  YYSYMBOL_VAR_IPSECMOD_STRICT = 220,      /* VAR_IPSECMOD_STRICT  */
+  YYSYMBOL_VAR_CACHEDB = 221,              /* VAR_CACHEDB  */
+  YYSYMBOL_VAR_CACHEDB_BACKEND = 222,      /* VAR_CACHEDB_BACKEND  */
+  YYSYMBOL_VAR_CACHEDB_SECRETSEED = 223,   /* VAR_CACHEDB_SECRETSEED  */
+  YYSYMBOL_VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 224, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
+  YYSYMBOL_VAR_FOR_UPSTREAM = 225,         /* VAR_FOR_UPSTREAM  */
+  YYSYMBOL_VAR_AUTH_ZONE = 226,            /* VAR_AUTH_ZONE  */
+  YYSYMBOL_VAR_ZONEFILE = 227,             /* VAR_ZONEFILE  */
+  YYSYMBOL_VAR_MASTER = 228,               /* VAR_MASTER  */
+  YYSYMBOL_VAR_URL = 229,                  /* VAR_URL  */
+  YYSYMBOL_VAR_FOR_DOWNSTREAM = 230,       /* VAR_FOR_DOWNSTREAM  */
+  YYSYMBOL_VAR_UDP_BATCH_SIZE = 231,       /* VAR_UDP_BATCH_SIZE  */
+  YYSYMBOL_VAR_CACHE_CLOCK_EVICTION = 232, /* VAR_CACHE_CLOCK_EVICTION  */
+  YYSYMBOL_VAR_CACHE_SNAPSHOT_FILE = 233,  /* VAR_CACHE_SNAPSHOT_FILE  */
+  YYSYMBOL_VAR_WIRE_CACHE_SIZE = 234,      /* VAR_WIRE_CACHE_SIZE  */
+  YYSYMBOL_VAR_INCOMING_TCP_PIPELINE = 235, /* VAR_INCOMING_TCP_PIPELINE  */
+  YYSYMBOL_VAR_INCOMING_TCP_PIPELINE_TOTAL = 236, /* VAR_INCOMING_TCP_PIPELINE_TOTAL  */
+  YYSYMBOL_VAR_TCP_REUSE_TIMEOUT = 237,    /* VAR_TCP_REUSE_TIMEOUT  */
+  YYSYMBOL_VAR_MAX_REUSE_TCP_QUERIES = 238, /* VAR_MAX_REUSE_TCP_QUERIES  */
+  YYSYMBOL_VAR_COMPRESSION_HASH = 239,     /* VAR_COMPRESSION_HASH  */
+  YYSYMBOL_VAR_SO_REUSEPORT_CBPF = 240,    /* VAR_SO_REUSEPORT_CBPF  */
+  YYSYMBOL_VAR_CPU_AFFINITY = 241,         /* VAR_CPU_AFFINITY  */
+  YYSYMBOL_VAR_CPU_AFFINITY_LIST = 242,    /* VAR_CPU_AFFINITY_LIST  */
+  YYSYMBOL_VAR_INFLIGHT_DEDUP = 243,       /* VAR_INFLIGHT_DEDUP  */
+  YYSYMBOL_VAR_JOSTLE_ADAPTIVE = 244,      /* VAR_JOSTLE_ADAPTIVE  */
+  YYSYMBOL_VAR_OUTGOING_BATCH = 245,       /* VAR_OUTGOING_BATCH  */
+  YYSYMBOL_VAR_OUTGOING_PORT_POOL = 246,   /* VAR_OUTGOING_PORT_POOL  */
+  YYSYMBOL_VAR_OUTGOING_PORT_POOL_USES = 247, /* VAR_OUTGOING_PORT_POOL_USES  */
+  YYSYMBOL_VAR_INFRA_CACHE_SERVER_SHARED = 248, /* VAR_INFRA_CACHE_SERVER_SHARED  */
+  YYSYMBOL_VAR_IP_RATELIMIT_BURST = 249,   /* VAR_IP_RATELIMIT_BURST  */
+  YYSYMBOL_VAR_RATELIMIT_BURST = 250,      /* VAR_RATELIMIT_BURST  */
+  YYSYMBOL_VAR_IP_RATELIMIT_IPV4_PREFIX = 251, /* VAR_IP_RATELIMIT_IPV4_PREFIX  */
+  YYSYMBOL_VAR_IP_RATELIMIT_IPV6_PREFIX = 252, /* VAR_IP_RATELIMIT_IPV6_PREFIX  */
+  YYSYMBOL_VAR_IP_RATELIMIT_EXEMPT = 253,  /* VAR_IP_RATELIMIT_EXEMPT  */
+  YYSYMBOL_VAR_SERVER_SELECTION_PERCENTILE = 254, /* VAR_SERVER_SELECTION_PERCENTILE  */
+  YYSYMBOL_VAR_TARGET_FETCH_FANOUT = 255,  /* VAR_TARGET_FETCH_FANOUT  */
+  YYSYMBOL_VAR_SIG_CACHE_SIZE = 256,       /* VAR_SIG_CACHE_SIZE  */
+  YYSYMBOL_VAR_CRYPTO_THREADS = 257,       /* VAR_CRYPTO_THREADS  */
+  YYSYMBOL_VAR_NSEC3_CACHE_SIZE = 258,     /* VAR_NSEC3_CACHE_SIZE  */
+  YYSYMBOL_VAR_VAL_NSEC3_MAX_ITERATIONS = 259, /* VAR_VAL_NSEC3_MAX_ITERATIONS  */
+  YYSYMBOL_VAR_NEG_CACHE_SLABS = 260,      /* VAR_NEG_CACHE_SLABS  */
+  YYSYMBOL_VAR_AGGRESSIVE_NSEC = 261,      /* VAR_AGGRESSIVE_NSEC  */
+  YYSYMBOL_YYACCEPT = 262,                 /* $accept  */
+  YYSYMBOL_toplevelvars = 263,             /* toplevelvars  */
+  YYSYMBOL_toplevelvar = 264,              /* toplevelvar  */
+  YYSYMBOL_serverstart = 265,              /* serverstart  */
+  YYSYMBOL_contents_server = 266,          /* contents_server  */
+  YYSYMBOL_content_server = 267,           /* content_server  */
+  YYSYMBOL_stubstart = 268,                /* stubstart  */
+  YYSYMBOL_contents_stub = 269,            /* contents_stub  */
+  YYSYMBOL_content_stub = 270,             /* content_stub  */
+  YYSYMBOL_forwardstart = 271,             /* forwardstart  */
+  YYSYMBOL_contents_forward = 272,         /* contents_forward  */
+  YYSYMBOL_content_forward = 273,          /* content_forward  */
+  YYSYMBOL_viewstart = 274,                /* viewstart  */
+  YYSYMBOL_contents_view = 275,            /* contents_view  */
+  YYSYMBOL_content_view = 276,             /* content_view  */
+  YYSYMBOL_authstart = 277,                /* authstart  */
+  YYSYMBOL_contents_auth = 278,            /* contents_auth  */
+  YYSYMBOL_content_auth = 279,             /* content_auth  */
+  YYSYMBOL_server_num_threads = 280,       /* server_num_threads  */
+  YYSYMBOL_server_verbosity = 281,         /* server_verbosity  */
+  YYSYMBOL_server_statistics_interval = 282, /* server_statistics_interval  */
+  YYSYMBOL_server_statistics_cumulative = 283, /* server_statistics_cumulative  */
+  YYSYMBOL_server_extended_statistics = 284, /* server_extended_statistics  */
+  YYSYMBOL_server_shm_enable = 285,        /* server_shm_enable  */
+  YYSYMBOL_server_shm_key = 286,           /* server_shm_key  */
+  YYSYMBOL_server_port = 287,              /* server_port  */
+  YYSYMBOL_server_send_client_subnet = 288, /* server_send_client_subnet  */
+  YYSYMBOL_server_client_subnet_zone = 289, /* server_client_subnet_zone  */
+  YYSYMBOL_server_client_subnet_always_forward = 290, /* server_client_subnet_always_forward  */
+  YYSYMBOL_server_client_subnet_opcode = 291, /* server_client_subnet_opcode  */
+  YYSYMBOL_server_max_client_subnet_ipv4 = 292, /* server_max_client_subnet_ipv4  */
+  YYSYMBOL_server_max_client_subnet_ipv6 = 293, /* server_max_client_subnet_ipv6  */
+  YYSYMBOL_server_interface = 294,         /* server_interface  */
+  YYSYMBOL_server_outgoing_interface = 295, /* server_outgoing_interface  */
+  YYSYMBOL_server_outgoing_range = 296,    /* server_outgoing_range  */
+  YYSYMBOL_server_outgoing_port_permit = 297, /* server_outgoing_port_permit  */
+  YYSYMBOL_server_outgoing_port_avoid = 298, /* server_outgoing_port_avoid  */
+  YYSYMBOL_server_outgoing_num_tcp = 299,  /* server_outgoing_num_tcp  */
+  YYSYMBOL_server_incoming_num_tcp = 300,  /* server_incoming_num_tcp  */
+  YYSYMBOL_server_incoming_tcp_pipeline = 301, /* server_incoming_tcp_pipeline  */
+  YYSYMBOL_server_incoming_tcp_pipeline_total = 302, /* server_incoming_tcp_pipeline_total  */
+  YYSYMBOL_server_tcp_reuse_timeout = 303, /* server_tcp_reuse_timeout  */
+  YYSYMBOL_server_max_reuse_tcp_queries = 304, /* server_max_reuse_tcp_queries  */
+  YYSYMBOL_server_interface_automatic = 305, /* server_interface_automatic  */
+  YYSYMBOL_server_do_ip4 = 306,            /* server_do_ip4  */
+  YYSYMBOL_server_do_ip6 = 307,            /* server_do_ip6  */
+  YYSYMBOL_server_do_udp = 308,            /* server_do_udp  */
+  YYSYMBOL_server_do_tcp = 309,            /* server_do_tcp  */
+  YYSYMBOL_server_prefer_ip6 = 310,        /* server_prefer_ip6  */
+  YYSYMBOL_server_tcp_mss = 311,           /* server_tcp_mss  */
+  YYSYMBOL_server_outgoing_tcp_mss = 312,  /* server_outgoing_tcp_mss  */
+  YYSYMBOL_server_tcp_upstream = 313,      /* server_tcp_upstream  */
+  YYSYMBOL_server_udp_upstream_without_downstream = 314, /* server_udp_upstream_without_downstream  */
+  YYSYMBOL_server_ssl_upstream = 315,      /* server_ssl_upstream  */
+  YYSYMBOL_server_ssl_service_key = 316,   /* server_ssl_service_key  */
+  YYSYMBOL_server_ssl_service_pem = 317,   /* server_ssl_service_pem  */
+  YYSYMBOL_server_ssl_port = 318,          /* server_ssl_port  */
+  YYSYMBOL_server_use_systemd = 319,       /* server_use_systemd  */
+  YYSYMBOL_server_do_daemonize = 320,      /* server_do_daemonize  */
+  YYSYMBOL_server_use_syslog = 321,        /* server_use_syslog  */
+  YYSYMBOL_server_log_time_ascii = 322,    /* server_log_time_ascii  */
+  YYSYMBOL_server_log_queries = 323,       /* server_log_queries  */
+  YYSYMBOL_server_log_replies = 324,       /* server_log_replies  */
+  YYSYMBOL_server_chroot = 325,            /* server_chroot  */
+  YYSYMBOL_server_username = 326,          /* server_username  */
+  YYSYMBOL_server_directory = 327,         /* server_directory  */
+  YYSYMBOL_server_logfile = 328,           /* server_logfile  */
+  YYSYMBOL_server_pidfile = 329,           /* server_pidfile  */
+  YYSYMBOL_server_root_hints = 330,        /* server_root_hints  */
+  YYSYMBOL_server_dlv_anchor_file = 331,   /* server_dlv_anchor_file  */
+  YYSYMBOL_server_dlv_anchor = 332,        /* server_dlv_anchor  */
+  YYSYMBOL_server_auto_trust_anchor_file = 333, /* server_auto_trust_anchor_file  */
+  YYSYMBOL_server_trust_anchor_file = 334, /* server_trust_anchor_file  */
+  YYSYMBOL_server_trusted_keys_file = 335, /* server_trusted_keys_file  */
+  YYSYMBOL_server_trust_anchor = 336,      /* server_trust_anchor  */
+  YYSYMBOL_server_trust_anchor_signaling = 337, /* server_trust_anchor_signaling  */
+  YYSYMBOL_server_domain_insecure = 338,   /* server_domain_insecure  */
+  YYSYMBOL_server_hide_identity = 339,     /* server_hide_identity  */
+  YYSYMBOL_server_hide_version = 340,      /* server_hide_version  */
+  YYSYMBOL_server_hide_trustanchor = 341,  /* server_hide_trustanchor  */
+  YYSYMBOL_server_identity = 342,          /* server_identity  */
+  YYSYMBOL_server_version = 343,           /* server_version  */
+  YYSYMBOL_server_so_rcvbuf = 344,         /* server_so_rcvbuf  */
+  YYSYMBOL_server_so_sndbuf = 345,         /* server_so_sndbuf  */
+  YYSYMBOL_server_so_reuseport = 346,      /* server_so_reuseport  */
+  YYSYMBOL_server_udp_batch_size = 347,    /* server_udp_batch_size  */
+  YYSYMBOL_server_ip_transparent = 348,    /* server_ip_transparent  */
+  YYSYMBOL_server_ip_freebind = 349,       /* server_ip_freebind  */
+  YYSYMBOL_server_edns_buffer_size = 350,  /* server_edns_buffer_size  */
+  YYSYMBOL_server_msg_buffer_size = 351,   /* server_msg_buffer_size  */
+  YYSYMBOL_server_msg_cache_size = 352,    /* server_msg_cache_size  */
+  YYSYMBOL_server_msg_cache_slabs = 353,   /* server_msg_cache_slabs  */
+  YYSYMBOL_server_num_queries_per_thread = 354, /* server_num_queries_per_thread  */
+  YYSYMBOL_server_jostle_timeout = 355,    /* server_jostle_timeout  */
+  YYSYMBOL_server_delay_close = 356,       /* server_delay_close  */
+  YYSYMBOL_server_unblock_lan_zones = 357, /* server_unblock_lan_zones  */
+  YYSYMBOL_server_insecure_lan_zones = 358, /* server_insecure_lan_zones  */
+  YYSYMBOL_server_rrset_cache_size = 359,  /* server_rrset_cache_size  */
+  YYSYMBOL_server_rrset_cache_slabs = 360, /* server_rrset_cache_slabs  */
+  YYSYMBOL_server_cache_clock_eviction = 361, /* server_cache_clock_eviction  */
+  YYSYMBOL_server_cache_snapshot_file = 362, /* server_cache_snapshot_file  */
+  YYSYMBOL_server_wire_cache_size = 363,   /* server_wire_cache_size  */
+  YYSYMBOL_server_infra_host_ttl = 364,    /* server_infra_host_ttl  */
+  YYSYMBOL_server_infra_lame_ttl = 365,    /* server_infra_lame_ttl  */
+  YYSYMBOL_server_infra_cache_numhosts = 366, /* server_infra_cache_numhosts  */
+  YYSYMBOL_server_infra_cache_lame_size = 367, /* server_infra_cache_lame_size  */
+  YYSYMBOL_server_infra_cache_slabs = 368, /* server_infra_cache_slabs  */
+  YYSYMBOL_server_infra_cache_min_rtt = 369, /* server_infra_cache_min_rtt  */
+  YYSYMBOL_server_target_fetch_policy = 370, /* server_target_fetch_policy  */
+  YYSYMBOL_server_harden_short_bufsize = 371, /* server_harden_short_bufsize  */
+  YYSYMBOL_server_harden_large_queries = 372, /* server_harden_large_queries  */
+  YYSYMBOL_server_harden_glue = 373,       /* server_harden_glue  */
+  YYSYMBOL_server_harden_dnssec_stripped = 374, /* server_harden_dnssec_stripped  */
+  YYSYMBOL_server_harden_below_nxdomain = 375, /* server_harden_below_nxdomain  */
+  YYSYMBOL_server_harden_referral_path = 376, /* server_harden_referral_path  */
+  YYSYMBOL_server_harden_algo_downgrade = 377, /* server_harden_algo_downgrade  */
+  YYSYMBOL_server_use_caps_for_id = 378,   /* server_use_caps_for_id  */
+  YYSYMBOL_server_caps_whitelist = 379,    /* server_caps_whitelist  */
+  YYSYMBOL_server_private_address = 380,   /* server_private_address  */
+  YYSYMBOL_server_private_domain = 381,    /* server_private_domain  */
+  YYSYMBOL_server_prefetch = 382,          /* server_prefetch  */
+  YYSYMBOL_server_prefetch_key = 383,      /* server_prefetch_key  */
+  YYSYMBOL_server_unwanted_reply_threshold = 384, /* server_unwanted_reply_threshold  */
+  YYSYMBOL_server_do_not_query_address = 385, /* server_do_not_query_address  */
+  YYSYMBOL_server_do_not_query_localhost = 386, /* server_do_not_query_localhost  */
+  YYSYMBOL_server_access_control = 387,    /* server_access_control  */
+  YYSYMBOL_server_module_conf = 388,       /* server_module_conf  */
+  YYSYMBOL_server_val_override_date = 389, /* server_val_override_date  */
+  YYSYMBOL_server_val_sig_skew_min = 390,  /* server_val_sig_skew_min  */
+  YYSYMBOL_server_val_sig_skew_max = 391,  /* server_val_sig_skew_max  */
+  YYSYMBOL_server_cache_max_ttl = 392,     /* server_cache_max_ttl  */
+  YYSYMBOL_server_cache_max_negative_ttl = 393, /* server_cache_max_negative_ttl  */
+  YYSYMBOL_server_cache_min_ttl = 394,     /* server_cache_min_ttl  */
+  YYSYMBOL_server_bogus_ttl = 395,         /* server_bogus_ttl  */
+  YYSYMBOL_server_val_clean_additional = 396, /* server_val_clean_additional  */
+  YYSYMBOL_server_val_permissive_mode = 397, /* server_val_permissive_mode  */
+  YYSYMBOL_server_ignore_cd_flag = 398,    /* server_ignore_cd_flag  */
+  YYSYMBOL_server_serve_expired = 399,     /* server_serve_expired  */
+  YYSYMBOL_server_fake_dsa = 400,          /* server_fake_dsa  */
+  YYSYMBOL_server_fake_sha1 = 401,         /* server_fake_sha1  */
+  YYSYMBOL_server_val_log_level = 402,     /* server_val_log_level  */
+  YYSYMBOL_server_val_nsec3_keysize_iterations = 403, /* server_val_nsec3_keysize_iterations  */
+  YYSYMBOL_server_add_holddown = 404,      /* server_add_holddown  */
+  YYSYMBOL_server_del_holddown = 405,      /* server_del_holddown  */
+  YYSYMBOL_server_keep_missing = 406,      /* server_keep_missing  */
+  YYSYMBOL_server_permit_small_holddown = 407, /* server_permit_small_holddown  */
+  YYSYMBOL_server_key_cache_size = 408,    /* server_key_cache_size  */
+  YYSYMBOL_server_sig_cache_size = 409,    /* server_sig_cache_size  */
+  YYSYMBOL_server_nsec3_cache_size = 410,  /* server_nsec3_cache_size  */
+  YYSYMBOL_server_val_nsec3_max_iterations = 411, /* server_val_nsec3_max_iterations  */
+  YYSYMBOL_server_crypto_threads = 412,    /* server_crypto_threads  */
+  YYSYMBOL_server_key_cache_slabs = 413,   /* server_key_cache_slabs  */
+  YYSYMBOL_server_neg_cache_size = 414,    /* server_neg_cache_size  */
+  YYSYMBOL_server_neg_cache_slabs = 415,   /* server_neg_cache_slabs  */
+  YYSYMBOL_server_aggressive_nsec = 416,   /* server_aggressive_nsec  */
+  YYSYMBOL_server_local_zone = 417,        /* server_local_zone  */
+  YYSYMBOL_server_local_data = 418,        /* server_local_data  */
+  YYSYMBOL_server_local_data_ptr = 419,    /* server_local_data_ptr  */
+  YYSYMBOL_server_minimal_responses = 420, /* server_minimal_responses  */
+  YYSYMBOL_server_rrset_roundrobin = 421,  /* server_rrset_roundrobin  */
+  YYSYMBOL_server_compression_hash = 422,  /* server_compression_hash  */
+  YYSYMBOL_server_so_reuseport_cbpf = 423, /* server_so_reuseport_cbpf  */
+  YYSYMBOL_server_cpu_affinity = 424,      /* server_cpu_affinity  */
+  YYSYMBOL_server_cpu_affinity_list = 425, /* server_cpu_affinity_list  */
+  YYSYMBOL_server_inflight_dedup = 426,    /* server_inflight_dedup  */
+  YYSYMBOL_server_jostle_adaptive = 427,   /* server_jostle_adaptive  */
+  YYSYMBOL_server_outgoing_batch = 428,    /* server_outgoing_batch  */
+  YYSYMBOL_server_outgoing_port_pool = 429, /* server_outgoing_port_pool  */
+  YYSYMBOL_server_outgoing_port_pool_uses = 430, /* server_outgoing_port_pool_uses  */
+  YYSYMBOL_server_infra_cache_server_shared = 431, /* server_infra_cache_server_shared  */
+  YYSYMBOL_server_server_selection_percentile = 432, /* server_server_selection_percentile  */
+  YYSYMBOL_server_target_fetch_fanout = 433, /* server_target_fetch_fanout  */
+  YYSYMBOL_server_max_udp_size = 434,      /* server_max_udp_size  */
+  YYSYMBOL_server_dns64_prefix = 435,      /* server_dns64_prefix  */
+  YYSYMBOL_server_dns64_synthall = 436,    /* server_dns64_synthall  */
+  YYSYMBOL_server_define_tag = 437,        /* server_define_tag  */
+  YYSYMBOL_server_local_zone_tag = 438,    /* server_local_zone_tag  */
+  YYSYMBOL_server_access_control_tag = 439, /* server_access_control_tag  */
+  YYSYMBOL_server_access_control_tag_action = 440, /* server_access_control_tag_action  */
+  YYSYMBOL_server_access_control_tag_data = 441, /* server_access_control_tag_data  */
+  YYSYMBOL_server_local_zone_override = 442, /* server_local_zone_override  */
+  YYSYMBOL_server_access_control_view = 443, /* server_access_control_view  */
+  YYSYMBOL_server_response_ip_tag = 444,   /* server_response_ip_tag  */
+  YYSYMBOL_server_ip_ratelimit = 445,      /* server_ip_ratelimit  */
+  YYSYMBOL_server_ratelimit = 446,         /* server_ratelimit  */
+  YYSYMBOL_server_ip_ratelimit_size = 447, /* server_ip_ratelimit_size  */
+  YYSYMBOL_server_ratelimit_size = 448,    /* server_ratelimit_size  */
+  YYSYMBOL_server_ip_ratelimit_slabs = 449, /* server_ip_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_slabs = 450,   /* server_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_for_domain = 451, /* server_ratelimit_for_domain  */
+  YYSYMBOL_server_ratelimit_below_domain = 452, /* server_ratelimit_below_domain  */
+  YYSYMBOL_server_ip_ratelimit_factor = 453, /* server_ip_ratelimit_factor  */
+  YYSYMBOL_server_ip_ratelimit_burst = 454, /* server_ip_ratelimit_burst  */
+  YYSYMBOL_server_ratelimit_burst = 455,   /* server_ratelimit_burst  */
+  YYSYMBOL_server_ip_ratelimit_ipv4_prefix = 456, /* server_ip_ratelimit_ipv4_prefix  */
+  YYSYMBOL_server_ip_ratelimit_ipv6_prefix = 457, /* server_ip_ratelimit_ipv6_prefix  */
+  YYSYMBOL_server_ip_ratelimit_exempt = 458, /* server_ip_ratelimit_exempt  */
+  YYSYMBOL_server_ratelimit_factor = 459,  /* server_ratelimit_factor  */
+  YYSYMBOL_server_qname_minimisation = 460, /* server_qname_minimisation  */
+  YYSYMBOL_server_qname_minimisation_strict = 461, /* server_qname_minimisation_strict  */
+  YYSYMBOL_server_ipsecmod_enabled = 462,  /* server_ipsecmod_enabled  */
+  YYSYMBOL_server_ipsecmod_ignore_bogus = 463, /* server_ipsecmod_ignore_bogus  */
+  YYSYMBOL_server_ipsecmod_hook = 464,     /* server_ipsecmod_hook  */
+  YYSYMBOL_server_ipsecmod_max_ttl = 465,  /* server_ipsecmod_max_ttl  */
+  YYSYMBOL_server_ipsecmod_whitelist = 466, /* server_ipsecmod_whitelist  */
+  YYSYMBOL_server_ipsecmod_strict = 467,   /* server_ipsecmod_strict  */
+  YYSYMBOL_stub_name = 468,                /* stub_name  */
+  YYSYMBOL_stub_host = 469,                /* stub_host  */
+  YYSYMBOL_stub_addr = 470,                /* stub_addr  */
+  YYSYMBOL_stub_first = 471,               /* stub_first  */
+  YYSYMBOL_stub_ssl_upstream = 472,        /* stub_ssl_upstream  */
+  YYSYMBOL_stub_prime = 473,               /* stub_prime  */
+  YYSYMBOL_forward_name = 474,             /* forward_name  */
+  YYSYMBOL_forward_host = 475,             /* forward_host  */
+  YYSYMBOL_forward_addr = 476,             /* forward_addr  */
+  YYSYMBOL_forward_first = 477,            /* forward_first  */
+  YYSYMBOL_forward_ssl_upstream = 478,     /* forward_ssl_upstream  */
+  YYSYMBOL_auth_name = 479,                /* auth_name  */
+  YYSYMBOL_auth_zonefile = 480,            /* auth_zonefile  */
+  YYSYMBOL_auth_master = 481,              /* auth_master  */
+  YYSYMBOL_auth_url = 482,                 /* auth_url  */
+  YYSYMBOL_auth_for_downstream = 483,      /* auth_for_downstream  */
+  YYSYMBOL_auth_for_upstream = 484,        /* auth_for_upstream  */
+  YYSYMBOL_view_name = 485,                /* view_name  */
+  YYSYMBOL_view_local_zone = 486,          /* view_local_zone  */
+  YYSYMBOL_view_response_ip = 487,         /* view_response_ip  */
+  YYSYMBOL_view_response_ip_data = 488,    /* view_response_ip_data  */
+  YYSYMBOL_view_local_data = 489,          /* view_local_data  */
+  YYSYMBOL_view_local_data_ptr = 490,      /* view_local_data_ptr  */
+  YYSYMBOL_view_first = 491,               /* view_first  */
+  YYSYMBOL_rcstart = 492,                  /* rcstart  */
+  YYSYMBOL_contents_rc = 493,              /* contents_rc  */
+  YYSYMBOL_content_rc = 494,               /* content_rc  */
+  YYSYMBOL_rc_control_enable = 495,        /* rc_control_enable  */
+  YYSYMBOL_rc_control_port = 496,          /* rc_control_port  */
+  YYSYMBOL_rc_control_interface = 497,     /* rc_control_interface  */
+  YYSYMBOL_rc_control_use_cert = 498,      /* rc_control_use_cert  */
+  YYSYMBOL_rc_server_key_file = 499,       /* rc_server_key_file  */
+  YYSYMBOL_rc_server_cert_file = 500,      /* rc_server_cert_file  */
+  YYSYMBOL_rc_control_key_file = 501,      /* rc_control_key_file  */
+  YYSYMBOL_rc_control_cert_file = 502,     /* rc_control_cert_file  */
+  YYSYMBOL_dtstart = 503,                  /* dtstart  */
+  YYSYMBOL_contents_dt = 504,              /* contents_dt  */
+  YYSYMBOL_content_dt = 505,               /* content_dt  */
+  YYSYMBOL_dt_dnstap_enable = 506,         /* dt_dnstap_enable  */
+  YYSYMBOL_dt_dnstap_socket_path = 507,    /* dt_dnstap_socket_path  */
+  YYSYMBOL_dt_dnstap_send_identity = 508,  /* dt_dnstap_send_identity  */
+  YYSYMBOL_dt_dnstap_send_version = 509,   /* dt_dnstap_send_version  */
+  YYSYMBOL_dt_dnstap_identity = 510,       /* dt_dnstap_identity  */
+  YYSYMBOL_dt_dnstap_version = 511,        /* dt_dnstap_version  */
+  YYSYMBOL_dt_dnstap_log_resolver_query_messages = 512, /* dt_dnstap_log_resolver_query_messages  */
+  YYSYMBOL_dt_dnstap_log_resolver_response_messages = 513, /* dt_dnstap_log_resolver_response_messages  */
+  YYSYMBOL_dt_dnstap_log_client_query_messages = 514, /* dt_dnstap_log_client_query_messages  */
+  YYSYMBOL_dt_dnstap_log_client_response_messages = 515, /* dt_dnstap_log_client_response_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_query_messages = 516, /* dt_dnstap_log_forwarder_query_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_response_messages = 517, /* dt_dnstap_log_forwarder_response_messages  */
+  YYSYMBOL_pythonstart = 518,              /* pythonstart  */
+  YYSYMBOL_contents_py = 519,              /* contents_py  */
+  YYSYMBOL_content_py = 520,               /* content_py  */
+  YYSYMBOL_py_script = 521,                /* py_script  */
+  YYSYMBOL_server_disable_dnssec_lame_check = 522, /* server_disable_dnssec_lame_check  */
+  YYSYMBOL_server_log_identity = 523,      /* server_log_identity  */
+  YYSYMBOL_server_response_ip = 524,       /* server_response_ip  */
+  YYSYMBOL_server_response_ip_data = 525,  /* server_response_ip_data  */
+  YYSYMBOL_dnscstart = 526,                /* dnscstart  */
+  YYSYMBOL_contents_dnsc = 527,            /* contents_dnsc  */
+  YYSYMBOL_content_dnsc = 528,             /* content_dnsc  */
+  YYSYMBOL_dnsc_dnscrypt_enable = 529,     /* dnsc_dnscrypt_enable  */
+  YYSYMBOL_dnsc_dnscrypt_port = 530,       /* dnsc_dnscrypt_port  */
+  YYSYMBOL_dnsc_dnscrypt_provider = 531,   /* dnsc_dnscrypt_provider  */
+  YYSYMBOL_dnsc_dnscrypt_provider_cert = 532, /* dnsc_dnscrypt_provider_cert  */
+  YYSYMBOL_dnsc_dnscrypt_provider_cert_rotated = 533, /* dnsc_dnscrypt_provider_cert_rotated  */
+  YYSYMBOL_dnsc_dnscrypt_secret_key = 534, /* dnsc_dnscrypt_secret_key  */
+  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_size = 535, /* dnsc_dnscrypt_shared_secret_cache_size  */
+  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_slabs = 536, /* dnsc_dnscrypt_shared_secret_cache_slabs  */
+  YYSYMBOL_dnsc_dnscrypt_nonce_cache_size = 537, /* dnsc_dnscrypt_nonce_cache_size  */
+  YYSYMBOL_dnsc_dnscrypt_nonce_cache_slabs = 538, /* dnsc_dnscrypt_nonce_cache_slabs  */
+  YYSYMBOL_cachedbstart = 539,             /* cachedbstart  */
+  YYSYMBOL_contents_cachedb = 540,         /* contents_cachedb  */
+  YYSYMBOL_content_cachedb = 541,          /* content_cachedb  */
+  YYSYMBOL_cachedb_backend_name = 542,     /* cachedb_backend_name  */
+  YYSYMBOL_cachedb_secret_seed = 543       /* cachedb_secret_seed  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
 
-extern YYSTYPE yylval;
 
-int yyparse (void);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-#line 616 "util/configparser.c" /* yacc.c:358  */
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -647,15 +766,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -669,47 +801,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -722,8 +850,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -788,8 +930,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -798,17 +939,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -821,11 +962,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -837,12 +978,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -854,28 +995,31 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   467
+#define YYLAST   528
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  231
+#define YYNTOKENS  262
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  251
+#define YYNNTS  282
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  479
+#define YYNRULES  541
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  717
+#define YYNSTATES  810
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   516
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   485
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
-static const yytype_uint8 yytranslate[] =
+   as returned by yylex.  */
+static const yytype_int16 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -925,75 +1069,93 @@ static const yytype_uint8 yytranslate[] =
      195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
      205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
      215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
-     225,   226,   227,   228,   229,   230
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   159,   159,   159,   160,   160,   161,   161,   162,   162,
-     162,   163,   163,   164,   168,   173,   174,   175,   175,   175,
-     176,   176,   177,   177,   178,   178,   179,   179,   180,   180,
-     180,   181,   181,   181,   182,   182,   183,   183,   184,   184,
-     185,   185,   186,   186,   187,   187,   188,   188,   189,   189,
-     190,   190,   190,   191,   191,   191,   192,   192,   192,   193,
-     193,   194,   194,   195,   195,   196,   196,   197,   197,   197,
-     198,   198,   199,   199,   200,   200,   200,   201,   201,   202,
-     202,   203,   203,   204,   204,   204,   205,   205,   206,   206,
-     207,   207,   208,   208,   209,   209,   210,   210,   210,   211,
-     211,   212,   212,   212,   213,   213,   213,   214,   214,   214,
-     215,   215,   215,   215,   216,   216,   216,   217,   217,   217,
-     218,   218,   219,   219,   220,   220,   221,   221,   222,   222,
-     222,   223,   223,   224,   224,   225,   226,   226,   227,   227,
-     228,   228,   229,   230,   230,   231,   231,   232,   232,   233,
+       0,   174,   174,   174,   175,   175,   176,   176,   177,   177,
+     177,   178,   178,   179,   183,   188,   189,   190,   190,   190,
+     191,   191,   192,   192,   193,   193,   194,   194,   195,   195,
+     195,   196,   196,   196,   197,   197,   198,   198,   199,   199,
+     200,   200,   201,   201,   202,   202,   203,   203,   204,   204,
+     205,   205,   205,   206,   206,   206,   207,   207,   207,   208,
+     208,   209,   209,   210,   210,   211,   211,   212,   212,   212,
+     213,   213,   214,   214,   215,   215,   215,   216,   216,   217,
+     217,   218,   218,   219,   219,   219,   220,   220,   221,   221,
+     222,   222,   223,   223,   224,   224,   225,   225,   225,   226,
+     226,   227,   227,   227,   228,   228,   228,   229,   229,   229,
+     230,   230,   230,   230,   231,   231,   231,   232,   232,   232,
      233,   233,   234,   234,   235,   235,   236,   236,   237,   237,
-     238,   238,   238,   239,   239,   239,   240,   240,   240,   241,
-     241,   242,   242,   243,   243,   244,   244,   245,   247,   259,
-     260,   261,   261,   261,   261,   261,   262,   264,   276,   277,
-     278,   278,   278,   278,   279,   281,   295,   296,   297,   297,
-     297,   297,   298,   298,   298,   300,   315,   316,   317,   317,
-     317,   317,   318,   318,   320,   329,   338,   349,   358,   367,
-     376,   387,   396,   407,   420,   435,   446,   463,   480,   493,
-     508,   517,   526,   535,   544,   553,   562,   571,   580,   589,
-     598,   607,   616,   625,   634,   643,   652,   659,   666,   675,
-     684,   693,   707,   716,   725,   734,   741,   748,   774,   782,
-     789,   796,   803,   810,   818,   826,   834,   841,   852,   859,
-     868,   877,   886,   893,   900,   908,   916,   926,   936,   946,
-     959,   970,   978,   991,  1000,  1009,  1018,  1028,  1038,  1046,
-    1059,  1068,  1076,  1085,  1093,  1106,  1115,  1122,  1132,  1142,
-    1152,  1162,  1172,  1182,  1192,  1202,  1209,  1216,  1223,  1232,
-    1241,  1250,  1257,  1267,  1284,  1291,  1309,  1322,  1335,  1344,
-    1353,  1362,  1371,  1381,  1391,  1400,  1409,  1422,  1435,  1444,
-    1451,  1460,  1469,  1478,  1487,  1495,  1508,  1516,  1544,  1551,
-    1566,  1576,  1586,  1593,  1600,  1609,  1623,  1642,  1661,  1673,
-    1685,  1697,  1708,  1727,  1737,  1746,  1754,  1762,  1775,  1788,
-    1801,  1814,  1823,  1832,  1842,  1852,  1865,  1878,  1889,  1902,
-    1913,  1926,  1936,  1943,  1950,  1959,  1969,  1979,  1989,  1996,
-    2003,  2012,  2022,  2032,  2039,  2046,  2053,  2063,  2073,  2083,
-    2112,  2122,  2130,  2139,  2154,  2163,  2168,  2169,  2170,  2170,
-    2170,  2171,  2171,  2171,  2172,  2172,  2174,  2184,  2193,  2200,
-    2210,  2217,  2224,  2231,  2238,  2243,  2244,  2245,  2245,  2246,
-    2246,  2247,  2247,  2248,  2249,  2250,  2251,  2252,  2253,  2255,
-    2263,  2270,  2278,  2286,  2293,  2300,  2309,  2318,  2327,  2336,
-    2345,  2354,  2359,  2360,  2361,  2363,  2369,  2379,  2386,  2395,
-    2403,  2409,  2410,  2412,  2412,  2412,  2413,  2413,  2414,  2415,
-    2416,  2417,  2418,  2420,  2430,  2440,  2447,  2456,  2463,  2472,
-    2480,  2493,  2501,  2514,  2519,  2520,  2521,  2521,  2523,  2537
+     237,   238,   238,   239,   239,   240,   241,   241,   242,   242,
+     243,   243,   244,   245,   245,   246,   246,   247,   247,   248,
+     248,   248,   249,   249,   250,   250,   251,   251,   252,   252,
+     253,   253,   253,   254,   254,   254,   255,   255,   255,   256,
+     256,   257,   257,   258,   258,   259,   259,   260,   260,   261,
+     261,   262,   262,   263,   263,   264,   264,   265,   265,   266,
+     266,   267,   267,   268,   268,   269,   269,   270,   270,   271,
+     271,   272,   272,   273,   273,   274,   274,   275,   275,   277,
+     289,   290,   291,   291,   291,   291,   291,   292,   294,   306,
+     307,   308,   308,   308,   308,   309,   311,   325,   326,   327,
+     327,   327,   327,   328,   328,   328,   330,   345,   346,   347,
+     347,   347,   347,   348,   348,   350,   359,   368,   379,   388,
+     397,   406,   417,   426,   437,   450,   465,   476,   493,   510,
+     523,   538,   547,   556,   565,   574,   583,   592,   601,   610,
+     619,   628,   637,   646,   655,   664,   673,   682,   691,   700,
+     709,   718,   725,   732,   741,   750,   759,   773,   782,   791,
+     800,   807,   814,   840,   848,   855,   862,   869,   876,   884,
+     892,   900,   907,   918,   925,   934,   943,   952,   959,   966,
+     974,   982,   992,  1001,  1011,  1021,  1034,  1045,  1053,  1066,
+    1075,  1084,  1093,  1103,  1113,  1121,  1134,  1144,  1151,  1159,
+    1168,  1176,  1185,  1193,  1206,  1215,  1222,  1232,  1242,  1252,
+    1262,  1272,  1282,  1292,  1302,  1309,  1316,  1323,  1332,  1341,
+    1350,  1357,  1367,  1384,  1391,  1409,  1422,  1435,  1444,  1453,
+    1462,  1471,  1481,  1491,  1500,  1509,  1522,  1535,  1544,  1551,
+    1560,  1569,  1578,  1587,  1595,  1603,  1611,  1620,  1629,  1642,
+    1650,  1663,  1673,  1701,  1708,  1723,  1733,  1743,  1753,  1763,
+    1773,  1780,  1790,  1800,  1810,  1819,  1828,  1838,  1849,  1858,
+    1865,  1872,  1881,  1895,  1914,  1933,  1945,  1957,  1969,  1980,
+    1999,  2009,  2018,  2026,  2034,  2047,  2060,  2073,  2086,  2095,
+    2104,  2113,  2124,  2135,  2143,  2152,  2162,  2172,  2185,  2198,
+    2209,  2222,  2233,  2246,  2256,  2263,  2270,  2279,  2289,  2299,
+    2309,  2316,  2323,  2332,  2342,  2352,  2359,  2366,  2373,  2383,
+    2393,  2403,  2432,  2442,  2450,  2459,  2474,  2483,  2488,  2489,
+    2490,  2490,  2490,  2491,  2491,  2491,  2492,  2492,  2494,  2504,
+    2513,  2520,  2530,  2537,  2544,  2551,  2558,  2563,  2564,  2565,
+    2565,  2566,  2566,  2567,  2567,  2568,  2569,  2570,  2571,  2572,
+    2573,  2575,  2583,  2590,  2598,  2606,  2613,  2620,  2629,  2638,
+    2647,  2656,  2665,  2674,  2679,  2680,  2681,  2683,  2689,  2699,
+    2706,  2715,  2723,  2729,  2730,  2732,  2732,  2732,  2733,  2733,
+    2734,  2735,  2736,  2737,  2738,  2740,  2750,  2760,  2767,  2776,
+    2783,  2792,  2800,  2813,  2821,  2834,  2839,  2840,  2841,  2841,
+    2843,  2857
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "SPACE", "LETTER", "NEWLINE", "COMMENT",
-  "COLON", "ANY", "ZONESTR", "STRING_ARG", "VAR_SERVER", "VAR_VERBOSITY",
-  "VAR_NUM_THREADS", "VAR_PORT", "VAR_OUTGOING_RANGE", "VAR_INTERFACE",
-  "VAR_DO_IP4", "VAR_DO_IP6", "VAR_PREFER_IP6", "VAR_DO_UDP", "VAR_DO_TCP",
-  "VAR_TCP_MSS", "VAR_OUTGOING_TCP_MSS", "VAR_CHROOT", "VAR_USERNAME",
-  "VAR_DIRECTORY", "VAR_LOGFILE", "VAR_PIDFILE", "VAR_MSG_CACHE_SIZE",
+  "\"end of file\"", "error", "\"invalid token\"", "SPACE", "LETTER",
+  "NEWLINE", "COMMENT", "COLON", "ANY", "ZONESTR", "STRING_ARG",
+  "VAR_SERVER", "VAR_VERBOSITY", "VAR_NUM_THREADS", "VAR_PORT",
+  "VAR_OUTGOING_RANGE", "VAR_INTERFACE", "VAR_DO_IP4", "VAR_DO_IP6",
+  "VAR_PREFER_IP6", "VAR_DO_UDP", "VAR_DO_TCP", "VAR_TCP_MSS",
+  "VAR_OUTGOING_TCP_MSS", "VAR_CHROOT", "VAR_USERNAME", "VAR_DIRECTORY",
+  "VAR_LOGFILE", "VAR_PIDFILE", "VAR_MSG_CACHE_SIZE",
   "VAR_MSG_CACHE_SLABS", "VAR_NUM_QUERIES_PER_THREAD",
   "VAR_RRSET_CACHE_SIZE", "VAR_RRSET_CACHE_SLABS", "VAR_OUTGOING_NUM_TCP",
   "VAR_INFRA_HOST_TTL", "VAR_INFRA_LAME_TTL", "VAR_INFRA_CACHE_SLABS",
@@ -1071,12 +1233,25 @@ static const char *const yytname[] =
   "VAR_CACHEDB", "VAR_CACHEDB_BACKEND", "VAR_CACHEDB_SECRETSEED",
   "VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM", "VAR_FOR_UPSTREAM",
   "VAR_AUTH_ZONE", "VAR_ZONEFILE", "VAR_MASTER", "VAR_URL",
-  "VAR_FOR_DOWNSTREAM", "$accept", "toplevelvars", "toplevelvar",
-  "serverstart", "contents_server", "content_server", "stubstart",
-  "contents_stub", "content_stub", "forwardstart", "contents_forward",
-  "content_forward", "viewstart", "contents_view", "content_view",
-  "authstart", "contents_auth", "content_auth", "server_num_threads",
-  "server_verbosity", "server_statistics_interval",
+  "VAR_FOR_DOWNSTREAM", "VAR_UDP_BATCH_SIZE", "VAR_CACHE_CLOCK_EVICTION",
+  "VAR_CACHE_SNAPSHOT_FILE", "VAR_WIRE_CACHE_SIZE",
+  "VAR_INCOMING_TCP_PIPELINE", "VAR_INCOMING_TCP_PIPELINE_TOTAL",
+  "VAR_TCP_REUSE_TIMEOUT", "VAR_MAX_REUSE_TCP_QUERIES",
+  "VAR_COMPRESSION_HASH", "VAR_SO_REUSEPORT_CBPF", "VAR_CPU_AFFINITY",
+  "VAR_CPU_AFFINITY_LIST", "VAR_INFLIGHT_DEDUP", "VAR_JOSTLE_ADAPTIVE",
+  "VAR_OUTGOING_BATCH", "VAR_OUTGOING_PORT_POOL",
+  "VAR_OUTGOING_PORT_POOL_USES", "VAR_INFRA_CACHE_SERVER_SHARED",
+  "VAR_IP_RATELIMIT_BURST", "VAR_RATELIMIT_BURST",
+  "VAR_IP_RATELIMIT_IPV4_PREFIX", "VAR_IP_RATELIMIT_IPV6_PREFIX",
+  "VAR_IP_RATELIMIT_EXEMPT", "VAR_SERVER_SELECTION_PERCENTILE",
+  "VAR_TARGET_FETCH_FANOUT", "VAR_SIG_CACHE_SIZE", "VAR_CRYPTO_THREADS",
+  "VAR_NSEC3_CACHE_SIZE", "VAR_VAL_NSEC3_MAX_ITERATIONS",
+  "VAR_NEG_CACHE_SLABS", "VAR_AGGRESSIVE_NSEC", "$accept", "toplevelvars",
+  "toplevelvar", "serverstart", "contents_server", "content_server",
+  "stubstart", "contents_stub", "content_stub", "forwardstart",
+  "contents_forward", "content_forward", "viewstart", "contents_view",
+  "content_view", "authstart", "contents_auth", "content_auth",
+  "server_num_threads", "server_verbosity", "server_statistics_interval",
   "server_statistics_cumulative", "server_extended_statistics",
   "server_shm_enable", "server_shm_key", "server_port",
   "server_send_client_subnet", "server_client_subnet_zone",
@@ -1085,6 +1260,8 @@ static const char *const yytname[] =
   "server_interface", "server_outgoing_interface", "server_outgoing_range",
   "server_outgoing_port_permit", "server_outgoing_port_avoid",
   "server_outgoing_num_tcp", "server_incoming_num_tcp",
+  "server_incoming_tcp_pipeline", "server_incoming_tcp_pipeline_total",
+  "server_tcp_reuse_timeout", "server_max_reuse_tcp_queries",
   "server_interface_automatic", "server_do_ip4", "server_do_ip6",
   "server_do_udp", "server_do_tcp", "server_prefer_ip6", "server_tcp_mss",
   "server_outgoing_tcp_mss", "server_tcp_upstream",
@@ -1100,12 +1277,14 @@ static const char *const yytname[] =
   "server_domain_insecure", "server_hide_identity", "server_hide_version",
   "server_hide_trustanchor", "server_identity", "server_version",
   "server_so_rcvbuf", "server_so_sndbuf", "server_so_reuseport",
-  "server_ip_transparent", "server_ip_freebind", "server_edns_buffer_size",
-  "server_msg_buffer_size", "server_msg_cache_size",
-  "server_msg_cache_slabs", "server_num_queries_per_thread",
-  "server_jostle_timeout", "server_delay_close",
-  "server_unblock_lan_zones", "server_insecure_lan_zones",
-  "server_rrset_cache_size", "server_rrset_cache_slabs",
+  "server_udp_batch_size", "server_ip_transparent", "server_ip_freebind",
+  "server_edns_buffer_size", "server_msg_buffer_size",
+  "server_msg_cache_size", "server_msg_cache_slabs",
+  "server_num_queries_per_thread", "server_jostle_timeout",
+  "server_delay_close", "server_unblock_lan_zones",
+  "server_insecure_lan_zones", "server_rrset_cache_size",
+  "server_rrset_cache_slabs", "server_cache_clock_eviction",
+  "server_cache_snapshot_file", "server_wire_cache_size",
   "server_infra_host_ttl", "server_infra_lame_ttl",
   "server_infra_cache_numhosts", "server_infra_cache_lame_size",
   "server_infra_cache_slabs", "server_infra_cache_min_rtt",
@@ -1127,17 +1306,29 @@ static const char *const yytname[] =
   "server_val_log_level", "server_val_nsec3_keysize_iterations",
   "server_add_holddown", "server_del_holddown", "server_keep_missing",
   "server_permit_small_holddown", "server_key_cache_size",
-  "server_key_cache_slabs", "server_neg_cache_size", "server_local_zone",
+  "server_sig_cache_size", "server_nsec3_cache_size",
+  "server_val_nsec3_max_iterations", "server_crypto_threads",
+  "server_key_cache_slabs", "server_neg_cache_size",
+  "server_neg_cache_slabs", "server_aggressive_nsec", "server_local_zone",
   "server_local_data", "server_local_data_ptr", "server_minimal_responses",
-  "server_rrset_roundrobin", "server_max_udp_size", "server_dns64_prefix",
-  "server_dns64_synthall", "server_define_tag", "server_local_zone_tag",
-  "server_access_control_tag", "server_access_control_tag_action",
-  "server_access_control_tag_data", "server_local_zone_override",
-  "server_access_control_view", "server_response_ip_tag",
-  "server_ip_ratelimit", "server_ratelimit", "server_ip_ratelimit_size",
-  "server_ratelimit_size", "server_ip_ratelimit_slabs",
-  "server_ratelimit_slabs", "server_ratelimit_for_domain",
-  "server_ratelimit_below_domain", "server_ip_ratelimit_factor",
+  "server_rrset_roundrobin", "server_compression_hash",
+  "server_so_reuseport_cbpf", "server_cpu_affinity",
+  "server_cpu_affinity_list", "server_inflight_dedup",
+  "server_jostle_adaptive", "server_outgoing_batch",
+  "server_outgoing_port_pool", "server_outgoing_port_pool_uses",
+  "server_infra_cache_server_shared", "server_server_selection_percentile",
+  "server_target_fetch_fanout", "server_max_udp_size",
+  "server_dns64_prefix", "server_dns64_synthall", "server_define_tag",
+  "server_local_zone_tag", "server_access_control_tag",
+  "server_access_control_tag_action", "server_access_control_tag_data",
+  "server_local_zone_override", "server_access_control_view",
+  "server_response_ip_tag", "server_ip_ratelimit", "server_ratelimit",
+  "server_ip_ratelimit_size", "server_ratelimit_size",
+  "server_ip_ratelimit_slabs", "server_ratelimit_slabs",
+  "server_ratelimit_for_domain", "server_ratelimit_below_domain",
+  "server_ip_ratelimit_factor", "server_ip_ratelimit_burst",
+  "server_ratelimit_burst", "server_ip_ratelimit_ipv4_prefix",
+  "server_ip_ratelimit_ipv6_prefix", "server_ip_ratelimit_exempt",
   "server_ratelimit_factor", "server_qname_minimisation",
   "server_qname_minimisation_strict", "server_ipsecmod_enabled",
   "server_ipsecmod_ignore_bogus", "server_ipsecmod_hook",
@@ -1173,136 +1364,119 @@ static const char *const yytname[] =
   "cachedbstart", "contents_cachedb", "content_cachedb",
   "cachedb_backend_name", "cachedb_secret_seed", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -215
+#define YYPACT_NINF (-195)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-215)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -1
+#define YYTABLE_NINF (-1)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -215,     0,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,   215,   -37,   -33,   -38,   -39,   -63,
-    -129,  -104,  -157,  -214,     2,     3,     4,    27,    30,    32,
-      33,    34,    35,    36,    48,    49,    50,    51,    52,    54,
-      55,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    82,    83,    84,    85,    87,
-      90,    92,    93,    94,    95,    96,    98,    99,   100,   101,
-     102,   103,   104,   105,   106,   107,   108,   109,   110,   113,
-     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
-     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
-     134,   136,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   147,   148,   149,   150,   151,   152,   153,   154,   155,
-     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
-     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
-     177,   183,   184,   185,   186,   187,   188,   189,   190,   191,
-     192,   193,   195,   196,   197,   198,   199,   200,   201,   202,
-     203,   204,   205,   206,   207,   208,   209,   210,   212,   213,
-     214,   245,   246,   247,   248,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,   252,   253,   254,
-     296,   297,   298,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-     299,   300,   301,   302,   303,  -215,  -215,  -215,  -215,  -215,
-    -215,   304,   308,   312,   313,   337,   338,   339,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,   340,   350,   351,   352,
-     353,   354,  -215,  -215,  -215,  -215,  -215,  -215,  -215,   355,
-     356,   357,   358,   359,   360,   361,   362,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,   397,   399,   409,   410,
-     411,   412,   413,   414,   415,   416,   417,   418,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,   419,  -215,  -215,   426,   427,   428,   430,   431,   432,
-     433,   434,   435,   436,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,   437,   438,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,   439,   440,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-     441,   442,   443,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,   444,   445,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,   446,
-     447,   448,   449,   450,   451,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,   452,  -215,  -215,   453,   454,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,   455,   456,   457,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215
+    -195,   250,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,   -12,   152,   161,   175,    39,   185,
+     -13,   -78,    93,  -194,    21,    25,    26,    27,    70,    71,
+      72,    73,    74,    75,    76,    77,    81,    85,    86,   110,
+     111,   112,   113,   135,   170,   172,   183,   186,   187,   188,
+     189,   190,   192,   201,   203,   204,   206,   207,   208,   243,
+     244,   246,   247,   248,   249,   252,   253,   255,   260,   261,
+     262,   263,   264,   265,   276,   278,   279,   280,   282,   284,
+     286,   298,   299,   300,   301,   302,   303,   304,   305,   306,
+     307,   308,   309,   310,   311,   312,   313,   314,   315,   316,
+     317,   318,   319,   320,   321,   322,   323,   326,   327,   328,
+     329,   330,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   348,   349,   350,
+     351,   352,   353,   354,   355,   356,   357,   358,   360,   361,
+     362,   363,   364,   365,   366,   367,   368,   369,   370,   371,
+     372,   373,   374,   375,   376,   377,   378,   379,   380,   381,
+     382,   383,   384,   386,   387,   388,   389,   390,   391,   392,
+     393,   394,   395,   396,   397,   398,   399,   400,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+     413,   414,   415,   416,   417,   418,   419,   420,   421,   422,
+     423,   424,   425,   426,   427,   428,   429,   430,   431,   433,
+     434,   435,   436,   437,   438,   439,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,   440,
+     441,   442,   443,   445,   446,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,   447,   448,   449,   450,   451,  -195,  -195,  -195,
+    -195,  -195,  -195,   452,   453,   454,   455,   456,   457,   458,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,   459,   460,
+     462,   463,   464,   465,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,   467,   468,   469,   470,   471,   472,   473,   474,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,   475,   476,
+     477,   478,   479,   480,   481,   482,   483,   484,   485,   486,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,   487,  -195,  -195,   488,   489,   490,   491,
+     492,   493,   494,   495,   496,   497,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,   498,   499,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,   500,   501,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,   502,   503,   504,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,   505,   506,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,   507,   508,   509,   510,   511,   512,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,   513,  -195,  -195,   514,
+     515,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+     516,   517,   518,  -195,  -195,  -195,  -195,  -195,  -195,  -195
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
 {
-       2,     0,     1,    14,   178,   187,   395,   441,   414,   195,
-     450,   473,   205,     3,    16,   180,   189,   197,   207,   397,
-     416,   443,   452,   475,     4,     5,     6,    10,    13,     8,
+       2,     0,     1,    14,   209,   218,   457,   503,   476,   226,
+     512,   535,   236,     3,    16,   211,   220,   228,   238,   459,
+     478,   505,   514,   537,     4,     5,     6,    10,    13,     8,
        9,     7,    11,    12,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -1319,236 +1493,263 @@ static const yytype_uint16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    15,    17,    18,    77,    80,
-      89,   166,   167,    19,   139,   140,   141,   142,   143,   144,
-      28,    68,    20,    81,    82,    39,    61,    76,    21,    22,
-      24,    25,    23,    26,    27,   112,   177,   113,   114,   115,
-     116,   162,    78,    67,    93,   110,   111,    29,    30,    31,
-      32,    33,    69,    83,    84,    99,    55,    65,    56,   170,
-      94,    49,    50,   169,    51,    52,   103,   107,   120,   128,
-     149,   104,    62,    34,    35,    36,    91,   121,   122,   123,
-      37,    38,    40,    41,    43,    44,    42,   126,    45,    46,
-      47,    53,    72,   108,    86,   127,    79,   145,    87,    88,
-     105,   106,    92,    48,    70,    73,    54,    57,    95,    96,
-      71,   146,    97,    58,    59,    60,   109,   159,   160,   168,
-      98,    66,   100,   101,   102,   147,    63,    64,    85,    74,
-      75,    90,   117,   118,   119,   124,   125,   150,   151,   153,
-     155,   156,   154,   157,   163,   129,   130,   133,   134,   131,
-     132,   135,   136,   138,   137,   148,   158,   171,   173,   172,
-     174,   175,   176,   152,   161,   164,   165,     0,     0,     0,
-       0,     0,     0,   179,   181,   182,   183,   185,   186,   184,
-       0,     0,     0,     0,     0,   188,   190,   191,   192,   193,
-     194,     0,     0,     0,     0,     0,     0,     0,   196,   198,
-     199,   202,   203,   200,   204,   201,     0,     0,     0,     0,
-       0,     0,   206,   208,   209,   210,   211,   212,   213,     0,
-       0,     0,     0,     0,     0,     0,     0,   396,   398,   400,
-     399,   405,   401,   402,   403,   404,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   415,   417,
-     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
-     428,     0,   442,   444,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   451,   453,   454,   455,   457,   458,
-     456,   459,   460,   461,   462,     0,     0,   474,   476,   477,
-     215,   214,   221,   230,   228,   236,   237,   240,   238,   239,
-     241,   242,   255,   256,   257,   258,   259,   281,   282,   283,
-     288,   289,   233,   290,   291,   294,   292,   293,   296,   297,
-     298,   311,   269,   270,   272,   273,   299,   314,   264,   266,
-     315,   321,   322,   323,   234,   280,   334,   335,   265,   329,
-     251,   229,   260,   312,   318,   300,     0,     0,   338,   235,
-     216,   250,   304,   217,   231,   232,   261,   262,   336,   302,
-     306,   307,   218,   339,   284,   310,   252,   268,   316,   317,
-     320,   328,   263,   332,   330,   331,   274,   279,   308,   309,
-     275,   276,   301,   324,   253,   254,   243,   245,   246,   247,
-     248,   340,   341,   342,   285,   286,   287,   295,   343,   344,
-       0,     0,     0,   303,   277,   446,   353,   357,   355,   354,
-     358,   356,     0,     0,   361,   362,   222,   223,   224,   225,
-     226,   227,   305,   319,   333,   363,   364,   278,   345,     0,
-       0,     0,     0,     0,     0,   325,   326,   327,   447,   271,
-     267,   249,   219,   220,   365,   367,   366,   368,   369,   370,
-     244,   371,   372,   373,   376,   375,   374,   377,   378,   379,
-     380,   381,   388,     0,   392,   393,     0,     0,   394,   382,
-     387,   383,   384,   385,   386,   406,   408,   407,   410,   411,
-     412,   413,   409,   429,   430,   431,   432,   433,   434,   435,
-     436,   437,   438,   439,   440,   445,   463,   464,   465,   468,
-     466,   467,   469,   470,   471,   472,   478,   479,   313,   337,
-     352,   448,   449,   359,   360,   346,   347,     0,     0,     0,
-     351,   389,   390,   391,   350,   348,   349
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    15,    17,    18,    77,
+      80,    89,   166,   167,    19,   139,   140,   141,   142,   143,
+     144,    28,    68,    20,    81,    82,    39,    61,   182,   183,
+     184,   185,    76,    21,    22,    24,    25,    23,    26,    27,
+     112,   177,   113,   114,   115,   116,   162,    78,    67,    93,
+     110,   111,    29,    30,    31,    32,    33,    69,    83,    84,
+      99,    55,    65,    56,   170,    94,    49,    50,   169,    51,
+      52,   103,   107,   120,   178,   128,   149,   104,    62,    34,
+      35,    36,    91,   121,   122,   123,    37,    38,   179,   180,
+     181,    40,    41,    43,    44,    42,   126,    45,    46,    47,
+      53,    72,   108,    86,   127,    79,   145,    87,    88,   105,
+     106,    92,    48,    70,    73,    54,    57,    95,    96,    71,
+     146,    97,    58,    59,    60,   109,   159,   160,   168,    98,
+      66,   100,   101,   102,   147,    63,   203,   205,   206,   204,
+      64,    85,   207,   208,    74,    75,    90,   117,   118,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   201,
+     202,   119,   124,   125,   150,   151,   153,   155,   156,   154,
+     157,   163,   129,   130,   133,   134,   131,   132,   135,   136,
+     138,   196,   197,   198,   199,   200,   137,   148,   158,   171,
+     173,   172,   174,   175,   176,   152,   161,   164,   165,     0,
+       0,     0,     0,     0,     0,   210,   212,   213,   214,   216,
+     217,   215,     0,     0,     0,     0,     0,   219,   221,   222,
+     223,   224,   225,     0,     0,     0,     0,     0,     0,     0,
+     227,   229,   230,   233,   234,   231,   235,   232,     0,     0,
+       0,     0,     0,     0,   237,   239,   240,   241,   242,   243,
+     244,     0,     0,     0,     0,     0,     0,     0,     0,   458,
+     460,   462,   461,   467,   463,   464,   465,   466,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     477,   479,   480,   481,   482,   483,   484,   485,   486,   487,
+     488,   489,   490,     0,   504,   506,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   513,   515,   516,   517,
+     519,   520,   518,   521,   522,   523,   524,     0,     0,   536,
+     538,   539,   246,   245,   252,   261,   259,   271,   272,   275,
+     273,   274,   276,   277,   290,   291,   292,   293,   294,   317,
+     318,   319,   324,   325,   264,   329,   330,   333,   331,   332,
+     335,   336,   337,   350,   304,   305,   307,   308,   338,   353,
+     299,   301,   354,   360,   361,   362,   265,   316,   373,   378,
+     300,   368,   286,   260,   295,   351,   357,   339,     0,     0,
+     383,   270,   247,   285,   343,   248,   262,   263,   296,   297,
+     379,   341,   345,   346,   249,   384,   320,   349,   287,   303,
+     355,   356,   359,   367,   298,   371,   369,   370,   309,   315,
+     347,   348,   310,   311,   340,   363,   288,   289,   278,   280,
+     281,   282,   283,   385,   386,   399,   321,   322,   323,   334,
+     400,   401,     0,     0,     0,   342,   313,   508,   410,   414,
+     412,   411,   415,   413,     0,     0,   418,   424,   253,   254,
+     255,   256,   257,   258,   344,   358,   372,   425,   426,   314,
+     402,     0,     0,     0,     0,     0,     0,   364,   365,   366,
+     509,   306,   302,   284,   250,   251,   427,   429,   428,   430,
+     431,   432,   279,   312,   326,   327,   328,   266,   267,   268,
+     269,   387,   388,   389,   390,   391,   392,   393,   394,   395,
+     396,   419,   420,   421,   422,   423,   397,   398,   374,   377,
+     375,   376,   380,   381,   433,   434,   435,   438,   437,   436,
+     439,   440,   441,   442,   443,   450,     0,   454,   455,     0,
+       0,   456,   444,   449,   445,   446,   447,   448,   468,   470,
+     469,   472,   473,   474,   475,   471,   491,   492,   493,   494,
+     495,   496,   497,   498,   499,   500,   501,   502,   507,   525,
+     526,   527,   530,   528,   529,   531,   532,   533,   534,   540,
+     541,   352,   382,   409,   510,   511,   416,   417,   403,   404,
+       0,     0,     0,   408,   451,   452,   453,   407,   405,   406
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,  -215,
-    -215
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
+    -195,  -195
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,    13,    14,    24,   195,    15,    25,   363,    16,
-      26,   375,    17,    27,   388,    18,    28,   402,   196,   197,
-     198,   199,   200,   201,   202,   203,   204,   205,   206,   207,
-     208,   209,   210,   211,   212,   213,   214,   215,   216,   217,
-     218,   219,   220,   221,   222,   223,   224,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
-     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
-     268,   269,   270,   271,   272,   273,   274,   275,   276,   277,
-     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
-     288,   289,   290,   291,   292,   293,   294,   295,   296,   297,
-     298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
-     308,   309,   310,   311,   312,   313,   314,   315,   316,   317,
-     318,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-     328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
-     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
-     348,   349,   350,   351,   352,   364,   365,   366,   367,   368,
-     369,   376,   377,   378,   379,   380,   403,   404,   405,   406,
-     407,   408,   389,   390,   391,   392,   393,   394,   395,    19,
-      29,   417,   418,   419,   420,   421,   422,   423,   424,   425,
-      20,    30,   438,   439,   440,   441,   442,   443,   444,   445,
-     446,   447,   448,   449,   450,    21,    31,   452,   453,   353,
-     354,   355,   356,    22,    32,   464,   465,   466,   467,   468,
-     469,   470,   471,   472,   473,   474,    23,    33,   477,   478,
-     479
+       0,     1,    13,    14,    24,   226,    15,    25,   425,    16,
+      26,   437,    17,    27,   450,    18,    28,   464,   227,   228,
+     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   266,   267,   268,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,   290,   291,   292,   293,   294,   295,   296,   297,   298,
+     299,   300,   301,   302,   303,   304,   305,   306,   307,   308,
+     309,   310,   311,   312,   313,   314,   315,   316,   317,   318,
+     319,   320,   321,   322,   323,   324,   325,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,   358,
+     359,   360,   361,   362,   363,   364,   365,   366,   367,   368,
+     369,   370,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   380,   381,   382,   383,   384,   385,   386,   387,   388,
+     389,   390,   391,   392,   393,   394,   395,   396,   397,   398,
+     399,   400,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   426,   427,   428,   429,
+     430,   431,   438,   439,   440,   441,   442,   465,   466,   467,
+     468,   469,   470,   451,   452,   453,   454,   455,   456,   457,
+      19,    29,   479,   480,   481,   482,   483,   484,   485,   486,
+     487,    20,    30,   500,   501,   502,   503,   504,   505,   506,
+     507,   508,   509,   510,   511,   512,    21,    31,   514,   515,
+     415,   416,   417,   418,    22,    32,   526,   527,   528,   529,
+     530,   531,   532,   533,   534,   535,   536,    23,    33,   539,
+     540,   541
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
-static const yytype_uint16 yytable[] =
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
 {
-       2,   396,   381,   357,   451,   358,   359,   370,   475,   476,
-       0,     3,   480,   481,   482,   371,   372,   426,   427,   428,
-     429,   430,   431,   432,   433,   434,   435,   436,   437,   409,
-     410,   411,   412,   413,   414,   415,   416,   483,   382,   383,
-     484,     4,   485,   486,   487,   488,   489,     5,   454,   455,
-     456,   457,   458,   459,   460,   461,   462,   463,   490,   491,
-     492,   493,   494,   384,   495,   496,   360,   497,   498,   499,
-     500,   501,   502,   503,   504,   505,   506,   507,   508,   509,
-     510,   511,   512,   513,   514,   515,   516,   517,   518,   519,
-     520,     6,   521,   522,   523,   524,   361,   525,   362,   373,
-     526,   374,   527,   528,   529,   530,   531,     7,   532,   533,
-     534,   535,   536,   537,   538,   539,   540,   541,   542,   543,
-     544,   385,   386,   545,   546,   547,   548,   549,   550,   551,
-     552,   553,   554,   555,   556,   557,   558,   559,   560,   561,
-     562,   563,   564,   565,   566,     8,   567,   568,   569,   570,
-     571,   572,   573,   574,   575,   576,   387,   577,   578,   579,
-     580,   581,   582,   583,   584,   585,   586,   587,   588,   589,
-     590,   591,   592,   593,   594,   595,   596,   597,   598,   599,
-     600,   601,   602,   603,   604,   605,   397,   606,   398,   399,
-     400,   401,     9,   607,   608,   609,   610,   611,   612,   613,
-     614,   615,   616,   617,    10,   618,   619,   620,   621,   622,
-     623,   624,   625,   626,   627,   628,   629,   630,   631,   632,
-     633,    11,   634,   635,   636,     0,    12,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,   637,   638,   639,   640,    62,
-      63,    64,   641,   642,   643,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
-     100,   101,   102,   103,   104,   105,   644,   645,   646,   647,
-     648,   649,   650,   651,   652,   106,   107,   108,   653,   109,
-     110,   111,   654,   655,   112,   113,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
-     128,   129,   130,   131,   132,   133,   134,   656,   657,   658,
-     659,   135,   136,   137,   138,   139,   140,   141,   142,   143,
-     660,   661,   662,   663,   664,   665,   666,   667,   668,   669,
-     670,   671,   672,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
-     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
-     171,   172,   173,   174,   175,   176,   177,   673,   178,   674,
-     179,   180,   181,   182,   183,   184,   185,   186,   187,   675,
-     676,   677,   678,   679,   680,   681,   682,   683,   684,   685,
-     188,   189,   190,   191,   192,   193,   686,   687,   688,   194,
-     689,   690,   691,   692,   693,   694,   695,   696,   697,   698,
-     699,   700,   701,   702,   703,   704,   705,   706,   707,   708,
-     709,   710,   711,   712,   713,   714,   715,   716
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,   537,   538,
+     513,   542,    62,    63,    64,   543,   544,   545,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   458,
+     546,   547,   548,   549,   550,   551,   552,   553,   106,   107,
+     108,   554,   109,   110,   111,   555,   556,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     557,   558,   559,   560,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   488,   489,   490,   491,   492,   493,   494,
+     495,   496,   497,   498,   499,   561,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
+     562,   178,   563,   179,   180,   181,   182,   183,   184,   185,
+     186,   187,   419,   564,   420,   421,   565,   566,   567,   568,
+     569,   432,   570,   188,   189,   190,   191,   192,   193,   433,
+     434,   571,   194,   572,   573,   443,   574,   575,   576,   195,
+     196,   197,   198,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,   224,   225,
+       2,   444,   445,   577,   578,   422,   579,   580,   581,   582,
+       0,     3,   583,   584,   459,   585,   460,   461,   462,   463,
+     586,   587,   588,   589,   590,   591,   446,   471,   472,   473,
+     474,   475,   476,   477,   478,   423,   592,   424,   593,   594,
+     595,     4,   596,   435,   597,   436,   598,     5,   516,   517,
+     518,   519,   520,   521,   522,   523,   524,   525,   599,   600,
+     601,   602,   603,   604,   605,   606,   607,   608,   609,   610,
+     611,   612,   613,   614,   615,   616,   617,   618,   619,   620,
+     621,   622,   623,   624,   447,   448,   625,   626,   627,   628,
+     629,     6,   630,   631,   632,   633,   634,   635,   636,   637,
+     638,   639,   640,   641,   642,   643,   644,     7,   645,   646,
+     647,   648,   649,   650,   651,   652,   653,   654,   655,   449,
+     656,   657,   658,   659,   660,   661,   662,   663,   664,   665,
+     666,   667,   668,   669,   670,   671,   672,   673,   674,   675,
+     676,   677,   678,   679,   680,     8,   681,   682,   683,   684,
+     685,   686,   687,   688,   689,   690,   691,   692,   693,   694,
+     695,   696,   697,   698,   699,   700,   701,   702,   703,   704,
+     705,   706,   707,   708,   709,   710,   711,   712,   713,   714,
+     715,   716,   717,   718,   719,   720,   721,   722,   723,   724,
+     725,   726,     9,   727,   728,   729,   730,   731,   732,   733,
+     734,   735,   736,   737,    10,   738,   739,   740,   741,   742,
+     743,   744,   745,   746,   747,   748,   749,   750,   751,   752,
+     753,    11,   754,   755,   756,   757,    12,   758,   759,   760,
+     761,   762,   763,   764,   765,   766,   767,   768,   769,   770,
+     771,   772,   773,   774,   775,   776,   777,   778,   779,   780,
+     781,   782,   783,   784,   785,   786,   787,   788,   789,   790,
+     791,   792,   793,   794,   795,   796,   797,   798,   799,   800,
+     801,   802,   803,   804,   805,   806,   807,   808,   809
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,    40,    40,    40,   108,    42,    43,    40,   222,   223,
-      -1,    11,    10,    10,    10,    48,    49,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,    92,
-      93,    94,    95,    96,    97,    98,    99,    10,    76,    77,
-      10,    41,    10,    10,    10,    10,    10,    47,   205,   206,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,   222,   223,
+     108,    10,    44,    45,    46,    10,    10,    10,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    40,
+      10,    10,    10,    10,    10,    10,    10,    10,   100,   101,
+     102,    10,   104,   105,   106,    10,    10,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+      10,    10,    10,    10,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,    10,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+      10,   193,    10,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,    40,    10,    42,    43,    10,    10,    10,    10,
+      10,    40,    10,   215,   216,   217,   218,   219,   220,    48,
+      49,    10,   224,    10,    10,    40,    10,    10,    10,   231,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+       0,    76,    77,    10,    10,   103,    10,    10,    10,    10,
+      -1,    11,    10,    10,   225,    10,   227,   228,   229,   230,
+      10,    10,    10,    10,    10,    10,   101,    92,    93,    94,
+      95,    96,    97,    98,    99,   133,    10,   135,    10,    10,
+      10,    41,    10,   132,    10,   134,    10,    47,   205,   206,
      207,   208,   209,   210,   211,   212,   213,   214,    10,    10,
-      10,    10,    10,   101,    10,    10,   103,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    91,    10,    10,    10,    10,   133,    10,   135,   132,
-      10,   134,    10,    10,    10,    10,    10,   107,    10,    10,
+      10,    10,    10,    10,   159,   160,    10,    10,    10,    10,
+      10,    91,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,   107,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,   194,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,   159,   160,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,   145,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,   194,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,   225,    10,   227,   228,
-     229,   230,   192,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,   192,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,   204,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,   221,    10,    10,    10,    -1,   226,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    10,    10,    10,    10,    44,
-      45,    46,    10,    10,    10,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,   100,   101,   102,    10,   104,
-     105,   106,    10,    10,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,    10,    10,    10,
-      10,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+      10,   221,    10,    10,    10,    10,   226,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,   158,   159,   160,   161,   162,   163,   164,
-     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
-     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
-     185,   186,   187,   188,   189,   190,   191,    10,   193,    10,
-     195,   196,   197,   198,   199,   200,   201,   202,   203,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-     215,   216,   217,   218,   219,   220,    10,    10,    10,   224,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10
+      10,    10,    10,    10,    10,    10,    10,    10,    10
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   232,     0,    11,    41,    47,    91,   107,   145,   192,
-     204,   221,   226,   233,   234,   237,   240,   243,   246,   430,
-     441,   456,   464,   477,   235,   238,   241,   244,   247,   431,
-     442,   457,   465,   478,    12,    13,    14,    15,    16,    17,
+       0,   263,     0,    11,    41,    47,    91,   107,   145,   192,
+     204,   221,   226,   264,   265,   268,   271,   274,   277,   492,
+     503,   518,   526,   539,   266,   269,   272,   275,   278,   493,
+     504,   519,   527,   540,    12,    13,    14,    15,    16,    17,
       18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
       28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
       38,    39,    44,    45,    46,    50,    51,    52,    53,    54,
@@ -1564,10 +1765,10 @@ static const yytype_uint16 yystos[] =
      174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
      184,   185,   186,   187,   188,   189,   190,   191,   193,   195,
      196,   197,   198,   199,   200,   201,   202,   203,   215,   216,
-     217,   218,   219,   220,   224,   236,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
-     263,   264,   265,   266,   267,   268,   269,   270,   271,   272,
-     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
+     217,   218,   219,   220,   224,   231,   232,   233,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,   267,   280,   281,   282,
      283,   284,   285,   286,   287,   288,   289,   290,   291,   292,
      293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
      303,   304,   305,   306,   307,   308,   309,   310,   311,   312,
@@ -1580,19 +1781,27 @@ static const yytype_uint16 yystos[] =
      373,   374,   375,   376,   377,   378,   379,   380,   381,   382,
      383,   384,   385,   386,   387,   388,   389,   390,   391,   392,
      393,   394,   395,   396,   397,   398,   399,   400,   401,   402,
-     403,   404,   405,   460,   461,   462,   463,    40,    42,    43,
-     103,   133,   135,   239,   406,   407,   408,   409,   410,   411,
-      40,    48,    49,   132,   134,   242,   412,   413,   414,   415,
-     416,    40,    76,    77,   101,   159,   160,   194,   245,   423,
-     424,   425,   426,   427,   428,   429,    40,   225,   227,   228,
-     229,   230,   248,   417,   418,   419,   420,   421,   422,    92,
-      93,    94,    95,    96,    97,    98,    99,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   146,   147,   148,   149,
-     150,   151,   152,   153,   154,   155,   156,   157,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   108,   458,   459,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,   466,   467,   468,   469,   470,   471,
-     472,   473,   474,   475,   476,   222,   223,   479,   480,   481,
+     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+     413,   414,   415,   416,   417,   418,   419,   420,   421,   422,
+     423,   424,   425,   426,   427,   428,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   459,   460,   461,   462,
+     463,   464,   465,   466,   467,   522,   523,   524,   525,    40,
+      42,    43,   103,   133,   135,   270,   468,   469,   470,   471,
+     472,   473,    40,    48,    49,   132,   134,   273,   474,   475,
+     476,   477,   478,    40,    76,    77,   101,   159,   160,   194,
+     276,   485,   486,   487,   488,   489,   490,   491,    40,   225,
+     227,   228,   229,   230,   279,   479,   480,   481,   482,   483,
+     484,    92,    93,    94,    95,    96,    97,    98,    99,   494,
+     495,   496,   497,   498,   499,   500,   501,   502,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
+     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
+     515,   516,   517,   108,   520,   521,   205,   206,   207,   208,
+     209,   210,   211,   212,   213,   214,   528,   529,   530,   531,
+     532,   533,   534,   535,   536,   537,   538,   222,   223,   541,
+     542,   543,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
@@ -1616,37 +1825,38 @@ static const yytype_uint16 yystos[] =
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
 {
-       0,   231,   232,   232,   233,   233,   233,   233,   233,   233,
-     233,   233,   233,   233,   234,   235,   235,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   237,   238,
-     238,   239,   239,   239,   239,   239,   239,   240,   241,   241,
-     242,   242,   242,   242,   242,   243,   244,   244,   245,   245,
-     245,   245,   245,   245,   245,   246,   247,   247,   248,   248,
-     248,   248,   248,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+       0,   262,   263,   263,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   265,   266,   266,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   268,
+     269,   269,   270,   270,   270,   270,   270,   270,   271,   272,
+     272,   273,   273,   273,   273,   273,   274,   275,   275,   276,
+     276,   276,   276,   276,   276,   276,   277,   278,   278,   279,
+     279,   279,   279,   279,   279,   280,   281,   282,   283,   284,
      285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
      295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
      305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
@@ -1661,19 +1871,26 @@ static const yytype_uint16 yyr1[] =
      395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
      405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
      415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   431,   432,   432,
-     432,   432,   432,   432,   432,   432,   433,   434,   435,   436,
-     437,   438,   439,   440,   441,   442,   442,   443,   443,   443,
-     443,   443,   443,   443,   443,   443,   443,   443,   443,   444,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
      445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   457,   458,   459,   460,   461,   462,   463,
-     464,   465,   465,   466,   466,   466,   466,   466,   466,   466,
-     466,   466,   466,   467,   468,   469,   470,   471,   472,   473,
-     474,   475,   476,   477,   478,   478,   479,   479,   480,   481
+     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
+     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
+     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
+     485,   486,   487,   488,   489,   490,   491,   492,   493,   493,
+     494,   494,   494,   494,   494,   494,   494,   494,   495,   496,
+     497,   498,   499,   500,   501,   502,   503,   504,   504,   505,
+     505,   505,   505,   505,   505,   505,   505,   505,   505,   505,
+     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
+     515,   516,   517,   518,   519,   519,   520,   521,   522,   523,
+     524,   525,   526,   527,   527,   528,   528,   528,   528,   528,
+     528,   528,   528,   528,   528,   529,   530,   531,   532,   533,
+     534,   535,   536,   537,   538,   539,   540,   540,   541,   541,
+     542,   543
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     1,     2,     0,     1,     1,     1,
@@ -1692,11 +1909,14 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
-       0,     1,     1,     1,     1,     1,     1,     1,     2,     0,
-       1,     1,     1,     1,     1,     1,     2,     0,     1,     1,
-       1,     1,     1,     1,     1,     1,     2,     0,     1,     1,
-       1,     1,     1,     1,     2,     2,     2,     2,     2,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     0,     1,     1,     1,     1,     1,     1,     1,     2,
+       0,     1,     1,     1,     1,     1,     1,     2,     0,     1,
+       1,     1,     1,     1,     1,     1,     1,     2,     0,     1,
+       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1706,59 +1926,63 @@ static const yytype_uint8 yyr2[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     3,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     3,     2,     2,
-       2,     2,     2,     2,     2,     2,     3,     3,     4,     4,
-       4,     3,     3,     2,     2,     2,     2,     2,     2,     3,
-       3,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     3,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     3,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     3,     3,     4,     4,     4,     3,     3,
+       2,     2,     2,     2,     2,     2,     3,     3,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     3,
-       3,     3,     2,     2,     2,     1,     2,     0,     1,     1,
-       1,     1,     1,     1,     1,     1,     2,     2,     2,     2,
-       2,     2,     2,     2,     1,     2,     0,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     1,     2,     0,     1,     2,     2,     2,     3,     3,
-       1,     2,     0,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     1,     2,     0,     1,     1,     2,     2
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     3,     3,     3,     2,     2,     2,     1,     2,     0,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     0,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     1,     2,     0,     1,     2,     2,     2,
+       3,     3,     1,     2,     0,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     1,     2,     0,     1,     1,
+       2,     2
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -1775,55 +1999,52 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1832,7 +2053,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1855,21 +2076,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1884,8 +2105,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1908,249 +2129,30 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
 
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -2159,6 +2161,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -2166,43 +2170,36 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -2210,71 +2207,75 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
-
         yyss = yyss1;
         yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -2282,30 +2283,31 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2316,18 +2318,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2355,15 +2368,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2378,7 +2389,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -2398,17 +2409,17 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 14:
-#line 169 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 14: /* serverstart: VAR_SERVER  */
+#line 184 "./util/configparser.y"
+        { 
 		OUTYY(("\nP(server:)\n")); 
 	}
-#line 2407 "util/configparser.c" /* yacc.c:1646  */
+#line 2418 "util/configparser.c"
     break;
 
-  case 178:
-#line 248 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 209: /* stubstart: VAR_STUB_ZONE  */
+#line 278 "./util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(stub_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2418,12 +2429,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2422 "util/configparser.c" /* yacc.c:1646  */
+#line 2433 "util/configparser.c"
     break;
 
-  case 187:
-#line 265 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 218: /* forwardstart: VAR_FORWARD_ZONE  */
+#line 295 "./util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(forward_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2433,12 +2444,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2437 "util/configparser.c" /* yacc.c:1646  */
+#line 2448 "util/configparser.c"
     break;
 
-  case 195:
-#line 282 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 226: /* viewstart: VAR_VIEW  */
+#line 312 "./util/configparser.y"
+        {
 		struct config_view* s;
 		OUTYY(("\nP(view:)\n")); 
 		s = (struct config_view*)calloc(1, sizeof(struct config_view));
@@ -2450,12 +2461,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2454 "util/configparser.c" /* yacc.c:1646  */
+#line 2465 "util/configparser.c"
     break;
 
-  case 205:
-#line 301 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 236: /* authstart: VAR_AUTH_ZONE  */
+#line 331 "./util/configparser.y"
+        {
 		struct config_auth* s;
 		OUTYY(("\nP(auth_zone:)\n")); 
 		s = (struct config_auth*)calloc(1, sizeof(struct config_auth));
@@ -2468,36 +2479,36 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2472 "util/configparser.c" /* yacc.c:1646  */
+#line 2483 "util/configparser.c"
     break;
 
-  case 214:
-#line 321 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 245: /* server_num_threads: VAR_NUM_THREADS STRING_ARG  */
+#line 351 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_num_threads:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->num_threads = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2484 "util/configparser.c" /* yacc.c:1646  */
+#line 2495 "util/configparser.c"
     break;
 
-  case 215:
-#line 330 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 246: /* server_verbosity: VAR_VERBOSITY STRING_ARG  */
+#line 360 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_verbosity:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->verbosity = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2496 "util/configparser.c" /* yacc.c:1646  */
+#line 2507 "util/configparser.c"
     break;
 
-  case 216:
-#line 339 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 247: /* server_statistics_interval: VAR_STATISTICS_INTERVAL STRING_ARG  */
+#line 369 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_statistics_interval:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
 			cfg_parser->cfg->stat_interval = 0;
@@ -2506,48 +2517,48 @@ yyreduce:
 		else cfg_parser->cfg->stat_interval = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2510 "util/configparser.c" /* yacc.c:1646  */
+#line 2521 "util/configparser.c"
     break;
 
-  case 217:
-#line 350 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 248: /* server_statistics_cumulative: VAR_STATISTICS_CUMULATIVE STRING_ARG  */
+#line 380 "./util/configparser.y"
+        {
 		OUTYY(("P(server_statistics_cumulative:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stat_cumulative = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2522 "util/configparser.c" /* yacc.c:1646  */
+#line 2533 "util/configparser.c"
     break;
 
-  case 218:
-#line 359 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 249: /* server_extended_statistics: VAR_EXTENDED_STATISTICS STRING_ARG  */
+#line 389 "./util/configparser.y"
+        {
 		OUTYY(("P(server_extended_statistics:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stat_extended = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2534 "util/configparser.c" /* yacc.c:1646  */
+#line 2545 "util/configparser.c"
     break;
 
-  case 219:
-#line 368 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 250: /* server_shm_enable: VAR_SHM_ENABLE STRING_ARG  */
+#line 398 "./util/configparser.y"
+        {
 		OUTYY(("P(server_shm_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->shm_enable = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2546 "util/configparser.c" /* yacc.c:1646  */
+#line 2557 "util/configparser.c"
     break;
 
-  case 220:
-#line 377 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 251: /* server_shm_key: VAR_SHM_KEY STRING_ARG  */
+#line 407 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_shm_key:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
 			cfg_parser->cfg->shm_key = 0;
@@ -2556,24 +2567,24 @@ yyreduce:
 		else cfg_parser->cfg->shm_key = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2560 "util/configparser.c" /* yacc.c:1646  */
+#line 2571 "util/configparser.c"
     break;
 
-  case 221:
-#line 388 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 252: /* server_port: VAR_PORT STRING_ARG  */
+#line 418 "./util/configparser.y"
+        {
 		OUTYY(("P(server_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
 		else cfg_parser->cfg->port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2572 "util/configparser.c" /* yacc.c:1646  */
+#line 2583 "util/configparser.c"
     break;
 
-  case 222:
-#line 397 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 253: /* server_send_client_subnet: VAR_SEND_CLIENT_SUBNET STRING_ARG  */
+#line 427 "./util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_send_client_subnet:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->client_subnet, (yyvsp[0].str)))
@@ -2582,12 +2593,12 @@ yyreduce:
 		OUTYY(("P(Compiled without edns subnet option, ignoring)\n"));
 	#endif
 	}
-#line 2586 "util/configparser.c" /* yacc.c:1646  */
+#line 2597 "util/configparser.c"
     break;
 
-  case 223:
-#line 408 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 254: /* server_client_subnet_zone: VAR_CLIENT_SUBNET_ZONE STRING_ARG  */
+#line 438 "./util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_client_subnet_zone:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->client_subnet_zone,
@@ -2597,12 +2608,12 @@ yyreduce:
 		OUTYY(("P(Compiled without edns subnet option, ignoring)\n"));
 	#endif
 	}
-#line 2601 "util/configparser.c" /* yacc.c:1646  */
+#line 2612 "util/configparser.c"
     break;
 
-  case 224:
-#line 421 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 255: /* server_client_subnet_always_forward: VAR_CLIENT_SUBNET_ALWAYS_FORWARD STRING_ARG  */
+#line 451 "./util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_client_subnet_always_forward:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -2615,12 +2626,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2619 "util/configparser.c" /* yacc.c:1646  */
+#line 2630 "util/configparser.c"
     break;
 
-  case 225:
-#line 436 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 256: /* server_client_subnet_opcode: VAR_CLIENT_SUBNET_OPCODE STRING_ARG  */
+#line 466 "./util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(client_subnet_opcode:%s)\n", (yyvsp[0].str)));
 		OUTYY(("P(Deprecated option, ignoring)\n"));
@@ -2629,12 +2640,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2633 "util/configparser.c" /* yacc.c:1646  */
+#line 2644 "util/configparser.c"
     break;
 
-  case 226:
-#line 447 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 257: /* server_max_client_subnet_ipv4: VAR_MAX_CLIENT_SUBNET_IPV4 STRING_ARG  */
+#line 477 "./util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv4:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2649,12 +2660,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2653 "util/configparser.c" /* yacc.c:1646  */
+#line 2664 "util/configparser.c"
     break;
 
-  case 227:
-#line 464 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 258: /* server_max_client_subnet_ipv6: VAR_MAX_CLIENT_SUBNET_IPV6 STRING_ARG  */
+#line 494 "./util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv6:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2669,12 +2680,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2673 "util/configparser.c" /* yacc.c:1646  */
+#line 2684 "util/configparser.c"
     break;
 
-  case 228:
-#line 481 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 259: /* server_interface: VAR_INTERFACE STRING_ARG  */
+#line 511 "./util/configparser.y"
+        {
 		OUTYY(("P(server_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_ifs == 0)
 			cfg_parser->cfg->ifs = calloc(1, sizeof(char*));
@@ -2685,12 +2696,12 @@ yyreduce:
 		else
 			cfg_parser->cfg->ifs[cfg_parser->cfg->num_ifs++] = (yyvsp[0].str);
 	}
-#line 2689 "util/configparser.c" /* yacc.c:1646  */
+#line 2700 "util/configparser.c"
     break;
 
-  case 229:
-#line 494 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 260: /* server_outgoing_interface: VAR_OUTGOING_INTERFACE STRING_ARG  */
+#line 524 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_out_ifs == 0)
 			cfg_parser->cfg->out_ifs = calloc(1, sizeof(char*));
@@ -2703,260 +2714,308 @@ yyreduce:
 			cfg_parser->cfg->out_ifs[
 				cfg_parser->cfg->num_out_ifs++] = (yyvsp[0].str);
 	}
-#line 2707 "util/configparser.c" /* yacc.c:1646  */
+#line 2718 "util/configparser.c"
     break;
 
-  case 230:
-#line 509 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 261: /* server_outgoing_range: VAR_OUTGOING_RANGE STRING_ARG  */
+#line 539 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_range:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_num_ports = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2719 "util/configparser.c" /* yacc.c:1646  */
+#line 2730 "util/configparser.c"
     break;
 
-  case 231:
-#line 518 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 262: /* server_outgoing_port_permit: VAR_OUTGOING_PORT_PERMIT STRING_ARG  */
+#line 548 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_port_permit:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 1, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 2731 "util/configparser.c" /* yacc.c:1646  */
+#line 2742 "util/configparser.c"
     break;
 
-  case 232:
-#line 527 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 263: /* server_outgoing_port_avoid: VAR_OUTGOING_PORT_AVOID STRING_ARG  */
+#line 557 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_port_avoid:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 0, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 2743 "util/configparser.c" /* yacc.c:1646  */
+#line 2754 "util/configparser.c"
     break;
 
-  case 233:
-#line 536 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 264: /* server_outgoing_num_tcp: VAR_OUTGOING_NUM_TCP STRING_ARG  */
+#line 566 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2755 "util/configparser.c" /* yacc.c:1646  */
+#line 2766 "util/configparser.c"
     break;
 
-  case 234:
-#line 545 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 265: /* server_incoming_num_tcp: VAR_INCOMING_NUM_TCP STRING_ARG  */
+#line 575 "./util/configparser.y"
+        {
 		OUTYY(("P(server_incoming_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->incoming_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2767 "util/configparser.c" /* yacc.c:1646  */
+#line 2778 "util/configparser.c"
     break;
 
-  case 235:
-#line 554 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[0].str)));
-		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
-			yyerror("expected yes or no.");
-		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[0].str), "yes")==0);
+  case 266: /* server_incoming_tcp_pipeline: VAR_INCOMING_TCP_PIPELINE STRING_ARG  */
+#line 584 "./util/configparser.y"
+        {
+		OUTYY(("P(server_incoming_tcp_pipeline:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->incoming_tcp_pipeline = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2779 "util/configparser.c" /* yacc.c:1646  */
+#line 2790 "util/configparser.c"
     break;
 
-  case 236:
-#line 563 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[0].str)));
-		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
-			yyerror("expected yes or no.");
-		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
+  case 267: /* server_incoming_tcp_pipeline_total: VAR_INCOMING_TCP_PIPELINE_TOTAL STRING_ARG  */
+#line 593 "./util/configparser.y"
+        {
+		OUTYY(("P(server_incoming_tcp_pipeline_total:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) <= 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->incoming_tcp_pipeline_total = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2791 "util/configparser.c" /* yacc.c:1646  */
+#line 2802 "util/configparser.c"
     break;
 
-  case 237:
-#line 572 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 268: /* server_tcp_reuse_timeout: VAR_TCP_REUSE_TIMEOUT STRING_ARG  */
+#line 602 "./util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_reuse_timeout:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_reuse_timeout = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2814 "util/configparser.c"
+    break;
+
+  case 269: /* server_max_reuse_tcp_queries: VAR_MAX_REUSE_TCP_QUERIES STRING_ARG  */
+#line 611 "./util/configparser.y"
+        {
+		OUTYY(("P(server_max_reuse_tcp_queries:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) <= 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->max_reuse_tcp_queries = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2826 "util/configparser.c"
+    break;
+
+  case 270: /* server_interface_automatic: VAR_INTERFACE_AUTOMATIC STRING_ARG  */
+#line 620 "./util/configparser.y"
+        {
+		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2838 "util/configparser.c"
+    break;
+
+  case 271: /* server_do_ip4: VAR_DO_IP4 STRING_ARG  */
+#line 629 "./util/configparser.y"
+        {
+		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2850 "util/configparser.c"
+    break;
+
+  case 272: /* server_do_ip6: VAR_DO_IP6 STRING_ARG  */
+#line 638 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2803 "util/configparser.c" /* yacc.c:1646  */
+#line 2862 "util/configparser.c"
     break;
 
-  case 238:
-#line 581 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 273: /* server_do_udp: VAR_DO_UDP STRING_ARG  */
+#line 647 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_udp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_udp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2815 "util/configparser.c" /* yacc.c:1646  */
+#line 2874 "util/configparser.c"
     break;
 
-  case 239:
-#line 590 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 274: /* server_do_tcp: VAR_DO_TCP STRING_ARG  */
+#line 656 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_tcp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_tcp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2827 "util/configparser.c" /* yacc.c:1646  */
+#line 2886 "util/configparser.c"
     break;
 
-  case 240:
-#line 599 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 275: /* server_prefer_ip6: VAR_PREFER_IP6 STRING_ARG  */
+#line 665 "./util/configparser.y"
+        {
 		OUTYY(("P(server_prefer_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefer_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2839 "util/configparser.c" /* yacc.c:1646  */
+#line 2898 "util/configparser.c"
     break;
 
-  case 241:
-#line 608 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 276: /* server_tcp_mss: VAR_TCP_MSS STRING_ARG  */
+#line 674 "./util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_mss:%s)\n", (yyvsp[0].str)));
                 if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
                         yyerror("number expected");
                 else cfg_parser->cfg->tcp_mss = atoi((yyvsp[0].str));
                 free((yyvsp[0].str));
 	}
-#line 2851 "util/configparser.c" /* yacc.c:1646  */
+#line 2910 "util/configparser.c"
     break;
 
-  case 242:
-#line 617 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 277: /* server_outgoing_tcp_mss: VAR_OUTGOING_TCP_MSS STRING_ARG  */
+#line 683 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_tcp_mss:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_tcp_mss = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2863 "util/configparser.c" /* yacc.c:1646  */
+#line 2922 "util/configparser.c"
     break;
 
-  case 243:
-#line 626 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 278: /* server_tcp_upstream: VAR_TCP_UPSTREAM STRING_ARG  */
+#line 692 "./util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2875 "util/configparser.c" /* yacc.c:1646  */
+#line 2934 "util/configparser.c"
     break;
 
-  case 244:
-#line 635 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 279: /* server_udp_upstream_without_downstream: VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM STRING_ARG  */
+#line 701 "./util/configparser.y"
+        {
 		OUTYY(("P(server_udp_upstream_without_downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->udp_upstream_without_downstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2887 "util/configparser.c" /* yacc.c:1646  */
+#line 2946 "util/configparser.c"
     break;
 
-  case 245:
-#line 644 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 280: /* server_ssl_upstream: VAR_SSL_UPSTREAM STRING_ARG  */
+#line 710 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2899 "util/configparser.c" /* yacc.c:1646  */
+#line 2958 "util/configparser.c"
     break;
 
-  case 246:
-#line 653 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 281: /* server_ssl_service_key: VAR_SSL_SERVICE_KEY STRING_ARG  */
+#line 719 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_key);
 		cfg_parser->cfg->ssl_service_key = (yyvsp[0].str);
 	}
-#line 2909 "util/configparser.c" /* yacc.c:1646  */
+#line 2968 "util/configparser.c"
     break;
 
-  case 247:
-#line 660 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 282: /* server_ssl_service_pem: VAR_SSL_SERVICE_PEM STRING_ARG  */
+#line 726 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_pem);
 		cfg_parser->cfg->ssl_service_pem = (yyvsp[0].str);
 	}
-#line 2919 "util/configparser.c" /* yacc.c:1646  */
+#line 2978 "util/configparser.c"
     break;
 
-  case 248:
-#line 667 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 283: /* server_ssl_port: VAR_SSL_PORT STRING_ARG  */
+#line 733 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
 		else cfg_parser->cfg->ssl_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2931 "util/configparser.c" /* yacc.c:1646  */
+#line 2990 "util/configparser.c"
     break;
 
-  case 249:
-#line 676 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 284: /* server_use_systemd: VAR_USE_SYSTEMD STRING_ARG  */
+#line 742 "./util/configparser.y"
+        {
 		OUTYY(("P(server_use_systemd:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->use_systemd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2943 "util/configparser.c" /* yacc.c:1646  */
+#line 3002 "util/configparser.c"
     break;
 
-  case 250:
-#line 685 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 285: /* server_do_daemonize: VAR_DO_DAEMONIZE STRING_ARG  */
+#line 751 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_daemonize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_daemonize = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2955 "util/configparser.c" /* yacc.c:1646  */
+#line 3014 "util/configparser.c"
     break;
 
-  case 251:
-#line 694 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 286: /* server_use_syslog: VAR_USE_SYSLOG STRING_ARG  */
+#line 760 "./util/configparser.y"
+        {
 		OUTYY(("P(server_use_syslog:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -2968,68 +3027,68 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 2972 "util/configparser.c" /* yacc.c:1646  */
+#line 3031 "util/configparser.c"
     break;
 
-  case 252:
-#line 708 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 287: /* server_log_time_ascii: VAR_LOG_TIME_ASCII STRING_ARG  */
+#line 774 "./util/configparser.y"
+        {
 		OUTYY(("P(server_log_time_ascii:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->log_time_ascii = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2984 "util/configparser.c" /* yacc.c:1646  */
+#line 3043 "util/configparser.c"
     break;
 
-  case 253:
-#line 717 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 288: /* server_log_queries: VAR_LOG_QUERIES STRING_ARG  */
+#line 783 "./util/configparser.y"
+        {
 		OUTYY(("P(server_log_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->log_queries = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2996 "util/configparser.c" /* yacc.c:1646  */
+#line 3055 "util/configparser.c"
     break;
 
-  case 254:
-#line 726 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 289: /* server_log_replies: VAR_LOG_REPLIES STRING_ARG  */
+#line 792 "./util/configparser.y"
+  {
   	OUTYY(("P(server_log_replies:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
   		yyerror("expected yes or no.");
   	else cfg_parser->cfg->log_replies = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 3008 "util/configparser.c" /* yacc.c:1646  */
+#line 3067 "util/configparser.c"
     break;
 
-  case 255:
-#line 735 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 290: /* server_chroot: VAR_CHROOT STRING_ARG  */
+#line 801 "./util/configparser.y"
+        {
 		OUTYY(("P(server_chroot:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->chrootdir);
 		cfg_parser->cfg->chrootdir = (yyvsp[0].str);
 	}
-#line 3018 "util/configparser.c" /* yacc.c:1646  */
+#line 3077 "util/configparser.c"
     break;
 
-  case 256:
-#line 742 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 291: /* server_username: VAR_USERNAME STRING_ARG  */
+#line 808 "./util/configparser.y"
+        {
 		OUTYY(("P(server_username:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->username);
 		cfg_parser->cfg->username = (yyvsp[0].str);
 	}
-#line 3028 "util/configparser.c" /* yacc.c:1646  */
+#line 3087 "util/configparser.c"
     break;
 
-  case 257:
-#line 749 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 292: /* server_directory: VAR_DIRECTORY STRING_ARG  */
+#line 815 "./util/configparser.y"
+        {
 		OUTYY(("P(server_directory:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->directory);
 		cfg_parser->cfg->directory = (yyvsp[0].str);
@@ -3053,106 +3112,106 @@ yyreduce:
 			}
 		}
 	}
-#line 3057 "util/configparser.c" /* yacc.c:1646  */
+#line 3116 "util/configparser.c"
     break;
 
-  case 258:
-#line 775 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 293: /* server_logfile: VAR_LOGFILE STRING_ARG  */
+#line 841 "./util/configparser.y"
+        {
 		OUTYY(("P(server_logfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->logfile);
 		cfg_parser->cfg->logfile = (yyvsp[0].str);
 		cfg_parser->cfg->use_syslog = 0;
 	}
-#line 3068 "util/configparser.c" /* yacc.c:1646  */
+#line 3127 "util/configparser.c"
     break;
 
-  case 259:
-#line 783 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 294: /* server_pidfile: VAR_PIDFILE STRING_ARG  */
+#line 849 "./util/configparser.y"
+        {
 		OUTYY(("P(server_pidfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->pidfile);
 		cfg_parser->cfg->pidfile = (yyvsp[0].str);
 	}
-#line 3078 "util/configparser.c" /* yacc.c:1646  */
+#line 3137 "util/configparser.c"
     break;
 
-  case 260:
-#line 790 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 295: /* server_root_hints: VAR_ROOT_HINTS STRING_ARG  */
+#line 856 "./util/configparser.y"
+        {
 		OUTYY(("P(server_root_hints:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->root_hints, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3088 "util/configparser.c" /* yacc.c:1646  */
+#line 3147 "util/configparser.c"
     break;
 
-  case 261:
-#line 797 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 296: /* server_dlv_anchor_file: VAR_DLV_ANCHOR_FILE STRING_ARG  */
+#line 863 "./util/configparser.y"
+        {
 		OUTYY(("P(server_dlv_anchor_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dlv_anchor_file);
 		cfg_parser->cfg->dlv_anchor_file = (yyvsp[0].str);
 	}
-#line 3098 "util/configparser.c" /* yacc.c:1646  */
+#line 3157 "util/configparser.c"
     break;
 
-  case 262:
-#line 804 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 297: /* server_dlv_anchor: VAR_DLV_ANCHOR STRING_ARG  */
+#line 870 "./util/configparser.y"
+        {
 		OUTYY(("P(server_dlv_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dlv_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3108 "util/configparser.c" /* yacc.c:1646  */
+#line 3167 "util/configparser.c"
     break;
 
-  case 263:
-#line 811 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 298: /* server_auto_trust_anchor_file: VAR_AUTO_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 877 "./util/configparser.y"
+        {
 		OUTYY(("P(server_auto_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			auto_trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3119 "util/configparser.c" /* yacc.c:1646  */
+#line 3178 "util/configparser.c"
     break;
 
-  case 264:
-#line 819 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 299: /* server_trust_anchor_file: VAR_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 885 "./util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3130 "util/configparser.c" /* yacc.c:1646  */
+#line 3189 "util/configparser.c"
     break;
 
-  case 265:
-#line 827 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 300: /* server_trusted_keys_file: VAR_TRUSTED_KEYS_FILE STRING_ARG  */
+#line 893 "./util/configparser.y"
+        {
 		OUTYY(("P(server_trusted_keys_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trusted_keys_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3141 "util/configparser.c" /* yacc.c:1646  */
+#line 3200 "util/configparser.c"
     break;
 
-  case 266:
-#line 835 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 301: /* server_trust_anchor: VAR_TRUST_ANCHOR STRING_ARG  */
+#line 901 "./util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->trust_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3151 "util/configparser.c" /* yacc.c:1646  */
+#line 3210 "util/configparser.c"
     break;
 
-  case 267:
-#line 842 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 302: /* server_trust_anchor_signaling: VAR_TRUST_ANCHOR_SIGNALING STRING_ARG  */
+#line 908 "./util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor_signaling:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3161,99 +3220,99 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3165 "util/configparser.c" /* yacc.c:1646  */
+#line 3224 "util/configparser.c"
     break;
 
-  case 268:
-#line 853 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 303: /* server_domain_insecure: VAR_DOMAIN_INSECURE STRING_ARG  */
+#line 919 "./util/configparser.y"
+        {
 		OUTYY(("P(server_domain_insecure:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->domain_insecure, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3175 "util/configparser.c" /* yacc.c:1646  */
+#line 3234 "util/configparser.c"
     break;
 
-  case 269:
-#line 860 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 304: /* server_hide_identity: VAR_HIDE_IDENTITY STRING_ARG  */
+#line 926 "./util/configparser.y"
+        {
 		OUTYY(("P(server_hide_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_identity = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3187 "util/configparser.c" /* yacc.c:1646  */
+#line 3246 "util/configparser.c"
     break;
 
-  case 270:
-#line 869 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 305: /* server_hide_version: VAR_HIDE_VERSION STRING_ARG  */
+#line 935 "./util/configparser.y"
+        {
 		OUTYY(("P(server_hide_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_version = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3199 "util/configparser.c" /* yacc.c:1646  */
+#line 3258 "util/configparser.c"
     break;
 
-  case 271:
-#line 878 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 306: /* server_hide_trustanchor: VAR_HIDE_TRUSTANCHOR STRING_ARG  */
+#line 944 "./util/configparser.y"
+        {
 		OUTYY(("P(server_hide_trustanchor:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_trustanchor = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3211 "util/configparser.c" /* yacc.c:1646  */
+#line 3270 "util/configparser.c"
     break;
 
-  case 272:
-#line 887 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 307: /* server_identity: VAR_IDENTITY STRING_ARG  */
+#line 953 "./util/configparser.y"
+        {
 		OUTYY(("P(server_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->identity);
 		cfg_parser->cfg->identity = (yyvsp[0].str);
 	}
-#line 3221 "util/configparser.c" /* yacc.c:1646  */
+#line 3280 "util/configparser.c"
     break;
 
-  case 273:
-#line 894 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 308: /* server_version: VAR_VERSION STRING_ARG  */
+#line 960 "./util/configparser.y"
+        {
 		OUTYY(("P(server_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->version);
 		cfg_parser->cfg->version = (yyvsp[0].str);
 	}
-#line 3231 "util/configparser.c" /* yacc.c:1646  */
+#line 3290 "util/configparser.c"
     break;
 
-  case 274:
-#line 901 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 309: /* server_so_rcvbuf: VAR_SO_RCVBUF STRING_ARG  */
+#line 967 "./util/configparser.y"
+        {
 		OUTYY(("P(server_so_rcvbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_rcvbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 3242 "util/configparser.c" /* yacc.c:1646  */
+#line 3301 "util/configparser.c"
     break;
 
-  case 275:
-#line 909 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 310: /* server_so_sndbuf: VAR_SO_SNDBUF STRING_ARG  */
+#line 975 "./util/configparser.y"
+        {
 		OUTYY(("P(server_so_sndbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_sndbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 3253 "util/configparser.c" /* yacc.c:1646  */
+#line 3312 "util/configparser.c"
     break;
 
-  case 276:
-#line 917 "./util/configparser.y" /* yacc.c:1646  */
+  case 311: /* server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG  */
+#line 983 "./util/configparser.y"
     {
         OUTYY(("P(server_so_reuseport:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3262,11 +3321,23 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3266 "util/configparser.c" /* yacc.c:1646  */
+#line 3325 "util/configparser.c"
     break;
 
-  case 277:
-#line 927 "./util/configparser.y" /* yacc.c:1646  */
+  case 312: /* server_udp_batch_size: VAR_UDP_BATCH_SIZE STRING_ARG  */
+#line 993 "./util/configparser.y"
+        {
+		OUTYY(("P(server_udp_batch_size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->udp_batch_size = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3337 "util/configparser.c"
+    break;
+
+  case 313: /* server_ip_transparent: VAR_IP_TRANSPARENT STRING_ARG  */
+#line 1002 "./util/configparser.y"
     {
         OUTYY(("P(server_ip_transparent:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3275,11 +3346,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3279 "util/configparser.c" /* yacc.c:1646  */
+#line 3350 "util/configparser.c"
     break;
 
-  case 278:
-#line 937 "./util/configparser.y" /* yacc.c:1646  */
+  case 314: /* server_ip_freebind: VAR_IP_FREEBIND STRING_ARG  */
+#line 1012 "./util/configparser.y"
     {
         OUTYY(("P(server_ip_freebind:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3288,12 +3359,12 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3292 "util/configparser.c" /* yacc.c:1646  */
+#line 3363 "util/configparser.c"
     break;
 
-  case 279:
-#line 947 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 315: /* server_edns_buffer_size: VAR_EDNS_BUFFER_SIZE STRING_ARG  */
+#line 1022 "./util/configparser.y"
+        {
 		OUTYY(("P(server_edns_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3304,12 +3375,12 @@ yyreduce:
 		else cfg_parser->cfg->edns_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3308 "util/configparser.c" /* yacc.c:1646  */
+#line 3379 "util/configparser.c"
     break;
 
-  case 280:
-#line 960 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 316: /* server_msg_buffer_size: VAR_MSG_BUFFER_SIZE STRING_ARG  */
+#line 1035 "./util/configparser.y"
+        {
 		OUTYY(("P(server_msg_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3318,23 +3389,23 @@ yyreduce:
 		else cfg_parser->cfg->msg_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3322 "util/configparser.c" /* yacc.c:1646  */
+#line 3393 "util/configparser.c"
     break;
 
-  case 281:
-#line 971 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 317: /* server_msg_cache_size: VAR_MSG_CACHE_SIZE STRING_ARG  */
+#line 1046 "./util/configparser.y"
+        {
 		OUTYY(("P(server_msg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->msg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3333 "util/configparser.c" /* yacc.c:1646  */
+#line 3404 "util/configparser.c"
     break;
 
-  case 282:
-#line 979 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 318: /* server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG  */
+#line 1054 "./util/configparser.y"
+        {
 		OUTYY(("P(server_msg_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3345,48 +3416,48 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3349 "util/configparser.c" /* yacc.c:1646  */
+#line 3420 "util/configparser.c"
     break;
 
-  case 283:
-#line 992 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 319: /* server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG  */
+#line 1067 "./util/configparser.y"
+        {
 		OUTYY(("P(server_num_queries_per_thread:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->num_queries_per_thread = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3361 "util/configparser.c" /* yacc.c:1646  */
+#line 3432 "util/configparser.c"
     break;
 
-  case 284:
-#line 1001 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 320: /* server_jostle_timeout: VAR_JOSTLE_TIMEOUT STRING_ARG  */
+#line 1076 "./util/configparser.y"
+        {
 		OUTYY(("P(server_jostle_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->jostle_time = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3373 "util/configparser.c" /* yacc.c:1646  */
+#line 3444 "util/configparser.c"
     break;
 
-  case 285:
-#line 1010 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 321: /* server_delay_close: VAR_DELAY_CLOSE STRING_ARG  */
+#line 1085 "./util/configparser.y"
+        {
 		OUTYY(("P(server_delay_close:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->delay_close = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3385 "util/configparser.c" /* yacc.c:1646  */
+#line 3456 "util/configparser.c"
     break;
 
-  case 286:
-#line 1019 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 322: /* server_unblock_lan_zones: VAR_UNBLOCK_LAN_ZONES STRING_ARG  */
+#line 1094 "./util/configparser.y"
+        {
 		OUTYY(("P(server_unblock_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3394,12 +3465,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3398 "util/configparser.c" /* yacc.c:1646  */
+#line 3469 "util/configparser.c"
     break;
 
-  case 287:
-#line 1029 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 323: /* server_insecure_lan_zones: VAR_INSECURE_LAN_ZONES STRING_ARG  */
+#line 1104 "./util/configparser.y"
+        {
 		OUTYY(("P(server_insecure_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3407,23 +3478,23 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3411 "util/configparser.c" /* yacc.c:1646  */
+#line 3482 "util/configparser.c"
     break;
 
-  case 288:
-#line 1039 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 324: /* server_rrset_cache_size: VAR_RRSET_CACHE_SIZE STRING_ARG  */
+#line 1114 "./util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->rrset_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3422 "util/configparser.c" /* yacc.c:1646  */
+#line 3493 "util/configparser.c"
     break;
 
-  case 289:
-#line 1047 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 325: /* server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG  */
+#line 1122 "./util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3434,58 +3505,92 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3438 "util/configparser.c" /* yacc.c:1646  */
+#line 3509 "util/configparser.c"
     break;
 
-  case 290:
-#line 1060 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 326: /* server_cache_clock_eviction: VAR_CACHE_CLOCK_EVICTION STRING_ARG  */
+#line 1135 "./util/configparser.y"
+        {
+		OUTYY(("P(server_cache_clock_eviction:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_clock_eviction = 
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3522 "util/configparser.c"
+    break;
+
+  case 327: /* server_cache_snapshot_file: VAR_CACHE_SNAPSHOT_FILE STRING_ARG  */
+#line 1145 "./util/configparser.y"
+        {
+		OUTYY(("P(server_cache_snapshot_file:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->cache_snapshot_file);
+		cfg_parser->cfg->cache_snapshot_file = (yyvsp[0].str);
+	}
+#line 3532 "util/configparser.c"
+    break;
+
+  case 328: /* server_wire_cache_size: VAR_WIRE_CACHE_SIZE STRING_ARG  */
+#line 1152 "./util/configparser.y"
+        {
+		OUTYY(("P(server_wire_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->wire_cache_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 3543 "util/configparser.c"
+    break;
+
+  case 329: /* server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG  */
+#line 1160 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_host_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->host_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3450 "util/configparser.c" /* yacc.c:1646  */
+#line 3555 "util/configparser.c"
     break;
 
-  case 291:
-#line 1069 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 330: /* server_infra_lame_ttl: VAR_INFRA_LAME_TTL STRING_ARG  */
+#line 1169 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_lame_ttl:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-lame-ttl: %s (option "
 			"removed, use infra-host-ttl)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3461 "util/configparser.c" /* yacc.c:1646  */
+#line 3566 "util/configparser.c"
     break;
 
-  case 292:
-#line 1077 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 331: /* server_infra_cache_numhosts: VAR_INFRA_CACHE_NUMHOSTS STRING_ARG  */
+#line 1177 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_numhosts:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->infra_cache_numhosts = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3473 "util/configparser.c" /* yacc.c:1646  */
+#line 3578 "util/configparser.c"
     break;
 
-  case 293:
-#line 1086 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 332: /* server_infra_cache_lame_size: VAR_INFRA_CACHE_LAME_SIZE STRING_ARG  */
+#line 1186 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_lame_size:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-cache-lame-size: %s "
 			"(option removed, use infra-cache-numhosts)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3484 "util/configparser.c" /* yacc.c:1646  */
+#line 3589 "util/configparser.c"
     break;
 
-  case 294:
-#line 1094 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 333: /* server_infra_cache_slabs: VAR_INFRA_CACHE_SLABS STRING_ARG  */
+#line 1194 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3496,34 +3601,34 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3500 "util/configparser.c" /* yacc.c:1646  */
+#line 3605 "util/configparser.c"
     break;
 
-  case 295:
-#line 1107 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 334: /* server_infra_cache_min_rtt: VAR_INFRA_CACHE_MIN_RTT STRING_ARG  */
+#line 1207 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_min_rtt:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->infra_cache_min_rtt = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3512 "util/configparser.c" /* yacc.c:1646  */
+#line 3617 "util/configparser.c"
     break;
 
-  case 296:
-#line 1116 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 335: /* server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG  */
+#line 1216 "./util/configparser.y"
+        {
 		OUTYY(("P(server_target_fetch_policy:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->target_fetch_policy);
 		cfg_parser->cfg->target_fetch_policy = (yyvsp[0].str);
 	}
-#line 3522 "util/configparser.c" /* yacc.c:1646  */
+#line 3627 "util/configparser.c"
     break;
 
-  case 297:
-#line 1123 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 336: /* server_harden_short_bufsize: VAR_HARDEN_SHORT_BUFSIZE STRING_ARG  */
+#line 1223 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_short_bufsize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3531,12 +3636,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3535 "util/configparser.c" /* yacc.c:1646  */
+#line 3640 "util/configparser.c"
     break;
 
-  case 298:
-#line 1133 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 337: /* server_harden_large_queries: VAR_HARDEN_LARGE_QUERIES STRING_ARG  */
+#line 1233 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_large_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3544,12 +3649,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3548 "util/configparser.c" /* yacc.c:1646  */
+#line 3653 "util/configparser.c"
     break;
 
-  case 299:
-#line 1143 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 338: /* server_harden_glue: VAR_HARDEN_GLUE STRING_ARG  */
+#line 1243 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_glue:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3557,12 +3662,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3561 "util/configparser.c" /* yacc.c:1646  */
+#line 3666 "util/configparser.c"
     break;
 
-  case 300:
-#line 1153 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 339: /* server_harden_dnssec_stripped: VAR_HARDEN_DNSSEC_STRIPPED STRING_ARG  */
+#line 1253 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_dnssec_stripped:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3570,12 +3675,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3574 "util/configparser.c" /* yacc.c:1646  */
+#line 3679 "util/configparser.c"
     break;
 
-  case 301:
-#line 1163 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 340: /* server_harden_below_nxdomain: VAR_HARDEN_BELOW_NXDOMAIN STRING_ARG  */
+#line 1263 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_below_nxdomain:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3583,12 +3688,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3587 "util/configparser.c" /* yacc.c:1646  */
+#line 3692 "util/configparser.c"
     break;
 
-  case 302:
-#line 1173 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 341: /* server_harden_referral_path: VAR_HARDEN_REFERRAL_PATH STRING_ARG  */
+#line 1273 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_referral_path:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3596,12 +3701,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3600 "util/configparser.c" /* yacc.c:1646  */
+#line 3705 "util/configparser.c"
     break;
 
-  case 303:
-#line 1183 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 342: /* server_harden_algo_downgrade: VAR_HARDEN_ALGO_DOWNGRADE STRING_ARG  */
+#line 1283 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_algo_downgrade:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3609,12 +3714,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3613 "util/configparser.c" /* yacc.c:1646  */
+#line 3718 "util/configparser.c"
     break;
 
-  case 304:
-#line 1193 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 343: /* server_use_caps_for_id: VAR_USE_CAPS_FOR_ID STRING_ARG  */
+#line 1293 "./util/configparser.y"
+        {
 		OUTYY(("P(server_use_caps_for_id:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3622,88 +3727,88 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3626 "util/configparser.c" /* yacc.c:1646  */
+#line 3731 "util/configparser.c"
     break;
 
-  case 305:
-#line 1203 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 344: /* server_caps_whitelist: VAR_CAPS_WHITELIST STRING_ARG  */
+#line 1303 "./util/configparser.y"
+        {
 		OUTYY(("P(server_caps_whitelist:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->caps_whitelist, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3636 "util/configparser.c" /* yacc.c:1646  */
+#line 3741 "util/configparser.c"
     break;
 
-  case 306:
-#line 1210 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 345: /* server_private_address: VAR_PRIVATE_ADDRESS STRING_ARG  */
+#line 1310 "./util/configparser.y"
+        {
 		OUTYY(("P(server_private_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_address, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3646 "util/configparser.c" /* yacc.c:1646  */
+#line 3751 "util/configparser.c"
     break;
 
-  case 307:
-#line 1217 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 346: /* server_private_domain: VAR_PRIVATE_DOMAIN STRING_ARG  */
+#line 1317 "./util/configparser.y"
+        {
 		OUTYY(("P(server_private_domain:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_domain, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3656 "util/configparser.c" /* yacc.c:1646  */
+#line 3761 "util/configparser.c"
     break;
 
-  case 308:
-#line 1224 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 347: /* server_prefetch: VAR_PREFETCH STRING_ARG  */
+#line 1324 "./util/configparser.y"
+        {
 		OUTYY(("P(server_prefetch:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefetch = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3668 "util/configparser.c" /* yacc.c:1646  */
+#line 3773 "util/configparser.c"
     break;
 
-  case 309:
-#line 1233 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 348: /* server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG  */
+#line 1333 "./util/configparser.y"
+        {
 		OUTYY(("P(server_prefetch_key:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefetch_key = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3680 "util/configparser.c" /* yacc.c:1646  */
+#line 3785 "util/configparser.c"
     break;
 
-  case 310:
-#line 1242 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 349: /* server_unwanted_reply_threshold: VAR_UNWANTED_REPLY_THRESHOLD STRING_ARG  */
+#line 1342 "./util/configparser.y"
+        {
 		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->unwanted_threshold = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3692 "util/configparser.c" /* yacc.c:1646  */
+#line 3797 "util/configparser.c"
     break;
 
-  case 311:
-#line 1251 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 350: /* server_do_not_query_address: VAR_DO_NOT_QUERY_ADDRESS STRING_ARG  */
+#line 1351 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_not_query_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->donotqueryaddrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3702 "util/configparser.c" /* yacc.c:1646  */
+#line 3807 "util/configparser.c"
     break;
 
-  case 312:
-#line 1258 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 351: /* server_do_not_query_localhost: VAR_DO_NOT_QUERY_LOCALHOST STRING_ARG  */
+#line 1358 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_not_query_localhost:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3711,12 +3816,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3715 "util/configparser.c" /* yacc.c:1646  */
+#line 3820 "util/configparser.c"
     break;
 
-  case 313:
-#line 1268 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 352: /* server_access_control: VAR_ACCESS_CONTROL STRING_ARG STRING_ARG  */
+#line 1368 "./util/configparser.y"
+        {
 		OUTYY(("P(server_access_control:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "deny")!=0 && strcmp((yyvsp[0].str), "refuse")!=0 &&
 			strcmp((yyvsp[0].str), "deny_non_local")!=0 &&
@@ -3731,22 +3836,22 @@ yyreduce:
 				fatal_exit("out of memory adding acl");
 		}
 	}
-#line 3735 "util/configparser.c" /* yacc.c:1646  */
+#line 3840 "util/configparser.c"
     break;
 
-  case 314:
-#line 1285 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 353: /* server_module_conf: VAR_MODULE_CONF STRING_ARG  */
+#line 1385 "./util/configparser.y"
+        {
 		OUTYY(("P(server_module_conf:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->module_conf);
 		cfg_parser->cfg->module_conf = (yyvsp[0].str);
 	}
-#line 3745 "util/configparser.c" /* yacc.c:1646  */
+#line 3850 "util/configparser.c"
     break;
 
-  case 315:
-#line 1292 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 354: /* server_val_override_date: VAR_VAL_OVERRIDE_DATE STRING_ARG  */
+#line 1392 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_override_date:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_date_override = 0;
@@ -3762,12 +3867,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3766 "util/configparser.c" /* yacc.c:1646  */
+#line 3871 "util/configparser.c"
     break;
 
-  case 316:
-#line 1310 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 355: /* server_val_sig_skew_min: VAR_VAL_SIG_SKEW_MIN STRING_ARG  */
+#line 1410 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_sig_skew_min:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_min = 0;
@@ -3778,12 +3883,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3782 "util/configparser.c" /* yacc.c:1646  */
+#line 3887 "util/configparser.c"
     break;
 
-  case 317:
-#line 1323 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 356: /* server_val_sig_skew_max: VAR_VAL_SIG_SKEW_MAX STRING_ARG  */
+#line 1423 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_sig_skew_max:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_max = 0;
@@ -3794,60 +3899,60 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3798 "util/configparser.c" /* yacc.c:1646  */
+#line 3903 "util/configparser.c"
     break;
 
-  case 318:
-#line 1336 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 357: /* server_cache_max_ttl: VAR_CACHE_MAX_TTL STRING_ARG  */
+#line 1436 "./util/configparser.y"
+        {
 		OUTYY(("P(server_cache_max_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->max_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3810 "util/configparser.c" /* yacc.c:1646  */
+#line 3915 "util/configparser.c"
     break;
 
-  case 319:
-#line 1345 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 358: /* server_cache_max_negative_ttl: VAR_CACHE_MAX_NEGATIVE_TTL STRING_ARG  */
+#line 1445 "./util/configparser.y"
+        {
 		OUTYY(("P(server_cache_max_negative_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->max_negative_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3822 "util/configparser.c" /* yacc.c:1646  */
+#line 3927 "util/configparser.c"
     break;
 
-  case 320:
-#line 1354 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 359: /* server_cache_min_ttl: VAR_CACHE_MIN_TTL STRING_ARG  */
+#line 1454 "./util/configparser.y"
+        {
 		OUTYY(("P(server_cache_min_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->min_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3834 "util/configparser.c" /* yacc.c:1646  */
+#line 3939 "util/configparser.c"
     break;
 
-  case 321:
-#line 1363 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 360: /* server_bogus_ttl: VAR_BOGUS_TTL STRING_ARG  */
+#line 1463 "./util/configparser.y"
+        {
 		OUTYY(("P(server_bogus_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->bogus_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3846 "util/configparser.c" /* yacc.c:1646  */
+#line 3951 "util/configparser.c"
     break;
 
-  case 322:
-#line 1372 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 361: /* server_val_clean_additional: VAR_VAL_CLEAN_ADDITIONAL STRING_ARG  */
+#line 1472 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_clean_additional:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3855,12 +3960,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3859 "util/configparser.c" /* yacc.c:1646  */
+#line 3964 "util/configparser.c"
     break;
 
-  case 323:
-#line 1382 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 362: /* server_val_permissive_mode: VAR_VAL_PERMISSIVE_MODE STRING_ARG  */
+#line 1482 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_permissive_mode:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3868,36 +3973,36 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3872 "util/configparser.c" /* yacc.c:1646  */
+#line 3977 "util/configparser.c"
     break;
 
-  case 324:
-#line 1392 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 363: /* server_ignore_cd_flag: VAR_IGNORE_CD_FLAG STRING_ARG  */
+#line 1492 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ignore_cd_flag:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->ignore_cd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3884 "util/configparser.c" /* yacc.c:1646  */
+#line 3989 "util/configparser.c"
     break;
 
-  case 325:
-#line 1401 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 364: /* server_serve_expired: VAR_SERVE_EXPIRED STRING_ARG  */
+#line 1501 "./util/configparser.y"
+        {
 		OUTYY(("P(server_serve_expired:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->serve_expired = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3896 "util/configparser.c" /* yacc.c:1646  */
+#line 4001 "util/configparser.c"
     break;
 
-  case 326:
-#line 1410 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 365: /* server_fake_dsa: VAR_FAKE_DSA STRING_ARG  */
+#line 1510 "./util/configparser.y"
+        {
 		OUTYY(("P(server_fake_dsa:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3908,12 +4013,12 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 3912 "util/configparser.c" /* yacc.c:1646  */
+#line 4017 "util/configparser.c"
     break;
 
-  case 327:
-#line 1423 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 366: /* server_fake_sha1: VAR_FAKE_SHA1 STRING_ARG  */
+#line 1523 "./util/configparser.y"
+        {
 		OUTYY(("P(server_fake_sha1:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3924,70 +4029,70 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 3928 "util/configparser.c" /* yacc.c:1646  */
+#line 4033 "util/configparser.c"
     break;
 
-  case 328:
-#line 1436 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 367: /* server_val_log_level: VAR_VAL_LOG_LEVEL STRING_ARG  */
+#line 1536 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_log_level:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->val_log_level = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3940 "util/configparser.c" /* yacc.c:1646  */
+#line 4045 "util/configparser.c"
     break;
 
-  case 329:
-#line 1445 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 368: /* server_val_nsec3_keysize_iterations: VAR_VAL_NSEC3_KEYSIZE_ITERATIONS STRING_ARG  */
+#line 1545 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->val_nsec3_key_iterations);
 		cfg_parser->cfg->val_nsec3_key_iterations = (yyvsp[0].str);
 	}
-#line 3950 "util/configparser.c" /* yacc.c:1646  */
+#line 4055 "util/configparser.c"
     break;
 
-  case 330:
-#line 1452 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 369: /* server_add_holddown: VAR_ADD_HOLDDOWN STRING_ARG  */
+#line 1552 "./util/configparser.y"
+        {
 		OUTYY(("P(server_add_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->add_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3962 "util/configparser.c" /* yacc.c:1646  */
+#line 4067 "util/configparser.c"
     break;
 
-  case 331:
-#line 1461 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 370: /* server_del_holddown: VAR_DEL_HOLDDOWN STRING_ARG  */
+#line 1561 "./util/configparser.y"
+        {
 		OUTYY(("P(server_del_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->del_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3974 "util/configparser.c" /* yacc.c:1646  */
+#line 4079 "util/configparser.c"
     break;
 
-  case 332:
-#line 1470 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 371: /* server_keep_missing: VAR_KEEP_MISSING STRING_ARG  */
+#line 1570 "./util/configparser.y"
+        {
 		OUTYY(("P(server_keep_missing:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->keep_missing = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3986 "util/configparser.c" /* yacc.c:1646  */
+#line 4091 "util/configparser.c"
     break;
 
-  case 333:
-#line 1479 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 372: /* server_permit_small_holddown: VAR_PERMIT_SMALL_HOLDDOWN STRING_ARG  */
+#line 1579 "./util/configparser.y"
+        {
 		OUTYY(("P(server_permit_small_holddown:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3995,23 +4100,69 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3999 "util/configparser.c" /* yacc.c:1646  */
+#line 4104 "util/configparser.c"
     break;
 
-  case 334:
-#line 1488 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 373: /* server_key_cache_size: VAR_KEY_CACHE_SIZE STRING_ARG  */
+#line 1588 "./util/configparser.y"
+        {
 		OUTYY(("P(server_key_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->key_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4010 "util/configparser.c" /* yacc.c:1646  */
+#line 4115 "util/configparser.c"
     break;
 
-  case 335:
-#line 1496 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 374: /* server_sig_cache_size: VAR_SIG_CACHE_SIZE STRING_ARG  */
+#line 1596 "./util/configparser.y"
+        {
+		OUTYY(("P(server_sig_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->sig_cache_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 4126 "util/configparser.c"
+    break;
+
+  case 375: /* server_nsec3_cache_size: VAR_NSEC3_CACHE_SIZE STRING_ARG  */
+#line 1604 "./util/configparser.y"
+        {
+		OUTYY(("P(server_nsec3_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->nsec3_cache_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 4137 "util/configparser.c"
+    break;
+
+  case 376: /* server_val_nsec3_max_iterations: VAR_VAL_NSEC3_MAX_ITERATIONS STRING_ARG  */
+#line 1612 "./util/configparser.y"
+        {
+		OUTYY(("P(server_val_nsec3_max_iterations:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->val_nsec3_max_iterations = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4149 "util/configparser.c"
+    break;
+
+  case 377: /* server_crypto_threads: VAR_CRYPTO_THREADS STRING_ARG  */
+#line 1621 "./util/configparser.y"
+        {
+		OUTYY(("P(server_crypto_threads:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->crypto_threads = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4161 "util/configparser.c"
+    break;
+
+  case 378: /* server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG  */
+#line 1630 "./util/configparser.y"
+        {
 		OUTYY(("P(server_key_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -4022,23 +4173,52 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4026 "util/configparser.c" /* yacc.c:1646  */
+#line 4177 "util/configparser.c"
     break;
 
-  case 336:
-#line 1509 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 379: /* server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG  */
+#line 1643 "./util/configparser.y"
+        {
 		OUTYY(("P(server_neg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->neg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4037 "util/configparser.c" /* yacc.c:1646  */
+#line 4188 "util/configparser.c"
     break;
 
-  case 337:
-#line 1517 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 380: /* server_neg_cache_slabs: VAR_NEG_CACHE_SLABS STRING_ARG  */
+#line 1651 "./util/configparser.y"
+        {
+		OUTYY(("P(server_neg_cache_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
+			yyerror("number expected");
+		else {
+			cfg_parser->cfg->neg_cache_slabs = atoi((yyvsp[0].str));
+			if(!is_pow2(cfg_parser->cfg->neg_cache_slabs))
+				yyerror("must be a power of 2");
+		}
+		free((yyvsp[0].str));
+	}
+#line 4204 "util/configparser.c"
+    break;
+
+  case 381: /* server_aggressive_nsec: VAR_AGGRESSIVE_NSEC STRING_ARG  */
+#line 1664 "./util/configparser.y"
+        {
+		OUTYY(("P(server_aggressive_nsec:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->aggressive_nsec =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4217 "util/configparser.c"
+    break;
+
+  case 382: /* server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 1674 "./util/configparser.y"
+        {
 		OUTYY(("P(server_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
 		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
@@ -4064,22 +4244,22 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 4068 "util/configparser.c" /* yacc.c:1646  */
+#line 4248 "util/configparser.c"
     break;
 
-  case 338:
-#line 1545 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 383: /* server_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 1702 "./util/configparser.y"
+        {
 		OUTYY(("P(server_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->local_data, (yyvsp[0].str)))
 			fatal_exit("out of memory adding local-data");
 	}
-#line 4078 "util/configparser.c" /* yacc.c:1646  */
+#line 4258 "util/configparser.c"
     break;
 
-  case 339:
-#line 1552 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 384: /* server_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 1709 "./util/configparser.y"
+        {
 		char* ptr;
 		OUTYY(("P(server_local_data_ptr:%s)\n", (yyvsp[0].str)));
 		ptr = cfg_ptr_reverse((yyvsp[0].str));
@@ -4092,70 +4272,221 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 4096 "util/configparser.c" /* yacc.c:1646  */
+#line 4276 "util/configparser.c"
+    break;
+
+  case 385: /* server_minimal_responses: VAR_MINIMAL_RESPONSES STRING_ARG  */
+#line 1724 "./util/configparser.y"
+        {
+		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->minimal_responses =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4289 "util/configparser.c"
+    break;
+
+  case 386: /* server_rrset_roundrobin: VAR_RRSET_ROUNDROBIN STRING_ARG  */
+#line 1734 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->rrset_roundrobin =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4302 "util/configparser.c"
+    break;
+
+  case 387: /* server_compression_hash: VAR_COMPRESSION_HASH STRING_ARG  */
+#line 1744 "./util/configparser.y"
+        {
+		OUTYY(("P(server_compression_hash:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->compression_hash =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4315 "util/configparser.c"
+    break;
+
+  case 388: /* server_so_reuseport_cbpf: VAR_SO_REUSEPORT_CBPF STRING_ARG  */
+#line 1754 "./util/configparser.y"
+        {
+		OUTYY(("P(server_so_reuseport_cbpf:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->so_reuseport_cbpf =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4328 "util/configparser.c"
+    break;
+
+  case 389: /* server_cpu_affinity: VAR_CPU_AFFINITY STRING_ARG  */
+#line 1764 "./util/configparser.y"
+        {
+		OUTYY(("P(server_cpu_affinity:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cpu_affinity =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4341 "util/configparser.c"
+    break;
+
+  case 390: /* server_cpu_affinity_list: VAR_CPU_AFFINITY_LIST STRING_ARG  */
+#line 1774 "./util/configparser.y"
+        {
+		OUTYY(("P(server_cpu_affinity_list:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->cpu_affinity_list);
+		cfg_parser->cfg->cpu_affinity_list = (yyvsp[0].str);
+	}
+#line 4351 "util/configparser.c"
+    break;
+
+  case 391: /* server_inflight_dedup: VAR_INFLIGHT_DEDUP STRING_ARG  */
+#line 1781 "./util/configparser.y"
+        {
+		OUTYY(("P(server_inflight_dedup:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->inflight_dedup =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4364 "util/configparser.c"
+    break;
+
+  case 392: /* server_jostle_adaptive: VAR_JOSTLE_ADAPTIVE STRING_ARG  */
+#line 1791 "./util/configparser.y"
+        {
+		OUTYY(("P(server_jostle_adaptive:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->jostle_adaptive =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4377 "util/configparser.c"
+    break;
+
+  case 393: /* server_outgoing_batch: VAR_OUTGOING_BATCH STRING_ARG  */
+#line 1801 "./util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_batch:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->outgoing_batch =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4390 "util/configparser.c"
+    break;
+
+  case 394: /* server_outgoing_port_pool: VAR_OUTGOING_PORT_POOL STRING_ARG  */
+#line 1811 "./util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_port_pool:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->outgoing_port_pool = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4402 "util/configparser.c"
+    break;
+
+  case 395: /* server_outgoing_port_pool_uses: VAR_OUTGOING_PORT_POOL_USES STRING_ARG  */
+#line 1820 "./util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_port_pool_uses:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->outgoing_port_pool_uses = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4414 "util/configparser.c"
     break;
 
-  case 340:
-#line 1567 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[0].str)));
+  case 396: /* server_infra_cache_server_shared: VAR_INFRA_CACHE_SERVER_SHARED STRING_ARG  */
+#line 1829 "./util/configparser.y"
+        {
+		OUTYY(("P(server_infra_cache_server_shared:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->minimal_responses =
+		else cfg_parser->cfg->infra_cache_server_shared =
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4109 "util/configparser.c" /* yacc.c:1646  */
+#line 4427 "util/configparser.c"
     break;
 
-  case 341:
-#line 1577 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[0].str)));
-		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
-			yyerror("expected yes or no.");
-		else cfg_parser->cfg->rrset_roundrobin =
-			(strcmp((yyvsp[0].str), "yes")==0);
+  case 397: /* server_server_selection_percentile: VAR_SERVER_SELECTION_PERCENTILE STRING_ARG  */
+#line 1839 "./util/configparser.y"
+        {
+		OUTYY(("P(server_server_selection_percentile:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0 || atoi((yyvsp[0].str)) > 100)
+			yyerror("percentile must be from 0 to 100");
+		else cfg_parser->cfg->server_selection_percentile = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4122 "util/configparser.c" /* yacc.c:1646  */
+#line 4441 "util/configparser.c"
     break;
 
-  case 342:
-#line 1587 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 398: /* server_target_fetch_fanout: VAR_TARGET_FETCH_FANOUT STRING_ARG  */
+#line 1850 "./util/configparser.y"
+        {
+		OUTYY(("P(server_target_fetch_fanout:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->target_fetch_fanout = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4453 "util/configparser.c"
+    break;
+
+  case 399: /* server_max_udp_size: VAR_MAX_UDP_SIZE STRING_ARG  */
+#line 1859 "./util/configparser.y"
+        {
 		OUTYY(("P(server_max_udp_size:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->max_udp_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4132 "util/configparser.c" /* yacc.c:1646  */
+#line 4463 "util/configparser.c"
     break;
 
-  case 343:
-#line 1594 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 400: /* server_dns64_prefix: VAR_DNS64_PREFIX STRING_ARG  */
+#line 1866 "./util/configparser.y"
+        {
 		OUTYY(("P(dns64_prefix:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dns64_prefix);
 		cfg_parser->cfg->dns64_prefix = (yyvsp[0].str);
 	}
-#line 4142 "util/configparser.c" /* yacc.c:1646  */
+#line 4473 "util/configparser.c"
     break;
 
-  case 344:
-#line 1601 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 401: /* server_dns64_synthall: VAR_DNS64_SYNTHALL STRING_ARG  */
+#line 1873 "./util/configparser.y"
+        {
 		OUTYY(("P(server_dns64_synthall:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dns64_synthall = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4154 "util/configparser.c" /* yacc.c:1646  */
+#line 4485 "util/configparser.c"
     break;
 
-  case 345:
-#line 1610 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 402: /* server_define_tag: VAR_DEFINE_TAG STRING_ARG  */
+#line 1882 "./util/configparser.y"
+        {
 		char* p, *s = (yyvsp[0].str);
 		OUTYY(("P(server_define_tag:%s)\n", (yyvsp[0].str)));
 		while((p=strsep(&s, " \t\n")) != NULL) {
@@ -4167,12 +4498,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4171 "util/configparser.c" /* yacc.c:1646  */
+#line 4502 "util/configparser.c"
     break;
 
-  case 346:
-#line 1624 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 403: /* server_local_zone_tag: VAR_LOCAL_ZONE_TAG STRING_ARG STRING_ARG  */
+#line 1896 "./util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -4189,12 +4520,12 @@ yyreduce:
 			}
 		}
 	}
-#line 4193 "util/configparser.c" /* yacc.c:1646  */
+#line 4524 "util/configparser.c"
     break;
 
-  case 347:
-#line 1643 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 404: /* server_access_control_tag: VAR_ACCESS_CONTROL_TAG STRING_ARG STRING_ARG  */
+#line 1915 "./util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -4211,12 +4542,12 @@ yyreduce:
 			}
 		}
 	}
-#line 4215 "util/configparser.c" /* yacc.c:1646  */
+#line 4546 "util/configparser.c"
     break;
 
-  case 348:
-#line 1662 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 405: /* server_access_control_tag_action: VAR_ACCESS_CONTROL_TAG_ACTION STRING_ARG STRING_ARG STRING_ARG  */
+#line 1934 "./util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_tag_action:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_actions,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4226,12 +4557,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4230 "util/configparser.c" /* yacc.c:1646  */
+#line 4561 "util/configparser.c"
     break;
 
-  case 349:
-#line 1674 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 406: /* server_access_control_tag_data: VAR_ACCESS_CONTROL_TAG_DATA STRING_ARG STRING_ARG STRING_ARG  */
+#line 1946 "./util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_tag_data:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_datas,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4241,12 +4572,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4245 "util/configparser.c" /* yacc.c:1646  */
+#line 4576 "util/configparser.c"
     break;
 
-  case 350:
-#line 1686 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 407: /* server_local_zone_override: VAR_LOCAL_ZONE_OVERRIDE STRING_ARG STRING_ARG STRING_ARG  */
+#line 1958 "./util/configparser.y"
+        {
 		OUTYY(("P(server_local_zone_override:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->local_zone_overrides,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4256,12 +4587,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4260 "util/configparser.c" /* yacc.c:1646  */
+#line 4591 "util/configparser.c"
     break;
 
-  case 351:
-#line 1698 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 408: /* server_access_control_view: VAR_ACCESS_CONTROL_VIEW STRING_ARG STRING_ARG  */
+#line 1970 "./util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_view:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->acl_view,
 			(yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4270,12 +4601,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4274 "util/configparser.c" /* yacc.c:1646  */
+#line 4605 "util/configparser.c"
     break;
 
-  case 352:
-#line 1709 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 409: /* server_response_ip_tag: VAR_RESPONSE_IP_TAG STRING_ARG STRING_ARG  */
+#line 1981 "./util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -4292,58 +4623,58 @@ yyreduce:
 			}
 		}
 	}
-#line 4296 "util/configparser.c" /* yacc.c:1646  */
+#line 4627 "util/configparser.c"
     break;
 
-  case 353:
-#line 1728 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 410: /* server_ip_ratelimit: VAR_IP_RATELIMIT STRING_ARG  */
+#line 2000 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_ip_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ip_ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4308 "util/configparser.c" /* yacc.c:1646  */
+#line 4639 "util/configparser.c"
     break;
 
-  case 354:
-#line 1738 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 411: /* server_ratelimit: VAR_RATELIMIT STRING_ARG  */
+#line 2010 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4320 "util/configparser.c" /* yacc.c:1646  */
+#line 4651 "util/configparser.c"
     break;
 
-  case 355:
-#line 1747 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 412: /* server_ip_ratelimit_size: VAR_IP_RATELIMIT_SIZE STRING_ARG  */
+#line 2019 "./util/configparser.y"
+  {
   	OUTYY(("P(server_ip_ratelimit_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ip_ratelimit_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 4331 "util/configparser.c" /* yacc.c:1646  */
+#line 4662 "util/configparser.c"
     break;
 
-  case 356:
-#line 1755 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 413: /* server_ratelimit_size: VAR_RATELIMIT_SIZE STRING_ARG  */
+#line 2027 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ratelimit_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4342 "util/configparser.c" /* yacc.c:1646  */
+#line 4673 "util/configparser.c"
     break;
 
-  case 357:
-#line 1763 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 414: /* server_ip_ratelimit_slabs: VAR_IP_RATELIMIT_SLABS STRING_ARG  */
+#line 2035 "./util/configparser.y"
+  {
   	OUTYY(("P(server_ip_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
   		yyerror("number expected");
@@ -4354,12 +4685,12 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 4358 "util/configparser.c" /* yacc.c:1646  */
+#line 4689 "util/configparser.c"
     break;
 
-  case 358:
-#line 1776 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 415: /* server_ratelimit_slabs: VAR_RATELIMIT_SLABS STRING_ARG  */
+#line 2048 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -4370,12 +4701,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4374 "util/configparser.c" /* yacc.c:1646  */
+#line 4705 "util/configparser.c"
     break;
 
-  case 359:
-#line 1789 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 416: /* server_ratelimit_for_domain: VAR_RATELIMIT_FOR_DOMAIN STRING_ARG STRING_ARG  */
+#line 2061 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_for_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
@@ -4386,12 +4717,12 @@ yyreduce:
 					"ratelimit-for-domain");
 		}
 	}
-#line 4390 "util/configparser.c" /* yacc.c:1646  */
+#line 4721 "util/configparser.c"
     break;
 
-  case 360:
-#line 1802 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 417: /* server_ratelimit_below_domain: VAR_RATELIMIT_BELOW_DOMAIN STRING_ARG STRING_ARG  */
+#line 2074 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_below_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
@@ -4402,36 +4733,99 @@ yyreduce:
 					"ratelimit-below-domain");
 		}
 	}
-#line 4406 "util/configparser.c" /* yacc.c:1646  */
+#line 4737 "util/configparser.c"
     break;
 
-  case 361:
-#line 1815 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 418: /* server_ip_ratelimit_factor: VAR_IP_RATELIMIT_FACTOR STRING_ARG  */
+#line 2087 "./util/configparser.y"
+  { 
   	OUTYY(("P(server_ip_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
   	if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
   		yyerror("number expected");
   	else cfg_parser->cfg->ip_ratelimit_factor = atoi((yyvsp[0].str));
   	free((yyvsp[0].str));
 	}
-#line 4418 "util/configparser.c" /* yacc.c:1646  */
+#line 4749 "util/configparser.c"
+    break;
+
+  case 419: /* server_ip_ratelimit_burst: VAR_IP_RATELIMIT_BURST STRING_ARG  */
+#line 2096 "./util/configparser.y"
+        {
+		OUTYY(("P(server_ip_ratelimit_burst:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->ip_ratelimit_burst = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4761 "util/configparser.c"
+    break;
+
+  case 420: /* server_ratelimit_burst: VAR_RATELIMIT_BURST STRING_ARG  */
+#line 2105 "./util/configparser.y"
+        {
+		OUTYY(("P(server_ratelimit_burst:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->ratelimit_burst = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4773 "util/configparser.c"
+    break;
+
+  case 421: /* server_ip_ratelimit_ipv4_prefix: VAR_IP_RATELIMIT_IPV4_PREFIX STRING_ARG  */
+#line 2114 "./util/configparser.y"
+        {
+		OUTYY(("P(server_ip_ratelimit_ipv4_prefix:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) > 32)
+			yyerror("ipv4 prefix length must be 32 or less");
+		else cfg_parser->cfg->ip_ratelimit_ipv4_prefix = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4787 "util/configparser.c"
+    break;
+
+  case 422: /* server_ip_ratelimit_ipv6_prefix: VAR_IP_RATELIMIT_IPV6_PREFIX STRING_ARG  */
+#line 2125 "./util/configparser.y"
+        {
+		OUTYY(("P(server_ip_ratelimit_ipv6_prefix:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) > 128)
+			yyerror("ipv6 prefix length must be 128 or less");
+		else cfg_parser->cfg->ip_ratelimit_ipv6_prefix = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4801 "util/configparser.c"
+    break;
+
+  case 423: /* server_ip_ratelimit_exempt: VAR_IP_RATELIMIT_EXEMPT STRING_ARG  */
+#line 2136 "./util/configparser.y"
+        {
+		OUTYY(("P(server_ip_ratelimit_exempt:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->ip_ratelimit_exempt,
+			(yyvsp[0].str)))
+			yyerror("out of memory");
+	}
+#line 4812 "util/configparser.c"
     break;
 
-  case 362:
-#line 1824 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 424: /* server_ratelimit_factor: VAR_RATELIMIT_FACTOR STRING_ARG  */
+#line 2144 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ratelimit_factor = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4430 "util/configparser.c" /* yacc.c:1646  */
+#line 4824 "util/configparser.c"
     break;
 
-  case 363:
-#line 1833 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 425: /* server_qname_minimisation: VAR_QNAME_MINIMISATION STRING_ARG  */
+#line 2153 "./util/configparser.y"
+        {
 		OUTYY(("P(server_qname_minimisation:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4439,12 +4833,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4443 "util/configparser.c" /* yacc.c:1646  */
+#line 4837 "util/configparser.c"
     break;
 
-  case 364:
-#line 1843 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 426: /* server_qname_minimisation_strict: VAR_QNAME_MINIMISATION_STRICT STRING_ARG  */
+#line 2163 "./util/configparser.y"
+        {
 		OUTYY(("P(server_qname_minimisation_strict:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4452,12 +4846,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4456 "util/configparser.c" /* yacc.c:1646  */
+#line 4850 "util/configparser.c"
     break;
 
-  case 365:
-#line 1853 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 427: /* server_ipsecmod_enabled: VAR_IPSECMOD_ENABLED STRING_ARG  */
+#line 2173 "./util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_enabled:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4468,12 +4862,12 @@ yyreduce:
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4472 "util/configparser.c" /* yacc.c:1646  */
+#line 4866 "util/configparser.c"
     break;
 
-  case 366:
-#line 1866 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 428: /* server_ipsecmod_ignore_bogus: VAR_IPSECMOD_IGNORE_BOGUS STRING_ARG  */
+#line 2186 "./util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_ignore_bogus:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4484,12 +4878,12 @@ yyreduce:
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4488 "util/configparser.c" /* yacc.c:1646  */
+#line 4882 "util/configparser.c"
     break;
 
-  case 367:
-#line 1879 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 429: /* server_ipsecmod_hook: VAR_IPSECMOD_HOOK STRING_ARG  */
+#line 2199 "./util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_hook:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ipsecmod_hook);
@@ -4498,12 +4892,12 @@ yyreduce:
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4502 "util/configparser.c" /* yacc.c:1646  */
+#line 4896 "util/configparser.c"
     break;
 
-  case 368:
-#line 1890 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 430: /* server_ipsecmod_max_ttl: VAR_IPSECMOD_MAX_TTL STRING_ARG  */
+#line 2210 "./util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_max_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4514,12 +4908,12 @@ yyreduce:
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4518 "util/configparser.c" /* yacc.c:1646  */
+#line 4912 "util/configparser.c"
     break;
 
-  case 369:
-#line 1903 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 431: /* server_ipsecmod_whitelist: VAR_IPSECMOD_WHITELIST STRING_ARG  */
+#line 2223 "./util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_whitelist:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->ipsecmod_whitelist, (yyvsp[0].str)))
@@ -4528,12 +4922,12 @@ yyreduce:
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4532 "util/configparser.c" /* yacc.c:1646  */
+#line 4926 "util/configparser.c"
     break;
 
-  case 370:
-#line 1914 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 432: /* server_ipsecmod_strict: VAR_IPSECMOD_STRICT STRING_ARG  */
+#line 2234 "./util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_strict:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4544,12 +4938,12 @@ yyreduce:
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4548 "util/configparser.c" /* yacc.c:1646  */
+#line 4942 "util/configparser.c"
     break;
 
-  case 371:
-#line 1927 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 433: /* stub_name: VAR_NAME STRING_ARG  */
+#line 2247 "./util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->stubs->name)
 			yyerror("stub name override, there must be one name "
@@ -4557,44 +4951,44 @@ yyreduce:
 		free(cfg_parser->cfg->stubs->name);
 		cfg_parser->cfg->stubs->name = (yyvsp[0].str);
 	}
-#line 4561 "util/configparser.c" /* yacc.c:1646  */
+#line 4955 "util/configparser.c"
     break;
 
-  case 372:
-#line 1937 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 434: /* stub_host: VAR_STUB_HOST STRING_ARG  */
+#line 2257 "./util/configparser.y"
+        {
 		OUTYY(("P(stub-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4571 "util/configparser.c" /* yacc.c:1646  */
+#line 4965 "util/configparser.c"
     break;
 
-  case 373:
-#line 1944 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 435: /* stub_addr: VAR_STUB_ADDR STRING_ARG  */
+#line 2264 "./util/configparser.y"
+        {
 		OUTYY(("P(stub-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4581 "util/configparser.c" /* yacc.c:1646  */
+#line 4975 "util/configparser.c"
     break;
 
-  case 374:
-#line 1951 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 436: /* stub_first: VAR_STUB_FIRST STRING_ARG  */
+#line 2271 "./util/configparser.y"
+        {
 		OUTYY(("P(stub-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stubs->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4593 "util/configparser.c" /* yacc.c:1646  */
+#line 4987 "util/configparser.c"
     break;
 
-  case 375:
-#line 1960 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 437: /* stub_ssl_upstream: VAR_STUB_SSL_UPSTREAM STRING_ARG  */
+#line 2280 "./util/configparser.y"
+        {
 		OUTYY(("P(stub-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4602,12 +4996,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4606 "util/configparser.c" /* yacc.c:1646  */
+#line 5000 "util/configparser.c"
     break;
 
-  case 376:
-#line 1970 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 438: /* stub_prime: VAR_STUB_PRIME STRING_ARG  */
+#line 2290 "./util/configparser.y"
+        {
 		OUTYY(("P(stub-prime:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4615,12 +5009,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4619 "util/configparser.c" /* yacc.c:1646  */
+#line 5013 "util/configparser.c"
     break;
 
-  case 377:
-#line 1980 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 439: /* forward_name: VAR_NAME STRING_ARG  */
+#line 2300 "./util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->forwards->name)
 			yyerror("forward name override, there must be one "
@@ -4628,44 +5022,44 @@ yyreduce:
 		free(cfg_parser->cfg->forwards->name);
 		cfg_parser->cfg->forwards->name = (yyvsp[0].str);
 	}
-#line 4632 "util/configparser.c" /* yacc.c:1646  */
+#line 5026 "util/configparser.c"
     break;
 
-  case 378:
-#line 1990 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 440: /* forward_host: VAR_FORWARD_HOST STRING_ARG  */
+#line 2310 "./util/configparser.y"
+        {
 		OUTYY(("P(forward-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4642 "util/configparser.c" /* yacc.c:1646  */
+#line 5036 "util/configparser.c"
     break;
 
-  case 379:
-#line 1997 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 441: /* forward_addr: VAR_FORWARD_ADDR STRING_ARG  */
+#line 2317 "./util/configparser.y"
+        {
 		OUTYY(("P(forward-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4652 "util/configparser.c" /* yacc.c:1646  */
+#line 5046 "util/configparser.c"
     break;
 
-  case 380:
-#line 2004 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 442: /* forward_first: VAR_FORWARD_FIRST STRING_ARG  */
+#line 2324 "./util/configparser.y"
+        {
 		OUTYY(("P(forward-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->forwards->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4664 "util/configparser.c" /* yacc.c:1646  */
+#line 5058 "util/configparser.c"
     break;
 
-  case 381:
-#line 2013 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 443: /* forward_ssl_upstream: VAR_FORWARD_SSL_UPSTREAM STRING_ARG  */
+#line 2333 "./util/configparser.y"
+        {
 		OUTYY(("P(forward-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4673,12 +5067,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4677 "util/configparser.c" /* yacc.c:1646  */
+#line 5071 "util/configparser.c"
     break;
 
-  case 382:
-#line 2023 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 444: /* auth_name: VAR_NAME STRING_ARG  */
+#line 2343 "./util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->auths->name)
 			yyerror("auth name override, there must be one name "
@@ -4686,42 +5080,42 @@ yyreduce:
 		free(cfg_parser->cfg->auths->name);
 		cfg_parser->cfg->auths->name = (yyvsp[0].str);
 	}
-#line 4690 "util/configparser.c" /* yacc.c:1646  */
+#line 5084 "util/configparser.c"
     break;
 
-  case 383:
-#line 2033 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 445: /* auth_zonefile: VAR_ZONEFILE STRING_ARG  */
+#line 2353 "./util/configparser.y"
+        {
 		OUTYY(("P(zonefile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->auths->zonefile);
 		cfg_parser->cfg->auths->zonefile = (yyvsp[0].str);
 	}
-#line 4700 "util/configparser.c" /* yacc.c:1646  */
+#line 5094 "util/configparser.c"
     break;
 
-  case 384:
-#line 2040 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 446: /* auth_master: VAR_MASTER STRING_ARG  */
+#line 2360 "./util/configparser.y"
+        {
 		OUTYY(("P(master:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->masters, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4710 "util/configparser.c" /* yacc.c:1646  */
+#line 5104 "util/configparser.c"
     break;
 
-  case 385:
-#line 2047 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 447: /* auth_url: VAR_URL STRING_ARG  */
+#line 2367 "./util/configparser.y"
+        {
 		OUTYY(("P(url:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->urls, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4720 "util/configparser.c" /* yacc.c:1646  */
+#line 5114 "util/configparser.c"
     break;
 
-  case 386:
-#line 2054 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 448: /* auth_for_downstream: VAR_FOR_DOWNSTREAM STRING_ARG  */
+#line 2374 "./util/configparser.y"
+        {
 		OUTYY(("P(for-downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4729,12 +5123,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4733 "util/configparser.c" /* yacc.c:1646  */
+#line 5127 "util/configparser.c"
     break;
 
-  case 387:
-#line 2064 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 449: /* auth_for_upstream: VAR_FOR_UPSTREAM STRING_ARG  */
+#line 2384 "./util/configparser.y"
+        {
 		OUTYY(("P(for-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4742,12 +5136,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4746 "util/configparser.c" /* yacc.c:1646  */
+#line 5140 "util/configparser.c"
     break;
 
-  case 388:
-#line 2074 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 450: /* view_name: VAR_NAME STRING_ARG  */
+#line 2394 "./util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->views->name)
 			yyerror("view name override, there must be one "
@@ -4755,12 +5149,12 @@ yyreduce:
 		free(cfg_parser->cfg->views->name);
 		cfg_parser->cfg->views->name = (yyvsp[0].str);
 	}
-#line 4759 "util/configparser.c" /* yacc.c:1646  */
+#line 5153 "util/configparser.c"
     break;
 
-  case 389:
-#line 2084 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 451: /* view_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 2404 "./util/configparser.y"
+        {
 		OUTYY(("P(view_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
 		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
@@ -4787,12 +5181,12 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 4791 "util/configparser.c" /* yacc.c:1646  */
+#line 5185 "util/configparser.c"
     break;
 
-  case 390:
-#line 2113 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 452: /* view_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 2433 "./util/configparser.y"
+        {
 		OUTYY(("P(view_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
 		if(!cfg_str2list_insert(
@@ -4800,35 +5194,35 @@ yyreduce:
 			fatal_exit("out of memory adding per-view "
 				"response-ip action");
 	}
-#line 4804 "util/configparser.c" /* yacc.c:1646  */
+#line 5198 "util/configparser.c"
     break;
 
-  case 391:
-#line 2123 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 453: /* view_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 2443 "./util/configparser.y"
+        {
 		OUTYY(("P(view_response_ip_data:%s)\n", (yyvsp[-1].str)));
 		if(!cfg_str2list_insert(
 			&cfg_parser->cfg->views->respip_data, (yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip-data");
 	}
-#line 4815 "util/configparser.c" /* yacc.c:1646  */
+#line 5209 "util/configparser.c"
     break;
 
-  case 392:
-#line 2131 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 454: /* view_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 2451 "./util/configparser.y"
+        {
 		OUTYY(("P(view_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->views->local_data, (yyvsp[0].str))) {
 			fatal_exit("out of memory adding local-data");
 			free((yyvsp[0].str));
 		}
 	}
-#line 4827 "util/configparser.c" /* yacc.c:1646  */
+#line 5221 "util/configparser.c"
     break;
 
-  case 393:
-#line 2140 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 455: /* view_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 2460 "./util/configparser.y"
+        {
 		char* ptr;
 		OUTYY(("P(view_local_data_ptr:%s)\n", (yyvsp[0].str)));
 		ptr = cfg_ptr_reverse((yyvsp[0].str));
@@ -4841,32 +5235,32 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 4845 "util/configparser.c" /* yacc.c:1646  */
+#line 5239 "util/configparser.c"
     break;
 
-  case 394:
-#line 2155 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 456: /* view_first: VAR_VIEW_FIRST STRING_ARG  */
+#line 2475 "./util/configparser.y"
+        {
 		OUTYY(("P(view-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->views->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4857 "util/configparser.c" /* yacc.c:1646  */
+#line 5251 "util/configparser.c"
     break;
 
-  case 395:
-#line 2164 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 457: /* rcstart: VAR_REMOTE_CONTROL  */
+#line 2484 "./util/configparser.y"
+        { 
 		OUTYY(("\nP(remote-control:)\n")); 
 	}
-#line 4865 "util/configparser.c" /* yacc.c:1646  */
+#line 5259 "util/configparser.c"
     break;
 
-  case 406:
-#line 2175 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 468: /* rc_control_enable: VAR_CONTROL_ENABLE STRING_ARG  */
+#line 2495 "./util/configparser.y"
+        {
 		OUTYY(("P(control_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4874,34 +5268,34 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4878 "util/configparser.c" /* yacc.c:1646  */
+#line 5272 "util/configparser.c"
     break;
 
-  case 407:
-#line 2185 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 469: /* rc_control_port: VAR_CONTROL_PORT STRING_ARG  */
+#line 2505 "./util/configparser.y"
+        {
 		OUTYY(("P(control_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("control port number expected");
 		else cfg_parser->cfg->control_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4890 "util/configparser.c" /* yacc.c:1646  */
+#line 5284 "util/configparser.c"
     break;
 
-  case 408:
-#line 2194 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 470: /* rc_control_interface: VAR_CONTROL_INTERFACE STRING_ARG  */
+#line 2514 "./util/configparser.y"
+        {
 		OUTYY(("P(control_interface:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->control_ifs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4900 "util/configparser.c" /* yacc.c:1646  */
+#line 5294 "util/configparser.c"
     break;
 
-  case 409:
-#line 2201 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 471: /* rc_control_use_cert: VAR_CONTROL_USE_CERT STRING_ARG  */
+#line 2521 "./util/configparser.y"
+        {
 		OUTYY(("P(control_use_cert:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4909,213 +5303,213 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4913 "util/configparser.c" /* yacc.c:1646  */
+#line 5307 "util/configparser.c"
     break;
 
-  case 410:
-#line 2211 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 472: /* rc_server_key_file: VAR_SERVER_KEY_FILE STRING_ARG  */
+#line 2531 "./util/configparser.y"
+        {
 		OUTYY(("P(rc_server_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_key_file);
 		cfg_parser->cfg->server_key_file = (yyvsp[0].str);
 	}
-#line 4923 "util/configparser.c" /* yacc.c:1646  */
+#line 5317 "util/configparser.c"
     break;
 
-  case 411:
-#line 2218 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 473: /* rc_server_cert_file: VAR_SERVER_CERT_FILE STRING_ARG  */
+#line 2538 "./util/configparser.y"
+        {
 		OUTYY(("P(rc_server_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_cert_file);
 		cfg_parser->cfg->server_cert_file = (yyvsp[0].str);
 	}
-#line 4933 "util/configparser.c" /* yacc.c:1646  */
+#line 5327 "util/configparser.c"
     break;
 
-  case 412:
-#line 2225 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 474: /* rc_control_key_file: VAR_CONTROL_KEY_FILE STRING_ARG  */
+#line 2545 "./util/configparser.y"
+        {
 		OUTYY(("P(rc_control_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_key_file);
 		cfg_parser->cfg->control_key_file = (yyvsp[0].str);
 	}
-#line 4943 "util/configparser.c" /* yacc.c:1646  */
+#line 5337 "util/configparser.c"
     break;
 
-  case 413:
-#line 2232 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 475: /* rc_control_cert_file: VAR_CONTROL_CERT_FILE STRING_ARG  */
+#line 2552 "./util/configparser.y"
+        {
 		OUTYY(("P(rc_control_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_cert_file);
 		cfg_parser->cfg->control_cert_file = (yyvsp[0].str);
 	}
-#line 4953 "util/configparser.c" /* yacc.c:1646  */
+#line 5347 "util/configparser.c"
     break;
 
-  case 414:
-#line 2239 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 476: /* dtstart: VAR_DNSTAP  */
+#line 2559 "./util/configparser.y"
+        {
 		OUTYY(("\nP(dnstap:)\n"));
 	}
-#line 4961 "util/configparser.c" /* yacc.c:1646  */
+#line 5355 "util/configparser.c"
     break;
 
-  case 429:
-#line 2256 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 491: /* dt_dnstap_enable: VAR_DNSTAP_ENABLE STRING_ARG  */
+#line 2576 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4972 "util/configparser.c" /* yacc.c:1646  */
+#line 5366 "util/configparser.c"
     break;
 
-  case 430:
-#line 2264 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 492: /* dt_dnstap_socket_path: VAR_DNSTAP_SOCKET_PATH STRING_ARG  */
+#line 2584 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_socket_path:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_socket_path);
 		cfg_parser->cfg->dnstap_socket_path = (yyvsp[0].str);
 	}
-#line 4982 "util/configparser.c" /* yacc.c:1646  */
+#line 5376 "util/configparser.c"
     break;
 
-  case 431:
-#line 2271 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 493: /* dt_dnstap_send_identity: VAR_DNSTAP_SEND_IDENTITY STRING_ARG  */
+#line 2591 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_send_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_send_identity = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4993 "util/configparser.c" /* yacc.c:1646  */
+#line 5387 "util/configparser.c"
     break;
 
-  case 432:
-#line 2279 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 494: /* dt_dnstap_send_version: VAR_DNSTAP_SEND_VERSION STRING_ARG  */
+#line 2599 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_send_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_send_version = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5004 "util/configparser.c" /* yacc.c:1646  */
+#line 5398 "util/configparser.c"
     break;
 
-  case 433:
-#line 2287 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 495: /* dt_dnstap_identity: VAR_DNSTAP_IDENTITY STRING_ARG  */
+#line 2607 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_identity);
 		cfg_parser->cfg->dnstap_identity = (yyvsp[0].str);
 	}
-#line 5014 "util/configparser.c" /* yacc.c:1646  */
+#line 5408 "util/configparser.c"
     break;
 
-  case 434:
-#line 2294 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 496: /* dt_dnstap_version: VAR_DNSTAP_VERSION STRING_ARG  */
+#line 2614 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_version);
 		cfg_parser->cfg->dnstap_version = (yyvsp[0].str);
 	}
-#line 5024 "util/configparser.c" /* yacc.c:1646  */
+#line 5418 "util/configparser.c"
     break;
 
-  case 435:
-#line 2301 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 497: /* dt_dnstap_log_resolver_query_messages: VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES STRING_ARG  */
+#line 2621 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_resolver_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_resolver_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5036 "util/configparser.c" /* yacc.c:1646  */
+#line 5430 "util/configparser.c"
     break;
 
-  case 436:
-#line 2310 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 498: /* dt_dnstap_log_resolver_response_messages: VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2630 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_resolver_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_resolver_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5048 "util/configparser.c" /* yacc.c:1646  */
+#line 5442 "util/configparser.c"
     break;
 
-  case 437:
-#line 2319 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 499: /* dt_dnstap_log_client_query_messages: VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES STRING_ARG  */
+#line 2639 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_client_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_client_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5060 "util/configparser.c" /* yacc.c:1646  */
+#line 5454 "util/configparser.c"
     break;
 
-  case 438:
-#line 2328 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 500: /* dt_dnstap_log_client_response_messages: VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES STRING_ARG  */
+#line 2648 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_client_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_client_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5072 "util/configparser.c" /* yacc.c:1646  */
+#line 5466 "util/configparser.c"
     break;
 
-  case 439:
-#line 2337 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 501: /* dt_dnstap_log_forwarder_query_messages: VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES STRING_ARG  */
+#line 2657 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_forwarder_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_forwarder_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5084 "util/configparser.c" /* yacc.c:1646  */
+#line 5478 "util/configparser.c"
     break;
 
-  case 440:
-#line 2346 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 502: /* dt_dnstap_log_forwarder_response_messages: VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2666 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_forwarder_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_forwarder_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5096 "util/configparser.c" /* yacc.c:1646  */
+#line 5490 "util/configparser.c"
     break;
 
-  case 441:
-#line 2355 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 503: /* pythonstart: VAR_PYTHON  */
+#line 2675 "./util/configparser.y"
+        { 
 		OUTYY(("\nP(python:)\n")); 
 	}
-#line 5104 "util/configparser.c" /* yacc.c:1646  */
+#line 5498 "util/configparser.c"
     break;
 
-  case 445:
-#line 2364 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 507: /* py_script: VAR_PYTHON_SCRIPT STRING_ARG  */
+#line 2684 "./util/configparser.y"
+        {
 		OUTYY(("P(python-script:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->python_script);
 		cfg_parser->cfg->python_script = (yyvsp[0].str);
 	}
-#line 5114 "util/configparser.c" /* yacc.c:1646  */
+#line 5508 "util/configparser.c"
     break;
 
-  case 446:
-#line 2370 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 508: /* server_disable_dnssec_lame_check: VAR_DISABLE_DNSSEC_LAME_CHECK STRING_ARG  */
+#line 2690 "./util/configparser.y"
+        {
 		OUTYY(("P(disable_dnssec_lame_check:%s)\n", (yyvsp[0].str)));
 		if (strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5123,66 +5517,66 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5127 "util/configparser.c" /* yacc.c:1646  */
+#line 5521 "util/configparser.c"
     break;
 
-  case 447:
-#line 2380 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 509: /* server_log_identity: VAR_LOG_IDENTITY STRING_ARG  */
+#line 2700 "./util/configparser.y"
+        {
 		OUTYY(("P(server_log_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->log_identity);
 		cfg_parser->cfg->log_identity = (yyvsp[0].str);
 	}
-#line 5137 "util/configparser.c" /* yacc.c:1646  */
+#line 5531 "util/configparser.c"
     break;
 
-  case 448:
-#line 2387 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 510: /* server_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 2707 "./util/configparser.y"
+        {
 		OUTYY(("P(server_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->respip_actions,
 			(yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip");
 	}
-#line 5149 "util/configparser.c" /* yacc.c:1646  */
+#line 5543 "util/configparser.c"
     break;
 
-  case 449:
-#line 2396 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 511: /* server_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 2716 "./util/configparser.y"
+        {
 		OUTYY(("P(server_response_ip_data:%s)\n", (yyvsp[-1].str)));
 			if(!cfg_str2list_insert(&cfg_parser->cfg->respip_data,
 				(yyvsp[-1].str), (yyvsp[0].str)))
 				fatal_exit("out of memory adding response-ip-data");
 	}
-#line 5160 "util/configparser.c" /* yacc.c:1646  */
+#line 5554 "util/configparser.c"
     break;
 
-  case 450:
-#line 2404 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 512: /* dnscstart: VAR_DNSCRYPT  */
+#line 2724 "./util/configparser.y"
+        {
 		OUTYY(("\nP(dnscrypt:)\n"));
 		OUTYY(("\nP(dnscrypt:)\n"));
 	}
-#line 5169 "util/configparser.c" /* yacc.c:1646  */
+#line 5563 "util/configparser.c"
     break;
 
-  case 463:
-#line 2421 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 525: /* dnsc_dnscrypt_enable: VAR_DNSCRYPT_ENABLE STRING_ARG  */
+#line 2741 "./util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnscrypt = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5181 "util/configparser.c" /* yacc.c:1646  */
+#line 5575 "util/configparser.c"
     break;
 
-  case 464:
-#line 2431 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 526: /* dnsc_dnscrypt_port: VAR_DNSCRYPT_PORT STRING_ARG  */
+#line 2751 "./util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_port:%s)\n", (yyvsp[0].str)));
 
 		if(atoi((yyvsp[0].str)) == 0)
@@ -5190,67 +5584,67 @@ yyreduce:
 		else cfg_parser->cfg->dnscrypt_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5194 "util/configparser.c" /* yacc.c:1646  */
+#line 5588 "util/configparser.c"
     break;
 
-  case 465:
-#line 2441 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 527: /* dnsc_dnscrypt_provider: VAR_DNSCRYPT_PROVIDER STRING_ARG  */
+#line 2761 "./util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_provider:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnscrypt_provider);
 		cfg_parser->cfg->dnscrypt_provider = (yyvsp[0].str);
 	}
-#line 5204 "util/configparser.c" /* yacc.c:1646  */
+#line 5598 "util/configparser.c"
     break;
 
-  case 466:
-#line 2448 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 528: /* dnsc_dnscrypt_provider_cert: VAR_DNSCRYPT_PROVIDER_CERT STRING_ARG  */
+#line 2768 "./util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_provider_cert:%s)\n", (yyvsp[0].str)));
 		if(cfg_strlist_find(cfg_parser->cfg->dnscrypt_provider_cert, (yyvsp[0].str)))
 			log_warn("dnscrypt-provider-cert %s is a duplicate", (yyvsp[0].str));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_provider_cert, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-provider-cert");
 	}
-#line 5216 "util/configparser.c" /* yacc.c:1646  */
+#line 5610 "util/configparser.c"
     break;
 
-  case 467:
-#line 2457 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 529: /* dnsc_dnscrypt_provider_cert_rotated: VAR_DNSCRYPT_PROVIDER_CERT_ROTATED STRING_ARG  */
+#line 2777 "./util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_provider_cert_rotated:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_provider_cert_rotated, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-provider-cert-rotated");
 	}
-#line 5226 "util/configparser.c" /* yacc.c:1646  */
+#line 5620 "util/configparser.c"
     break;
 
-  case 468:
-#line 2464 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 530: /* dnsc_dnscrypt_secret_key: VAR_DNSCRYPT_SECRET_KEY STRING_ARG  */
+#line 2784 "./util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_secret_key:%s)\n", (yyvsp[0].str)));
 		if(cfg_strlist_find(cfg_parser->cfg->dnscrypt_secret_key, (yyvsp[0].str)))
 			log_warn("dnscrypt-secret-key: %s is a duplicate", (yyvsp[0].str));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_secret_key, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-secret-key");
 	}
-#line 5238 "util/configparser.c" /* yacc.c:1646  */
+#line 5632 "util/configparser.c"
     break;
 
-  case 469:
-#line 2473 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 531: /* dnsc_dnscrypt_shared_secret_cache_size: VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE STRING_ARG  */
+#line 2793 "./util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_shared_secret_cache_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->dnscrypt_shared_secret_cache_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 5249 "util/configparser.c" /* yacc.c:1646  */
+#line 5643 "util/configparser.c"
     break;
 
-  case 470:
-#line 2481 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 532: /* dnsc_dnscrypt_shared_secret_cache_slabs: VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS STRING_ARG  */
+#line 2801 "./util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_shared_secret_cache_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
   		yyerror("number expected");
@@ -5261,23 +5655,23 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 5265 "util/configparser.c" /* yacc.c:1646  */
+#line 5659 "util/configparser.c"
     break;
 
-  case 471:
-#line 2494 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 533: /* dnsc_dnscrypt_nonce_cache_size: VAR_DNSCRYPT_NONCE_CACHE_SIZE STRING_ARG  */
+#line 2814 "./util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_nonce_cache_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->dnscrypt_nonce_cache_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 5276 "util/configparser.c" /* yacc.c:1646  */
+#line 5670 "util/configparser.c"
     break;
 
-  case 472:
-#line 2502 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 534: /* dnsc_dnscrypt_nonce_cache_slabs: VAR_DNSCRYPT_NONCE_CACHE_SLABS STRING_ARG  */
+#line 2822 "./util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_nonce_cache_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
   		yyerror("number expected");
@@ -5288,20 +5682,20 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 5292 "util/configparser.c" /* yacc.c:1646  */
+#line 5686 "util/configparser.c"
     break;
 
-  case 473:
-#line 2515 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 535: /* cachedbstart: VAR_CACHEDB  */
+#line 2835 "./util/configparser.y"
+        {
 		OUTYY(("\nP(cachedb:)\n"));
 	}
-#line 5300 "util/configparser.c" /* yacc.c:1646  */
+#line 5694 "util/configparser.c"
     break;
 
-  case 478:
-#line 2524 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 540: /* cachedb_backend_name: VAR_CACHEDB_BACKEND STRING_ARG  */
+#line 2844 "./util/configparser.y"
+        {
 	#ifdef USE_CACHEDB
 		OUTYY(("P(backend:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->cachedb_backend)
@@ -5313,12 +5707,12 @@ yyreduce:
 		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
 	#endif
 	}
-#line 5317 "util/configparser.c" /* yacc.c:1646  */
+#line 5711 "util/configparser.c"
     break;
 
-  case 479:
-#line 2538 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 541: /* cachedb_secret_seed: VAR_CACHEDB_SECRETSEED STRING_ARG  */
+#line 2858 "./util/configparser.y"
+        {
 	#ifdef USE_CACHEDB
 		OUTYY(("P(secret-seed:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->cachedb_secret)
@@ -5331,11 +5725,12 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 5335 "util/configparser.c" /* yacc.c:1646  */
+#line 5729 "util/configparser.c"
     break;
 
 
-#line 5339 "util/configparser.c" /* yacc.c:1646  */
+#line 5733 "util/configparser.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -5349,25 +5744,23 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -5378,50 +5771,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -5450,12 +5807,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -5472,13 +5828,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -5492,7 +5849,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -5504,7 +5861,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -5515,26 +5872,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -5550,20 +5911,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 2552 "./util/configparser.y" /* yacc.c:1906  */
+
+#line 2872 "./util/configparser.y"
 
 
 /* parse helper routines could be here */
@@ -154,6 +154,21 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_CACHEDB VAR_CACHEDB_BACKEND VAR_CACHEDB_SECRETSEED
 %token VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM VAR_FOR_UPSTREAM
 %token VAR_AUTH_ZONE VAR_ZONEFILE VAR_MASTER VAR_URL VAR_FOR_DOWNSTREAM
+%token VAR_UDP_BATCH_SIZE VAR_CACHE_CLOCK_EVICTION VAR_CACHE_SNAPSHOT_FILE
+%token VAR_WIRE_CACHE_SIZE
+%token VAR_INCOMING_TCP_PIPELINE VAR_INCOMING_TCP_PIPELINE_TOTAL
+%token VAR_TCP_REUSE_TIMEOUT VAR_MAX_REUSE_TCP_QUERIES
+%token VAR_COMPRESSION_HASH
+%token VAR_SO_REUSEPORT_CBPF VAR_CPU_AFFINITY VAR_CPU_AFFINITY_LIST
+%token VAR_INFLIGHT_DEDUP VAR_JOSTLE_ADAPTIVE VAR_OUTGOING_BATCH
+%token VAR_OUTGOING_PORT_POOL VAR_OUTGOING_PORT_POOL_USES
+%token VAR_INFRA_CACHE_SERVER_SHARED VAR_IP_RATELIMIT_BURST
+%token VAR_RATELIMIT_BURST VAR_IP_RATELIMIT_IPV4_PREFIX
+%token VAR_IP_RATELIMIT_IPV6_PREFIX VAR_IP_RATELIMIT_EXEMPT
+%token VAR_SERVER_SELECTION_PERCENTILE VAR_TARGET_FETCH_FANOUT
+%token VAR_SIG_CACHE_SIZE VAR_CRYPTO_THREADS VAR_NSEC3_CACHE_SIZE
+%token VAR_VAL_NSEC3_MAX_ITERATIONS
+%token VAR_NEG_CACHE_SLABS VAR_AGGRESSIVE_NSEC
 
 %%
 toplevelvars: /* empty */ | toplevelvars toplevelvar ;
@@ -242,7 +257,22 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_ipsecmod_enabled | server_ipsecmod_hook |
 	server_ipsecmod_ignore_bogus | server_ipsecmod_max_ttl |
 	server_ipsecmod_whitelist | server_ipsecmod_strict |
-	server_udp_upstream_without_downstream
+	server_udp_upstream_without_downstream | server_udp_batch_size |
+	server_cache_clock_eviction | server_cache_snapshot_file |
+	server_wire_cache_size | server_incoming_tcp_pipeline |
+	server_incoming_tcp_pipeline_total | server_tcp_reuse_timeout |
+	server_max_reuse_tcp_queries | server_compression_hash |
+	server_so_reuseport_cbpf | server_cpu_affinity |
+	server_cpu_affinity_list | server_inflight_dedup |
+	server_jostle_adaptive | server_outgoing_batch |
+	server_outgoing_port_pool | server_outgoing_port_pool_uses |
+	server_infra_cache_server_shared | server_ip_ratelimit_burst |
+	server_ratelimit_burst | server_ip_ratelimit_ipv4_prefix |
+	server_ip_ratelimit_ipv6_prefix | server_ip_ratelimit_exempt |
+	server_server_selection_percentile | server_target_fetch_fanout |
+	server_sig_cache_size | server_crypto_threads |
+	server_nsec3_cache_size | server_val_nsec3_max_iterations |
+	server_neg_cache_slabs | server_aggressive_nsec
 	;
 stubstart: VAR_STUB_ZONE
 	{
@@ -550,6 +580,42 @@ server_incoming_num_tcp: VAR_INCOMING_NUM_TCP STRING_ARG
 		free($2);
 	}
 	;
+server_incoming_tcp_pipeline: VAR_INCOMING_TCP_PIPELINE STRING_ARG
+	{
+		OUTYY(("P(server_incoming_tcp_pipeline:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->incoming_tcp_pipeline = atoi($2);
+		free($2);
+	}
+	;
+server_incoming_tcp_pipeline_total: VAR_INCOMING_TCP_PIPELINE_TOTAL STRING_ARG
+	{
+		OUTYY(("P(server_incoming_tcp_pipeline_total:%s)\n", $2));
+		if(atoi($2) <= 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->incoming_tcp_pipeline_total = atoi($2);
+		free($2);
+	}
+	;
+server_tcp_reuse_timeout: VAR_TCP_REUSE_TIMEOUT STRING_ARG
+	{
+		OUTYY(("P(server_tcp_reuse_timeout:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_reuse_timeout = atoi($2);
+		free($2);
+	}
+	;
+server_max_reuse_tcp_queries: VAR_MAX_REUSE_TCP_QUERIES STRING_ARG
+	{
+		OUTYY(("P(server_max_reuse_tcp_queries:%s)\n", $2));
+		if(atoi($2) <= 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->max_reuse_tcp_queries = atoi($2);
+		free($2);
+	}
+	;
 server_interface_automatic: VAR_INTERFACE_AUTOMATIC STRING_ARG
 	{
 		OUTYY(("P(server_interface_automatic:%s)\n", $2));
@@ -923,6 +989,15 @@ server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG
         free($2);
     }
     ;
+server_udp_batch_size: VAR_UDP_BATCH_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_udp_batch_size:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->udp_batch_size = atoi($2);
+		free($2);
+	}
+	;
 server_ip_transparent: VAR_IP_TRANSPARENT STRING_ARG
     {
         OUTYY(("P(server_ip_transparent:%s)\n", $2));
@@ -1056,6 +1131,31 @@ server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_cache_clock_eviction: VAR_CACHE_CLOCK_EVICTION STRING_ARG
+	{
+		OUTYY(("P(server_cache_clock_eviction:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_clock_eviction = 
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_cache_snapshot_file: VAR_CACHE_SNAPSHOT_FILE STRING_ARG
+	{
+		OUTYY(("P(server_cache_snapshot_file:%s)\n", $2));
+		free(cfg_parser->cfg->cache_snapshot_file);
+		cfg_parser->cfg->cache_snapshot_file = $2;
+	}
+	;
+server_wire_cache_size: VAR_WIRE_CACHE_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_wire_cache_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->wire_cache_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
 server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG
 	{
 		OUTYY(("P(server_infra_host_ttl:%s)\n", $2));
@@ -1492,6 +1592,40 @@ server_key_cache_size: VAR_KEY_CACHE_SIZE STRING_ARG
 		free($2);
 	}
 	;
+server_sig_cache_size: VAR_SIG_CACHE_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_sig_cache_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->sig_cache_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+server_nsec3_cache_size: VAR_NSEC3_CACHE_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_nsec3_cache_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->nsec3_cache_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+server_val_nsec3_max_iterations: VAR_VAL_NSEC3_MAX_ITERATIONS STRING_ARG
+	{
+		OUTYY(("P(server_val_nsec3_max_iterations:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->val_nsec3_max_iterations = atoi($2);
+		free($2);
+	}
+	;
+server_crypto_threads: VAR_CRYPTO_THREADS STRING_ARG
+	{
+		OUTYY(("P(server_crypto_threads:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->crypto_threads = atoi($2);
+		free($2);
+	}
+	;
 server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG
 	{
 		OUTYY(("P(server_key_cache_slabs:%s)\n", $2));
@@ -1513,6 +1647,29 @@ server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG
 		free($2);
 	}
 	;
+server_neg_cache_slabs: VAR_NEG_CACHE_SLABS STRING_ARG
+	{
+		OUTYY(("P(server_neg_cache_slabs:%s)\n", $2));
+		if(atoi($2) == 0)
+			yyerror("number expected");
+		else {
+			cfg_parser->cfg->neg_cache_slabs = atoi($2);
+			if(!is_pow2(cfg_parser->cfg->neg_cache_slabs))
+				yyerror("must be a power of 2");
+		}
+		free($2);
+	}
+	;
+server_aggressive_nsec: VAR_AGGRESSIVE_NSEC STRING_ARG
+	{
+		OUTYY(("P(server_aggressive_nsec:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->aggressive_nsec =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG
 	{
 		OUTYY(("P(server_local_zone:%s %s)\n", $2, $3));
@@ -1583,6 +1740,121 @@ server_rrset_roundrobin: VAR_RRSET_ROUNDROBIN STRING_ARG
 		free($2);
 	}
 	;
+server_compression_hash: VAR_COMPRESSION_HASH STRING_ARG
+	{
+		OUTYY(("P(server_compression_hash:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->compression_hash =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_so_reuseport_cbpf: VAR_SO_REUSEPORT_CBPF STRING_ARG
+	{
+		OUTYY(("P(server_so_reuseport_cbpf:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->so_reuseport_cbpf =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_cpu_affinity: VAR_CPU_AFFINITY STRING_ARG
+	{
+		OUTYY(("P(server_cpu_affinity:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cpu_affinity =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_cpu_affinity_list: VAR_CPU_AFFINITY_LIST STRING_ARG
+	{
+		OUTYY(("P(server_cpu_affinity_list:%s)\n", $2));
+		free(cfg_parser->cfg->cpu_affinity_list);
+		cfg_parser->cfg->cpu_affinity_list = $2;
+	}
+	;
+server_inflight_dedup: VAR_INFLIGHT_DEDUP STRING_ARG
+	{
+		OUTYY(("P(server_inflight_dedup:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->inflight_dedup =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_jostle_adaptive: VAR_JOSTLE_ADAPTIVE STRING_ARG
+	{
+		OUTYY(("P(server_jostle_adaptive:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->jostle_adaptive =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_outgoing_batch: VAR_OUTGOING_BATCH STRING_ARG
+	{
+		OUTYY(("P(server_outgoing_batch:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->outgoing_batch =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_outgoing_port_pool: VAR_OUTGOING_PORT_POOL STRING_ARG
+	{
+		OUTYY(("P(server_outgoing_port_pool:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->outgoing_port_pool = atoi($2);
+		free($2);
+	}
+	;
+server_outgoing_port_pool_uses: VAR_OUTGOING_PORT_POOL_USES STRING_ARG
+	{
+		OUTYY(("P(server_outgoing_port_pool_uses:%s)\n", $2));
+		if(atoi($2) == 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->outgoing_port_pool_uses = atoi($2);
+		free($2);
+	}
+	;
+server_infra_cache_server_shared: VAR_INFRA_CACHE_SERVER_SHARED STRING_ARG
+	{
+		OUTYY(("P(server_infra_cache_server_shared:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->infra_cache_server_shared =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_server_selection_percentile: VAR_SERVER_SELECTION_PERCENTILE STRING_ARG
+	{
+		OUTYY(("P(server_server_selection_percentile:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0 || atoi($2) > 100)
+			yyerror("percentile must be from 0 to 100");
+		else cfg_parser->cfg->server_selection_percentile = atoi($2);
+		free($2);
+	}
+	;
+server_target_fetch_fanout: VAR_TARGET_FETCH_FANOUT STRING_ARG
+	{
+		OUTYY(("P(server_target_fetch_fanout:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->target_fetch_fanout = atoi($2);
+		free($2);
+	}
+	;
 server_max_udp_size: VAR_MAX_UDP_SIZE STRING_ARG
 	{
 		OUTYY(("P(server_max_udp_size:%s)\n", $2));
@@ -1820,6 +2092,54 @@ server_ip_ratelimit_factor: VAR_IP_RATELIMIT_FACTOR STRING_ARG
   	free($2);
 	}
 	;
+server_ip_ratelimit_burst: VAR_IP_RATELIMIT_BURST STRING_ARG
+	{
+		OUTYY(("P(server_ip_ratelimit_burst:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->ip_ratelimit_burst = atoi($2);
+		free($2);
+	}
+	;
+server_ratelimit_burst: VAR_RATELIMIT_BURST STRING_ARG
+	{
+		OUTYY(("P(server_ratelimit_burst:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->ratelimit_burst = atoi($2);
+		free($2);
+	}
+	;
+server_ip_ratelimit_ipv4_prefix: VAR_IP_RATELIMIT_IPV4_PREFIX STRING_ARG
+	{
+		OUTYY(("P(server_ip_ratelimit_ipv4_prefix:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) > 32)
+			yyerror("ipv4 prefix length must be 32 or less");
+		else cfg_parser->cfg->ip_ratelimit_ipv4_prefix = atoi($2);
+		free($2);
+	}
+	;
+server_ip_ratelimit_ipv6_prefix: VAR_IP_RATELIMIT_IPV6_PREFIX STRING_ARG
+	{
+		OUTYY(("P(server_ip_ratelimit_ipv6_prefix:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) > 128)
+			yyerror("ipv6 prefix length must be 128 or less");
+		else cfg_parser->cfg->ip_ratelimit_ipv6_prefix = atoi($2);
+		free($2);
+	}
+	;
+server_ip_ratelimit_exempt: VAR_IP_RATELIMIT_EXEMPT STRING_ARG
+	{
+		OUTYY(("P(server_ip_ratelimit_exempt:%s)\n", $2));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->ip_ratelimit_exempt,
+			$2))
+			yyerror("out of memory");
+	}
+	;
 server_ratelimit_factor: VAR_RATELIMIT_FACTOR STRING_ARG 
 	{ 
 		OUTYY(("P(server_ratelimit_factor:%s)\n", $2)); 
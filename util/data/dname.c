@@ -46,6 +46,17 @@
 #include "util/log.h"
 #include "util/storage/lookup3.h"
 #include "sldns/sbuffer.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+#if defined(__x86_64__) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+/** AVX2 code is compiled with a target attribute, selected at runtime */
+#define DNAME_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
 
 /* determine length of a dname in buffer, no compression pointers allowed */
 size_t
@@ -93,6 +104,63 @@ dname_valid(uint8_t* dname, size_t maxlen)
 	return len;
 }
 
+#ifdef __SSE2__
+/** lowercase 16 bytes, the A-Z bytes get the 0x20 bit set */
+static __m128i
+lower_16(__m128i x)
+{
+	/* signed compares, bytes >= 0x80 are negative and stay as-is */
+	__m128i up = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('A'-1)),
+		_mm_cmplt_epi8(x, _mm_set1_epi8('Z'+1)));
+	return _mm_or_si128(x, _mm_and_si128(up, _mm_set1_epi8(0x20)));
+}
+#endif /* __SSE2__ */
+
+/** lowercase 8 bytes in a word, the A-Z bytes get the 0x20 bit set */
+static uint64_t
+lower_8(uint64_t x)
+{
+	const uint64_t hi = 0x8080808080808080ULL;
+	uint64_t h = x & ~hi;
+	/* per byte, high bit set if >= 'A', and if > 'Z', no carries */
+	uint64_t ge_a = h + 0x0101010101010101ULL*(0x80-'A');
+	uint64_t gt_z = h + 0x0101010101010101ULL*(0x7f-'Z');
+	uint64_t up = (ge_a ^ gt_z) & ~x & hi;
+	return x | (up >> 2);
+}
+
+int
+dname_lower_equal(uint8_t* d1, uint8_t* d2, size_t len)
+{
+	size_t i = 0;
+	/* keys stored in lowercase are the common case */
+	if(memcmp(d1, d2, len) == 0)
+		return 1;
+	/* label length bytes are below 'A', so the whole name can be
+	 * lowercased at once, without walking the labels */
+#ifdef __SSE2__
+	for(; i+16 <= len; i+=16) {
+		__m128i a = lower_16(_mm_loadu_si128((__m128i*)(d1+i)));
+		__m128i b = lower_16(_mm_loadu_si128((__m128i*)(d2+i)));
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xffff)
+			return 0;
+	}
+#else
+	for(; i+8 <= len; i+=8) {
+		uint64_t a, b;
+		memcpy(&a, d1+i, sizeof(a));
+		memcpy(&b, d2+i, sizeof(b));
+		if(lower_8(a) != lower_8(b))
+			return 0;
+	}
+#endif /* __SSE2__ */
+	for(; i < len; i++) {
+		if(DNAME_LOWER(d1[i]) != DNAME_LOWER(d2[i]))
+			return 0;
+	}
+	return 1;
+}
+
 /** compare uncompressed, noncanonical, registers are hints for speed */
 int 
 query_dname_compare(register uint8_t* d1, register uint8_t* d2)
@@ -113,9 +181,8 @@ query_dname_compare(register uint8_t* d1, register uint8_t* d2)
 		/* compare lowercased labels. */
 		while(lab1--) {
 			/* compare bytes first for speed */
-			if(*d1 != *d2 && 
-				tolower((unsigned char)*d1) != tolower((unsigned char)*d2)) {
-				if(tolower((unsigned char)*d1) < tolower((unsigned char)*d2))
+			if(*d1 != *d2 && DNAME_LOWER(*d1) != DNAME_LOWER(*d2)) {
+				if(DNAME_LOWER(*d1) < DNAME_LOWER(*d2))
 					return -1;
 				return 1;
 			}
@@ -138,7 +205,7 @@ query_dname_tolower(uint8_t* dname)
 	while(labellen) {
 		dname++;
 		while(labellen--) {
-			*dname = (uint8_t)tolower((unsigned char)*dname);
+			*dname = DNAME_LOWER(*dname);
 			dname++;
 		}
 		labellen = *dname;
@@ -270,58 +337,178 @@ dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 	return 0;
 }
 
+/** lowercase copy of the bytes after the vectors, a word at a time */
+static void
+lower_copy_tail(uint8_t* dst, uint8_t* src, size_t len)
+{
+	size_t i = 0;
+	for(; i+8 <= len; i+=8) {
+		uint64_t x;
+		memcpy(&x, src+i, sizeof(x));
+		x = lower_8(x);
+		memcpy(dst+i, &x, sizeof(x));
+	}
+	for(; i < len; i++)
+		dst[i] = DNAME_LOWER(src[i]);
+}
+
+#if !defined(__SSE2__) && !defined(__ARM_NEON)
+/** lowercase copy, scalar */
+static void
+lower_copy_scalar(uint8_t* dst, uint8_t* src, size_t len)
+{
+	lower_copy_tail(dst, src, len);
+}
+#endif /* !__SSE2__ && !__ARM_NEON */
+
+#ifdef __SSE2__
+/** lowercase copy, 16 bytes at a time */
+static void
+lower_copy_sse2(uint8_t* dst, uint8_t* src, size_t len)
+{
+	size_t i = 0;
+	for(; i+16 <= len; i+=16) {
+		__m128i x = _mm_loadu_si128((__m128i*)(src+i));
+		_mm_storeu_si128((__m128i*)(dst+i), lower_16(x));
+	}
+	lower_copy_tail(dst+i, src+i, len-i);
+}
+#endif /* __SSE2__ */
+
+#ifdef DNAME_HAVE_AVX2
+/** lowercase copy, 32 bytes at a time */
+static void __attribute__((target("avx2")))
+lower_copy_avx2(uint8_t* dst, uint8_t* src, size_t len)
+{
+	size_t i = 0;
+	for(; i+32 <= len; i+=32) {
+		__m256i x = _mm256_loadu_si256((__m256i*)(src+i));
+		__m256i up = _mm256_and_si256(
+			_mm256_cmpgt_epi8(x, _mm256_set1_epi8('A'-1)),
+			_mm256_cmpgt_epi8(_mm256_set1_epi8('Z'+1), x));
+		x = _mm256_or_si256(x, _mm256_and_si256(up,
+			_mm256_set1_epi8(0x20)));
+		_mm256_storeu_si256((__m256i*)(dst+i), x);
+	}
+	if(i+16 <= len) {
+		__m128i x = _mm_loadu_si128((__m128i*)(src+i));
+		_mm_storeu_si128((__m128i*)(dst+i), lower_16(x));
+		i += 16;
+	}
+	lower_copy_tail(dst+i, src+i, len-i);
+}
+#endif /* DNAME_HAVE_AVX2 */
+
+#ifdef __ARM_NEON
+/** lowercase copy, 16 bytes at a time */
+static void
+lower_copy_neon(uint8_t* dst, uint8_t* src, size_t len)
+{
+	size_t i = 0;
+	for(; i+16 <= len; i+=16) {
+		uint8x16_t x = vld1q_u8(src+i);
+		/* unsigned x-'A' <= 'Z'-'A' only for the uppercase letters */
+		uint8x16_t up = vcleq_u8(vsubq_u8(x, vdupq_n_u8('A')),
+			vdupq_n_u8('Z'-'A'));
+		vst1q_u8(dst+i, vorrq_u8(x, vandq_u8(up, vdupq_n_u8(0x20))));
+	}
+	lower_copy_tail(dst+i, src+i, len-i);
+}
+#endif /* __ARM_NEON */
+
+#if defined(__SSE2__)
+/** the lowercase copy routine for the dname hash */
+static void (*lower_copy)(uint8_t*, uint8_t*, size_t) = &lower_copy_sse2;
+/** name of the lowercase copy routine */
+static const char* lower_copy_name = "sse2";
+#elif defined(__ARM_NEON)
+/** the lowercase copy routine for the dname hash */
+static void (*lower_copy)(uint8_t*, uint8_t*, size_t) = &lower_copy_neon;
+/** name of the lowercase copy routine */
+static const char* lower_copy_name = "neon";
+#else
+/** the lowercase copy routine for the dname hash */
+static void (*lower_copy)(uint8_t*, uint8_t*, size_t) = &lower_copy_scalar;
+/** name of the lowercase copy routine */
+static const char* lower_copy_name = "scalar";
+#endif
+
+#ifdef DNAME_HAVE_AVX2
+/** pick the avx2 routine if this CPU has it.  It runs at program or
+ * library load, before threads are started, after that the pointer is
+ * only read. */
+static void __attribute__((constructor))
+lower_copy_pick(void)
+{
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2")) {
+		lower_copy_name = "avx2";
+		lower_copy = &lower_copy_avx2;
+	}
+}
+#endif /* DNAME_HAVE_AVX2 */
+
+const char*
+dname_hash_impl(void)
+{
+	return lower_copy_name;
+}
+
 hashvalue_type
 dname_query_hash(uint8_t* dname, hashvalue_type h)
 {
-	uint8_t labuf[LDNS_MAX_LABELLEN+1];
+	/* word aligned, for the fast path of hashlittle */
+	uint32_t bufw[(LDNS_MAX_DOMAINLEN+3)/sizeof(uint32_t)];
+	uint8_t* buf = (uint8_t*)bufw;
+	size_t len = 0;
 	uint8_t lablen;
-	int i;
 
-	/* preserve case of query, make hash label by label */
-	lablen = *dname++;
+	/* preserve case of query, hash a lowercased copy.  Label length
+	 * bytes are below 'A', the labels are lowercased at once */
+	lablen = dname[0];
 	while(lablen) {
 		log_assert(lablen <= LDNS_MAX_LABELLEN);
-		labuf[0] = lablen;
-		i=0;
-		while(lablen--) {
-			labuf[++i] = (uint8_t)tolower((unsigned char)*dname);
-			dname++;
-		}
-		h = hashlittle(labuf, labuf[0] + 1, h);
-		lablen = *dname++;
+		if(len+lablen+1 > LDNS_MAX_DOMAINLEN)
+			break;
+		len += lablen+1;
+		lablen = dname[len];
 	}
-
-	return h;
+	(*lower_copy)(buf, dname, len);
+	return hashlittle(buf, len, h);
 }
 
 hashvalue_type
 dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_type h)
 {
-	uint8_t labuf[LDNS_MAX_LABELLEN+1];
+	/* word aligned, for the fast path of hashlittle */
+	uint32_t bufw[(LDNS_MAX_DOMAINLEN+3)/sizeof(uint32_t)];
+	uint8_t* buf = (uint8_t*)bufw;
+	size_t len = 0, run = 0;
 	uint8_t lablen;
-	int i;
 
-	/* preserve case of query, make hash label by label */
-	lablen = *dname++;
+	/* preserve case of query, gather the labels and lowercase them,
+	 * the labels between compression pointers are copied at once */
+	lablen = dname[0];
 	while(lablen) {
 		if(LABEL_IS_PTR(lablen)) {
+			(*lower_copy)(buf+len, dname, run);
+			len += run;
 			/* follow pointer */
-			dname = sldns_buffer_at(pkt, PTR_OFFSET(lablen, *dname));
-			lablen = *dname++;
+			dname = sldns_buffer_at(pkt, PTR_OFFSET(lablen,
+				dname[run+1]));
+			run = 0;
+			lablen = dname[0];
 			continue;
 		}
 		log_assert(lablen <= LDNS_MAX_LABELLEN);
-		labuf[0] = lablen;
-		i=0;
-		while(lablen--) {
-			labuf[++i] = (uint8_t)tolower((unsigned char)*dname);
-			dname++;
-		}
-		h = hashlittle(labuf, labuf[0] + 1, h);
-		lablen = *dname++;
+		if(len+run+lablen+1 > LDNS_MAX_DOMAINLEN)
+			break;
+		run += lablen+1;
+		lablen = dname[run];
 	}
-
-	return h;
+	(*lower_copy)(buf+len, dname, run);
+	len += run;
+	return hashlittle(buf, len, h);
 }
 
 void dname_pkt_copy(sldns_buffer* pkt, uint8_t* to, uint8_t* dname)
@@ -66,6 +66,9 @@ size_t query_dname_len(struct sldns_buffer* query);
  */
 size_t dname_valid(uint8_t* dname, size_t len);
 
+/** lowercase an ASCII byte of a dname, without the locale of tolower() */
+#define DNAME_LOWER(c) ((uint8_t)((c)>='A'&&(c)<='Z'?(c)|0x20:(c)))
+
 /** lowercase query dname */
 void query_dname_tolower(uint8_t* dname);
 
@@ -98,6 +101,19 @@ void pkt_dname_tolower(struct sldns_buffer* pkt, uint8_t* dname);
  */
 int query_dname_compare(uint8_t* d1, uint8_t* d2);
 
+/**
+ * See if two dnames of the same length are equal, ignoring case.
+ * Fast for names that are stored in lowercase, such as the keys in the
+ * message and rrset cache, then it is a memcmp.  Otherwise the names are
+ * lowercased and compared a vector at a time.
+ * Dnames have to be valid format, uncompressed.
+ * @param d1: dname to compare
+ * @param d2: dname to compare
+ * @param len: length of both dnames.
+ * @return true if equal.
+ */
+int dname_lower_equal(uint8_t* d1, uint8_t* d2, size_t len);
+
 /**
  * Determine correct, compressed, dname present in packet.
  * Checks for parse errors.
@@ -121,7 +137,9 @@ size_t pkt_dname_len(struct sldns_buffer* pkt);
 int dname_pkt_compare(struct sldns_buffer* pkt, uint8_t* d1, uint8_t* d2);
 
 /**
- * Hash dname, label by label, lowercasing, into hashvalue.
+ * Hash dname, lowercasing, into hashvalue.
+ * The labels are copied, lowercased with the vector routine for this CPU,
+ * and hashed at once.
  * Dname in query format (not compressed).
  * @param dname: dname to hash.
  * @param h: initial hash value.
@@ -130,7 +148,7 @@ int dname_pkt_compare(struct sldns_buffer* pkt, uint8_t* d1, uint8_t* d2);
 hashvalue_type dname_query_hash(uint8_t* dname, hashvalue_type h);
 
 /**
- * Hash dname, label by label, lowercasing, into hashvalue.
+ * Hash dname, lowercasing, into hashvalue.
  * Dname in pkt format (compressed).
  * @param pkt: packet, for resolving compression pointers.
  * @param dname: dname to hash, pointer to the pkt buffer.
@@ -142,6 +160,13 @@ hashvalue_type dname_query_hash(uint8_t* dname, hashvalue_type h);
 hashvalue_type dname_pkt_hash(struct sldns_buffer* pkt, uint8_t* dname,
 	hashvalue_type h);
 
+/**
+ * Name of the lowercase routine that the dname hash uses, picked at
+ * startup by the CPU features, "avx2", "sse2", "neon" or "scalar".
+ * @return static string.
+ */
+const char* dname_hash_impl(void);
+
 /**
  * Copy over a valid dname and decompress it.
  * @param pkt: packet to resolve compression pointers.
@@ -85,6 +85,52 @@ struct compress_tree_node {
 	size_t offset;
 };
 
+/**
+ * Hash table alternative to the compression tree, used when
+ * compression-hash is enabled.  Open addressing, keyed on the lowercased
+ * name suffixes.  It stores the same suffixes with the same offsets as
+ * the tree, and a lookup returns the longest stored suffix, which is
+ * what the tree finds, so the packet is the same.  The lookup cost does
+ * not grow with the number of names in the message.
+ */
+struct compress_hash_entry {
+	/** the domain name, pointer to uncompressed memory, NULL if empty */
+	uint8_t* dname;
+	/** hash of the lowercased name */
+	uint32_t hash;
+	/** number of labels in domain name */
+	uint16_t labs;
+	/** offset in packet that points to this dname */
+	uint16_t offset;
+};
+
+/** start number of slots in the compression hash, power of two */
+#define COMPRESS_HASH_START 64
+
+/** the names in the message for compression, in the tree or the hash */
+struct compress_index {
+	/** root of the compression tree, used if there is no hash */
+	struct compress_tree_node* tree;
+	/** slots of the compression hash, or NULL to use the tree */
+	struct compress_hash_entry* hash;
+	/** number of slots in the hash, power of two */
+	size_t size;
+	/** number of used slots in the hash */
+	size_t num;
+};
+
+/** closest match for a name from the compression index */
+struct compress_match {
+	/** number of labels in the match, 0 if no match */
+	int labs;
+	/** offset in packet of the match */
+	size_t offset;
+	/** the tree node of the match, for the tree */
+	struct compress_tree_node* node;
+	/** insert location in the tree */
+	struct compress_tree_node** insertpt;
+};
+
 /**
  * Find domain name in tree, returns exact and closest match.
  * @param tree: root of tree.
@@ -242,10 +288,216 @@ compress_tree_store(uint8_t* dname, int labs, size_t offset,
 	return 1;
 }
 
+/**
+ * Find the labels of a domain name and the hashes of its suffixes.
+ * The hash of a suffix is made from the hash of its parent, so that
+ * all the suffixes are hashed in one pass.
+ * @param dname: uncompressed dname.
+ * @param labs: number of labels in dname, including the root.
+ * @param lab: the start of each label is returned.
+ * @param h: the hash of the suffix that starts at the label is returned.
+ */
+static void
+compress_hash_suffixes(uint8_t* dname, int labs, uint8_t** lab, uint32_t* h)
+{
+	int i;
+	for(i=0; i<labs; i++) {
+		lab[i] = dname;
+		dname += *dname + 1;
+	}
+	h[labs-1] = 0x811c9dc5; /* the root */
+	for(i=labs-2; i>=0; i--) {
+		uint32_t x = h[i+1];
+		uint8_t* p = lab[i];
+		uint8_t* end = p + *p + 1;
+		/* FNV-1a over the lowercased label and its length */
+		while(p < end) {
+			x = (x ^ DNAME_LOWER(*p)) * 16777619;
+			p++;
+		}
+		h[i] = x;
+	}
+}
+
+/** find a name in the compression hash, or its empty slot */
+static struct compress_hash_entry*
+compress_hash_slot(struct compress_index* ci, uint8_t* dname, int labs,
+	uint32_t h)
+{
+	size_t mask = ci->size-1;
+	size_t i = (h ^ (h>>16)) & mask;
+	while(ci->hash[i].dname) {
+		if(ci->hash[i].hash == h && ci->hash[i].labs == labs &&
+			query_dname_compare(ci->hash[i].dname, dname) == 0)
+			return &ci->hash[i];
+		i = (i+1) & mask;
+	}
+	return &ci->hash[i];
+}
+
+/**
+ * Create the compression hash.
+ * @param ci: compression index, the hash is set up in it.
+ * @param region: how to allocate memory.
+ * @return 0 on malloc failure.
+ */
+static int
+compress_hash_create(struct compress_index* ci, struct regional* region)
+{
+	ci->size = COMPRESS_HASH_START;
+	ci->num = 0;
+	ci->hash = (struct compress_hash_entry*)regional_alloc_zero(region,
+		ci->size*sizeof(struct compress_hash_entry));
+	return ci->hash != NULL;
+}
+
+/** insert a name in the compression hash, it is not in there, 0 on
+ * malloc failure */
+static int
+compress_hash_insert(struct compress_index* ci, uint8_t* dname, int labs,
+	size_t offset, uint32_t h, struct regional* region)
+{
+	struct compress_hash_entry* e;
+	if((ci->num+1)*2 > ci->size) {
+		/* grow, the old slots stay in the region until it is freed */
+		struct compress_hash_entry* old = ci->hash;
+		size_t i, oldsize = ci->size;
+		ci->hash = (struct compress_hash_entry*)regional_alloc_zero(
+			region, oldsize*2*sizeof(struct compress_hash_entry));
+		if(!ci->hash) {
+			ci->hash = old;
+			return 0;
+		}
+		ci->size = oldsize*2;
+		for(i=0; i<oldsize; i++) {
+			if(old[i].dname)
+				*compress_hash_slot(ci, old[i].dname,
+					old[i].labs, old[i].hash) = old[i];
+		}
+	}
+	e = compress_hash_slot(ci, dname, labs, h);
+	log_assert(e->dname == NULL);
+	e->dname = dname;
+	e->hash = h;
+	e->labs = (uint16_t)labs;
+	e->offset = (uint16_t)offset;
+	ci->num++;
+	return 1;
+}
+
+/**
+ * Lookup the longest suffix of a domain name in the compression hash.
+ * @param ci: compression index with the hash.
+ * @param dname: pointer to uncompressed dname.
+ * @param labs: number of labels in domain name.
+ * @param m: the match is returned, labs is 0 if no match.
+ * @return: 0 if not found.
+ */
+static int
+compress_hash_lookup(struct compress_index* ci, uint8_t* dname, int labs,
+	struct compress_match* m)
+{
+	uint8_t* lab[LDNS_MAX_DOMAINLEN/2+1];
+	uint32_t h[LDNS_MAX_DOMAINLEN/2+1];
+	struct compress_hash_entry* e;
+	int i;
+	if(labs <= 1)
+		return 0; /* do not compress root node */
+	compress_hash_suffixes(dname, labs, lab, h);
+	/* the root label is not stored */
+	for(i=0; i<labs-1; i++) {
+		e = compress_hash_slot(ci, lab[i], labs-i, h[i]);
+		if(e->dname) {
+			m->labs = e->labs;
+			m->offset = e->offset;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Store domain name and its suffixes into the compression hash, the
+ * suffixes that are longer than the match.  Like the tree, nothing is
+ * stored if a compression pointer cannot reach the suffixes.
+ * @param ci: compression index with the hash.
+ * @param dname: pointer to uncompressed dname (stored in hash).
+ * @param labs: number of labels in dname.
+ * @param offset: offset into packet for dname.
+ * @param m: match from previous lookup.
+ * @param region: how to allocate memory.
+ * @return: 0 on memory error.
+ */
+static int
+compress_hash_store(struct compress_index* ci, uint8_t* dname, int labs,
+	size_t offset, struct compress_match* m, struct regional* region)
+{
+	uint8_t* lab[LDNS_MAX_DOMAINLEN/2+1];
+	uint32_t h[LDNS_MAX_DOMAINLEN/2+1];
+	int i, uplabs = labs-1; /* does not store root */
+	if(m->labs) uplabs = labs - m->labs;
+	log_assert(uplabs >= 0);
+	if(uplabs == 0)
+		return 1;
+	compress_hash_suffixes(dname, labs, lab, h);
+	if(offset + (size_t)(lab[uplabs-1] - dname) > PTR_MAX_OFFSET)
+		return 1; /* compression pointer no longer useful */
+	for(i=0; i<uplabs; i++) {
+		if(!compress_hash_insert(ci, lab[i], labs-i,
+			offset + (size_t)(lab[i] - dname), h[i], region))
+			return 0;
+	}
+	return 1;
+}
+
+/**
+ * Lookup a domain name in the compression index, in the tree or hash.
+ * @param ci: compression index.
+ * @param dname: pointer to uncompressed dname.
+ * @param labs: number of labels in domain name.
+ * @param m: the closest match is returned, to use for compression and
+ *	to store the name afterwards.
+ * @return: 0 if not found, or 1 if the match can be used to compress.
+ */
+static int
+compress_lookup(struct compress_index* ci, uint8_t* dname, int labs,
+	struct compress_match* m)
+{
+	memset(m, 0, sizeof(*m));
+	if(ci->hash)
+		return compress_hash_lookup(ci, dname, labs, m);
+	if(!(m->node = compress_tree_lookup(&ci->tree, dname, labs,
+		&m->insertpt)))
+		return 0;
+	m->labs = m->node->labs;
+	m->offset = m->node->offset;
+	return 1;
+}
+
+/**
+ * Store domain name and ancestors into the compression index.
+ * @param ci: compression index.
+ * @param dname: pointer to uncompressed dname (stored in the index).
+ * @param labs: number of labels in dname.
+ * @param offset: offset into packet for dname.
+ * @param m: match from previous lookup.
+ * @param region: how to allocate memory.
+ * @return: 0 on memory error.
+ */
+static int
+compress_store(struct compress_index* ci, uint8_t* dname, int labs,
+	size_t offset, struct compress_match* m, struct regional* region)
+{
+	if(ci->hash)
+		return compress_hash_store(ci, dname, labs, offset, m, region);
+	return compress_tree_store(dname, labs, offset, region, m->node,
+		m->insertpt);
+}
+
 /** compress a domain name */
 static int
 write_compressed_dname(sldns_buffer* pkt, uint8_t* dname, int labs,
-	struct compress_tree_node* p)
+	struct compress_match* p)
 {
 	/* compress it */
 	int labcopy = labs - p->labs;
@@ -280,21 +532,19 @@ write_compressed_dname(sldns_buffer* pkt, uint8_t* dname, int labs,
 /** compress owner name of RR, return RETVAL_OUTMEM RETVAL_TRUNC */
 static int
 compress_owner(struct ub_packed_rrset_key* key, sldns_buffer* pkt, 
-	struct regional* region, struct compress_tree_node** tree, 
+	struct regional* region, struct compress_index* ci, 
 	size_t owner_pos, uint16_t* owner_ptr, int owner_labs)
 {
-	struct compress_tree_node* p;
-	struct compress_tree_node** insertpt = NULL;
+	struct compress_match p;
 	if(!*owner_ptr) {
 		/* compress first time dname */
-		if((p = compress_tree_lookup(tree, key->rk.dname, 
-			owner_labs, &insertpt))) {
-			if(p->labs == owner_labs) 
+		if(compress_lookup(ci, key->rk.dname, owner_labs, &p)) {
+			if(p.labs == owner_labs) 
 				/* avoid ptr chains, since some software is
 				 * not capable of decoding ptr after a ptr. */
-				*owner_ptr = htons(PTR_CREATE(p->offset));
+				*owner_ptr = htons(PTR_CREATE(p.offset));
 			if(!write_compressed_dname(pkt, key->rk.dname, 
-				owner_labs, p))
+				owner_labs, &p))
 				return RETVAL_TRUNC;
 			/* check if typeclass+4 ttl + rdatalen is available */
 			if(sldns_buffer_remaining(pkt) < 4+4+2)
@@ -308,8 +558,8 @@ compress_owner(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 			if(owner_pos <= PTR_MAX_OFFSET)
 				*owner_ptr = htons(PTR_CREATE(owner_pos));
 		}
-		if(!compress_tree_store(key->rk.dname, owner_labs, 
-			owner_pos, region, p, insertpt))
+		if(!compress_store(ci, key->rk.dname, owner_labs, 
+			owner_pos, &p, region))
 			return RETVAL_OUTMEM;
 	} else {
 		/* always compress 2nd-further RRs in RRset */
@@ -329,19 +579,18 @@ compress_owner(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 /** compress any domain name to the packet, return RETVAL_* */
 static int
 compress_any_dname(uint8_t* dname, sldns_buffer* pkt, int labs, 
-	struct regional* region, struct compress_tree_node** tree)
+	struct regional* region, struct compress_index* ci)
 {
-	struct compress_tree_node* p;
-	struct compress_tree_node** insertpt = NULL;
+	struct compress_match p;
 	size_t pos = sldns_buffer_position(pkt);
-	if((p = compress_tree_lookup(tree, dname, labs, &insertpt))) {
-		if(!write_compressed_dname(pkt, dname, labs, p))
+	if(compress_lookup(ci, dname, labs, &p)) {
+		if(!write_compressed_dname(pkt, dname, labs, &p))
 			return RETVAL_TRUNC;
 	} else {
 		if(!dname_buffer_write(pkt, dname))
 			return RETVAL_TRUNC;
 	}
-	if(!compress_tree_store(dname, labs, pos, region, p, insertpt))
+	if(!compress_store(ci, dname, labs, pos, &p, region))
 		return RETVAL_OUTMEM;
 	return RETVAL_OK;
 }
@@ -360,7 +609,7 @@ type_rdata_compressable(struct ub_packed_rrset_key* key)
 /** compress domain names in rdata, return RETVAL_* */
 static int
 compress_rdata(sldns_buffer* pkt, uint8_t* rdata, size_t todolen, 
-	struct regional* region, struct compress_tree_node** tree, 
+	struct regional* region, struct compress_index* ci, 
 	const sldns_rr_descriptor* desc)
 {
 	int labs, r, rdf = 0;
@@ -376,7 +625,7 @@ compress_rdata(sldns_buffer* pkt, uint8_t* rdata, size_t todolen,
 		case LDNS_RDF_TYPE_DNAME:
 			labs = dname_count_size_labels(rdata, &dname_len);
 			if((r=compress_any_dname(rdata, pkt, labs, region, 
-				tree)) != RETVAL_OK)
+				ci)) != RETVAL_OK)
 				return r;
 			rdata += dname_len;
 			todolen -= dname_len;
@@ -443,7 +692,7 @@ rrset_belongs_in_reply(sldns_pkt_section s, uint16_t rrtype, uint16_t qtype,
 static int
 packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt, 
 	uint16_t* num_rrs, time_t timenow, struct regional* region,
-	int do_data, int do_sig, struct compress_tree_node** tree,
+	int do_data, int do_sig, struct compress_index* ci,
 	sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset)
 {
 	size_t i, j, owner_pos;
@@ -468,7 +717,7 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 		for(i=0; i<data->count; i++) {
 			/* rrset roundrobin */
 			j = (i + rr_offset) % data->count;
-			if((r=compress_owner(key, pkt, region, tree, 
+			if((r=compress_owner(key, pkt, region, ci, 
 				owner_pos, &owner_ptr, owner_labs))
 				!= RETVAL_OK)
 				return r;
@@ -480,7 +729,7 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 					data->rr_ttl[j]-timenow);
 			if(c) {
 				if((r=compress_rdata(pkt, data->rr_data[j],
-					data->rr_len[j], region, tree, c))
+					data->rr_len[j], region, ci, c))
 					!= RETVAL_OK)
 					return r;
 			} else {
@@ -502,7 +751,7 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 				sldns_buffer_write(pkt, &owner_ptr, 2);
 			} else {
 				if((r=compress_any_dname(key->rk.dname, 
-					pkt, owner_labs, region, tree))
+					pkt, owner_labs, region, ci))
 					!= RETVAL_OK)
 					return r;
 				if(sldns_buffer_remaining(pkt) < 
@@ -534,7 +783,7 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 static int
 insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 	sldns_buffer* pkt, size_t rrsets_before, time_t timenow, 
-	struct regional* region, struct compress_tree_node** tree,
+	struct regional* region, struct compress_index* ci,
 	sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset)
 {
 	int r;
@@ -550,7 +799,7 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 	  	for(i=0; i<num_rrsets; i++) {
 			setstart = sldns_buffer_position(pkt);
 			if((r=packed_rrset_encode(rep->rrsets[rrsets_before+i], 
-				pkt, num_rrs, timenow, region, 1, 1, tree,
+				pkt, num_rrs, timenow, region, 1, 1, ci,
 				s, qtype, dnssec, rr_offset))
 				!= RETVAL_OK) {
 				/* Bad, but if due to size must set TC bit */
@@ -563,7 +812,7 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 	  	for(i=0; i<num_rrsets; i++) {
 			setstart = sldns_buffer_position(pkt);
 			if((r=packed_rrset_encode(rep->rrsets[rrsets_before+i], 
-				pkt, num_rrs, timenow, region, 1, 0, tree,
+				pkt, num_rrs, timenow, region, 1, 0, ci,
 				s, qtype, dnssec, rr_offset))
 				!= RETVAL_OK) {
 				sldns_buffer_set_position(pkt, setstart);
@@ -574,7 +823,7 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 	  	  for(i=0; i<num_rrsets; i++) {
 			setstart = sldns_buffer_position(pkt);
 			if((r=packed_rrset_encode(rep->rrsets[rrsets_before+i], 
-				pkt, num_rrs, timenow, region, 0, 1, tree,
+				pkt, num_rrs, timenow, region, 0, 1, ci,
 				s, qtype, dnssec, rr_offset))
 				!= RETVAL_OK) {
 				sldns_buffer_set_position(pkt, setstart);
@@ -587,9 +836,10 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 
 /** store query section in wireformat buffer, return RETVAL */
 static int
-insert_query(struct query_info* qinfo, struct compress_tree_node** tree, 
+insert_query(struct query_info* qinfo, struct compress_index* ci, 
 	sldns_buffer* buffer, struct regional* region)
 {
+	struct compress_match nomatch;
 	uint8_t* qname = qinfo->local_alias ?
 		qinfo->local_alias->rrset->rk.dname : qinfo->qname;
 	size_t qname_len = qinfo->local_alias ?
@@ -598,8 +848,10 @@ insert_query(struct query_info* qinfo, struct compress_tree_node** tree,
 		qinfo->qname_len+sizeof(uint16_t)*2)
 		return RETVAL_TRUNC; /* buffer too small */
 	/* the query is the first name inserted into the tree */
-	if(!compress_tree_store(qname, dname_count_labels(qname),
-		sldns_buffer_position(buffer), region, NULL, tree))
+	memset(&nomatch, 0, sizeof(nomatch));
+	nomatch.insertpt = &ci->tree;
+	if(!compress_store(ci, qname, dname_count_labels(qname),
+		sldns_buffer_position(buffer), &nomatch, region))
 		return RETVAL_OUTMEM;
 	if(sldns_buffer_current(buffer) == qname)
 		sldns_buffer_skip(buffer, (ssize_t)qname_len);
@@ -640,10 +892,14 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 	struct regional* region, uint16_t udpsize, int dnssec)
 {
 	uint16_t ancount=0, nscount=0, arcount=0;
-	struct compress_tree_node* tree = 0;
+	struct compress_index ci;
 	int r;
 	size_t rr_offset; 
 
+	memset(&ci, 0, sizeof(ci));
+	if(COMPRESSION_HASH && !compress_hash_create(&ci, region))
+		return 0;
+
 	sldns_buffer_clear(buffer);
 	if(udpsize < sldns_buffer_limit(buffer))
 		sldns_buffer_set_limit(buffer, udpsize);
@@ -660,7 +916,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 
 	/* insert query section */
 	if(rep->qdcount) {
-		if((r=insert_query(qinfo, &tree, buffer, region)) != 
+		if((r=insert_query(qinfo, &ci, buffer, region)) != 
 			RETVAL_OK) {
 			if(r == RETVAL_TRUNC) {
 				/* create truncated message */
@@ -690,7 +946,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 		arep.rrset_count = 1;
 		arep.rrsets = &qinfo->local_alias->rrset;
 		if((r=insert_section(&arep, 1, &ancount, buffer, 0,
-			timezero, region, &tree, LDNS_SECTION_ANSWER,
+			timezero, region, &ci, LDNS_SECTION_ANSWER,
 			qinfo->qtype, dnssec, rr_offset)) != RETVAL_OK) {
 			if(r == RETVAL_TRUNC) {
 				/* create truncated message */
@@ -705,7 +961,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 
 	/* insert answer section */
 	if((r=insert_section(rep, rep->an_numrrsets, &ancount, buffer, 
-		0, timenow, region, &tree, LDNS_SECTION_ANSWER, qinfo->qtype, 
+		0, timenow, region, &ci, LDNS_SECTION_ANSWER, qinfo->qtype, 
 		dnssec, rr_offset)) != RETVAL_OK) {
 		if(r == RETVAL_TRUNC) {
 			/* create truncated message */
@@ -722,7 +978,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 	if( ! (MINIMAL_RESPONSES && positive_answer(rep, qinfo->qtype)) ) {
 		/* insert auth section */
 		if((r=insert_section(rep, rep->ns_numrrsets, &nscount, buffer, 
-			rep->an_numrrsets, timenow, region, &tree,
+			rep->an_numrrsets, timenow, region, &ci,
 			LDNS_SECTION_AUTHORITY, qinfo->qtype,
 			dnssec, rr_offset)) != RETVAL_OK) {
 			if(r == RETVAL_TRUNC) {
@@ -739,7 +995,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 		/* insert add section */
 		if((r=insert_section(rep, rep->ar_numrrsets, &arcount, buffer, 
 			rep->an_numrrsets + rep->ns_numrrsets, timenow, region, 
-			&tree, LDNS_SECTION_ADDITIONAL, qinfo->qtype, 
+			&ci, LDNS_SECTION_ADDITIONAL, qinfo->qtype, 
 			dnssec, rr_offset)) != RETVAL_OK) {
 			if(r == RETVAL_TRUNC) {
 				/* no need to set TC bit, this is the additional */
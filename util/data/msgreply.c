@@ -268,6 +268,7 @@ parse_rr_copy(sldns_buffer* pkt, struct rrset_parse* pset,
 	data->rrsig_count = pset->rrsig_count;
 	data->trust = rrset_trust_none;
 	data->security = sec_status_unchecked;
+	data->canon_len = 0;
 	/* layout: struct - rr_len - rr_data - rr_ttl - rdata - rrsig */
 	data->rr_len = (size_t*)((uint8_t*)data + 
 		sizeof(struct packed_rrset_data));
@@ -563,8 +564,12 @@ query_info_compare(void* m1, void* m2)
 	int mc;
 	/* from most different to least different for speed */
 	COMPARE_IT(msg1->qtype, msg2->qtype);
-	if((mc = query_dname_compare(msg1->qname, msg2->qname)) != 0)
-		return mc;
+	/* the cache keys are stored in lowercase, equal length and memcmp */
+	if(msg1->qname_len != msg2->qname_len || !dname_lower_equal(
+		msg1->qname, msg2->qname, msg1->qname_len)) {
+		if((mc = query_dname_compare(msg1->qname, msg2->qname)) != 0)
+			return mc;
+	}
 	log_assert(msg1->qname_len == msg2->qname_len);
 	COMPARE_IT(msg1->qclass, msg2->qclass);
 	return 0;
@@ -627,6 +632,8 @@ query_info_entrysetup(struct query_info* q, struct reply_info* r,
 		sizeof(struct msgreply_entry));
 	if(!e) return NULL;
 	memcpy(&e->key, q, sizeof(*q));
+	/* store the key in lowercase, so that lookups can memcmp it */
+	query_dname_tolower(e->key.qname);
 	e->entry.hash = h;
 	e->entry.key = e;
 	e->entry.data = r;
@@ -87,7 +87,14 @@ packed_rrset_sizeof(struct packed_rrset_data* d)
 		s = ((uint8_t*)d->rr_data[d->count-1] - (uint8_t*)d) + 
 			d->rr_len[d->count-1];
 	}
-	return s;
+	return s + d->canon_len;
+}
+
+uint8_t*
+packed_rrset_canon(struct packed_rrset_data* d)
+{
+	log_assert(d->canon_len != 0);
+	return (uint8_t*)d + packed_rrset_sizeof(d) - d->canon_len;
 }
 
 int 
@@ -108,7 +115,10 @@ ub_rrset_compare(void* k1, void* k2)
 			return -1;
 		return 1;
 	}
-	if((c=query_dname_compare(key1->rk.dname, key2->rk.dname)) != 0)
+	/* the cache keys are stored in lowercase, then it is a memcmp */
+	if(!dname_lower_equal(key1->rk.dname, key2->rk.dname,
+		key1->rk.dname_len) &&
+		(c=query_dname_compare(key1->rk.dname, key2->rk.dname)) != 0)
 		return c;
 	if(key1->rk.rrset_class != key2->rk.rrset_class) {
 		if(key1->rk.rrset_class < key2->rk.rrset_class)
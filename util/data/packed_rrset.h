@@ -211,6 +211,7 @@ enum sec_status {
  *		Since the stuff before is 32/64bit, rr_ttl is 32 bit aligned.
  *	o rr_data rdata wireformats
  *	o rrsig_data rdata wireformat(s)
+ *	o canonical rdata image, canon_len bytes, if canon_len is not 0.
  *
  * Rdata is stored in wireformat. The dname is stored in wireformat.
  * TTLs are stored as absolute values (and could be expired).
@@ -252,6 +253,15 @@ struct packed_rrset_data {
 	 * rr_data[count] to rr_data[count+rrsig_count] contain the rrsig data.
 	 */
 	uint8_t** rr_data;
+	/**
+	 * Length of the canonical rdata image stored after the rrsig data,
+	 * 0 if there is none. The image has the rrs (not the rrsigs) in
+	 * canonical order, duplicates removed, each as rdlength and rdata
+	 * in canonical form (RFC 4034 section 6.2). It is created for
+	 * validated rrsets when they are stored in the rrset cache, and
+	 * saves the sort and downcase when the signature is checked again.
+	 */
+	size_t canon_len;
 };
 
 /**
@@ -292,6 +302,13 @@ void ub_packed_rrset_parsedelete(struct ub_packed_rrset_key* pkey,
  */
 size_t packed_rrset_sizeof(struct packed_rrset_data* data);
 
+/**
+ * Get the canonical rdata image of the rrset data.
+ * @param data: contiguous rrset data, with canon_len not 0.
+ * @return pointer to the canon_len bytes of the image.
+ */
+uint8_t* packed_rrset_canon(struct packed_rrset_data* data);
+
 /**
  * Get TTL of rrset. RRset data must be filled in correctly.
  * @param key: rrset key, with data to examine.
@@ -61,6 +61,8 @@
 #include "validator/val_nsec3.h"
 #include "validator/val_sigcrypt.h"
 #include "validator/val_kentry.h"
+#include "validator/val_sigcache.h"
+#include "validator/val_nsec3cache.h"
 #include "validator/val_neg.h"
 #include "validator/autotrust.h"
 #include "util/data/msgreply.h"
@@ -100,6 +102,7 @@ fptr_whitelist_comm_point(comm_point_callback_type *fptr)
 	else if(fptr == &tube_handle_listen) return 1;
 	else if(fptr == &auth_xfer_probe_udp_callback) return 1;
 	else if(fptr == &auth_xfer_transfer_tcp_callback) return 1;
+	else if(fptr == &test_comm_point_cb) return 1;
 	return 0;
 }
 
@@ -118,7 +121,9 @@ fptr_whitelist_comm_timer(void (*fptr)(void*))
 {
 	if(fptr == &pending_udp_timer_cb) return 1;
 	else if(fptr == &outnet_tcptimer) return 1;
+	else if(fptr == &reuse_tcp_idle_timeout) return 1;
 	else if(fptr == &pending_udp_timer_delay_cb) return 1;
+	else if(fptr == &outnet_udp_batch_cb) return 1;
 	else if(fptr == &worker_stat_timer_cb) return 1;
 	else if(fptr == &worker_probe_timer_cb) return 1;
 #ifdef UB_ON_WINDOWS
@@ -126,6 +131,7 @@ fptr_whitelist_comm_timer(void (*fptr)(void*))
 #endif
 	else if(fptr == &auth_xfer_timer) return 1;
 	else if(fptr == &auth_xfer_probe_timer_callback) return 1;
+	else if(fptr == &test_comm_timer_cb) return 1;
 	return 0;
 }
 
@@ -182,6 +188,7 @@ fptr_whitelist_pending_tcp(comm_point_callback_type *fptr)
 	if(fptr == &serviced_tcp_callback) return 1;
 	else if(fptr == &worker_handle_reply) return 1;
 	else if(fptr == &libworker_handle_reply) return 1;
+	else if(fptr == &test_comm_point_cb) return 1;
 	return 0;
 }
 
@@ -196,13 +203,14 @@ fptr_whitelist_serviced_query(comm_point_callback_type *fptr)
 int 
 fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 {
-	if(fptr == &mesh_state_compare) return 1;
-	else if(fptr == &mesh_state_ref_compare) return 1;
+	if(fptr == &mesh_state_ref_compare) return 1;
 	else if(fptr == &addr_tree_compare) return 1;
 	else if(fptr == &local_zone_cmp) return 1;
 	else if(fptr == &local_data_cmp) return 1;
 	else if(fptr == &fwd_cmp) return 1;
 	else if(fptr == &pending_cmp) return 1;
+	else if(fptr == &reuse_cmp) return 1;
+	else if(fptr == &reuse_id_cmp) return 1;
 	else if(fptr == &serviced_cmp) return 1;
 	else if(fptr == &name_tree_compare) return 1;
 	else if(fptr == &order_lock_cmp) return 1;
@@ -230,8 +238,12 @@ fptr_whitelist_hash_sizefunc(lruhash_sizefunc_type fptr)
 	else if(fptr == &ub_rrset_sizefunc) return 1;
 	else if(fptr == &infra_sizefunc) return 1;
 	else if(fptr == &key_entry_sizefunc) return 1;
+	else if(fptr == &sig_cache_sizefunc) return 1;
+	else if(fptr == &nsec3_hash_cache_sizefunc) return 1;
 	else if(fptr == &rate_sizefunc) return 1;
 	else if(fptr == &ip_rate_sizefunc) return 1;
+	else if(fptr == &evict_sizefunc) return 1;
+	else if(fptr == &infra_server_sizefunc) return 1;
 	else if(fptr == &test_slabhash_sizefunc) return 1;
 #ifdef CLIENT_SUBNET
 	else if(fptr == &msg_cache_sizefunc) return 1;
@@ -250,8 +262,11 @@ fptr_whitelist_hash_compfunc(lruhash_compfunc_type fptr)
 	else if(fptr == &ub_rrset_compare) return 1;
 	else if(fptr == &infra_compfunc) return 1;
 	else if(fptr == &key_entry_compfunc) return 1;
+	else if(fptr == &sig_cache_compfunc) return 1;
+	else if(fptr == &nsec3_hash_cache_compfunc) return 1;
 	else if(fptr == &rate_compfunc) return 1;
 	else if(fptr == &ip_rate_compfunc) return 1;
+	else if(fptr == &infra_server_compfunc) return 1;
 	else if(fptr == &test_slabhash_compfunc) return 1;
 #ifdef USE_DNSCRYPT
 	else if(fptr == &dnsc_shared_secrets_compfunc) return 1;
@@ -267,8 +282,11 @@ fptr_whitelist_hash_delkeyfunc(lruhash_delkeyfunc_type fptr)
 	else if(fptr == &ub_rrset_key_delete) return 1;
 	else if(fptr == &infra_delkeyfunc) return 1;
 	else if(fptr == &key_entry_delkeyfunc) return 1;
+	else if(fptr == &sig_cache_delkeyfunc) return 1;
+	else if(fptr == &nsec3_hash_cache_delkeyfunc) return 1;
 	else if(fptr == &rate_delkeyfunc) return 1;
 	else if(fptr == &ip_rate_delkeyfunc) return 1;
+	else if(fptr == &infra_server_delkeyfunc) return 1;
 	else if(fptr == &test_slabhash_delkey) return 1;
 #ifdef USE_DNSCRYPT
 	else if(fptr == &dnsc_shared_secrets_delkeyfunc) return 1;
@@ -284,6 +302,8 @@ fptr_whitelist_hash_deldatafunc(lruhash_deldatafunc_type fptr)
 	else if(fptr == &rrset_data_delete) return 1;
 	else if(fptr == &infra_deldatafunc) return 1;
 	else if(fptr == &key_entry_deldatafunc) return 1;
+	else if(fptr == &sig_cache_deldatafunc) return 1;
+	else if(fptr == &nsec3_hash_cache_deldatafunc) return 1;
 	else if(fptr == &rate_deldatafunc) return 1;
 	else if(fptr == &test_slabhash_deldata) return 1;
 #ifdef CLIENT_SUBNET
@@ -504,6 +524,8 @@ fptr_whitelist_alloc_cleanup(void (*fptr)(void*))
 int fptr_whitelist_tube_listen(tube_callback_type* fptr)
 {
 	if(fptr == &worker_handle_control_cmd) return 1;
+	else if(fptr == &worker_handle_inflight_wakeup) return 1;
+	else if(fptr == &worker_handle_crypto_wakeup) return 1;
 	else if(fptr == &libworker_handle_control_cmd) return 1;
 	return 0;
 }
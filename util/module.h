@@ -175,6 +175,7 @@ struct mesh_area;
 struct mesh_state;
 struct val_anchors;
 struct val_neg_cache;
+struct crypto_pool;
 struct iter_forwards;
 struct iter_hints;
 struct respip_set;
@@ -504,6 +505,23 @@ struct module_env {
 
 	/* Make every mesh state unique, do not aggregate mesh states. */
 	int unique_mesh;
+
+	/** threads that verify signatures, crypto-threads, or NULL */
+	struct crypto_pool* crypto_pool;
+	/** the thread number in the crypto pool */
+	int crypto_thread;
+	/** number of signatures of this thread that were found in the
+	 * signature cache, and that were not, per thread, no lock */
+	size_t num_sig_cache_hit;
+	/** number of signatures of this thread that were not found in the
+	 * signature cache, and were verified */
+	size_t num_sig_cache_miss;
+	/** number of NSEC3 hashes of this thread that were found in the
+	 * NSEC3 hash cache, per thread, no lock */
+	size_t num_nsec3_cache_hit;
+	/** number of NSEC3 hashes of this thread that were not found in the
+	 * NSEC3 hash cache, and were calculated */
+	size_t num_nsec3_cache_miss;
 };
 
 /**
@@ -632,6 +650,17 @@ struct module_qstate {
 
 	/** whether the reply should be dropped */
 	int is_drop;
+
+	/** zone (delegation point name, in the region) that the last
+	 * upstream query was sent for, NULL if none; used by the jostle
+	 * admission control to look up the server in the infra cache */
+	uint8_t* work_zone;
+	/** length of work_zone */
+	size_t work_zonelen;
+	/** address of the server the last upstream query was sent to */
+	struct sockaddr_storage work_addr;
+	/** length of work_addr */
+	socklen_t work_addrlen;
 };
 
 /** 
@@ -99,6 +99,9 @@ extern int MINIMAL_RESPONSES;
 /** rrset order roundrobin */
 extern int RRSET_ROUNDROBIN;
 
+/** name compression in replies with a hash table, instead of the tree */
+extern int COMPRESSION_HASH;
+
 /**
  * See if string is ip4 or ip6.
  * @param str: IP specification.
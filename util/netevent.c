@@ -93,6 +93,44 @@
 #define NUM_UDP_PER_SELECT 1
 #endif
 
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG) && !defined(USE_WINSOCK)
+/** use recvmmsg and sendmmsg to handle UDP datagrams in batches */
+#define USE_UDP_BATCH 1
+/** size of the ancillary data space per datagram in a batch */
+#define UDP_BATCH_ANCIL 256
+
+/**
+ * Batch of UDP datagrams, received with one recvmmsg call, and the
+ * immediate replies to them, that are sent with one sendmmsg call.
+ */
+struct udp_batch {
+	/** max number of datagrams in the batch */
+	int num;
+	/** if the datagrams carry ancillary data, for interface-automatic */
+	int ancil;
+	/** buffers, per datagram, with the query and then the reply */
+	struct sldns_buffer** buf;
+	/** reply info, per datagram, address and interface */
+	struct comm_reply* rep;
+	/** message headers for recvmmsg */
+	struct mmsghdr* recv_msg;
+	/** io vectors for recvmmsg */
+	struct iovec* recv_iov;
+	/** ancillary data space for recvmmsg, per datagram */
+	char* recv_ancil;
+	/** number of replies that wait to be sent */
+	int num_send;
+	/** message headers for sendmmsg */
+	struct mmsghdr* send_msg;
+	/** io vectors for sendmmsg */
+	struct iovec* send_iov;
+	/** ancillary data space for sendmmsg, per reply */
+	char* send_ancil;
+	/** index of the datagram in buf and rep, per reply */
+	int* send_idx;
+};
+#endif /* USE_UDP_BATCH */
+
 /**
  * The internal event structure for keeping ub_event info for the event.
  * Possibly other structures (list, tree) this is part of.
@@ -118,6 +156,8 @@ struct internal_base {
 	struct ub_event* slow_accept;
 	/** true if slow_accept is enabled */
 	int slow_accept_enabled;
+	/** number of queries outstanding on the pipelined TCP streams */
+	int tcp_pipeline_count;
 };
 
 /**
@@ -379,6 +419,60 @@ comm_point_send_udp_msg(struct comm_point *c, sldns_buffer* packet,
 	return 1;
 }
 
+int
+comm_point_send_udp_msgs(struct comm_point* c, sldns_buffer** packets,
+	int num, struct sockaddr* addr, socklen_t addrlen)
+{
+#ifdef USE_UDP_BATCH
+	struct mmsghdr msg[UDP_SEND_MAX];
+	struct iovec iov[UDP_SEND_MAX];
+	int i, n, sent, done = 0;
+	log_assert(c->fd != -1);
+	log_assert(addr && addrlen > 0);
+	if(num == 1)
+		return comm_point_send_udp_msg(c, packets[0], addr, addrlen);
+	while(done < num) {
+		/* at most UDP_SEND_MAX messages per sendmmsg call */
+		n = num - done;
+		if(n > UDP_SEND_MAX)
+			n = UDP_SEND_MAX;
+		memset(msg, 0, sizeof(msg[0])*(size_t)n);
+		for(i=0; i<n; i++) {
+			iov[i].iov_base = sldns_buffer_begin(packets[done+i]);
+			iov[i].iov_len = sldns_buffer_remaining(
+				packets[done+i]);
+			msg[i].msg_hdr.msg_name = addr;
+			msg[i].msg_hdr.msg_namelen = addrlen;
+			msg[i].msg_hdr.msg_iov = &iov[i];
+			msg[i].msg_hdr.msg_iovlen = 1;
+		}
+		i = 0;
+		while(i < n) {
+			sent = sendmmsg(c->fd, msg+i, (unsigned int)(n-i), 0);
+			if(sent > 0) {
+				i += sent;
+				continue;
+			}
+			/* the single send blocks on a full buffer, and logs
+			 * errors */
+			if(!comm_point_send_udp_msg(c, packets[done+i], addr,
+				addrlen))
+				return done+i;
+			i++;
+		}
+		done += n;
+	}
+	return done;
+#else
+	int i;
+	for(i=0; i<num; i++) {
+		if(!comm_point_send_udp_msg(c, packets[i], addr, addrlen))
+			return i;
+	}
+	return num;
+#endif /* USE_UDP_BATCH */
+}
+
 #if defined(AF_INET6) && defined(IPV6_PKTINFO) && (defined(HAVE_RECVMSG) || defined(HAVE_SENDMSG))
 /** print debug ancillary info */
 static void p_ancil(const char* str, struct comm_reply* r)
@@ -427,46 +521,27 @@ static void p_ancil(const char* str, struct comm_reply* r)
 }
 #endif /* AF_INET6 && IPV6_PKTINFO && HAVE_RECVMSG||HAVE_SENDMSG */
 
-/** send a UDP reply over specified interface*/
-static int
-comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
-	struct sockaddr* addr, socklen_t addrlen, struct comm_reply* r) 
-{
 #if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_SENDMSG)
-	ssize_t sent;
-	struct msghdr msg;
-	struct iovec iov[1];
-	char control[256];
+/**
+ * Put the source interface for a UDP reply in the ancillary data of msg.
+ * @param msg: msg_control points to the space for it, and msg_controllen
+ *	is the size of that space.  Set to the length used.
+ * @param r: reply info with the interface.
+ */
+static void
+udp_send_set_ancil(struct msghdr* msg, struct comm_reply* r)
+{
 #ifndef S_SPLINT_S
 	struct cmsghdr *cmsg;
-#endif /* S_SPLINT_S */
-
-	log_assert(c->fd != -1);
-#ifdef UNBOUND_DEBUG
-	if(sldns_buffer_remaining(packet) == 0)
-		log_err("error: send empty UDP packet");
-#endif
-	log_assert(addr && addrlen > 0);
-
-	msg.msg_name = addr;
-	msg.msg_namelen = addrlen;
-	iov[0].iov_base = sldns_buffer_begin(packet);
-	iov[0].iov_len = sldns_buffer_remaining(packet);
-	msg.msg_iov = iov;
-	msg.msg_iovlen = 1;
-	msg.msg_control = control;
-#ifndef S_SPLINT_S
-	msg.msg_controllen = sizeof(control);
-#endif /* S_SPLINT_S */
-	msg.msg_flags = 0;
+	size_t ctrlsize = (size_t)msg->msg_controllen;
+	(void)ctrlsize; /* only used by log_assert */
 
-#ifndef S_SPLINT_S
-	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg = CMSG_FIRSTHDR(msg);
 	if(r->srctype == 4) {
 #ifdef IP_PKTINFO
 		void* cmsg_data;
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in_pktinfo));
-		log_assert(msg.msg_controllen <= sizeof(control));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in_pktinfo));
+		log_assert(msg->msg_controllen <= ctrlsize);
 		cmsg->cmsg_level = IPPROTO_IP;
 		cmsg->cmsg_type = IP_PKTINFO;
 		memmove(CMSG_DATA(cmsg), &r->pktinfo.v4info,
@@ -476,8 +551,8 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 		((struct in_pktinfo *) cmsg_data)->ipi_ifindex = 0;
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in_pktinfo));
 #elif defined(IP_SENDSRCADDR)
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in_addr));
-		log_assert(msg.msg_controllen <= sizeof(control));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in_addr));
+		log_assert(msg->msg_controllen <= ctrlsize);
 		cmsg->cmsg_level = IPPROTO_IP;
 		cmsg->cmsg_type = IP_SENDSRCADDR;
 		memmove(CMSG_DATA(cmsg), &r->pktinfo.v4addr,
@@ -485,12 +560,12 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in_addr));
 #else
 		verbose(VERB_ALGO, "no IP_PKTINFO or IP_SENDSRCADDR");
-		msg.msg_control = NULL;
+		msg->msg_control = NULL;
 #endif /* IP_PKTINFO or IP_SENDSRCADDR */
 	} else if(r->srctype == 6) {
 		void* cmsg_data;
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
-		log_assert(msg.msg_controllen <= sizeof(control));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
+		log_assert(msg->msg_controllen <= ctrlsize);
 		cmsg->cmsg_level = IPPROTO_IPV6;
 		cmsg->cmsg_type = IPV6_PKTINFO;
 		memmove(CMSG_DATA(cmsg), &r->pktinfo.v6info,
@@ -501,14 +576,51 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in6_pktinfo));
 	} else {
 		/* try to pass all 0 to use default route */
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
-		log_assert(msg.msg_controllen <= sizeof(control));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
+		log_assert(msg->msg_controllen <= ctrlsize);
 		cmsg->cmsg_level = IPPROTO_IPV6;
 		cmsg->cmsg_type = IPV6_PKTINFO;
 		memset(CMSG_DATA(cmsg), 0, sizeof(struct in6_pktinfo));
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in6_pktinfo));
 	}
+#else
+	(void)msg;
+	(void)r;
 #endif /* S_SPLINT_S */
+}
+#endif /* AF_INET6 && IPV6_PKTINFO && HAVE_SENDMSG */
+
+/** send a UDP reply over specified interface*/
+static int
+comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
+	struct sockaddr* addr, socklen_t addrlen, struct comm_reply* r) 
+{
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_SENDMSG)
+	ssize_t sent;
+	struct msghdr msg;
+	struct iovec iov[1];
+	char control[256];
+
+	log_assert(c->fd != -1);
+#ifdef UNBOUND_DEBUG
+	if(sldns_buffer_remaining(packet) == 0)
+		log_err("error: send empty UDP packet");
+#endif
+	log_assert(addr && addrlen > 0);
+
+	msg.msg_name = addr;
+	msg.msg_namelen = addrlen;
+	iov[0].iov_base = sldns_buffer_begin(packet);
+	iov[0].iov_len = sldns_buffer_remaining(packet);
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+#ifndef S_SPLINT_S
+	msg.msg_controllen = sizeof(control);
+#endif /* S_SPLINT_S */
+	msg.msg_flags = 0;
+
+	udp_send_set_ancil(&msg, r);
 	if(verbosity >= VERB_ALGO)
 		p_ancil("send_udp over interface", r);
 	sent = sendmsg(c->fd, &msg, 0);
@@ -565,6 +677,296 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 #endif /* AF_INET6 && IPV6_PKTINFO && HAVE_SENDMSG */
 }
 
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_RECVMSG)
+/**
+ * Get the destination interface of a received UDP datagram from the
+ * ancillary data of msg.
+ * @param msg: the received msg.
+ * @param rep: reply info, srctype and pktinfo are set.
+ */
+static void
+udp_recv_get_ancil(struct msghdr* msg, struct comm_reply* rep)
+{
+#ifndef S_SPLINT_S
+	struct cmsghdr* cmsg;
+#endif /* S_SPLINT_S */
+	rep->srctype = 0;
+#ifndef S_SPLINT_S
+	for(cmsg = CMSG_FIRSTHDR(msg); cmsg != NULL;
+		cmsg = CMSG_NXTHDR(msg, cmsg)) {
+		if( cmsg->cmsg_level == IPPROTO_IPV6 &&
+			cmsg->cmsg_type == IPV6_PKTINFO) {
+			rep->srctype = 6;
+			memmove(&rep->pktinfo.v6info, CMSG_DATA(cmsg),
+				sizeof(struct in6_pktinfo));
+			break;
+#ifdef IP_PKTINFO
+		} else if( cmsg->cmsg_level == IPPROTO_IP &&
+			cmsg->cmsg_type == IP_PKTINFO) {
+			rep->srctype = 4;
+			memmove(&rep->pktinfo.v4info, CMSG_DATA(cmsg),
+				sizeof(struct in_pktinfo));
+			break;
+#elif defined(IP_RECVDSTADDR)
+		} else if( cmsg->cmsg_level == IPPROTO_IP &&
+			cmsg->cmsg_type == IP_RECVDSTADDR) {
+			rep->srctype = 4;
+			memmove(&rep->pktinfo.v4addr, CMSG_DATA(cmsg),
+				sizeof(struct in_addr));
+			break;
+#endif /* IP_PKTINFO or IP_RECVDSTADDR */
+		}
+	}
+	if(verbosity >= VERB_ALGO)
+		p_ancil("receive_udp on interface", rep);
+#else
+	(void)msg;
+#endif /* S_SPLINT_S */
+}
+#endif /* AF_INET6 && IPV6_PKTINFO && HAVE_RECVMSG */
+
+#ifdef USE_UDP_BATCH
+/** delete udp batch */
+static void
+udp_batch_delete(struct udp_batch* b)
+{
+	int i;
+	if(!b)
+		return;
+	if(b->buf) {
+		for(i=0; i<b->num; i++)
+			sldns_buffer_free(b->buf[i]);
+		free(b->buf);
+	}
+	free(b->rep);
+	free(b->recv_msg);
+	free(b->recv_iov);
+	free(b->recv_ancil);
+	free(b->send_msg);
+	free(b->send_iov);
+	free(b->send_ancil);
+	free(b->send_idx);
+	free(b);
+}
+
+/** create udp batch with num datagrams of bufsize */
+static struct udp_batch*
+udp_batch_create(int num, size_t bufsize)
+{
+	int i;
+	struct udp_batch* b = (struct udp_batch*)calloc(1, sizeof(*b));
+	if(!b)
+		return NULL;
+	b->num = num;
+	b->buf = (struct sldns_buffer**)calloc((size_t)num,
+		sizeof(struct sldns_buffer*));
+	b->rep = (struct comm_reply*)calloc((size_t)num,
+		sizeof(struct comm_reply));
+	b->recv_msg = (struct mmsghdr*)calloc((size_t)num,
+		sizeof(struct mmsghdr));
+	b->recv_iov = (struct iovec*)calloc((size_t)num,
+		sizeof(struct iovec));
+	b->recv_ancil = (char*)calloc((size_t)num, UDP_BATCH_ANCIL);
+	b->send_msg = (struct mmsghdr*)calloc((size_t)num,
+		sizeof(struct mmsghdr));
+	b->send_iov = (struct iovec*)calloc((size_t)num,
+		sizeof(struct iovec));
+	b->send_ancil = (char*)calloc((size_t)num, UDP_BATCH_ANCIL);
+	b->send_idx = (int*)calloc((size_t)num, sizeof(int));
+	if(!b->buf || !b->rep || !b->recv_msg || !b->recv_iov ||
+		!b->recv_ancil || !b->send_msg || !b->send_iov ||
+		!b->send_ancil || !b->send_idx) {
+		/* buf entries are NULL, the num is not used to free them */
+		b->num = 0;
+		udp_batch_delete(b);
+		return NULL;
+	}
+	for(i=0; i<num; i++) {
+		b->buf[i] = sldns_buffer_new(bufsize);
+		if(!b->buf[i]) {
+			b->num = i;
+			udp_batch_delete(b);
+			return NULL;
+		}
+	}
+	return b;
+}
+
+/** get memory used by udp batch */
+static size_t
+udp_batch_get_mem(struct udp_batch* b)
+{
+	size_t s;
+	int i;
+	if(!b)
+		return 0;
+	s = sizeof(*b) + (size_t)b->num * (sizeof(struct sldns_buffer*) +
+		sizeof(struct comm_reply) + 2*sizeof(struct mmsghdr) +
+		2*sizeof(struct iovec) + 2*UDP_BATCH_ANCIL + sizeof(int));
+	for(i=0; i<b->num; i++)
+		s += sizeof(*b->buf[i]) + sldns_buffer_capacity(b->buf[i]);
+	return s;
+}
+
+/** send one reply from the batch, with the single message routines,
+ * that wait for buffer space and log errors */
+static void
+udp_batch_send_one(struct comm_point* c, int i)
+{
+	struct udp_batch* b = c->udp_batch;
+	if(b->ancil)
+		(void)comm_point_send_udp_msg_if(c, b->buf[i],
+			(struct sockaddr*)&b->rep[i].addr, b->rep[i].addrlen,
+			&b->rep[i]);
+	else
+		(void)comm_point_send_udp_msg(c, b->buf[i],
+			(struct sockaddr*)&b->rep[i].addr, b->rep[i].addrlen);
+}
+
+/** add the reply in datagram i to the replies to send */
+static void
+udp_batch_add_reply(struct udp_batch* b, int i)
+{
+	struct msghdr* msg = &b->send_msg[b->num_send].msg_hdr;
+	struct iovec* iov = &b->send_iov[b->num_send];
+	log_assert(b->num_send < b->num);
+#ifdef UNBOUND_DEBUG
+	if(sldns_buffer_remaining(b->buf[i]) == 0)
+		log_err("error: send empty UDP packet");
+#endif
+	iov->iov_base = sldns_buffer_begin(b->buf[i]);
+	iov->iov_len = sldns_buffer_remaining(b->buf[i]);
+	msg->msg_name = &b->rep[i].addr;
+	msg->msg_namelen = b->rep[i].addrlen;
+	msg->msg_iov = iov;
+	msg->msg_iovlen = 1;
+	msg->msg_control = NULL;
+	msg->msg_controllen = 0;
+	msg->msg_flags = 0;
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_SENDMSG)
+	if(b->ancil) {
+		msg->msg_control = b->send_ancil +
+			(size_t)b->num_send*UDP_BATCH_ANCIL;
+		msg->msg_controllen = UDP_BATCH_ANCIL;
+		udp_send_set_ancil(msg, &b->rep[i]);
+		if(verbosity >= VERB_ALGO)
+			p_ancil("send_udp over interface", &b->rep[i]);
+	}
+#endif
+	b->send_idx[b->num_send] = i;
+	b->num_send++;
+}
+
+/** send the replies in the batch */
+static void
+udp_batch_flush(struct comm_point* c)
+{
+	struct udp_batch* b = c->udp_batch;
+	int done = 0, n;
+	while(done < b->num_send) {
+		n = sendmmsg(c->fd, b->send_msg+done,
+			(unsigned int)(b->num_send-done), 0);
+		if(n <= 0) {
+			/* the first one failed, the single send routine
+			 * waits for buffer space, or logs the error */
+			udp_batch_send_one(c, b->send_idx[done]);
+			n = 1;
+		}
+		done += n;
+	}
+	b->num_send = 0;
+}
+
+/** 
+ * Read UDP datagrams with recvmmsg, and send the immediate replies
+ * with sendmmsg.  The callback is called with c->buffer set to the
+ * buffer of the datagram, and it is set back afterwards.
+ * @param c: comm point with udp batch.
+ * @param fd: file descriptor.
+ * @param ancil: if the datagrams have ancillary data, the interface.
+ */
+static void
+udp_batch_callback(struct comm_point* c, int fd, int ancil)
+{
+	struct udp_batch* b = c->udp_batch;
+	struct sldns_buffer* buffer = c->buffer;
+	struct msghdr* msg;
+	int i, n, total = 0;
+
+	b->ancil = ancil;
+	while(total < NUM_UDP_PER_SELECT) {
+		for(i=0; i<b->num; i++) {
+			sldns_buffer_clear(b->buf[i]);
+			msg = &b->recv_msg[i].msg_hdr;
+			b->recv_iov[i].iov_base = sldns_buffer_begin(b->buf[i]);
+			b->recv_iov[i].iov_len = sldns_buffer_remaining(
+				b->buf[i]);
+			msg->msg_name = &b->rep[i].addr;
+			msg->msg_namelen = (socklen_t)sizeof(b->rep[i].addr);
+			msg->msg_iov = &b->recv_iov[i];
+			msg->msg_iovlen = 1;
+			if(ancil) {
+				msg->msg_control = b->recv_ancil +
+					(size_t)i*UDP_BATCH_ANCIL;
+				msg->msg_controllen = UDP_BATCH_ANCIL;
+			} else {
+				msg->msg_control = NULL;
+				msg->msg_controllen = 0;
+			}
+			msg->msg_flags = 0;
+			b->recv_msg[i].msg_len = 0;
+		}
+		n = recvmmsg(fd, b->recv_msg, (unsigned int)b->num, 0, NULL);
+		if(n == -1) {
+			if(errno != EAGAIN && errno != EINTR)
+				log_err("recvmmsg %d failed: %s", 
+					fd, strerror(errno));
+			return;
+		}
+		if(n == 0)
+			return;
+		c->udp_batch_count++;
+		c->udp_batch_pkts += (size_t)n;
+		b->num_send = 0;
+		for(i=0; i<n; i++) {
+			struct comm_reply* rep = &b->rep[i];
+			rep->c = c;
+			rep->addrlen = b->recv_msg[i].msg_hdr.msg_namelen;
+			sldns_buffer_skip(b->buf[i],
+				(ssize_t)b->recv_msg[i].msg_len);
+			sldns_buffer_flip(b->buf[i]);
+			rep->srctype = 0;
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_RECVMSG)
+			if(ancil)
+				udp_recv_get_ancil(&b->recv_msg[i].msg_hdr,
+					rep);
+#endif
+			c->buffer = b->buf[i];
+#ifdef USE_DNSCRYPT
+			c->dnscrypt_buffer = b->buf[i];
+#endif
+			fptr_ok(fptr_whitelist_comm_point(c->callback));
+			if((*c->callback)(c, c->cb_arg, NETEVENT_NOERROR, rep))
+				udp_batch_add_reply(b, i);
+			c->buffer = buffer;
+#ifdef USE_DNSCRYPT
+			c->dnscrypt_buffer = buffer;
+#endif
+			if(c->fd != fd) {
+				/* commpoint closed or reused for another
+				 * port, the replies are not sent */
+				b->num_send = 0;
+				return;
+			}
+		}
+		udp_batch_flush(c);
+		total += n;
+		if(n < b->num)
+			break;
+	}
+}
+#endif /* USE_UDP_BATCH */
+
 void 
 comm_point_udp_ancil_callback(int fd, short event, void* arg)
 {
@@ -575,9 +977,6 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 	ssize_t rcv;
 	char ancil[256];
 	int i;
-#ifndef S_SPLINT_S
-	struct cmsghdr* cmsg;
-#endif /* S_SPLINT_S */
 
 	rep.c = (struct comm_point*)arg;
 	log_assert(rep.c->type == comm_udp);
@@ -586,6 +985,12 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 		return;
 	log_assert(rep.c && rep.c->buffer && rep.c->fd == fd);
 	ub_comm_base_now(rep.c->ev->base);
+#ifdef USE_UDP_BATCH
+	if(rep.c->udp_batch) {
+		udp_batch_callback(rep.c, fd, 1);
+		return;
+	}
+#endif
 	for(i=0; i<NUM_UDP_PER_SELECT; i++) {
 		sldns_buffer_clear(rep.c->buffer);
 		rep.addrlen = (socklen_t)sizeof(rep.addr);
@@ -612,36 +1017,7 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 		rep.addrlen = msg.msg_namelen;
 		sldns_buffer_skip(rep.c->buffer, rcv);
 		sldns_buffer_flip(rep.c->buffer);
-		rep.srctype = 0;
-#ifndef S_SPLINT_S
-		for(cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL;
-			cmsg = CMSG_NXTHDR(&msg, cmsg)) {
-			if( cmsg->cmsg_level == IPPROTO_IPV6 &&
-				cmsg->cmsg_type == IPV6_PKTINFO) {
-				rep.srctype = 6;
-				memmove(&rep.pktinfo.v6info, CMSG_DATA(cmsg),
-					sizeof(struct in6_pktinfo));
-				break;
-#ifdef IP_PKTINFO
-			} else if( cmsg->cmsg_level == IPPROTO_IP &&
-				cmsg->cmsg_type == IP_PKTINFO) {
-				rep.srctype = 4;
-				memmove(&rep.pktinfo.v4info, CMSG_DATA(cmsg),
-					sizeof(struct in_pktinfo));
-				break;
-#elif defined(IP_RECVDSTADDR)
-			} else if( cmsg->cmsg_level == IPPROTO_IP &&
-				cmsg->cmsg_type == IP_RECVDSTADDR) {
-				rep.srctype = 4;
-				memmove(&rep.pktinfo.v4addr, CMSG_DATA(cmsg),
-					sizeof(struct in_addr));
-				break;
-#endif /* IP_PKTINFO or IP_RECVDSTADDR */
-			}
-		}
-		if(verbosity >= VERB_ALGO)
-			p_ancil("receive_udp on interface", &rep);
-#endif /* S_SPLINT_S */
+		udp_recv_get_ancil(&msg, &rep);
 		fptr_ok(fptr_whitelist_comm_point(rep.c->callback));
 		if((*rep.c->callback)(rep.c, rep.c->cb_arg, NETEVENT_NOERROR, &rep)) {
 			/* send back immediate reply */
@@ -675,6 +1051,12 @@ comm_point_udp_callback(int fd, short event, void* arg)
 		return;
 	log_assert(rep.c && rep.c->buffer && rep.c->fd == fd);
 	ub_comm_base_now(rep.c->ev->base);
+#ifdef USE_UDP_BATCH
+	if(rep.c->udp_batch) {
+		udp_batch_callback(rep.c, fd, 0);
+		return;
+	}
+#endif
 	for(i=0; i<NUM_UDP_PER_SELECT; i++) {
 		sldns_buffer_clear(rep.c->buffer);
 		rep.addrlen = (socklen_t)sizeof(rep.addr);
@@ -909,11 +1291,42 @@ comm_point_tcp_accept_callback(int fd, short event, void* arg)
 	setup_tcp_handler(c_hdl, new_fd, c->cur_tcp_count, c->max_tcp_count);
 }
 
+/** free the queued answers of a pipelined stream */
+static void
+tcp_req_info_free_done(struct tcp_req_info* req)
+{
+	struct tcp_req_done_item* item = req->done_req_list, *next;
+	while(item) {
+		next = item->next;
+		free(item);
+		item = next;
+	}
+	req->done_req_list = NULL;
+	req->done_req_last = NULL;
+	req->num_done_req = 0;
+	req->done_req_mem = 0;
+}
+
+/** reset a pipelined stream when it is closed, the answers that are
+ * still to come for it are discarded because the generation changes */
+static void
+tcp_req_info_clear(struct tcp_req_info* req)
+{
+	req->cp->ev->base->eb->tcp_pipeline_count -= req->num_open_req +
+		req->num_done_req;
+	tcp_req_info_free_done(req);
+	req->num_open_req = 0;
+	req->read_is_closed = 0;
+	req->cp->repinfo.tcp_gen++;
+}
+
 /** Make tcp handler free for next assignment */
 static void
 reclaim_tcp_handler(struct comm_point* c)
 {
 	log_assert(c->type == comm_tcp);
+	if(c->tcp_req_info)
+		tcp_req_info_clear(c->tcp_req_info);
 	if(c->ssl) {
 #ifdef HAVE_SSL
 		SSL_shutdown(c->ssl);
@@ -933,11 +1346,203 @@ reclaim_tcp_handler(struct comm_point* c)
 	}
 }
 
+/** see if another query can be read from a pipelined stream */
+static int
+tcp_req_info_can_read(struct tcp_req_info* req)
+{
+	struct comm_point* acc = req->cp->tcp_parent;
+	int num = req->num_open_req + req->num_done_req;
+	if(req->read_is_closed)
+		return 0;
+	/* the first query is always read, also when the other streams
+	 * use up the total */
+	if(num == 0)
+		return 1;
+	return num < acc->tcp_pipeline_max &&
+		req->cp->ev->base->eb->tcp_pipeline_count <
+		acc->tcp_pipeline_total;
+}
+
+/** see if a TLS stream that is ready to read has decrypted bytes waiting,
+ * those do not make the socket readable */
+static int
+ssl_read_again(struct comm_point* c)
+{
+#ifdef HAVE_SSL
+	return c->fd != -1 && c->ssl && c->tcp_is_reading &&
+		c->tcp_byte_count == 0 &&
+		c->ssl_shake_state == comm_ssl_shake_none &&
+		(!c->tcp_req_info || tcp_req_info_can_read(c->tcp_req_info)) &&
+		SSL_pending(c->ssl) > 0;
+#else
+	(void)c;
+	return 0;
+#endif
+}
+
+/** start to write the answer in the stream buffer */
+static void
+tcp_req_info_start_write(struct comm_point* c)
+{
+	c->tcp_is_reading = 0;
+	c->tcp_byte_count = 0;
+	comm_point_stop_listening(c);
+	comm_point_start_listening(c, -1, c->tcp_timeout_msec);
+}
+
+/**
+ * Continue a pipelined stream when its buffer is free: write the next
+ * queued answer, read the next query, or wait for the answers that are
+ * still resolving.  The stream is closed when the client has stopped
+ * sending and all answers are written.
+ * @param req: the stream.
+ * @return false if the stream has been closed.
+ */
+static int
+tcp_req_info_pickup(struct tcp_req_info* req)
+{
+	struct comm_point* c = req->cp;
+	sldns_buffer_clear(c->buffer);
+	c->tcp_byte_count = 0;
+	if(req->done_req_list) {
+		struct tcp_req_done_item* item = req->done_req_list;
+		req->done_req_list = item->next;
+		if(!req->done_req_list)
+			req->done_req_last = NULL;
+		req->num_done_req--;
+		req->done_req_mem -= sizeof(*item) + item->len;
+		c->ev->base->eb->tcp_pipeline_count--;
+		sldns_buffer_write(c->buffer, item->buf, item->len);
+		sldns_buffer_flip(c->buffer);
+		free(item);
+		tcp_req_info_start_write(c);
+		return 1;
+	}
+	c->tcp_is_reading = 1;
+	if(tcp_req_info_can_read(req)) {
+		comm_point_stop_listening(c);
+		comm_point_start_listening(c, -1, c->tcp_timeout_msec);
+		return 1;
+	}
+	if(req->read_is_closed && req->num_open_req == 0) {
+		reclaim_tcp_handler(c);
+		if(!c->tcp_do_close) {
+			fptr_ok(fptr_whitelist_comm_point(c->callback));
+			(void)(*c->callback)(c, c->cb_arg, NETEVENT_CLOSED,
+				NULL);
+		}
+		return 0;
+	}
+	/* wait for the answers, no timeout while the queries resolve,
+	 * like for a stream that is not pipelined */
+	comm_point_stop_listening(c);
+	return 1;
+}
+
+/** the client stopped sending on a pipelined stream, or it timed out
+ * while queries are outstanding.
+ * @return true if the stream is kept to write the answers. */
+static int
+tcp_req_info_read_close(struct tcp_req_info* req)
+{
+	if(!req->cp->tcp_is_reading ||
+		req->num_open_req + req->num_done_req == 0)
+		return 0;
+	verbose(VERB_ALGO, "tcp pipeline: read closed, %d answers to send",
+		req->num_open_req + req->num_done_req);
+	req->read_is_closed = 1;
+	(void)tcp_req_info_pickup(req);
+	return 1;
+}
+
+/** a query has been read on a pipelined stream, pass it to the callback */
+static void
+tcp_req_info_handle_readdone(struct tcp_req_info* req)
+{
+	struct comm_point* c = req->cp;
+	int r;
+	c->tcp_byte_count = 0;
+	req->is_drop = 0;
+	req->num_open_req++;
+	c->ev->base->eb->tcp_pipeline_count++;
+	req->in_worker_handle = 1;
+	fptr_ok(fptr_whitelist_comm_point(c->callback));
+	r = (*c->callback)(c, c->cb_arg, NETEVENT_NOERROR, &c->repinfo);
+	req->in_worker_handle = 0;
+	if(req->is_drop) {
+		/* dropped while in the callback */
+		reclaim_tcp_handler(c);
+		return;
+	}
+	if(r) {
+		/* the answer is in the stream buffer, it goes first */
+		req->num_open_req--;
+		c->ev->base->eb->tcp_pipeline_count--;
+		tcp_req_info_start_write(c);
+		return;
+	}
+	/* the query resolves in the mesh; the answers that arrived while
+	 * reading are written, or the next query is read */
+	(void)tcp_req_info_pickup(req);
+}
+
+/** an answer for a query on a pipelined stream, it has been encoded
+ * into the spool buffer, write it or queue it */
+static void
+tcp_req_info_send_reply(struct comm_reply* repinfo)
+{
+	struct comm_point* c = repinfo->c;
+	struct tcp_req_info* req = c->tcp_req_info;
+	struct sldns_buffer* buf = req->spool_buffer;
+	struct tcp_req_done_item* item;
+	if(repinfo->tcp_gen != c->repinfo.tcp_gen) {
+		verbose(VERB_ALGO, "tcp pipeline: answer for closed stream "
+			"discarded");
+		return;
+	}
+	req->num_open_req--;
+	if(!req->in_worker_handle && c->tcp_is_reading &&
+		c->tcp_byte_count == 0 && !req->done_req_list) {
+		/* the stream is idle, write the answer right away */
+		c->ev->base->eb->tcp_pipeline_count--;
+		sldns_buffer_clear(c->buffer);
+		sldns_buffer_write(c->buffer, sldns_buffer_begin(buf),
+			sldns_buffer_limit(buf));
+		sldns_buffer_flip(c->buffer);
+		tcp_req_info_start_write(c);
+		return;
+	}
+	/* the stream is busy reading or writing, queue the answer */
+	item = (struct tcp_req_done_item*)malloc(sizeof(*item) +
+		sldns_buffer_limit(buf));
+	if(!item) {
+		log_err("tcp pipeline: out of memory, dropping stream");
+		if(req->in_worker_handle)
+			req->is_drop = 1;
+		else	reclaim_tcp_handler(c);
+		return;
+	}
+	item->next = NULL;
+	item->buf = (uint8_t*)item + sizeof(*item);
+	item->len = sldns_buffer_limit(buf);
+	memmove(item->buf, sldns_buffer_begin(buf), item->len);
+	if(req->done_req_last)
+		req->done_req_last->next = item;
+	else	req->done_req_list = item;
+	req->done_req_last = item;
+	req->num_done_req++;
+	req->done_req_mem += sizeof(*item) + item->len;
+}
+
 /** do the callback when writing is done */
 static void
 tcp_callback_writer(struct comm_point* c)
 {
 	log_assert(c->type == comm_tcp);
+	if(c->tcp_req_info) {
+		(void)tcp_req_info_pickup(c->tcp_req_info);
+		return;
+	}
 	sldns_buffer_clear(c->buffer);
 	if(c->tcp_do_toggle_rw)
 		c->tcp_is_reading = 1;
@@ -945,6 +1550,11 @@ tcp_callback_writer(struct comm_point* c)
 	/* switch from listening(write) to listening(read) */
 	comm_point_stop_listening(c);
 	comm_point_start_listening(c, -1, -1);
+	if(c->tcp_notify_written) {
+		/* the owner can continue with the next write */
+		fptr_ok(fptr_whitelist_comm_point(c->callback));
+		(void)(*c->callback)(c, c->cb_arg, NETEVENT_PKT_WRITTEN, NULL);
+	}
 }
 
 /** do the callback when reading is done */
@@ -953,6 +1563,10 @@ tcp_callback_reader(struct comm_point* c)
 {
 	log_assert(c->type == comm_tcp || c->type == comm_local);
 	sldns_buffer_flip(c->buffer);
+	if(c->tcp_req_info) {
+		tcp_req_info_handle_readdone(c->tcp_req_info);
+		return;
+	}
 	if(c->tcp_do_toggle_rw)
 		c->tcp_is_reading = 0;
 	c->tcp_byte_count = 0;
@@ -1109,6 +1723,9 @@ ssl_handle_read(struct comm_point* c)
 	sldns_buffer_skip(c->buffer, (ssize_t)r);
 	if(sldns_buffer_remaining(c->buffer) <= 0) {
 		tcp_callback_reader(c);
+		/* the next pipelined query may be decrypted already */
+		if(ssl_read_again(c))
+			return ssl_handle_read(c);
 	}
 	return 1;
 #else
@@ -1163,6 +1780,8 @@ ssl_handle_write(struct comm_point* c)
 			sizeof(uint16_t));
 		if(sldns_buffer_remaining(c->buffer) == 0) {
 			tcp_callback_writer(c);
+			if(ssl_read_again(c))
+				return ssl_handle_read(c);
 			return 1;
 		}
 	}
@@ -1193,6 +1812,9 @@ ssl_handle_write(struct comm_point* c)
 
 	if(sldns_buffer_remaining(c->buffer) == 0) {
 		tcp_callback_writer(c);
+		/* the next query may be decrypted already */
+		if(ssl_read_again(c))
+			return ssl_handle_read(c);
 	}
 	return 1;
 #else
@@ -1565,6 +2187,11 @@ comm_point_tcp_handle_callback(int fd, short event, void* arg)
 
 	if(event&UB_EV_READ) {
 		if(!comm_point_tcp_handle_read(fd, c, 0)) {
+			/* a half closed TCP stream gets its answers, a TLS
+			 * stream is closed for both directions */
+			if(c->tcp_req_info && !c->ssl &&
+				tcp_req_info_read_close(c->tcp_req_info))
+				return;
 			reclaim_tcp_handler(c);
 			if(!c->tcp_do_close) {
 				fptr_ok(fptr_whitelist_comm_point(
@@ -1588,6 +2215,8 @@ comm_point_tcp_handle_callback(int fd, short event, void* arg)
 		return;
 	}
 	if(event&UB_EV_TIMEOUT) {
+		if(c->tcp_req_info && tcp_req_info_read_close(c->tcp_req_info))
+			return;
 		verbose(VERB_QUERY, "tcp took too long, dropped");
 		reclaim_tcp_handler(c);
 		if(!c->tcp_do_close) {
@@ -1748,6 +2377,31 @@ comm_point_create_udp_ancil(struct comm_base *base, int fd,
 	return c;
 }
 
+int
+comm_point_set_udp_batch(struct comm_point* c, int num)
+{
+	log_assert(c->type == comm_udp);
+#ifdef USE_UDP_BATCH
+	udp_batch_delete(c->udp_batch);
+	c->udp_batch = NULL;
+	if(num <= 1)
+		return 1;
+	if(num > NUM_UDP_PER_SELECT)
+		num = NUM_UDP_PER_SELECT;
+	c->udp_batch = udp_batch_create(num, sldns_buffer_capacity(c->buffer));
+	if(!c->udp_batch) {
+		log_err("could not allocate udp batch");
+		return 0;
+	}
+#else
+	(void)c;
+	if(num > 1)
+		verbose(VERB_ALGO, "udp batch: no recvmmsg and sendmmsg, "
+			"datagrams are not batched");
+#endif /* USE_UDP_BATCH */
+	return 1;
+}
+
 static struct comm_point* 
 comm_point_create_tcp_handler(struct comm_base *base, 
 	struct comm_point* parent, size_t bufsize,
@@ -1896,6 +2550,30 @@ comm_point_create_tcp(struct comm_base *base, int fd, int num, size_t bufsize,
 	return c;
 }
 
+int
+comm_point_set_tcp_pipeline(struct comm_point* c,
+	struct sldns_buffer* spoolbuf, int num, int total)
+{
+	int i;
+	log_assert(c->type == comm_tcp_accept);
+	if(num <= 1)
+		return 1;
+	c->tcp_pipeline_max = num;
+	c->tcp_pipeline_total = total;
+	for(i=0; i<c->max_tcp_count; i++) {
+		struct comm_point* h = c->tcp_handlers[i];
+		h->tcp_req_info = (struct tcp_req_info*)calloc(1,
+			sizeof(struct tcp_req_info));
+		if(!h->tcp_req_info) {
+			log_err("tcp pipeline: out of memory");
+			return 0;
+		}
+		h->tcp_req_info->cp = h;
+		h->tcp_req_info->spool_buffer = spoolbuf;
+	}
+	return 1;
+}
+
 struct comm_point* 
 comm_point_create_tcp_out(struct comm_base *base, size_t bufsize,
         comm_point_callback_type* callback, void* callback_arg)
@@ -2124,6 +2802,13 @@ comm_point_delete(struct comm_point* c)
 		free(c->tcp_handlers);
 	}
 	free(c->timeout);
+#ifdef USE_UDP_BATCH
+	udp_batch_delete(c->udp_batch);
+#endif
+	if(c->tcp_req_info) {
+		tcp_req_info_free_done(c->tcp_req_info);
+		free(c->tcp_req_info);
+	}
 	if(c->type == comm_tcp || c->type == comm_local) {
 		sldns_buffer_free(c->buffer);
 #ifdef USE_DNSCRYPT
@@ -2164,6 +2849,15 @@ comm_point_send_reply(struct comm_reply *repinfo)
 			dt_msg_send_client_response(repinfo->c->dtenv,
 			&repinfo->addr, repinfo->c->type, repinfo->c->buffer);
 #endif
+	} else if(repinfo->c->tcp_req_info) {
+#ifdef USE_DNSTAP
+		if(repinfo->c->tcp_parent->dtenv != NULL &&
+		   repinfo->c->tcp_parent->dtenv->log_client_response_messages)
+			dt_msg_send_client_response(repinfo->c->tcp_parent->dtenv,
+			&repinfo->addr, repinfo->c->type,
+			repinfo->c->tcp_req_info->spool_buffer);
+#endif
+		tcp_req_info_send_reply(repinfo);
 	} else {
 #ifdef USE_DNSTAP
 		if(repinfo->c->tcp_parent->dtenv != NULL &&
@@ -2185,6 +2879,16 @@ comm_point_drop_reply(struct comm_reply* repinfo)
 	log_assert(repinfo->c->type != comm_tcp_accept);
 	if(repinfo->c->type == comm_udp)
 		return;
+	if(repinfo->c->tcp_req_info) {
+		/* the stream has been closed already */
+		if(repinfo->tcp_gen != repinfo->c->repinfo.tcp_gen)
+			return;
+		/* close it after the callback for the current query */
+		if(repinfo->c->tcp_req_info->in_worker_handle) {
+			repinfo->c->tcp_req_info->is_drop = 1;
+			return;
+		}
+	}
 	reclaim_tcp_handler(repinfo->c);
 }
 
@@ -2274,11 +2978,16 @@ size_t comm_point_get_mem(struct comm_point* c)
 		}
 #endif
 	}
+	if(c->tcp_req_info)
+		s += sizeof(*c->tcp_req_info) + c->tcp_req_info->done_req_mem;
 	if(c->type == comm_tcp_accept) {
 		int i;
 		for(i=0; i<c->max_tcp_count; i++)
 			s += comm_point_get_mem(c->tcp_handlers[i]);
 	}
+#ifdef USE_UDP_BATCH
+	s += udp_batch_get_mem(c->udp_batch);
+#endif
 	return s;
 }
 
@@ -2437,3 +3146,19 @@ comm_signal_delete(struct comm_signal* comsig)
 	}
 	free(comsig);
 }
+
+/* test code, here to avoid linking problems with fptr_wlist */
+int
+test_comm_point_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* repinfo)
+{
+	struct comm_point_testcb* t = (struct comm_point_testcb*)arg;
+	return (*t->point_cb)(c, t->arg, error, repinfo);
+}
+
+void
+test_comm_timer_cb(void* arg)
+{
+	struct comm_point_testcb* t = (struct comm_point_testcb*)arg;
+	(*t->timer_cb)(t->arg);
+}
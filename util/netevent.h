@@ -66,6 +66,8 @@ struct sldns_buffer;
 struct comm_point;
 struct comm_reply;
 struct ub_event_base;
+struct udp_batch;
+struct tcp_req_info;
 
 /* internal event notification data storage structure. */
 struct internal_event;
@@ -84,6 +86,9 @@ typedef int comm_point_callback_type(struct comm_point*, void*, int,
 #define NETEVENT_TIMEOUT -2 
 /** to pass fallback from capsforID to callback function; 0x20 failed */
 #define NETEVENT_CAPSFAIL -3
+/** to pass that a tcp write completed to the callback, when the comm point
+ * has tcp_notify_written set; the comm point now listens for the reply */
+#define NETEVENT_PKT_WRITTEN -4
 
 /** timeout to slow accept calls when not possible, in msec. */
 #define NETEVENT_SLOW_ACCEPT_TIME 2000
@@ -138,6 +143,10 @@ struct comm_reply {
 		pktinfo;
 	/** max udp size for udp packets */
 	size_t max_udp_size;
+	/** for pipelined TCP streams, the generation of the stream the
+	 * query arrived on; answers for an older generation, the stream has
+	 * been closed since, are discarded */
+	unsigned int tcp_gen;
 };
 
 /** 
@@ -242,6 +251,11 @@ struct comm_point {
 	/** if set, checks for pending error from nonblocking connect() call.*/
 	int tcp_check_nb_connect;
 
+	/** if set, the callback is called with NETEVENT_PKT_WRITTEN when
+	 * the buffer has been written, so that more can be written on the
+	 * stream before the reply is read. */
+	int tcp_notify_written;
+
 #ifdef USE_MSG_FASTOPEN
 	/** used to track if the sendto() call should be done when using TFO. */
 	int tcp_do_fastopen;
@@ -257,6 +271,26 @@ struct comm_point {
 	 * outside network for udp ports */
 	int inuse;
 
+	/* -------- UDP batch ------- */
+	/** batched receive and send state, with recvmmsg and sendmmsg,
+	 * NULL if datagrams are handled one per system call. */
+	struct udp_batch* udp_batch;
+	/** number of recvmmsg calls that returned datagrams */
+	size_t udp_batch_count;
+	/** number of datagrams received by those recvmmsg calls */
+	size_t udp_batch_pkts;
+
+	/* -------- TCP pipeline ------- */
+	/** for TCP handlers, pipelined queries and queued answers on the
+	 * stream, NULL if queries are read and answered one at a time. */
+	struct tcp_req_info* tcp_req_info;
+	/** for TCP accept, max number of queries outstanding on one
+	 * pipelined stream */
+	int tcp_pipeline_max;
+	/** for TCP accept, max number of queries outstanding on all the
+	 * pipelined streams of the comm_base */
+	int tcp_pipeline_total;
+
 	/** callback when done.
 	    tcp_accept does not get called back, is NULL then.
 	    If a timeout happens, callback with timeout=1 is called.
@@ -286,6 +320,50 @@ struct comm_point {
 	void *cb_arg;
 };
 
+/**
+ * Answer waiting to be written on a pipelined TCP stream.
+ */
+struct tcp_req_done_item {
+	/** next in list */
+	struct tcp_req_done_item* next;
+	/** the answer, without the length bytes, allocated after the item */
+	uint8_t* buf;
+	/** length of the answer */
+	size_t len;
+};
+
+/**
+ * Pipelined queries on an incoming TCP stream.  Queries are read while
+ * earlier queries on the stream are still resolving, and the answers are
+ * written in the order the mesh completes them.  The stream buffer is
+ * used to read a query and to write an answer, one at a time.
+ */
+struct tcp_req_info {
+	/** the TCP handler */
+	struct comm_point* cp;
+	/** buffer, shared per thread, that the mesh encodes answers for this
+	 * stream into; the stream buffer may hold a partly read query. */
+	struct sldns_buffer* spool_buffer;
+	/** the callback for a query read on this stream is running */
+	int in_worker_handle;
+	/** the stream is dropped once the callback returns */
+	int is_drop;
+	/** the client has stopped sending, queued answers are still
+	 * written before the stream is closed */
+	int read_is_closed;
+	/** number of queries that have been passed to the callback and
+	 * have not been answered yet */
+	int num_open_req;
+	/** answers waiting to be written, the first to write at the head */
+	struct tcp_req_done_item* done_req_list;
+	/** last item of the done list */
+	struct tcp_req_done_item* done_req_last;
+	/** number of answers in the done list */
+	int num_done_req;
+	/** bytes allocated for the done list */
+	size_t done_req_mem;
+};
+
 /**
  * Structure only for making timeout events.
  */
@@ -417,6 +495,20 @@ struct comm_point* comm_point_create_udp_ancil(struct comm_base* base,
 	int fd, struct sldns_buffer* buffer, 
 	comm_point_callback_type* callback, void* callback_arg);
 
+/**
+ * Set an UDP comm point to handle datagrams in batches.  Up to num
+ * datagrams are read per recvmmsg call, and the immediate replies to
+ * them are sent with one sendmmsg call.  Other replies, those sent
+ * later with comm_point_send_reply, are sent one at a time.
+ * @param c: the UDP comm point, created with comm_point_create_udp or
+ *	comm_point_create_udp_ancil.
+ * @param num: max number of datagrams in a batch.  If 1 or less, batches
+ *	are not used.
+ * @return false on alloc failure.  If the system does not have recvmmsg
+ *	and sendmmsg, true is returned and datagrams are not batched.
+ */
+int comm_point_set_udp_batch(struct comm_point* c, int num);
+
 /**
  * Create a TCP listener comm point. Calls malloc.
  * Setups the structure with the parameters you provide.
@@ -438,6 +530,22 @@ struct comm_point* comm_point_create_tcp(struct comm_base* base,
 	int fd, int num, size_t bufsize, 
 	comm_point_callback_type* callback, void* callback_arg);
 
+/**
+ * Turn on query pipelining for the TCP handlers of a TCP listener.  More
+ * queries are read from a stream while the earlier ones are resolving,
+ * and answers are written out of order as they complete.
+ * @param c: the TCP listener commpoint.
+ * @param spoolbuf: buffer to encode answers for the streams into, it is
+ *	shared with other commpoints of the thread and is not freed.
+ * @param num: max number of queries outstanding on one stream.  0 or 1
+ *	reads and answers the queries on a stream one at a time.
+ * @param total: max number of queries outstanding on all pipelined
+ *	streams of the comm_base.  A stream can always have one query.
+ * @return false on alloc failure.
+ */
+int comm_point_set_tcp_pipeline(struct comm_point* c,
+	struct sldns_buffer* spoolbuf, int num, int total);
+
 /**
  * Create an outgoing TCP commpoint. No file descriptor is opened, left at -1.
  * @param base: in which base to alloc the commpoint.
@@ -511,6 +619,24 @@ void comm_point_drop_reply(struct comm_reply* repinfo);
 int comm_point_send_udp_msg(struct comm_point* c, struct sldns_buffer* packet,
 	struct sockaddr* addr, socklen_t addrlen);
 
+/** max number of udp messages sent with one comm_point_send_udp_msgs */
+#define UDP_SEND_MAX 16
+
+/**
+ * Send udp messages to the same address over a commpoint.  Uses a
+ * sendmmsg call per UDP_SEND_MAX of them, where that is available.
+ * @param c: commpoint to send them from.
+ * @param packets: array with what to send, num elements.
+ * @param num: number of packets.
+ * @param addr: where to send them to.
+ * @param addrlen: length of addr.
+ * @return: number of packets, from the start of the array, that were sent.
+ *	If less than num, the next one failed.
+ */
+int comm_point_send_udp_msgs(struct comm_point* c,
+	struct sldns_buffer** packets, int num, struct sockaddr* addr,
+	socklen_t addrlen);
+
 /**
  * Stop listening for input on the commpoint. No callbacks will happen.
  * @param c: commpoint to disable. The fd is not closed.
@@ -728,4 +854,20 @@ void comm_point_tcp_win_bio_cb(struct comm_point* c, void* ssl);
 /** see if errno for tcp connect has to be logged or not. This uses errno */
 int tcp_connect_errno_needs_log(struct sockaddr* addr, socklen_t addrlen);
 
+/** test structure for comm point and timer callbacks in unit tests */
+struct comm_point_testcb {
+	/** called by test_comm_point_cb */
+	comm_point_callback_type* point_cb;
+	/** called by test_comm_timer_cb */
+	void (*timer_cb)(void*);
+	/** argument for them */
+	void* arg;
+};
+
+/** test comm point callback, calls point_cb of the comm_point_testcb arg */
+int test_comm_point_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* repinfo);
+/** test timer callback, calls timer_cb of the comm_point_testcb arg */
+void test_comm_timer_cb(void* arg);
+
 #endif /* NET_EVENT_H */
@@ -81,12 +81,14 @@ lruhash_create(size_t start_size, size_t maxmem,
 	table->num = 0;
 	table->space_used = 0;
 	table->space_max = maxmem;
+	table->clock = 0;
 	table->array = calloc(table->size, sizeof(struct lruhash_bin));
 	if(!table->array) {
 		lock_quick_destroy(&table->lock);
 		free(table);
 		return NULL;
 	}
+	lock_rw_init(&table->array_lock);
 	bin_init(table->array, table->size);
 	lock_protect(&table->lock, table, sizeof(*table));
 	lock_protect(&table->lock, table->array, 
@@ -157,6 +159,7 @@ lruhash_delete(struct lruhash* table)
 		return;
 	/* delete lock on hashtable to force check its OK */
 	lock_quick_destroy(&table->lock);
+	lock_rw_destroy(&table->array_lock);
 	for(i=0; i<table->size; i++)
 		bin_delete(table, &table->array[i]);
 	free(table->array);
@@ -183,6 +186,7 @@ reclaim_space(struct lruhash* table, struct lruhash_entry** list)
 {
 	struct lruhash_entry* d;
 	struct lruhash_bin* bin;
+	size_t chances = 0;
 	log_assert(table);
 	/* does not delete MRU entry, so table will not be empty. */
 	while(table->num > 1 && table->space_used > table->space_max) {
@@ -193,6 +197,15 @@ reclaim_space(struct lruhash* table, struct lruhash_entry** list)
 		   which is unlikely, since it is LRU, if someone got a rdlock
 		   it would be moved to front, but to be sure. */
 		d = table->lru_end;
+		if(table->clock && d->lru_ref && chances < table->num) {
+			/* used since it was put at the front, give it a
+			 * second chance. After a round of num entries, all
+			 * have been cleared, and the end is deleted. */
+			d->lru_ref = 0;
+			lru_touch(table, d);
+			chances++;
+			continue;
+		}
 		/* specialised, delete from end of double linked list,
 		   and we know num>1, so there is a previous lru entry. */
 		log_assert(d && d->lru_prev);
@@ -246,6 +259,8 @@ table_grow(struct lruhash* table)
 	}
 	bin_init(newa, table->size*2);
 	newmask = (table->size_mask << 1) | 1;
+	/* keep lookups that do not hold the table lock out of the array */
+	lock_rw_wrlock(&table->array_lock);
 	bin_split(table, newa, newmask);
 	/* delete the old bins */
 	lock_unprotect(&table->lock, table->array);
@@ -259,6 +274,7 @@ table_grow(struct lruhash* table)
 	table->array = newa;
 	lock_protect(&table->lock, table->array, 
 		table->size*sizeof(struct lruhash_bin));
+	lock_rw_unlock(&table->array_lock);
 	return;
 }
 
@@ -321,6 +337,7 @@ lruhash_insert(struct lruhash* table, hashvalue_type hash,
 		/* if not: add to bin */
 		entry->overflow_next = bin->overflow_list;
 		bin->overflow_list = entry;
+		entry->lru_ref = 1;
 		lru_front(table, entry);
 		table->num++;
 		table->space_used += need_size;
@@ -359,6 +376,24 @@ lruhash_lookup(struct lruhash* table, hashvalue_type hash, void* key, int wr)
 	struct lruhash_bin* bin;
 	fptr_ok(fptr_whitelist_hash_compfunc(table->compfunc));
 
+	if(table->clock) {
+		/* no hashtable lock, the array lock protects the array
+		 * from table_grow, the reference bit replaces the touch */
+		lock_rw_rdlock(&table->array_lock);
+		bin = &table->array[hash & table->size_mask];
+		lock_quick_lock(&bin->lock);
+		/* the bin lock keeps bin_split, and thus the array free,
+		 * waiting, the array lock is not needed anymore */
+		lock_rw_unlock(&table->array_lock);
+		if((entry=bin_find_entry(table, bin, hash, key))) {
+			entry->lru_ref = 1;
+			if(wr)	{ lock_rw_wrlock(&entry->lock); }
+			else	{ lock_rw_rdlock(&entry->lock); }
+		}
+		lock_quick_unlock(&bin->lock);
+		return entry;
+	}
+
 	lock_quick_lock(&table->lock);
 	bin = &table->array[hash & table->size_mask];
 	lock_quick_lock(&bin->lock);
@@ -520,6 +555,14 @@ lruhash_setmarkdel(struct lruhash* table, lruhash_markdelfunc_type md)
 	lock_quick_unlock(&table->lock);
 }
 
+void
+lruhash_setclock(struct lruhash* table, int clock)
+{
+	lock_quick_lock(&table->lock);
+	table->clock = clock;
+	lock_quick_unlock(&table->lock);
+}
+
 void 
 lruhash_traverse(struct lruhash* h, int wr, 
 	void (*func)(struct lruhash_entry*, void*), void* arg)
@@ -557,6 +600,7 @@ lru_demote(struct lruhash* table, struct lruhash_entry* entry)
 		return; /* nothing to do */
 	/* remove from current lru position */
 	lru_remove(table, entry);
+	entry->lru_ref = 0;
 	/* add at end */
 	entry->lru_next = NULL;
 	entry->lru_prev = table->lru_end;
@@ -602,6 +646,7 @@ lruhash_insert_or_retrieve(struct lruhash* table, hashvalue_type hash,
 		/* if not: add to bin */
 		entry->overflow_next = bin->overflow_list;
 		bin->overflow_list = entry;
+		entry->lru_ref = 1;
 		lru_front(table, entry);
 		table->num++;
 		table->space_used += need_size;
@@ -102,6 +102,24 @@
  *	  doing the next lookup/insert/delete/whatever.
  *	o To acquire multiple items you should use a special routine that
  *	  obtains the locks on those multiple items in one go.
+ *
+ * With CLOCK eviction (lruhash_setclock), the read does not lock the
+ * hashtable, so that lookups by different threads do not wait for
+ * each other on it:
+ *	o readlock the array lock (it is only writelocked by table grow).
+ *		o lookup hash bin.
+ *		o lock hash bin.
+ *			o find entry (if failed, unlock bin, unl array, exit).
+ *			o set the reference bit of the entry.
+ *		o lock entry (rwlock).
+ *		o unlock hash bin.
+ *	o unlock array lock.
+ * The LRU list is then only changed by insert and delete, with the
+ * hashtable lock.  When space is reclaimed, an entry at the end of the
+ * list with the reference bit set gets a second chance, the bit is
+ * cleared and the entry is moved to the front.  The reference bit is set
+ * without the hashtable lock, if that races with the clear, the entry
+ * only loses its second chance.
  */
 
 #ifndef UTIL_STORAGE_LRUHASH_H
@@ -178,6 +196,13 @@ struct lruhash {
 	size_t space_used;
 	/** the amount of space the hash table is maximally allowed to use. */
 	size_t space_max;
+
+	/** if true, CLOCK eviction is used; lookups do not lock the
+	 * hashtable but set the reference bit on the entry. */
+	int clock;
+	/** lock for the lookup array, readlocked by lookups in CLOCK mode
+	 * that do not hold the hashtable lock, writelocked by table_grow */
+	lock_rw_type array_lock;
 };
 
 /**
@@ -216,6 +241,9 @@ struct lruhash_entry {
 	struct lruhash_entry* lru_prev;
 	/** hash value of the key. It may not change, until entry deleted. */
 	hashvalue_type hash;
+	/** reference bit for CLOCK eviction, set when the entry is used, 
+	 * cleared when it gets a second chance. Set without hashlock. */
+	uint8_t lru_ref;
 	/** key */
 	void* key;
 	/** data */
@@ -301,6 +329,17 @@ void lru_touch(struct lruhash* table, struct lruhash_entry* entry);
  */
 void lruhash_setmarkdel(struct lruhash* table, lruhash_markdelfunc_type md);
 
+/**
+ * Set the eviction policy. By default it is LRU, and every lookup moves
+ * the entry to the front of the LRU list, under the hashtable lock.
+ * With CLOCK eviction, lookups only set a reference bit on the entry, and
+ * do not need the hashtable lock, this lowers lock contention between
+ * threads.  Can be changed when the table is in use.
+ * @param table: hash table.
+ * @param clock: if true CLOCK (second chance) eviction, otherwise LRU.
+ */
+void lruhash_setclock(struct lruhash* table, int clock);
+
 /************************* getdns functions ************************/
 /*** these are used by getdns only and not by unbound. ***/
 
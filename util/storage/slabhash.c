@@ -210,6 +210,14 @@ void slabhash_setmarkdel(struct slabhash* sl, lruhash_markdelfunc_type md)
 	}
 }
 
+void slabhash_setclock(struct slabhash* sl, int clock)
+{
+	size_t i;
+	for(i=0; i<sl->size; i++) {
+		lruhash_setclock(sl->array[i], clock);
+	}
+}
+
 void slabhash_traverse(struct slabhash* sh, int wr,
 	void (*func)(struct lruhash_entry*, void*), void* arg)
 {
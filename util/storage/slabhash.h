@@ -174,6 +174,13 @@ struct lruhash* slabhash_gettable(struct slabhash* table, hashvalue_type hash);
  */
 void slabhash_setmarkdel(struct slabhash* table, lruhash_markdelfunc_type md);
 
+/**
+ * Set the eviction policy of the tables, see lruhash_setclock.
+ * @param table: slabbed hash table.
+ * @param clock: if true CLOCK eviction, otherwise LRU.
+ */
+void slabhash_setclock(struct slabhash* table, int clock);
+
 /**
  * Traverse a slabhash.
  * @param table: slabbed hash table.
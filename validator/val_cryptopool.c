@@ -0,0 +1,400 @@
+/*
+ * validator/val_cryptopool.c - threads that verify signatures for the workers.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the crypto pool, threads that verify signatures
+ * for the validator.
+ */
+#include "config.h"
+#include <sys/time.h>
+#include "validator/val_cryptopool.h"
+#include "validator/validator.h"
+#include "validator/val_kentry.h"
+#include "validator/val_sigcrypt.h"
+#include "services/cache/rrset.h"
+#include "util/module.h"
+#include "util/regional.h"
+#include "util/tube.h"
+#include "util/log.h"
+#include "sldns/sbuffer.h"
+
+/** the histogram bucket for a value, log2 */
+static int
+crypto_hist_bucket(size_t v)
+{
+	int b = 0;
+	while(v > 1 && b < CRYPTO_HIST_BUCKETS-1) {
+		v >>= 1;
+		b++;
+	}
+	return b;
+}
+
+/** usec elapsed since start */
+static size_t
+crypto_elapsed(struct timeval* start)
+{
+	struct timeval now;
+	long long d;
+	if(gettimeofday(&now, NULL) < 0)
+		return 0;
+	d = ((long long)now.tv_sec - (long long)start->tv_sec)*1000000 +
+		((long long)now.tv_usec - (long long)start->tv_usec);
+	if(d < 0)
+		return 0;
+	return (size_t)d;
+}
+
+/** put a job on the finished list of its worker, and wake it up */
+static void
+crypto_pool_done(struct crypto_pool* pool, struct crypto_job* job)
+{
+	struct crypto_done* done = &pool->done[job->thread];
+	int send = 0;
+	job->next = NULL;
+	lock_basic_lock(&done->lock);
+	if(done->last)
+		done->last->next = job;
+	else	done->first = job;
+	done->last = job;
+	if(!done->wake_pending) {
+		done->wake_pending = 1;
+		send = 1;
+	}
+	lock_basic_unlock(&done->lock);
+	if(send) {
+		uint32_t c = 0;
+		if(!tube_write_msg(done->wake, (uint8_t*)&c, sizeof(c), 0))
+			log_err("could not wake up thread %d", job->thread);
+	}
+}
+
+/** verify the rrset of a job */
+static void
+crypto_job_run(struct crypto_pool* pool, struct crypto_job* job,
+	struct regional* region, sldns_buffer* buf)
+{
+	struct module_env env;
+	char* reason = NULL;
+	size_t usec;
+	memset(&env, 0, sizeof(env));
+	env.scratch = region;
+	env.scratch_buffer = buf;
+	env.now = &job->now;
+	job->sec = dnskeyset_verify_rrset(&env, job->ve, job->rrset,
+		job->dnskey, job->sigalg, &reason);
+	job->num_sig_cache_hit = env.num_sig_cache_hit;
+	job->num_sig_cache_miss = env.num_sig_cache_miss;
+	regional_free_all(region);
+	usec = crypto_elapsed(&job->start);
+	lock_basic_lock(&pool->stat_lock);
+	pool->num_jobs++;
+	pool->hist_verify[crypto_hist_bucket(usec)]++;
+	lock_basic_unlock(&pool->stat_lock);
+}
+
+/** the pool thread, verifies the jobs from the queue */
+static void*
+crypto_thread_main(void* arg)
+{
+	struct crypto_thread* t = (struct crypto_thread*)arg;
+	struct crypto_pool* pool = t->pool;
+	struct regional* region;
+	sldns_buffer* buf;
+	ub_thread_blocksigs();
+	log_thread_set(&t->num);
+	region = regional_create();
+	buf = sldns_buffer_new(65535);
+	if(!region || !buf)
+		fatal_exit("crypto thread: out of memory");
+	for(;;) {
+		struct crypto_job* job;
+		uint8_t* msg = NULL;
+		uint32_t len = 0;
+		int r;
+		lock_basic_lock(&pool->read_lock);
+		r = tube_read_msg(pool->jobs, &msg, &len, 0);
+		lock_basic_unlock(&pool->read_lock);
+		if(r <= 0) {
+			log_err("crypto thread: could not read job");
+			break;
+		}
+		if(len != sizeof(job)) {
+			free(msg);
+			continue;
+		}
+		memmove(&job, msg, sizeof(job));
+		free(msg);
+		if(!job)
+			break;
+		lock_basic_lock(&pool->stat_lock);
+		pool->queued--;
+		lock_basic_unlock(&pool->stat_lock);
+		crypto_job_run(pool, job, region, buf);
+		crypto_pool_done(pool, job);
+	}
+	regional_destroy(region);
+	sldns_buffer_free(buf);
+	return NULL;
+}
+
+struct crypto_pool*
+crypto_pool_create(int num_threads, int num_workers, struct tube** wake)
+{
+	struct crypto_pool* pool = (struct crypto_pool*)calloc(1,
+		sizeof(*pool));
+	int i;
+	if(!pool)
+		return NULL;
+	pool->num_workers = num_workers;
+	pool->threads = (struct crypto_thread*)calloc((size_t)num_threads,
+		sizeof(*pool->threads));
+	pool->done = (struct crypto_done*)calloc((size_t)num_workers,
+		sizeof(*pool->done));
+	if(!pool->threads || !pool->done || !(pool->jobs = tube_create())) {
+		free(pool->threads);
+		free(pool->done);
+		free(pool);
+		return NULL;
+	}
+	lock_basic_init(&pool->read_lock);
+	lock_basic_init(&pool->write_lock);
+	lock_basic_init(&pool->stat_lock);
+	lock_protect(&pool->stat_lock, &pool->queued, sizeof(pool->queued));
+	lock_protect(&pool->stat_lock, &pool->num_jobs,
+		sizeof(pool->num_jobs));
+	lock_protect(&pool->stat_lock, pool->hist_queue,
+		sizeof(pool->hist_queue));
+	lock_protect(&pool->stat_lock, pool->hist_verify,
+		sizeof(pool->hist_verify));
+	for(i=0; i<num_workers; i++) {
+		lock_basic_init(&pool->done[i].lock);
+		lock_protect(&pool->done[i].lock, &pool->done[i].first,
+			sizeof(pool->done[i].first));
+		lock_protect(&pool->done[i].lock, &pool->done[i].last,
+			sizeof(pool->done[i].last));
+		lock_protect(&pool->done[i].lock, &pool->done[i].wake_pending,
+			sizeof(pool->done[i].wake_pending));
+		pool->done[i].wake = wake[i];
+	}
+	for(i=0; i<num_threads; i++) {
+		pool->threads[i].pool = pool;
+		pool->threads[i].num = num_workers + i;
+		ub_thread_create(&pool->threads[i].thr, crypto_thread_main,
+			&pool->threads[i]);
+	}
+	pool->num_threads = num_threads;
+	return pool;
+}
+
+void
+crypto_pool_stop(struct crypto_pool* pool)
+{
+	struct crypto_job* stop = NULL;
+	int i;
+	if(!pool || !pool->num_threads)
+		return;
+	/* the stop messages are after the jobs in the queue */
+	lock_basic_lock(&pool->write_lock);
+	for(i=0; i<pool->num_threads; i++) {
+		if(!tube_write_msg(pool->jobs, (uint8_t*)&stop, sizeof(stop),
+			0))
+			fatal_exit("could not stop the crypto threads");
+	}
+	lock_basic_unlock(&pool->write_lock);
+	for(i=0; i<pool->num_threads; i++)
+		ub_thread_join(pool->threads[i].thr);
+	pool->num_threads = 0;
+}
+
+void
+crypto_pool_delete(struct crypto_pool* pool)
+{
+	int i;
+	if(!pool)
+		return;
+	crypto_pool_stop(pool);
+	for(i=0; i<pool->num_workers; i++) {
+		struct crypto_job* job = pool->done[i].first, *nx;
+		for(; job; job = nx) {
+			nx = job->next;
+			crypto_job_delete(job);
+		}
+		lock_basic_destroy(&pool->done[i].lock);
+	}
+	lock_basic_destroy(&pool->read_lock);
+	lock_basic_destroy(&pool->write_lock);
+	lock_basic_destroy(&pool->stat_lock);
+	tube_delete(pool->jobs);
+	free(pool->threads);
+	free(pool->done);
+	free(pool);
+}
+
+struct crypto_job*
+crypto_job_create(struct module_qstate* qstate, int id, struct val_env* ve,
+	struct ub_packed_rrset_key* rrset, struct key_entry_key* kkey,
+	int thread)
+{
+	struct key_entry_data* kd = (struct key_entry_data*)kkey->entry.data;
+	struct ub_packed_rrset_key dnskey;
+	struct crypto_job* job = (struct crypto_job*)calloc(1, sizeof(*job));
+	if(!job)
+		return NULL;
+	if(!(job->region = regional_create())) {
+		free(job);
+		return NULL;
+	}
+	job->qstate = qstate;
+	job->id = id;
+	job->thread = thread;
+	job->orig = rrset;
+	job->ve = ve;
+	job->now = *qstate->env->now;
+	job->sec = sec_status_unchecked;
+	/* the keys, like val_verify_rrset_entry */
+	memset(&dnskey, 0, sizeof(dnskey));
+	dnskey.rk.type = htons(kd->rrset_type);
+	dnskey.rk.rrset_class = htons(kkey->key_class);
+	dnskey.rk.dname = kkey->name;
+	dnskey.rk.dname_len = kkey->namelen;
+	dnskey.entry.key = &dnskey;
+	dnskey.entry.data = kd->rrset_data;
+	job->rrset = packed_rrset_copy_region(rrset, job->region, 0);
+	job->dnskey = packed_rrset_copy_region(&dnskey, job->region, 0);
+	if(kd->algo)
+		job->sigalg = (uint8_t*)regional_strdup(job->region,
+			(char*)kd->algo);
+	if(!job->rrset || !job->dnskey || (kd->algo && !job->sigalg)) {
+		crypto_job_delete(job);
+		return NULL;
+	}
+	return job;
+}
+
+void
+crypto_job_delete(struct crypto_job* job)
+{
+	if(!job)
+		return;
+	regional_destroy(job->region);
+	free(job);
+}
+
+int
+crypto_pool_submit(struct crypto_pool* pool, struct crypto_job* job)
+{
+	size_t q;
+	lock_basic_lock(&pool->stat_lock);
+	q = pool->queued;
+	if(q < CRYPTO_QUEUE_MAX) {
+		pool->queued++;
+		pool->hist_queue[crypto_hist_bucket(q)]++;
+	}
+	lock_basic_unlock(&pool->stat_lock);
+	if(q >= CRYPTO_QUEUE_MAX)
+		return 0;
+	if(gettimeofday(&job->start, NULL) < 0)
+		memset(&job->start, 0, sizeof(job->start));
+	lock_basic_lock(&pool->write_lock);
+	if(!tube_write_msg(pool->jobs, (uint8_t*)&job, sizeof(job), 0)) {
+		lock_basic_unlock(&pool->write_lock);
+		log_err("could not queue crypto job");
+		lock_basic_lock(&pool->stat_lock);
+		pool->queued--;
+		lock_basic_unlock(&pool->stat_lock);
+		return 0;
+	}
+	lock_basic_unlock(&pool->write_lock);
+	return 1;
+}
+
+struct crypto_job*
+crypto_pool_take(struct crypto_pool* pool, int thread)
+{
+	struct crypto_done* done = &pool->done[thread];
+	struct crypto_job* list;
+	lock_basic_lock(&done->lock);
+	list = done->first;
+	done->first = NULL;
+	done->last = NULL;
+	done->wake_pending = 0;
+	lock_basic_unlock(&done->lock);
+	return list;
+}
+
+struct module_qstate*
+crypto_job_finish(struct crypto_job* job)
+{
+	struct module_qstate* qstate = job->qstate;
+	struct val_qstate* vq;
+	struct crypto_job** p;
+	if(!qstate) {
+		/* the query was deleted */
+		crypto_job_delete(job);
+		return NULL;
+	}
+	qstate->env->num_sig_cache_hit += job->num_sig_cache_hit;
+	qstate->env->num_sig_cache_miss += job->num_sig_cache_miss;
+	vq = (struct val_qstate*)qstate->minfo[job->id];
+	for(p = &vq->crypto_jobs; *p; p = &(*p)->qnext) {
+		if(*p == job) {
+			*p = job->qnext;
+			break;
+		}
+	}
+	/* only secure is stored, the validator verifies the others
+	 * again, for the reason of failure */
+	if(job->sec == sec_status_secure) {
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			job->orig->entry.data;
+		struct packed_rrset_data* cd = (struct packed_rrset_data*)
+			job->rrset->entry.data;
+		if(d->security != sec_status_secure) {
+			d->security = sec_status_secure;
+			d->trust = rrset_trust_validated;
+			if(cd->ttl < d->ttl)
+				d->ttl = cd->ttl;
+			rrset_update_sec_status(qstate->env->rrset_cache,
+				job->orig, *qstate->env->now);
+		}
+	}
+	crypto_job_delete(job);
+	if(vq->crypto_jobs)
+		return NULL;
+	return qstate;
+}
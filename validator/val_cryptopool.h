@@ -0,0 +1,235 @@
+/*
+ * validator/val_cryptopool.h - threads that verify signatures for the workers.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the crypto pool, with crypto-threads.  The validator
+ * sends the rrsets of a message that need signature verification to the
+ * pool threads, one job per rrset, so they verify in parallel and the
+ * worker thread continues with other queries.  When the jobs are done the
+ * worker is woken up, and the query continues where it left off.
+ */
+
+#ifndef VALIDATOR_VAL_CRYPTOPOOL_H
+#define VALIDATOR_VAL_CRYPTOPOOL_H
+#include "util/locks.h"
+#include "util/data/packed_rrset.h"
+struct tube;
+struct val_env;
+struct module_qstate;
+struct key_entry_key;
+struct regional;
+
+/** number of buckets in the crypto pool histograms, powers of two */
+#define CRYPTO_HIST_BUCKETS 16
+/** jobs that can wait in the queue, after this the worker verifies */
+#define CRYPTO_QUEUE_MAX 1024
+
+/**
+ * A signature verification job, for one rrset.
+ */
+struct crypto_job {
+	/** next in the list of finished jobs of a worker */
+	struct crypto_job* next;
+	/** next in the list of jobs of the query */
+	struct crypto_job* qnext;
+	/** the query, NULL if it was deleted while the job ran.
+	 * only used by the worker thread. */
+	struct module_qstate* qstate;
+	/** module id of the validator */
+	int id;
+	/** the worker thread that waits for the job */
+	int thread;
+	/** the rrset in the message of the query, only used by the worker */
+	struct ub_packed_rrset_key* orig;
+	/** region with the copies of the rrset and keys */
+	struct regional* region;
+	/** copy of the rrset, that is verified */
+	struct ub_packed_rrset_key* rrset;
+	/** copy of the DNSKEY rrset */
+	struct ub_packed_rrset_key* dnskey;
+	/** signalled algorithms, or NULL */
+	uint8_t* sigalg;
+	/** validator environment, with the settings */
+	struct val_env* ve;
+	/** time of the verification */
+	time_t now;
+	/** time the job was put in the queue */
+	struct timeval start;
+	/** result of the verification */
+	enum sec_status sec;
+	/** signature cache hits of the verification, these are counted
+	 * for the worker thread when it finishes the job */
+	size_t num_sig_cache_hit;
+	/** signature cache misses of the verification */
+	size_t num_sig_cache_miss;
+};
+
+/**
+ * The jobs that are finished for a worker thread.
+ */
+struct crypto_done {
+	/** lock on the list and the wake_pending flag */
+	lock_basic_type lock;
+	/** finished jobs */
+	struct crypto_job* first;
+	/** last of the finished jobs */
+	struct crypto_job* last;
+	/** true if a wakeup was sent and not handled yet */
+	int wake_pending;
+	/** the tube that wakes up the worker.  Because a wakeup is only
+	 * sent if none is pending, there is one writer at a time. */
+	struct tube* wake;
+};
+
+/**
+ * A thread of the crypto pool.
+ */
+struct crypto_thread {
+	/** the pool */
+	struct crypto_pool* pool;
+	/** thread number, for logging, after the worker threads */
+	int num;
+	/** the thread */
+	ub_thread_type thr;
+};
+
+/**
+ * The crypto pool.
+ */
+struct crypto_pool {
+	/** number of threads, 0 if they are stopped */
+	int num_threads;
+	/** the threads */
+	struct crypto_thread* threads;
+	/** queue of jobs, messages with the job pointer, a NULL job
+	 * stops a thread */
+	struct tube* jobs;
+	/** lock for the pool threads, one reads from the queue at a time */
+	lock_basic_type read_lock;
+	/** lock for the workers, one writes to the queue at a time */
+	lock_basic_type write_lock;
+	/** number of worker threads */
+	int num_workers;
+	/** per worker, the finished jobs */
+	struct crypto_done* done;
+	/** lock on the counters */
+	lock_basic_type stat_lock;
+	/** number of jobs in the queue */
+	size_t queued;
+	/** number of jobs done */
+	size_t num_jobs;
+	/** histogram of the queue length when a job is put in the queue,
+	 * bucket i is from 2**i up to 2**(i+1), bucket 0 includes 0. */
+	size_t hist_queue[CRYPTO_HIST_BUCKETS];
+	/** histogram of the time from queue until verified, in usec,
+	 * bucket i is from 2**i up to 2**(i+1), bucket 0 includes 0. */
+	size_t hist_verify[CRYPTO_HIST_BUCKETS];
+};
+
+/**
+ * Create the crypto pool and start the threads.
+ * @param num_threads: number of threads that verify signatures.
+ * @param num_workers: number of worker threads.
+ * @param wake: array of the wakeup tubes of the workers, it is copied.
+ * @return new pool or NULL on failure.
+ */
+struct crypto_pool* crypto_pool_create(int num_threads, int num_workers,
+	struct tube** wake);
+
+/**
+ * Stop the threads of the pool.  The jobs in the queue are finished
+ * first.  The workers must not submit jobs anymore.
+ * @param pool: the pool, can be NULL.
+ */
+void crypto_pool_stop(struct crypto_pool* pool);
+
+/**
+ * Delete the crypto pool and the finished jobs that were not taken.
+ * The threads must have been stopped, and the queries of the workers
+ * deleted.
+ * @param pool: to delete, can be NULL.
+ */
+void crypto_pool_delete(struct crypto_pool* pool);
+
+/**
+ * Create a job to verify an rrset, it copies the rrset and the keys.
+ * @param qstate: the query that waits for the job.
+ * @param id: module id.
+ * @param ve: validator environment.
+ * @param rrset: the rrset to verify.
+ * @param kkey: the key entry with the keys.
+ * @param thread: worker thread number.
+ * @return new job or NULL on malloc failure.
+ */
+struct crypto_job* crypto_job_create(struct module_qstate* qstate, int id,
+	struct val_env* ve, struct ub_packed_rrset_key* rrset,
+	struct key_entry_key* kkey, int thread);
+
+/**
+ * Delete a job.
+ * @param job: to delete.
+ */
+void crypto_job_delete(struct crypto_job* job);
+
+/**
+ * Put a job in the queue of the pool, for the threads.
+ * @param pool: the pool.
+ * @param job: the job.
+ * @return false if the queue is full, or on failure.  The caller has to
+ * 	delete the job and verify itself.
+ */
+int crypto_pool_submit(struct crypto_pool* pool, struct crypto_job* job);
+
+/**
+ * Take the finished jobs of a worker.  Called when the worker is woken up,
+ * it can be woken up again after this.
+ * @param pool: the pool.
+ * @param thread: worker thread number.
+ * @return list of jobs, linked with next.
+ */
+struct crypto_job* crypto_pool_take(struct crypto_pool* pool, int thread);
+
+/**
+ * Handle a finished job in the worker thread.  The rrset is marked
+ * secure if it verified, the signature cache counters are added to the
+ * worker, and the job is removed from the query and deleted.
+ * @param job: the finished job.
+ * @return the query to resume if this was its last job, or NULL.
+ */
+struct module_qstate* crypto_job_finish(struct crypto_job* job);
+
+#endif /* VALIDATOR_VAL_CRYPTOPOOL_H */
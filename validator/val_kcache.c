@@ -67,6 +67,7 @@ key_cache_create(struct config_file* cfg)
 		free(kcache);
 		return NULL;
 	}
+	slabhash_setclock(kcache->slab, cfg->cache_clock_eviction);
 	return kcache;
 }
 
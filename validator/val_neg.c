@@ -51,16 +51,19 @@
 #include "validator/val_neg.h"
 #include "validator/val_nsec.h"
 #include "validator/val_nsec3.h"
+#include "validator/val_nsec3cache.h"
 #include "validator/val_utils.h"
 #include "util/data/dname.h"
 #include "util/data/msgreply.h"
 #include "util/log.h"
 #include "util/net_help.h"
 #include "util/config_file.h"
+#include "util/module.h"
 #include "services/cache/rrset.h"
 #include "services/cache/dns.h"
 #include "sldns/rrdef.h"
 #include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
 
 int val_neg_data_compare(const void* a, const void* b)
 {
@@ -85,6 +88,7 @@ int val_neg_zone_compare(const void* a, const void* b)
 
 struct val_neg_cache* val_neg_create(struct config_file* cfg, size_t maxiter)
 {
+	size_t i, max = 1024*1024; /* 1 M is thousands of entries */
 	struct val_neg_cache* neg = (struct val_neg_cache*)calloc(1, 
 		sizeof(*neg));
 	if(!neg) {
@@ -92,23 +96,72 @@ struct val_neg_cache* val_neg_create(struct config_file* cfg, size_t maxiter)
 		return NULL;
 	}
 	neg->nsec3_max_iter = maxiter;
-	neg->max = 1024*1024; /* 1 M is thousands of entries */
-	if(cfg) neg->max = cfg->neg_cache_size;
-	rbtree_init(&neg->tree, &val_neg_zone_compare);
-	lock_basic_init(&neg->lock);
-	lock_protect(&neg->lock, neg, sizeof(*neg));
+	neg->num_stripes = 1;
+	if(cfg) {
+		max = cfg->neg_cache_size;
+		neg->num_stripes = cfg->neg_cache_slabs;
+		neg->aggressive = cfg->aggressive_nsec;
+	}
+	log_assert(neg->num_stripes > 0 &&
+		(neg->num_stripes & (neg->num_stripes-1)) == 0);
+	neg->mask = neg->num_stripes-1;
+	neg->stripes = (struct val_neg_stripe*)calloc(neg->num_stripes,
+		sizeof(struct val_neg_stripe));
+	if(!neg->stripes) {
+		log_err("Could not create neg cache: out of memory");
+		free(neg);
+		return NULL;
+	}
+	for(i=0; i<neg->num_stripes; i++) {
+		struct val_neg_stripe* stripe = &neg->stripes[i];
+		stripe->nsec3_max_iter = maxiter;
+		stripe->max = max / neg->num_stripes;
+		rbtree_init(&stripe->tree, &val_neg_zone_compare);
+		lock_basic_init(&stripe->lock);
+		lock_protect(&stripe->lock, stripe, sizeof(*stripe));
+	}
 	return neg;
 }
 
 size_t val_neg_get_mem(struct val_neg_cache* neg)
 {
-	size_t result;
-	lock_basic_lock(&neg->lock);
-	result = sizeof(*neg) + neg->use;
-	lock_basic_unlock(&neg->lock);
+	size_t i, result = sizeof(*neg) +
+		neg->num_stripes*sizeof(struct val_neg_stripe);
+	for(i=0; i<neg->num_stripes; i++) {
+		lock_basic_lock(&neg->stripes[i].lock);
+		result += neg->stripes[i].use;
+		lock_basic_unlock(&neg->stripes[i].lock);
+	}
 	return result;
 }
 
+void val_neg_get_stats(struct val_neg_cache* neg, size_t* nxdomain,
+	size_t* nodata, int reset)
+{
+	size_t i;
+	*nxdomain = 0;
+	*nodata = 0;
+	for(i=0; i<neg->num_stripes; i++) {
+		struct val_neg_stripe* stripe = &neg->stripes[i];
+		lock_basic_lock(&stripe->lock);
+		*nxdomain += stripe->num_nxdomain;
+		*nodata += stripe->num_nodata;
+		if(reset) {
+			stripe->num_nxdomain = 0;
+			stripe->num_nodata = 0;
+		}
+		lock_basic_unlock(&stripe->lock);
+	}
+}
+
+struct val_neg_stripe* neg_zone_stripe(struct val_neg_cache* neg,
+	uint8_t* nm, uint16_t dclass)
+{
+	/* the hash is case insensitive, like the zone tree compare */
+	hashvalue_type h = dname_query_hash(nm, 0xab + (hashvalue_type)dclass);
+	return &neg->stripes[h & neg->mask];
+}
+
 /** clear datas on cache deletion */
 static void
 neg_clear_datas(rbnode_type* n, void* ATTR_UNUSED(arg))
@@ -132,69 +185,75 @@ neg_clear_zones(rbnode_type* n, void* ATTR_UNUSED(arg))
 
 void neg_cache_delete(struct val_neg_cache* neg)
 {
+	size_t i;
 	if(!neg) return;
-	lock_basic_destroy(&neg->lock);
-	/* delete all the zones in the tree */
-	traverse_postorder(&neg->tree, &neg_clear_zones, NULL);
+	for(i=0; i<neg->num_stripes; i++) {
+		lock_basic_destroy(&neg->stripes[i].lock);
+		/* delete all the zones in the tree */
+		traverse_postorder(&neg->stripes[i].tree, &neg_clear_zones,
+			NULL);
+	}
+	free(neg->stripes);
 	free(neg);
 }
 
 /**
  * Put data element at the front of the LRU list.
- * @param neg: negative cache with LRU start and end.
+ * @param stripe: negative cache stripe with LRU start and end.
  * @param data: this data is fronted.
  */
-static void neg_lru_front(struct val_neg_cache* neg, 
+static void neg_lru_front(struct val_neg_stripe* stripe, 
 	struct val_neg_data* data)
 {
 	data->prev = NULL;
-	data->next = neg->first;
-	if(!neg->first)
-		neg->last = data;
-	else	neg->first->prev = data;
-	neg->first = data;
+	data->next = stripe->first;
+	if(!stripe->first)
+		stripe->last = data;
+	else	stripe->first->prev = data;
+	stripe->first = data;
 }
 
 /**
  * Remove data element from LRU list.
- * @param neg: negative cache with LRU start and end.
+ * @param stripe: negative cache stripe with LRU start and end.
  * @param data: this data is removed from the list.
  */
-static void neg_lru_remove(struct val_neg_cache* neg, 
+static void neg_lru_remove(struct val_neg_stripe* stripe, 
 	struct val_neg_data* data)
 {
 	if(data->prev)
 		data->prev->next = data->next;
-	else	neg->first = data->next;
+	else	stripe->first = data->next;
 	if(data->next)
 		data->next->prev = data->prev;
-	else	neg->last = data->prev;
+	else	stripe->last = data->prev;
 }
 
 /**
  * Touch LRU for data element, put it at the start of the LRU list.
- * @param neg: negative cache with LRU start and end.
+ * @param stripe: negative cache stripe with LRU start and end.
  * @param data: this data is used.
  */
-static void neg_lru_touch(struct val_neg_cache* neg, 
+static void neg_lru_touch(struct val_neg_stripe* stripe, 
 	struct val_neg_data* data)
 {
-	if(data == neg->first)
+	if(data == stripe->first)
 		return; /* nothing to do */
 	/* remove from current lru position */
-	neg_lru_remove(neg, data);
+	neg_lru_remove(stripe, data);
 	/* add at front */
-	neg_lru_front(neg, data);
+	neg_lru_front(stripe, data);
 }
 
 /**
  * Delete a zone element from the negative cache.
  * May delete other zone elements to keep tree coherent, or
  * only mark the element as 'not in use'.
- * @param neg: negative cache.
+ * @param stripe: negative cache stripe.
  * @param z: zone element to delete.
  */
-static void neg_delete_zone(struct val_neg_cache* neg, struct val_neg_zone* z)
+static void neg_delete_zone(struct val_neg_stripe* stripe,
+	struct val_neg_zone* z)
 {
 	struct val_neg_zone* p, *np;
 	if(!z) return;
@@ -214,8 +273,8 @@ static void neg_delete_zone(struct val_neg_cache* neg, struct val_neg_zone* z)
 	p = z;
 	while(p && p->count == 0) {
 		np = p->parent;
-		(void)rbtree_delete(&neg->tree, &p->node);
-		neg->use -= p->len + sizeof(*p);
+		(void)rbtree_delete(&stripe->tree, &p->node);
+		stripe->use -= p->len + sizeof(*p);
 		free(p->nsec3_salt);
 		free(p->name);
 		free(p);
@@ -223,7 +282,7 @@ static void neg_delete_zone(struct val_neg_cache* neg, struct val_neg_zone* z)
 	}
 }
 	
-void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
+void neg_delete_data(struct val_neg_stripe* stripe, struct val_neg_data* el)
 {
 	struct val_neg_zone* z;
 	struct val_neg_data* p, *np;
@@ -234,7 +293,7 @@ void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
 	el->in_use = 0;
 
 	/* remove it from the lru list */
-	neg_lru_remove(neg, el);
+	neg_lru_remove(stripe, el);
 	
 	/* go up the tree and reduce counts */
 	p = el;
@@ -249,7 +308,7 @@ void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
 	while(p && p->count == 0) {
 		np = p->parent;
 		(void)rbtree_delete(&z->tree, &p->node);
-		neg->use -= p->len + sizeof(*p);
+		stripe->use -= p->len + sizeof(*p);
 		free(p->name);
 		free(p);
 		p = np;
@@ -257,7 +316,7 @@ void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
 
 	/* check if the zone is now unused */
 	if(z->tree.count == 0) {
-		neg_delete_zone(neg, z);
+		neg_delete_zone(stripe, z);
 	}
 }
 
@@ -265,18 +324,18 @@ void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
  * Create more space in negative cache
  * The oldest elements are deleted until enough space is present.
  * Empty zones are deleted.
- * @param neg: negative cache.
+ * @param stripe: negative cache stripe.
  * @param need: how many bytes are needed.
  */
-static void neg_make_space(struct val_neg_cache* neg, size_t need)
+static void neg_make_space(struct val_neg_stripe* stripe, size_t need)
 {
 	/* delete elements until enough space or its empty */
-	while(neg->last && neg->max < neg->use + need) {
-		neg_delete_data(neg, neg->last);
+	while(stripe->last && stripe->max < stripe->use + need) {
+		neg_delete_data(stripe, stripe->last);
 	}
 }
 
-struct val_neg_zone* neg_find_zone(struct val_neg_cache* neg, 
+struct val_neg_zone* neg_find_zone(struct val_neg_stripe* stripe, 
 	uint8_t* nm, size_t len, uint16_t dclass)
 {
 	struct val_neg_zone lookfor;
@@ -288,7 +347,7 @@ struct val_neg_zone* neg_find_zone(struct val_neg_cache* neg,
 	lookfor.dclass = dclass;
 
 	result = (struct val_neg_zone*)
-		rbtree_search(&neg->tree, lookfor.node.key);
+		rbtree_search(&stripe->tree, lookfor.node.key);
 	return result;
 }
 
@@ -326,7 +385,8 @@ static size_t calc_data_need(struct reply_info* rep)
 	size_t i, len, res = 0;
 
 	for(i=rep->an_numrrsets; i<rep->an_numrrsets+rep->ns_numrrsets; i++) {
-		if(ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC) {
+		if(ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC ||
+			ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC3) {
 			d = rep->rrsets[i]->rk.dname;
 			len = rep->rrsets[i]->rk.dname_len;
 			res = sizeof(struct val_neg_data) + len;
@@ -359,15 +419,16 @@ static size_t calc_zone_need(uint8_t* d, size_t len)
 
 /**
  * Find closest existing parent zone of the given name.
- * @param neg: negative cache.
+ * @param stripe: negative cache stripe.
  * @param nm: name to look for
  * @param nm_len: length of nm
  * @param labs: labelcount of nm.
  * @param qclass: class.
  * @return the zone or NULL if none found.
  */
-static struct val_neg_zone* neg_closest_zone_parent(struct val_neg_cache* neg,
-	uint8_t* nm, size_t nm_len, int labs, uint16_t qclass)
+static struct val_neg_zone* neg_closest_zone_parent(
+	struct val_neg_stripe* stripe, uint8_t* nm, size_t nm_len, int labs,
+	uint16_t qclass)
 {
 	struct val_neg_zone key;
 	struct val_neg_zone* result;
@@ -377,7 +438,7 @@ static struct val_neg_zone* neg_closest_zone_parent(struct val_neg_cache* neg,
 	key.len = nm_len;
 	key.labs = labs;
 	key.dclass = qclass;
-	if(rbtree_find_less_equal(&neg->tree, &key, &res)) {
+	if(rbtree_find_less_equal(&stripe->tree, &key, &res)) {
 		/* exact match */
 		result = (struct val_neg_zone*)res;
 	} else {
@@ -526,7 +587,7 @@ void val_neg_zone_take_inuse(struct val_neg_zone* zone)
 	}
 }
 
-struct val_neg_zone* neg_create_zone(struct val_neg_cache* neg,
+struct val_neg_zone* neg_create_zone(struct val_neg_stripe* stripe,
 	uint8_t* nm, size_t nm_len, uint16_t dclass)
 {
 	struct val_neg_zone* zone;
@@ -535,7 +596,7 @@ struct val_neg_zone* neg_create_zone(struct val_neg_cache* neg,
 	int labs = dname_count_labels(nm);
 
 	/* find closest enclosing parent zone that (still) exists */
-	parent = neg_closest_zone_parent(neg, nm, nm_len, labs, dclass);
+	parent = neg_closest_zone_parent(stripe, nm, nm_len, labs, dclass);
 	if(parent && query_dname_compare(parent->name, nm) == 0)
 		return parent; /* already exists, weird */
 	/* if parent exists, it is in use */
@@ -550,9 +611,9 @@ struct val_neg_zone* neg_create_zone(struct val_neg_cache* neg,
 	while(p) {
 		np = p->parent;
 		/* mem use */
-		neg->use += sizeof(struct val_neg_zone) + p->len;
+		stripe->use += sizeof(struct val_neg_zone) + p->len;
 		/* insert in tree */
-		(void)rbtree_insert(&neg->tree, &p->node);
+		(void)rbtree_insert(&stripe->tree, &p->node);
 		/* last one needs proper parent pointer */
 		if(np == NULL)
 			p->parent = parent;
@@ -572,15 +633,18 @@ static struct ub_packed_rrset_key* reply_find_soa(struct reply_info* rep)
 	return NULL;
 }
 
-/** see if the reply has NSEC records worthy of caching */
-static int reply_has_nsec(struct reply_info* rep)
+/** see if the reply has NSEC records worthy of caching, and with nsec3
+ * true also NSEC3 records */
+static int reply_has_nsec(struct reply_info* rep, int nsec3)
 {
 	size_t i;
 	struct packed_rrset_data* d;
 	if(rep->security != sec_status_secure)
 		return 0;
 	for(i=rep->an_numrrsets; i< rep->an_numrrsets+rep->ns_numrrsets; i++){
-		if(ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC) {
+		if(ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC ||
+			(nsec3 && ntohs(rep->rrsets[i]->rk.type) ==
+			LDNS_RR_TYPE_NSEC3)) {
 			d = (struct packed_rrset_data*)rep->rrsets[i]->
 				entry.data;
 			if(d->security == sec_status_secure)
@@ -664,12 +728,12 @@ static struct val_neg_data* neg_data_chain(
 /**
  * Remove NSEC records between start and end points.
  * By walking the tree, the tree is sorted canonically.
- * @param neg: negative cache.
+ * @param stripe: negative cache stripe.
  * @param zone: the zone
  * @param el: element to start walking at.
  * @param nsec: the nsec record with the end point
  */
-static void wipeout(struct val_neg_cache* neg, struct val_neg_zone* zone, 
+static void wipeout(struct val_neg_stripe* stripe, struct val_neg_zone* zone,
 	struct val_neg_data* el, struct ub_packed_rrset_key* nsec)
 {
 	struct packed_rrset_data* d = (struct packed_rrset_data*)nsec->
@@ -739,12 +803,12 @@ static void wipeout(struct val_neg_cache* neg, struct val_neg_zone* zone,
 		 * it cannot get deleted, the zone cannot get empty.
 		 * If the next==NULL, then zone can be empty. */
 		if(cur->in_use)
-			neg_delete_data(neg, cur);
+			neg_delete_data(stripe, cur);
 		walk = next;
 	}
 }
 
-void neg_insert_data(struct val_neg_cache* neg, 
+void neg_insert_data(struct val_neg_stripe* stripe, 
 	struct val_neg_zone* zone, struct ub_packed_rrset_key* nsec)
 {
 	struct packed_rrset_data* d;
@@ -787,7 +851,7 @@ void neg_insert_data(struct val_neg_cache* neg,
 		while(p) {
 			np = p->parent;
 			/* mem use */
-			neg->use += sizeof(struct val_neg_data) + p->len;
+			stripe->use += sizeof(struct val_neg_data) + p->len;
 			/* insert in tree */
 			p->zone = zone;
 			(void)rbtree_insert(&zone->tree, &p->node);
@@ -807,10 +871,10 @@ void neg_insert_data(struct val_neg_cache* neg,
 			p->count++;
 		}
 
-		neg_lru_front(neg, el);
+		neg_lru_front(stripe, el);
 	} else {
 		/* in use, bring to front, lru */
-		neg_lru_touch(neg, el);
+		neg_lru_touch(stripe, el);
 	}
 
 	/* if nsec3 store last used parameters */
@@ -819,7 +883,7 @@ void neg_insert_data(struct val_neg_cache* neg,
 		uint8_t* s;
 		size_t slen, it;
 		if(nsec3_get_params(nsec, 0, &h, &it, &s, &slen) &&
-			it <= neg->nsec3_max_iter &&
+			it <= stripe->nsec3_max_iter &&
 			(h != zone->nsec3_hash || it != zone->nsec3_iter ||
 			slen != zone->nsec3_saltlen || 
 			memcmp(zone->nsec3_salt, s, slen) != 0)) {
@@ -844,7 +908,7 @@ void neg_insert_data(struct val_neg_cache* neg,
 	}
 
 	/* wipe out the cache items between NSEC start and end */
-	wipeout(neg, zone, el, nsec);
+	wipeout(stripe, zone, el, nsec);
 }
 
 void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
@@ -852,8 +916,10 @@ void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 	size_t i, need;
 	struct ub_packed_rrset_key* soa;
 	struct val_neg_zone* zone;
-	/* see if secure nsecs inside */
-	if(!reply_has_nsec(rep))
+	struct val_neg_stripe* stripe;
+	/* see if secure nsecs inside, the NSEC3s are only needed for
+	 * synthesized answers */
+	if(!reply_has_nsec(rep, neg->aggressive))
 		return;
 	/* find the zone name in message */
 	soa = reply_find_soa(rep);
@@ -866,16 +932,18 @@ void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 	/* ask for enough space to store all of it */
 	need = calc_data_need(rep) + 
 		calc_zone_need(soa->rk.dname, soa->rk.dname_len);
-	lock_basic_lock(&neg->lock);
-	neg_make_space(neg, need);
+	stripe = neg_zone_stripe(neg, soa->rk.dname, 
+		ntohs(soa->rk.rrset_class));
+	lock_basic_lock(&stripe->lock);
+	neg_make_space(stripe, need);
 
 	/* find or create the zone entry */
-	zone = neg_find_zone(neg, soa->rk.dname, soa->rk.dname_len,
+	zone = neg_find_zone(stripe, soa->rk.dname, soa->rk.dname_len,
 		ntohs(soa->rk.rrset_class));
 	if(!zone) {
-		if(!(zone = neg_create_zone(neg, soa->rk.dname, 
+		if(!(zone = neg_create_zone(stripe, soa->rk.dname, 
 			soa->rk.dname_len, ntohs(soa->rk.rrset_class)))) {
-			lock_basic_unlock(&neg->lock);
+			lock_basic_unlock(&stripe->lock);
 			log_err("out of memory adding negative zone");
 			return;
 		}
@@ -884,18 +952,20 @@ void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 
 	/* insert the NSECs */
 	for(i=rep->an_numrrsets; i< rep->an_numrrsets+rep->ns_numrrsets; i++){
-		if(ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC)
+		if(ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC &&
+			!(neg->aggressive && ntohs(rep->rrsets[i]->rk.type)
+			== LDNS_RR_TYPE_NSEC3))
 			continue;
 		if(!dname_subdomain_c(rep->rrsets[i]->rk.dname, 
 			zone->name)) continue;
 		/* insert NSEC into this zone's tree */
-		neg_insert_data(neg, zone, rep->rrsets[i]);
+		neg_insert_data(stripe, zone, rep->rrsets[i]);
 	}
 	if(zone->tree.count == 0) {
 		/* remove empty zone if inserts failed */
-		neg_delete_zone(neg, zone);
+		neg_delete_zone(stripe, zone);
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_basic_unlock(&stripe->lock);
 }
 
 /**
@@ -927,11 +997,44 @@ static int neg_closest_data(struct val_neg_zone* zone,
 	}
 }
 
+/**
+ * Find the closest enclosing zone that is in use, for a name.
+ * Zones are stored in the stripe of their own name, so the name is
+ * walked up, label by label, looking in the stripe for that name.
+ * @param neg: negative cache.
+ * @param nm: name to look for.
+ * @param nm_len: length of nm.
+ * @param qclass: class.
+ * @param topname: if not NULL, do not look higher than this name.
+ * @param stripe: returns the stripe of the zone, locked.
+ * @return the zone, with its stripe locked, or NULL if none found, and
+ *	then nothing is locked.
+ */
+static struct val_neg_zone* neg_closest_zone(struct val_neg_cache* neg,
+	uint8_t* nm, size_t nm_len, uint16_t qclass, uint8_t* topname,
+	struct val_neg_stripe** stripe)
+{
+	struct val_neg_zone* zone;
+	while(!topname || dname_subdomain_c(nm, topname)) {
+		*stripe = neg_zone_stripe(neg, nm, qclass);
+		lock_basic_lock(&(*stripe)->lock);
+		zone = neg_find_zone(*stripe, nm, nm_len, qclass);
+		if(zone && zone->in_use)
+			return zone;
+		lock_basic_unlock(&(*stripe)->lock);
+		if(dname_is_root(nm))
+			break;
+		dname_remove_label(&nm, &nm_len);
+	}
+	return NULL;
+}
+
 int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
         uint16_t qclass, struct rrset_cache* rrset_cache, time_t now)
 {
 	/* lookup closest zone */
 	struct val_neg_zone* zone;
+	struct val_neg_stripe* stripe;
 	struct val_neg_data* data;
 	int labs;
 	struct ub_packed_rrset_key* nsec;
@@ -945,20 +1048,15 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 		LDNS_RR_TYPE_DLV, qclass);
 	
 	labs = dname_count_labels(qname);
-	lock_basic_lock(&neg->lock);
-	zone = neg_closest_zone_parent(neg, qname, len, labs, qclass);
-	while(zone && !zone->in_use)
-		zone = zone->parent;
-	if(!zone) {
-		lock_basic_unlock(&neg->lock);
+	zone = neg_closest_zone(neg, qname, len, qclass, NULL, &stripe);
+	if(!zone)
 		return 0;
-	}
 	log_nametypeclass(VERB_ALGO, "negcache zone", zone->name, 0, 
 		zone->dclass);
 
 	/* DLV is defined to use NSEC only */
 	if(zone->nsec3_hash) {
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&stripe->lock);
 		return 0;
 	}
 
@@ -967,7 +1065,7 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 	while(data && !data->in_use)
 		data = data->parent;
 	if(!data) {
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&stripe->lock);
 		return 0;
 	}
 	log_nametypeclass(VERB_ALGO, "negcache rr", data->name, 
@@ -982,21 +1080,21 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 
 	/* check if secure and TTL ok */
 	if(!nsec) {
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&stripe->lock);
 		return 0;
 	}
 	d = (struct packed_rrset_data*)nsec->entry.data;
 	if(!d || now > d->ttl) {
 		lock_rw_unlock(&nsec->entry.lock);
 		/* delete data record if expired */
-		neg_delete_data(neg, data);
-		lock_basic_unlock(&neg->lock);
+		neg_delete_data(stripe, data);
+		lock_basic_unlock(&stripe->lock);
 		return 0;
 	}
 	if(d->security != sec_status_secure) {
 		lock_rw_unlock(&nsec->entry.lock);
-		neg_delete_data(neg, data);
-		lock_basic_unlock(&neg->lock);
+		neg_delete_data(stripe, data);
+		lock_basic_unlock(&stripe->lock);
 		return 0;
 	}
 	verbose(VERB_ALGO, "negcache got secure rrset");
@@ -1012,7 +1110,7 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 		!val_nsec_proves_name_error(nsec, qname)) {
 		/* the NSEC is not a denial for the DLV */
 		lock_rw_unlock(&nsec->entry.lock);
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&stripe->lock);
 		verbose(VERB_ALGO, "negcache not proven");
 		return 0;
 	}
@@ -1023,8 +1121,8 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 
 	lock_rw_unlock(&nsec->entry.lock);
 	/* if OK touch the LRU for neg_data element */
-	neg_lru_touch(neg, data);
-	lock_basic_unlock(&neg->lock);
+	neg_lru_touch(stripe, data);
+	lock_basic_unlock(&stripe->lock);
 	verbose(VERB_ALGO, "negcache DLV denial proven");
 	return 1;
 }
@@ -1064,6 +1162,7 @@ void val_neg_addreferral(struct val_neg_cache* neg, struct reply_info* rep,
 	size_t signer_len;
 	uint16_t dclass;
 	struct val_neg_zone* zone;
+	struct val_neg_stripe* stripe;
 	/* no SOA in this message, find RRSIG over NSEC's signer name.
 	 * note the NSEC records are maybe not validated yet */
 	signer = reply_nsec_signer(rep, &signer_len, &dclass);
@@ -1079,15 +1178,16 @@ void val_neg_addreferral(struct val_neg_cache* neg, struct reply_info* rep,
 	
 	/* ask for enough space to store all of it */
 	need = calc_data_need(rep) + calc_zone_need(signer, signer_len);
-	lock_basic_lock(&neg->lock);
-	neg_make_space(neg, need);
+	stripe = neg_zone_stripe(neg, signer, dclass);
+	lock_basic_lock(&stripe->lock);
+	neg_make_space(stripe, need);
 
 	/* find or create the zone entry */
-	zone = neg_find_zone(neg, signer, signer_len, dclass);
+	zone = neg_find_zone(stripe, signer, signer_len, dclass);
 	if(!zone) {
-		if(!(zone = neg_create_zone(neg, signer, signer_len, 
+		if(!(zone = neg_create_zone(stripe, signer, signer_len, 
 			dclass))) {
-			lock_basic_unlock(&neg->lock);
+			lock_basic_unlock(&stripe->lock);
 			log_err("out of memory adding negative zone");
 			return;
 		}
@@ -1102,13 +1202,13 @@ void val_neg_addreferral(struct val_neg_cache* neg, struct reply_info* rep,
 		if(!dname_subdomain_c(rep->rrsets[i]->rk.dname, 
 			zone->name)) continue;
 		/* insert NSEC into this zone's tree */
-		neg_insert_data(neg, zone, rep->rrsets[i]);
+		neg_insert_data(stripe, zone, rep->rrsets[i]);
 	}
 	if(zone->tree.count == 0) {
 		/* remove empty zone if inserts failed */
-		neg_delete_zone(neg, zone);
+		neg_delete_zone(stripe, zone);
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_basic_unlock(&stripe->lock);
 }
 
 /**
@@ -1183,10 +1283,39 @@ grab_nsec(struct rrset_cache* rrset_cache, uint8_t* qname, size_t qname_len,
 	return r;
 }
 
-/** find nsec3 closest encloser in neg cache */
+/** hash a name with the nsec3 parameters of the zone, or get it from the
+ * nsec3 hash cache, the cache hits and misses are counted in the env */
+static size_t
+neg_nsec3_hash(struct val_neg_cache* neg, struct val_neg_zone* zone,
+	struct module_env* env, uint8_t* nm, size_t nmlen, uint8_t* res,
+	size_t max)
+{
+	size_t len;
+	if(neg->nsec3cache && (len=nsec3_hash_cache_lookup(neg->nsec3cache,
+		zone->name, zone->len, zone->nsec3_hash, zone->nsec3_iter,
+		zone->nsec3_salt, zone->nsec3_saltlen, nm, nmlen, res,
+		max)) != 0) {
+		env->num_nsec3_cache_hit++;
+		return len;
+	}
+	if(neg->nsec3cache)
+		env->num_nsec3_cache_miss++;
+	len = nsec3_get_hashed(env->scratch_buffer, nm, nmlen,
+		zone->nsec3_hash, zone->nsec3_iter, zone->nsec3_salt,
+		zone->nsec3_saltlen, res, max);
+	if(neg->nsec3cache && len != 0)
+		nsec3_hash_cache_insert(neg->nsec3cache, zone->name,
+			zone->len, zone->nsec3_hash, zone->nsec3_iter,
+			zone->nsec3_salt, zone->nsec3_saltlen, nm, nmlen,
+			res, len);
+	return len;
+}
+
+/** find nsec3 closest encloser in neg cache, its name is returned in ce */
 static struct val_neg_data*
-neg_find_nsec3_ce(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
-		int qlabs, sldns_buffer* buf, uint8_t* hashnc, size_t* nclen)
+neg_find_nsec3_ce(struct val_neg_cache* neg, struct val_neg_zone* zone,
+	uint8_t* qname, size_t qname_len, int qlabs, struct module_env* env,
+	uint8_t* hashnc, size_t* nclen, uint8_t** ce, size_t* ce_len)
 {
 	struct val_neg_data* data;
 	uint8_t hashce[NSEC3_SHA_LEN];
@@ -1196,9 +1325,8 @@ neg_find_nsec3_ce(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
 	*nclen = 0;
 	while(qlabs > 0) {
 		/* hash */
-		if(!(celen=nsec3_get_hashed(buf, qname, qname_len, 
-			zone->nsec3_hash, zone->nsec3_iter, zone->nsec3_salt, 
-			zone->nsec3_saltlen, hashce, sizeof(hashce))))
+		if(!(celen=neg_nsec3_hash(neg, zone, env, qname, qname_len,
+			hashce, sizeof(hashce))))
 			return NULL;
 		if(!(b32len=nsec3_hash_to_b32(hashce, celen, zone->name,
 			zone->len, b32, sizeof(b32))))
@@ -1208,6 +1336,8 @@ neg_find_nsec3_ce(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
 		data = neg_find_data(zone, b32, b32len, zone->labs+1);
 		if(data && data->in_use) {
 			/* found ce match! */
+			*ce = qname;
+			*ce_len = qname_len;
 			return data;
 		}
 
@@ -1268,10 +1398,13 @@ neg_nsec3_getnc(struct val_neg_zone* zone, uint8_t* hashnc, size_t nclen,
 
 /** neg cache nsec3 proof procedure*/
 static struct dns_msg*
-neg_nsec3_proof_ds(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
-		int qlabs, sldns_buffer* buf, struct rrset_cache* rrset_cache,
-		struct regional* region, time_t now, uint8_t* topname)
+neg_nsec3_proof_ds(struct val_neg_cache* neg, struct val_neg_zone* zone,
+	uint8_t* qname, size_t qname_len, int qlabs, struct module_env* env,
+	struct regional* region, uint8_t* topname)
 {
+	struct rrset_cache* rrset_cache = env->rrset_cache;
+	sldns_buffer* buf = env->scratch_buffer;
+	time_t now = *env->now;
 	struct dns_msg* msg;
 	struct val_neg_data* data;
 	uint8_t hashnc[NSEC3_SHA_LEN];
@@ -1279,6 +1412,8 @@ neg_nsec3_proof_ds(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
 	struct ub_packed_rrset_key* ce_rrset, *nc_rrset;
 	struct nsec3_cached_hash c;
 	uint8_t nc_b32[257];
+	uint8_t* ce;
+	size_t ce_len;
 
 	/* for NSEC3 ; determine the closest encloser for which we
 	 * can find an exact match. Remember the hashed lower name,
@@ -1291,8 +1426,8 @@ neg_nsec3_proof_ds(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
 	if(!zone->nsec3_hash) 
 		return NULL; /* not nsec3 zone */
 
-	if(!(data=neg_find_nsec3_ce(zone, qname, qname_len, qlabs, buf,
-		hashnc, &nclen))) {
+	if(!(data=neg_find_nsec3_ce(neg, zone, qname, qname_len, qlabs, env,
+		hashnc, &nclen, &ce, &ce_len))) {
 		return NULL;
 	}
 
@@ -1397,21 +1532,324 @@ static int add_soa(struct rrset_cache* rrset_cache, time_t now,
 	return 1;
 }
 
+/**
+ * Make the wildcard name at the closest encloser.
+ * @param ce: closest encloser name.
+ * @param ce_len: length of ce.
+ * @param wc: buffer for the result, LDNS_MAX_DOMAINLEN+1 long.
+ * @return length of wildcard name, or 0 if too long.
+ */
+static size_t neg_wildcard_name(uint8_t* ce, size_t ce_len, uint8_t* wc)
+{
+	if(ce_len > LDNS_MAX_DOMAINLEN-2)
+		return 0;
+	wc[0] = 1;
+	wc[1] = (uint8_t)'*';
+	memmove(wc+2, ce, ce_len);
+	return ce_len+2;
+}
+
+/**
+ * Grab the in use NSEC record that is closest before the name, from the
+ * NSEC tree of the zone.
+ * @param zone: the zone, an NSEC zone.
+ * @param nm: the name.
+ * @param nm_len: length of nm.
+ * @param rrset_cache: rrset cache.
+ * @param region: where to allocate the result.
+ * @param now: to check TTLs against.
+ * @param data: returns the data element of the NSEC record.
+ * @return rrset, allocated in region, or NULL if not found.
+ */
+static struct ub_packed_rrset_key*
+neg_grab_closest_nsec(struct val_neg_zone* zone, uint8_t* nm, size_t nm_len,
+	struct rrset_cache* rrset_cache, struct regional* region, time_t now,
+	struct val_neg_data** data)
+{
+	uint32_t flags = 0;
+	(void)neg_closest_data(zone, nm, nm_len, dname_count_labels(nm), data);
+	while(*data && !(*data)->in_use)
+		*data = (*data)->parent;
+	if(!*data)
+		return NULL;
+	if(query_dname_compare((*data)->name, zone->name) == 0)
+		flags = PACKED_RRSET_NSEC_AT_APEX;
+	return grab_nsec(rrset_cache, (*data)->name, (*data)->len,
+		LDNS_RR_TYPE_NSEC, zone->dclass, flags, region, 0, 0, now);
+}
+
+/**
+ * Synthesize an NXDOMAIN or NODATA answer from the NSEC records of a zone.
+ * Answers that would need a wildcard expansion are not made.
+ * @param stripe: the locked stripe of the zone.
+ * @param zone: the NSEC zone.
+ * @param qinfo: query.
+ * @param rrset_cache: rrset cache.
+ * @param region: where to allocate reply.
+ * @param now: to check TTLs against.
+ * @return message with the NSEC records, without SOA, or NULL.
+ */
+static struct dns_msg*
+neg_nsec_synth(struct val_neg_stripe* stripe, struct val_neg_zone* zone,
+	struct query_info* qinfo, struct rrset_cache* rrset_cache,
+	struct regional* region, time_t now)
+{
+	struct dns_msg* msg;
+	struct val_neg_data* data, *wcdata;
+	struct ub_packed_rrset_key* nsec, *wcnsec = NULL;
+	uint8_t* wc = NULL, *ce;
+	size_t ce_len, wc_len;
+	uint8_t wcname[LDNS_MAX_DOMAINLEN+1];
+
+	nsec = neg_grab_closest_nsec(zone, qinfo->qname, qinfo->qname_len,
+		rrset_cache, region, now, &data);
+	if(!nsec)
+		return NULL;
+
+	if(nsec_proves_nodata(nsec, qinfo, &wc)) {
+		/* the name exists, or is an empty nonterminal, without
+		 * the type; a wildcard nodata is not made */
+		if(wc)
+			return NULL;
+		if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len,
+			qinfo->qtype, qinfo->qclass, region, 2)))
+			return NULL;
+		/* TTL reduced in grab_nsec */
+		if(!dns_msg_authadd(msg, region, nsec, 0))
+			return NULL;
+		neg_lru_touch(stripe, data);
+		return msg;
+	}
+	if(!val_nsec_proves_name_error(nsec, qinfo->qname))
+		return NULL;
+
+	/* the wildcard at the closest encloser must not exist, the same
+	 * check as the validator performs on the NSECs in the reply */
+	if(!val_nsec_proves_no_wc(nsec, qinfo->qname, qinfo->qname_len)) {
+		if(!(ce = nsec_closest_encloser(qinfo->qname, nsec)))
+			return NULL;
+		(void)dname_count_size_labels(ce, &ce_len);
+		if(!(wc_len = neg_wildcard_name(ce, ce_len, wcname)))
+			return NULL;
+		wcnsec = neg_grab_closest_nsec(zone, wcname, wc_len,
+			rrset_cache, region, now, &wcdata);
+		if(!wcnsec || !val_nsec_proves_no_wc(wcnsec, qinfo->qname,
+			qinfo->qname_len))
+			return NULL;
+		if(query_dname_compare(wcnsec->rk.dname, nsec->rk.dname) == 0)
+			wcnsec = NULL;
+	}
+
+	/* capacity=3: nsec + wildcard nsec + soa */
+	if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len,
+		qinfo->qtype, qinfo->qclass, region, 3)))
+		return NULL;
+	msg->rep->flags |= LDNS_RCODE_NXDOMAIN;
+	if(!dns_msg_authadd(msg, region, nsec, 0))
+		return NULL;
+	if(wcnsec && !dns_msg_authadd(msg, region, wcnsec, 0))
+		return NULL;
+	neg_lru_touch(stripe, data);
+	return msg;
+}
+
+/**
+ * Synthesize an NXDOMAIN or NODATA answer from the NSEC3 records of a zone.
+ * Opt-out spans and wildcard expansions are not used.
+ * @param neg: negative cache, with the nsec3 hash cache.
+ * @param stripe: the locked stripe of the zone.
+ * @param zone: the NSEC3 zone.
+ * @param qinfo: query.
+ * @param env: module env with rrset cache, scratch buffer and time.
+ * @param region: where to allocate reply.
+ * @return message with the NSEC3 records, without SOA, or NULL.
+ */
+static struct dns_msg*
+neg_nsec3_synth(struct val_neg_cache* neg, struct val_neg_stripe* stripe,
+	struct val_neg_zone* zone, struct query_info* qinfo,
+	struct module_env* env, struct regional* region)
+{
+	struct rrset_cache* rrset_cache = env->rrset_cache;
+	sldns_buffer* buf = env->scratch_buffer;
+	time_t now = *env->now;
+	struct dns_msg* msg;
+	struct val_neg_data* data;
+	uint8_t hashnc[NSEC3_SHA_LEN], hashwc[NSEC3_SHA_LEN];
+	size_t nclen, wclen, ce_len, wc_len;
+	uint8_t* ce;
+	struct ub_packed_rrset_key* ce_rrset, *nc_rrset, *wc_rrset;
+	struct nsec3_cached_hash c;
+	uint8_t nc_b32[257], wc_b32[257];
+	uint8_t wcname[LDNS_MAX_DOMAINLEN+1];
+
+	if(!(data=neg_find_nsec3_ce(neg, zone, qinfo->qname,
+		qinfo->qname_len, dname_count_labels(qinfo->qname) -
+		zone->labs + 1, env, hashnc, &nclen, &ce, &ce_len)))
+		return NULL;
+	ce_rrset = grab_nsec(rrset_cache, data->name, data->len,
+		LDNS_RR_TYPE_NSEC3, zone->dclass, 0, region, 0, 0, now);
+	if(!ce_rrset || !neg_params_ok(zone, ce_rrset))
+		return NULL;
+
+	if(nclen == 0) {
+		/* exact match, the name exists, check the type bits,
+		 * it must not be a CNAME or a delegation point */
+		if(!nsec3_no_type(ce_rrset, qinfo->qtype) ||
+			!nsec3_no_type(ce_rrset, LDNS_RR_TYPE_CNAME) ||
+			(nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_NS) &&
+			!nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_SOA)))
+			return NULL;
+		if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len,
+			qinfo->qtype, qinfo->qclass, region, 2)))
+			return NULL;
+		/* TTL reduced in grab_nsec */
+		if(!dns_msg_authadd(msg, region, ce_rrset, 0))
+			return NULL;
+		neg_lru_touch(stripe, data);
+		return msg;
+	}
+
+	/* the closest encloser must not be a delegation or DNAME,
+	 * otherwise the name could exist below it */
+	if(nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_DNAME) ||
+		(nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_NS) &&
+		!nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_SOA)))
+		return NULL;
+
+	/* the next closer name must be covered, not in an optout span */
+	nc_rrset = neg_nsec3_getnc(zone, hashnc, nclen, rrset_cache,
+		region, now, nc_b32, sizeof(nc_b32));
+	if(!nc_rrset || nsec3_has_optout(nc_rrset, 0))
+		return NULL;
+	c.hash = hashnc;
+	c.hash_len = nclen;
+	c.b32 = nc_b32+1;
+	c.b32_len = (size_t)nc_b32[0];
+	if(!nsec3_covers(zone->name, &c, nc_rrset, 0, buf))
+		return NULL;
+
+	/* the wildcard at the closest encloser must be covered */
+	if(!(wc_len = neg_wildcard_name(ce, ce_len, wcname)))
+		return NULL;
+	if(!(wclen=neg_nsec3_hash(neg, zone, env, wcname, wc_len, hashwc,
+		sizeof(hashwc))))
+		return NULL;
+	wc_rrset = neg_nsec3_getnc(zone, hashwc, wclen, rrset_cache,
+		region, now, wc_b32, sizeof(wc_b32));
+	if(!wc_rrset)
+		return NULL;
+	c.hash = hashwc;
+	c.hash_len = wclen;
+	c.b32 = wc_b32+1;
+	c.b32_len = (size_t)wc_b32[0];
+	if(!nsec3_covers(zone->name, &c, wc_rrset, 0, buf))
+		return NULL;
+
+	/* capacity=4: ce + nc + wc + soa */
+	if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len,
+		qinfo->qtype, qinfo->qclass, region, 4)))
+		return NULL;
+	msg->rep->flags |= LDNS_RCODE_NXDOMAIN;
+	if(!dns_msg_authadd(msg, region, ce_rrset, 0))
+		return NULL;
+	if(query_dname_compare(nc_rrset->rk.dname, ce_rrset->rk.dname) != 0
+		&& !dns_msg_authadd(msg, region, nc_rrset, 0))
+		return NULL;
+	if(query_dname_compare(wc_rrset->rk.dname, ce_rrset->rk.dname) != 0
+		&& query_dname_compare(wc_rrset->rk.dname,
+		nc_rrset->rk.dname) != 0
+		&& !dns_msg_authadd(msg, region, wc_rrset, 0))
+		return NULL;
+	neg_lru_touch(stripe, data);
+	return msg;
+}
+
+/** set the message TTL to the lowest TTL of its (relative TTL) rrsets */
+static void
+neg_msg_ttl(struct dns_msg* msg)
+{
+	size_t i;
+	struct packed_rrset_data* d;
+	for(i=0; i<msg->rep->rrset_count; i++) {
+		d = (struct packed_rrset_data*)msg->rep->rrsets[i]->entry.data;
+		if(i == 0 || d->ttl < msg->rep->ttl)
+			msg->rep->ttl = d->ttl;
+	}
+	msg->rep->prefetch_ttl = PREFETCH_TTL_CALC(msg->rep->ttl);
+}
+
+/**
+ * Synthesize an NXDOMAIN or NODATA answer for the query from the closest
+ * enclosing zone in the negative cache, with SOA record for the client.
+ * @param neg: negative cache.
+ * @param qinfo: query, not type DS.
+ * @param region: where to allocate reply.
+ * @param env: module env with rrset cache, scratch buffer and time.
+ * @param topname: do not use zones above this name, or NULL.
+ * @return message that needs validation, or NULL.
+ */
+static struct dns_msg*
+neg_synth_msg(struct val_neg_cache* neg, struct query_info* qinfo,
+	struct regional* region, struct module_env* env, uint8_t* topname)
+{
+	struct rrset_cache* rrset_cache = env->rrset_cache;
+	time_t now = *env->now;
+	struct dns_msg* msg;
+	struct val_neg_zone* zone;
+	struct val_neg_stripe* stripe;
+	int nxdomain = 0;
+
+	/* the type bitmap proves nothing for type ANY */
+	if(qinfo->qtype == LDNS_RR_TYPE_ANY ||
+		qinfo->qclass == LDNS_RR_CLASS_ANY)
+		return NULL;
+	zone = neg_closest_zone(neg, qinfo->qname, qinfo->qname_len,
+		qinfo->qclass, topname, &stripe);
+	if(!zone)
+		return NULL;
+	if(zone->nsec3_hash)
+		msg = neg_nsec3_synth(neg, stripe, zone, qinfo, env, region);
+	else	msg = neg_nsec_synth(stripe, zone, qinfo, rrset_cache,
+			region, now);
+	if(msg && !add_soa(rrset_cache, now, region, msg, zone))
+		msg = NULL;
+	if(msg) {
+		neg_msg_ttl(msg);
+		nxdomain = (FLAGS_GET_RCODE(msg->rep->flags) ==
+			LDNS_RCODE_NXDOMAIN);
+		if(nxdomain)
+			stripe->num_nxdomain++;
+		else	stripe->num_nodata++;
+	}
+	lock_basic_unlock(&stripe->lock);
+	if(msg)
+		log_nametypeclass(VERB_ALGO, nxdomain?"negcache synthesized "
+			"NXDOMAIN":"negcache synthesized NODATA", qinfo->qname,
+			qinfo->qtype, qinfo->qclass);
+	return msg;
+}
+
 struct dns_msg* 
 val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo, 
-	struct regional* region, struct rrset_cache* rrset_cache, 
-	sldns_buffer* buf, time_t now, int addsoa, uint8_t* topname)
+	struct regional* region, struct module_env* env, int addsoa,
+	uint8_t* topname)
 {
+	struct rrset_cache* rrset_cache = env->rrset_cache;
+	time_t now = *env->now;
 	struct dns_msg* msg;
 	struct ub_packed_rrset_key* rrset;
 	uint8_t* zname;
 	size_t zname_len;
 	int zname_labs;
 	struct val_neg_zone* zone;
+	struct val_neg_stripe* stripe;
 
-	/* only for DS queries */
-	if(qinfo->qtype != LDNS_RR_TYPE_DS)
-		return NULL;
+	/* other types only for external answers, aggressively synthesized */
+	if(qinfo->qtype != LDNS_RR_TYPE_DS) {
+		if(!neg->aggressive || !addsoa)
+			return NULL;
+		return neg_synth_msg(neg, qinfo, region, env, topname);
+	}
 	log_assert(!topname || dname_subdomain_c(qinfo->qname, topname));
 
 	/* see if info from neg cache is available 
@@ -1442,29 +1880,20 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 	dname_remove_label(&zname, &zname_len);
 	zname_labs = dname_count_labels(zname);
 
-	/* lookup closest zone */
-	lock_basic_lock(&neg->lock);
-	zone = neg_closest_zone_parent(neg, zname, zname_len, zname_labs, 
-		qinfo->qclass);
-	while(zone && !zone->in_use)
-		zone = zone->parent;
-	/* check that the zone is not too high up so that we do not pick data
-	 * out of a zone that is above the last-seen key (or trust-anchor). */
-	if(zone && topname) {
-		if(!dname_subdomain_c(zone->name, topname))
-			zone = NULL;
-	}
-	if(!zone) {
-		lock_basic_unlock(&neg->lock);
+	/* lookup closest zone, that is not too high up so that we do not
+	 * pick data out of a zone that is above the last-seen key (or
+	 * trust-anchor). */
+	zone = neg_closest_zone(neg, zname, zname_len, qinfo->qclass,
+		topname, &stripe);
+	if(!zone)
 		return NULL;
-	}
 
-	msg = neg_nsec3_proof_ds(zone, qinfo->qname, qinfo->qname_len, 
-		zname_labs+1, buf, rrset_cache, region, now, topname);
+	msg = neg_nsec3_proof_ds(neg, zone, qinfo->qname, qinfo->qname_len,
+		zname_labs+1, env, region, topname);
 	if(msg && addsoa && !add_soa(rrset_cache, now, region, msg, zone)) {
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&stripe->lock);
 		return NULL;
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_basic_unlock(&stripe->lock);
 	return msg;
 }
@@ -55,17 +55,17 @@ struct regional;
 struct query_info;
 struct dns_msg;
 struct ub_packed_rrset_key;
+struct nsec3_hash_cache;
+struct module_env;
 
 /**
- * The negative cache.  It is shared between the threads, so locked. 
- * Kept as validator-environ-state.  It refers back to the rrset cache for
- * data elements.  It can be out of date and contain conflicting data 
- * from zone content changes.  
- * It contains a tree of zones, every zone has a tree of data elements.
- * The data elements are part of one big LRU list, with one memory counter.
+ * One stripe of the negative cache.  It holds a part of the zones, picked
+ * by the hash of the zone name, with its own lock, LRU list and memory
+ * counter.  Every stripe has the tree structure of zones and their parent
+ * zones for the zones that hash to it.
  */
-struct val_neg_cache {
-	/** the big lock on the negative cache.  Because we use a rbtree 
+struct val_neg_stripe {
+	/** the lock on this stripe.  Because we use a rbtree 
 	 * for the data (quick lookup), we need a big lock */
 	lock_basic_type lock;
 	/** The zone rbtree. contents sorted canonical, type val_neg_zone */
@@ -80,6 +80,38 @@ struct val_neg_cache {
 	size_t max;
 	/** max nsec3 iterations allowed */
 	size_t nsec3_max_iter;
+	/** number of NXDOMAIN answers synthesized from this stripe */
+	size_t num_nxdomain;
+	/** number of NODATA answers synthesized from this stripe */
+	size_t num_nodata;
+};
+
+/**
+ * The negative cache.  It is shared between the threads, so locked. 
+ * Kept as validator-environ-state.  It refers back to the rrset cache for
+ * data elements.  It can be out of date and contain conflicting data 
+ * from zone content changes.  
+ * It contains a tree of zones, every zone has a tree of data elements.
+ * The zones are spread over a number of stripes by the hash of the zone
+ * name, so that lookups in different zones do not contend for one lock.
+ * The data elements in a stripe are part of one LRU list, with one
+ * memory counter for the stripe.
+ */
+struct val_neg_cache {
+	/** array of stripes, num_stripes long */
+	struct val_neg_stripe* stripes;
+	/** number of stripes, a power of 2 */
+	size_t num_stripes;
+	/** mask to select the stripe from the zone name hash */
+	size_t mask;
+	/** max nsec3 iterations allowed */
+	size_t nsec3_max_iter;
+	/** if true, synthesize NXDOMAIN and NODATA answers from the cached
+	 * NSEC and NSEC3 records for any query type (RFC 8198) */
+	int aggressive;
+	/** the nsec3 hash cache of the validator, used for the hashes of
+	 * the synthesized NSEC3 proofs, or NULL if none */
+	struct nsec3_hash_cache* nsec3cache;
 };
 
 /**
@@ -184,6 +216,16 @@ size_t val_neg_get_mem(struct val_neg_cache* neg);
  */
 void neg_cache_delete(struct val_neg_cache* neg);
 
+/**
+ * Get the number of answers synthesized from the negative cache.
+ * @param neg: negative cache.
+ * @param nxdomain: returns number of NXDOMAIN answers synthesized.
+ * @param nodata: returns number of NODATA answers synthesized.
+ * @param reset: if true, the counters are zeroed.
+ */
+void val_neg_get_stats(struct val_neg_cache* neg, size_t* nxdomain,
+	size_t* nodata, int reset);
+
 /** 
  * Comparison function for rbtree val neg data elements
  */
@@ -235,12 +277,16 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 /**
  * For the given query, try to get a reply out of the negative cache.
  * The reply still needs to be validated.
+ * For type DS, the DS denial is looked up.  If the cache is configured
+ * aggressive and addsoa is true, NXDOMAIN and NODATA answers are
+ * synthesized for other query types from the cached NSEC and NSEC3
+ * records of the closest enclosing zone (RFC 8198).
  * @param neg: negative cache.
  * @param qinfo: query
  * @param region: where to allocate reply.
- * @param rrset_cache: rrset cache.
- * @param buf: temporary buffer.
- * @param now: to check TTLs against.
+ * @param env: module env with the rrset cache, the scratch buffer and
+ *	the time to check TTLs against.  The nsec3 hash cache hits and
+ *	misses are counted in it.
  * @param addsoa: if true, produce result for external consumption.
  *	if false, do not add SOA - for unbound-internal consumption.
  * @param topname: do not look higher than this name, 
@@ -256,19 +302,28 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
  */
 struct dns_msg* val_neg_getmsg(struct val_neg_cache* neg, 
 	struct query_info* qinfo, struct regional* region, 
-	struct rrset_cache* rrset_cache, struct sldns_buffer* buf, time_t now,
-	int addsoa, uint8_t* topname);
+	struct module_env* env, int addsoa, uint8_t* topname);
 
 
 /**** functions exposed for unit test ****/
+/**
+ * Get the stripe that holds the given zone.
+ * @param neg: negative cache
+ * @param nm: zone name.
+ * @param dclass: class of zone, host order.
+ * @return the stripe, the caller must lock it.
+ */
+struct val_neg_stripe* neg_zone_stripe(struct val_neg_cache* neg,
+	uint8_t* nm, uint16_t dclass);
+
 /**
  * Insert data into the data tree of a zone
  * Does not do locking.
- * @param neg: negative cache
+ * @param stripe: negative cache stripe that holds the zone.
  * @param zone: zone to insert into
  * @param nsec: record to insert.
  */
-void neg_insert_data(struct val_neg_cache* neg,
+void neg_insert_data(struct val_neg_stripe* stripe,
         struct val_neg_zone* zone, struct ub_packed_rrset_key* nsec);
 
 /**
@@ -276,33 +331,33 @@ void neg_insert_data(struct val_neg_cache* neg,
  * May delete other data elements to keep tree coherent, or
  * only mark the element as 'not in use'.
  * Does not do locking.
- * @param neg: negative cache.
+ * @param stripe: negative cache stripe that holds the element.
  * @param el: data element to delete.
  */
-void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el);
+void neg_delete_data(struct val_neg_stripe* stripe, struct val_neg_data* el);
 
 /**
  * Find the given zone, from the SOA owner name and class
  * Does not do locking.
- * @param neg: negative cache
+ * @param stripe: negative cache stripe, from neg_zone_stripe.
  * @param nm: what to look for.
  * @param len: length of nm
  * @param dclass: class to look for.
  * @return zone or NULL if not found.
  */
-struct val_neg_zone* neg_find_zone(struct val_neg_cache* neg,
+struct val_neg_zone* neg_find_zone(struct val_neg_stripe* stripe,
         uint8_t* nm, size_t len, uint16_t dclass);
 
 /**
  * Create a new zone.
  * Does not do locking.
- * @param neg: negative cache
+ * @param stripe: negative cache stripe, from neg_zone_stripe.
  * @param nm: what to look for.
  * @param nm_len: length of name.
  * @param dclass: class of zone, host order.
  * @return zone or NULL if out of memory.
  */
-struct val_neg_zone* neg_create_zone(struct val_neg_cache* neg,
+struct val_neg_zone* neg_create_zone(struct val_neg_stripe* stripe,
         uint8_t* nm, size_t nm_len, uint16_t dclass);
 
 /**
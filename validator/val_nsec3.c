@@ -46,6 +46,7 @@
 #include "validator/val_secalgo.h"
 #include "validator/validator.h"
 #include "validator/val_kentry.h"
+#include "validator/val_nsec3cache.h"
 #include "services/cache/rrset.h"
 #include "util/regional.h"
 #include "util/rbtree.h"
@@ -105,6 +106,8 @@ struct nsec3_filter {
 	size_t num;
 	/** class of records for the NSEC3, only this class applies */
 	uint16_t fclass;
+	/** shared cache of NSEC3 hashes, or NULL */
+	struct nsec3_hash_cache* hcache;
 };
 
 /** return number of rrs in an rrset */
@@ -401,10 +404,11 @@ nsec3_rrset_has_known(struct ub_packed_rrset_key* s)
  *	query name to match a zone for.
  *	query type (if DS a higher zone must be chosen)
  *	qclass, to filter NSEC3s with.
+ * @param ve: validator environment, with the NSEC3 hash cache.
  */
 static void
 filter_init(struct nsec3_filter* filter, struct ub_packed_rrset_key** list,
-	size_t num, struct query_info* qinfo)
+	size_t num, struct query_info* qinfo, struct val_env* ve)
 {
 	size_t i;
 	uint8_t* nm;
@@ -414,6 +418,7 @@ filter_init(struct nsec3_filter* filter, struct ub_packed_rrset_key** list,
 	filter->list = list;
 	filter->num = num;
 	filter->fclass = qinfo->qclass;
+	filter->hcache = ve->nsec3cache;
 	for(i=0; i<num; i++) {
 		/* ignore other stuff in the list */
 		if(ntohs(list[i]->rk.type) != LDNS_RR_TYPE_NSEC3 ||
@@ -457,10 +462,15 @@ get_max_iter(struct val_env* ve, size_t bits)
 	/* round up to nearest config keysize, linear search, keep it small */
 	for(i=0; i<ve->nsec3_keyiter_count; i++) {
 		if(bits <= ve->nsec3_keysize[i])
-			return ve->nsec3_maxiter[i];
+			break;
 	}
 	/* else, use value for biggest key */
-	return ve->nsec3_maxiter[ve->nsec3_keyiter_count-1];
+	if(i == ve->nsec3_keyiter_count)
+		i--;
+	/* no more than the iteration ceiling for any key size */
+	if(ve->nsec3_maxiter[i] > ve->nsec3_iter_ceiling)
+		return ve->nsec3_iter_ceiling;
+	return ve->nsec3_maxiter[i];
 }
 
 /** 
@@ -562,17 +572,35 @@ nsec3_get_hashed(sldns_buffer* buf, uint8_t* nm, size_t nmlen, int algo,
 	return hash_len;
 }
 
-/** perform hash of name */
+/** perform hash of name, or get it from the shared cache, the cache
+ * hits and misses are counted in the env of the thread */
 static int
-nsec3_calc_hash(struct regional* region, sldns_buffer* buf, 
+nsec3_calc_hash(struct nsec3_hash_cache* hcache, struct module_env* env,
 	struct nsec3_cached_hash* c)
 {
+	struct regional* region = env->scratch;
+	sldns_buffer* buf = env->scratch_buffer;
 	int algo = nsec3_get_algo(c->nsec3, c->rr);
 	size_t iter = nsec3_get_iter(c->nsec3, c->rr);
-	uint8_t* salt;
-	size_t saltlen, i;
+	uint8_t* salt, *zone = c->nsec3->rk.dname;
+	size_t saltlen, i, zonelen = c->nsec3->rk.dname_len;
+	uint8_t res[NSEC3_HASH_CACHE_MAXLEN];
 	if(!nsec3_get_salt(c->nsec3, c->rr, &salt, &saltlen))
 		return -1;
+	/* the zone is the NSEC3 owner name without the hash label */
+	dname_remove_label(&zone, &zonelen);
+	if(hcache && (c->hash_len=nsec3_hash_cache_lookup(hcache, zone,
+		zonelen, algo, iter, salt, saltlen, c->dname, c->dname_len,
+		res, sizeof(res))) != 0) {
+		env->num_nsec3_cache_hit++;
+		c->hash = (uint8_t*)regional_alloc_init(region, res,
+			c->hash_len);
+		if(!c->hash)
+			return 0;
+		return 1;
+	}
+	if(hcache)
+		env->num_nsec3_cache_miss++;
 	/* prepare buffer for first iteration */
 	sldns_buffer_clear(buf);
 	sldns_buffer_write(buf, c->dname, c->dname_len);
@@ -598,6 +626,10 @@ nsec3_calc_hash(struct regional* region, sldns_buffer* buf,
 			(unsigned char*)sldns_buffer_begin(buf),
 			sldns_buffer_limit(buf), (unsigned char*)c->hash);
 	}
+	if(hcache)
+		nsec3_hash_cache_insert(hcache, zone, zonelen, algo, iter,
+			salt, saltlen, c->dname, c->dname_len, c->hash,
+			c->hash_len);
 	return 1;
 }
 
@@ -623,9 +655,9 @@ nsec3_calc_b32(struct regional* region, sldns_buffer* buf,
 }
 
 int
-nsec3_hash_name(rbtree_type* table, struct regional* region, sldns_buffer* buf,
-	struct ub_packed_rrset_key* nsec3, int rr, uint8_t* dname, 
-	size_t dname_len, struct nsec3_cached_hash** hash)
+nsec3_hash_name(rbtree_type* table, struct nsec3_hash_cache* hcache,
+	struct module_env* env, struct ub_packed_rrset_key* nsec3, int rr,
+	uint8_t* dname, size_t dname_len, struct nsec3_cached_hash** hash)
 {
 	struct nsec3_cached_hash* c;
 	struct nsec3_cached_hash looki;
@@ -645,17 +677,18 @@ nsec3_hash_name(rbtree_type* table, struct regional* region, sldns_buffer* buf,
 		return 1;
 	}
 	/* create a new entry */
-	c = (struct nsec3_cached_hash*)regional_alloc(region, sizeof(*c));
+	c = (struct nsec3_cached_hash*)regional_alloc(env->scratch,
+		sizeof(*c));
 	if(!c) return 0;
 	c->node.key = c;
 	c->nsec3 = nsec3;
 	c->rr = rr;
 	c->dname = dname;
 	c->dname_len = dname_len;
-	r = nsec3_calc_hash(region, buf, c);
+	r = nsec3_calc_hash(hcache, env, c);
 	if(r != 1)
 		return r;
-	r = nsec3_calc_b32(region, buf, c);
+	r = nsec3_calc_b32(env->scratch, env->scratch_buffer, c);
 	if(r != 1)
 		return r;
 #ifdef UNBOUND_DEBUG
@@ -743,8 +776,8 @@ find_matching_nsec3(struct module_env* env, struct nsec3_filter* flt,
 	for(s=filter_first(flt, &i_rs, &i_rr); s; 
 		s=filter_next(flt, &i_rs, &i_rr)) {
 		/* get name hashed for this NSEC3 RR */
-		r = nsec3_hash_name(ct, env->scratch, env->scratch_buffer,
-			s, i_rr, nm, nmlen, &hash);
+		r = nsec3_hash_name(ct, flt->hcache, env, s, i_rr, nm,
+			nmlen, &hash);
 		if(r == 0) {
 			log_err("nsec3: malloc failure");
 			break; /* alloc failure */
@@ -836,8 +869,8 @@ find_covering_nsec3(struct module_env* env, struct nsec3_filter* flt,
 	for(s=filter_first(flt, &i_rs, &i_rr); s; 
 		s=filter_next(flt, &i_rs, &i_rr)) {
 		/* get name hashed for this NSEC3 RR */
-		r = nsec3_hash_name(ct, env->scratch, env->scratch_buffer,
-			s, i_rr, nm, nmlen, &hash);
+		r = nsec3_hash_name(ct, flt->hcache, env, s, i_rr, nm,
+			nmlen, &hash);
 		if(r == 0) {
 			log_err("nsec3: malloc failure");
 			break; /* alloc failure */
@@ -1068,7 +1101,7 @@ nsec3_prove_nameerror(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve); /* init RR iterator */
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
@@ -1227,7 +1260,7 @@ nsec3_prove_nodata(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve); /* init RR iterator */
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
@@ -1251,7 +1284,7 @@ nsec3_prove_wildcard(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve); /* init RR iterator */
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
@@ -1328,7 +1361,7 @@ nsec3_prove_nods(struct module_env* env, struct val_env* ve,
 	if(!list_is_secure(env, ve, list, num, kkey, reason))
 		return sec_status_bogus; /* not all NSEC3 records secure */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve); /* init RR iterator */
 	if(!flt.zone) {
 		*reason = "no NSEC3 records";
 		return sec_status_bogus; /* no RRs */
@@ -1410,7 +1443,7 @@ nsec3_prove_nxornodata(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve); /* init RR iterator */
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
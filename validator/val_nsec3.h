@@ -76,6 +76,7 @@ struct reply_info;
 struct query_info;
 struct key_entry_key;
 struct sldns_buffer;
+struct nsec3_hash_cache;
 
 /**
  *     0 1 2 3 4 5 6 7
@@ -257,9 +258,13 @@ int nsec3_hash_cmp(const void* c1, const void* c2);
  * published to enable unit testing of hash algorithms and cache.
  *
  * @param table: the cache table. Must be initialised at start.
- * @param region: scratch region to use for allocation.
- * 	This region holds the tree, if you wipe the region, reinit the tree.
- * @param buf: temporary buffer.
+ * @param hcache: the NSEC3 hash cache shared by the threads, or NULL.
+ * 	Names that are not in the table are looked up there, before
+ * 	they are hashed.
+ * @param env: module env, the hits and misses of hcache are counted in
+ * 	it.  Its scratch region is used for allocation, and its scratch
+ * 	buffer as temporary buffer.  The scratch region holds the tree,
+ * 	if you wipe the region, reinit the tree.
  * @param nsec3: the rrset with parameters
  * @param rr: rr number from d that has the NSEC3 parameters to hash to.
  * @param dname: name to hash
@@ -271,8 +276,8 @@ int nsec3_hash_cmp(const void* c1, const void* c2);
  * 	0 on a malloc failure.
  * 	-1 if the NSEC3 rr was badly formatted (i.e. formerr).
  */
-int nsec3_hash_name(rbtree_type* table, struct regional* region,
-	struct sldns_buffer* buf, struct ub_packed_rrset_key* nsec3, int rr,
+int nsec3_hash_name(rbtree_type* table, struct nsec3_hash_cache* hcache,
+	struct module_env* env, struct ub_packed_rrset_key* nsec3, int rr,
 	uint8_t* dname, size_t dname_len, struct nsec3_cached_hash** hash);
 
 /**
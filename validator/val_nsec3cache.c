@@ -0,0 +1,244 @@
+/*
+ * validator/val_nsec3cache.c - validator cache of NSEC3 hashes.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains functions for the validator NSEC3 hash cache.
+ */
+#include "config.h"
+#include "validator/val_nsec3cache.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "util/data/dname.h"
+#include "util/storage/lookup3.h"
+#include "sldns/rrdef.h"
+
+size_t
+nsec3_hash_cache_sizefunc(void* k, void* ATTR_UNUSED(d))
+{
+	struct nsec3_hash_cache_key* key = (struct nsec3_hash_cache_key*)k;
+	return sizeof(*key) + key->zone_len + key->salt_len + key->name_len
+		+ sizeof(struct nsec3_hash_cache_data)
+		+ lock_get_mem(&key->entry.lock);
+}
+
+int
+nsec3_hash_cache_compfunc(void* key1, void* key2)
+{
+	struct nsec3_hash_cache_key* k1 = (struct nsec3_hash_cache_key*)key1;
+	struct nsec3_hash_cache_key* k2 = (struct nsec3_hash_cache_key*)key2;
+	int c;
+	/* the names are stored in lowercase */
+	if(k1->name_len != k2->name_len)
+		return k1->name_len < k2->name_len ? -1 : 1;
+	if((c=memcmp(k1->name, k2->name, k1->name_len)) != 0)
+		return c;
+	if(k1->algo != k2->algo)
+		return k1->algo < k2->algo ? -1 : 1;
+	if(k1->iter != k2->iter)
+		return k1->iter < k2->iter ? -1 : 1;
+	if(k1->salt_len != k2->salt_len)
+		return k1->salt_len < k2->salt_len ? -1 : 1;
+	if((c=memcmp(k1->salt, k2->salt, k1->salt_len)) != 0)
+		return c;
+	if(k1->zone_len != k2->zone_len)
+		return k1->zone_len < k2->zone_len ? -1 : 1;
+	return memcmp(k1->zone, k2->zone, k1->zone_len);
+}
+
+void
+nsec3_hash_cache_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
+{
+	struct nsec3_hash_cache_key* key = (struct nsec3_hash_cache_key*)k;
+	if(!key)
+		return;
+	lock_rw_destroy(&key->entry.lock);
+	free(key);
+}
+
+void
+nsec3_hash_cache_deldatafunc(void* d, void* ATTR_UNUSED(arg))
+{
+	free(d);
+}
+
+struct nsec3_hash_cache*
+nsec3_hash_cache_create(struct config_file* cfg)
+{
+	struct nsec3_hash_cache* hc = (struct nsec3_hash_cache*)calloc(1,
+		sizeof(*hc));
+	if(!hc) {
+		log_err("malloc failure");
+		return NULL;
+	}
+	hc->slab = slabhash_create(cfg->key_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, cfg->nsec3_cache_size,
+		&nsec3_hash_cache_sizefunc, &nsec3_hash_cache_compfunc,
+		&nsec3_hash_cache_delkeyfunc, &nsec3_hash_cache_deldatafunc,
+		NULL);
+	if(!hc->slab) {
+		log_err("malloc failure");
+		free(hc);
+		return NULL;
+	}
+	slabhash_setclock(hc->slab, cfg->cache_clock_eviction);
+	return hc;
+}
+
+void
+nsec3_hash_cache_delete(struct nsec3_hash_cache* hc)
+{
+	if(!hc)
+		return;
+	slabhash_delete(hc->slab);
+	free(hc);
+}
+
+/** the hash value of the entry */
+static hashvalue_type
+nsec3_hash_cache_hash(struct nsec3_hash_cache_key* k)
+{
+	hashvalue_type h = 0xab;
+	h = dname_query_hash(k->name, h);
+	h = dname_query_hash(k->zone, h);
+	h = hashlittle(&k->algo, sizeof(k->algo), h);
+	h = hashlittle(&k->iter, sizeof(k->iter), h);
+	h = hashlittle(k->salt, k->salt_len, h);
+	return h;
+}
+
+/** fill the lookup key, the names are lowercased into the buffers */
+static int
+nsec3_hash_cache_key_init(struct nsec3_hash_cache_key* k, uint8_t* zone,
+	size_t zone_len, int algo, size_t iter, uint8_t* salt,
+	size_t salt_len, uint8_t* name, size_t name_len, uint8_t* zbuf,
+	uint8_t* nbuf)
+{
+	if(zone_len > LDNS_MAX_DOMAINLEN || name_len > LDNS_MAX_DOMAINLEN)
+		return 0;
+	memset(k, 0, sizeof(*k));
+	memmove(zbuf, zone, zone_len);
+	query_dname_tolower(zbuf);
+	memmove(nbuf, name, name_len);
+	query_dname_tolower(nbuf);
+	k->entry.key = k;
+	k->zone = zbuf;
+	k->zone_len = zone_len;
+	k->algo = algo;
+	k->iter = iter;
+	k->salt = salt;
+	k->salt_len = salt_len;
+	k->name = nbuf;
+	k->name_len = name_len;
+	return 1;
+}
+
+size_t
+nsec3_hash_cache_lookup(struct nsec3_hash_cache* hc, uint8_t* zone,
+	size_t zone_len, int algo, size_t iter, uint8_t* salt,
+	size_t salt_len, uint8_t* name, size_t name_len, uint8_t* res,
+	size_t max)
+{
+	struct nsec3_hash_cache_key key;
+	struct lruhash_entry* e;
+	uint8_t zbuf[LDNS_MAX_DOMAINLEN+1], nbuf[LDNS_MAX_DOMAINLEN+1];
+	size_t len = 0;
+	if(!nsec3_hash_cache_key_init(&key, zone, zone_len, algo, iter,
+		salt, salt_len, name, name_len, zbuf, nbuf))
+		return 0;
+	e = slabhash_lookup(hc->slab, nsec3_hash_cache_hash(&key), &key, 0);
+	if(e) {
+		struct nsec3_hash_cache_data* d =
+			(struct nsec3_hash_cache_data*)e->data;
+		if(d->hash_len <= max) {
+			len = d->hash_len;
+			memmove(res, d->hash, len);
+		}
+		lock_rw_unlock(&e->lock);
+	}
+	return len;
+}
+
+void
+nsec3_hash_cache_insert(struct nsec3_hash_cache* hc, uint8_t* zone,
+	size_t zone_len, int algo, size_t iter, uint8_t* salt,
+	size_t salt_len, uint8_t* name, size_t name_len, uint8_t* hash,
+	size_t hash_len)
+{
+	struct nsec3_hash_cache_key* k;
+	struct nsec3_hash_cache_data* d;
+	if(hash_len > NSEC3_HASH_CACHE_MAXLEN ||
+		zone_len > LDNS_MAX_DOMAINLEN || name_len > LDNS_MAX_DOMAINLEN)
+		return;
+	/* the names and the salt are stored after the key */
+	k = (struct nsec3_hash_cache_key*)calloc(1, sizeof(*k) + zone_len +
+		salt_len + name_len);
+	d = (struct nsec3_hash_cache_data*)malloc(sizeof(*d));
+	if(!k || !d) {
+		free(k);
+		free(d);
+		return;
+	}
+	k->zone = (uint8_t*)k + sizeof(*k);
+	memmove(k->zone, zone, zone_len);
+	query_dname_tolower(k->zone);
+	k->zone_len = zone_len;
+	k->algo = algo;
+	k->iter = iter;
+	k->salt = k->zone + zone_len;
+	if(salt_len)
+		memmove(k->salt, salt, salt_len);
+	k->salt_len = salt_len;
+	k->name = k->salt + salt_len;
+	memmove(k->name, name, name_len);
+	query_dname_tolower(k->name);
+	k->name_len = name_len;
+	lock_rw_init(&k->entry.lock);
+	k->entry.hash = nsec3_hash_cache_hash(k);
+	k->entry.key = k;
+	k->entry.data = d;
+	d->hash_len = hash_len;
+	memmove(d->hash, hash, hash_len);
+	slabhash_insert(hc->slab, k->entry.hash, &k->entry, d, NULL);
+}
+
+size_t
+nsec3_hash_cache_get_mem(struct nsec3_hash_cache* hc)
+{
+	if(!hc)
+		return 0;
+	return sizeof(*hc) + slabhash_get_mem(hc->slab);
+}
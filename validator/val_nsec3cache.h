@@ -0,0 +1,169 @@
+/*
+ * validator/val_nsec3cache.h - validator cache of NSEC3 hashes.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a cache of NSEC3 hashes, shared by the threads.
+ * The closest encloser proofs of queries for a zone hash the same names
+ * with the same parameters, this saves the iterated hashing.
+ */
+
+#ifndef VALIDATOR_VAL_NSEC3CACHE_H
+#define VALIDATOR_VAL_NSEC3CACHE_H
+#include "util/storage/slabhash.h"
+#include "util/locks.h"
+struct config_file;
+
+/** max length of a hash in the cache, bytes */
+#define NSEC3_HASH_CACHE_MAXLEN 64
+
+/**
+ * NSEC3 hash cache
+ */
+struct nsec3_hash_cache {
+	/** uses slabhash for storage, type nsec3_hash_cache_key and
+	 * nsec3_hash_cache_data */
+	struct slabhash* slab;
+};
+
+/**
+ * Key of an NSEC3 hash entry.  The names and the salt are allocated
+ * after the structure.
+ */
+struct nsec3_hash_cache_key {
+	/** lru hash entry */
+	struct lruhash_entry entry;
+	/** the zone of the NSEC3 record, lowercase */
+	uint8_t* zone;
+	/** length of the zone name */
+	size_t zone_len;
+	/** hash algorithm */
+	int algo;
+	/** number of iterations */
+	size_t iter;
+	/** the salt */
+	uint8_t* salt;
+	/** length of the salt */
+	size_t salt_len;
+	/** the name that is hashed, lowercase */
+	uint8_t* name;
+	/** length of the name */
+	size_t name_len;
+};
+
+/**
+ * Data of an NSEC3 hash entry.
+ */
+struct nsec3_hash_cache_data {
+	/** length of the hash */
+	size_t hash_len;
+	/** the hash, not base32 encoded */
+	uint8_t hash[NSEC3_HASH_CACHE_MAXLEN];
+};
+
+/**
+ * Create the NSEC3 hash cache
+ * @param cfg: config settings for the cache.
+ * @return new NSEC3 hash cache or NULL on malloc failure.
+ */
+struct nsec3_hash_cache* nsec3_hash_cache_create(struct config_file* cfg);
+
+/**
+ * Delete the NSEC3 hash cache
+ * @param hc: to delete
+ */
+void nsec3_hash_cache_delete(struct nsec3_hash_cache* hc);
+
+/**
+ * Lookup an NSEC3 hash in the cache.
+ * @param hc: the NSEC3 hash cache.
+ * @param zone: the zone of the NSEC3 record.
+ * @param zone_len: length of the zone name.
+ * @param algo: hash algorithm.
+ * @param iter: number of iterations.
+ * @param salt: the salt.
+ * @param salt_len: length of the salt.
+ * @param name: the name that is hashed.
+ * @param name_len: length of the name.
+ * @param res: the hash is returned here.
+ * @param max: size of res.
+ * @return length of the hash, or 0 if not in the cache.
+ */
+size_t nsec3_hash_cache_lookup(struct nsec3_hash_cache* hc, uint8_t* zone,
+	size_t zone_len, int algo, size_t iter, uint8_t* salt,
+	size_t salt_len, uint8_t* name, size_t name_len, uint8_t* res,
+	size_t max);
+
+/**
+ * Insert an NSEC3 hash in the cache.  The insert may silently fail if
+ * there is not enough memory.
+ * @param hc: the NSEC3 hash cache.
+ * @param zone: the zone of the NSEC3 record.
+ * @param zone_len: length of the zone name.
+ * @param algo: hash algorithm.
+ * @param iter: number of iterations.
+ * @param salt: the salt.
+ * @param salt_len: length of the salt.
+ * @param name: the name that is hashed.
+ * @param name_len: length of the name.
+ * @param hash: the hash.
+ * @param hash_len: length of the hash.
+ */
+void nsec3_hash_cache_insert(struct nsec3_hash_cache* hc, uint8_t* zone,
+	size_t zone_len, int algo, size_t iter, uint8_t* salt,
+	size_t salt_len, uint8_t* name, size_t name_len, uint8_t* hash,
+	size_t hash_len);
+
+/**
+ * Get memory in use by the NSEC3 hash cache.
+ * @param hc: the NSEC3 hash cache.
+ * @return memory in use in bytes.
+ */
+size_t nsec3_hash_cache_get_mem(struct nsec3_hash_cache* hc);
+
+/** calculate size for the hashtable, does not count size of lock */
+size_t nsec3_hash_cache_sizefunc(void* k, void* d);
+
+/** compare two NSEC3 hash cache keys */
+int nsec3_hash_cache_compfunc(void* key1, void* key2);
+
+/** delete key, and destroy the lock */
+void nsec3_hash_cache_delkeyfunc(void* k, void* arg);
+
+/** delete data */
+void nsec3_hash_cache_deldatafunc(void* d, void* arg);
+
+#endif /* VALIDATOR_VAL_NSEC3CACHE_H */
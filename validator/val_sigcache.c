@@ -0,0 +1,184 @@
+/*
+ * validator/val_sigcache.c - validator cache of verified signatures.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains functions for the validator signature cache.
+ */
+#include "config.h"
+#include "validator/val_sigcache.h"
+#include "validator/val_secalgo.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "util/regional.h"
+#include "sldns/sbuffer.h"
+
+size_t
+sig_cache_sizefunc(void* k, void* ATTR_UNUSED(d))
+{
+	struct sig_cache_key* key = (struct sig_cache_key*)k;
+	return sizeof(*key) + sizeof(struct sig_cache_data)
+		+ lock_get_mem(&key->entry.lock);
+}
+
+int
+sig_cache_compfunc(void* key1, void* key2)
+{
+	struct sig_cache_key* k1 = (struct sig_cache_key*)key1;
+	struct sig_cache_key* k2 = (struct sig_cache_key*)key2;
+	return memcmp(k1->digest, k2->digest, sizeof(k1->digest));
+}
+
+void
+sig_cache_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
+{
+	struct sig_cache_key* key = (struct sig_cache_key*)k;
+	if(!key)
+		return;
+	lock_rw_destroy(&key->entry.lock);
+	free(key);
+}
+
+void
+sig_cache_deldatafunc(void* d, void* ATTR_UNUSED(arg))
+{
+	free(d);
+}
+
+struct sig_cache*
+sig_cache_create(struct config_file* cfg)
+{
+	struct sig_cache* sc = (struct sig_cache*)calloc(1, sizeof(*sc));
+	if(!sc) {
+		log_err("malloc failure");
+		return NULL;
+	}
+	sc->slab = slabhash_create(cfg->key_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, cfg->sig_cache_size,
+		&sig_cache_sizefunc, &sig_cache_compfunc,
+		&sig_cache_delkeyfunc, &sig_cache_deldatafunc, NULL);
+	if(!sc->slab) {
+		log_err("malloc failure");
+		free(sc);
+		return NULL;
+	}
+	slabhash_setclock(sc->slab, cfg->cache_clock_eviction);
+	return sc;
+}
+
+void
+sig_cache_delete(struct sig_cache* sc)
+{
+	if(!sc)
+		return;
+	slabhash_delete(sc->slab);
+	free(sc);
+}
+
+int
+sig_cache_digest(struct regional* region, struct sldns_buffer* buf,
+	unsigned char* sigblock, unsigned int sigblock_len,
+	unsigned char* key, unsigned int keylen, uint8_t* digest)
+{
+	/* the digest of the canonical rrset, followed by the signature
+	 * and the public key, the dates and the keytag are in the
+	 * canonical rrset already */
+	size_t len = SIG_CACHE_DIGEST_LEN + sigblock_len + keylen;
+	uint8_t* p = (uint8_t*)regional_alloc(region, len);
+	if(!p)
+		return 0;
+	secalgo_hash_sha256(sldns_buffer_begin(buf), sldns_buffer_limit(buf),
+		p);
+	memmove(p+SIG_CACHE_DIGEST_LEN, sigblock, sigblock_len);
+	memmove(p+SIG_CACHE_DIGEST_LEN+sigblock_len, key, keylen);
+	secalgo_hash_sha256(p, len, digest);
+	return 1;
+}
+
+/** the hash value of the entry, from the digest */
+static hashvalue_type
+sig_cache_hash(uint8_t* digest)
+{
+	hashvalue_type h;
+	memmove(&h, digest, sizeof(h));
+	return h;
+}
+
+int
+sig_cache_lookup(struct sig_cache* sc, uint8_t* digest, time_t now)
+{
+	struct sig_cache_key key;
+	struct lruhash_entry* e;
+	int found = 0;
+	memset(&key, 0, sizeof(key));
+	memmove(key.digest, digest, sizeof(key.digest));
+	key.entry.key = &key;
+	e = slabhash_lookup(sc->slab, sig_cache_hash(digest), &key, 0);
+	if(e) {
+		found = (((struct sig_cache_data*)e->data)->ttl > now);
+		lock_rw_unlock(&e->lock);
+	}
+	return found;
+}
+
+void
+sig_cache_insert(struct sig_cache* sc, uint8_t* digest, time_t ttl)
+{
+	struct sig_cache_key* k = (struct sig_cache_key*)calloc(1,
+		sizeof(*k));
+	struct sig_cache_data* d = (struct sig_cache_data*)malloc(
+		sizeof(*d));
+	if(!k || !d) {
+		free(k);
+		free(d);
+		return;
+	}
+	memmove(k->digest, digest, sizeof(k->digest));
+	lock_rw_init(&k->entry.lock);
+	k->entry.hash = sig_cache_hash(digest);
+	k->entry.key = k;
+	k->entry.data = d;
+	d->ttl = ttl;
+	slabhash_insert(sc->slab, k->entry.hash, &k->entry, d, NULL);
+}
+
+size_t
+sig_cache_get_mem(struct sig_cache* sc)
+{
+	if(!sc)
+		return 0;
+	return sizeof(*sc) + slabhash_get_mem(sc->slab);
+}
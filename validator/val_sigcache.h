@@ -0,0 +1,149 @@
+/*
+ * validator/val_sigcache.h - validator cache of verified signatures.
+ *
+ * Copyright (c) 2018, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a cache of signatures that verified correctly.
+ * The same rrset, signed by the same RRSIG with the same DNSKEY, does not
+ * need the public key crypto again, when another query or thread meets it.
+ */
+
+#ifndef VALIDATOR_VAL_SIGCACHE_H
+#define VALIDATOR_VAL_SIGCACHE_H
+#include "util/storage/slabhash.h"
+#include "util/locks.h"
+struct config_file;
+struct regional;
+struct sldns_buffer;
+
+/** length of the digest that identifies a verified signature, sha256 */
+#define SIG_CACHE_DIGEST_LEN 32
+
+/**
+ * Signature cache
+ */
+struct sig_cache {
+	/** uses slabhash for storage, type sig_cache_key, sig_cache_data.
+	 * The hits and misses are counted per thread, in the module_env. */
+	struct slabhash* slab;
+};
+
+/**
+ * Key of a verified signature entry.
+ */
+struct sig_cache_key {
+	/** lru hash entry */
+	struct lruhash_entry entry;
+	/** digest over the canonical rrset, the RRSIG rdata and the DNSKEY */
+	uint8_t digest[SIG_CACHE_DIGEST_LEN];
+};
+
+/**
+ * Data of a verified signature entry.
+ */
+struct sig_cache_data {
+	/** absolute time when the entry expires, the signature
+	 * expiration date */
+	time_t ttl;
+};
+
+/**
+ * Create the signature cache
+ * @param cfg: config settings for the signature cache.
+ * @return new signature cache or NULL on malloc failure.
+ */
+struct sig_cache* sig_cache_create(struct config_file* cfg);
+
+/**
+ * Delete the signature cache
+ * @param sc: to delete
+ */
+void sig_cache_delete(struct sig_cache* sc);
+
+/**
+ * Calculate the digest that identifies a signature.
+ * @param region: temporary storage.
+ * @param buf: canonical rrset, with the RRSIG rdata prepended, as it is
+ * 	passed to the signature verification.
+ * @param sigblock: the signature.
+ * @param sigblock_len: length of the signature.
+ * @param key: the public key of the DNSKEY.
+ * @param keylen: length of the public key.
+ * @param digest: the digest is returned here, SIG_CACHE_DIGEST_LEN bytes.
+ * @return false on alloc failure.
+ */
+int sig_cache_digest(struct regional* region, struct sldns_buffer* buf,
+	unsigned char* sigblock, unsigned int sigblock_len,
+	unsigned char* key, unsigned int keylen, uint8_t* digest);
+
+/**
+ * Lookup a signature in the cache.
+ * @param sc: the signature cache.
+ * @param digest: digest of the signature.
+ * @param now: current time.
+ * @return true if the signature verified before and has not expired.
+ */
+int sig_cache_lookup(struct sig_cache* sc, uint8_t* digest, time_t now);
+
+/**
+ * Insert a verified signature in the cache.  The insert may silently
+ * fail if there is not enough memory.
+ * @param sc: the signature cache.
+ * @param digest: digest of the signature.
+ * @param ttl: absolute time when the signature expires.
+ */
+void sig_cache_insert(struct sig_cache* sc, uint8_t* digest, time_t ttl);
+
+/**
+ * Get memory in use by the signature cache.
+ * @param sc: the signature cache.
+ * @return memory in use in bytes.
+ */
+size_t sig_cache_get_mem(struct sig_cache* sc);
+
+/** calculate size for the hashtable, does not count size of lock */
+size_t sig_cache_sizefunc(void* k, void* d);
+
+/** compare two signature cache keys */
+int sig_cache_compfunc(void* key1, void* key2);
+
+/** delete key, and destroy the lock */
+void sig_cache_delkeyfunc(void* k, void* arg);
+
+/** delete data */
+void sig_cache_deldatafunc(void* d, void* arg);
+
+#endif /* VALIDATOR_VAL_SIGCACHE_H */
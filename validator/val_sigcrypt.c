@@ -44,6 +44,7 @@
 #include "validator/val_sigcrypt.h"
 #include "validator/val_secalgo.h"
 #include "validator/validator.h"
+#include "validator/val_sigcache.h"
 #include "util/data/msgreply.h"
 #include "util/data/msgparse.h"
 #include "util/data/dname.h"
@@ -575,8 +576,7 @@ dnskey_verify_rrset(struct module_env* env, struct val_env* ve,
 			tag != rrset_get_sig_keytag(rrset, i))
 			continue;
 		buf_canon = 0;
-		sec = dnskey_verify_rrset_sig(env->scratch, 
-			env->scratch_buffer, ve, *env->now, rrset, 
+		sec = dnskey_verify_rrset_sig(env, ve, *env->now, rrset,
 			dnskey, dnskey_idx, i, &sortree, &buf_canon, reason);
 		if(sec == sec_status_secure)
 			return sec;
@@ -614,9 +614,8 @@ dnskeyset_verify_rrset_sig(struct module_env* env, struct val_env* ve,
 		numchecked ++;
 
 		/* see if key verifies */
-		sec = dnskey_verify_rrset_sig(env->scratch, 
-			env->scratch_buffer, ve, now, rrset, dnskey, i, 
-			sig_idx, sortree, &buf_canon, reason);
+		sec = dnskey_verify_rrset_sig(env, ve, now, rrset, dnskey,
+			i, sig_idx, sortree, &buf_canon, reason);
 		if(sec == sec_status_secure)
 			return sec;
 	}
@@ -1071,6 +1070,11 @@ int rrset_canonical_equal(struct regional* region,
 		d1->trust != d2->trust ||
 		d1->security != d2->security)
 		return 0;
+	/* the stored canonical images are sorted and downcased already */
+	if(d1->canon_len != 0 && d2->canon_len != 0)
+		return d1->canon_len == d2->canon_len &&
+			memcmp(packed_rrset_canon(d1), packed_rrset_canon(d2),
+			d1->canon_len) == 0;
 
 	/* init */
 	memset(&fk, 0, sizeof(fk));
@@ -1111,6 +1115,66 @@ int rrset_canonical_equal(struct regional* region,
 	return 1;
 }
 
+struct packed_rrset_data*
+rrset_canonical_store(struct ub_packed_rrset_key* k)
+{
+	struct packed_rrset_data* d = (struct packed_rrset_data*)k->entry.data;
+	struct packed_rrset_data* nd;
+	struct rbtree_type sortree;
+	struct canon_rr* rrs, *walk;
+	sldns_buffer canon;
+	size_t dsize, len = 0;
+
+	if(d->canon_len != 0 || d->count == 0 || d->count > RR_COUNT_MAX)
+		return NULL;
+	rrs = (struct canon_rr*)reallocarray(NULL, d->count,
+		sizeof(struct canon_rr));
+	if(!rrs)
+		return NULL;
+	rbtree_init(&sortree, &canonical_tree_compare);
+	canonical_sort(k, d, &sortree, rrs);
+	RBTREE_FOR(walk, struct canon_rr*, &sortree) {
+		len += d->rr_len[walk->rr_idx];
+	}
+	dsize = packed_rrset_sizeof(d);
+	nd = (struct packed_rrset_data*)malloc(dsize + len);
+	if(!nd) {
+		free(rrs);
+		return NULL;
+	}
+	memcpy(nd, d, dsize);
+	nd->canon_len = len;
+	packed_rrset_ptr_fixup(nd);
+	sldns_buffer_init_frm_data(&canon, packed_rrset_canon(nd), len);
+	RBTREE_FOR(walk, struct canon_rr*, &sortree) {
+		sldns_buffer_write(&canon, d->rr_data[walk->rr_idx],
+			d->rr_len[walk->rr_idx]);
+		canonicalize_rdata(&canon, k, d->rr_len[walk->rr_idx]);
+	}
+	free(rrs);
+	return nd;
+}
+
+/**
+ * Write the part of a canonical RR before the rdata into the buffer.
+ * @param buf: buffer to insert into at current position.
+ * @param k: rrset with owner name, type and class.
+ * @param sig: signature with signer name, label count and original TTL.
+ * @param can_owner: canonical owner in the buffer, NULL for the first RR.
+ * @param can_owner_len: length of canonical owner name.
+ */
+static void
+canonical_rr_start(sldns_buffer* buf, struct ub_packed_rrset_key* k,
+	uint8_t* sig, uint8_t** can_owner, size_t* can_owner_len)
+{
+	if(*can_owner)
+		sldns_buffer_write(buf, *can_owner, *can_owner_len);
+	else	insert_can_owner(buf, k, sig, can_owner, can_owner_len);
+	sldns_buffer_write(buf, &k->rk.type, 2);
+	sldns_buffer_write(buf, &k->rk.rrset_class, 2);
+	sldns_buffer_write(buf, sig+4, 4);
+}
+
 /**
  * Create canonical form of rrset in the scratch buffer.
  * @param region: temporary region.
@@ -1134,6 +1198,33 @@ rrset_canonical(struct regional* region, sldns_buffer* buf,
 	struct canon_rr* walk;
 	struct canon_rr* rrs;
 
+	if(d->canon_len != 0) {
+		/* the rdata is stored in canonical form and order */
+		uint8_t* p = packed_rrset_canon(d);
+		size_t left = d->canon_len, len;
+		sldns_buffer_clear(buf);
+		sldns_buffer_write(buf, sig, siglen);
+		query_dname_tolower(sldns_buffer_begin(buf)+18);
+		while(left >= 2) {
+			len = (size_t)sldns_read_uint16(p) + 2;
+			if(len > left)
+				return 0;
+			if(sldns_buffer_remaining(buf) < can_owner_len + 2 + 2
+				+ 4 + len) {
+				log_err("verify: failed to canonicalize, "
+					"rrset too big");
+				return 0;
+			}
+			canonical_rr_start(buf, k, sig, &can_owner,
+				&can_owner_len);
+			sldns_buffer_write(buf, p, len);
+			p += len;
+			left -= len;
+		}
+		sldns_buffer_flip(buf);
+		return 1;
+	}
+
 	if(!*sortree) {
 		*sortree = (struct rbtree_type*)regional_alloc(region, 
 			sizeof(rbtree_type));
@@ -1162,14 +1253,7 @@ rrset_canonical(struct regional* region, sldns_buffer* buf,
 				"rrset too big");
 			return 0;
 		}
-		/* determine canonical owner name */
-		if(can_owner)
-			sldns_buffer_write(buf, can_owner, can_owner_len);
-		else	insert_can_owner(buf, k, sig, &can_owner, 
-				&can_owner_len);
-		sldns_buffer_write(buf, &k->rk.type, 2);
-		sldns_buffer_write(buf, &k->rk.rrset_class, 2);
-		sldns_buffer_write(buf, sig+4, 4);
+		canonical_rr_start(buf, k, sig, &can_owner, &can_owner_len);
 		sldns_buffer_write(buf, d->rr_data[walk->rr_idx], 
 			d->rr_len[walk->rr_idx]);
 		canonicalize_rdata(buf, k, d->rr_len[walk->rr_idx]);
@@ -1351,9 +1435,24 @@ adjust_ttl(struct val_env* ve, uint32_t unow,
 	}
 }
 
+/** time until the signature expires, for the signature cache, or 0 */
+static time_t
+sig_expire_ttl(struct val_env* ve, uint32_t unow, uint8_t* expi_p)
+{
+	int32_t expi, now;
+	memmove(&expi, expi_p, sizeof(expi));
+	expi = ntohl(expi);
+	if(ve->date_override) {
+		now = ve->date_override;
+	} else	now = (int32_t)unow;
+	if(expi - now <= 0)
+		return 0;
+	return (time_t)(expi - now);
+}
+
 enum sec_status 
-dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf, 
-	struct val_env* ve, time_t now,
+dnskey_verify_rrset_sig(struct module_env* env, struct val_env* ve,
+	time_t now,
         struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey,
         size_t dnskey_idx, size_t sig_idx,
 	struct rbtree_type** sortree, int* buf_canon, char** reason)
@@ -1369,6 +1468,10 @@ dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf,
 	uint16_t ktag;		/* DNSKEY key tag */
 	unsigned char* key;	/* public key rdata field */
 	unsigned int keylen;
+	uint8_t digest[SIG_CACHE_DIGEST_LEN];
+	int cached = 0;
+	struct regional* region = env->scratch;
+	sldns_buffer* buf = env->scratch_buffer;
 	rrset_get_rdata(rrset, rrnum + sig_idx, &sig, &siglen);
 	/* min length of rdatalen, fixed rrsig, root signer, 1 byte sig */
 	if(siglen < 2+20) {
@@ -1469,8 +1572,25 @@ dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf,
 		return sec_status_unchecked;
 	}
 
+	/* the same signature verified before, skip the crypto */
+	if(ve->sigcache) {
+		if(!sig_cache_digest(region, buf, sigblock, sigblock_len,
+			key, keylen, digest)) {
+			log_err("verify: failed due to alloc error");
+			return sec_status_unchecked;
+		}
+		cached = sig_cache_lookup(ve->sigcache, digest, now);
+		/* counted per thread, there is no lock for it */
+		if(cached)
+			env->num_sig_cache_hit++;
+		else	env->num_sig_cache_miss++;
+	}
+
 	/* verify */
-	sec = verify_canonrrset(buf, (int)sig[2+2],
+	if(cached) {
+		verbose(VERB_ALGO, "verify: signature in cache");
+		sec = sec_status_secure;
+	} else	sec = verify_canonrrset(buf, (int)sig[2+2],
 		sigblock, sigblock_len, key, keylen, reason);
 	
 	if(sec == sec_status_secure) {
@@ -1483,6 +1603,12 @@ dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf,
 		if(!check_dates(ve, now, sig+2+8, sig+2+12, reason)) {
 			return sec_status_bogus;
 		}
+		if(ve->sigcache && !cached) {
+			time_t ttl = sig_expire_ttl(ve, now, sig+2+8);
+			if(ttl > 0)
+				sig_cache_insert(ve->sigcache, digest,
+					now + ttl);
+		}
 	}
 
 	return sec;
@@ -281,8 +281,8 @@ enum sec_status dnskeyset_verify_rrset_sig(struct module_env* env,
 
 /** 
  * verify rrset, with specific dnskey(from set), for a specific rrsig 
- * @param region: scratch region used for temporary allocation.
- * @param buf: scratch buffer used for canonicalized rrset data.
+ * @param env: module env, scratch region and buffer, and the counters
+ *	of the signature cache.
  * @param ve: validator environment, date settings.
  * @param now: current time for validation (can be overridden).
  * @param rrset: to be validated.
@@ -298,8 +298,8 @@ enum sec_status dnskeyset_verify_rrset_sig(struct module_env* env,
  * @return secure if this key signs this signature. unchecked on error or 
  *	bogus if it did not validate.
  */
-enum sec_status dnskey_verify_rrset_sig(struct regional* region, 
-	struct sldns_buffer* buf, struct val_env* ve, time_t now,
+enum sec_status dnskey_verify_rrset_sig(struct module_env* env,
+	struct val_env* ve, time_t now,
 	struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey, 
 	size_t dnskey_idx, size_t sig_idx,
 	struct rbtree_type** sortree, int* buf_canon, char** reason);
@@ -320,4 +320,13 @@ int canonical_tree_compare(const void* k1, const void* k2);
 int rrset_canonical_equal(struct regional* region,
 	struct ub_packed_rrset_key* k1, struct ub_packed_rrset_key* k2);
 
+/**
+ * Create a copy of the rrset data with the canonical rdata image
+ * appended, see canon_len in packed_rrset_data.
+ * @param k: rrset with contiguous data, not altered.
+ * @return malloced rrset data, or NULL if the data already has the image,
+ *	has no rrs or on alloc failure.
+ */
+struct packed_rrset_data* rrset_canonical_store(struct ub_packed_rrset_key* k);
+
 #endif /* VALIDATOR_VAL_SIGCRYPT_H */
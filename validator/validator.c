@@ -43,6 +43,9 @@
 #include "validator/validator.h"
 #include "validator/val_anchor.h"
 #include "validator/val_kcache.h"
+#include "validator/val_sigcache.h"
+#include "validator/val_nsec3cache.h"
+#include "validator/val_cryptopool.h"
 #include "validator/val_kentry.h"
 #include "validator/val_utils.h"
 #include "validator/val_nsec.h"
@@ -51,6 +54,7 @@
 #include "validator/val_sigcrypt.h"
 #include "validator/autotrust.h"
 #include "services/cache/dns.h"
+#include "services/cache/rrset.h"
 #include "util/data/dname.h"
 #include "util/module.h"
 #include "util/log.h"
@@ -126,6 +130,20 @@ val_apply_cfg(struct module_env* env, struct val_env* val_env,
 		return 0;
 	}
 	env->key_cache = val_env->kcache;
+	if(!val_env->sigcache && cfg->sig_cache_size != 0) {
+		val_env->sigcache = sig_cache_create(cfg);
+		if(!val_env->sigcache) {
+			log_err("out of memory");
+			return 0;
+		}
+	}
+	if(!val_env->nsec3cache && cfg->nsec3_cache_size != 0) {
+		val_env->nsec3cache = nsec3_hash_cache_create(cfg);
+		if(!val_env->nsec3cache) {
+			log_err("out of memory");
+			return 0;
+		}
+	}
 	if(!anchors_apply_cfg(env->anchors, cfg)) {
 		log_err("validator: error in trustanchors config");
 		return 0;
@@ -144,13 +162,18 @@ val_apply_cfg(struct module_env* env, struct val_env* val_env,
 		log_err("validator: cannot apply nsec3 key iterations");
 		return 0;
 	}
+	val_env->nsec3_iter_ceiling = (size_t)cfg->val_nsec3_max_iterations;
 	if(!val_env->neg_cache)
 		val_env->neg_cache = val_neg_create(cfg,
-			val_env->nsec3_maxiter[val_env->nsec3_keyiter_count-1]);
+			val_env->nsec3_maxiter[val_env->nsec3_keyiter_count-1] <
+			val_env->nsec3_iter_ceiling ?
+			val_env->nsec3_maxiter[val_env->nsec3_keyiter_count-1] :
+			val_env->nsec3_iter_ceiling);
 	if(!val_env->neg_cache) {
 		log_err("out of memory");
 		return 0;
 	}
+	val_env->neg_cache->nsec3cache = val_env->nsec3cache;
 	env->neg_cache = val_env->neg_cache;
 	return 1;
 }
@@ -194,6 +217,8 @@ val_deinit(struct module_env* env, int id)
 	anchors_delete(env->anchors);
 	env->anchors = NULL;
 	key_cache_delete(val_env->kcache);
+	sig_cache_delete(val_env->sigcache);
+	nsec3_hash_cache_delete(val_env->nsec3cache);
 	neg_cache_delete(val_env->neg_cache);
 	free(val_env->nsec3_keysize);
 	free(val_env->nsec3_maxiter);
@@ -1726,6 +1751,63 @@ processFindKey(struct module_qstate* qstate, struct val_qstate* vq, int id)
 	return 0;
 }
 
+/**
+ * Send the rrsets of the message that need signature verification to the
+ * crypto pool, where they verify in parallel.  The rrsets that verify are
+ * marked secure, when the jobs are done, and the others are checked
+ * again by validate_msg_signatures for the reason of failure.
+ * @param qstate: query state.
+ * @param vq: validator query state.
+ * @param ve: validator shared global environment.
+ * @param id: module id.
+ * @return the number of jobs sent to the pool.
+ */
+static int
+val_crypto_submit(struct module_qstate* qstate, struct val_qstate* vq,
+	struct val_env* ve, int id)
+{
+	struct module_env* env = qstate->env;
+	struct reply_info* rep = vq->chase_reply;
+	size_t i, num = rep->an_numrrsets + rep->ns_numrrsets;
+	uint8_t* sname;
+	size_t slen;
+	int n = 0;
+	if(env->cfg->val_clean_additional)
+		num = rep->rrset_count;
+	for(i=0; i<num; i++) {
+		struct ub_packed_rrset_key* s = rep->rrsets[i];
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			s->entry.data;
+		struct crypto_job* job;
+		if(d->security == sec_status_secure || d->rrsig_count == 0)
+			continue;
+		/* in the additional section, only the key signs */
+		if(i >= rep->an_numrrsets + rep->ns_numrrsets) {
+			val_find_rrset_signer(s, &sname, &slen);
+			if(!sname || query_dname_compare(sname,
+				vq->key_entry->name) != 0)
+				continue;
+		}
+		rrset_check_sec_status(env->rrset_cache, s, *env->now);
+		if(d->security == sec_status_secure)
+			continue;
+		job = crypto_job_create(qstate, id, ve, s, vq->key_entry,
+			env->crypto_thread);
+		if(!job)
+			break;
+		job->qnext = vq->crypto_jobs;
+		vq->crypto_jobs = job;
+		if(!crypto_pool_submit(env->crypto_pool, job)) {
+			/* the queue is full, verify the rest here */
+			vq->crypto_jobs = job->qnext;
+			crypto_job_delete(job);
+			break;
+		}
+		n++;
+	}
+	return n;
+}
+
 /**
  * Process the VALIDATE stage, the init and findkey stages are finished,
  * and the right keys are available to validate the response.
@@ -1790,6 +1872,19 @@ processValidate(struct module_qstate* qstate, struct val_qstate* vq,
 		vq->chase_reply->security = sec_status_bogus;
 		return 1;
 	}
+
+	/* verify the signatures on the crypto threads, and continue here
+	 * when they are done */
+	if(qstate->env->crypto_pool && !vq->crypto_wait &&
+		val_crypto_submit(qstate, vq, ve, id) > 0) {
+		verbose(VERB_ALGO, "validate: wait for the crypto threads");
+		vq->crypto_wait = 1;
+		vq->state = VAL_VALIDATE_STATE;
+		qstate->ext_state[id] = module_wait_reply;
+		return 0;
+	}
+	vq->crypto_wait = 0;
+
 	subtype = val_classify_response(qstate->query_flags, &qstate->qinfo,
 		&vq->qchase, vq->orig_msg->rep, vq->rrset_skip);
 	if(subtype != VAL_CLASS_REFERRAL)
@@ -2200,6 +2295,13 @@ processFinished(struct module_qstate* qstate, struct val_qstate* vq,
 			log_err("out of memory caching validator results");
 		}
 	}
+	/* store the NSECs of secure denials into the negative cache, for
+	 * the aggressive use of them, after the rrsets are in the cache */
+	if(ve->neg_cache->aggressive &&
+		vq->orig_msg->rep->security == sec_status_secure &&
+		(subtype == VAL_CLASS_NAMEERROR || subtype == VAL_CLASS_NODATA ||
+		subtype == VAL_CLASS_CNAMENOANSWER))
+		val_neg_addreply(ve->neg_cache, vq->orig_msg->rep);
 	qstate->return_rcode = LDNS_RCODE_NOERROR;
 	qstate->return_msg = vq->orig_msg;
 	qstate->ext_state[id] = module_finished;
@@ -3128,6 +3230,13 @@ val_clear(struct module_qstate* qstate, int id)
 {
 	if(!qstate)
 		return;
+	/* jobs in the crypto pool do not return to this query */
+	if(qstate->minfo[id]) {
+		struct crypto_job* job = ((struct val_qstate*)qstate->
+			minfo[id])->crypto_jobs;
+		for(; job; job = job->qnext)
+			job->qstate = NULL;
+	}
 	/* everything is allocated in the region, so assign NULL */
 	qstate->minfo[id] = NULL;
 }
@@ -3139,6 +3248,8 @@ val_get_mem(struct module_env* env, int id)
 	if(!ve)
 		return 0;
 	return sizeof(*ve) + key_cache_get_mem(ve->kcache) + 
+		sig_cache_get_mem(ve->sigcache) +
+		nsec3_hash_cache_get_mem(ve->nsec3cache) +
 		val_neg_get_mem(ve->neg_cache) +
 		sizeof(size_t)*2*ve->nsec3_keyiter_count;
 }
@@ -47,6 +47,9 @@
 #include "validator/val_utils.h"
 struct val_anchors;
 struct key_cache;
+struct sig_cache;
+struct nsec3_hash_cache;
+struct crypto_job;
 struct key_entry_key;
 struct val_neg_cache;
 struct config_strlist;
@@ -78,6 +81,12 @@ struct val_env {
 	/** aggressive negative cache. index into NSECs in rrset cache. */
 	struct val_neg_cache* neg_cache;
 
+	/** cache of signatures that verified, NULL if disabled */
+	struct sig_cache* sigcache;
+
+	/** cache of NSEC3 hashes, NULL if disabled */
+	struct nsec3_hash_cache* nsec3cache;
+
 	/** for debug testing a fixed validation date can be entered.
 	 * if 0, current time is used for rrsig validation */
 	int32_t date_override;
@@ -112,6 +121,10 @@ struct val_env {
 	 */
 	size_t* nsec3_maxiter;
 
+	/** NSEC3 maximum iteration count for any key size, NSEC3s with
+	 * more iterations are not hashed and the answer is insecure */
+	size_t nsec3_iter_ceiling;
+
 	/** lock on bogus counter */
 	lock_basic_type bogus_lock;
 	/** number of times rrsets marked bogus */
@@ -231,6 +244,12 @@ struct val_qstate {
 		dlv_ask_higher, /* ask again */
 		dlv_there_is_no_dlv /* got no DLV, sure of it */
 	} dlv_status;
+
+	/** the jobs in the crypto pool that have not finished */
+	struct crypto_job* crypto_jobs;
+	/** true if the signatures were sent to the crypto pool, and the
+	 * state continues after the jobs are done */
+	int crypto_wait;
 };
 
 /**